@@ -29,12 +29,15 @@
 // IMU related
 #include "src/BMI270.h"          // Accelerometer and Gyroscope
 #include "src/BMM150class.h"     // Magnetometer
-#include "src/IMUFusion.h"       // Sensor fusion
+#include "src/AHRSEngine.h"      // Quaternion attitude filter
+#include "src/SensorTask.h"      // Dedicated sensor task (core 0)
 
 // GPS related
 #include "src/AtomicBaseGPS.h"   // AtomicBase GPS module
 #include <TinyGPSPlus.h>         // GPS parser
 #include "src/GPSDataManager.h"  // GPS data storage manager
+#include "src/PersistenceStore.h" // Coalesced NVS storage
+#include "src/TimeBase.h"        // GPS-disciplined UTC clock
 
 // Display related
 #include "src/CompassDisplay.h"  // Compass display
@@ -45,16 +48,49 @@
 
 // Celestial calculations
 #include "src/celestial_math.h"  // Custom celestial calculations
+#include "src/Ephemeris.h"       // Cached ephemeris service
 
 // Calibration and Settings
 #include "src/CalibrationManager.h" // Sensor calibration
 #include "src/SettingsManager.h"    // User settings
 #include "src/SettingsMenu.h"       // Settings menu interface
+#include "src/PowerManager.h"       // Display dimming, clock scaling and light sleep
+#include "src/SessionRecorder.h"    // Binary session log on LittleFS
+#include "src/RefreshScheduler.h"   // Adaptive display refresh
+#include "src/BleStreamer.h"        // BLE streaming of orientation and alignment
+#include "src/WifiAssist.h"         // Wi-Fi NTP time and GPS assist data
+#include "src/OtaUpdater.h"         // Firmware updates into the inactive app slot
+
+// Logging
+#include "src/Logger.h"             // Compile-time log levels
+#include "src/BootSequencer.h"      // Boot stage timing
+#include "src/Profiler.h"           // Loop profiler
+#include "src/AllocationTrap.h"     // Steady-state heap check (debug builds)
+#include "src/UiStateMachine.h"     // Non-blocking UI flows
 
 // Constants
 #define GPS_BAUD 9600        // GPS baud rate
 #define SERIAL_BAUD 115200   // Serial monitor baud rate
-#define UPDATE_INTERVAL 200  // LCD更新間隔（ミリ秒）- 応答性向上のため短く設定
+#define MAG_CAL_TIMEOUT_MS 30000         // 磁力計キャリブレーションの制限時間（ミリ秒）
+#define CAL_FLOW_RESULT_MS 2000          // キャリブレーション結果の表示時間
+#define CAL_FLOW_DRAW_MS 50              // キャリブレーション中の進捗の描画間隔
+#define UI_TOAST_MS 1500                 // 長押しで切り替えた設定の表示時間
+#define CAL_SAVE_INTERVAL_MS 1800000     // バックグラウンドで更新された較正値の保存間隔（ミリ秒）
+#define BOOT_IMU_TIMEOUT_MS 3000         // IMU検出がこれを超えたら遅延として記録する（完了までは待つ）
+#define BOOT_IMU_RETRY_DELAY_MS 100      // IMU検出に失敗した場合の再試行までの待ち時間（ミリ秒）
+#define SESSION_GPS_INTERVAL_MS 1000     // GPSレコードの記録間隔（ミリ秒）
+#define SESSION_ORIENT_INTERVAL_MS 200   // 姿勢・極軸誤差の記録間隔（画面点灯中）
+#define SESSION_IDLE_INTERVAL_MS 1000    // 同上（減光・消灯中）
+#define DISPLAY_PREDICTION 1             // 表示の遅れをジャイロで補う（0で無効）
+#define DISPLAY_PANEL_LATENCY_US 8000    // 転送してからパネルに表示されるまで（走査の半分）
+#define DISPLAY_MAX_PREDICTION_US 150000 // これより古いスナップショットは予測しない
+#define FINE_ENTER_DEG 1.0f              // 方位・高度の誤差がともにこれ未満で微調整画面に入る
+#define FINE_EXIT_DEG 1.5f               // どちらかがこれを超えたら通常の画面に戻る
+#define FINE_FRAME_MS 100                // 微調整画面の描画間隔（平均値は細かく動くため一定間隔）
+#define FINE_SENSOR_RATE_HZ SENSOR_RATE_400HZ // 微調整中のIMUサンプリング周期
+#define BLE_CONTEXT_INTERVAL_MS 200      // BLEへ極の位置・GPSの状態を渡す間隔
+#define WIFI_POSITION_INTERVAL_MS 1000   // 受信機の初期化に使う位置を渡す間隔
+#define WIFI_SERIAL_LINE_SIZE 256        // シリアルのコマンド行の最大長
 
 // GPS pins for AtomicBase GPS
 // 注: これらの定義はAtomicBaseGPS.hですでに定義されているため、ここでは参照用です
@@ -65,14 +101,25 @@
 AtomicBaseGPS gps;           // GPS object
 BMI270 bmi270;               // IMU object
 BMM150class bmm150;          // Magnetometer object
-IMUFusion imuFusion(&bmi270, &bmm150); // Sensor fusion
 CompassDisplay display;      // Display object
 RawDataDisplay rawDisplay;   // Raw data display object
-CalibrationManager calibrationManager(&bmi270, &bmm150); // Calibration manager
-SettingsManager settingsManager;  // Settings manager
+PersistenceStore persistence;  // NVS storage shared by the managers below
+CalibrationManager calibrationManager(&bmi270, &bmm150, &persistence); // Calibration manager
+PowerManager powerManager;      // Display dimming, clock scaling and light sleep
+SettingsManager settingsManager(&persistence, &powerManager);  // Settings manager
 SettingsMenu settingsMenu(&settingsManager); // Settings menu
-GPSDataManager gpsDataManager;  // GPS data manager
+GPSDataManager gpsDataManager(&persistence);  // GPS data manager
 StartupScreen startupScreen;    // Startup screen object
+Ephemeris ephemeris;            // Cached celestial positions
+TimeBase timeBase;              // UTC clock disciplined by the GPS task
+CelestialOverlay celestialOverlay; // Rise/set times and the Polaris hour angle
+SensorTask sensorTask(&bmi270); // Sensor task (IMU sampling and AHRS on core 0)
+BootSequencer bootSequencer;    // Boot stage timing
+SessionRecorder sessionRecorder; // Binary session log (Data Logging setting)
+RefreshScheduler refreshScheduler; // Display refresh driven by the attitude change
+BleStreamer bleStreamer(&sensorTask); // BLE streaming (Bluetooth setting)
+OtaUpdater otaUpdater;          // Firmware updates with rollback
+WifiAssist wifiAssist(&persistence, &timeBase, &gps, &otaUpdater); // NTP, GPS assist and OTA over Wi-Fi
 
 // GPS data
 float latitude = 0.0;
@@ -103,11 +150,21 @@ int minute = 0;
 int second = 0;
 
 // IMU data
+// センサータスクが公開するスナップショットのUIタスク側コピー
+// （readIMU()で更新され、UIタスク以外からは書き込まない）
+OrientationData orientation;
+// heading/pitch/rollは描画時にクォータニオンから変換する（updateDisplay()）
 float heading = 0.0;         // Compass heading in degrees
 float heading_raw = 0.0;     // 磁力計の生値から計算した方位角
 bool use_raw_heading = true; // 生値の方位角を使用するフラグ
 float pitch = 0.0;           // Pitch angle in degrees
 float roll = 0.0;            // Roll angle in degrees
+// 予測前の値（センサータスクが出力した姿勢そのもの、ログ用）
+float measuredHeading = 0.0;
+float measuredPitch = 0.0;
+float measuredRoll = 0.0;
+float predictionLeadMs = 0.0; // 描画した姿勢を進めた時間
+bool fineAlignment = false;   // 極軸合わせの微調整画面（センサータスクで平均中）
 bool imuCalibrated = false;
 
 // Celestial data
@@ -130,17 +187,32 @@ RawDataMode previousRawMode = RAW_IMU;
 
 // Function prototypes
 void setupHardware();
-void setupIMU();
-void setupGPS();
+bool setupIMU(void* arg);
+bool setupGPS();
 void readGPS();
 void readIMU();
 void calculateCelestialPositions();
 void updateDisplay();
+void predictDisplayAttitude(int64_t nowUs, float quat[4]);
+void updateFineAlignment();
+void showFineAlignment();
 void handleButtonPress();
 void cycleDisplayMode();
 void handleLongPress();
 void cycleRawDataMode();
-void calibrateIMU();
+void serviceUiFlows();
+void showHeadingMethodToast();
+void saveBackgroundCalibration();
+void recordSession();
+void serviceBluetooth();
+void serviceWifiAssist();
+void handleSerialLine(char* line);
+void handleSerialCommands();
+bool showsAttitude();
+
+// UI flows (the tables are defined with their handlers further down)
+extern UiStateMachine toastFlow;
+extern UiStateMachine calibrationFlow;
 
 // Get temperature from internal sensor
 float getTemperature() {
@@ -148,11 +220,10 @@ float getTemperature() {
   // BMI270の内部温度センサーを使用
   float temp = 0.0f;
   
-  // M5.Imu.getTemp()を使用して温度を取得
-  if (M5.Imu.getType()) {
-    M5.Imu.getTemp(&temp);
-    Serial.print("IMU Temperature: ");
-    Serial.println(temp);
+  // センサータスクが読み出した温度を使用（I2Cバスをタスク間で共有しないため）
+  if (orientation.temperatureOk) {
+    temp = orientation.temperature;
+    LOG_V_EVERY(LOG_TAG_IMU, 1000, "IMU Temperature: %.1f", temp);
     return temp;
   }
   
@@ -168,35 +239,113 @@ unsigned long lastDisplayTime = 0;
 bool longPressHandled = false; // 長押し処理が実行済みかどうかのフラグ
 
 void setup() {
-  // Initialize hardware
+  // 起動時間の計測（各ステージの内訳は終了時にログとシステム情報画面に出す）
+  bootSequencer.startStage(BOOT_STAGE_HARDWARE);
   setupHardware();
+  powerManager.begin();  // loop()と同じタスクから呼ぶ（起床通知の宛先になる）
+  otaUpdater.beginBootCheck();  // 更新後の初回起動なら、正常に動作するまで確定しない
+  bootSequencer.endStage(BOOT_STAGE_HARDWARE);
   
-  // Initialize startup screen
-  startupScreen.begin();
+  // IMUの検出はI2Cだけを使うため、ロゴの展開・GPS・NVS・表示の初期化と並列にコア0で行う
+  // （センサータスクを開始する前に完了を待つ）
+  bootSequencer.startParallel(BOOT_STAGE_IMU, setupIMU, nullptr);
   
-  // Show splash screen
+  // Show splash screen (初期化の間そのまま表示しておき、固定の待ち時間は設けない)
+  bootSequencer.startStage(BOOT_STAGE_SPLASH);
+  startupScreen.begin();
   startupScreen.showSplashScreen();
+  bootSequencer.endStage(BOOT_STAGE_SPLASH);
   
-  // Wait for splash screen display
-  delay(2000);
-  
-  // Initialize sensors
-  setupIMU();
-  setupGPS();
-  display.begin();
+  // Initialize GPS (最初の受信は待たず、測位はGPSタスクがバックグラウンドで続ける)
+  bootSequencer.startStage(BOOT_STAGE_GPS);
+  bootSequencer.endStage(BOOT_STAGE_GPS, setupGPS());
   
-  // Initialize other components
-  rawDisplay.begin();
+  // 保存データは1回でまとめて読み込み、各マネージャーはそこから取得する
+  bootSequencer.startStage(BOOT_STAGE_STORAGE);
+  persistence.begin();
   calibrationManager.begin();
   settingsManager.begin();
   settingsMenu.begin();
   gpsDataManager.begin();
+  sessionRecorder.begin();
+  wifiAssist.begin();
+  bootSequencer.endStage(BOOT_STAGE_STORAGE);
+  
+  // 接続先が設定されていれば、GPSの初回測位を待たずにNTPで時刻を合わせて受信機に補助データを送る
+  if (wifiAssist.isConfigured() && settingsManager.getTimeSource() != TIME_MANUAL) {
+    wifiAssist.request();
+  }
+  
+  bootSequencer.startStage(BOOT_STAGE_DISPLAY);
+  display.begin();
+  rawDisplay.begin();
+  bootSequencer.endStage(BOOT_STAGE_DISPLAY);
+  
+  // Wait for the IMU
+  bool imuOk = bootSequencer.waitParallel(BOOT_STAGE_IMU, BOOT_IMU_TIMEOUT_MS);
+  if (imuOk) {
+    startupScreen.showInitProgress("IMU OK", 50);
+  } else {
+    startupScreen.showInitError("IMU Failed!");
+  }
+  
+  // センサータスクを開始（以降、IMUへのアクセスはセンサータスクのみが行う）
+  // サンプリング周期は設定から取得するため、settingsManager.begin()の後に開始する
+  bootSequencer.startStage(BOOT_STAGE_SENSOR_TASK);
+  bool sensorTaskOk = false;
+  if (imuOk) {
+    sensorTask.setAlgorithm(settingsManager.getAhrsAlgorithm());
+    
+    // 保存済みの磁力計較正を読み込む（起動後もセンサータスクが学習を続ける）
+    MagCalibration magCal;
+    if (calibrationManager.getMagCalibration(&magCal)) {
+      sensorTask.setMagCalibration(magCal);
+      imuCalibrated = true;
+    }
+    
+    // ジャイロバイアスの温度モデルも開始前に渡す（静止観測までの補正に使う）
+    GyroTempModel gyroModel;
+    if (calibrationManager.getGyroTempModel(&gyroModel)) {
+      sensorTask.setGyroTempModel(gyroModel);
+    }
+    
+    // 動きを検出したら減光・消灯中の画面を点灯させる
+    sensorTask.setMotionCallback(PowerManager::motionWake, &powerManager);
+    
+    // 生のIMUサンプルはバッチごとに記録側へ渡す（記録中でなければすぐ戻る）
+    sensorTask.setBatchCallback(SessionRecorder::imuBatchCallback, &sessionRecorder);
+    
+    sensorTaskOk = sensorTask.begin(settingsManager.getImuSampleRate());
+    if (!sensorTaskOk) {
+      startupScreen.showInitError("Sensor Task Failed!");
+    }
+  }
+  bootSequencer.endStage(BOOT_STAGE_SENSOR_TASK, sensorTaskOk);
+  
+  // BLEのタスクは常に作っておき、スタックはBluetooth設定が有効になってから起動する
+  bleStreamer.begin();
+  
+  // ウォームスタート: 保存された位置で極の高度と偏角を計算しておき、
+  // 最初の画面から極軸合わせに使えるようにする（測位後はreadGPS()が切り替える）。
+  // 時角や太陽・月はGPSかNTPで時刻が合うまで表示しない
+  readGPS();
+  if (gpsValid && !gps.isValid()) {
+    LOG_I(LOG_TAG_GPS, "Warm start from stored position %.4f, %.4f", latitude, longitude);
+  }
+  calculateCelestialPositions();
   
   // Initialize timing
   lastUpdateTime = millis();
   
   // Show initialization complete
   startupScreen.showInitComplete();
+  bootSequencer.finish();
+  
+  // これ以降、UI・センサー・GPSタスクはヒープを使わない（ALLOC_TRAP_ENABLEDで検証）
+  AllocationTrap::guardTask(xTaskGetCurrentTaskHandle());
+  AllocationTrap::guardTask(xTaskGetHandle("SensorTask"));
+  AllocationTrap::guardTask(xTaskGetHandle("gps"));
+  AllocationTrap::arm();
 }
 
 void setupHardware() {
@@ -215,61 +364,43 @@ void setupHardware() {
   M5.Display.setColorDepth(16);       // Set color depth to 16-bit
   M5.Display.setSwapBytes(true);      // Swap byte order
   
-  // 画面の初期化のみを行う（背景色は設定しない）
+  // 画面の初期化のみを行う（スプラッシュ画面がすぐに上書きする）
   M5.Display.clear();
   
-  // 下部18ピクセルに2行だけで表示
-  M5.Display.fillRect(0, M5.Display.height() - 18, M5.Display.width(), 18, TFT_BLACK);
-  M5.Display.setTextColor(TFT_WHITE);
-  M5.Display.setTextSize(1.0);
-  M5.Display.setCursor(5, M5.Display.height() - 18);
-  M5.Display.println("Polaris Navigator");
-  M5.Display.setCursor(5, M5.Display.height() - 8);
-  M5.Display.println("Initializing...");
-  
   Serial.println("Polaris Navigator initializing...");
 }
 
-void setupIMU() {
-  // 初期化状態を表示（StartupScreenクラスを使用）
-  startupScreen.showInitProgress("IMU Init...", 30);
+// Runs on the boot helper task (core 0): no drawing here, the display belongs to setup()
+bool setupIMU(void* arg) {
+  (void)arg;
   
   // M5Unifiedライブラリを使用してIMUを初期化
   bool initResult = M5.Imu.init();
-  Serial.print("IMU init result: ");
-  Serial.println(initResult ? "Success" : "Failed");
+  LOG_I(LOG_TAG_IMU, "IMU init result: %s", initResult ? "Success" : "Failed");
   
   // センサー初期化チェック
   int imuType = M5.Imu.getType();
-  Serial.print("IMU Type: ");
-  Serial.println(imuType);
+  LOG_I(LOG_TAG_IMU, "IMU Type: %d", imuType);
   
   if(!imuType){
-    // 初期化失敗の場合
-    startupScreen.showInitError("IMU Init Failed!");
-    
-    Serial.println("IMU initialization failed! No IMU detected.");
-    
-    // 再試行
-    Serial.println("Retrying IMU initialization...");
-    delay(500);
+    // 初期化失敗の場合は少し待って再試行（電源投入直後はセンサーの起動が遅れることがある）
+    LOG_W(LOG_TAG_IMU, "IMU initialization failed! No IMU detected. Retrying...");
+    delay(BOOT_IMU_RETRY_DELAY_MS);
     initResult = M5.Imu.init();
     imuType = M5.Imu.getType();
     
     if(!imuType) {
-      Serial.println("IMU retry failed. Check hardware connections.");
-      startupScreen.showInitError("IMU Failed!");
-      delay(1000);
-      return;
+      LOG_E(LOG_TAG_IMU, "IMU retry failed. Check hardware connections.");
+      return false;
     }
   }
   
   // センサー初期化成功
-  startupScreen.showInitProgress("IMU OK", 50);
-  Serial.println("IMU initialized successfully");
+  LOG_I(LOG_TAG_IMU, "IMU initialized successfully");
+  return true;
 }
 
-void setupGPS() {
+bool setupGPS() {
   // 初期化状態を表示（StartupScreenクラスを使用）
   startupScreen.showInitProgress("GPS Init...", 60);
   
@@ -280,6 +411,12 @@ void setupGPS() {
   Serial.print("GPS_RX_PIN: ");
   Serial.println(GPS_RX_PIN);
   
+  // 時刻はGPSタスクがTimeBaseに反映し、天体計算はTimeBaseから読む
+  // （解析タスクの起動前に設定する）
+  gps.setTimeBase(&timeBase);
+  timeBase.beginPps(TIMEBASE_PPS_PIN);
+  ephemeris.setTimeBase(&timeBase);
+  
   // AtomicBaseGPSクラスのデフォルトピン設定を使用
   bool gpsResult = gps.begin(GPS_BAUD);
   if (gpsResult) {
@@ -291,50 +428,25 @@ void setupGPS() {
     
     // 再試行
     Serial.println("Retrying GPS initialization...");
-    delay(500);
     gpsResult = gps.begin(GPS_BAUD);
     if (gpsResult) {
       startupScreen.showInitProgress("GPS Retry OK", 70);
       Serial.println("GPS retry successful");
     } else {
+      // GPSが初期化できなくても、保存された位置でアプリケーションは続行する
       startupScreen.showInitError("GPS Failed");
       Serial.println("GPS retry failed. Check hardware connections.");
-      delay(1000);
-      return;
-    }
-  }
-  
-  // Check Serial2 status
-  Serial.print("Serial2 available: ");
-  Serial.println(Serial2 ? "Yes" : "No");
-  
-  // Wait for initial GPS data
-  Serial.println("Waiting for initial GPS data...");
-  startupScreen.showInitProgress("Waiting for GPS...", 75);
-  
-  // Try to get initial GPS data with timeout
-  unsigned long startTime = millis();
-  bool initialDataReceived = false;
-  
-  while (millis() - startTime < 5000) { // 5秒間待機
-    gps.update();
-    if (Serial2.available() > 0) {
-      initialDataReceived = true;
-      break;
+      return false;
     }
-    delay(100);
   }
   
-  if (initialDataReceived) {
-    startupScreen.showInitProgress("GPS Signal OK", 80);
-    Serial.println("Initial GPS data received");
-  } else {
-    startupScreen.showInitProgress("No GPS Signal", 80);
-    Serial.println("No initial GPS data received within timeout");
+  // 送信線が配線されていれば受信機を高速ボーレート・高更新レートに設定する
+  if (gps.configure(GPS_UPDATE_RATE_HZ)) {
+    startupScreen.showInitProgress("GPS Fast Mode", 72);
   }
   
-  // GPSが初期化できなくても、アプリケーションは続行できるようにする
-  delay(1000);
+  // 最初の受信・測位は待たない（GPSタスクが受信を続け、readGPS()が測位後に切り替える）
+  return true;
 }
 
 void readGPS() {
@@ -372,18 +484,7 @@ void readGPS() {
         timeValid = true;
         
         // デバッグ用時刻出力
-        Serial.print("Date/Time: ");
-        Serial.print(year);
-        Serial.print("-");
-        Serial.print(month);
-        Serial.print("-");
-        Serial.print(day);
-        Serial.print(" ");
-        Serial.print(hour);
-        Serial.print(":");
-        Serial.print(minute);
-        Serial.print(":");
-        Serial.println(second);
+        LOG_I(LOG_TAG_GPS, "Date/Time: %d-%d-%d %d:%d:%d", year, month, day, hour, minute, second);
         
         // 有効なGPSデータをGPSDataManagerに保存
         GPSData data;
@@ -404,26 +505,19 @@ void readGPS() {
         
         // 更新理由をデバッグ出力
         if (!wasGpsValid) {
-          Serial.println("GPS data updated: Signal newly acquired");
+          bootSequencer.noteFirstFix();
+          LOG_I(LOG_TAG_GPS, "GPS data updated: Signal newly acquired");
         } else {
-          Serial.println("GPS data updated: 60-minute interval");
+          LOG_I(LOG_TAG_GPS, "GPS data updated: 60-minute interval");
         }
       }
       
       // デバッグ出力
-      Serial.print("GPS: ");
-      Serial.print(latitude, 6);
-      Serial.print(", ");
-      Serial.print(longitude, 6);
-      Serial.print(" Alt: ");
-      Serial.print(altitude);
-      Serial.print("m Sats: ");
-      Serial.print(satellites);
-      Serial.print(" HDOP: ");
-      Serial.println(hdop);
+      LOG_I(LOG_TAG_GPS, "GPS: %.6f, %.6f Alt: %.2fm Sats: %d HDOP: %.2f",
+            latitude, longitude, altitude, satellites, hdop);
     } else {
       // 更新しない場合のデバッグ出力
-      Serial.println("Using current GPS data (update not needed)");
+      LOG_V_EVERY(LOG_TAG_GPS, 1000, "Using current GPS data (update not needed)");
     }
     
     // GPS有効フラグを更新
@@ -442,35 +536,13 @@ void readGPS() {
       satellites = savedData.satellites;
       hdop = savedData.hdop;
       
-      year = savedData.year;
-      month = savedData.month;
-      day = savedData.day;
-      hour = savedData.hour;
-      minute = savedData.minute;
-      second = savedData.second;
-      
-      // 保存されたデータを使用していることを示すデバッグ出力
-      Serial.println("Using saved GPS data:");
-      Serial.print("Location: ");
-      Serial.print(latitude, 6);
-      Serial.print(", ");
-      Serial.println(longitude, 6);
-      Serial.print("Date/Time: ");
-      Serial.print(year);
-      Serial.print("-");
-      Serial.print(month);
-      Serial.print("-");
-      Serial.print(day);
-      Serial.print(" ");
-      Serial.print(hour);
-      Serial.print(":");
-      Serial.print(minute);
-      Serial.print(":");
-      Serial.println(second);
+      // 保存された日時は使わない（電源を切っていた時間だけずれるため、
+      // 時刻はTimeBaseがGPSかNTPで合わせるまで無効のままにする）
+      LOG_D_EVERY(LOG_TAG_GPS, 5000, "Using saved GPS position: %.6f, %.6f",
+                  latitude, longitude);
       
-      // GPS有効フラグとタイム有効フラグを更新
+      // GPS有効フラグを更新（位置のみ）
       gpsValid = true;
-      timeValid = true;
     }
     
     // GPS無効フラグを更新
@@ -483,254 +555,139 @@ void readGPS() {
     wasGpsValid = false;
     
     // デバッグ出力
-    Serial.println("No GPS signal and no saved data available");
+    LOG_D_EVERY(LOG_TAG_GPS, 5000, "No GPS signal and no saved data available");
+  }
+  
+  // GPSで合わせた時刻がある場合、日時は保存データではなく現在のUTCを使う
+  // （測位が途切れても時刻は進み続ける）
+  if (timeBase.getUtc(&year, &month, &day, &hour, &minute, &second)) {
+    timeValid = true;
   }
 }
 
 void readIMU() {
-  // M5Unifiedライブラリを使用してIMUデータを取得
-  float acc[3], gyro[3], mag[3];
-  bool accOk = false, gyroOk = false, magOk = false;
-  
-  // センサーデータを取得
-  accOk = M5.Imu.getAccel(&acc[0], &acc[1], &acc[2]);    // 加速度 (g)
-  gyroOk = M5.Imu.getGyro(&gyro[0], &gyro[1], &gyro[2]);  // 角速度 (dps)
-  magOk = M5.Imu.getMag(&mag[0], &mag[1], &mag[2]);      // 地磁気 (μT)
-  
-  // 定期的にセンサー状態をレポート
-  static unsigned long lastSensorReport = 0;
-  if (millis() - lastSensorReport > 10000) {  // 10秒ごと
-    Serial.println("IMU Sensor Status:");
-    Serial.print("Accelerometer: ");
-    Serial.println(accOk ? "OK" : "Failed");
-    Serial.print("Gyroscope: ");
-    Serial.println(gyroOk ? "OK" : "Failed");
-    Serial.print("Magnetometer: ");
-    Serial.println(magOk ? "OK" : "Failed");
-    lastSensorReport = millis();
-  }
-  
-  // AtomS3R IMU座標系に合わせて軸を調整
-  // 注: AtomS3Rの物理的な向きに合わせて、軸の対応関係を調整
-  //     X軸: デバイスの右方向
-  //     Y軸: デバイスの上方向
-  //     Z軸: デバイスの画面から外向き
-  
-  // 極軸合わせ用の座標系に変換
-  // 極軸合わせでは、デバイスの上面（-X方向）を天の北極/南極に向ける
-  float acc_adj[3], mag_adj[3];
-  
-  // 加速度データの軸調整（軸の入れ替えと符号の反転）
-  // 問題: デバイスをロール方向に傾けるとピッチが変化する
-  // 解決: 軸の対応関係を修正
-  acc_adj[0] = acc[1];  // X軸をY軸に変更（デバイスの上方向を右方向と再定義）
-  acc_adj[1] = -acc[0]; // Y軸を-X軸に変更（デバイスの右方向を下方向と再定義）
-  acc_adj[2] = acc[2];  // Z軸はそのまま（画面垂直方向）
-  
-  // 地磁気データの軸調整（加速度と同様の調整）
-  mag_adj[0] = mag[1];  // X軸をY軸に変更
-  mag_adj[1] = -mag[0]; // Y軸を-X軸に変更
-  mag_adj[2] = mag[2];  // Z軸はそのまま
-  
-  // ピッチとロールの計算
-  // 重力ベクトルからピッチとロールを計算
-  if (accOk) {
-    // ピッチ: X-Z平面での傾き（+/-90度）
-    // 修正: 調整後のX軸を基準にした傾き角度
-    pitch = atan2(acc_adj[0], sqrt(acc_adj[1] * acc_adj[1] + acc_adj[2] * acc_adj[2])) * 180.0 / PI;
-    
-    // ロール: Y-Z平面での傾き（+/-180度）
-    // 修正: 調整後のY軸とZ軸の関係から計算
-    roll = atan2(acc_adj[1], acc_adj[2]) * 180.0 / PI;
-    
-    // デバッグ: 生のセンサー値と計算された角度の関係を確認
-    Serial.print("Raw Accel vs Angles: ");
-    Serial.print("X="); Serial.print(acc[0]);
-    Serial.print(", Y="); Serial.print(acc[1]);
-    Serial.print(", Z="); Serial.print(acc[2]);
-    Serial.print(" -> Pitch="); Serial.print(pitch);
-    Serial.print(", Roll="); Serial.println(roll);
+  // センサータスクが公開した最新の姿勢スナップショットを取得
+  // IMUのサンプリングとフィルタ処理はコア0のセンサータスクで固定周期実行される
+  if (!sensorTask.getSnapshot(orientation)) {
+    // まだサンプルがない、または書き込み中で取得できなかった場合は前回の値を維持
+    return;
+  }
+  
+  bool accOk = orientation.accOk;
+  bool gyroOk = orientation.gyroOk;
+  bool magOk = orientation.magOk;
+  const float* acc = orientation.acc;
+  const float* gyro = orientation.gyro;
+  const float* mag = orientation.mag;
+  
+  // 定期的にセンサー状態をレポート（10秒ごと）
+  LOG_I_EVERY(LOG_TAG_IMU, 10000, "Sensors: Acc %s, Gyro %s, Mag %s | %u Hz, %u samples, %u overruns, %u invalid headings | %s batch %u, dt %.3f ms, max jitter %u us | %s error %.2f deg",
+              accOk ? "OK" : "Failed", gyroOk ? "OK" : "Failed", magOk ? "OK" : "Failed",
+              (unsigned)sensorTask.getRate(), (unsigned)orientation.sampleCount,
+              (unsigned)sensorTask.getOverruns(), (unsigned)orientation.invalidHeadings,
+              orientation.fifoMode ? "FIFO" : "register", (unsigned)orientation.batchSize,
+              orientation.dt * 1000.0f, (unsigned)orientation.maxJitterUs,
+              AHRSEngine::getAlgorithmName((AHRSAlgorithm)orientation.algorithm),
+              orientation.attitudeError);
+  
+  // 補正後の磁場の大きさが較正値から外れている場合は近くの金属や磁石の影響
+  imuCalibrated = orientation.magCalValid;
+  if (magOk && orientation.magDisturbed) {
+    LOG_W_EVERY(LOG_TAG_IMU, 10000, "Magnetic interference detected, field %.1f uT", orientation.magField);
   }
   
-  // 方位角の計算（ティルト補正あり）
+  // 姿勢はクォータニオンのまま保持し、オイラー角には描画時に変換する
   if (accOk && magOk) {
-    // ピッチとロールを考慮した方位角の計算
-    float pitch_rad = pitch * PI / 180.0;
-    float roll_rad = roll * PI / 180.0;
-    
-    // 地磁気データをティルト補正
-    // 水平面に投影するための補正計算
-    float mag_x = mag_adj[0] * cos(pitch_rad) + mag_adj[2] * sin(pitch_rad);
-    float mag_y = mag_adj[0] * sin(roll_rad) * sin(pitch_rad) + 
-                 mag_adj[1] * cos(roll_rad) - 
-                 mag_adj[2] * sin(roll_rad) * cos(pitch_rad);
-    
-    // 補正後の地磁気データから方位角を計算
-    heading = atan2(mag_y, mag_x) * 180.0 / PI;
-    
-    // 0-360度の範囲に変換
-    if (heading < 0) {
-      heading += 360.0;
-    }
-    
-    // 異常値チェック
-    static float lastValidHeading = heading;
-    if (isnan(heading) || heading < 0 || heading > 360) {
-      Serial.println("Warning: Invalid heading detected, using last valid value");
-      heading = lastValidHeading;
-    } else {
-      // 有効な値の場合は保存
-      lastValidHeading = heading;
-    }
-    
-    // 簡単なローパスフィルタを適用して急激な変化を抑制
-    static float filteredHeading = heading;
-    filteredHeading = 0.9 * filteredHeading + 0.1 * heading;
-    heading = filteredHeading;
-    
-    // 実験的な実装: 磁力計の生値から直接方位角を計算
-    // 生値から単純にatan2を使用して方位角を計算（傾き補正なし）
-    heading_raw = atan2(mag_adj[1], mag_adj[0]) * 180.0 / PI;
-    
-    // 0-360度の範囲に変換
-    if (heading_raw < 0) {
-      heading_raw += 360.0;
-    }
-    
-    // 異常値チェック
-    static float lastValidHeadingRaw = heading_raw;
-    if (isnan(heading_raw) || heading_raw < 0 || heading_raw > 360) {
-      Serial.println("Warning: Invalid raw heading detected, using last valid value");
-      heading_raw = lastValidHeadingRaw;
-    } else {
-      // 有効な値の場合は保存
-      lastValidHeadingRaw = heading_raw;
-    }
-    
-    // 簡単なローパスフィルタを適用して急激な変化を抑制
-    static float filteredHeadingRaw = heading_raw;
-    filteredHeadingRaw = 0.9 * filteredHeadingRaw + 0.1 * heading_raw;
-    heading_raw = filteredHeadingRaw;
+    heading_raw = orientation.headingRaw;
     
     // 使用する方位角を選択
-    if (use_raw_heading) {
-      // 生値の方位角をheadingに上書き
-      Serial.println("Using RAW heading value (no tilt compensation)");
-    } else {
-      Serial.println("Using tilt-compensated heading value");
-    }
-    
+    LOG_V_EVERY(LOG_TAG_IMU, 1000, use_raw_heading ? "Using RAW heading value (no tilt compensation)"
+                                                   : "Using tilt-compensated heading value");
   } else {
     // センサーデータが無効な場合は前回の値を維持
-    Serial.println("Warning: Cannot calculate heading, sensor data unavailable");
+    LOG_W_EVERY(LOG_TAG_IMU, 1000, "Cannot calculate heading, sensor data unavailable");
   }
   
-  // デバッグ出力
-  Serial.print("Orientation: Heading=");
-  Serial.print(heading);
-  Serial.print(", Heading_Raw=");
-  Serial.print(heading_raw);
-  Serial.print(", Pitch=");
-  Serial.print(pitch);
-  Serial.print(", Roll=");
-  Serial.println(roll);
-  
-  // センサーデータが有効な場合のみ詳細情報を出力
-  if (accOk) {
-    Serial.print("Accel (g): X=");
-    Serial.print(acc[0]);
-    Serial.print(", Y=");
-    Serial.print(acc[1]);
-    Serial.print(", Z=");
-    Serial.println(acc[2]);
-    
-    Serial.print("Accel Adjusted: X=");
-    Serial.print(acc_adj[0]);
-    Serial.print(", Y=");
-    Serial.print(acc_adj[1]);
-    Serial.print(", Z=");
-    Serial.println(acc_adj[2]);
-  }
-  
-  if (gyroOk) {
-    Serial.print("Gyro (dps): X=");
-    Serial.print(gyro[0]);
-    Serial.print(", Y=");
-    Serial.print(gyro[1]);
-    Serial.print(", Z=");
-    Serial.println(gyro[2]);
-  }
-  
-  if (magOk) {
-    Serial.print("Mag (uT): X=");
-    Serial.print(mag[0]);
-    Serial.print(", Y=");
-    Serial.print(mag[1]);
-    Serial.print(", Z=");
-    Serial.println(mag[2]);
-    
-    Serial.print("Mag Adjusted: X=");
-    Serial.print(mag_adj[0]);
-    Serial.print(", Y=");
-    Serial.print(mag_adj[1]);
-    Serial.print(", Z=");
-    Serial.println(mag_adj[2]);
+  // デバッグ出力（1秒ごと）
+  if (LOG_ACTIVE(LOG_LEVEL_DEBUG)) {
+    static uint32_t lastOrientationLog = 0;
+    if (Logger::rateLimit(&lastOrientationLog, 1000)) {
+      LOG_D(LOG_TAG_IMU, "Orientation: q=(%.4f, %.4f, %.4f, %.4f), Heading_Raw=%.2f, Confidence=%.2f",
+            orientation.quat[0], orientation.quat[1], orientation.quat[2], orientation.quat[3],
+            heading_raw, orientation.confidence);
+      
+      // センサーデータが有効な場合のみ詳細情報を出力
+      if (accOk) {
+        LOG_D(LOG_TAG_IMU, "Accel (g): X=%.2f, Y=%.2f, Z=%.2f", acc[0], acc[1], acc[2]);
+      }
+      if (gyroOk) {
+        LOG_D(LOG_TAG_IMU, "Gyro (dps): X=%.2f, Y=%.2f, Z=%.2f", gyro[0], gyro[1], gyro[2]);
+      }
+      if (orientation.gyroBiasValid) {
+        LOG_D(LOG_TAG_IMU, "Gyro bias (dps): X=%.3f, Y=%.3f, Z=%.3f%s at %.1f C",
+              orientation.gyroBias[0], orientation.gyroBias[1], orientation.gyroBias[2],
+              orientation.stationary ? " (still)" : "", orientation.temperature);
+      }
+      if (magOk) {
+        LOG_D(LOG_TAG_IMU, "Mag (uT): X=%.2f, Y=%.2f, Z=%.2f", mag[0], mag[1], mag[2]);
+      }
+    }
   }
 }
 
 void calculateCelestialPositions() {
   // Calculate celestial positions based on GPS location and current time
   // GPSが無効でも最後に記録された緯度経度を使用して計算する
+  // 計算結果はEphemerisがキャッシュし、毎回の呼び出しでは時刻を進めるだけ
+  ephemeris.setLocation(latitude, longitude);
+  ephemeris.setAtmosphere(getTemperature(), altitude);  // 極の高度の大気差補正
+  if (timeValid) {
+    ephemeris.setTime(year, month, day, hour, minute, second);
+  }
+  
+  if (!ephemeris.update()) {
+    return;  // 更新周期に達していない
+  }
   
-  // Calculate magnetic declination for current location
-  magDeclination = calculateMagneticDeclination(latitude, longitude);
+  // 偏角は手動設定を優先し、未設定（0）の場合は磁気モデルの値を使う
+  magDeclination = settingsManager.resolveDeclination(ephemeris.getMagneticDeclination());
+  polarisAz = ephemeris.getPoleAzimuth();
+  polarisAlt = ephemeris.getPoleAltitude();
+  
+  if (ephemeris.hasTime()) {
+    sunAz = ephemeris.getSunAzimuth();
+    sunAlt = ephemeris.getSunAltitude();
+    moonAz = ephemeris.getMoonAzimuth();
+    moonAlt = ephemeris.getMoonAltitude();
+    moonPhase = ephemeris.getMoonPhase();
+    
+    // 出入りの時刻は次の現象が過ぎたときだけ探し直される
+    celestialOverlay.update(latitude, longitude, ephemeris.getJulianDate());
+  }
   
   // Apply magnetic declination to heading
   float trueHeading = heading;
   applyMagneticDeclination(&trueHeading, magDeclination);
   
-  // Calculate celestial pole position
-  calculatePolePosition(latitude, longitude, &polarisAz, &polarisAlt);
+  // Debug output（1秒ごと）
+  LOG_D_EVERY(LOG_TAG_CELESTIAL, 1000, "Magnetic Declination: %.2f° | Polaris/Pole: Az=%.2f° Alt=%.2f° | True Heading: %.2f",
+              magDeclination, polarisAz, polarisAlt, trueHeading);
   
-  // Calculate sun position if time is valid
   if (timeValid) {
-    calculateSunPosition(latitude, longitude, year, month, day, hour, minute, second, &sunAz, &sunAlt);
-    
-    // Calculate moon position
-    calculateMoonPosition(latitude, longitude, year, month, day, hour, minute, second, &moonAz, &moonAlt, &moonPhase);
+    LOG_D_EVERY(LOG_TAG_CELESTIAL, 1000, "Sun: Az=%.2f° Alt=%.2f° | Moon: Az=%.2f° Alt=%.2f° Phase=%.2f",
+                sunAz, sunAlt, moonAz, moonAlt, moonPhase);
   }
   
-  // Debug output
-  Serial.print("Celestial Calculations - Magnetic Declination: ");
-  Serial.print(magDeclination);
-  Serial.print("° | Polaris/Pole: Az=");
-  Serial.print(polarisAz);
-  Serial.print("° Alt=");
-  Serial.print(polarisAlt);
-  Serial.print("° | True Heading: ");
-  Serial.println(trueHeading);
-  
-  if (timeValid) {
-    Serial.print("Sun: Az=");
-    Serial.print(sunAz);
-    Serial.print("° Alt=");
-    Serial.print(sunAlt);
-    Serial.print("° | Moon: Az=");
-    Serial.print(moonAz);
-    Serial.print("° Alt=");
-    Serial.print(moonAlt);
-    Serial.print("° Phase=");
-    Serial.println(moonPhase);
-  }
-  
-  // デバッグ出力を追加 - 北極星の高度と緯度を比較
-  Serial.print("DEBUG - Latitude: ");
-  Serial.print(latitude);
-  Serial.print(", Polaris Altitude: ");
-  Serial.println(polarisAlt);
+  // 北極星の高度と緯度を比較
+  LOG_V_EVERY(LOG_TAG_CELESTIAL, 1000, "Latitude: %.2f, Polaris Altitude: %.2f", latitude, polarisAlt);
 }
 
 void updateDisplay() {
+  // 通知の表示中は描かない（消えるときに全体を描き直す）
+  if (!toastFlow.isIdle()) {
+    return;
+  }
+  
   // Static variable to record the last display mode
   static int lastMode = -1;
   static bool lastGpsValid = false;
@@ -738,27 +695,73 @@ void updateDisplay() {
   // Determine if display update is needed
   bool needUpdate = (currentMode != lastMode) || (gpsValid != lastGpsValid);
   
+  // モードが変わった場合、パネルには他の画面が描かれているので全体を再転送する
+  if (currentMode != lastMode) {
+    display.invalidate();
+  }
+  
   // Record current state
   lastMode = currentMode;
   lastGpsValid = gpsValid;
   
   // Check IMU and GPS status
-  bool imuDataAvailable = true;  // IMU data is always available
+  bool imuDataAvailable = orientation.attitudeValid;
+  
+  // 描画する直前にだけクォータニオンをオイラー角に変換する
+  // 描くのは表示されるまでの遅れの分だけジャイロで先に進めた姿勢
+  float displayHeading = heading_raw;
+  if (orientation.attitudeValid) {
+    float quat[4];
+    AHRSEngine::quaternionToEuler(orientation.quat, &measuredHeading, &measuredPitch, &measuredRoll);
+    predictDisplayAttitude(esp_timer_get_time(), quat);
+    AHRSEngine::quaternionToEuler(quat, &heading, &pitch, &roll);
+    
+    // 生値の方位角にも同じ回転を加える（ローパスの遅れの分だけ長く進める）
+    if (predictionLeadMs > 0.0f) {
+      float turn = heading - measuredHeading;
+      if (turn > 180.0f) turn -= 360.0f;
+      if (turn < -180.0f) turn += 360.0f;
+      float scale = (predictionLeadMs + SENSOR_HEADING_LPF_TAU * 1000.0f) / predictionLeadMs;
+      displayHeading = heading_raw + turn * scale;
+      if (displayHeading < 0.0f) displayHeading += 360.0f;
+      if (displayHeading >= 360.0f) displayHeading -= 360.0f;
+    }
+  }
   
   // 使用する方位角を選択
-  float displayHeading = use_raw_heading ? heading_raw : heading;
+  if (!use_raw_heading) {
+    displayHeading = heading;
+  }
+  
+  // 極の近くでは微調整画面に切り替える（他のモードに移ったら平均をやめる）
+  updateFineAlignment();
+  
+  // 真北基準の設定では偏角を加え、天体の方位（真方位）と合わせる
+  if (settingsManager.getUseNorthReference()) {
+    applyMagneticDeclination(&displayHeading, magDeclination);
+  }
   
   // Update display based on current mode
   switch (currentMode) {
     case POLAR_ALIGNMENT:
       // Polar alignment mode - Display compass with Polaris position
-      display.showPolarAlignment(displayHeading, polarisAz, polarisAlt, pitch, roll);
+      if (fineAlignment) {
+        showFineAlignment();
+      } else {
+        display.showPolarAlignment(displayHeading, polarisAz, polarisAlt, pitch, roll);
+      }
       break;
     case CELESTIAL_DATA:  
       // Celestial mode - Display compass with sun/moon positions
       display.showCelestialOverlay(displayHeading, pitch, roll, 
                                  sunAz, sunAlt, 
-                                 moonAz, moonAlt, moonPhase);
+                                 moonAz, moonAlt, moonPhase, ephemeris.hasTime());
+      break;
+    case POLARIS_CLOCK:
+      // Polaris hour-angle clock with the next sunrise/sunset
+      display.showPolarisClock(celestialOverlay.getPolarisHourAngle(), latitude,
+                               celestialOverlay.getMinutesToNextSunrise(),
+                               celestialOverlay.getMinutesToNextSunset(), ephemeris.hasTime());
       break;
     case GPS_DATA:  
       // GPS information mode - Display GPS coordinates and status
@@ -771,7 +774,7 @@ void updateDisplay() {
     case RAW_DATA:
       // Raw data mode - Display raw sensor data
       if (rawDisplay.getCurrentMode() == RAW_IMU) {
-        // IMUデータを強制的に再取得して表示を更新
+        // 最新のスナップショットを取得して表示を更新
         readIMU();
       }
       rawDisplay.update(currentRawMode);  
@@ -781,25 +784,41 @@ void updateDisplay() {
       display.showIMU();
       break;
     case CALIBRATION_MODE:
-      // Calibration mode - handled by main loop
+      // Calibration mode - drawn by the calibration flow (serviceUiFlows)
       break;
   }
   
-  // Add a small delay after updating display to reduce flickering
-  delay(1);
+  // 描画した姿勢を記録し、次の描画の要否はここからの変化で決める
+  refreshScheduler.rendered(millis());
+  
+  // サンプル時刻から転送完了までの遅れ（次のフレームの予測に使う描画時間はPROFILE_RENDER）
+  if (orientation.attitudeValid && showsAttitude()) {
+    Profiler::recordUs(PROFILE_LATENCY, (uint32_t)(esp_timer_get_time() - (int64_t)orientation.timestampUs));
+  }
+  
+  // 予測前後の姿勢（ログ用）
+  LOG_D_EVERY(LOG_TAG_DISPLAY, 1000, "Attitude measured %.2f/%.2f, drawn %.2f/%.2f (lead %.1f ms)",
+              measuredHeading, measuredPitch, heading, pitch, predictionLeadMs);
   
   // Output debug information to serial
-  Serial.print("Display Mode: ");
-  Serial.print(currentMode);
-  Serial.print(", IMU Valid: ");
-  Serial.print(imuDataAvailable ? "Yes" : "No");
-  Serial.print(", GPS Valid: ");
-  Serial.print(gpsValid ? "Yes" : "No");
-  Serial.print(", Using Raw Heading: ");
-  Serial.println(use_raw_heading ? "Yes" : "No");
+  LOG_D_EVERY(LOG_TAG_DISPLAY, 1000, "Display Mode: %d, IMU Valid: %s, GPS Valid: %s, Using Raw Heading: %s",
+              (int)currentMode, imuDataAvailable ? "Yes" : "No", gpsValid ? "Yes" : "No",
+              use_raw_heading ? "Yes" : "No");
 }
 
 void handleButtonPress() {
+  // 実行中のフローがボタンを受け取る（モードの切り替えには使わない）
+  if (!toastFlow.isIdle() && M5.BtnA.wasPressed()) {
+    toastFlow.dispatch(UI_EVENT_PRESS);
+    return;
+  }
+  if (currentMode == CALIBRATION_MODE) {
+    if (M5.BtnA.wasPressed()) {
+      calibrationFlow.dispatch(UI_EVENT_PRESS);
+    }
+    return;
+  }
+  
   // Handle button press
   if (M5.BtnA.wasPressed()) {
     // ボタン押下をデバッグ出力
@@ -822,7 +841,7 @@ void handleButtonPress() {
       handleLongPress();
       longPressHandled = true;
     } else {
-      Serial.println("Long press already handled, ignoring");
+      LOG_V_EVERY(LOG_TAG_MAIN, 1000, "Long press already handled, ignoring");
     }
   } else {
     // ボタンが押されていない場合はフラグをリセット
@@ -846,11 +865,17 @@ void cycleDisplayMode() {
       currentMode = CELESTIAL_DATA;
       break;
     case CELESTIAL_DATA: 
+      currentMode = POLARIS_CLOCK;
+      break;
+    case POLARIS_CLOCK: 
       currentMode = RAW_DATA;
       // RAW_DATAモードに入る時は、サブモードをRAW_IMUに初期化
       currentRawMode = RAW_IMU;
       break;
     case RAW_DATA: 
+      // キャリブレーションを中止すれば次のモード（初期画面）に進む
+      previousMode = POLAR_ALIGNMENT;
+      previousRawMode = currentRawMode;
       currentMode = CALIBRATION_MODE;
       break;
     case CALIBRATION_MODE: 
@@ -879,63 +904,25 @@ void handleLongPress() {
       Serial.print("Toggled heading calculation method. Using raw heading: ");
       Serial.println(use_raw_heading ? "YES (no tilt compensation)" : "NO (with tilt compensation)");
       
-      // 方位角計算方法の変更を通知
-      M5.Display.fillScreen(TFT_BLACK);
-      M5.Display.setTextColor(TFT_WHITE);
-      M5.Display.setTextSize(1);
-      M5.Display.setCursor(2, 10);
-      M5.Display.println("Heading Method:");
-      M5.Display.setCursor(2, 30);
-      if (use_raw_heading) {
-        M5.Display.setTextColor(TFT_YELLOW);
-        M5.Display.println("RAW VALUE");
-        M5.Display.setTextColor(TFT_WHITE);
-        M5.Display.setCursor(2, 50);
-        M5.Display.println("No tilt compensation");
-      } else {
-        M5.Display.setTextColor(TFT_GREEN);
-        M5.Display.println("COMPENSATED");
-        M5.Display.setTextColor(TFT_WHITE);
-        M5.Display.setCursor(2, 50);
-        M5.Display.println("With tilt compensation");
-      }
-      delay(1500); // 1.5秒間表示
+      // 方位角計算方法の変更を通知（表示中もループは止めない）
+      showHeadingMethodToast();
       break;
-      
+    
     case CELESTIAL_DATA:
       // 方位角の計算方法を切り替え（生値 <-> 傾き補正値）
       use_raw_heading = !use_raw_heading;
       Serial.print("Toggled heading calculation method. Using raw heading: ");
       Serial.println(use_raw_heading ? "YES (no tilt compensation)" : "NO (with tilt compensation)");
       
-      // 方位角計算方法の変更を通知
-      M5.Display.fillScreen(TFT_BLACK);
-      M5.Display.setTextColor(TFT_WHITE);
-      M5.Display.setTextSize(1);
-      M5.Display.setCursor(2, 10);
-      M5.Display.println("Heading Method:");
-      M5.Display.setCursor(2, 30);
-      if (use_raw_heading) {
-        M5.Display.setTextColor(TFT_YELLOW);
-        M5.Display.println("RAW VALUE");
-        M5.Display.setTextColor(TFT_WHITE);
-        M5.Display.setCursor(2, 50);
-        M5.Display.println("No tilt compensation");
-      } else {
-        M5.Display.setTextColor(TFT_GREEN);
-        M5.Display.println("COMPENSATED");
-        M5.Display.setTextColor(TFT_WHITE);
-        M5.Display.setCursor(2, 50);
-        M5.Display.println("With tilt compensation");
-      }
-      delay(1500); // 1.5秒間表示
+      // 方位角計算方法の変更を通知（表示中もループは止めない）
+      showHeadingMethodToast();
       break;
-      
+    
     case GPS_DATA: 
       // Force GPS refresh
       // TODO: Implement GPS refresh
       break;
-      
+    
     case IMU_DATA: 
       // 現在のモードを保存
       previousMode = currentMode;
@@ -946,7 +933,7 @@ void handleLongPress() {
       currentMode = CALIBRATION_MODE;
       Serial.println("Starting IMU calibration");
       break;
-      
+    
     case RAW_DATA: 
       // RAW_DATAモード内でのサブモード切り替え
       if (currentRawMode == RAW_IMU) {
@@ -959,9 +946,10 @@ void handleLongPress() {
         Serial.println("Starting IMU calibration from RAW mode");
       }
       break;
-      
+    
+    case POLARIS_CLOCK: 
     case CALIBRATION_MODE: 
-      // キャリブレーションモードでの長押しは無視
+      // 北極星クロック・キャリブレーションモードでの長押しは無視
       break;
   }
   
@@ -982,6 +970,9 @@ void cycleRawDataMode() {
       currentRawMode = RAW_SYSTEM; 
       break;
     case RAW_SYSTEM: 
+      currentRawMode = RAW_PERFORMANCE; 
+      break;
+    case RAW_PERFORMANCE: 
       currentRawMode = DISPLAY_DEBUG; 
       break;
     case DISPLAY_DEBUG: 
@@ -1009,24 +1000,102 @@ void cycleRawDataMode() {
     case RAW_SYSTEM: 
       Serial.println("SYSTEM");
       break;
+    case RAW_PERFORMANCE: 
+      Serial.println("PERFORMANCE");
+      break;
     case DISPLAY_DEBUG: 
       Serial.println("DEBUG");
       break;
   }
 }
 
-void calibrateIMU() {
-  // デバッグ出力
-  Serial.println("Starting calibrateIMU function");
-  Serial.print("Current mode: ");
-  Serial.println(currentMode);
-  Serial.print("Previous mode: ");
-  Serial.println(previousMode);
-  Serial.print("Previous RAW mode: ");
-  Serial.println(previousRawMode);
-  
-  // キャリブレーション開始
-  Serial.println("Starting IMU calibration...");
+// ---- UI flows (UiStateMachine tables) ----
+// 待ち時間はすべて状態のタイムアウトで表し、loop()がtick()する
+
+// Message toast: drawn once, dismissed by the timeout or a press
+enum ToastState : uint8_t {
+  TOAST_HIDDEN,
+  TOAST_SHOWN,
+  TOAST_STATE_COUNT
+};
+
+struct ToastMessage {
+  const char* title;
+  const char* value;
+  uint16_t valueColor;
+  const char* detail;
+};
+ToastMessage toastMessage = {"", "", TFT_WHITE, ""};
+
+void drawToast() {
+  M5.Display.fillScreen(TFT_BLACK);
+  M5.Display.setTextColor(TFT_WHITE);
+  M5.Display.setTextSize(1);
+  M5.Display.setCursor(2, 10);
+  M5.Display.println(toastMessage.title);
+  M5.Display.setCursor(2, 30);
+  M5.Display.setTextColor(toastMessage.valueColor);
+  M5.Display.println(toastMessage.value);
+  M5.Display.setTextColor(TFT_WHITE);
+  M5.Display.setCursor(2, 50);
+  M5.Display.println(toastMessage.detail);
+}
+
+void hideToast() {
+  // パネルに直接描画したため、次のフレームは全体を転送する
+  display.invalidate();
+  refreshScheduler.requestRedraw();
+}
+
+static const UiStateInfo TOAST_STATES[TOAST_STATE_COUNT] = {
+  // timeoutMs       onEnter     onTick   onExit
+  {0,                nullptr,    nullptr, nullptr},    // TOAST_HIDDEN
+  {UI_TOAST_MS,      drawToast,  nullptr, hideToast},  // TOAST_SHOWN
+};
+
+static const UiTransition TOAST_TRANSITIONS[] = {
+  {TOAST_HIDDEN, UI_EVENT_START,   TOAST_SHOWN,  nullptr},
+  {TOAST_SHOWN,  UI_EVENT_START,   TOAST_SHOWN,  nullptr},  // 新しいメッセージで描き直す
+  {TOAST_SHOWN,  UI_EVENT_TIMEOUT, TOAST_HIDDEN, nullptr},
+  {TOAST_SHOWN,  UI_EVENT_PRESS,   TOAST_HIDDEN, nullptr},
+};
+
+UiStateMachine toastFlow(TOAST_STATES, TOAST_STATE_COUNT, TOAST_TRANSITIONS,
+                         sizeof(TOAST_TRANSITIONS) / sizeof(TOAST_TRANSITIONS[0]), TOAST_HIDDEN);
+
+void showToast(const char* title, const char* value, uint16_t valueColor, const char* detail) {
+  toastMessage.title = title;
+  toastMessage.value = value;
+  toastMessage.valueColor = valueColor;
+  toastMessage.detail = detail;
+  toastFlow.dispatch(UI_EVENT_START);
+}
+
+void showHeadingMethodToast() {
+  if (use_raw_heading) {
+    showToast("Heading Method:", "RAW VALUE", TFT_YELLOW, "No tilt compensation");
+  } else {
+    showToast("Heading Method:", "COMPENSATED", TFT_GREEN, "With tilt compensation");
+  }
+}
+
+// Magnetometer calibration: arm (wait for the long press to end), collect, show the result
+enum CalibrationFlowState : uint8_t {
+  CAL_FLOW_IDLE,
+  CAL_FLOW_ARMING,
+  CAL_FLOW_COLLECTING,
+  CAL_FLOW_RESULT,
+  CAL_FLOW_STATE_COUNT
+};
+
+bool calUseSensorTask = false;   // センサータスクの楕円体フィットを使う
+uint32_t calStartFitCount = 0;
+bool calComplete = false;
+unsigned long calLastDrawMs = 0;
+
+void calibrationArm() {
+  LOG_I(LOG_TAG_IMU, "Starting IMU calibration (mode %d, returning to %d/%d)",
+        (int)currentMode, (int)previousMode, (int)previousRawMode);
   
   // ディスプレイにキャリブレーションモードを表示
   M5.Display.fillScreen(TFT_BLACK);
@@ -1045,172 +1114,520 @@ void calibrateIMU() {
   M5.Display.println("Draw figure 8 pattern");
   M5.Display.println("with device");
   
-  // キャリブレーション変数
-  bool calibrationComplete = false;
-  bool calibrationCancelled = false;
-  unsigned long startTime = millis();
-  unsigned long calibrationDuration = 15000; // 15秒間のキャリブレーション
-  
-  // キャリブレーション用データ
-  int16_t min_x = 32767, max_x = -32768;
-  int16_t min_y = 32767, max_y = -32768;
-  int16_t min_z = 32767, max_z = -32768;
-  int sampleCount = 0;
-  
-  // ボタン状態をリセット - 重要: 前の状態をクリアする
-  delay(500); // ボタン状態が安定するまで少し待機
-  M5.update();
-  
-  // キャリブレーションループ
-  while (!calibrationComplete && !calibrationCancelled) {
-    // 現在の経過時間を計算
-    unsigned long elapsedTime = millis() - startTime;
-    float progress = min(1.0f, (float)elapsedTime / calibrationDuration);
-    
-    // 時間経過でキャリブレーション完了
-    if (progress >= 1.0) {
-      calibrationComplete = true;
-      Serial.println("Calibration completed by timeout");
-      continue; // ループを抜ける
+  // センサータスクの楕円体フィットを学習し直す（失敗しても現在の較正値は使われ続ける）
+  // センサータスクが動いていない場合はCalibrationManagerで直接読み出す
+  calComplete = false;
+  calLastDrawMs = 0;
+  calUseSensorTask = sensorTask.isRunning();
+  calStartFitCount = 0;
+  if (calUseSensorTask) {
+    OrientationData snap;
+    if (sensorTask.getSnapshot(snap)) {
+      calStartFitCount = snap.magCalFitCount;
     }
-    
-    // ボタン入力をチェック（キャンセル用）
-    M5.update();
-    
-    // ボタンの状態をデバッグ出力
-    static bool lastBtnState = false;
-    bool currentBtnState = M5.BtnA.isPressed();
-    
-    if (currentBtnState != lastBtnState) {
-      Serial.print("In calibration loop, button state changed to: ");
-      Serial.println(currentBtnState ? "PRESSED" : "RELEASED");
-      lastBtnState = currentBtnState;
-    }
-    
-    if (M5.BtnA.wasPressed()) {
-      // キャリブレーションをキャンセル
-      Serial.println("Calibration cancelled by button press");
-      calibrationCancelled = true;
-      continue; // ループを抜ける
+    sensorTask.startMagCalibration();
+  } else {
+    calibrationManager.startCalibration(false, true);
+  }
+}
+
+void calibrationWaitRelease() {
+  // 開始した長押しが離されるまではキャンセルとして扱わない
+  if (!M5.BtnA.isPressed()) {
+    calibrationFlow.dispatch(UI_EVENT_RELEASE);
+  }
+}
+
+void calibrationCollect() {
+  // 楕円体フィットの進捗を取得
+  float progress = 0.0f;
+  float field = 0.0f;
+  if (calUseSensorTask) {
+    OrientationData snap;
+    if (sensorTask.getSnapshot(snap)) {
+      progress = snap.magCalProgress;
+      field = snap.magField;
+      calComplete = progress >= 1.0f && snap.magCalFitCount != calStartFitCount;
     }
-    
-    // 磁気センサーデータを読み取り
-    bmm150.readMagnetometer();
-    
-    // キャリブレーションデータを更新
-    if (bmm150.raw_mag_x < min_x) min_x = bmm150.raw_mag_x;
-    if (bmm150.raw_mag_x > max_x) max_x = bmm150.raw_mag_x;
-    
-    if (bmm150.raw_mag_y < min_y) min_y = bmm150.raw_mag_y;
-    if (bmm150.raw_mag_y > max_y) max_y = bmm150.raw_mag_y;
-    
-    if (bmm150.raw_mag_z < min_z) min_z = bmm150.raw_mag_z;
-    if (bmm150.raw_mag_z > max_z) max_z = bmm150.raw_mag_z;
-    
-    sampleCount++;
-    
-    // 進捗バーを表示
-    int barWidth = 120;
-    int barHeight = 10;
-    int barX = 20;
-    int barY = 120;
-    
-    M5.Display.fillRect(barX, barY, barWidth, barHeight, TFT_DARKGREY);
-    M5.Display.fillRect(barX, barY, (int)(barWidth * progress), barHeight, TFT_GREEN);
-    
-    // 進捗テキスト表示
-    M5.Display.fillRect(0, 140, 160, 10, TFT_BLACK);
-    M5.Display.setCursor(20, 140);
-    M5.Display.print((int)(progress * 100));
-    M5.Display.print("% ");
-    M5.Display.print(sampleCount);
-    M5.Display.print(" samples");
-    
-    // 少し待機
-    delay(50);
+  } else {
+    calibrationManager.updateCalibration();
+    progress = calibrationManager.getCalibrationStatus().progress;
+    calComplete = !calibrationManager.isCalibrating();
+  }
+  if (calComplete) {
+    calibrationFlow.dispatch(UI_EVENT_DONE);
+    return;
   }
   
-  // キャリブレーション結果表示
+  // 進捗バーを表示
+  unsigned long now = millis();
+  if (calLastDrawMs != 0 && now - calLastDrawMs < CAL_FLOW_DRAW_MS) {
+    return;
+  }
+  calLastDrawMs = now;
+  int barWidth = 120;
+  int barHeight = 10;
+  int barX = 20;
+  int barY = 120;
+  M5.Display.fillRect(barX, barY, barWidth, barHeight, TFT_DARKGREY);
+  M5.Display.fillRect(barX, barY, (int)(barWidth * progress), barHeight, TFT_GREEN);
+  
+  // 進捗テキスト表示
+  M5.Display.fillRect(0, 140, 160, 10, TFT_BLACK);
+  M5.Display.setCursor(20, 140);
+  M5.Display.printf("%d%% %.1f uT", (int)(progress * 100), field);
+}
+
+void calibrationShowResult() {
+  // キャリブレーション結果表示（時間切れは姿勢の網羅が足りない、または磁気干渉がある）
   M5.Display.fillRect(0, 80, 160, 80, TFT_BLACK);
   M5.Display.setCursor(0, 80);
+  M5.Display.setTextColor(TFT_WHITE);
   
-  if (calibrationComplete) {
+  // 残差はセンサータスクのフィットにしかない（保存データには含まれない）ため、
+  // 結果の表示には取得した構造体をそのまま使う
+  MagCalibration magCal;
+  bool haveFit = calComplete && calUseSensorTask && sensorTask.getMagCalibration(magCal) && magCal.valid;
+  if (haveFit) {
+    calibrationManager.setMagCalibration(magCal);
+  }
+  
+  if (haveFit || (calComplete && calibrationManager.getMagCalibration(&magCal))) {
     // キャリブレーション完了処理
-    M5.Display.setTextColor(TFT_WHITE);
     M5.Display.println("Calibration Complete!");
-    Serial.println("IMU calibration complete");
-    
-    // キャリブレーションデータを計算して適用
-    float hard_iron_x = (min_x + max_x) / 2.0f;
-    float hard_iron_y = (min_y + max_y) / 2.0f;
-    float hard_iron_z = (min_z + max_z) / 2.0f;
-    
-    // スケーリング係数を計算
-    float range_x = (max_x - min_x) / 2.0f;
-    float range_y = (max_y - min_y) / 2.0f;
-    float range_z = (max_z - min_z) / 2.0f;
-    
-    // ゼロ除算を防止
-    if (range_x < 1.0f) range_x = 1.0f;
-    if (range_y < 1.0f) range_y = 1.0f;
-    if (range_z < 1.0f) range_z = 1.0f;
-    
-    // 平均範囲を計算
-    float avg_range = (range_x + range_y + range_z) / 3.0f;
-    
-    // スケーリング係数
-    float scale_x = avg_range / range_x;
-    float scale_y = avg_range / range_y;
-    float scale_z = avg_range / range_z;
-    
-    // BMM150クラスにキャリブレーションデータを設定
-    bmm150.setCalibrationData(hard_iron_x, hard_iron_y, hard_iron_z, 
-                             scale_x, scale_y, scale_z);
-    
-    // キャリブレーション完了フラグを設定
-    bmm150.setCalibrationStatus(true);
+    if (haveFit) {
+      M5.Display.printf("%.1f uT, err %.1f%%\n", magCal.fieldStrength, magCal.residual * 100.0f);
+    } else {
+      M5.Display.printf("%.1f uT\n", magCal.fieldStrength);
+    }
+    calibrationManager.saveCalibrationData();
     imuCalibrated = true;
     
-    // デバッグ出力
-    Serial.print("Samples collected: ");
-    Serial.println(sampleCount);
+    // 全磁力をWMMの値と比較（大きく違う場合は近くの金属の影響が残っている）
+    float expected = ephemeris.getMagneticFieldStrength();
+    if (haveFit) {
+      LOG_I(LOG_TAG_IMU, "Magnetometer calibrated: %.1f uT (WMM %.1f uT), residual %.1f%%, coverage %.2f",
+            magCal.fieldStrength, expected, magCal.residual * 100.0f, magCal.coverage);
+    } else {
+      LOG_I(LOG_TAG_IMU, "Magnetometer calibrated: %.1f uT (WMM %.1f uT)", magCal.fieldStrength, expected);
+    }
+    if (expected > 0.0f && fabsf(magCal.fieldStrength / expected - 1.0f) > 0.25f) {
+      LOG_W(LOG_TAG_IMU, "Calibrated field differs from the model, check for nearby metal");
+    }
   } else {
-    M5.Display.setTextColor(TFT_WHITE);
-    M5.Display.println("Calibration Cancelled");
-    Serial.println("IMU calibration cancelled");
+    M5.Display.println("Calibration Failed");
+    M5.Display.println("Rotate in all directions");
+    LOG_W(LOG_TAG_IMU, "IMU calibration failed (timed out)");
+  }
+}
+
+void calibrationFinish() {
+  // 明示的に前のモードに戻す（長押しのフラグはボタンが離されたときにリセットされる）
+  currentMode = previousMode;
+  currentRawMode = previousRawMode;
+  display.invalidate();
+  refreshScheduler.requestRedraw();
+  LOG_D(LOG_TAG_MAIN, "Calibration finished, back to mode %d", (int)currentMode);
+}
+
+void calibrationCancelled() {
+  // フィットはセンサータスクで続ける（現在の較正値は変わらない）
+  LOG_I(LOG_TAG_IMU, "IMU calibration cancelled by button press");
+  calibrationFinish();
+}
+
+static const UiStateInfo CALIBRATION_STATES[CAL_FLOW_STATE_COUNT] = {
+  // timeoutMs           onEnter                onTick                  onExit
+  {0,                    nullptr,               nullptr,                nullptr},  // CAL_FLOW_IDLE
+  {0,                    calibrationArm,        calibrationWaitRelease, nullptr},  // CAL_FLOW_ARMING
+  {MAG_CAL_TIMEOUT_MS,   nullptr,               calibrationCollect,     nullptr},  // CAL_FLOW_COLLECTING
+  {CAL_FLOW_RESULT_MS,   calibrationShowResult, nullptr,                nullptr},  // CAL_FLOW_RESULT
+};
+
+static const UiTransition CALIBRATION_TRANSITIONS[] = {
+  {CAL_FLOW_IDLE,       UI_EVENT_START,   CAL_FLOW_ARMING,     nullptr},
+  {CAL_FLOW_ARMING,     UI_EVENT_RELEASE, CAL_FLOW_COLLECTING, nullptr},
+  {CAL_FLOW_COLLECTING, UI_EVENT_DONE,    CAL_FLOW_RESULT,     nullptr},
+  {CAL_FLOW_COLLECTING, UI_EVENT_TIMEOUT, CAL_FLOW_RESULT,     nullptr},
+  {CAL_FLOW_COLLECTING, UI_EVENT_PRESS,   CAL_FLOW_IDLE,       calibrationCancelled},
+  {CAL_FLOW_RESULT,     UI_EVENT_TIMEOUT, CAL_FLOW_IDLE,       calibrationFinish},
+  {CAL_FLOW_RESULT,     UI_EVENT_PRESS,   CAL_FLOW_IDLE,       calibrationFinish},
+};
+
+UiStateMachine calibrationFlow(CALIBRATION_STATES, CAL_FLOW_STATE_COUNT, CALIBRATION_TRANSITIONS,
+                               sizeof(CALIBRATION_TRANSITIONS) / sizeof(CALIBRATION_TRANSITIONS[0]),
+                               CAL_FLOW_IDLE);
+
+// Start and tick the UI flows (UI task, every loop)
+void serviceUiFlows() {
+  // キャリブレーションモードに入ったら開始する（長押し・モード切り替えのどちらからでも）
+  if (currentMode == CALIBRATION_MODE && calibrationFlow.isIdle()) {
+    calibrationFlow.dispatch(UI_EVENT_START);
+  }
+  calibrationFlow.tick();
+  toastFlow.tick();
+}
+
+// Persist calibration refined in the background (magnetometer fit, gyro temperature model)
+void saveBackgroundCalibration() {
+  // NVSの書き込み回数を抑えるため、較正値が更新されていても保存は低頻度にする
+  static uint32_t lastSaveMs = 0;
+  static uint32_t savedFitCount = 0;
+  static uint32_t savedGyroModelVersion = 0;
+  uint32_t now = millis();
+  if (now - lastSaveMs < CAL_SAVE_INTERVAL_MS) {
+    return;
+  }
+  lastSaveMs = now;
+  
+  bool changed = false;
+  MagCalibration magCal;
+  if (sensorTask.getMagCalibration(magCal) && magCal.valid && magCal.fitCount != savedFitCount) {
+    savedFitCount = magCal.fitCount;
+    calibrationManager.setMagCalibration(magCal);
+    changed = true;
+    LOG_I(LOG_TAG_IMU, "Saving refined magnetometer calibration: %.1f uT, residual %.1f%%",
+          magCal.fieldStrength, magCal.residual * 100.0f);
+  }
+  
+  GyroTempModel gyroModel;
+  uint32_t gyroModelVersion = sensorTask.getGyroTempModelVersion();
+  if (gyroModelVersion != savedGyroModelVersion && sensorTask.getGyroTempModel(gyroModel)) {
+    savedGyroModelVersion = gyroModelVersion;
+    calibrationManager.setGyroTempModel(gyroModel);
+    changed = true;
+    LOG_I(LOG_TAG_IMU, "Saving gyro bias temperature model");
   }
   
-  // 少し待機してから終了
-  delay(2000);
+  if (changed) {
+    calibrationManager.saveCalibrationData();
+  }
+}
+
+// Record GPS, orientation and alignment error while data logging is enabled
+// IMUの生データはセンサータスクからバッチごとに直接記録される
+void recordSession() {
+  bool wanted = settingsManager.getEnableDataLogging() && sensorTask.isRunning();
+  if (wanted != sessionRecorder.isRecording()) {
+    if (wanted) {
+      sessionRecorder.start(settingsManager.getImuSampleRate(), timeBase.nowUtcUs());
+    } else {
+      sessionRecorder.stop();
+    }
+  }
+  if (!sessionRecorder.isRecording()) {
+    return;
+  }
+
+  // 生データは画面点灯中（極軸合わせの操作中）だけ残し、容量を節約する
+  bool active = powerManager.getState() == POWER_ACTIVE;
+  sessionRecorder.setRawImuEnabled(active);
+
+  unsigned long now = millis();
+  uint32_t sessionMs = sessionRecorder.getSessionMs();
+
+  static unsigned long lastGpsRecord = 0;
+  if (now - lastGpsRecord >= SESSION_GPS_INTERVAL_MS) {
+    lastGpsRecord = now;
+
+    SessionGpsRecord rec;
+    rec.timeMs = sessionMs;
+    rec.latitudeE7 = (int32_t)(latitude * 1e7f);
+    rec.longitudeE7 = (int32_t)(longitude * 1e7f);
+    rec.altitudeCm = (int32_t)(altitude * 100.0f);
+    rec.hdopCenti = (uint16_t)constrain(hdop * 100.0f, 0.0f, 65535.0f);
+    rec.satellites = (uint8_t)constrain(satellites, 0, 255);
+    rec.flags = (gps.isValid() ? 0x01 : 0) | (timeBase.isValid() ? 0x02 : 0);
+    rec.utcSeconds = (uint32_t)(timeBase.nowUtcUs() / 1000000LL);
+    sessionRecorder.recordGps(rec);
+  }
+
+  static unsigned long lastOrientationRecord = 0;
+  unsigned long interval = active ? SESSION_ORIENT_INTERVAL_MS : SESSION_IDLE_INTERVAL_MS;
+  if (now - lastOrientationRecord < interval || !orientation.attitudeValid) {
+    return;
+  }
+  lastOrientationRecord = now;
+
+  SessionOrientationRecord rec;
+  rec.timeMs = sessionMs;
+  for (int i = 0; i < 4; i++) {
+    rec.quat[i] = (int16_t)constrain(orientation.quat[i] * 16384.0f, -32768.0f, 32767.0f);
+  }
+  rec.headingRawCenti = (uint16_t)(orientation.headingRaw * 100.0f);
+  rec.errorCenti = (uint16_t)constrain(orientation.attitudeError * 100.0f, 0.0f, 65535.0f);
+  for (int axis = 0; axis < 3; axis++) {
+    rec.gyroBias[axis] = (int16_t)constrain(orientation.gyroBias[axis] * 1000.0f, -32768.0f, 32767.0f);
+  }
+  rec.temperatureCenti = (int16_t)(orientation.temperature * 100.0f);
+  rec.confidence = (uint8_t)constrain(orientation.confidence * 255.0f, 0.0f, 255.0f);
+  rec.flags = (orientation.attitudeValid ? 0x01 : 0) | (orientation.magCalValid ? 0x02 : 0) |
+              (orientation.magDisturbed ? 0x04 : 0) | (orientation.stationary ? 0x08 : 0);
+  rec.magFieldCenti = (uint16_t)constrain(orientation.magField * 100.0f, 0.0f, 65535.0f);
+  sessionRecorder.recordOrientation(rec);
+
+  // 極軸の誤差は画面と同じ方位角（生値/傾き補正、真北基準）で計算する
+  float recHeading, recPitch, recRoll;
+  AHRSEngine::quaternionToEuler(orientation.quat, &recHeading, &recPitch, &recRoll);
+  float pointing = use_raw_heading ? heading_raw : recHeading;
+  if (settingsManager.getUseNorthReference()) {
+    applyMagneticDeclination(&pointing, magDeclination);
+  }
+  float azimuthError = pointing - polarisAz;
+  while (azimuthError > 180.0f) azimuthError -= 360.0f;
+  while (azimuthError < -180.0f) azimuthError += 360.0f;
+
+  SessionAlignmentRecord align;
+  align.timeMs = sessionMs;
+  align.azimuthErrorCenti = (int16_t)(azimuthError * 100.0f);
+  align.altitudeErrorCenti = (int16_t)constrain((recPitch - polarisAlt) * 100.0f, -32768.0f, 32767.0f);
+  align.poleAzimuthCenti = (uint16_t)(polarisAz * 100.0f);
+  align.poleAltitudeCenti = (int16_t)(polarisAlt * 100.0f);
+  align.displayMode = (uint8_t)currentMode;
+  align.powerState = (uint8_t)powerManager.getState();
+  align.reserved = 0;
+  sessionRecorder.recordAlignment(align);
+}
+
+// Follow the Bluetooth setting and hand the pole target and GPS state to the BLE task
+// 姿勢はBLEのタスクがセンサータスクのスナップショットから直接読む
+void serviceBluetooth() {
+  bleStreamer.setEnabled(settingsManager.getEnableBluetooth());
+  if (!bleStreamer.isConnected()) {
+    return;
+  }
   
-  // 明示的に前のモードに戻す
-  Serial.println("Returning to previous mode");
-  Serial.print("Previous mode: ");
-  Serial.println(previousMode);
-  Serial.print("Previous RAW mode: ");
-  Serial.println(previousRawMode);
+  static unsigned long lastContext = 0;
+  unsigned long now = millis();
+  if (lastContext != 0 && now - lastContext < BLE_CONTEXT_INTERVAL_MS) {
+    return;
+  }
+  lastContext = now;
+  
+  BleContext context;
+  context.poleAzimuth = polarisAz;
+  context.poleAltitude = polarisAlt;
+  context.declination = settingsManager.getUseNorthReference() ? magDeclination : 0.0f;
+  context.latitude = latitude;
+  context.longitude = longitude;
+  context.altitude = altitude;
+  context.hdop = hdop;
+  context.utcSeconds = (uint32_t)(timeBase.nowUtcUs() / 1000000LL);
+  context.imuRateHz = sensorTask.getRate();
+  context.satellites = (uint8_t)constrain(satellites, 0, 255);
+  context.statusFlags = (gps.isValid() ? BLE_STATUS_GPS_FIX : 0) |
+                        (timeBase.isValid() ? BLE_STATUS_TIME_SYNCED : 0) |
+                        (settingsManager.getUseNorthReference() ? BLE_STATUS_TRUE_NORTH : 0) |
+                        (fineAlignment ? BLE_STATUS_FINE_ALIGN : 0);
+  context.targetValid = gpsValid;
+  bleStreamer.setContext(context);
+}
+
+// Extrapolate the snapshot attitude to the time the frame reaches the panel
+// 遅れ = サンプルからの経過時間 + 描画・転送の平均（プロファイラ）+ パネルの表示
+void predictDisplayAttitude(int64_t nowUs, float quat[4]) {
+  memcpy(quat, orientation.quat, sizeof(orientation.quat));
+  predictionLeadMs = 0.0f;
+  
+  int64_t leadUs = (nowUs - (int64_t)orientation.timestampUs) +
+                   Profiler::getWindow(PROFILE_RENDER).avgUs + DISPLAY_PANEL_LATENCY_US;
+  // 静止中はジャイロの雑音で針が揺れないよう予測しない
+  if (!DISPLAY_PREDICTION || !orientation.gyroOk || orientation.stationary ||
+      leadUs <= 0 || leadUs > DISPLAY_MAX_PREDICTION_US) {
+    return;
+  }
   
-  // モードを元に戻す
-  currentMode = previousMode;
-  currentRawMode = previousRawMode;
+  // バイアス補正後の角速度を体軸に変換する（AHRSへの入力と同じ）
+  float gyro[3], gyroBody[3];
+  for (int axis = 0; axis < 3; axis++) {
+    gyro[axis] = orientation.gyro[axis] - (orientation.gyroBiasValid ? orientation.gyroBias[axis] : 0.0f);
+  }
+  AHRSEngine::fromDeviceAxes(gyro, gyroBody);
+  AHRSEngine::predict(orientation.quat, gyroBody, leadUs * 1e-6f, quat);
+  predictionLeadMs = leadUs * 0.001f;
+}
+
+// Pointing error against the pole (degrees; azimuth on the sky, i.e. scaled by cos(alt))
+// 微調整では傾き補正済みの姿勢の方位角を使う（生値の方位角は傾きの影響を受けるため）
+static void alignmentError(float fusedHeading, float fusedPitch, float* azError, float* altError) {
+  float trueHeading = fusedHeading;
+  if (settingsManager.getUseNorthReference()) {
+    applyMagneticDeclination(&trueHeading, magDeclination);
+  }
+  float az = trueHeading - polarisAz;
+  if (az > 180.0f) az -= 360.0f;
+  if (az < -180.0f) az += 360.0f;
+  *azError = az * cosf(polarisAlt * DEG_TO_RAD);
+  *altError = fusedPitch - polarisAlt;
+}
+
+// Enter or leave the fine alignment view with hysteresis
+void updateFineAlignment() {
+  bool active = false;
+  if (currentMode == POLAR_ALIGNMENT && orientation.attitudeValid) {
+    float azError, altError;
+    alignmentError(heading, pitch, &azError, &altError);
+    float limit = fineAlignment ? FINE_EXIT_DEG : FINE_ENTER_DEG;
+    active = fabsf(azError) < limit && fabsf(altError) < limit;
+  }
+  if (active == fineAlignment) {
+    return;
+  }
   
-  // 長押し処理フラグをリセット
-  longPressHandled = false;
+  // 微調整中はIMUを最高レートにして、センサータスクで全サンプルを平均する
+  fineAlignment = active;
+  sensorTask.setAlignmentAveraging(active);
+  sensorTask.setRate(active ? FINE_SENSOR_RATE_HZ : settingsManager.getImuSampleRate());
+  LOG_I(LOG_TAG_IMU, "Fine alignment %s", active ? "started" : "ended");
+}
+
+// Draw the fine alignment view from the sensor task's average
+void showFineAlignment() {
+  AlignmentEstimate estimate;
+  float azError, altError;
+  bool averaging = sensorTask.getAlignmentEstimate(estimate) && estimate.valid;
+  if (averaging) {
+    alignmentError(estimate.heading, estimate.pitch, &azError, &altError);
+  } else {
+    // 平均が求まるまでは最新の姿勢を表示する
+    alignmentError(heading, pitch, &azError, &altError);
+  }
+  display.showFineAlignment(azError * 60.0f, altError * 60.0f,
+                            averaging ? estimate.sigmaDeg * 60.0f : 0.0f,
+                            averaging ? estimate.windowS : 0.0f, averaging);
+}
+
+// True when the current view draws the attitude (needles, horizon, raw IMU)
+bool showsAttitude() {
+  switch (currentMode) {
+    case POLAR_ALIGNMENT:
+    case CELESTIAL_DATA:
+    case IMU_DATA:
+      return true;
+    case RAW_DATA:
+      return currentRawMode == RAW_IMU;
+    default:
+      return false;
+  }
+}
+
+// Publish the position for the receiver seed and re-sync from NTP while GPS has no time
+void serviceWifiAssist() {
+  static unsigned long lastPosition = 0;
+  unsigned long now = millis();
+  if (lastPosition == 0 || now - lastPosition >= WIFI_POSITION_INTERVAL_MS) {
+    lastPosition = now;
+    AssistPosition position;
+    position.latitude = latitude;
+    position.longitude = longitude;
+    position.altitude = altitude;
+    position.valid = gpsValid;
+    wifiAssist.setPosition(position);
+  }
   
-  // ボタン状態をリセット
-  M5.update();
+  if (!wifiAssist.isConfigured() || wifiAssist.isBusy() ||
+      settingsManager.getTimeSource() != TIME_NTP ||
+      timeBase.getSource() >= TIMEBASE_SOURCE_NMEA) {
+    return;
+  }
+  if (now - wifiAssist.getLastRunMs() >= WIFI_NTP_RESYNC_MS) {
+    wifiAssist.request();
+  }
+}
+
+// Serial line commands (Wi-Fi configuration)
+//   wifi <ssid> [password]  接続先を保存して同期する
+//   wifi                    今すぐ同期する
+//   ntp <server>            NTPサーバー（省略時はpool.ntp.org）
+//   assist <url>            補助データのURL（"-"で取得しない）
+//   ota <url> [md5]         ファームウェアを更新する（MD5を省略すると "<url>.md5" を読む）
+//   ota reboot              更新したファームウェアで再起動する（次の電源投入でも切り替わる）
+//   ota                     更新の状態
+void handleSerialLine(char* line) {
+  char* command = strtok(line, " ");
+  if (command == nullptr) {
+    return;
+  }
+  char* arg1 = strtok(nullptr, " ");
+  char* arg2 = strtok(nullptr, "");
   
-  // 画面を更新して前のモードの表示に戻す
-  Serial.println("Updating display to show previous mode");
-  updateDisplay();
+  if (strcmp(command, "wifi") == 0) {
+    if (arg1 != nullptr) {
+      wifiAssist.setCredentials(arg1, arg2);
+    }
+    if (!wifiAssist.isConfigured()) {
+      Serial.println("usage: wifi <ssid> [password]");
+      return;
+    }
+    wifiAssist.request();
+    Serial.printf("Wi-Fi: syncing with %s\n", wifiAssist.getSsid());
+  } else if (strcmp(command, "ntp") == 0 && arg1 != nullptr) {
+    wifiAssist.setNtpServer(arg1);
+    Serial.printf("NTP server: %s\n", arg1);
+  } else if (strcmp(command, "assist") == 0 && arg1 != nullptr) {
+    wifiAssist.setAssistUrl(strcmp(arg1, "-") == 0 ? "" : arg1);
+    Serial.println(strcmp(arg1, "-") == 0 ? "Assist data disabled" : "Assist URL saved");
+  } else if (strcmp(command, "ota") == 0) {
+    if (arg1 == nullptr) {
+      Serial.printf("OTA: %s, %lu bytes %s%s\n", OtaUpdater::getStateName(otaUpdater.getState()),
+                    (unsigned long)otaUpdater.getWritten(), otaUpdater.getError(),
+                    otaUpdater.isPendingVerify() ? " (running firmware not confirmed yet)" : "");
+    } else if (strcmp(arg1, "reboot") == 0) {
+      if (otaUpdater.getState() != OTA_READY) {
+        Serial.println("OTA: no verified update to boot");
+        return;
+      }
+      persistence.flush();
+      ESP.restart();
+    } else if (wifiAssist.requestUpdate(arg1, arg2)) {
+      Serial.println("OTA: download started in the background");
+    } else {
+      Serial.println("usage: ota <url> [md5] (needs a Wi-Fi network and an idle assist task)");
+    }
+  } else {
+    Serial.printf("Unknown command: %s (Wi-Fi: %s)\n", command,
+                  WifiAssist::getStateName(wifiAssist.getState()));
+  }
+}
+
+void handleSerialCommands() {
+  static char line[WIFI_SERIAL_LINE_SIZE];
+  static size_t lineLength = 0;
   
-  // 追加の安全策として、ボタン状態が完全にリセットされるまで待機
-  delay(500);
-  M5.update();
-  Serial.println("Calibration function completed");
+  while (Serial.available() > 0) {
+    int command = Serial.read();
+    
+    // 行頭の'p'と'r'は従来どおりすぐに実行する
+    if (lineLength == 0) {
+      switch (command) {
+        case 'p':
+          Profiler::dump();
+          continue;
+        case 'r':
+          Profiler::reset();
+          Serial.println("Profiler reset");
+          continue;
+        default:
+          break;
+      }
+    }
+    
+    if (command == '\n' || command == '\r') {
+      if (lineLength > 0) {
+        line[lineLength] = '\0';
+        handleSerialLine(line);
+        lineLength = 0;
+      }
+    } else if (lineLength < sizeof(line) - 1) {
+      line[lineLength++] = (char)command;
+    }
+  }
 }
 
 void loop() {
+  // 待機を除いた1回分の処理時間を計測する
+  uint32_t loopStartCycles = Profiler::cycles();
+  
   // Get current time
   unsigned long currentTime = millis();
   unsigned long deltaTime = currentTime - lastUpdateTime;
@@ -1228,53 +1645,106 @@ void loop() {
   
   // ボタン状態が変化した場合のみ出力
   if (btnPressed != prevBtnPressed) {
-    Serial.print("Button state changed: ");
-    Serial.println(btnPressed ? "PRESSED" : "RELEASED");
+    LOG_D(LOG_TAG_MAIN, "Button state changed: %s", btnPressed ? "PRESSED" : "RELEASED");
     prevBtnPressed = btnPressed;
   }
   
   if (btnLongPressed != prevBtnLongPressed) {
-    Serial.print("Long press state: ");
-    Serial.println(btnLongPressed ? "DETECTED" : "RELEASED");
+    LOG_D(LOG_TAG_MAIN, "Long press state: %s", btnLongPressed ? "DETECTED" : "RELEASED");
     prevBtnLongPressed = btnLongPressed;
   }
   
-  // モード情報を定期的に出力
-  static unsigned long lastDebugTime = 0;
-  if (currentTime - lastDebugTime >= 1000) { // 1秒ごとに出力
-    lastDebugTime = currentTime;
-    Serial.print("Current mode: ");
-    Serial.print(currentMode);
-    if (currentMode == RAW_DATA) {
-      Serial.print(", Raw submode: ");
-      Serial.print(currentRawMode);
-    }
-    Serial.print(", longPressHandled: ");
-    Serial.println(longPressHandled);
+  // モード情報を定期的に出力（1秒ごと）
+  LOG_V_EVERY(LOG_TAG_MAIN, 1000, "Current mode: %d, Raw submode: %d, longPressHandled: %d",
+              (int)currentMode, (int)currentRawMode, (int)longPressHandled);
+  
+  // 電源管理: ボタンとセンサータスクの動き検出で点灯し、操作がなければ減光・消灯する
+  // 減光・消灯中の押下は点灯させるだけで、離すまでモード切り替えには使わない
+  static bool wakePressActive = false;
+  if (M5.BtnA.isPressed() && powerManager.notifyActivity(POWER_WAKE_BUTTON)) {
+    wakePressActive = true;
   }
+  // GPSの受信はライトスリープ中に途切れるため、GPSの時刻が得られてから許可する（以降はTimeBaseが補間する）
+  // NTPの時刻だけの間は測位を続けさせる。BLEの接続中も接続イベントを逃さないよう許可しない
+  powerManager.setLightSleepAllowed(timeBase.getSource() >= TIMEBASE_SOURCE_NMEA &&
+                                    !bleStreamer.isConnected() && !wifiAssist.isBusy());
+  powerManager.update();
   
   // Handle button presses - ボタン処理を最優先
-  handleButtonPress();
+  if (wakePressActive) {
+    if (!M5.BtnA.isPressed()) {
+      wakePressActive = false;
+    }
+  } else {
+    handleButtonPress();
+  }
   
-  // Read sensor data and update fusion
-  readGPS();
+  // キャリブレーションと通知の進行（待ち時間はタイマーで、ループは止めない）
+  serviceUiFlows();
+  
+  // Read sensor data
+  // loop()はコア1のUIタスクとして動作し、IMUはセンサータスクのスナップショットを読むだけ
+  {
+    PROFILE_SCOPE(PROFILE_GPS);
+    readGPS();
+  }
   readIMU();
   
-  // M5Unifiedを使用しているため、独自のセンサーフュージョンは不要
-  // imuFusion.update(deltaTime);
+  // 姿勢推定（AHRSEngine）はセンサータスク内で実測dtを使って更新される
   
   // Calculate celestial positions
-  calculateCelestialPositions();
+  {
+    PROFILE_SCOPE(PROFILE_EPHEMERIS);
+    calculateCelestialPositions();
+  }
   
-  // LCD更新は一定間隔で実行（ちらつき軽減と応答性のバランス）
-  static unsigned long lastDisplayTime = 0;
-  if (currentTime - lastDisplayTime >= UPDATE_INTERVAL) {
-    lastDisplayTime = currentTime;
-    
+  // センサータスクがバックグラウンドで更新した較正値を保存
+  saveBackgroundCalibration();
+  
+  // 保存の予約があればまとめてNVSに書き込む
+  // NVSは書き込み時に内部でヒープを使うが、数分に1回程度のため監視から除外する
+  {
+    ALLOC_TRAP_EXEMPT();
+    persistence.service();
+  }
+  
+  // Data Logging設定が有効な間はセッションを記録する
+  recordSession();
+  
+  // Bluetooth設定が有効な間はBLEで姿勢と極軸の誤差を送る
+  serviceBluetooth();
+  
+  // GPSの時刻が得られない間はNTPで定期的に合わせ直す
+  serviceWifiAssist();
+  
+  // 更新後の初回起動: センサータスクが姿勢を出し続けていれば確定し、出なければ前の版に戻す
+  otaUpdater.serviceBootCheck(sensorTask.isRunning() && orientation.attitudeValid);
+  
+  // LCD更新の間隔は表示中の姿勢の変化で決める（調整中は30-60Hz、静止中は1Hz）
+  // 減光中は描画間隔を延ばし、消灯中は描画しない
+  if (orientation.attitudeValid && showsAttitude()) {
+    refreshScheduler.observe(orientation.quat, currentTime);
+  }
+  if (fineAlignment && currentTime - refreshScheduler.getLastRenderMs() >= FINE_FRAME_MS) {
+    refreshScheduler.requestRedraw();
+  }
+  unsigned long frameInterval = powerManager.getFrameInterval(refreshScheduler.getInterval());
+  if (powerManager.isDisplayOn() && refreshScheduler.isDue(currentTime, frameInterval)) {
     // LCD更新
+    PROFILE_SCOPE(PROFILE_RENDER);
     updateDisplay();
-    
-    // 遅延を短くして応答性を向上
-    delay(1);
   }
+  
+  // シリアルからのプロファイラ操作（'p' = 出力、'r' = リセット）とWi-Fiの設定
+  handleSerialCommands();
+  
+  // 計測区間を締めて、一定間隔で統計を更新する
+  Profiler::record(PROFILE_LOOP, Profiler::cycles() - loopStartCycles);
+  Profiler::service(gps.getCharsProcessed(), gps.getBaud() / 10,  // 高速ボーレートへの切り替え後の値
+                    sensorTask.getI2cBytes(), BMI270_I2C_BYTES_PER_S);
+  AllocationTrap::check();
+  
+  // 次の処理まで待つ（空回りせずCPUを休ませる。動きの検出で早く戻る）
+  unsigned long elapsed = millis() - refreshScheduler.getLastRenderMs();
+  powerManager.idle(elapsed < frameInterval ? frameInterval - elapsed : 0);
 }
@@ -0,0 +1,583 @@
+/*
+ * AHRSEngine.cpp
+ * 
+ * Implementation of the quaternion AHRS engine
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "AHRSEngine.h"
+#include <math.h>
+#include <string.h>
+#include "fast_math.h"
+
+// Constructor
+AHRSEngine::AHRSEngine(AHRSAlgorithm algorithm) {
+  _algorithm = algorithm;
+  _kp = AHRS_MAHONY_KP;
+  _ki = AHRS_MAHONY_KI;
+  _beta = AHRS_MADGWICK_BETA;
+  memset(_gyroOffset, 0, sizeof(_gyroOffset));
+  reset();
+}
+
+void AHRSEngine::setAlgorithm(AHRSAlgorithm algorithm) {
+  if ((int)algorithm < 0 || (int)algorithm >= AHRS_ALGORITHM_COUNT) {
+    return;
+  }
+  _algorithm = algorithm;
+  reset();
+}
+
+void AHRSEngine::setMahonyGains(float kp, float ki) {
+  _kp = kp;
+  _ki = ki;
+}
+
+void AHRSEngine::setMadgwickBeta(float beta) {
+  _beta = beta;
+}
+
+void AHRSEngine::setGyroBias(const float bias[3]) {
+  _gyroOffset[0] = bias[0];
+  _gyroOffset[1] = bias[1];
+  _gyroOffset[2] = bias[2];
+}
+
+void AHRSEngine::reset() {
+  _initialized = false;
+  _q[0] = 1.0f;
+  _q[1] = 0.0f;
+  _q[2] = 0.0f;
+  _q[3] = 0.0f;
+  memset(_eInt, 0, sizeof(_eInt));
+  memset(_bias, 0, sizeof(_bias));
+  memset(_P, 0, sizeof(_P));
+  for (int i = 0; i < 3; i++) {
+    _P[i][i] = AHRS_ESKF_INIT_ATTITUDE * AHRS_ESKF_INIT_ATTITUDE;
+    _P[i + 3][i + 3] = AHRS_ESKF_INIT_BIAS * AHRS_ESKF_INIT_BIAS;
+  }
+  _residual = 0.0f;
+}
+
+void AHRSEngine::update(const float acc[3], const float gyro[3], const float mag[3], float dt) {
+  // 不正なdtは公称値に置き換える
+  if (dt <= 0.0f || dt > 1.0f) {
+    dt = 0.01f;
+  }
+  
+  // 加速度が1gから大きく外れている間（移動中・衝撃）は重力方向として使わない
+  float accNorm2 = acc[0] * acc[0] + acc[1] * acc[1] + acc[2] * acc[2];
+  float accUnit[3];
+  const float *a = nullptr;
+  if (accNorm2 > 0.0f) {
+    float invNorm = fastInvSqrt(accNorm2);
+    float accNorm = accNorm2 * invNorm;
+    if (fabsf(accNorm - 1.0f) < AHRS_ACC_GATE) {
+      accUnit[0] = acc[0] * invNorm;
+      accUnit[1] = acc[1] * invNorm;
+      accUnit[2] = acc[2] * invNorm;
+      a = accUnit;
+    }
+  }
+  
+  float magUnit[3];
+  const float *m = nullptr;
+  if (mag != nullptr) {
+    float magNorm2 = mag[0] * mag[0] + mag[1] * mag[1] + mag[2] * mag[2];
+    if (magNorm2 > 0.0f) {
+      float invNorm = fastInvSqrt(magNorm2);
+      magUnit[0] = mag[0] * invNorm;
+      magUnit[1] = mag[1] * invNorm;
+      magUnit[2] = mag[2] * invNorm;
+      m = magUnit;
+    }
+  }
+  
+  // 最初の有効サンプルで姿勢を直接求める（収束を待たない）
+  if (!_initialized) {
+    if (a == nullptr) {
+      return;
+    }
+    initFromVectors(a, m);
+    _initialized = true;
+    return;
+  }
+  
+  float gx = (gyro[0] - _gyroOffset[0]) * FM_DEG_TO_RAD;
+  float gy = (gyro[1] - _gyroOffset[1]) * FM_DEG_TO_RAD;
+  float gz = (gyro[2] - _gyroOffset[2]) * FM_DEG_TO_RAD;
+  
+  switch (_algorithm) {
+    case AHRS_MADGWICK:
+      updateMadgwick(gx, gy, gz, a, m, dt);
+      break;
+    case AHRS_ESKF:
+      updateEskf(gx, gy, gz, a, m, dt);
+      break;
+    case AHRS_MAHONY:
+    default:
+      updateMahony(gx, gy, gz, a, m, dt);
+      break;
+  }
+  
+  if (a != nullptr) {
+    updateResidual(a, dt);
+  }
+}
+
+void AHRSEngine::getQuaternion(float q[4]) const {
+  q[0] = _q[0];
+  q[1] = _q[1];
+  q[2] = _q[2];
+  q[3] = _q[3];
+}
+
+void AHRSEngine::getEuler(float *heading, float *pitch, float *roll) const {
+  quaternionToEuler(_q, heading, pitch, roll);
+}
+
+float AHRSEngine::getErrorEstimate() const {
+  float error2 = _residual * _residual;
+  if (_algorithm == AHRS_ESKF) {
+    error2 += _P[0][0] + _P[1][1] + _P[2][2];
+  }
+  return fastSqrt(error2) * FM_RAD_TO_DEG;
+}
+
+float AHRSEngine::getConfidence() const {
+  if (!_initialized) {
+    return 0.0f;
+  }
+  return AHRS_CONFIDENCE_REF_DEG / (AHRS_CONFIDENCE_REF_DEG + getErrorEstimate());
+}
+
+void AHRSEngine::getGyroBias(float bias[3]) const {
+  for (int i = 0; i < 3; i++) {
+    // Mahonyの積分項は補正量なので符号を反転してバイアスとする
+    bias[i] = _gyroOffset[i] + (_algorithm == AHRS_ESKF ? _bias[i] : -_eInt[i]) * FM_RAD_TO_DEG;
+  }
+}
+
+void AHRSEngine::quaternionToEuler(const float q[4], float *heading, float *pitch, float *roll) {
+  // 体軸座標系での天頂方向（加速度計が静止時に測る重力ベクトルの向き）
+  float vx = 2.0f * (q[1] * q[3] - q[0] * q[2]);
+  float vy = 2.0f * (q[0] * q[1] + q[2] * q[3]);
+  float vz = q[0] * q[0] - q[1] * q[1] - q[2] * q[2] + q[3] * q[3];
+  
+  *pitch = fastAtan2Deg(vx, fastSqrt(vy * vy + vz * vz));
+  *roll = fastAtan2Deg(vy, vz);
+  
+  // 体軸Xの水平投影の磁北からの角度（時計回り）
+  float yaw = fastAtan2Deg(2.0f * (q[1] * q[2] + q[0] * q[3]),
+                           1.0f - 2.0f * (q[2] * q[2] + q[3] * q[3]));
+  float h = -yaw;
+  if (h < 0.0f) h += 360.0f;
+  if (h >= 360.0f) h -= 360.0f;
+  *heading = h;
+}
+
+void AHRSEngine::predict(const float q[4], const float gyro[3], float dt, float out[4]) {
+  // 一定の角速度での回転 dq = (cos(θ/2), sin(θ/2)·ω/|ω|) を右から掛ける（体軸の回転）
+  float wx = gyro[0] * FM_DEG_TO_RAD;
+  float wy = gyro[1] * FM_DEG_TO_RAD;
+  float wz = gyro[2] * FM_DEG_TO_RAD;
+  float rate = sqrtf(wx * wx + wy * wy + wz * wz);
+  float halfAngle = 0.5f * rate * dt;
+  if (rate < 1e-6f || dt <= 0.0f) {
+    memcpy(out, q, 4 * sizeof(float));
+    return;
+  }
+  
+  float c = cosf(halfAngle);
+  float s = sinf(halfAngle) / rate;
+  float dq[4] = {c, wx * s, wy * s, wz * s};
+  float r[4] = {
+    q[0] * dq[0] - q[1] * dq[1] - q[2] * dq[2] - q[3] * dq[3],
+    q[0] * dq[1] + q[1] * dq[0] + q[2] * dq[3] - q[3] * dq[2],
+    q[0] * dq[2] - q[1] * dq[3] + q[2] * dq[0] + q[3] * dq[1],
+    q[0] * dq[3] + q[1] * dq[2] - q[2] * dq[1] + q[3] * dq[0]
+  };
+  memcpy(out, r, sizeof(r));
+}
+
+const char* AHRSEngine::getAlgorithmName(AHRSAlgorithm algorithm) {
+  switch (algorithm) {
+    case AHRS_MAHONY:   return "Mahony";
+    case AHRS_MADGWICK: return "Madgwick";
+    case AHRS_ESKF:     return "ESKF";
+    default:            return "Unknown";
+  }
+}
+
+void AHRSEngine::initFromVectors(const float acc[3], const float mag[3]) {
+  // 水平座標系の各軸を体軸座標系で表す（Z=天頂、Y=西、X=磁北）
+  float ref[3] = {1.0f, 0.0f, 0.0f};
+  if (mag != nullptr) {
+    ref[0] = mag[0];
+    ref[1] = mag[1];
+    ref[2] = mag[2];
+  } else if (fabsf(acc[0]) > 0.9f) {
+    // 地磁気がない場合、方位は体軸Xの向きを基準にする（X軸が鉛直ならY軸）
+    ref[0] = 0.0f;
+    ref[1] = 1.0f;
+  }
+  
+  float z[3] = {acc[0], acc[1], acc[2]};
+  float y[3] = {z[1] * ref[2] - z[2] * ref[1],
+                z[2] * ref[0] - z[0] * ref[2],
+                z[0] * ref[1] - z[1] * ref[0]};
+  float yNorm2 = y[0] * y[0] + y[1] * y[1] + y[2] * y[2];
+  if (yNorm2 < 1e-6f) {
+    // 地磁気が鉛直方向と平行：重力のみで初期化
+    float fallback[3] = {0.0f, 0.0f, 0.0f};
+    fallback[fabsf(acc[0]) > 0.9f ? 1 : 0] = 1.0f;
+    y[0] = z[1] * fallback[2] - z[2] * fallback[1];
+    y[1] = z[2] * fallback[0] - z[0] * fallback[2];
+    y[2] = z[0] * fallback[1] - z[1] * fallback[0];
+    yNorm2 = y[0] * y[0] + y[1] * y[1] + y[2] * y[2];
+  }
+  float invNorm = fastInvSqrt(yNorm2);
+  y[0] *= invNorm;
+  y[1] *= invNorm;
+  y[2] *= invNorm;
+  float x[3] = {y[1] * z[2] - y[2] * z[1],
+                y[2] * z[0] - y[0] * z[2],
+                y[0] * z[1] - y[1] * z[0]};
+  
+  // 回転行列（行がx, y, z）からクォータニオンへ変換
+  float trace = x[0] + y[1] + z[2];
+  if (trace > 0.0f) {
+    float s = sqrtf(trace + 1.0f) * 2.0f;
+    _q[0] = 0.25f * s;
+    _q[1] = (z[1] - y[2]) / s;
+    _q[2] = (x[2] - z[0]) / s;
+    _q[3] = (y[0] - x[1]) / s;
+  } else if (x[0] > y[1] && x[0] > z[2]) {
+    float s = sqrtf(1.0f + x[0] - y[1] - z[2]) * 2.0f;
+    _q[0] = (z[1] - y[2]) / s;
+    _q[1] = 0.25f * s;
+    _q[2] = (x[1] + y[0]) / s;
+    _q[3] = (x[2] + z[0]) / s;
+  } else if (y[1] > z[2]) {
+    float s = sqrtf(1.0f + y[1] - x[0] - z[2]) * 2.0f;
+    _q[0] = (x[2] - z[0]) / s;
+    _q[1] = (x[1] + y[0]) / s;
+    _q[2] = 0.25f * s;
+    _q[3] = (y[2] + z[1]) / s;
+  } else {
+    float s = sqrtf(1.0f + z[2] - x[0] - y[1]) * 2.0f;
+    _q[0] = (y[0] - x[1]) / s;
+    _q[1] = (x[2] + z[0]) / s;
+    _q[2] = (y[2] + z[1]) / s;
+    _q[3] = 0.25f * s;
+  }
+  normalize();
+}
+
+void AHRSEngine::updateMahony(float gx, float gy, float gz, const float *acc, const float *mag, float dt) {
+  const float *q = _q;
+  
+  if (acc != nullptr) {
+    // 推定した重力方向と実測値の外積が姿勢誤差
+    float vx = 2.0f * (q[1] * q[3] - q[0] * q[2]);
+    float vy = 2.0f * (q[0] * q[1] + q[2] * q[3]);
+    float vz = q[0] * q[0] - q[1] * q[1] - q[2] * q[2] + q[3] * q[3];
+    
+    float ex = acc[1] * vz - acc[2] * vy;
+    float ey = acc[2] * vx - acc[0] * vz;
+    float ez = acc[0] * vy - acc[1] * vx;
+    
+    if (mag != nullptr) {
+      // 地磁気を水平座標系に変換し、水平成分をX軸に揃えた基準方向を作る
+      float mx = mag[0], my = mag[1], mz = mag[2];
+      float hx = 2.0f * (mx * (0.5f - q[2] * q[2] - q[3] * q[3]) + my * (q[1] * q[2] - q[0] * q[3]) + mz * (q[1] * q[3] + q[0] * q[2]));
+      float hy = 2.0f * (mx * (q[1] * q[2] + q[0] * q[3]) + my * (0.5f - q[1] * q[1] - q[3] * q[3]) + mz * (q[2] * q[3] - q[0] * q[1]));
+      float hz = 2.0f * (mx * (q[1] * q[3] - q[0] * q[2]) + my * (q[2] * q[3] + q[0] * q[1]) + mz * (0.5f - q[1] * q[1] - q[2] * q[2]));
+      float bx = fastSqrt(hx * hx + hy * hy);
+      float bz = hz;
+      
+      // 基準方向を体軸座標系に戻した推定値
+      float wx = 2.0f * bx * (0.5f - q[2] * q[2] - q[3] * q[3]) + 2.0f * bz * (q[1] * q[3] - q[0] * q[2]);
+      float wy = 2.0f * bx * (q[1] * q[2] - q[0] * q[3]) + 2.0f * bz * (q[0] * q[1] + q[2] * q[3]);
+      float wz = 2.0f * bx * (q[0] * q[2] + q[1] * q[3]) + 2.0f * bz * (0.5f - q[1] * q[1] - q[2] * q[2]);
+      
+      ex += my * wz - mz * wy;
+      ey += mz * wx - mx * wz;
+      ez += mx * wy - my * wx;
+    }
+    
+    if (_ki > 0.0f) {
+      _eInt[0] += _ki * ex * dt;
+      _eInt[1] += _ki * ey * dt;
+      _eInt[2] += _ki * ez * dt;
+      gx += _eInt[0];
+      gy += _eInt[1];
+      gz += _eInt[2];
+    }
+    
+    gx += _kp * ex;
+    gy += _kp * ey;
+    gz += _kp * ez;
+  }
+  
+  integrate(gx, gy, gz, dt);
+}
+
+void AHRSEngine::updateMadgwick(float gx, float gy, float gz, const float *acc, const float *mag, float dt) {
+  float q0 = _q[0], q1 = _q[1], q2 = _q[2], q3 = _q[3];
+  
+  // ジャイロによるクォータニオンの変化率
+  float qDot0 = 0.5f * (-q1 * gx - q2 * gy - q3 * gz);
+  float qDot1 = 0.5f * (q0 * gx + q2 * gz - q3 * gy);
+  float qDot2 = 0.5f * (q0 * gy - q1 * gz + q3 * gx);
+  float qDot3 = 0.5f * (q0 * gz + q1 * gy - q2 * gx);
+  
+  if (acc != nullptr) {
+    float ax = acc[0], ay = acc[1], az = acc[2];
+    float s0, s1, s2, s3;
+    
+    if (mag != nullptr) {
+      // 重力と地磁気の目的関数の勾配
+      float mx = mag[0], my = mag[1], mz = mag[2];
+      float _2q0mx = 2.0f * q0 * mx;
+      float _2q0my = 2.0f * q0 * my;
+      float _2q0mz = 2.0f * q0 * mz;
+      float _2q1mx = 2.0f * q1 * mx;
+      float _2q0 = 2.0f * q0;
+      float _2q1 = 2.0f * q1;
+      float _2q2 = 2.0f * q2;
+      float _2q3 = 2.0f * q3;
+      float _2q0q2 = 2.0f * q0 * q2;
+      float _2q2q3 = 2.0f * q2 * q3;
+      float q0q0 = q0 * q0;
+      float q0q1 = q0 * q1;
+      float q0q2 = q0 * q2;
+      float q0q3 = q0 * q3;
+      float q1q1 = q1 * q1;
+      float q1q2 = q1 * q2;
+      float q1q3 = q1 * q3;
+      float q2q2 = q2 * q2;
+      float q2q3 = q2 * q3;
+      float q3q3 = q3 * q3;
+      
+      float hx = mx * q0q0 - _2q0my * q3 + _2q0mz * q2 + mx * q1q1 + _2q1 * my * q2 + _2q1 * mz * q3 - mx * q2q2 - mx * q3q3;
+      float hy = _2q0mx * q3 + my * q0q0 - _2q0mz * q1 + _2q1mx * q2 - my * q1q1 + my * q2q2 + _2q2 * mz * q3 - my * q3q3;
+      float _2bx = fastSqrt(hx * hx + hy * hy);
+      float _2bz = -_2q0mx * q2 + _2q0my * q1 + mz * q0q0 + _2q1mx * q3 - mz * q1q1 + _2q2 * my * q3 - mz * q2q2 + mz * q3q3;
+      float _4bx = 2.0f * _2bx;
+      float _4bz = 2.0f * _2bz;
+      
+      float fgx = 2.0f * q1q3 - _2q0q2 - ax;
+      float fgy = 2.0f * q0q1 + _2q2q3 - ay;
+      float fgz = 1.0f - 2.0f * q1q1 - 2.0f * q2q2 - az;
+      float fmx = _2bx * (0.5f - q2q2 - q3q3) + _2bz * (q1q3 - q0q2) - mx;
+      float fmy = _2bx * (q1q2 - q0q3) + _2bz * (q0q1 + q2q3) - my;
+      float fmz = _2bx * (q0q2 + q1q3) + _2bz * (0.5f - q1q1 - q2q2) - mz;
+      
+      s0 = -_2q2 * fgx + _2q1 * fgy - _2bz * q2 * fmx + (-_2bx * q3 + _2bz * q1) * fmy + _2bx * q2 * fmz;
+      s1 = _2q3 * fgx + _2q0 * fgy - 4.0f * q1 * fgz + _2bz * q3 * fmx + (_2bx * q2 + _2bz * q0) * fmy + (_2bx * q3 - _4bz * q1) * fmz;
+      s2 = -_2q0 * fgx + _2q3 * fgy - 4.0f * q2 * fgz + (-_4bx * q2 - _2bz * q0) * fmx + (_2bx * q1 + _2bz * q3) * fmy + (_2bx * q0 - _4bz * q2) * fmz;
+      s3 = _2q1 * fgx + _2q2 * fgy + (-_4bx * q3 + _2bz * q1) * fmx + (-_2bx * q0 + _2bz * q2) * fmy + _2bx * q1 * fmz;
+    } else {
+      // 重力のみの目的関数の勾配
+      float _2q0 = 2.0f * q0;
+      float _2q1 = 2.0f * q1;
+      float _2q2 = 2.0f * q2;
+      float _2q3 = 2.0f * q3;
+      float _4q0 = 4.0f * q0;
+      float _4q1 = 4.0f * q1;
+      float _4q2 = 4.0f * q2;
+      float _8q1 = 8.0f * q1;
+      float _8q2 = 8.0f * q2;
+      float q0q0 = q0 * q0;
+      float q1q1 = q1 * q1;
+      float q2q2 = q2 * q2;
+      float q3q3 = q3 * q3;
+      
+      s0 = _4q0 * q2q2 + _2q2 * ax + _4q0 * q1q1 - _2q1 * ay;
+      s1 = _4q1 * q3q3 - _2q3 * ax + 4.0f * q0q0 * q1 - _2q0 * ay - _4q1 + _8q1 * q1q1 + _8q1 * q2q2 + _4q1 * az;
+      s2 = 4.0f * q0q0 * q2 + _2q0 * ax + _4q2 * q3q3 - _2q3 * ay - _4q2 + _8q2 * q1q1 + _8q2 * q2q2 + _4q2 * az;
+      s3 = 4.0f * q1q1 * q3 - _2q1 * ax + 4.0f * q2q2 * q3 - _2q2 * ay;
+    }
+    
+    float sNorm2 = s0 * s0 + s1 * s1 + s2 * s2 + s3 * s3;
+    if (sNorm2 > 0.0f) {
+      float invNorm = fastInvSqrt(sNorm2);
+      qDot0 -= _beta * s0 * invNorm;
+      qDot1 -= _beta * s1 * invNorm;
+      qDot2 -= _beta * s2 * invNorm;
+      qDot3 -= _beta * s3 * invNorm;
+    }
+  }
+  
+  _q[0] = q0 + qDot0 * dt;
+  _q[1] = q1 + qDot1 * dt;
+  _q[2] = q2 + qDot2 * dt;
+  _q[3] = q3 + qDot3 * dt;
+  normalize();
+}
+
+void AHRSEngine::updateEskf(float gx, float gy, float gz, const float *acc, const float *mag, float dt) {
+  // 推定バイアスを除いた角速度で公称状態を進める
+  float wx = gx - _bias[0];
+  float wy = gy - _bias[1];
+  float wz = gz - _bias[2];
+  integrate(wx, wy, wz, dt);
+  eskfPredict(wx, wy, wz, dt);
+  
+  const float *q = _q;
+  float dx[6] = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+  bool corrected = false;
+  
+  // 体軸座標系での天頂方向
+  float v[3] = {2.0f * (q[1] * q[3] - q[0] * q[2]),
+                2.0f * (q[0] * q[1] + q[2] * q[3]),
+                q[0] * q[0] - q[1] * q[1] - q[2] * q[2] + q[3] * q[3]};
+  
+  if (acc != nullptr) {
+    // 重力方向の観測（H = [v]x）を成分ごとに逐次処理する
+    float rows[3][3] = {{0.0f, -v[2], v[1]},
+                        {v[2], 0.0f, -v[0]},
+                        {-v[1], v[0], 0.0f}};
+    float variance = AHRS_ESKF_ACC_NOISE * AHRS_ESKF_ACC_NOISE;
+    for (int i = 0; i < 3; i++) {
+      eskfScalarUpdate(rows[i], acc[i] - v[i], variance, dx);
+    }
+    corrected = true;
+  }
+  
+  if (mag != nullptr) {
+    // 地磁気は方位のみに使う（傾きの推定に磁場の伏角・擾乱を混ぜない）
+    float mx = mag[0], my = mag[1], mz = mag[2];
+    float hx = 2.0f * (mx * (0.5f - q[2] * q[2] - q[3] * q[3]) + my * (q[1] * q[2] - q[0] * q[3]) + mz * (q[1] * q[3] + q[0] * q[2]));
+    float hy = 2.0f * (mx * (q[1] * q[2] + q[0] * q[3]) + my * (0.5f - q[1] * q[1] - q[3] * q[3]) + mz * (q[2] * q[3] - q[0] * q[1]));
+    if (hx * hx + hy * hy > 1e-4f) {
+      // 水平面内の磁北のずれ（天頂軸まわりの回転、H = v）
+      eskfScalarUpdate(v, -fastAtan2(hy, hx), AHRS_ESKF_MAG_NOISE * AHRS_ESKF_MAG_NOISE, dx);
+      corrected = true;
+    }
+  }
+  
+  if (!corrected) {
+    return;
+  }
+  
+  // 誤差状態を公称状態に反映（q ⊗ [1, δθ/2]）
+  float q0 = _q[0], q1 = _q[1], q2 = _q[2], q3 = _q[3];
+  float hx = 0.5f * dx[0], hy = 0.5f * dx[1], hz = 0.5f * dx[2];
+  _q[0] = q0 - q1 * hx - q2 * hy - q3 * hz;
+  _q[1] = q1 + q0 * hx + q2 * hz - q3 * hy;
+  _q[2] = q2 + q0 * hy - q1 * hz + q3 * hx;
+  _q[3] = q3 + q0 * hz + q1 * hy - q2 * hx;
+  normalize();
+  
+  _bias[0] += dx[3];
+  _bias[1] += dx[4];
+  _bias[2] += dx[5];
+}
+
+void AHRSEngine::eskfPredict(float wx, float wy, float wz, float dt) {
+  // F = [[I - [ω]x dt, -I dt], [0, I]]
+  float F[6][6];
+  memset(F, 0, sizeof(F));
+  F[0][0] = 1.0f;      F[0][1] = wz * dt;   F[0][2] = -wy * dt;
+  F[1][0] = -wz * dt;  F[1][1] = 1.0f;      F[1][2] = wx * dt;
+  F[2][0] = wy * dt;   F[2][1] = -wx * dt;  F[2][2] = 1.0f;
+  for (int i = 0; i < 3; i++) {
+    F[i][i + 3] = -dt;
+    F[i + 3][i + 3] = 1.0f;
+  }
+  
+  // P = F P F^T + Q
+  float FP[6][6];
+  for (int i = 0; i < 6; i++) {
+    for (int j = 0; j < 6; j++) {
+      float sum = 0.0f;
+      for (int k = 0; k < 6; k++) {
+        sum += F[i][k] * _P[k][j];
+      }
+      FP[i][j] = sum;
+    }
+  }
+  for (int i = 0; i < 6; i++) {
+    for (int j = i; j < 6; j++) {
+      float sum = 0.0f;
+      for (int k = 0; k < 6; k++) {
+        sum += FP[i][k] * F[j][k];
+      }
+      _P[i][j] = sum;
+      _P[j][i] = sum;
+    }
+  }
+  
+  float gyroVar = AHRS_ESKF_GYRO_NOISE * AHRS_ESKF_GYRO_NOISE * dt;
+  float biasVar = AHRS_ESKF_BIAS_NOISE * AHRS_ESKF_BIAS_NOISE * dt;
+  for (int i = 0; i < 3; i++) {
+    _P[i][i] += gyroVar;
+    _P[i + 3][i + 3] += biasVar;
+  }
+}
+
+void AHRSEngine::eskfScalarUpdate(const float h[3], float residual, float variance, float dx[6]) {
+  // Hは姿勢誤差の3成分のみ非ゼロ（バイアスは共分散を通じて補正される）
+  float PHt[6];
+  for (int i = 0; i < 6; i++) {
+    PHt[i] = _P[i][0] * h[0] + _P[i][1] * h[1] + _P[i][2] * h[2];
+  }
+  float S = h[0] * PHt[0] + h[1] * PHt[1] + h[2] * PHt[2] + variance;
+  if (S <= 0.0f) {
+    return;
+  }
+  
+  // 同じ線形化点で逐次処理するため、これまでの補正量を残差から差し引く
+  float r = residual - (h[0] * dx[0] + h[1] * dx[1] + h[2] * dx[2]);
+  float invS = 1.0f / S;
+  for (int i = 0; i < 6; i++) {
+    float K = PHt[i] * invS;
+    dx[i] += K * r;
+    for (int j = 0; j < 6; j++) {
+      _P[i][j] -= K * PHt[j];
+    }
+  }
+}
+
+void AHRSEngine::integrate(float gx, float gy, float gz, float dt) {
+  float q0 = _q[0], q1 = _q[1], q2 = _q[2], q3 = _q[3];
+  float halfDt = 0.5f * dt;
+  _q[0] = q0 + (-q1 * gx - q2 * gy - q3 * gz) * halfDt;
+  _q[1] = q1 + (q0 * gx + q2 * gz - q3 * gy) * halfDt;
+  _q[2] = q2 + (q0 * gy - q1 * gz + q3 * gx) * halfDt;
+  _q[3] = q3 + (q0 * gz + q1 * gy - q2 * gx) * halfDt;
+  normalize();
+}
+
+void AHRSEngine::normalize() {
+  float norm2 = _q[0] * _q[0] + _q[1] * _q[1] + _q[2] * _q[2] + _q[3] * _q[3];
+  if (norm2 <= 0.0f) {
+    _q[0] = 1.0f;
+    _q[1] = _q[2] = _q[3] = 0.0f;
+    return;
+  }
+  float invNorm = fastInvSqrt(norm2);
+  _q[0] *= invNorm;
+  _q[1] *= invNorm;
+  _q[2] *= invNorm;
+  _q[3] *= invNorm;
+}
+
+void AHRSEngine::updateResidual(const float acc[3], float dt) {
+  // 推定した重力方向と実測値のなす角（外積の大きさ ≈ sin）
+  const float *q = _q;
+  float vx = 2.0f * (q[1] * q[3] - q[0] * q[2]);
+  float vy = 2.0f * (q[0] * q[1] + q[2] * q[3]);
+  float vz = q[0] * q[0] - q[1] * q[1] - q[2] * q[2] + q[3] * q[3];
+  float cx = acc[1] * vz - acc[2] * vy;
+  float cy = acc[2] * vx - acc[0] * vz;
+  float cz = acc[0] * vy - acc[1] * vx;
+  float angle = fastSqrt(cx * cx + cy * cy + cz * cz);
+  
+  float alpha = dt / (AHRS_RESIDUAL_TAU + dt);
+  _residual += alpha * (angle - _residual);
+}
@@ -0,0 +1,156 @@
+/*
+ * AHRSEngine.h
+ * 
+ * Quaternion attitude and heading reference system for the Polaris Navigator
+ * Selectable Mahony, Madgwick or error-state Kalman filter, with all
+ * filter state held per instance
+ * 
+ * クォータニオンは体軸座標系から水平座標系（X=磁北、Z=天頂）への回転。
+ * オイラー角への変換は表示時にquaternionToEuler()で行う。
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef AHRS_ENGINE_H
+#define AHRS_ENGINE_H
+
+#include "hal.h"
+
+// Filter algorithms
+enum AHRSAlgorithm {
+  AHRS_MAHONY,
+  AHRS_MADGWICK,
+  AHRS_ESKF
+};
+
+#define AHRS_ALGORITHM_COUNT    3
+
+// Mahony gains
+#define AHRS_MAHONY_KP          8.0f    // 比例ゲイン
+#define AHRS_MAHONY_KI          0.0f    // 積分ゲイン（ジャイロバイアス推定）
+
+// Madgwick gain
+#define AHRS_MADGWICK_BETA      0.1f
+
+// Error-state Kalman filter noise (1σ)
+#define AHRS_ESKF_GYRO_NOISE    0.005f  // 角速度ノイズ (rad/s)
+#define AHRS_ESKF_BIAS_NOISE    0.0001f // ジャイロバイアスのランダムウォーク (rad/s/√s)
+#define AHRS_ESKF_ACC_NOISE     0.03f   // 正規化した重力方向のノイズ
+#define AHRS_ESKF_MAG_NOISE     0.05f   // 地磁気から求めた方位のノイズ (rad)
+#define AHRS_ESKF_INIT_ATTITUDE 0.1f    // 初期姿勢の不確かさ (rad)
+#define AHRS_ESKF_INIT_BIAS     0.01f   // 初期バイアスの不確かさ (rad/s)
+
+// 加速度の大きさが1gからこれ以上ずれている間は重力方向として使わない
+#define AHRS_ACC_GATE           0.2f    // (g)
+
+// Confidence figure
+#define AHRS_RESIDUAL_TAU       1.0f    // 残差のローパスフィルタ時定数（秒）
+#define AHRS_CONFIDENCE_REF_DEG 2.0f    // 推定誤差がこの値のとき信頼度0.5
+
+class AHRSEngine {
+public:
+  // Constructor
+  AHRSEngine(AHRSAlgorithm algorithm = AHRS_MAHONY);
+  
+  // Select the filter algorithm (resets the filter state)
+  void setAlgorithm(AHRSAlgorithm algorithm);
+  AHRSAlgorithm getAlgorithm() const { return _algorithm; }
+  
+  // Set filter gains
+  void setMahonyGains(float kp, float ki);
+  void setMadgwickBeta(float beta);
+  
+  // Reset the filter (the next update re-initializes from accel/mag)
+  // The external gyro bias is kept
+  void reset();
+  
+  // External gyro bias in dps, subtracted before every update
+  // (GyroBiasEstimator; ESKF/Mahony Ki then only track the residual)
+  void setGyroBias(const float bias[3]);
+  
+  // Update from one sample
+  // acc (g), gyro (dps) and mag (any unit) must share the same body frame;
+  // mag may be nullptr for a 6-axis update. dt is the sample interval in seconds.
+  void update(const float acc[3], const float gyro[3], const float mag[3], float dt);
+  
+  // True once the first accelerometer sample has aligned the filter
+  bool isInitialized() const { return _initialized; }
+  
+  // Get orientation
+  void getQuaternion(float q[4]) const;
+  void getEuler(float *heading, float *pitch, float *roll) const;
+  
+  // Estimated attitude error in degrees (1σ) and a 0-1 confidence figure
+  // ESKFは共分散と残差、Mahony/Madgwickは残差のみから求める
+  float getErrorEstimate() const;
+  float getConfidence() const;
+  
+  // Estimated gyro bias in dps (external bias plus the ESKF or Mahony Ki estimate)
+  void getGyroBias(float bias[3]) const;
+  
+  // Convert a quaternion to heading (0-360), pitch (+/-90) and roll (+/-180) in degrees
+  // 方位角は時計回り、ピッチ・ロールは重力ベクトルから求める従来の定義と同じ
+  static void quaternionToEuler(const float q[4], float *heading, float *pitch, float *roll);
+  
+  // Extrapolate a quaternion by constant body rates (dps) over dt seconds
+  // 表示の遅れ（センサー→描画→転送）を補うため、描画する姿勢を先に進める
+  static void predict(const float q[4], const float gyro[3], float dt, float out[4]);
+  
+  // Map a vector from the AtomS3R IMU axes to the polar alignment body axes
+  // 極軸合わせではデバイスの上面（-X方向）を天の北極/南極に向ける
+  static void fromDeviceAxes(const float device[3], float body[3]) {
+    body[0] = device[1];    // X軸をY軸に変更（デバイスの上方向を右方向と再定義）
+    body[1] = -device[0];   // Y軸を-X軸に変更（デバイスの右方向を下方向と再定義）
+    body[2] = device[2];    // Z軸はそのまま（画面垂直方向）
+  }
+  
+  // Display name of an algorithm
+  static const char* getAlgorithmName(AHRSAlgorithm algorithm);
+
+private:
+  // Align the quaternion directly from gravity and the magnetic field
+  void initFromVectors(const float acc[3], const float mag[3]);
+  
+  // Per-algorithm updates (gyro in rad/s, acc normalized or nullptr when gated)
+  void updateMahony(float gx, float gy, float gz, const float *acc, const float *mag, float dt);
+  void updateMadgwick(float gx, float gy, float gz, const float *acc, const float *mag, float dt);
+  void updateEskf(float gx, float gy, float gz, const float *acc, const float *mag, float dt);
+  
+  // ESKF helpers
+  void eskfPredict(float wx, float wy, float wz, float dt);
+  void eskfScalarUpdate(const float h[3], float residual, float variance, float dx[6]);
+  
+  // Integrate body rates (rad/s) into the quaternion
+  void integrate(float gx, float gy, float gz, float dt);
+  void normalize();
+  
+  // Track the gravity residual for the confidence figure
+  void updateResidual(const float acc[3], float dt);
+  
+  AHRSAlgorithm _algorithm;
+  bool _initialized;
+  
+  // Orientation (w, x, y, z)
+  float _q[4];
+  
+  // External gyro bias (dps)
+  float _gyroOffset[3];
+  
+  // Mahony
+  float _kp;
+  float _ki;
+  float _eInt[3];
+  
+  // Madgwick
+  float _beta;
+  
+  // ESKF: error state [δθ(3), gyro bias(3)]
+  float _bias[3];
+  float _P[6][6];
+  
+  // Low-pass filtered angle between measured and predicted gravity (rad)
+  float _residual;
+};
+
+#endif // AHRS_ENGINE_H
@@ -0,0 +1,187 @@
+/*
+ * AlignmentAverager.cpp
+ * 
+ * Implementation of the fine alignment averager
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "AlignmentAverager.h"
+#include <math.h>
+#include <string.h>
+#include "AHRSEngine.h"
+
+// Constructor
+AlignmentAverager::AlignmentAverager() {
+  memset(&_estimate, 0, sizeof(_estimate));
+  reset();
+  _estimate.resets = 0;
+}
+
+void AlignmentAverager::reset() {
+  memset(_sum, 0, sizeof(_sum));
+  _sumCount = 0;
+  _blockStartUs = 0;
+  _head = 0;
+  _count = 0;
+  _referenceHeading = 0.0f;
+  _cosPitch = 1.0f;
+  _estimate.valid = false;
+  _estimate.blocks = 0;
+  _estimate.windowS = 0.0f;
+}
+
+int AlignmentAverager::index(int back) const {
+  int i = _head - 1 - back;
+  return i < 0 ? i + ALIGN_AVG_HISTORY : i;
+}
+
+bool AlignmentAverager::addSample(const float quat[4], int64_t timestampUs) {
+  if (_sumCount == 0) {
+    _blockStartUs = timestampUs;
+  }
+  
+  // qと-qは同じ姿勢なので、ブロックの最初のサンプルと同じ半球にそろえて加える
+  float sign = 1.0f;
+  if (_sumCount > 0 &&
+      _sum[0] * quat[0] + _sum[1] * quat[1] + _sum[2] * quat[2] + _sum[3] * quat[3] < 0.0f) {
+    sign = -1.0f;
+  }
+  for (int i = 0; i < 4; i++) {
+    _sum[i] += sign * quat[i];
+  }
+  _sumCount++;
+  
+  if (timestampUs - _blockStartUs < ALIGN_AVG_BLOCK_US) {
+    return false;
+  }
+  closeBlock();
+  return true;
+}
+
+void AlignmentAverager::closeBlock() {
+  // ブロック内は小さな回転なので、成分の平均を正規化すれば平均の姿勢になる
+  float norm = sqrtf(_sum[0] * _sum[0] + _sum[1] * _sum[1] + _sum[2] * _sum[2] + _sum[3] * _sum[3]);
+  float mean[4] = {1.0f, 0.0f, 0.0f, 0.0f};
+  if (norm > 0.0f) {
+    for (int i = 0; i < 4; i++) {
+      mean[i] = _sum[i] / norm;
+    }
+  }
+  memset(_sum, 0, sizeof(_sum));
+  _sumCount = 0;
+  
+  float heading, pitch, roll;
+  AHRSEngine::quaternionToEuler(mean, &heading, &pitch, &roll);
+  
+  // 方位角は最初のブロックからの差で持つ（0/360度をまたいでも平均できる）
+  if (_count == 0) {
+    _referenceHeading = heading;
+    _cosPitch = cosf(pitch * DEG_TO_RAD);
+  }
+  float dh = heading - _referenceHeading;
+  if (dh > 180.0f) dh -= 360.0f;
+  if (dh < -180.0f) dh += 360.0f;
+  
+  // 平均から外れたブロックは架台を動かしたものとして、そこからやり直す
+  if (_estimate.valid) {
+    float meanHeading = _estimate.heading - _referenceHeading;
+    if (meanHeading > 180.0f) meanHeading -= 360.0f;
+    if (meanHeading < -180.0f) meanHeading += 360.0f;
+    float dx = (dh - meanHeading) * _cosPitch;
+    float dy = pitch - _estimate.pitch;
+    float limit = fmaxf(ALIGN_AVG_RESET_DEG, ALIGN_AVG_RESET_SIGMA * _estimate.sigmaDeg);
+    if (dx * dx + dy * dy > limit * limit) {
+      uint32_t resets = _estimate.resets + 1;
+      reset();
+      _estimate.resets = resets;
+      _referenceHeading = heading;
+      _cosPitch = cosf(pitch * DEG_TO_RAD);
+      dh = 0.0f;
+    }
+  }
+  
+  _heading[_head] = dh;
+  _pitch[_head] = pitch;
+  _head = (_head + 1) % ALIGN_AVG_HISTORY;
+  if (_count < ALIGN_AVG_HISTORY) {
+    _count++;
+  }
+  
+  // 古い順の累積和（任意の区間の平均を1回の引き算で求める）
+  _prefixH[0] = 0.0f;
+  _prefixP[0] = 0.0f;
+  for (int k = 0; k < _count; k++) {
+    int i = index(_count - 1 - k);
+    _prefixH[k + 1] = _prefixH[k] + _heading[i];
+    _prefixP[k + 1] = _prefixP[k] + _pitch[i];
+  }
+  
+  // クラスタの大きさを倍々に変えてAllan分散が最小になる窓を選ぶ
+  int bestM = 0;
+  float bestVariance = 0.0f;
+  float whiteVariance = 0.0f;
+  for (int m = 1; m * ALIGN_AVG_MIN_CLUSTERS <= _count; m *= 2) {
+    float variance = allanVariance(m, _count);
+    if (m == 1) {
+      whiteVariance = variance;
+    }
+    if (bestM == 0 || variance < bestVariance) {
+      bestM = m;
+      bestVariance = variance;
+    }
+  }
+  
+  _estimate.blocks = (uint16_t)_count;
+  if (bestM == 0) {
+    // まだ最短の窓も作れない間は最新のブロックをそのまま出す
+    _estimate.heading = heading;
+    _estimate.pitch = pitch;
+    _estimate.windowS = ALIGN_AVG_BLOCK_US * 1e-6f;
+    _estimate.valid = false;
+    return;
+  }
+  
+  float meanHeading, meanPitch;
+  meanOf(bestM, &meanHeading, &meanPitch);
+  meanHeading += _referenceHeading;
+  if (meanHeading < 0.0f) meanHeading += 360.0f;
+  if (meanHeading >= 360.0f) meanHeading -= 360.0f;
+  
+  _estimate.heading = meanHeading;
+  _estimate.pitch = meanPitch;
+  // 長い窓のAllan分散はクラスタが少なく、最小を選ぶと小さく出やすい。
+  // 精度の高いm=1の値から白色雑音として見込む値を下限にする
+  _estimate.sigmaDeg = sqrtf(fmaxf(bestVariance, whiteVariance / bestM));
+  _estimate.windowS = bestM * ALIGN_AVG_BLOCK_US * 1e-6f;
+  _estimate.valid = true;
+}
+
+float AlignmentAverager::allanVariance(int m, int n) const {
+  // 重なりありのAllan分散: 隣り合うm個ずつの平均の差を1ブロックずつずらして集める
+  int terms = n - 2 * m + 1;
+  float sum = 0.0f;
+  for (int k = 0; k < terms; k++) {
+    float h1 = _prefixH[k + m] - _prefixH[k];
+    float h2 = _prefixH[k + 2 * m] - _prefixH[k + m];
+    float p1 = _prefixP[k + m] - _prefixP[k];
+    float p2 = _prefixP[k + 2 * m] - _prefixP[k + m];
+    float dx = (h2 - h1) / m * _cosPitch;
+    float dy = (p2 - p1) / m;
+    sum += dx * dx + dy * dy;
+  }
+  // 2軸の合計なので、1軸あたりに直して返す（円の半径の1σ）
+  return 0.5f * sum / terms * 0.5f;
+}
+
+void AlignmentAverager::meanOf(int m, float* heading, float* pitch) const {
+  float h = 0.0f, p = 0.0f;
+  for (int j = 0; j < m; j++) {
+    int i = index(j);
+    h += _heading[i];
+    p += _pitch[i];
+  }
+  *heading = h / m;
+  *pitch = p / m;
+}
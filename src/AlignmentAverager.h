@@ -0,0 +1,93 @@
+/*
+ * AlignmentAverager.h
+ * 
+ * Pointing averager for fine polar alignment
+ * Averages the fused attitude into short blocks and picks the averaging
+ * window from the Allan deviation of the block means
+ * 
+ * センサータスクが全サンプルの姿勢（クォータニオン）を渡し、
+ * ALIGN_AVG_BLOCK_USごとに平均した方位角・高度を履歴に積む。
+ * 窓の長さmブロックごとの（重なりありの）Allan偏差を求め、最小になるmの窓で
+ * 直近の平均を出力する（白色雑音が支配的な間は窓が伸び、
+ * ドリフトが見え始めるとそれ以上は伸ばさない）。出力の1σには
+ * そのmでのAllan偏差を使う。架台を動かして平均から大きく外れた
+ * ブロックが来たら履歴を捨ててやり直す。
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef ALIGNMENT_AVERAGER_H
+#define ALIGNMENT_AVERAGER_H
+
+#include "hal.h"
+
+// Block averaging
+#define ALIGN_AVG_BLOCK_US     50000   // 1ブロックの長さ（400Hzで20サンプル）
+#define ALIGN_AVG_HISTORY      240     // 保持するブロック数（12秒）
+#define ALIGN_AVG_MIN_CLUSTERS 3       // Allan偏差を求める最小のクラスタ数
+
+// Restart when a new block leaves the current average
+#define ALIGN_AVG_RESET_DEG    0.05f   // 3分角（雑音に対してこの値とRESET_SIGMAの大きい方）
+#define ALIGN_AVG_RESET_SIGMA  5.0f
+
+// Averaged pointing (published by the sensor task)
+struct AlignmentEstimate {
+  float heading;       // 平均の方位角（度 0-360、姿勢の出力から）
+  float pitch;         // 平均の高度（度）
+  float sigmaDeg;      // 平均の1σ（方位は天球上の角度に換算、度）
+  float windowS;       // 使った窓の長さ（秒）
+  uint16_t blocks;     // 履歴のブロック数
+  uint32_t resets;     // 動きで履歴を捨てた回数
+  bool valid;          // 最短の窓でもAllan偏差が求まった
+};
+
+class AlignmentAverager {
+public:
+  // Constructor
+  AlignmentAverager();
+  
+  // Discard the history
+  void reset();
+  
+  // Add one attitude sample (w, x, y, z)
+  // Returns true when a block closed and the estimate was updated
+  bool addSample(const float quat[4], int64_t timestampUs);
+  
+  const AlignmentEstimate& getEstimate() const { return _estimate; }
+
+private:
+  // Close the current block and update the estimate
+  void closeBlock();
+  
+  // Overlapping Allan variance of the last n blocks at cluster size m
+  // (heading scaled to the sky, uses the running sums)
+  float allanVariance(int m, int n) const;
+  
+  // Mean of the last m blocks
+  void meanOf(int m, float* heading, float* pitch) const;
+  
+  // Block i counted back from the newest (0 = newest)
+  int index(int back) const;
+  
+  // Current block (quaternion sum, sign-aligned with its first sample)
+  float _sum[4];
+  uint16_t _sumCount;
+  int64_t _blockStartUs;
+  
+  // Block means relative to the reference heading (ring buffer)
+  float _heading[ALIGN_AVG_HISTORY];
+  float _pitch[ALIGN_AVG_HISTORY];
+  int _head;
+  int _count;
+  float _referenceHeading;
+  float _cosPitch;          // 方位角の差を天球上の角度に換算する係数
+  
+  // Running sums of the history, oldest first (for the window means)
+  float _prefixH[ALIGN_AVG_HISTORY + 1];
+  float _prefixP[ALIGN_AVG_HISTORY + 1];
+  
+  AlignmentEstimate _estimate;
+};
+
+#endif // ALIGNMENT_AVERAGER_H
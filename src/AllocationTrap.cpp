@@ -0,0 +1,139 @@
+/*
+ * AllocationTrap.cpp
+ * 
+ * Implementation of the steady-state allocation check
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "AllocationTrap.h"
+#include <esp_heap_caps.h>
+#include <rom/ets_sys.h>
+#include "Logger.h"
+
+TaskHandle_t AllocationTrap::_tasks[ALLOC_TRAP_MAX_TASKS];
+volatile uint8_t AllocationTrap::_exemptDepth[ALLOC_TRAP_MAX_TASKS];
+int AllocationTrap::_taskCount = 0;
+volatile bool AllocationTrap::_armed = false;
+volatile uint32_t AllocationTrap::_trapCount = 0;
+volatile uint32_t AllocationTrap::_lastSize = 0;
+volatile int AllocationTrap::_lastSlot = -1;
+uint32_t AllocationTrap::_reportedCount = 0;
+uint32_t AllocationTrap::_lastCheckMs = 0;
+int32_t AllocationTrap::_armedBlocks = 0;
+
+#if ALLOC_TRAP_ENABLED && defined(CONFIG_HEAP_USE_HOOKS)
+// ESP-IDFのヒープから全ての確保の後に呼ばれる（弱シンボルを上書き）
+extern "C" void IRAM_ATTR esp_heap_trace_alloc_hook(void* ptr, size_t size, uint32_t caps) {
+  (void)ptr;
+  (void)caps;
+  AllocationTrap::onAlloc(size);
+}
+
+extern "C" void IRAM_ATTR esp_heap_trace_free_hook(void* ptr) {
+  (void)ptr;
+}
+#endif
+
+// Blocks currently allocated on the default heap
+static int32_t allocatedBlocks() {
+  multi_heap_info_t info;
+  heap_caps_get_info(&info, MALLOC_CAP_DEFAULT);
+  return (int32_t)info.allocated_blocks;
+}
+
+bool AllocationTrap::guardTask(TaskHandle_t task) {
+  if (task == nullptr || _armed || _taskCount >= ALLOC_TRAP_MAX_TASKS) {
+    return false;
+  }
+  _tasks[_taskCount++] = task;
+  return true;
+}
+
+void AllocationTrap::arm() {
+#if ALLOC_TRAP_ENABLED
+  _reportedCount = _trapCount;
+  _lastCheckMs = millis();
+  _armedBlocks = allocatedBlocks();
+  _armed = true;
+#ifdef CONFIG_HEAP_USE_HOOKS
+  LOG_I(LOG_TAG_MAIN, "Allocation trap armed for %d tasks%s", _taskCount,
+        ALLOC_TRAP_ABORT ? " (abort)" : "");
+#else
+  LOG_W(LOG_TAG_MAIN, "Heap hooks unavailable, reporting heap block growth only");
+#endif
+#endif
+}
+
+int IRAM_ATTR AllocationTrap::findSlot(TaskHandle_t task) {
+  for (int i = 0; i < _taskCount; i++) {
+    if (_tasks[i] == task) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+void IRAM_ATTR AllocationTrap::onAlloc(size_t size) {
+  if (!_armed || xPortInIsrContext()) {
+    return;
+  }
+  int slot = findSlot(xTaskGetCurrentTaskHandle());
+  if (slot < 0 || _exemptDepth[slot] != 0) {
+    return;
+  }
+  
+  _lastSize = size;
+  _lastSlot = slot;
+  _trapCount++;
+
+#if ALLOC_TRAP_ABORT
+  // ここでログを出すと確保が入れ子になるため、ROMのprintfで出してから止める
+  ets_printf("Allocation trap: %u bytes on task %s\n", (unsigned)size,
+             pcTaskGetName(nullptr));
+  abort();
+#endif
+}
+
+void AllocationTrap::check() {
+  if (!_armed) {
+    return;
+  }
+  uint32_t now = millis();
+  if (now - _lastCheckMs < ALLOC_TRAP_CHECK_INTERVAL_MS) {
+    return;
+  }
+  _lastCheckMs = now;
+
+#ifdef CONFIG_HEAP_USE_HOOKS
+  uint32_t count = _trapCount;
+  if (count != _reportedCount) {
+    int slot = _lastSlot;
+    LOG_W(LOG_TAG_MAIN, "%u heap allocations after setup (last %u bytes on %s)",
+          (unsigned)(count - _reportedCount), (unsigned)_lastSize,
+          slot >= 0 ? pcTaskGetName(_tasks[slot]) : "?");
+    _reportedCount = count;
+  }
+#else
+  // 確保したまま返していないブロックが増えた場合のみ（全タスクの合計）
+  int32_t blocks = allocatedBlocks();
+  if (blocks > _armedBlocks) {
+    LOG_W(LOG_TAG_MAIN, "Heap grew by %d blocks since setup", (int)(blocks - _armedBlocks));
+    _armedBlocks = blocks;
+  }
+#endif
+}
+
+AllocationTrap::Exempt::Exempt() {
+  _slot = findSlot(xTaskGetCurrentTaskHandle());
+  if (_slot >= 0) {
+    _exemptDepth[_slot]++;
+  }
+}
+
+AllocationTrap::Exempt::~Exempt() {
+  if (_slot >= 0) {
+    _exemptDepth[_slot]--;
+  }
+}
@@ -0,0 +1,96 @@
+/*
+ * AllocationTrap.h
+ * 
+ * Debug check that the steady-state loop does not touch the heap
+ * Counts (or aborts on) heap allocations made by the UI, sensor and GPS
+ * tasks after setup() has finished
+ * 
+ * 長時間の使用で断片化によるカクつきが出ないよう、setup()の後は
+ * 監視対象のタスクからmalloc/newを呼ばないことを前提にしている。
+ * ALLOC_TRAP_ENABLED=1でビルドすると、ESP-IDFのヒープフック
+ * （CONFIG_HEAP_USE_HOOKS）で監視対象タスクの確保を捕まえ、
+ * check()がログに出す。ALLOC_TRAP_ABORT=1ではその場でabort()し、
+ * パニックのバックトレースで呼び出し元を特定できる。
+ * フックが無効なビルドでは、ヒープのブロック数の増加だけを報告する
+ * （全タスクの合計のため、確保と解放の対は検出できない）。
+ * 
+ * NVSへの書き込みなど、頻度が低く確保が避けられない処理は
+ * ALLOC_TRAP_EXEMPT()で除外する。
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef ALLOCATION_TRAP_H
+#define ALLOCATION_TRAP_H
+
+#include <Arduino.h>
+
+// Compile-time switches (build flags, e.g. -DALLOC_TRAP_ENABLED=1)
+#ifndef ALLOC_TRAP_ENABLED
+#define ALLOC_TRAP_ENABLED 0
+#endif
+
+#ifndef ALLOC_TRAP_ABORT
+#define ALLOC_TRAP_ABORT 0
+#endif
+
+#define ALLOC_TRAP_MAX_TASKS         4     // 監視できるタスクの数
+#define ALLOC_TRAP_CHECK_INTERVAL_MS 1000  // check()が報告する間隔
+
+class AllocationTrap {
+public:
+  // Add a task to the guarded set (before arm())
+  static bool guardTask(TaskHandle_t task);
+  
+  // Start trapping (end of setup())
+  static void arm();
+  static bool isArmed() { return _armed; }
+  
+  // Report new trapped allocations (UI task, every loop)
+  static void check();
+  
+  // Allocations trapped since arm()
+  static uint32_t getTrapCount() { return _trapCount; }
+  
+  // Exempt the calling task while the object is alive
+  class Exempt {
+  public:
+    Exempt();
+    ~Exempt();
+  
+  private:
+    int _slot;
+  };
+  
+  // Heap hook (called for every allocation)
+  static void onAlloc(size_t size);
+
+private:
+  static int findSlot(TaskHandle_t task);
+  
+  static TaskHandle_t _tasks[ALLOC_TRAP_MAX_TASKS];
+  static volatile uint8_t _exemptDepth[ALLOC_TRAP_MAX_TASKS];
+  static int _taskCount;
+  static volatile bool _armed;
+  
+  // Written by the hook
+  static volatile uint32_t _trapCount;
+  static volatile uint32_t _lastSize;
+  static volatile int _lastSlot;
+  
+  // Reporting state (UI task)
+  static uint32_t _reportedCount;
+  static uint32_t _lastCheckMs;
+  static int32_t _armedBlocks;
+};
+
+#if ALLOC_TRAP_ENABLED
+#define ALLOC_TRAP_CONCAT_(a, b) a##b
+#define ALLOC_TRAP_CONCAT(a, b)  ALLOC_TRAP_CONCAT_(a, b)
+#define ALLOC_TRAP_EXEMPT()      AllocationTrap::Exempt ALLOC_TRAP_CONCAT(_allocExempt, __LINE__)
+#else
+#define ALLOC_TRAP_EXEMPT()      do { } while (0)
+#endif
+
+#endif // ALLOCATION_TRAP_H
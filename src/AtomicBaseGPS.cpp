@@ -8,198 +8,732 @@
  */
 
 #include "AtomicBaseGPS.h"
+#include "Logger.h"
+
+// CASIC $PCAS01 baud rate codes
+static const unsigned long CASIC_BAUD_RATES[] = {4800, 9600, 19200, 38400, 57600, 115200};
+
+static int casicBaudCode(unsigned long baud) {
+  for (int i = 0; i < (int)(sizeof(CASIC_BAUD_RATES) / sizeof(CASIC_BAUD_RATES[0])); i++) {
+    if (CASIC_BAUD_RATES[i] == baud) {
+      return i;
+    }
+  }
+  return -1;
+}
 
 // Constructor
 AtomicBaseGPS::AtomicBaseGPS() {
   _isValid = false;
   _lastValidFix = 0;
   _serial = nullptr;
+  _baud = 0;
+  _taskHandle = nullptr;
+  _charsProcessed = 0;
+  _validSentences = 0;
+  _rejectedSentences = 0;
+  _receivingData = false;
+  
+  // Initialize sentence buffers
+  _sentence[0][0] = '\0';
+  _sentence[1][0] = '\0';
+  _fillIndex = 0;
+  _lastIndex = 1;
+  _fillLength = 0;
+  _lastLength = 0;
+  _sentenceStartUs = 0;
+  _epochStartUs = 0;
+  _epochTime = 0xFFFFFFFF;
+  _timeBase = nullptr;
   
   // Initialize cached values
   _latitude = 0.0;
   _longitude = 0.0;
   _altitude = 0.0;
   _satellites = 0;
+  _satellitesValid = false;
+  _locationValid = false;
   _hdop = 99.99;
   _speed = 0.0;
   _course = 0.0;
+  
+  _timeValid = false;
+  _dateValid = false;
+  _hour = _minute = _second = 0;
+  _year = _month = _day = 0;
 }
 
 // Initialize GPS with specified baud rate
 bool AtomicBaseGPS::begin(unsigned long baud) {
   // Use Serial2 for GPS communication on AtomS3R
+  // リングバッファはbegin()より前に設定する必要がある
+  Serial2.setRxBufferSize(GPS_RX_BUFFER_SIZE);
   Serial2.begin(baud, SERIAL_8N1, GPS_TX_PIN, GPS_RX_PIN);
   _serial = &Serial2;
+  _baud = baud;
   
-  // Wait a moment for GPS to initialize
-  delay(100);
-  
-  Serial.println("AtomicBase GPS initialized on pin " + String(GPS_TX_PIN));
+  Serial.print("AtomicBase GPS initialized on pin ");
+  Serial.println(GPS_TX_PIN);
   
   // Clear any existing data in the buffer
   while (_serial->available()) {
     _serial->read();
   }
   
+  // 再初期化の場合は既存のタスクをそのまま使う
+  if (_taskHandle != nullptr) {
+    return true;
+  }
+  
+  // Start the parse task
+  BaseType_t result = xTaskCreatePinnedToCore(
+    taskEntry,
+    "gps",
+    GPS_TASK_STACK_SIZE,
+    this,
+    GPS_TASK_PRIORITY,
+    &_taskHandle,
+    GPS_TASK_CORE
+  );
+  
+  if (result != pdPASS) {
+    // タスクが作れない場合はupdate()からポーリングする
+    _taskHandle = nullptr;
+    Serial.println("GPS parse task could not be created, falling back to polling");
+    return true;
+  }
+  
+  // 受信イベントでタスクを起床させる
+  _serial->onReceive([this]() { onReceive(); });
+  
   return true;
 }
 
-// Update GPS data (call this regularly)
-void AtomicBaseGPS::update() {
-  bool newData = false;
-  unsigned long startTime = millis();
+// Configure the receiver (baud rate, update rate, sentence filter)
+bool AtomicBaseGPS::configure(uint8_t rateHz) {
+  if (_serial == nullptr) {
+    return false;
+  }
   
-  // Read all available data from GPS with timeout
-  while (_serial->available() > 0 && (millis() - startTime < 100)) {
-    char c = _serial->read();
-    newData = _gps.encode(c) || newData;
+#if GPS_RX_PIN < 0
+  // 受信機への送信線がないため、モジュールの初期設定（1Hz）のまま使う
+  (void)rateHz;
+  Serial.println("GPS config skipped: TX line not wired (GPS_RX_PIN -1)");
+  return false;
+#else
+  if (rateHz < 1) rateHz = 1;
+  if (rateHz > 10) rateHz = 10;
+  
+  int baudCode = casicBaudCode(GPS_FAST_BAUD);
+  if (baudCode < 0) {
+    Serial.println("GPS config failed: unsupported GPS_FAST_BAUD");
+    return false;
+  }
+  
+  unsigned long defaultBaud = _baud;
+  
+  // ESP32だけがリセットされた場合、受信機は前回の設定（高速側）のまま動いている
+  if (!waitForSentences(GPS_CONFIG_VERIFY_MS)) {
+    setBaud(GPS_FAST_BAUD);
+    if (!waitForSentences(GPS_CONFIG_VERIFY_MS)) {
+      setBaud(defaultBaud);
+      Serial.println("GPS config failed: no valid sentences, keeping receiver defaults");
+      return false;
+    }
+  }
+  
+  // Output GGA (fix, satellites, HDOP, altitude) and RMC (time, date, speed, course) only
+  sendCommand("PCAS03,1,0,0,0,1,0,0,0,0,0,,,0,0");
+  
+  // Switch the baud rate first so the faster output fits on the line
+  if (_baud != GPS_FAST_BAUD) {
+    char body[16];
+    snprintf(body, sizeof(body), "PCAS01,%d", baudCode);
+    sendCommand(body);
     
-    // Collect NMEA sentence for debugging
-    if (c == '$') {
-      // Start of a new NMEA sentence
-      _lastNMEA = String(c);
-    } else if (_lastNMEA.length() > 0) {
-      // Continue collecting the NMEA sentence
-      _lastNMEA += c;
-      
-      // End of NMEA sentence
-      if (c == '\n') {
-        // Only print NMEA sentences occasionally to avoid flooding Serial
-        static unsigned long lastNmeaPrint = 0;
-        if (millis() - lastNmeaPrint > 5000) {  // Print every 5 seconds
-          Serial.print("NMEA: ");
-          Serial.print(_lastNMEA);
-          lastNmeaPrint = millis();
-        }
+    // 旧ボーレートで送信し終えてから切り替える
+    _serial->flush();
+    setBaud(GPS_FAST_BAUD);
+  }
+  
+  // Update rate (interval in milliseconds)
+  char body[16];
+  snprintf(body, sizeof(body), "PCAS02,%u", 1000 / rateHz);
+  sendCommand(body);
+  
+  // 新しいボーレートで正しい文が届くことを確認し、届かなければ元に戻す
+  if (!waitForSentences(GPS_CONFIG_VERIFY_MS)) {
+    // 受信機はPCAS01を受け付けて高速側で待っている可能性があるため、
+    // 高速側のまま元の設定に戻すコマンドを送ってから手元のUARTを戻す
+    sendCommand("PCAS02,1000");
+    int defaultCode = casicBaudCode(defaultBaud);
+    if (defaultCode >= 0) {
+      snprintf(body, sizeof(body), "PCAS01,%d", defaultCode);
+      sendCommand(body);
+    }
+    _serial->flush();
+    setBaud(defaultBaud);
+    
+    // どちらのボーレートで話しているかを確認し直す
+    if (!waitForSentences(GPS_CONFIG_VERIFY_MS)) {
+      setBaud(GPS_FAST_BAUD);
+      if (!waitForSentences(GPS_CONFIG_VERIFY_MS)) {
+        setBaud(defaultBaud);
+        Serial.println("GPS config failed: no response at either baud rate after revert");
+        return false;
       }
     }
+    Serial.print("GPS config failed: no response at new baud rate, reverted to ");
+    Serial.print(_baud);
+    Serial.println(" baud, 1 Hz");
+    return false;
+  }
+  
+  // 設定はフラッシュに保存しない（電源を入れ直すとモジュールは初期設定に戻る）
+  Serial.print("GPS configured: ");
+  Serial.print(_baud);
+  Serial.print(" baud, ");
+  Serial.print(rateHz);
+  Serial.println(" Hz, GGA/RMC");
+  return true;
+#endif
+}
+
+// Update GPS data (call this regularly)
+void AtomicBaseGPS::update() {
+  // タスクがない場合のみここで解析する
+  if (_taskHandle == nullptr && _serial != nullptr) {
+    pollSerial();
+    updateValidity();
+    
+    // NTPなどの観測はこのタスクで取り込む（時刻の基準を書くのはGPSタスクだけ）
+    if (_timeBase != nullptr) {
+      _timeBase->service();
+    }
   }
   
   // Report if new data was processed
   static unsigned long lastStatusReport = 0;
   if (millis() - lastStatusReport > 10000) {  // Every 10 seconds
-    Serial.print("GPS Status: ");
-    if (newData) {
-      Serial.println("Receiving data");
+    bool receiving;
+    bool satellitesValid;
+    bool locationValid;
+    int satellites;
+    
+    portENTER_CRITICAL(&_lock);
+    receiving = _receivingData;
+    _receivingData = false;
+    satellitesValid = _satellitesValid;
+    locationValid = _locationValid;
+    satellites = _satellites;
+    portEXIT_CRITICAL(&_lock);
+    
+    if (satellitesValid) {
+      LOG_I(LOG_TAG_GPS, "GPS Status: %s, Satellites: %d, Location valid: %s",
+            receiving ? "Receiving data" : "No new data", satellites, locationValid ? "Yes" : "No");
     } else {
-      Serial.println("No new data");
+      LOG_I(LOG_TAG_GPS, "GPS Status: %s, Satellites: Invalid, Location valid: %s",
+            receiving ? "Receiving data" : "No new data", locationValid ? "Yes" : "No");
     }
     
-    Serial.print("Satellites: ");
-    if (_gps.satellites.isValid()) {
-      Serial.println(_satellites);
-    } else {
-      Serial.println("Invalid");
+    lastStatusReport = millis();
+  }
+  
+  // Only print NMEA sentences occasionally to avoid flooding Serial
+  static uint32_t lastNmeaPrint = 0;
+  if (LOG_ACTIVE(LOG_LEVEL_DEBUG) && Logger::rateLimit(&lastNmeaPrint, 5000)) {  // Print every 5 seconds
+    char nmea[GPS_NMEA_MAX_LENGTH + 1];
+    size_t length = getLastNMEA(nmea, sizeof(nmea));
+    
+    // 末尾の改行はロガーが付けるため取り除く
+    while (length > 0 && (nmea[length - 1] == '\r' || nmea[length - 1] == '\n')) {
+      nmea[--length] = '\0';
+    }
+    if (length > 0) {
+      LOG_D(LOG_TAG_GPS, "NMEA: %s", nmea);
     }
+  }
+}
+
+// UART receive callback
+void AtomicBaseGPS::onReceive() {
+  // UARTイベントタスクから呼ばれるため、通知だけしてすぐに戻る
+  if (_taskHandle != nullptr) {
+    xTaskNotifyGive(_taskHandle);
+  }
+}
+
+// Wake the parse task
+void AtomicBaseGPS::wake() {
+  if (_taskHandle != nullptr) {
+    xTaskNotifyGive(_taskHandle);
+  }
+}
+
+// FreeRTOS entry point
+void AtomicBaseGPS::taskEntry(void* param) {
+  static_cast<AtomicBaseGPS*>(param)->run();
+}
+
+// Task body
+void AtomicBaseGPS::run() {
+  while (true) {
+    // 受信通知を待つ（受信がなくても有効期限の判定のために定期的に起床）
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(GPS_TASK_IDLE_MS));
     
-    Serial.print("Location valid: ");
-    Serial.println(_gps.location.isValid() ? "Yes" : "No");
+    pollSerial();
+    updateValidity();
     
-    lastStatusReport = millis();
+    // NTPなどの観測はこのタスクで取り込む（時刻の基準を書くのはGPSタスクだけ）
+    if (_timeBase != nullptr) {
+      _timeBase->service();
+    }
   }
+}
+
+// Drain the UART ring buffer (non-blocking)
+void AtomicBaseGPS::pollSerial() {
+  uint8_t chunk[GPS_READ_CHUNK_SIZE];
   
-  // Update cached values if valid
-  if (_gps.location.isValid()) {
-    _latitude = _gps.location.lat();
-    _longitude = _gps.location.lng();
-    _isValid = true;
-    _lastValidFix = millis();
+  int available = _serial->available();
+  while (available > 0) {
+    size_t toRead = available < GPS_READ_CHUNK_SIZE ? available : GPS_READ_CHUNK_SIZE;
+    size_t length = _serial->read(chunk, toRead);
+    if (length == 0) {
+      break;
+    }
+    
+    // バイトは連続して届くため、まだバッファに残っている分だけ遡れば
+    // チャンク最後のバイトの受信時刻になる
+    int64_t now = esp_timer_get_time();
+    available = _serial->available();
+    int64_t lastByteUs = now - (int64_t)available * (10000000LL / _baud);
+    
+    portENTER_CRITICAL(&_lock);
+    _charsProcessed += length;
+    _receivingData = true;
+    portEXIT_CRITICAL(&_lock);
+    
+    ingest(chunk, length, lastByteUs);
   }
+}
+
+// Split received bytes into NMEA sentences
+void AtomicBaseGPS::ingest(const uint8_t* data, size_t length, int64_t lastByteUs) {
+  char* sentence = _sentence[_fillIndex];
+  int64_t byteUs = 10000000LL / _baud;  // 1バイト（10ビット）の転送時間
   
-  if (_gps.altitude.isValid()) {
-    _altitude = _gps.altitude.meters();
+  for (size_t i = 0; i < length; i++) {
+    char c = (char)data[i];
+    
+    if (c == '$') {
+      // Start of a new NMEA sentence (途中の文は破棄)
+      sentence[0] = c;
+      _fillLength = 1;
+      _sentenceStartUs = lastByteUs - (int64_t)(length - 1 - i) * byteUs;
+      continue;
+    }
+    
+    // 文の外のデータは無視
+    if (_fillLength == 0) {
+      continue;
+    }
+    
+    // 長すぎる文はノイズとして破棄
+    if (_fillLength >= GPS_NMEA_MAX_LENGTH) {
+      _fillLength = 0;
+      portENTER_CRITICAL(&_lock);
+      _rejectedSentences++;
+      portEXIT_CRITICAL(&_lock);
+      continue;
+    }
+    
+    sentence[_fillLength++] = c;
+    
+    // End of NMEA sentence
+    if (c == '\n') {
+      sentence[_fillLength] = '\0';
+      handleSentence(sentence, _fillLength);
+      
+      // handleSentence()でバッファが入れ替わる
+      sentence = _sentence[_fillIndex];
+      _fillLength = 0;
+    }
+  }
+}
+
+// Feed one complete sentence to TinyGPS++ and publish the results
+void AtomicBaseGPS::handleSentence(const char* sentence, size_t length) {
+  // チェックサムが合わない文はTinyGPS++に渡さない
+  if (!verifyChecksum(sentence, length)) {
+    portENTER_CRITICAL(&_lock);
+    _rejectedSentences++;
+    portEXIT_CRITICAL(&_lock);
+    return;
   }
   
-  if (_gps.satellites.isValid()) {
-    _satellites = _gps.satellites.value();
+  bool newData = false;
+  for (size_t i = 0; i < length; i++) {
+    newData = _gps.encode(sentence[i]) || newData;
   }
   
-  if (_gps.hdop.isValid()) {
-    _hdop = _gps.hdop.hdop();
+  // 時刻・日付を含む文か（値を読むと更新フラグが消えるため先に判定する）
+  bool timeUpdated = newData && _gps.time.isUpdated() && _gps.time.isValid();
+  bool dateUpdated = newData && _gps.date.isUpdated() && _gps.date.isValid();
+  
+  // エポックの受信時刻は最初に時刻を含んだ文（GGA）の'$'で取る
+  if (timeUpdated && _gps.time.value() != _epochTime) {
+    _epochTime = _gps.time.value();
+    _epochStartUs = _sentenceStartUs;
   }
   
-  if (_gps.speed.isValid()) {
-    _speed = _gps.speed.kmph();
+  portENTER_CRITICAL(&_lock);
+  
+  // 完成した文を公開し、次の文は反対側のバッファに組み立てる
+  _lastIndex = _fillIndex;
+  _lastLength = length;
+  _fillIndex ^= 1;
+  _validSentences++;
+  
+  if (newData) {
+    // Update cached values if valid
+    _locationValid = _gps.location.isValid();
+    if (_locationValid) {
+      _latitude = _gps.location.lat();
+      _longitude = _gps.location.lng();
+    }
+    
+    if (_gps.altitude.isValid()) {
+      _altitude = _gps.altitude.meters();
+    }
+    
+    _satellitesValid = _gps.satellites.isValid();
+    if (_satellitesValid) {
+      _satellites = _gps.satellites.value();
+    }
+    
+    if (_gps.hdop.isValid()) {
+      _hdop = _gps.hdop.hdop();
+    }
+    
+    if (_gps.speed.isValid()) {
+      _speed = _gps.speed.kmph();
+    }
+    
+    if (_gps.course.isValid()) {
+      _course = _gps.course.deg();
+    }
+    
+    _timeValid = _gps.time.isValid();
+    if (_timeValid) {
+      _hour = _gps.time.hour();
+      _minute = _gps.time.minute();
+      _second = _gps.time.second();
+    }
+    
+    _dateValid = _gps.date.isValid();
+    if (_dateValid) {
+      _year = _gps.date.year();
+      _month = _gps.date.month();
+      _day = _gps.date.day();
+    }
+    
+    // Check if we have a valid fix
+    if (_locationValid && _satellitesValid) {
+      _isValid = true;
+      _lastValidFix = millis();
+    }
   }
   
-  if (_gps.course.isValid()) {
-    _course = _gps.course.deg();
+  portEXIT_CRITICAL(&_lock);
+  
+  // 日付と時刻が同じ文で届いたとき（RMC）だけ合わせる
+  // GGAには日付がなく、前回のRMCの日付と組み合わせると0時ちょうどに1日ずれる
+  if (timeUpdated && dateUpdated && _timeBase) {
+    _timeBase->discipline(_gps.date.year(), _gps.date.month(), _gps.date.day(),
+                          _gps.time.hour(), _gps.time.minute(), _gps.time.second(),
+                          _gps.time.centisecond(), _epochStartUs);
   }
+}
+
+// Expire the fix when no valid data arrives
+void AtomicBaseGPS::updateValidity() {
+  unsigned long now = millis();
   
-  // Check if we have a valid fix
-  if (_gps.location.isValid() && _gps.satellites.isValid()) {
-    _isValid = true;
-    _lastValidFix = millis();
-  } else if (millis() - _lastValidFix > 10000) {
+  portENTER_CRITICAL(&_lock);
+  if (_isValid && now - _lastValidFix > 10000) {
     // If no valid fix for 10 seconds, mark as invalid
     _isValid = false;
   }
+  portEXIT_CRITICAL(&_lock);
+}
+
+// NMEA checksum (XOR of the characters between '$' and '*')
+uint8_t AtomicBaseGPS::nmeaChecksum(const char* sentence, size_t length) {
+  uint8_t checksum = 0;
+  size_t i = (length > 0 && sentence[0] == '$') ? 1 : 0;
+  for (; i < length && sentence[i] != '*'; i++) {
+    checksum ^= (uint8_t)sentence[i];
+  }
+  return checksum;
+}
+
+// Check the "*hh" checksum of a complete sentence
+bool AtomicBaseGPS::verifyChecksum(const char* sentence, size_t length) {
+  const char* star = (const char*)memchr(sentence, '*', length);
+  if (star == nullptr || (size_t)(star - sentence) + 3 > length) {
+    return false;
+  }
+  
+  uint8_t expected = 0;
+  for (int i = 1; i <= 2; i++) {
+    char c = star[i];
+    expected <<= 4;
+    if (c >= '0' && c <= '9') {
+      expected |= c - '0';
+    } else if (c >= 'A' && c <= 'F') {
+      expected |= c - 'A' + 10;
+    } else if (c >= 'a' && c <= 'f') {
+      expected |= c - 'a' + 10;
+    } else {
+      return false;
+    }
+  }
+  
+  return nmeaChecksum(sentence, star - sentence) == expected;
+}
+
+// Send "$<body>*hh\r\n" to the receiver
+void AtomicBaseGPS::sendCommand(const char* body) {
+  char sentence[GPS_NMEA_MAX_LENGTH + 1];
+  int length = snprintf(sentence, sizeof(sentence), "$%s*", body);
+  if (length <= 0 || length + 4 >= (int)sizeof(sentence)) {
+    return;
+  }
+  
+  snprintf(sentence + length, sizeof(sentence) - length, "%02X\r\n",
+           nmeaChecksum(sentence, length));
+  _serial->write((const uint8_t*)sentence, strlen(sentence));
+}
+
+// CASIC AID-INI payload (little-endian, 56 bytes)
+struct CasicAidIni {
+  double latitude;     // 度
+  double longitude;
+  double altitude;     // m
+  double tow;          // GPS週内秒
+  float freqBias;      // 受信機クロックの周波数ずれ（未使用）
+  float positionAcc;   // 位置の精度（m）
+  float timeAcc;       // 時刻の精度（秒）
+  float freqAcc;
+  uint32_t reserved;
+  uint16_t week;       // GPS週番号
+  uint8_t timeSource;
+  uint8_t flags;       // GPS_AID_FLAG_*
+};
+static_assert(sizeof(CasicAidIni) == 56, "CasicAidIni layout changed");
+
+bool AtomicBaseGPS::sendAidIni(double latitude, double longitude, double altitude,
+                               float positionAccM, int64_t utcUs, float timeAccS) {
+  if (_serial == nullptr || !canSend()) {
+    return false;
+  }
+  
+  CasicAidIni aid;
+  memset(&aid, 0, sizeof(aid));
+  aid.latitude = latitude;
+  aid.longitude = longitude;
+  aid.altitude = altitude;
+  aid.positionAcc = positionAccM;
+  if (positionAccM > 0.0f) {
+    aid.flags = GPS_AID_FLAG_POSITION | GPS_AID_FLAG_LLA;
+  }
+  if (utcUs > 0) {
+    // GPS時刻は1980-01-06から数え、うるう秒を含まない
+    int64_t gpsUs = utcUs - 315964800LL * 1000000LL + GPS_UTC_LEAP_SECONDS * 1000000LL;
+    int64_t weekUs = 604800LL * 1000000LL;
+    aid.week = (uint16_t)(gpsUs / weekUs);
+    aid.tow = (double)(gpsUs % weekUs) * 1e-6;
+    aid.timeAcc = timeAccS;
+    aid.flags |= GPS_AID_FLAG_TIME;
+  }
+  
+  sendCasic(GPS_CASIC_CLASS_AID, GPS_CASIC_ID_AID_INI, (const uint8_t*)&aid, sizeof(aid));
+  return true;
+}
+
+size_t AtomicBaseGPS::sendRaw(const uint8_t* data, size_t length) {
+  if (_serial == nullptr || !canSend()) {
+    return 0;
+  }
+  return _serial->write(data, length);
+}
+
+// Frame: BA CE, length, class, id, payload, checksum (sum of 32-bit words)
+void AtomicBaseGPS::sendCasic(uint8_t cls, uint8_t id, const uint8_t* payload, uint16_t length) {
+  uint8_t header[6] = {GPS_CASIC_SYNC1, GPS_CASIC_SYNC2, (uint8_t)(length & 0xFF),
+                       (uint8_t)(length >> 8), cls, id};
+  uint32_t checksum = ((uint32_t)id << 24) + ((uint32_t)cls << 16) + length;
+  for (uint16_t i = 0; i + 3 < length; i += 4) {
+    uint32_t word;
+    memcpy(&word, payload + i, sizeof(word));
+    checksum += word;
+  }
+  
+  _serial->write(header, sizeof(header));
+  _serial->write(payload, length);
+  _serial->write((const uint8_t*)&checksum, sizeof(checksum));
+}
+
+// Wait until enough valid sentences arrive at the current baud rate
+bool AtomicBaseGPS::waitForSentences(unsigned long timeoutMs) {
+  uint32_t start = getValidSentences();
+  unsigned long startTime = millis();
+  
+  while (millis() - startTime < timeoutMs) {
+    // タスクがない場合はここで読み出す
+    if (_taskHandle == nullptr) {
+      pollSerial();
+    }
+    
+    if (getValidSentences() - start >= GPS_CONFIG_MIN_SENTENCES) {
+      return true;
+    }
+    delay(20);
+  }
+  
+  return false;
+}
+
+// Switch the UART baud rate (parse task keeps running)
+void AtomicBaseGPS::setBaud(unsigned long baud) {
+  // 切り替え直後の文字化けした文はチェックサムで破棄される
+  _serial->updateBaudRate(baud);
+  _baud = baud;
 }
 
 // Check if GPS data is valid
 bool AtomicBaseGPS::isValid() const {
-  return _isValid;
+  portENTER_CRITICAL(&_lock);
+  bool valid = _isValid;
+  portEXIT_CRITICAL(&_lock);
+  return valid;
 }
 
 // Get location data
 float AtomicBaseGPS::getLatitude() const {
-  return _latitude;
+  portENTER_CRITICAL(&_lock);
+  float value = _latitude;
+  portEXIT_CRITICAL(&_lock);
+  return value;
 }
 
 float AtomicBaseGPS::getLongitude() const {
-  return _longitude;
+  portENTER_CRITICAL(&_lock);
+  float value = _longitude;
+  portEXIT_CRITICAL(&_lock);
+  return value;
 }
 
 float AtomicBaseGPS::getAltitude() const {
-  return _altitude;
+  portENTER_CRITICAL(&_lock);
+  float value = _altitude;
+  portEXIT_CRITICAL(&_lock);
+  return value;
 }
 
 // Get quality indicators
 int AtomicBaseGPS::getSatellites() const {
-  return _satellites;
+  portENTER_CRITICAL(&_lock);
+  int value = _satellites;
+  portEXIT_CRITICAL(&_lock);
+  return value;
 }
 
 float AtomicBaseGPS::getHDOP() const {
-  return _hdop;
+  portENTER_CRITICAL(&_lock);
+  float value = _hdop;
+  portEXIT_CRITICAL(&_lock);
+  return value;
 }
 
 // Get time data
 bool AtomicBaseGPS::getTime(int *hour, int *minute, int *second) {
-  if (!_gps.time.isValid()) {
-    return false;
+  portENTER_CRITICAL(&_lock);
+  bool valid = _timeValid;
+  if (valid) {
+    *hour = _hour;
+    *minute = _minute;
+    *second = _second;
   }
+  portEXIT_CRITICAL(&_lock);
   
-  *hour = _gps.time.hour();
-  *minute = _gps.time.minute();
-  *second = _gps.time.second();
-  
-  return true;
+  return valid;
 }
 
 bool AtomicBaseGPS::getDate(int *year, int *month, int *day) {
-  if (!_gps.date.isValid()) {
-    return false;
+  portENTER_CRITICAL(&_lock);
+  bool valid = _dateValid;
+  if (valid) {
+    *year = _year;
+    *month = _month;
+    *day = _day;
   }
+  portEXIT_CRITICAL(&_lock);
   
-  *year = _gps.date.year();
-  *month = _gps.date.month();
-  *day = _gps.date.day();
-  
-  return true;
+  return valid;
 }
 
 // Get speed and course
 float AtomicBaseGPS::getSpeed() const {
-  return _speed;
+  portENTER_CRITICAL(&_lock);
+  float value = _speed;
+  portEXIT_CRITICAL(&_lock);
+  return value;
 }
 
 float AtomicBaseGPS::getCourse() const {
-  return _course;
+  portENTER_CRITICAL(&_lock);
+  float value = _course;
+  portEXIT_CRITICAL(&_lock);
+  return value;
 }
 
 // Get raw NMEA sentence (for debugging)
-String AtomicBaseGPS::getLastNMEA() const {
-  return _lastNMEA;
+size_t AtomicBaseGPS::getLastNMEA(char* buffer, size_t size) const {
+  if (buffer == nullptr || size == 0) {
+    return 0;
+  }
+  
+  portENTER_CRITICAL(&_lock);
+  size_t length = _lastLength < size - 1 ? _lastLength : size - 1;
+  memcpy(buffer, _sentence[_lastIndex], length);
+  portEXIT_CRITICAL(&_lock);
+  
+  buffer[length] = '\0';
+  return length;
+}
+
+// Number of bytes received from the module
+uint32_t AtomicBaseGPS::getCharsProcessed() const {
+  portENTER_CRITICAL(&_lock);
+  uint32_t value = _charsProcessed;
+  portEXIT_CRITICAL(&_lock);
+  return value;
+}
+
+uint32_t AtomicBaseGPS::getValidSentences() const {
+  portENTER_CRITICAL(&_lock);
+  uint32_t value = _validSentences;
+  portEXIT_CRITICAL(&_lock);
+  return value;
+}
+
+uint32_t AtomicBaseGPS::getRejectedSentences() const {
+  portENTER_CRITICAL(&_lock);
+  uint32_t value = _rejectedSentences;
+  portEXIT_CRITICAL(&_lock);
+  return value;
 }
 
 // Get raw TinyGPS++ object for advanced usage
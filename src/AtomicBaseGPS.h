@@ -4,6 +4,9 @@
  * Interface for the AtomicBase GPS module
  * Handles GPS data parsing and provides location and time information
  * 
+ * UARTの受信イベントで起床する専用タスクがNMEAを解析する。
+ * update()はブロックせず、キャッシュされた値を参照するだけ。
+ * 
  * Created: 2025-03-23
  * GitHub: https://github.com/kennel-org/polaris-navigator
  */
@@ -13,10 +16,41 @@
 
 #include <Arduino.h>
 #include <TinyGPS++.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include "TimeBase.h"
 
 // Default pins for AtomicBase GPS
 #define GPS_TX_PIN 5    // GPS TX pin (connects to RX of AtomS3R)
 #define GPS_RX_PIN -1   // GPS RX pin (not used for one-way communication)
+                        // 配線した場合は受信機の設定（ボーレート・更新レート）が有効になる
+
+// Receiver configuration (CASIC $PCAS commands, requires GPS_RX_PIN)
+#define GPS_FAST_BAUD          115200 // 設定後のボーレート
+#define GPS_UPDATE_RATE_HZ     5      // 測位更新レート（Hz、最大10）
+#define GPS_CONFIG_VERIFY_MS   1500   // 正しい文が届くまでの待ち時間
+#define GPS_CONFIG_MIN_SENTENCES 3    // 設定を確認するのに必要な文の数
+
+// Assisted start (CASIC binary protocol, requires GPS_RX_PIN)
+#define GPS_CASIC_SYNC1        0xBA
+#define GPS_CASIC_SYNC2        0xCE
+#define GPS_CASIC_CLASS_AID    0x0B
+#define GPS_CASIC_ID_AID_INI   0x01  // 概略の位置・時刻
+#define GPS_AID_FLAG_POSITION  0x01  // 位置が有効
+#define GPS_AID_FLAG_TIME      0x02  // 時刻が有効
+#define GPS_AID_FLAG_LLA       0x20  // 位置は緯度・経度・高度（0 = ECEF）
+#define GPS_UTC_LEAP_SECONDS   18    // GPS時刻 - UTC（2017年以降）
+
+// Parse task configuration
+#define GPS_TASK_CORE          0     // センサータスクと同じコア（UIはコア1）
+#define GPS_TASK_PRIORITY      3     // センサータスク(5)より低い優先度
+#define GPS_TASK_STACK_SIZE    4096  // スタックサイズ（バイト）
+#define GPS_TASK_IDLE_MS       200   // 受信がない場合の起床間隔（有効期限の判定用）
+
+// Buffers
+#define GPS_RX_BUFFER_SIZE     1024  // UARTドライバのリングバッファ
+#define GPS_READ_CHUNK_SIZE    128   // 1回の一括読み出しサイズ
+#define GPS_NMEA_MAX_LENGTH    96    // NMEA文の最大長（規格は82文字）
 
 class AtomicBaseGPS {
 public:
@@ -26,7 +60,28 @@ public:
   // Initialize GPS with specified baud rate
   bool begin(unsigned long baud = 9600);
   
+  // Configure the receiver for GPS_FAST_BAUD, the given update rate and
+  // GGA/RMC output only. Requires the TX line (GPS_RX_PIN) to be wired;
+  // returns false and leaves the module at its defaults otherwise.
+  bool configure(uint8_t rateHz = GPS_UPDATE_RATE_HZ);
+  
+  // Whether commands can be sent to the receiver (TX line wired)
+  static bool canSend() { return GPS_RX_PIN >= 0; }
+  
+  // Seed the receiver with an approximate position and UTC (CASIC AID-INI)
+  // so it can predict the visible satellites; any task, returns false when
+  // the TX line is not wired (positionAccM <= 0 sends the time only)
+  bool sendAidIni(double latitude, double longitude, double altitude, float positionAccM,
+                  int64_t utcUs, float timeAccS);
+  
+  // Forward assist data (a stream of CASIC messages, e.g. ephemerides) as is
+  size_t sendRaw(const uint8_t* data, size_t length);
+  
+  // Current UART baud rate
+  unsigned long getBaud() const { return _baud; }
+  
   // Update GPS data (call this regularly)
+  // 解析はタスク側で行うため、ここでは定期的な状態出力のみ（ブロックしない）
   void update();
   
   // Check if GPS data is valid
@@ -41,6 +96,10 @@ public:
   int getSatellites() const;
   float getHDOP() const;  // Horizontal Dilution of Precision
   
+  // Discipline a time base from the received time (called from the parse task)
+  // 各エポック最初の文の'$'の受信時刻を基準にする
+  void setTimeBase(TimeBase* timeBase) { _timeBase = timeBase; }
+  
   // Get time data
   bool getTime(int *hour, int *minute, int *second);
   bool getDate(int *year, int *month, int *day);
@@ -50,26 +109,109 @@ public:
   float getCourse() const; // Course in degrees
   
   // Get raw NMEA sentence (for debugging)
-  String getLastNMEA() const;
+  // Copies the last complete sentence into buffer; returns its length
+  size_t getLastNMEA(char* buffer, size_t size) const;
+  
+  // Number of bytes received from the module
+  uint32_t getCharsProcessed() const;
+  
+  // Number of sentences with a valid checksum
+  uint32_t getValidSentences() const;
+  
+  // Number of sentences dropped because of a bad checksum or length
+  uint32_t getRejectedSentences() const;
+  
+  // NMEA checksum (XOR of the characters between '$' and '*')
+  static uint8_t nmeaChecksum(const char* sentence, size_t length);
   
   // Get raw TinyGPS++ object for advanced usage
+  // 注: 解析タスクと同時にアクセスしないこと
   TinyGPSPlus* getRawGPS();
   
+  // Wake the parse task early (e.g. after TimeBase::submit(), so that
+  // service() applies the sample without waiting for the next sentence)
+  void wake();
+
 private:
-  TinyGPSPlus _gps;        // GPS parser
+  // UART receive callback (runs in the UART event task)
+  void onReceive();
+  
+  // FreeRTOS entry point
+  static void taskEntry(void* param);
+  
+  // Task body
+  void run();
+  
+  // Drain the UART ring buffer (non-blocking)
+  void pollSerial();
+  
+  // Split received bytes into NMEA sentences
+  // lastByteUs: esp_timer time at which the last byte of data arrived
+  void ingest(const uint8_t* data, size_t length, int64_t lastByteUs);
+  
+  // Feed one complete sentence to TinyGPS++ and publish the results
+  void handleSentence(const char* sentence, size_t length);
+  
+  // Expire the fix when no valid data arrives
+  void updateValidity();
+  
+  // Check the "*hh" checksum of a complete sentence
+  static bool verifyChecksum(const char* sentence, size_t length);
+  
+  // Send "$<body>*hh\r\n" to the receiver
+  void sendCommand(const char* body);
+  
+  // Send one CASIC binary message (payload length must be a multiple of 4)
+  void sendCasic(uint8_t cls, uint8_t id, const uint8_t* payload, uint16_t length);
+  
+  // Wait until enough valid sentences arrive at the current baud rate
+  bool waitForSentences(unsigned long timeoutMs);
+  
+  // Switch the UART baud rate (parse task keeps running)
+  void setBaud(unsigned long baud);
+  
+  TinyGPSPlus _gps;        // GPS parser (parse task only)
   HardwareSerial *_serial; // Serial port for GPS
+  unsigned long _baud;     // Current UART baud rate
+  TaskHandle_t _taskHandle;
+  
+  // NMEA sentence assembly (double buffered: one is filled while the other is published)
+  char _sentence[2][GPS_NMEA_MAX_LENGTH + 1];
+  uint8_t _fillIndex;      // 組み立て中のバッファ
+  uint8_t _lastIndex;      // 最後に完成したバッファ
+  size_t _fillLength;      // 組み立て中の文字数（0 = 文の外）
+  size_t _lastLength;      // 最後に完成した文の長さ
+  int64_t _sentenceStartUs; // 組み立て中の文の'$'を受信したesp_timer時刻
+  int64_t _epochStartUs;   // 現在のエポックで最初に時刻を含んだ文の'$'の時刻
+  uint32_t _epochTime;     // そのエポックの時刻（TinyGPSTime::value()、hhmmsscc）
+  TimeBase* _timeBase;     // 時刻を合わせる対象（nullptrなら無効）
+  
+  // Protects the cached values below (shared with the UI task)
+  mutable portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+  
   bool _isValid;           // Flag for valid GPS data
   unsigned long _lastValidFix; // Timestamp of last valid fix
-  String _lastNMEA;        // Last NMEA sentence received
+  uint32_t _charsProcessed;
+  uint32_t _validSentences;
+  uint32_t _rejectedSentences;
+  bool _receivingData;     // 前回の状態出力以降にデータを受信したか
   
   // Cached data for faster access
   float _latitude;
   float _longitude;
   float _altitude;
   int _satellites;
+  bool _satellitesValid;
+  bool _locationValid;
   float _hdop;
   float _speed;
   float _course;
+  
+  // Cached time/date (TinyGPS++ is not touched outside the parse task)
+  bool _timeValid;
+  bool _dateValid;
+  int _hour, _minute, _second;
+  int _year, _month, _day;
 };
 
 #endif // ATOMIC_BASE_GPS_H
@@ -5,6 +5,7 @@
  */
 
 #include "BMI270.h"
+#include <M5Unified.h>
 #include <math.h>
 
 BMI270::BMI270() {
@@ -29,6 +30,13 @@ BMI270::BMI270() {
   // These may need adjustment based on the actual sensor configuration
   acc_scale = 2.0 / 32768.0;  // ±2g range
   gyr_scale = 250.0 / 32768.0;  // ±250 deg/s range
+  
+  _fifoEnabled = false;
+  _busBytes = 0;
+  _fifoPeriodUs = 10000.0f;
+  _lastSensorTime = 0;
+  _framesSinceTime = 0;
+  _lastTimestampUs = 0;
 }
 
 int BMI270::begin() {
@@ -48,19 +56,10 @@ int BMI270::begin() {
 }
 
 void BMI270::readAcceleration() {
-  // Read raw accelerometer data
-  uint8_t data[6];
-  
   // Read 6 bytes starting from ACC_X_LSB
-  Wire.beginTransmission(BMI270_I2C_ADDR);
-  Wire.write(BMI270_ACC_X_LSB);
-  Wire.endTransmission(false);
-  
-  Wire.requestFrom(BMI270_I2C_ADDR, 6);
-  if (Wire.available() == 6) {
-    for (int i = 0; i < 6; i++) {
-      data[i] = Wire.read();
-    }
+  uint8_t data[6] = {0};
+  if (!readRegisters(BMI270_ACC_X_LSB, data, sizeof(data))) {
+    return;
   }
   
   // Combine MSB and LSB bytes
@@ -75,19 +74,10 @@ void BMI270::readAcceleration() {
 }
 
 void BMI270::readGyro() {
-  // Read raw gyroscope data
-  uint8_t data[6];
-  
   // Read 6 bytes starting from GYR_X_LSB
-  Wire.beginTransmission(BMI270_I2C_ADDR);
-  Wire.write(BMI270_GYR_X_LSB);
-  Wire.endTransmission(false);
-  
-  Wire.requestFrom(BMI270_I2C_ADDR, 6);
-  if (Wire.available() == 6) {
-    for (int i = 0; i < 6; i++) {
-      data[i] = Wire.read();
-    }
+  uint8_t data[6] = {0};
+  if (!readRegisters(BMI270_GYR_X_LSB, data, sizeof(data))) {
+    return;
   }
   
   // Combine MSB and LSB bytes
@@ -101,6 +91,224 @@ void BMI270::readGyro() {
   gyr_z = raw_gyr_z * gyr_scale;
 }
 
+void BMI270::readAccelGyro() {
+  // ACC_X_LSB..GYR_Z_MSB are contiguous, so one transaction covers both
+  uint8_t data[12] = {0};
+  if (!readRegisters(BMI270_ACC_X_LSB, data, sizeof(data))) {
+    return;
+  }
+  
+  raw_acc_x = (int16_t)((data[1] << 8) | data[0]);
+  raw_acc_y = (int16_t)((data[3] << 8) | data[2]);
+  raw_acc_z = (int16_t)((data[5] << 8) | data[4]);
+  raw_gyr_x = (int16_t)((data[7] << 8) | data[6]);
+  raw_gyr_y = (int16_t)((data[9] << 8) | data[8]);
+  raw_gyr_z = (int16_t)((data[11] << 8) | data[10]);
+  
+  acc_x = raw_acc_x * acc_scale;
+  acc_y = raw_acc_y * acc_scale;
+  acc_z = raw_acc_z * acc_scale;
+  gyr_x = raw_gyr_x * gyr_scale;
+  gyr_y = raw_gyr_y * gyr_scale;
+  gyr_z = raw_gyr_z * gyr_scale;
+}
+
+int BMI270::beginFifo(uint16_t odrHz) {
+  // Check if BMI270 is connected (no soft reset: that would drop the config file)
+  if (readRegister(BMI270_CHIP_ID) != 0x24) {
+    return BMI270_ERROR;
+  }
+  
+  // ODR code: 0x08 = 100Hz, each step doubles (0x09 = 200Hz, 0x0A = 400Hz)
+  uint8_t odrCode = 0x08;
+  while (odrCode < 0x0C && (100u << (odrCode - 0x08)) < odrHz) {
+    odrCode++;
+  }
+  
+  // Keep bandwidth/filter bits, replace only the ODR field (bits 3:0)
+  uint8_t accConf = readRegister(BMI270_ACC_CONF);
+  uint8_t gyrConf = readRegister(BMI270_GYR_CONF);
+  writeRegister(BMI270_ACC_CONF, (accConf & 0xF0) | odrCode);
+  writeRegister(BMI270_GYR_CONF, (gyrConf & 0xF0) | odrCode);
+  
+  // Scale factors must match whatever range the chip was configured with
+  updateScales();
+  
+  // Header mode, accel+gyro, sensortime frame appended when drained
+  writeRegister(BMI270_FIFO_CONFIG_0, BMI270_FIFO_TIME_EN);
+  writeRegister(BMI270_FIFO_CONFIG_1, BMI270_FIFO_GYR_EN | BMI270_FIFO_ACC_EN | BMI270_FIFO_HEADER_EN);
+  writeRegister(BMI270_CMD, BMI270_CMD_FIFO_FLUSH);
+  
+  // Verify the configuration took effect
+  uint8_t cfg1 = readRegister(BMI270_FIFO_CONFIG_1);
+  if ((cfg1 & 0xF0) != (BMI270_FIFO_GYR_EN | BMI270_FIFO_ACC_EN | BMI270_FIFO_HEADER_EN)) {
+    return BMI270_ERROR;
+  }
+  
+  _fifoPeriodUs = 1000000.0f / (100u << (odrCode - 0x08));
+  _lastSensorTime = 0;
+  _framesSinceTime = 0;
+  _lastTimestampUs = 0;
+  _fifoEnabled = true;
+  return BMI270_OK;
+}
+
+void BMI270::endFifo() {
+  writeRegister(BMI270_FIFO_CONFIG_1, 0x00);
+  writeRegister(BMI270_CMD, BMI270_CMD_FIFO_FLUSH);
+  _fifoEnabled = false;
+}
+
+int BMI270::readFifo(BMI270Sample* samples, size_t maxSamples, uint64_t readTimeUs) {
+  if (!_fifoEnabled) {
+    return -1;
+  }
+  
+  // FIFO fill level (14 bits)
+  uint8_t lengthData[2];
+  if (!readRegisters(BMI270_FIFO_LENGTH_0, lengthData, sizeof(lengthData))) {
+    return -1;
+  }
+  size_t length = ((lengthData[1] & 0x3F) << 8) | lengthData[0];
+  if (length == 0) {
+    return 0;
+  }
+  
+  // Sensortime frame (4 bytes) is appended after the last frame
+  length += 4;
+  bool truncated = length > BMI270_FIFO_BUFFER_SIZE;
+  if (truncated) {
+    length = BMI270_FIFO_BUFFER_SIZE;  // 残りは次回読み出す
+  }
+  
+  // Read everything in one burst: the chip re-sends a frame cut at the end
+  // of a read, so splitting the read would duplicate the frame fragment
+  if (!readRegisters(BMI270_FIFO_DATA, _fifoBuffer, length)) {
+    return -1;
+  }
+  
+  // Decode frames
+  size_t count = 0;
+  size_t frames = 0;
+  bool haveSensorTime = false;
+  uint32_t sensorTime = 0;
+  size_t i = 0;
+  
+  while (i < length) {
+    uint8_t header = _fifoBuffer[i];
+    
+    if ((header & BMI270_FH_MODE_MASK) == BMI270_FH_REGULAR) {
+      if ((header & 0x1C) == 0) {
+        break;  // 0x80: FIFO empty
+      }
+      
+      size_t frameSize = 1;
+      if (header & BMI270_FH_AUX) frameSize += 8;
+      if (header & BMI270_FH_GYR) frameSize += 6;
+      if (header & BMI270_FH_ACC) frameSize += 6;
+      if (i + frameSize > length) {
+        break;  // 途中で切れたフレームは次回再送される
+      }
+      
+      // Frame order: aux, gyr, acc
+      const uint8_t* p = &_fifoBuffer[i + 1];
+      if (header & BMI270_FH_AUX) {
+        p += 8;
+      }
+      if (header & BMI270_FH_GYR) {
+        raw_gyr_x = (int16_t)((p[1] << 8) | p[0]);
+        raw_gyr_y = (int16_t)((p[3] << 8) | p[2]);
+        raw_gyr_z = (int16_t)((p[5] << 8) | p[4]);
+        p += 6;
+      }
+      if (header & BMI270_FH_ACC) {
+        raw_acc_x = (int16_t)((p[1] << 8) | p[0]);
+        raw_acc_y = (int16_t)((p[3] << 8) | p[2]);
+        raw_acc_z = (int16_t)((p[5] << 8) | p[4]);
+      }
+      
+      // Frames carrying only one sensor reuse the other sensor's last value
+      if (count < maxSamples) {
+        BMI270Sample& s = samples[count++];
+        s.acc[0] = raw_acc_x * acc_scale;
+        s.acc[1] = raw_acc_y * acc_scale;
+        s.acc[2] = raw_acc_z * acc_scale;
+        s.gyr[0] = raw_gyr_x * gyr_scale;
+        s.gyr[1] = raw_gyr_y * gyr_scale;
+        s.gyr[2] = raw_gyr_z * gyr_scale;
+      }
+      frames++;
+      i += frameSize;
+    } else if ((header & BMI270_FH_MODE_MASK) == BMI270_FH_CONTROL) {
+      uint8_t type = header & 0xFC;
+      if (type == BMI270_FH_SENSORTIME) {
+        if (i + 4 > length) {
+          break;
+        }
+        sensorTime = _fifoBuffer[i + 1] | (_fifoBuffer[i + 2] << 8) | ((uint32_t)_fifoBuffer[i + 3] << 16);
+        haveSensorTime = true;
+        i += 4;
+      } else if (type == BMI270_FH_SKIP) {
+        i += 2;  // オーバーフローで失われたフレーム数（読み捨て）
+      } else if (type == BMI270_FH_INPUT_CFG) {
+        i += 5;
+      } else {
+        break;   // 不明なフレーム
+      }
+    } else {
+      break;     // 同期が外れた場合は残りを破棄
+    }
+  }
+  
+  // Measure the real frame period from the sensor clock (24-bit counter)
+  _framesSinceTime += frames;
+  if (haveSensorTime) {
+    if (_lastSensorTime != 0 && _framesSinceTime > 0) {
+      uint32_t ticks = (sensorTime - _lastSensorTime) & 0xFFFFFF;
+      float period = ticks * BMI270_SENSORTIME_US / _framesSinceTime;
+      
+      // Ignore implausible values (e.g. after an overflow)
+      if (period > _fifoPeriodUs * 0.5f && period < _fifoPeriodUs * 1.5f) {
+        _fifoPeriodUs = 0.9f * _fifoPeriodUs + 0.1f * period;
+      }
+    }
+    _lastSensorTime = sensorTime;
+    _framesSinceTime = 0;
+  }
+  
+  if (truncated && _lastTimestampUs != 0) {
+    // 新しいフレームはまだFIFOに残っているので、読み出し時刻ではなく
+    // 前回のバッチの続きとして時刻を付ける
+    for (size_t n = 0; n < count; n++) {
+      samples[n].timestampUs = _lastTimestampUs + (uint64_t)((n + 1) * _fifoPeriodUs);
+    }
+  } else {
+    // Back-date timestamps: the newest frame was taken just before the read
+    // (frames beyond maxSamples were decoded but newer than the last sample kept)
+    for (size_t n = 0; n < count; n++) {
+      samples[n].timestampUs = readTimeUs - (uint64_t)((frames - 1 - n) * _fifoPeriodUs);
+    }
+  }
+  if (count > 0) {
+    _lastTimestampUs = samples[count - 1].timestampUs;
+  }
+  
+  return (int)count;
+}
+
+void BMI270::updateScales() {
+  // ACC_RANGE: 0 = ±2g, 1 = ±4g, 2 = ±8g, 3 = ±16g
+  uint8_t accRange = readRegister(BMI270_ACC_RANGE) & 0x03;
+  acc_scale = (2.0f * (1 << accRange)) / 32768.0f;
+  
+  // GYR_RANGE: 0 = ±2000, 1 = ±1000, 2 = ±500, 3 = ±250, 4 = ±125 deg/s
+  uint8_t gyrRange = readRegister(BMI270_GYR_RANGE) & 0x07;
+  if (gyrRange > 4) {
+    gyrRange = 4;
+  }
+  gyr_scale = (2000.0f / (1 << gyrRange)) / 32768.0f;
+}
+
 void BMI270::calculateOrientation(float *pitch, float *roll) {
   // Calculate pitch and roll from accelerometer data
   // This is a simple calculation without sensor fusion
@@ -117,24 +325,20 @@ void BMI270::calculateOrientation(float *pitch, float *roll) {
   *roll *= 180.0 / PI;
 }
 
+// 内蔵I2CバスはM5Unified（M5.In_I2C）が管理しているため、同じドライバ経由でアクセスする
 uint8_t BMI270::readRegister(uint8_t reg) {
-  Wire.beginTransmission(BMI270_I2C_ADDR);
-  Wire.write(reg);
-  Wire.endTransmission(false);
-  
-  Wire.requestFrom(BMI270_I2C_ADDR, 1);
-  if (Wire.available()) {
-    return Wire.read();
-  }
-  
-  return 0;
+  uint8_t value = 0;
+  M5.In_I2C.readRegister(BMI270_I2C_ADDR, reg, &value, 1, BMI270_I2C_FREQ);
+  return value;
+}
+
+bool BMI270::readRegisters(uint8_t reg, uint8_t* data, size_t length) {
+  _busBytes += length + BMI270_I2C_READ_OVERHEAD;
+  return M5.In_I2C.readRegister(BMI270_I2C_ADDR, reg, data, length, BMI270_I2C_FREQ);
 }
 
 void BMI270::writeRegister(uint8_t reg, uint8_t value) {
-  Wire.beginTransmission(BMI270_I2C_ADDR);
-  Wire.write(reg);
-  Wire.write(value);
-  Wire.endTransmission();
+  M5.In_I2C.writeRegister8(BMI270_I2C_ADDR, reg, value, BMI270_I2C_FREQ);
 }
 
 void BMI270::softReset() {
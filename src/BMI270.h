@@ -8,7 +8,6 @@
 #define BMI270_H
 
 #include <Arduino.h>
-#include <Wire.h>
 
 // BMI270 registers
 #define BMI270_CHIP_ID          0x00
@@ -26,18 +25,66 @@
 #define BMI270_GYR_Y_MSB        0x15
 #define BMI270_GYR_Z_LSB        0x16
 #define BMI270_GYR_Z_MSB        0x17
+#define BMI270_SENSORTIME_0     0x18
+#define BMI270_FIFO_LENGTH_0    0x24
+#define BMI270_FIFO_LENGTH_1    0x25
+#define BMI270_FIFO_DATA        0x26
+#define BMI270_ACC_CONF         0x40
+#define BMI270_ACC_RANGE        0x41
+#define BMI270_GYR_CONF         0x42
+#define BMI270_GYR_RANGE        0x43
+#define BMI270_FIFO_CONFIG_0    0x48
+#define BMI270_FIFO_CONFIG_1    0x49
 #define BMI270_CMD              0x7E
 
 // BMI270 commands
 #define BMI270_CMD_SOFTRESET    0xB6
+#define BMI270_CMD_FIFO_FLUSH   0xB0
+
+// FIFO configuration bits
+#define BMI270_FIFO_TIME_EN     0x02  // FIFO_CONFIG_0: append sensortime frame
+#define BMI270_FIFO_HEADER_EN   0x10  // FIFO_CONFIG_1: header mode
+#define BMI270_FIFO_ACC_EN      0x40  // FIFO_CONFIG_1: store accelerometer
+#define BMI270_FIFO_GYR_EN      0x80  // FIFO_CONFIG_1: store gyroscope
+
+// FIFO frame headers
+#define BMI270_FH_MODE_MASK     0xC0
+#define BMI270_FH_REGULAR       0x80  // data frame (parameter bits select sensors)
+#define BMI270_FH_CONTROL       0x40  // control frame
+#define BMI270_FH_ACC           0x04
+#define BMI270_FH_GYR           0x08
+#define BMI270_FH_AUX           0x10
+#define BMI270_FH_SKIP          0x40  // skipped frames (1 byte)
+#define BMI270_FH_SENSORTIME    0x44  // sensortime (3 bytes)
+#define BMI270_FH_INPUT_CFG     0x48  // FIFO input config changed (4 bytes)
+#define BMI270_FH_EMPTY         0x80  // over-read / FIFO empty
+
+// FIFO limits
+#define BMI270_FIFO_BUFFER_SIZE 512   // local burst buffer (bytes, read in one transaction)
+#define BMI270_SENSORTIME_US    39.0625f  // sensortime LSB in microseconds
 
 // BMI270 I2C address
 #define BMI270_I2C_ADDR         0x68
 
+// I2C clock for the internal bus
+#define BMI270_I2C_FREQ         400000
+
+// Bus accounting: 9 bit times per byte (8 data + ACK), and a register read
+// adds the address (write), register and address (read) bytes to the data
+#define BMI270_I2C_BYTES_PER_S  (BMI270_I2C_FREQ / 9)
+#define BMI270_I2C_READ_OVERHEAD 3
+
 // Return codes
 #define BMI270_OK               0
 #define BMI270_ERROR            1
 
+// Timestamped sample drained from the FIFO
+struct BMI270Sample {
+  float acc[3];          // g
+  float gyr[3];          // deg/s
+  uint64_t timestampUs;  // esp_timer time the sample was taken (estimated)
+};
+
 class BMI270 {
 public:
   BMI270();
@@ -49,6 +96,29 @@ public:
   void readAcceleration();
   void readGyro();
   
+  // Read accelerometer and gyroscope in a single 12-byte burst
+  void readAccelGyro();
+  
+  // FIFO mode
+  // Enables header-mode FIFO for accel+gyro at the given ODR (Hz).
+  // The chip must already be initialized (M5Unified loads the config file).
+  int beginFifo(uint16_t odrHz);
+  void endFifo();
+  bool isFifoEnabled() const { return _fifoEnabled; }
+  
+  // Drain the FIFO in one burst and decode up to maxSamples frames.
+  // readTimeUs is the esp_timer time of the read; samples are back-dated
+  // from it using the sensor's own clock. When the FIFO held more than the
+  // local buffer, the batch continues from the previous one instead.
+  // Returns the number of samples or -1 on a bus error.
+  int readFifo(BMI270Sample* samples, size_t maxSamples, uint64_t readTimeUs);
+  
+  // Measured time between FIFO frames (microseconds)
+  float getFifoPeriodUs() const { return _fifoPeriodUs; }
+  
+  // Bytes moved on the bus by the multi-byte reads (FIFO length and burst)
+  uint32_t getBusBytes() const { return _busBytes; }
+  
   // Raw sensor data
   int16_t raw_acc_x;
   int16_t raw_acc_y;
@@ -73,6 +143,7 @@ public:
 private:
   // I2C communication
   uint8_t readRegister(uint8_t reg);
+  bool readRegisters(uint8_t reg, uint8_t* data, size_t length);
   void writeRegister(uint8_t reg, uint8_t value);
   
   // Sensor configuration
@@ -82,6 +153,18 @@ private:
   // Conversion factors
   float acc_scale;  // Scale factor for accelerometer (g per LSB)
   float gyr_scale;  // Scale factor for gyroscope (deg/s per LSB)
+  
+  // Update scale factors from the range registers
+  void updateScales();
+  
+  // FIFO state
+  bool _fifoEnabled;
+  float _fifoPeriodUs;       // 実測したフレーム間隔
+  uint32_t _lastSensorTime;  // 前回のsensortimeフレームの値
+  uint32_t _framesSinceTime; // 前回のsensortime以降のフレーム数
+  uint64_t _lastTimestampUs; // 前回のバッチの最後のサンプル時刻（0 = なし）
+  uint8_t _fifoBuffer[BMI270_FIFO_BUFFER_SIZE];
+  volatile uint32_t _busBytes; // 読み出した側のタスクだけが加算する
 };
 
 #endif // BMI270_H
@@ -6,6 +6,7 @@
 
 #include "BMM150class.h"
 #include <math.h>
+#include "fast_math.h"
 
 BMM150class::BMM150class() {
   // Initialize variables
@@ -110,9 +111,9 @@ void BMM150class::readMagnetometer() {
   mag_z = soft_iron[2][0] * cal_x + soft_iron[2][1] * cal_y + soft_iron[2][2] * cal_z;
   
   // Apply low-pass filter to reduce noise
-  mag_x = mag_x * 0.9 + prev_mag_x * 0.1;
-  mag_y = mag_y * 0.9 + prev_mag_y * 0.1;
-  mag_z = mag_z * 0.9 + prev_mag_z * 0.1;
+  mag_x = mag_x * 0.9f + prev_mag_x * 0.1f;
+  mag_y = mag_y * 0.9f + prev_mag_y * 0.1f;
+  mag_z = mag_z * 0.9f + prev_mag_z * 0.1f;
   
   // Store current values for next filter iteration
   prev_mag_x = mag_x;
@@ -124,11 +125,11 @@ float BMM150class::calculateHeading() {
   // Calculate heading from magnetometer data
   // This assumes the device is flat (no tilt compensation)
   
-  float heading = atan2(mag_y, mag_x) * 180.0 / PI;
+  float heading = fastAtan2Deg(mag_y, mag_x);
   
   // Convert to 0-360 degrees
   if (heading < 0) {
-    heading += 360.0;
+    heading += 360.0f;
   }
   
   return heading;
@@ -139,19 +140,20 @@ float BMM150class::calculateTiltCompensatedHeading(float pitch, float roll) {
   // pitch and roll in radians
   
   // Convert pitch and roll to radians if they are in degrees
-  float pitch_rad = pitch * PI / 180.0;
-  float roll_rad = roll * PI / 180.0;
+  float sinPitch, cosPitch, sinRoll, cosRoll;
+  fastSinCos(pitch * FM_DEG_TO_RAD, &sinPitch, &cosPitch);
+  fastSinCos(roll * FM_DEG_TO_RAD, &sinRoll, &cosRoll);
   
   // Tilt compensation
-  float mag_x_comp = mag_x * cos(pitch_rad) + mag_z * sin(pitch_rad);
-  float mag_y_comp = mag_x * sin(roll_rad) * sin(pitch_rad) + mag_y * cos(roll_rad) - mag_z * sin(roll_rad) * cos(pitch_rad);
+  float mag_x_comp = mag_x * cosPitch + mag_z * sinPitch;
+  float mag_y_comp = mag_x * sinRoll * sinPitch + mag_y * cosRoll - mag_z * sinRoll * cosPitch;
   
   // Calculate heading
-  float heading = atan2(mag_y_comp, mag_x_comp) * 180.0 / PI;
+  float heading = fastAtan2Deg(mag_y_comp, mag_x_comp);
   
   // Convert to 0-360 degrees
   if (heading < 0) {
-    heading += 360.0;
+    heading += 360.0f;
   }
   
   return heading;
@@ -0,0 +1,382 @@
+/*
+ * BleStreamer.cpp
+ * 
+ * Implementation of the BLE orientation streamer
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "BleStreamer.h"
+#include <BLEServer.h>
+#include <BLEUtils.h>
+#include <BLE2902.h>
+#include <esp_gap_ble_api.h>
+#include <esp_timer.h>
+#include "AHRSEngine.h"
+#include "Logger.h"
+
+// クライアント（tools・アプリ）と合わせるレイアウト
+static_assert(sizeof(BleStreamHeader) == 4, "BleStreamHeader layout changed");
+static_assert(sizeof(BleStreamFrame) == 16, "BleStreamFrame layout changed");
+static_assert(sizeof(BleStatusPacket) == 40, "BleStatusPacket layout changed");
+
+// ATT notification overhead (opcode + handle)
+#define BLE_ATT_OVERHEAD 3
+
+// GAPのコールバックはインスタンスを受け取れないため
+static BleStreamer* s_instance = nullptr;
+
+// Quantize with rounding and saturation to int16
+static int16_t quantize(float value, float scale, bool* clipped = nullptr) {
+  float q = value * scale;
+  q += (q >= 0.0f) ? 0.5f : -0.5f;
+  if (q > 32767.0f || q < -32768.0f) {
+    if (clipped) *clipped = true;
+    return q > 0.0f ? 32767 : -32768;
+  }
+  return (int16_t)q;
+}
+
+// Connection events from the GATT server (BLE stack task)
+class BleStreamer::ServerCallbacks : public BLEServerCallbacks {
+public:
+  explicit ServerCallbacks(BleStreamer* owner) : _owner(owner) {}
+  
+  void onConnect(BLEServer* server, esp_ble_gatts_cb_param_t* param) override {
+    _owner->onConnect(param->connect.conn_id, param->connect.conn_params.interval);
+    
+    // 30Hz以上で送るため、短い接続間隔を要求する（決めるのはセントラル側）
+    server->updateConnParams(param->connect.remote_bda, BLE_CONN_INTERVAL_MIN,
+                             BLE_CONN_INTERVAL_MAX, 0, BLE_CONN_TIMEOUT);
+  }
+  
+  void onDisconnect(BLEServer* server, esp_ble_gatts_cb_param_t* param) override {
+    _owner->onDisconnect();
+    if (_owner->_enabledRequested) {
+      server->startAdvertising();
+    }
+  }
+  
+  void onMtuChanged(BLEServer* server, esp_ble_gatts_cb_param_t* param) override {
+    _owner->_mtu = param->mtu.mtu;
+    LOG_I(LOG_TAG_MAIN, "BLE MTU %u", (unsigned)param->mtu.mtu);
+  }
+
+private:
+  BleStreamer* _owner;
+};
+
+// Constructor
+BleStreamer::BleStreamer(const SensorTask* sensorTask) {
+  _sensorTask = sensorTask;
+  _taskHandle = nullptr;
+  _enabledRequested = false;
+  _enabled = false;
+  _stackStarted = false;
+  _connected = false;
+  _connId = 0;
+  _mtu = BLE_DEFAULT_MTU;
+  _intervalUs = 0;
+  _server = nullptr;
+  _streamChar = nullptr;
+  _statusChar = nullptr;
+  memset(_queue, 0, sizeof(_queue));
+  _queueCount = 0;
+  _sequence = 0;
+  _lastSnapshotUs = 0;
+  _framesSent = 0;
+  _framesDropped = 0;
+  _notifications = 0;
+}
+
+bool BleStreamer::begin() {
+  if (_taskHandle != nullptr) {
+    return true;
+  }
+  s_instance = this;
+  
+  // タスクは起動時に作っておく（有効にしたときにUIタスクでヒープを使わない）
+  BaseType_t result = xTaskCreatePinnedToCore(taskEntry, "ble", BLE_TASK_STACK_SIZE, this,
+                                              BLE_TASK_PRIORITY, &_taskHandle, BLE_TASK_CORE);
+  if (result != pdPASS) {
+    _taskHandle = nullptr;
+    LOG_E(LOG_TAG_MAIN, "BLE streamer task could not be created");
+    return false;
+  }
+  return true;
+}
+
+void BleStreamer::setEnabled(bool enabled) {
+  if (enabled == _enabledRequested) {
+    return;
+  }
+  _enabledRequested = enabled;
+  if (_taskHandle != nullptr) {
+    xTaskNotifyGive(_taskHandle);
+  }
+}
+
+void BleStreamer::taskEntry(void* param) {
+  static_cast<BleStreamer*>(param)->run();
+}
+
+void BleStreamer::run() {
+  const TickType_t period = pdMS_TO_TICKS(1000 / BLE_STREAM_RATE_HZ);
+  TickType_t lastWake = xTaskGetTickCount();
+  int64_t lastStatusUs = 0;
+  
+  for (;;) {
+    // 無効の間は設定が変わるまで眠る
+    if (!_enabledRequested) {
+      if (_enabled) {
+        applyEnabled(false);
+      }
+      ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+      lastWake = xTaskGetTickCount();
+      continue;
+    }
+    if (!_enabled) {
+      applyEnabled(true);
+      if (!_enabled) {
+        // スタックを起動できなかった（設定を切り替えるまで再試行しない）
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        continue;
+      }
+      lastWake = xTaskGetTickCount();
+    }
+    
+    vTaskDelayUntil(&lastWake, period);
+    if (!_connected) {
+      _queueCount = 0;
+      continue;
+    }
+    
+    int64_t now = esp_timer_get_time();
+    if (_queueCount == BLE_QUEUE_FRAMES) {
+      // 送れない間は古いフレームから捨てる（通し番号で欠けが分かる）
+      memmove(&_queue[0], &_queue[1], sizeof(BleStreamFrame) * (BLE_QUEUE_FRAMES - 1));
+      _queueCount--;
+      _sequence++;
+      _framesDropped++;
+    }
+    makeFrame(now, _queue[_queueCount]);
+    _queueCount++;
+    flush();
+    
+    if (now - lastStatusUs >= (int64_t)BLE_STATUS_INTERVAL_MS * 1000LL) {
+      lastStatusUs = now;
+      sendStatus();
+    }
+  }
+}
+
+bool BleStreamer::startStack() {
+  BLEDevice::init(BLE_DEVICE_NAME);
+  BLEDevice::setMTU(BLE_LOCAL_MTU);
+  BLEDevice::setCustomGapHandler(gapHandler);
+  
+  _server = BLEDevice::createServer();
+  if (_server == nullptr) {
+    return false;
+  }
+  _server->setCallbacks(new ServerCallbacks(this));
+  
+  BLEService* service = _server->createService(BLE_SERVICE_UUID);
+  _streamChar = service->createCharacteristic(BLE_STREAM_CHAR_UUID,
+                                              BLECharacteristic::PROPERTY_NOTIFY);
+  _streamChar->addDescriptor(new BLE2902());
+  _statusChar = service->createCharacteristic(BLE_STATUS_CHAR_UUID,
+                                              BLECharacteristic::PROPERTY_READ |
+                                              BLECharacteristic::PROPERTY_NOTIFY);
+  _statusChar->addDescriptor(new BLE2902());
+  service->start();
+  
+  BLEAdvertising* advertising = BLEDevice::getAdvertising();
+  advertising->addServiceUUID(BLE_SERVICE_UUID);
+  advertising->setScanResponse(true);
+  return true;
+}
+
+void BleStreamer::applyEnabled(bool enabled) {
+  if (enabled) {
+    if (!_stackStarted) {
+      _stackStarted = startStack();
+      if (!_stackStarted) {
+        LOG_E(LOG_TAG_MAIN, "BLE stack could not be started");
+        return;
+      }
+    }
+    BLEDevice::startAdvertising();
+    _enabled = true;
+    LOG_I(LOG_TAG_MAIN, "BLE advertising as %s", BLE_DEVICE_NAME);
+    return;
+  }
+  
+  BLEDevice::stopAdvertising();
+  if (_connected && _server != nullptr) {
+    _server->disconnect(_connId);
+  }
+  _enabled = false;
+  _queueCount = 0;
+  LOG_I(LOG_TAG_MAIN, "BLE streaming stopped");
+}
+
+void BleStreamer::makeFrame(int64_t nowUs, BleStreamFrame& frame) {
+  OrientationData snapshot;
+  BleContext context;
+  bool hasSnapshot = _sensorTask != nullptr && _sensorTask->getSnapshot(snapshot);
+  bool hasContext = _context.read(context);
+  
+  memset(&frame, 0, sizeof(frame));
+  frame.timeMs = (uint16_t)(nowUs / 1000);
+  if (!hasSnapshot || !snapshot.attitudeValid) {
+    frame.quat[0] = 16384;
+    return;
+  }
+  
+  // 新しいスナップショットはそのまま、間のフレームは現在時刻まで進める
+  float quat[4];
+  memcpy(quat, snapshot.quat, sizeof(quat));
+  bool fresh = snapshot.timestampUs != _lastSnapshotUs;
+  _lastSnapshotUs = snapshot.timestampUs;
+  int64_t leadUs = nowUs - (int64_t)snapshot.timestampUs;
+  if (fresh) {
+    frame.timeMs = (uint16_t)(snapshot.timestampUs / 1000);
+  } else {
+    frame.flags |= BLE_FLAG_PREDICTED;
+    if (snapshot.gyroOk && !snapshot.stationary && leadUs > 0 && leadUs <= BLE_MAX_PREDICTION_US) {
+      float gyro[3], gyroBody[3];
+      for (int axis = 0; axis < 3; axis++) {
+        gyro[axis] = snapshot.gyro[axis] - (snapshot.gyroBiasValid ? snapshot.gyroBias[axis] : 0.0f);
+      }
+      AHRSEngine::fromDeviceAxes(gyro, gyroBody);
+      AHRSEngine::predict(snapshot.quat, gyroBody, leadUs * 1e-6f, quat);
+    }
+  }
+  
+  for (int i = 0; i < 4; i++) {
+    frame.quat[i] = quantize(quat[i], 16384.0f);
+  }
+  frame.confidence = (uint8_t)constrain(snapshot.confidence * 255.0f, 0.0f, 255.0f);
+  frame.flags |= BLE_FLAG_ATTITUDE_VALID |
+                 (snapshot.magCalValid ? BLE_FLAG_MAG_CAL_VALID : 0) |
+                 (snapshot.magDisturbed ? BLE_FLAG_MAG_DISTURBED : 0) |
+                 (snapshot.stationary ? BLE_FLAG_STATIONARY : 0);
+  
+  if (!hasContext || !context.targetValid) {
+    return;
+  }
+  
+  // 極軸の誤差は微調整画面と同じ定義（傾き補正済みの方位角、方位は天球上の角度）
+  float heading, pitch, roll;
+  AHRSEngine::quaternionToEuler(quat, &heading, &pitch, &roll);
+  float az = heading + context.declination - context.poleAzimuth;
+  while (az > 180.0f) az -= 360.0f;
+  while (az < -180.0f) az += 360.0f;
+  az *= cosf(context.poleAltitude * DEG_TO_RAD);
+  
+  bool clipped = false;
+  frame.azimuthError = quantize(az, 600.0f, &clipped);
+  frame.altitudeError = quantize(pitch - context.poleAltitude, 600.0f, &clipped);
+  frame.flags |= BLE_FLAG_TARGET_VALID | (clipped ? BLE_FLAG_ERROR_CLIPPED : 0);
+}
+
+uint8_t BleStreamer::maxFramesPerNotify() const {
+  int payload = (int)_mtu - BLE_ATT_OVERHEAD - (int)sizeof(BleStreamHeader);
+  int frames = payload / (int)sizeof(BleStreamFrame);
+  if (frames < 1) frames = 1;
+  if (frames > BLE_QUEUE_FRAMES) frames = BLE_QUEUE_FRAMES;
+  return (uint8_t)frames;
+}
+
+uint8_t BleStreamer::batchFrames() const {
+  // 接続間隔の間に生成されるフレームをまとめて1回で送る（通知の数を減らす）
+  uint32_t framePeriodUs = 1000000UL / BLE_STREAM_RATE_HZ;
+  uint32_t frames = (_intervalUs + framePeriodUs - 1) / framePeriodUs;
+  uint8_t limit = maxFramesPerNotify();
+  if (frames < 1) frames = 1;
+  return frames > limit ? limit : (uint8_t)frames;
+}
+
+void BleStreamer::flush() {
+  uint8_t batch = batchFrames();
+  while (_queueCount >= batch) {
+    // Bluedroidの送信バッファに空きがない間は溜めておく（ブロックしない）
+    if (esp_ble_get_cur_sendable_packets_num(_connId) == 0) {
+      return;
+    }
+    
+    uint8_t count = _queueCount < maxFramesPerNotify() ? _queueCount : maxFramesPerNotify();
+    BleStreamHeader header;
+    header.version = BLE_STREAM_VERSION;
+    header.count = count;
+    header.sequence = _sequence;
+    memcpy(_packet, &header, sizeof(header));
+    memcpy(_packet + sizeof(header), _queue, sizeof(BleStreamFrame) * count);
+    _streamChar->setValue(_packet, sizeof(header) + sizeof(BleStreamFrame) * count);
+    _streamChar->notify();
+    
+    _queueCount -= count;
+    memmove(&_queue[0], &_queue[count], sizeof(BleStreamFrame) * _queueCount);
+    _sequence += count;
+    _framesSent += count;
+    _notifications++;
+  }
+}
+
+void BleStreamer::sendStatus() {
+  BleContext context;
+  if (!_context.read(context)) {
+    memset(&context, 0, sizeof(context));
+  }
+  
+  BleStatusPacket status;
+  status.latitudeE7 = (int32_t)(context.latitude * 1e7f);
+  status.longitudeE7 = (int32_t)(context.longitude * 1e7f);
+  status.altitudeCm = (int32_t)(context.altitude * 100.0f);
+  status.utcSeconds = context.utcSeconds;
+  status.hdopCenti = (uint16_t)constrain(context.hdop * 100.0f, 0.0f, 65535.0f);
+  status.poleAzimuthCenti = (uint16_t)(context.poleAzimuth * 100.0f);
+  status.poleAltitudeCenti = quantize(context.poleAltitude, 100.0f);
+  status.declinationCenti = quantize(context.declination, 100.0f);
+  status.frameRateHz = BLE_STREAM_RATE_HZ;
+  status.imuRateHz = context.imuRateHz;
+  status.satellites = context.satellites;
+  status.flags = context.statusFlags;
+  status.version = BLE_STREAM_VERSION;
+  status.mtu = (uint8_t)(_mtu > 255 ? 255 : _mtu);
+  status.framesSent = _framesSent;
+  status.framesDropped = _framesDropped;
+  
+  // 読み出し用に常に値を更新し、MTUに収まる場合だけ通知する
+  _statusChar->setValue((uint8_t*)&status, sizeof(status));
+  if (_mtu >= sizeof(status) + BLE_ATT_OVERHEAD && esp_ble_get_cur_sendable_packets_num(_connId) > 0) {
+    _statusChar->notify();
+  }
+}
+
+void BleStreamer::gapHandler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param) {
+  if (event != ESP_GAP_BLE_UPDATE_CONN_PARAMS_EVT || s_instance == nullptr) {
+    return;
+  }
+  
+  // 接続間隔が決まったらバッチの大きさを合わせる
+  s_instance->_intervalUs = (uint32_t)param->update_conn_params.conn_int * 1250UL;
+  LOG_I(LOG_TAG_MAIN, "BLE connection interval %.2f ms, %u frames per notification",
+        s_instance->_intervalUs * 0.001f, (unsigned)s_instance->batchFrames());
+}
+
+void BleStreamer::onConnect(uint16_t connId, uint16_t intervalUnits) {
+  _connId = connId;
+  _mtu = BLE_DEFAULT_MTU;
+  _intervalUs = (uint32_t)intervalUnits * 1250UL;
+  _connected = true;
+  LOG_I(LOG_TAG_MAIN, "BLE client connected (interval %.2f ms)", _intervalUs * 0.001f);
+}
+
+void BleStreamer::onDisconnect() {
+  _connected = false;
+  LOG_I(LOG_TAG_MAIN, "BLE client disconnected (%u frames sent, %u dropped)",
+        (unsigned)_framesSent, (unsigned)_framesDropped);
+}
@@ -0,0 +1,212 @@
+/*
+ * BleStreamer.h
+ * 
+ * BLE GATT streaming of the fused orientation, polar alignment error and
+ * GPS state to phone/tablet/PC clients (Bluetooth setting)
+ * 
+ * 専用のタスクがBLE_STREAM_RATE_HZでセンサータスクのスナップショット
+ * （UIと同じSeqLock）を読み、固定長のフレームに詰めて通知する。
+ * スナップショットはFIFOのバッチごと（25Hz）にしか更新されないため、
+ * 間のフレームはバイアス補正後のジャイロで姿勢を進める（BLE_FLAG_PREDICTED）。
+ * フレームは接続間隔の間に溜まる数だけ1つの通知にまとめ、
+ * MTUに収まる数を上限とする。送信バッファが空くまでは溜めておき、
+ * あふれた分は古いものから捨てて次の通知のヘッダーで知らせる。
+ * BLEスタックの初期化・送信はこのタスクだけが行う（UIタスクと
+ * センサータスクではヒープを使わないため）。無効にすると広告を止めて
+ * 切断するが、スタックは解放しない（Arduinoのライブラリは再初期化できない）。
+ * 
+ * Stream characteristic (notify): BleStreamHeader, then count × BleStreamFrame
+ * Status characteristic (read, notify at 1 Hz): BleStatusPacket
+ * Multi-byte fields are little-endian.
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef BLE_STREAMER_H
+#define BLE_STREAMER_H
+
+#include <Arduino.h>
+#include <BLEDevice.h>
+#include "SeqLock.h"
+#include "SensorTask.h"
+
+// GATT layout
+#define BLE_DEVICE_NAME          "Polaris-Nav"
+#define BLE_SERVICE_UUID         "7a0b1000-5c3e-4b8e-9d2a-6f1c0e9a4b01"
+#define BLE_STREAM_CHAR_UUID     "7a0b1001-5c3e-4b8e-9d2a-6f1c0e9a4b01"
+#define BLE_STATUS_CHAR_UUID     "7a0b1002-5c3e-4b8e-9d2a-6f1c0e9a4b01"
+#define BLE_STREAM_VERSION       1
+
+// Streaming
+#define BLE_STREAM_RATE_HZ       50         // フレームの生成周期
+#define BLE_STATUS_INTERVAL_MS   1000       // 状態の通知間隔
+#define BLE_MAX_PREDICTION_US    150000     // これより古いスナップショットは進めない
+#define BLE_LOCAL_MTU            247        // 要求するMTU（1通知に15フレーム）
+#define BLE_DEFAULT_MTU          23
+#define BLE_QUEUE_FRAMES         32         // 送れない間に溜めておくフレーム数
+
+// Connection interval requested from the central (1.25 ms units)
+#define BLE_CONN_INTERVAL_MIN    12         // 15ms
+#define BLE_CONN_INTERVAL_MAX    24         // 30ms
+#define BLE_CONN_TIMEOUT         400        // 4s（10ms単位）
+
+// Streamer task
+#define BLE_TASK_CORE            1          // UIと同じコア（センサータスクを遅らせない）
+#define BLE_TASK_PRIORITY        2          // loopTask(1)より上、センサータスク(5)より下
+#define BLE_TASK_STACK_SIZE      6144
+
+// Frame flags
+#define BLE_FLAG_ATTITUDE_VALID  0x01
+#define BLE_FLAG_MAG_CAL_VALID   0x02
+#define BLE_FLAG_MAG_DISTURBED   0x04
+#define BLE_FLAG_STATIONARY      0x08
+#define BLE_FLAG_PREDICTED       0x10   // 前回のスナップショットを進めた姿勢（静止中はそのまま）
+#define BLE_FLAG_ERROR_CLIPPED   0x20   // 極軸の誤差が範囲外（±54.6度で飽和）
+#define BLE_FLAG_TARGET_VALID    0x40   // 極の位置が計算済み
+
+// Status flags
+#define BLE_STATUS_GPS_FIX       0x01
+#define BLE_STATUS_TIME_SYNCED   0x02
+#define BLE_STATUS_TRUE_NORTH    0x04
+#define BLE_STATUS_FINE_ALIGN    0x08
+
+// Notification header
+struct BleStreamHeader {
+  uint8_t version;         // BLE_STREAM_VERSION
+  uint8_t count;           // 続くフレームの数
+  uint16_t sequence;       // 最初のフレームの通し番号
+};
+
+// One orientation sample
+struct BleStreamFrame {
+  uint16_t timeMs;         // 姿勢の時刻（esp_timerのミリ秒の下位16ビット）
+  int16_t quat[4];         // w, x, y, z × 16384（体軸座標系→水平座標系）
+  int16_t azimuthError;    // 方位の誤差（天球上、0.1分角）
+  int16_t altitudeError;   // 高度の誤差（0.1分角）
+  uint8_t confidence;      // 0-255
+  uint8_t flags;           // BLE_FLAG_*
+};
+
+// Position and pole target (read or 1 Hz notify)
+struct BleStatusPacket {
+  int32_t latitudeE7;      // 度 × 1e7
+  int32_t longitudeE7;
+  int32_t altitudeCm;
+  uint32_t utcSeconds;     // Unix時刻（未同期なら0）
+  uint16_t hdopCenti;
+  uint16_t poleAzimuthCenti;
+  int16_t poleAltitudeCenti;
+  int16_t declinationCenti; // 方位角に加えている偏角（磁北基準なら0）
+  uint16_t frameRateHz;    // BLE_STREAM_RATE_HZ
+  uint16_t imuRateHz;
+  uint8_t satellites;
+  uint8_t flags;           // BLE_STATUS_*
+  uint8_t version;         // BLE_STREAM_VERSION
+  uint8_t mtu;             // 交渉後のMTU（255で飽和）
+  uint32_t framesSent;
+  uint32_t framesDropped;
+};
+
+// Inputs computed by the UI task (published through a SeqLock)
+struct BleContext {
+  float poleAzimuth;       // 度（真北基準）
+  float poleAltitude;
+  float declination;       // 方位角に加える偏角（磁北基準なら0）
+  float latitude;
+  float longitude;
+  float altitude;
+  float hdop;
+  uint32_t utcSeconds;
+  uint16_t imuRateHz;
+  uint8_t satellites;
+  uint8_t statusFlags;     // BLE_STATUS_*
+  bool targetValid;
+};
+
+class BleStreamer {
+public:
+  // Constructor
+  BleStreamer(const SensorTask* sensorTask);
+  
+  // Start the streamer task (the BLE stack is started on the first setEnabled(true))
+  bool begin();
+  
+  // Advertise and stream while enabled (any task, applied by the streamer task)
+  void setEnabled(bool enabled);
+  bool isEnabled() const { return _enabledRequested; }
+  
+  // Publish the pole target and GPS state (UI task only)
+  void setContext(const BleContext& context) { _context.write(context); }
+  
+  // Connection state
+  bool isConnected() const { return _connected; }
+  uint16_t getMtu() const { return _mtu; }
+  uint32_t getIntervalUs() const { return _intervalUs; }
+  
+  // Statistics
+  uint32_t getFramesSent() const { return _framesSent; }
+  uint32_t getFramesDropped() const { return _framesDropped; }
+  uint32_t getNotifications() const { return _notifications; }
+
+private:
+  // Streamer task
+  static void taskEntry(void* param);
+  void run();
+  
+  // BLE stack (streamer task only)
+  bool startStack();
+  void applyEnabled(bool enabled);
+  
+  // Build the next frame from the snapshot (predicted between snapshots)
+  void makeFrame(int64_t nowUs, BleStreamFrame& frame);
+  
+  // Send queued frames when a batch is due and the stack has room
+  void flush();
+  void sendStatus();
+  
+  // Frames per notification for the negotiated MTU / connection interval
+  uint8_t maxFramesPerNotify() const;
+  uint8_t batchFrames() const;
+  
+  // GATT/GAP callbacks (BLE stack task)
+  class ServerCallbacks;
+  friend class ServerCallbacks;
+  static void gapHandler(esp_gap_ble_cb_event_t event, esp_ble_gap_cb_param_t* param);
+  void onConnect(uint16_t connId, uint16_t intervalUnits);
+  void onDisconnect();
+  
+  const SensorTask* _sensorTask;
+  SeqLock<BleContext> _context;
+  TaskHandle_t _taskHandle;
+  
+  // Requested and applied state
+  volatile bool _enabledRequested;
+  bool _enabled;
+  bool _stackStarted;
+  
+  // Connection (written from the BLE stack callbacks)
+  volatile bool _connected;
+  volatile uint16_t _connId;
+  volatile uint16_t _mtu;
+  volatile uint32_t _intervalUs;
+  
+  // GATT objects (owned by the BLE library)
+  BLEServer* _server;
+  BLECharacteristic* _streamChar;
+  BLECharacteristic* _statusChar;
+  
+  // Frame queue (streamer task only)
+  BleStreamFrame _queue[BLE_QUEUE_FRAMES];
+  uint8_t _queueCount;
+  uint16_t _sequence;          // _queue[0]の通し番号
+  uint64_t _lastSnapshotUs;
+  uint8_t _packet[BLE_LOCAL_MTU];
+  
+  // Statistics
+  volatile uint32_t _framesSent;
+  volatile uint32_t _framesDropped;
+  volatile uint32_t _notifications;
+};
+
+#endif // BLE_STREAMER_H
@@ -0,0 +1,158 @@
+/*
+ * BootSequencer.cpp
+ * 
+ * Implementation of the boot stage timer
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "BootSequencer.h"
+#include "Logger.h"
+
+// Constructor
+BootSequencer::BootSequencer() {
+  memset(_stages, 0, sizeof(_stages));
+  memset(_jobs, 0, sizeof(_jobs));
+  _finishUs = 0;
+  _firstFixUs = 0;
+}
+
+void BootSequencer::startStage(BootStage stage) {
+  _stages[stage].startUs = esp_timer_get_time();
+  _stages[stage].endUs = 0;
+  _stages[stage].ok = false;
+  _stages[stage].parallel = false;
+}
+
+void BootSequencer::endStage(BootStage stage, bool ok) {
+  _stages[stage].endUs = esp_timer_get_time();
+  _stages[stage].ok = ok;
+}
+
+void BootSequencer::startParallel(BootStage stage, BootStageFunction function, void* arg) {
+  ParallelJob* job = &_jobs[stage];
+  job->owner = this;
+  job->stage = stage;
+  job->function = function;
+  job->arg = arg;
+  job->result = false;
+  if (job->done == nullptr) {
+    job->done = xSemaphoreCreateBinary();
+  }
+  
+  startStage(stage);
+  _stages[stage].parallel = true;
+  
+  BaseType_t created = pdFAIL;
+  if (job->done != nullptr) {
+    created = xTaskCreatePinnedToCore(taskEntry, "boot", BOOT_TASK_STACK_SIZE, job,
+                                      BOOT_TASK_PRIORITY, nullptr, BOOT_TASK_CORE);
+  }
+  
+  if (created != pdPASS) {
+    // 並列化できなくても起動は続ける（その場で実行）
+    LOG_W(LOG_TAG_MAIN, "Boot helper task unavailable, running %s inline", getStageName(stage));
+    job->result = function(arg);
+    endStage(stage, job->result);
+    if (job->done != nullptr) {
+      xSemaphoreGive(job->done);
+    }
+  }
+}
+
+bool BootSequencer::waitParallel(BootStage stage, uint32_t timeoutMs) {
+  ParallelJob* job = &_jobs[stage];
+  if (job->done == nullptr) {
+    return _stages[stage].ok;
+  }
+  
+  if (xSemaphoreTake(job->done, pdMS_TO_TICKS(timeoutMs)) != pdTRUE) {
+    // ヘルパータスクを残したまま先に進むと、共有バスへのアクセスが後続の処理と
+    // 重なり、成功しても結果が使われない。遅れても終わるまで待つ
+    LOG_E(LOG_TAG_MAIN, "Boot stage %s did not finish within %u ms, waiting for it",
+          getStageName(stage), (unsigned)timeoutMs);
+    xSemaphoreTake(job->done, portMAX_DELAY);
+    LOG_W(LOG_TAG_MAIN, "Boot stage %s finished late after %u ms: %s", getStageName(stage),
+          (unsigned)getStageMs(stage), job->result ? "ok" : "failed");
+  }
+  
+  // 再度待たれた場合も同じ結果を返せるようにする
+  xSemaphoreGive(job->done);
+  return job->result;
+}
+
+void BootSequencer::taskEntry(void* param) {
+  ParallelJob* job = static_cast<ParallelJob*>(param);
+  
+  bool result = job->function(job->arg);
+  job->owner->endStage(job->stage, result);
+  job->result = result;
+  xSemaphoreGive(job->done);
+  
+  vTaskDelete(nullptr);
+}
+
+void BootSequencer::finish() {
+  _finishUs = esp_timer_get_time();
+  logSummary();
+}
+
+void BootSequencer::noteFirstFix() {
+  if (_firstFixUs != 0) {
+    return;
+  }
+  _firstFixUs = esp_timer_get_time();
+  LOG_I(LOG_TAG_MAIN, "First GPS fix %lu ms after power-on, switching from stored position",
+        (unsigned long)getFirstFixMs());
+}
+
+bool BootSequencer::isStageOk(BootStage stage) const {
+  return _stages[stage].endUs != 0 && _stages[stage].ok;
+}
+
+uint32_t BootSequencer::getStageMs(BootStage stage) const {
+  const StageRecord& record = _stages[stage];
+  if (record.startUs == 0 || record.endUs < record.startUs) {
+    return 0;
+  }
+  return (uint32_t)((record.endUs - record.startUs) / 1000);
+}
+
+uint32_t BootSequencer::getTotalMs() const {
+  return (uint32_t)(_finishUs / 1000);
+}
+
+uint32_t BootSequencer::getFirstFixMs() const {
+  return (uint32_t)(_firstFixUs / 1000);
+}
+
+const char* BootSequencer::getStageName(BootStage stage) {
+  switch (stage) {
+    case BOOT_STAGE_HARDWARE:    return "hardware";
+    case BOOT_STAGE_SPLASH:      return "splash";
+    case BOOT_STAGE_IMU:         return "imu";
+    case BOOT_STAGE_GPS:         return "gps";
+    case BOOT_STAGE_STORAGE:     return "storage";
+    case BOOT_STAGE_DISPLAY:     return "display";
+    case BOOT_STAGE_SENSOR_TASK: return "sensors";
+    default:                     return "?";
+  }
+}
+
+void BootSequencer::logSummary() const {
+  // setup()に入るまで（ブートローダーとArduinoの初期化）の時間も合わせて出す
+  LOG_I(LOG_TAG_MAIN, "Boot complete in %lu ms (setup entered at %lu ms)",
+        (unsigned long)getTotalMs(), (unsigned long)(_stages[BOOT_STAGE_HARDWARE].startUs / 1000));
+  
+  for (int i = 0; i < BOOT_STAGE_COUNT; i++) {
+    BootStage stage = (BootStage)i;
+    if (_stages[i].startUs == 0) {
+      continue;
+    }
+    LOG_I(LOG_TAG_MAIN, "  %-8s %5lu ms%s%s", getStageName(stage),
+          (unsigned long)getStageMs(stage),
+          _stages[i].parallel ? " (parallel)" : "",
+          isStageOk(stage) ? "" : (_stages[i].endUs == 0 ? " PENDING" : " FAILED"));
+  }
+}
@@ -0,0 +1,105 @@
+/*
+ * BootSequencer.h
+ * 
+ * Boot stage timing and parallel bring-up for the Polaris Navigator
+ * Runs slow, independent initialization (IMU) on a helper task while
+ * setup() continues with GPS, storage and display
+ * 
+ * 各ステージの開始・終了時刻をesp_timerで記録し、起動時間の内訳を
+ * シリアルとシステム情報画面で確認できるようにする。
+ * 起動時間は電源投入（esp_timer = 0）から数える。
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef BOOT_SEQUENCER_H
+#define BOOT_SEQUENCER_H
+
+#include <Arduino.h>
+#include <esp_timer.h>
+
+// Helper task configuration
+#define BOOT_TASK_CORE        0     // loopTask（コア1）と並列に動かす
+#define BOOT_TASK_PRIORITY    2     // loopTask(1)より高く、センサータスク(5)より低い
+#define BOOT_TASK_STACK_SIZE  4096  // スタックサイズ（バイト）
+
+// Boot stages (in the order setup() runs them)
+enum BootStage {
+  BOOT_STAGE_HARDWARE,     // M5.begin and display settings
+  BOOT_STAGE_SPLASH,       // Splash screen
+  BOOT_STAGE_IMU,          // IMU detection (helper task)
+  BOOT_STAGE_GPS,          // UART, parse task and receiver configuration
+  BOOT_STAGE_STORAGE,      // NVS load and managers
+  BOOT_STAGE_DISPLAY,      // Display objects
+  BOOT_STAGE_SENSOR_TASK,  // Sensor task start
+  BOOT_STAGE_COUNT
+};
+
+// Function run on the helper task (returns the stage result)
+typedef bool (*BootStageFunction)(void* arg);
+
+class BootSequencer {
+public:
+  // Constructor
+  BootSequencer();
+  
+  // Time a stage run on the calling task
+  void startStage(BootStage stage);
+  void endStage(BootStage stage, bool ok = true);
+  
+  // Run a stage on the helper task; setup() continues immediately
+  // タスクを作れない場合はその場で実行する
+  void startParallel(BootStage stage, BootStageFunction function, void* arg);
+  
+  // Wait for a parallel stage and return its result. After timeoutMs the
+  // overrun is logged and the wait continues until the stage ends, so the
+  // helper task never outlives setup() on the shared bus
+  bool waitParallel(BootStage stage, uint32_t timeoutMs);
+  
+  // Mark the end of setup() and log the breakdown
+  void finish();
+  
+  // Note the first live GPS fix (replaces the stored position)
+  void noteFirstFix();
+  
+  // Results
+  bool isFinished() const { return _finishUs != 0; }
+  bool isStageOk(BootStage stage) const;
+  uint32_t getStageMs(BootStage stage) const;
+  uint32_t getTotalMs() const;      // 電源投入からsetup()終了まで
+  uint32_t getFirstFixMs() const;   // 電源投入から最初の測位まで（未測位なら0）
+  static const char* getStageName(BootStage stage);
+  
+  // Print the per-stage breakdown
+  void logSummary() const;
+
+private:
+  // Per-stage record
+  struct StageRecord {
+    int64_t startUs;
+    int64_t endUs;
+    bool ok;
+    bool parallel;    // ヘルパータスクで実行した
+  };
+  
+  // Helper task job
+  struct ParallelJob {
+    BootSequencer* owner;
+    BootStage stage;
+    BootStageFunction function;
+    void* arg;
+    SemaphoreHandle_t done;
+    volatile bool result;
+  };
+  
+  // Helper task entry point
+  static void taskEntry(void* param);
+  
+  StageRecord _stages[BOOT_STAGE_COUNT];
+  ParallelJob _jobs[BOOT_STAGE_COUNT];
+  int64_t _finishUs;
+  int64_t _firstFixUs;
+};
+
+#endif // BOOT_SEQUENCER_H
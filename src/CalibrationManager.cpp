@@ -10,17 +10,25 @@
 #include "CalibrationManager.h"
 #include <math.h>
 
+// 保存レコードの大きさの上限
+static_assert(sizeof(CalibrationData) <= PERSIST_MAX_RECORD_SIZE, "CalibrationData does not fit in a record");
+static_assert(sizeof(GyroTempModel) <= PERSIST_MAX_RECORD_SIZE, "GyroTempModel does not fit in a record");
+
 // Constructor
-CalibrationManager::CalibrationManager(BMI270* bmi270, BMM150class* bmm150) {
+CalibrationManager::CalibrationManager(BMI270* bmi270, BMM150class* bmm150, PersistenceStore* store) {
   _bmi270 = bmi270;
   _bmm150 = bmm150;
+  _store = store;
   
   _calibrationState = CAL_IDLE;
   _calibrationStartTime = 0;
   _lastUpdateTime = 0;
   
   // Initialize calibration data
+  memset(&_calibrationData, 0, sizeof(_calibrationData));
+  memset(&_gyroTempModel, 0, sizeof(_gyroTempModel));
   resetCalibration();
+  _gyroTempValid = false;
   
   _sampleCount = 0;
   _requiredSamples = 100; // Number of samples required for calibration
@@ -28,11 +36,17 @@ CalibrationManager::CalibrationManager(BMI270* bmi270, BMM150class* bmm150) {
 
 // Initialize calibration manager
 void CalibrationManager::begin() {
-  // Initialize preferences for storing calibration data
-  _preferences.begin("polaris-nav", false);
-  
-  // Try to load calibration data
-  loadCalibrationData();
+  // Try to load calibration data (the store has already read it at boot)
+  if (!loadCalibrationData() && loadLegacyCalibrationData()) {
+    // 旧形式（キーごとの保存）から移行し、古い名前空間を消す
+    saveCalibrationData();
+    _store->flush();
+    Preferences legacy;
+    legacy.begin("polaris-nav", false);
+    legacy.clear();
+    legacy.end();
+    Serial.println("Migrated calibration data to the persistence store");
+  }
 }
 
 // Start calibration procedure (both accel and mag)
@@ -57,11 +71,8 @@ void CalibrationManager::startCalibration(bool accel, bool mag) {
   } else if (mag) {
     _calibrationState = CAL_MAG_START;
     
-    // Initialize min/max values for magnetometer
-    for (int i = 0; i < 3; i++) {
-      _magMin[i] = 1000.0;
-      _magMax[i] = -1000.0;
-    }
+    // Discard the ellipsoid statistics
+    _magCalibrator.reset();
   } else {
     // Nothing to calibrate
     _calibrationState = CAL_IDLE;
@@ -93,7 +104,7 @@ void CalibrationManager::updateCalibration() {
       _calibrationState = CAL_ACCEL_COLLECT;
       Serial.println("Collecting accelerometer data...");
       break;
-      
+    
     case CAL_ACCEL_COLLECT:
       // Collect accelerometer sample
       collectAccelSample();
@@ -114,30 +125,27 @@ void CalibrationManager::updateCalibration() {
         _sampleCount = 0;
       }
       break;
-      
+    
     case CAL_ACCEL_COMPLETE:
       // Transition to magnetometer calibration
       _calibrationState = CAL_MAG_START;
       
-      // Initialize min/max values for magnetometer
-      for (int i = 0; i < 3; i++) {
-        _magMin[i] = 1000.0;
-        _magMax[i] = -1000.0;
-      }
+      // Discard the ellipsoid statistics
+      _magCalibrator.reset();
       break;
-      
+    
     case CAL_MAG_START:
       // Transition to data collection
       _calibrationState = CAL_MAG_COLLECT;
       Serial.println("Collecting magnetometer data...");
       break;
-      
+    
     case CAL_MAG_COLLECT:
       // Collect magnetometer sample
       collectMagSample();
       
-      // Check if we have enough samples
-      if (_sampleCount >= _requiredSamples) {
+      // Check if the ellipsoid fit has been accepted
+      if (!_magCalibrator.isLearning()) {
         // Calculate calibration parameters
         calculateMagCalibration();
         
@@ -149,7 +157,7 @@ void CalibrationManager::updateCalibration() {
         Serial.println("Magnetometer calibration complete");
       }
       break;
-      
+    
     case CAL_MAG_COMPLETE:
       // All calibration complete
       _calibrationState = CAL_COMPLETE;
@@ -194,43 +202,43 @@ CalibrationStatus CalibrationManager::getCalibrationStatus() {
       status.progress = 0.0;
       status.isComplete = false;
       break;
-      
+    
     case CAL_ACCEL_START:
       status.stage = 0;
       status.progress = 0.0;
       status.isComplete = false;
       break;
-      
+    
     case CAL_ACCEL_COLLECT:
       status.stage = 0;
       status.progress = (float)_sampleCount / _requiredSamples;
       status.isComplete = false;
       break;
-      
+    
     case CAL_ACCEL_COMPLETE:
       status.stage = 1;
       status.progress = 0.0;
       status.isComplete = false;
       break;
-      
+    
     case CAL_MAG_START:
       status.stage = 1;
       status.progress = 0.0;
       status.isComplete = false;
       break;
-      
+    
     case CAL_MAG_COLLECT:
       status.stage = 1;
-      status.progress = (float)_sampleCount / _requiredSamples;
+      status.progress = _magCalibrator.getProgress();
       status.isComplete = false;
       break;
-      
+    
     case CAL_MAG_COMPLETE:
       status.stage = 2;
       status.progress = 1.0;
       status.isComplete = false;
       break;
-      
+    
     case CAL_COMPLETE:
       status.stage = 3;
       status.progress = 1.0;
@@ -248,94 +256,102 @@ CalibrationData CalibrationManager::getCalibrationData() {
 
 // Load calibration data from storage
 bool CalibrationManager::loadCalibrationData() {
+  _gyroTempValid = _store->attach(PERSIST_GYRO_MODEL, &_gyroTempModel, sizeof(_gyroTempModel),
+                                  GYRO_TC_MODEL_VERSION);
+  if (!_store->attach(PERSIST_CALIBRATION, &_calibrationData, sizeof(_calibrationData),
+                      CALIBRATION_RECORD_VERSION)) {
+    return _gyroTempValid;
+  }
+  
+  Serial.println("Loaded calibration data from storage");
+  return true;
+}
+
+// Load calibration data saved by older firmware (one key per field)
+bool CalibrationManager::loadLegacyCalibrationData() {
+  Preferences preferences;
+  if (!preferences.begin("polaris-nav", true)) {
+    return false;
+  }
+  
   // Check if calibration data exists
-  if (!_preferences.isKey("cal_valid")) {
+  if (!preferences.isKey("cal_valid")) {
+    preferences.end();
     return false;
   }
   
   // Load calibration status
-  bool isValid = _preferences.getBool("cal_valid", false);
+  bool isValid = preferences.getBool("cal_valid", false);
   if (!isValid) {
+    preferences.end();
     return false;
   }
   
   // Load accelerometer calibration
-  _calibrationData.accelCalibrated = _preferences.getBool("accel_cal", false);
+  _calibrationData.accelCalibrated = preferences.getBool("accel_cal", false);
   if (_calibrationData.accelCalibrated) {
     // Load accelerometer offsets
-    _calibrationData.accelOffset[0] = _preferences.getFloat("accel_ox", 0.0);
-    _calibrationData.accelOffset[1] = _preferences.getFloat("accel_oy", 0.0);
-    _calibrationData.accelOffset[2] = _preferences.getFloat("accel_oz", 0.0);
+    _calibrationData.accelOffset[0] = preferences.getFloat("accel_ox", 0.0);
+    _calibrationData.accelOffset[1] = preferences.getFloat("accel_oy", 0.0);
+    _calibrationData.accelOffset[2] = preferences.getFloat("accel_oz", 0.0);
     
     // Load accelerometer scale factors
-    _calibrationData.accelScale[0] = _preferences.getFloat("accel_sx", 1.0);
-    _calibrationData.accelScale[1] = _preferences.getFloat("accel_sy", 1.0);
-    _calibrationData.accelScale[2] = _preferences.getFloat("accel_sz", 1.0);
+    _calibrationData.accelScale[0] = preferences.getFloat("accel_sx", 1.0);
+    _calibrationData.accelScale[1] = preferences.getFloat("accel_sy", 1.0);
+    _calibrationData.accelScale[2] = preferences.getFloat("accel_sz", 1.0);
   }
   
   // Load magnetometer calibration
-  _calibrationData.magCalibrated = _preferences.getBool("mag_cal", false);
+  _calibrationData.magCalibrated = preferences.getBool("mag_cal", false);
   if (_calibrationData.magCalibrated) {
     // Load magnetometer offsets
-    _calibrationData.magOffset[0] = _preferences.getFloat("mag_ox", 0.0);
-    _calibrationData.magOffset[1] = _preferences.getFloat("mag_oy", 0.0);
-    _calibrationData.magOffset[2] = _preferences.getFloat("mag_oz", 0.0);
+    _calibrationData.magOffset[0] = preferences.getFloat("mag_ox", 0.0);
+    _calibrationData.magOffset[1] = preferences.getFloat("mag_oy", 0.0);
+    _calibrationData.magOffset[2] = preferences.getFloat("mag_oz", 0.0);
     
-    // Load magnetometer scale factors
-    _calibrationData.magScale[0] = _preferences.getFloat("mag_sx", 1.0);
-    _calibrationData.magScale[1] = _preferences.getFloat("mag_sy", 1.0);
-    _calibrationData.magScale[2] = _preferences.getFloat("mag_sz", 1.0);
+    // Load soft-iron matrix and field strength
+    _calibrationData.magFieldStrength = preferences.getFloat("mag_f", 0.0);
+    if (preferences.getBytesLength("mag_si") == sizeof(_calibrationData.magSoftIron)) {
+      preferences.getBytes("mag_si", _calibrationData.magSoftIron,
+                            sizeof(_calibrationData.magSoftIron));
+    } else {
+      // 旧形式（BMM150の生値の軸ごとのmin/max）は単位が異なるため使わない
+      Serial.println("Discarding legacy magnetometer calibration");
+      _calibrationData.magCalibrated = false;
+      for (int i = 0; i < 3; i++) {
+        _calibrationData.magOffset[i] = 0.0;
+      }
+    }
   }
   
+  // Load gyro temperature model
+  _gyroTempValid = preferences.getBytesLength("gyro_tc") == sizeof(_gyroTempModel) &&
+                   preferences.getBytes("gyro_tc", &_gyroTempModel, sizeof(_gyroTempModel)) ==
+                     sizeof(_gyroTempModel) &&
+                   _gyroTempModel.version == GYRO_TC_MODEL_VERSION;
+  
   // Load timestamp
-  _calibrationData.timestamp = _preferences.getULong("cal_time", 0);
+  _calibrationData.timestamp = preferences.getULong("cal_time", 0);
   
-  Serial.println("Loaded calibration data from storage");
+  preferences.end();
+  Serial.println("Loaded legacy calibration data");
   return true;
 }
 
 // Save calibration data to storage
+// 書き込みはPersistenceStoreが遅延してまとめて行う
 bool CalibrationManager::saveCalibrationData() {
-  // Check if calibration is valid
-  if (!isCalibrated()) {
+  // Check if there is anything to save (the sensors are calibrated separately)
+  if (!_calibrationData.accelCalibrated && !_calibrationData.magCalibrated && !_gyroTempValid) {
     return false;
   }
   
-  // Save calibration status
-  _preferences.putBool("cal_valid", true);
-  
-  // Save accelerometer calibration
-  _preferences.putBool("accel_cal", _calibrationData.accelCalibrated);
-  if (_calibrationData.accelCalibrated) {
-    // Save accelerometer offsets
-    _preferences.putFloat("accel_ox", _calibrationData.accelOffset[0]);
-    _preferences.putFloat("accel_oy", _calibrationData.accelOffset[1]);
-    _preferences.putFloat("accel_oz", _calibrationData.accelOffset[2]);
-    
-    // Save accelerometer scale factors
-    _preferences.putFloat("accel_sx", _calibrationData.accelScale[0]);
-    _preferences.putFloat("accel_sy", _calibrationData.accelScale[1]);
-    _preferences.putFloat("accel_sz", _calibrationData.accelScale[2]);
+  if (_calibrationData.accelCalibrated || _calibrationData.magCalibrated) {
+    _store->requestSave(PERSIST_CALIBRATION);
   }
-  
-  // Save magnetometer calibration
-  _preferences.putBool("mag_cal", _calibrationData.magCalibrated);
-  if (_calibrationData.magCalibrated) {
-    // Save magnetometer offsets
-    _preferences.putFloat("mag_ox", _calibrationData.magOffset[0]);
-    _preferences.putFloat("mag_oy", _calibrationData.magOffset[1]);
-    _preferences.putFloat("mag_oz", _calibrationData.magOffset[2]);
-    
-    // Save magnetometer scale factors
-    _preferences.putFloat("mag_sx", _calibrationData.magScale[0]);
-    _preferences.putFloat("mag_sy", _calibrationData.magScale[1]);
-    _preferences.putFloat("mag_sz", _calibrationData.magScale[2]);
+  if (_gyroTempValid) {
+    _store->requestSave(PERSIST_GYRO_MODEL);
   }
-  
-  // Save timestamp
-  _preferences.putULong("cal_time", _calibrationData.timestamp);
-  
-  Serial.println("Saved calibration data to storage");
   return true;
 }
 
@@ -347,11 +363,8 @@ void CalibrationManager::applyCalibration() {
     Serial.println("Applied accelerometer calibration");
   }
   
-  // Apply magnetometer calibration
-  if (_calibrationData.magCalibrated) {
-    // TODO: Apply magnetometer calibration to BMM150
-    Serial.println("Applied magnetometer calibration");
-  }
+  // Magnetometer calibration is applied by the sensor task
+  // (SensorTask::setMagCalibration() with getMagCalibration())
 }
 
 // Reset calibration data
@@ -366,8 +379,11 @@ void CalibrationManager::resetCalibration() {
   // Reset magnetometer calibration
   for (int i = 0; i < 3; i++) {
     _calibrationData.magOffset[i] = 0.0;
-    _calibrationData.magScale[i] = 1.0;
+    for (int j = 0; j < 3; j++) {
+      _calibrationData.magSoftIron[i][j] = (i == j) ? 1.0 : 0.0;
+    }
   }
+  _calibrationData.magFieldStrength = 0.0;
   _calibrationData.magCalibrated = false;
   
   // Reset timestamp
@@ -389,6 +405,56 @@ bool CalibrationManager::isMagCalibrated() {
   return _calibrationData.magCalibrated;
 }
 
+// Store a magnetometer calibration
+void CalibrationManager::setMagCalibration(const MagCalibration& calibration) {
+  if (!calibration.valid) {
+    return;
+  }
+  
+  for (int i = 0; i < 3; i++) {
+    _calibrationData.magOffset[i] = calibration.offset[i];
+    for (int j = 0; j < 3; j++) {
+      _calibrationData.magSoftIron[i][j] = calibration.softIron[i][j];
+    }
+  }
+  _calibrationData.magFieldStrength = calibration.fieldStrength;
+  _calibrationData.magCalibrated = true;
+  _calibrationData.timestamp = millis();
+}
+
+// Store the gyro temperature model
+void CalibrationManager::setGyroTempModel(const GyroTempModel& model) {
+  _gyroTempModel = model;
+  _gyroTempValid = true;
+}
+
+// Get the gyro temperature model
+bool CalibrationManager::getGyroTempModel(GyroTempModel* model) {
+  if (!_gyroTempValid) {
+    return false;
+  }
+  *model = _gyroTempModel;
+  return true;
+}
+
+// Get the magnetometer calibration
+bool CalibrationManager::getMagCalibration(MagCalibration* calibration) {
+  if (!_calibrationData.magCalibrated) {
+    return false;
+  }
+  
+  memset(calibration, 0, sizeof(*calibration));
+  for (int i = 0; i < 3; i++) {
+    calibration->offset[i] = _calibrationData.magOffset[i];
+    for (int j = 0; j < 3; j++) {
+      calibration->softIron[i][j] = _calibrationData.magSoftIron[i][j];
+    }
+  }
+  calibration->fieldStrength = _calibrationData.magFieldStrength;
+  calibration->valid = true;
+  return true;
+}
+
 // Helper methods
 
 // Collect accelerometer sample
@@ -413,21 +479,16 @@ void CalibrationManager::collectAccelSample() {
 }
 
 // Collect magnetometer sample
+// センサータスクの実行中は較正をSensorTask側で行う（I2Cの読み出しが競合するため）
 void CalibrationManager::collectMagSample() {
-  // Get magnetometer data
-  _bmm150->readMagnetometer();
-  float magX = _bmm150->mag_x;
-  float magY = _bmm150->mag_y;
-  float magZ = _bmm150->mag_z;
-  
-  // Update min/max values
-  _magMin[0] = min(_magMin[0], magX);
-  _magMin[1] = min(_magMin[1], magY);
-  _magMin[2] = min(_magMin[2], magZ);
+  // Get magnetometer data (uT, same source as the AHRS)
+  float mag[3];
+  if (!M5.Imu.getMag(&mag[0], &mag[1], &mag[2])) {
+    return;
+  }
   
-  _magMax[0] = max(_magMax[0], magX);
-  _magMax[1] = max(_magMax[1], magY);
-  _magMax[2] = max(_magMax[2], magZ);
+  // Update the ellipsoid statistics
+  _magCalibrator.addSample(mag);
   
   // Increment sample count
   _sampleCount++;
@@ -453,18 +514,6 @@ void CalibrationManager::calculateAccelCalibration() {
 
 // Calculate magnetometer calibration
 void CalibrationManager::calculateMagCalibration() {
-  // Calculate offsets (center point)
-  for (int i = 0; i < 3; i++) {
-    _calibrationData.magOffset[i] = (_magMin[i] + _magMax[i]) / 2.0;
-  }
-  
-  // Calculate scale factors
-  for (int i = 0; i < 3; i++) {
-    float range = _magMax[i] - _magMin[i];
-    if (range > 0.01) {
-      _calibrationData.magScale[i] = 2.0 / range; // Scale to +/- 1
-    } else {
-      _calibrationData.magScale[i] = 1.0; // Default if range is too small
-    }
-  }
+  // Copy the accepted ellipsoid fit
+  setMagCalibration(_magCalibrator.getCalibration());
 }
@@ -13,8 +13,11 @@
 
 #include <M5Unified.h>
 #include <Preferences.h>
+#include "PersistenceStore.h"
 #include "BMI270.h"
 #include "BMM150class.h"
+#include "MagCalibrator.h"
+#include "GyroBiasEstimator.h"
 
 // Calibration states
 enum CalibrationState {
@@ -35,15 +38,19 @@ struct CalibrationStatus {
   bool isComplete;      // Whether calibration is complete
 };
 
+// Layout version of CalibrationData in the persistence store
+#define CALIBRATION_RECORD_VERSION 1
+
 // Calibration data structure
 struct CalibrationData {
   // Accelerometer calibration
   float accelOffset[3];    // X, Y, Z offsets
   float accelScale[3];     // X, Y, Z scale factors
   
-  // Magnetometer calibration
-  float magOffset[3];      // X, Y, Z offsets
-  float magScale[3];       // X, Y, Z scale factors
+  // Magnetometer calibration (uT, corrected = magSoftIron * (raw - magOffset))
+  float magOffset[3];      // Hard-iron offset
+  float magSoftIron[3][3]; // Soft-iron matrix
+  float magFieldStrength;  // Fitted field strength (uT)
   
   // Calibration status
   bool accelCalibrated;
@@ -56,7 +63,7 @@ struct CalibrationData {
 class CalibrationManager {
 public:
   // Constructor
-  CalibrationManager(BMI270* bmi270, BMM150class* bmm150);
+  CalibrationManager(BMI270* bmi270, BMM150class* bmm150, PersistenceStore* store);
   
   // Initialize calibration manager
   void begin();
@@ -88,7 +95,7 @@ public:
   // Load calibration data from storage
   bool loadCalibrationData();
   
-  // Save calibration data to storage
+  // Save calibration data to storage (debounced by the persistence store)
   bool saveCalibrationData();
   
   // Apply calibration to sensors
@@ -106,6 +113,16 @@ public:
   // Check if magnetometer is calibrated
   bool isMagCalibrated();
   
+  // Magnetometer calibration in the MagCalibrator format
+  // (the sensor task refines it in the background; store it here to persist)
+  void setMagCalibration(const MagCalibration& calibration);
+  bool getMagCalibration(MagCalibration* calibration);
+  
+  // Gyro bias-vs-temperature model (learned by the sensor task while still)
+  void setGyroTempModel(const GyroTempModel& model);
+  bool getGyroTempModel(GyroTempModel* model);
+  bool isGyroCalibrated() { return _gyroTempValid; }
+
 private:
   // References to sensor objects
   BMI270* _bmi270;
@@ -118,19 +135,22 @@ private:
   
   // Calibration data
   CalibrationData _calibrationData;
+  GyroTempModel _gyroTempModel;
+  bool _gyroTempValid;
   
   // Data collection for calibration
   float _accelMin[3];
   float _accelMax[3];
-  float _magMin[3];
-  float _magMax[3];
+  // 磁力計は楕円体フィットの統計のみ保持する（センサータスク停止中の較正用）
+  MagCalibrator _magCalibrator;
   int _sampleCount;
   int _requiredSamples;
   
   // Storage for calibration data
-  Preferences _preferences;
+  PersistenceStore* _store;
   
   // Helper methods
+  bool loadLegacyCalibrationData();
   void collectAccelSample();
   void collectMagSample();
   void calculateAccelCalibration();
@@ -9,6 +9,7 @@
 
 #include "CelestialOverlay.h"
 #include <math.h>
+#include "pole_star_table.h"
 
 // Constructor
 CelestialOverlay::CelestialOverlay() {
@@ -20,6 +21,7 @@ CelestialOverlay::CelestialOverlay() {
   _moonPhase = 0.0;
   _polarisAzimuth = 0.0;
   _polarisAltitude = 0.0;
+  _polarisHourAngle = 0.0;
   
   _latitude = 0.0;
   _longitude = 0.0;
@@ -29,16 +31,13 @@ CelestialOverlay::CelestialOverlay() {
   _hour = 0;
   _minute = 0;
   _second = 0;
+  _jd = 0.0;
   
-  _sunriseHour = 6;
-  _sunriseMinute = 0;
-  _sunsetHour = 18;
-  _sunsetMinute = 0;
-  
-  _moonriseHour = 0;
-  _moonriseMinute = 0;
-  _moonsetHour = 0;
-  _moonsetMinute = 0;
+  _sunriseJd = _sunsetJd = 0.0;
+  _moonriseJd = _moonsetJd = 0.0;
+  _eventsValidUntil = 0.0;
+  _eventLatitude = 0.0;
+  _eventLongitude = 0.0;
 }
 
 // Initialize overlay
@@ -59,12 +58,23 @@ void CelestialOverlay::updateCelestialData(float lat, float lon, int year, int m
   _minute = minute;
   _second = second;
   
-  // Calculate positions
-  calculateSunPosition();
-  calculateMoonPosition();
-  calculatePolarisPosition();
-  calculateSunriseSunset();
-  calculateMoonriseMoonset();
+  update(lat, lon, getJulianDateTime(year, month, day, hour, minute, second));
+}
+
+// Update from a UTC Julian date
+void CelestialOverlay::update(float lat, float lon, double jd) {
+  _latitude = lat;
+  _longitude = lon;
+  _jd = jd;
+  
+  calculatePositions();
+  
+  // 出入りの探索は次の現象が過ぎたとき、または位置が変わったときだけ行う
+  bool moved = fabsf(lat - _eventLatitude) > CELESTIAL_EVENT_LOCATION_EPSILON ||
+               fabsf(lon - _eventLongitude) > CELESTIAL_EVENT_LOCATION_EPSILON;
+  if (moved || jd >= _eventsValidUntil) {
+    searchEvents();
+  }
 }
 
 // Get sun position
@@ -114,71 +124,31 @@ bool CelestialOverlay::isMoonVisible() {
 // Get celestial event times (sunrise, sunset, moonrise, moonset)
 void CelestialOverlay::getSunriseSunsetTime(int* sunriseHour, int* sunriseMinute, 
                                           int* sunsetHour, int* sunsetMinute) {
-  *sunriseHour = _sunriseHour;
-  *sunriseMinute = _sunriseMinute;
-  *sunsetHour = _sunsetHour;
-  *sunsetMinute = _sunsetMinute;
+  eventToTime(_sunriseJd, sunriseHour, sunriseMinute);
+  eventToTime(_sunsetJd, sunsetHour, sunsetMinute);
 }
 
 void CelestialOverlay::getMoonriseMoonsetTime(int* moonriseHour, int* moonriseMinute, 
                                             int* moonsetHour, int* moonsetMinute) {
-  *moonriseHour = _moonriseHour;
-  *moonriseMinute = _moonriseMinute;
-  *moonsetHour = _moonsetHour;
-  *moonsetMinute = _moonsetMinute;
+  eventToTime(_moonriseJd, moonriseHour, moonriseMinute);
+  eventToTime(_moonsetJd, moonsetHour, moonsetMinute);
 }
 
 // Get time until next celestial event in minutes
 int CelestialOverlay::getMinutesToNextSunrise() {
-  int currentMinutes = _hour * 60 + _minute;
-  int sunriseMinutes = _sunriseHour * 60 + _sunriseMinute;
-  
-  if (currentMinutes >= sunriseMinutes) {
-    // Sunrise has already occurred today, calculate for tomorrow
-    return (24 * 60 - currentMinutes) + sunriseMinutes;
-  } else {
-    // Sunrise is later today
-    return sunriseMinutes - currentMinutes;
-  }
+  return minutesUntil(_sunriseJd);
 }
 
 int CelestialOverlay::getMinutesToNextSunset() {
-  int currentMinutes = _hour * 60 + _minute;
-  int sunsetMinutes = _sunsetHour * 60 + _sunsetMinute;
-  
-  if (currentMinutes >= sunsetMinutes) {
-    // Sunset has already occurred today, calculate for tomorrow
-    return (24 * 60 - currentMinutes) + sunsetMinutes;
-  } else {
-    // Sunset is later today
-    return sunsetMinutes - currentMinutes;
-  }
+  return minutesUntil(_sunsetJd);
 }
 
 int CelestialOverlay::getMinutesToNextMoonrise() {
-  int currentMinutes = _hour * 60 + _minute;
-  int moonriseMinutes = _moonriseHour * 60 + _moonriseMinute;
-  
-  if (currentMinutes >= moonriseMinutes) {
-    // Moonrise has already occurred today, calculate for tomorrow
-    return (24 * 60 - currentMinutes) + moonriseMinutes;
-  } else {
-    // Moonrise is later today
-    return moonriseMinutes - currentMinutes;
-  }
+  return minutesUntil(_moonriseJd);
 }
 
 int CelestialOverlay::getMinutesToNextMoonset() {
-  int currentMinutes = _hour * 60 + _minute;
-  int moonsetMinutes = _moonsetHour * 60 + _moonsetMinute;
-  
-  if (currentMinutes >= moonsetMinutes) {
-    // Moonset has already occurred today, calculate for tomorrow
-    return (24 * 60 - currentMinutes) + moonsetMinutes;
-  } else {
-    // Moonset is later today
-    return moonsetMinutes - currentMinutes;
-  }
+  return minutesUntil(_moonsetJd);
 }
 
 // Get Polaris position
@@ -187,6 +157,23 @@ void CelestialOverlay::getPolarisPosition(float* azimuth, float* altitude) {
   *altitude = _polarisAltitude;
 }
 
+// Polaris hour angle in hours
+float CelestialOverlay::getPolarisHourAngle() {
+  return _polarisHourAngle / 15.0f;
+}
+
+// Print an event time as H:MM ("--:--" if none)
+static void printEventTime(int hour, int minute) {
+  if (hour < 0) {
+    Serial.print("--:--");
+    return;
+  }
+  Serial.print(hour);
+  Serial.print(":");
+  if (minute < 10) Serial.print("0");
+  Serial.print(minute);
+}
+
 // Debug output
 void CelestialOverlay::printCelestialData() {
   Serial.println("Celestial Data:");
@@ -239,61 +226,83 @@ void CelestialOverlay::printCelestialData() {
   Serial.print(", Alt=");
   Serial.println(_polarisAltitude);
   
+  int riseHour, riseMinute, setHour, setMinute;
+  getSunriseSunsetTime(&riseHour, &riseMinute, &setHour, &setMinute);
   Serial.print("Sunrise: ");
-  Serial.print(_sunriseHour);
-  Serial.print(":");
-  if (_sunriseMinute < 10) Serial.print("0");
-  Serial.print(_sunriseMinute);
+  printEventTime(riseHour, riseMinute);
   Serial.print(", Sunset: ");
-  Serial.print(_sunsetHour);
-  Serial.print(":");
-  if (_sunsetMinute < 10) Serial.print("0");
-  Serial.println(_sunsetMinute);
+  printEventTime(setHour, setMinute);
+  Serial.println(" (UTC)");
   
+  getMoonriseMoonsetTime(&riseHour, &riseMinute, &setHour, &setMinute);
   Serial.print("Moonrise: ");
-  Serial.print(_moonriseHour);
-  Serial.print(":");
-  if (_moonriseMinute < 10) Serial.print("0");
-  Serial.print(_moonriseMinute);
+  printEventTime(riseHour, riseMinute);
   Serial.print(", Moonset: ");
-  Serial.print(_moonsetHour);
-  Serial.print(":");
-  if (_moonsetMinute < 10) Serial.print("0");
-  Serial.println(_moonsetMinute);
+  printEventTime(setHour, setMinute);
+  Serial.println(" (UTC)");
 }
 
 // Private methods
 
-// Calculate sun position
-void CelestialOverlay::calculateSunPosition() {
-  // Use celestial_math library to calculate sun position
-  ::calculateSunPosition(_latitude, _longitude, _year, _month, _day, _hour, _minute, _second, &_sunAzimuth, &_sunAltitude);
-}
-
-// Calculate moon position
-void CelestialOverlay::calculateMoonPosition() {
-  // Use celestial_math library to calculate moon position
-  float phase;
-  ::calculateMoonPosition(_latitude, _longitude, _year, _month, _day, _hour, _minute, _second, &_moonAzimuth, &_moonAltitude, &phase);
-  _moonPhase = phase;
+// Calculate sun, moon and Polaris positions for _jd
+void CelestialOverlay::calculatePositions() {
+  // 1サンプルのトラックとして計算する（出入りの探索と同じ計算経路）
+  calculateTrack(CELESTIAL_SUN, _latitude, _longitude, _jd, 0.0, 1, &_sunAzimuth, &_sunAltitude);
+  calculateTrack(CELESTIAL_MOON, _latitude, _longitude, _jd, 0.0, 1, &_moonAzimuth, &_moonAltitude);
+  
+  double ra, dec;
+  calculateMoonEquatorial(_jd, &ra, &dec, &_moonPhase);
+  
+  // 北極星の時角（恒星時 - 視位置の赤経）
+  getPoleStarPlace(POLE_STAR_POLARIS, _jd, &ra, &dec);
+  double hourAngle = fmod(getSiderealTime(_jd, _longitude) - ra, 360.0);
+  if (hourAngle < 0) hourAngle += 360.0;
+  _polarisHourAngle = (float)hourAngle;
+  ::calculatePolarisPosition(_latitude, hourAngle, dec, &_polarisAzimuth, &_polarisAltitude);
 }
 
-// Calculate Polaris position
-void CelestialOverlay::calculatePolarisPosition() {
-  // Use celestial_math library to calculate Polaris position
-  ::calculatePolePosition(_latitude, _longitude, &_polarisAzimuth, &_polarisAltitude);
+// Search the next rise/set events of the Sun and Moon
+void CelestialOverlay::searchEvents() {
+  findRiseSet(CELESTIAL_SUN, _latitude, _longitude, _jd, CELESTIAL_EVENT_SPAN_DAYS,
+              &_sunriseJd, &_sunsetJd);
+  findRiseSet(CELESTIAL_MOON, _latitude, _longitude, _jd, CELESTIAL_EVENT_SPAN_DAYS,
+              &_moonriseJd, &_moonsetJd);
+  _eventLatitude = _latitude;
+  _eventLongitude = _longitude;
+  
+  // 最も早い現象が過ぎたら探し直す
+  _eventsValidUntil = _jd + CELESTIAL_EVENT_RECHECK_DAYS;
+  double events[4] = { _sunriseJd, _sunsetJd, _moonriseJd, _moonsetJd };
+  for (int i = 0; i < 4; i++) {
+    if (events[i] != 0.0 && events[i] < _eventsValidUntil) {
+      _eventsValidUntil = events[i];
+    }
+  }
 }
 
-// Calculate sunrise and sunset times
-void CelestialOverlay::calculateSunriseSunset() {
-  // Use celestial_math library to calculate sunrise and sunset
-  ::calculateSunriseSunset(_latitude, _longitude, _year, _month, _day, &_sunriseHour, &_sunriseMinute, &_sunsetHour, &_sunsetMinute);
+// Convert an event to a UTC hour/minute
+void CelestialOverlay::eventToTime(double eventJd, int* hour, int* minute) {
+  if (eventJd == 0.0) {
+    *hour = -1;
+    *minute = 0;
+    return;
+  }
+  
+  // ユリウス日は正午始まりなので0.5日ずらして時刻を取り出す
+  double dayFraction = eventJd + 0.5 - floor(eventJd + 0.5);
+  int minutes = (int)(dayFraction * 1440.0 + 0.5) % 1440;
+  *hour = minutes / 60;
+  *minute = minutes % 60;
 }
 
-// Calculate moonrise and moonset times
-void CelestialOverlay::calculateMoonriseMoonset() {
-  // Use celestial_math library to calculate moonrise and moonset
-  ::calculateMoonriseMoonset(_latitude, _longitude, _year, _month, _day, &_moonriseHour, &_moonriseMinute, &_moonsetHour, &_moonsetMinute);
+// Minutes from now until an event
+int CelestialOverlay::minutesUntil(double eventJd) {
+  if (eventJd == 0.0) {
+    return -1;
+  }
+  
+  double minutes = (eventJd - _jd) * 1440.0;
+  return minutes > 0.0 ? (int)(minutes + 0.5) : 0;
 }
 
 // Convert phase value to enum
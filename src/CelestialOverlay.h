@@ -4,6 +4,9 @@
  * Celestial overlay display for the Polaris Navigator
  * Handles rendering sun and moon positions on the compass display
  * 
+ * 日の出入り・月の出入りはバッチAPI（findRiseSet()）で探索し、次の現象が
+ * 過ぎるか位置が変わるまで結果を使い回す。
+ * 
  * Created: 2025-03-23
  * GitHub: https://github.com/kennel-org/polaris-navigator
  */
@@ -14,6 +17,11 @@
 #include <M5Unified.h>
 #include "celestial_math.h"
 
+// Rise/set cache
+#define CELESTIAL_EVENT_SPAN_DAYS     1.0          // 次の出入りを探す範囲（日）
+#define CELESTIAL_EVENT_RECHECK_DAYS  (1.0 / 24.0) // 現象がなくてもこの間隔で探し直す
+#define CELESTIAL_EVENT_LOCATION_EPSILON 0.01f     // これ以上移動したら探し直す（度）
+
 // Moon phase definitions
 enum MoonPhase {
   NEW_MOON = 0,
@@ -38,6 +46,9 @@ public:
   void updateCelestialData(float lat, float lon, int year, int month, int day, 
                           int hour, int minute, int second);
   
+  // Update from a UTC Julian date (rise/set searches run only when due)
+  void update(float lat, float lon, double jd);
+  
   // Get sun position
   void getSunPosition(float* azimuth, float* altitude);
   
@@ -47,6 +58,9 @@ public:
   // Get polaris position
   void getPolarisPosition(float* azimuth, float* altitude);
   
+  // Polaris hour angle in hours (0-24, 0 = upper culmination)
+  float getPolarisHourAngle();
+  
   // Get moon phase (0.0 to 1.0, where 0.0 is new moon and 1.0 is full moon)
   float getMoonPhase();
   
@@ -61,13 +75,14 @@ public:
   bool isMoonVisible();
   
   // Get celestial event times (sunrise, sunset, moonrise, moonset)
+  // Next events in UTC; the hour is -1 when none occurs within a day
   void getSunriseSunsetTime(int* sunriseHour, int* sunriseMinute, 
                            int* sunsetHour, int* sunsetMinute);
   
   void getMoonriseMoonsetTime(int* moonriseHour, int* moonriseMinute, 
                              int* moonsetHour, int* moonsetMinute);
   
-  // Get time until next celestial event in minutes
+  // Get time until next celestial event in minutes (-1 if none within a day)
   int getMinutesToNextSunrise();
   int getMinutesToNextSunset();
   int getMinutesToNextMoonrise();
@@ -85,27 +100,31 @@ private:
   float _moonPhase;
   float _polarisAzimuth;
   float _polarisAltitude;
+  float _polarisHourAngle;
   
   // Location and time data
   float _latitude;
   float _longitude;
   int _year, _month, _day;
   int _hour, _minute, _second;
+  double _jd;
   
-  // Sunrise/sunset times
-  int _sunriseHour, _sunriseMinute;
-  int _sunsetHour, _sunsetMinute;
-  
-  // Moonrise/moonset times
-  int _moonriseHour, _moonriseMinute;
-  int _moonsetHour, _moonsetMinute;
+  // Next rise/set events (Julian dates, 0 = none within CELESTIAL_EVENT_SPAN_DAYS)
+  double _sunriseJd, _sunsetJd;
+  double _moonriseJd, _moonsetJd;
+  double _eventsValidUntil;   // この時刻を過ぎたら探し直す
+  float _eventLatitude;
+  float _eventLongitude;
   
   // Helper methods
-  void calculateSunPosition();
-  void calculateMoonPosition();
-  void calculatePolarisPosition();
-  void calculateSunriseSunset();
-  void calculateMoonriseMoonset();
+  void calculatePositions();
+  void searchEvents();
+  
+  // Convert an event to a UTC hour/minute (-1 if none)
+  static void eventToTime(double eventJd, int* hour, int* minute);
+  
+  // Minutes from now until an event (-1 if none)
+  int minutesUntil(double eventJd);
   
   // Convert phase value to enum
   MoonPhase phaseValueToEnum(float phase);
@@ -10,11 +10,30 @@
 #include "CompassDisplay.h"
 #include <math.h>
 #include "AtomicBaseGPS.h" // Include for GPS settings
+#include "Logger.h"
+#include "Profiler.h"
 
 // Constructor
 CompassDisplay::CompassDisplay() {
   _currentColor = COLOR_BLACK;
   _lastAnimationTime = 0;
+  _bmm150 = nullptr;
+  _currentMode = POLAR_ALIGNMENT;
+  
+  // Draw directly to the panel until the canvas is allocated
+  _gfx = &M5.Display;
+  _canvasReady = false;
+  _tilesX = 0;
+  _tilesY = 0;
+  _tilesValid = false;
+  _lastDirtyPixels = 0;
+  
+  _roseReady = false;
+  _roseRadius = 0;
+  _glyphsReady = false;
+  for (int i = 0; i <= TRIG_LUT_SIZE; i++) {
+    _sinTable[i] = 0.0f;
+  }
 }
 
 // Initialize display
@@ -27,23 +46,47 @@ void CompassDisplay::begin() {
   M5.Display.setTextSize(1); // Small font size
   
   // Initialize celestial overlay
-  _celestialOverlay.begin();
+  
+  // Precompute the sine table used for needles and markers
+  for (int i = 0; i <= TRIG_LUT_SIZE; i++) {
+    _sinTable[i] = sinf(i * 360.0f / TRIG_LUT_SIZE * DEG_TO_RAD);
+  }
   
   // Initialize canvas for double buffering
-  _canvas.createSprite(M5.Display.width(), M5.Display.height());
+  // 画面全体のオフスクリーンバッファに描画し、変化したタイルだけを転送する
+  _canvas.setColorDepth(16);
+  _canvasReady = _canvas.createSprite(M5.Display.width(), M5.Display.height()) != nullptr;
+  if (_canvasReady) {
+    _gfx = &_canvas;
+    
+    _tilesX = (M5.Display.width() + DISPLAY_TILE_WIDTH - 1) / DISPLAY_TILE_WIDTH;
+    _tilesY = (M5.Display.height() + DISPLAY_TILE_HEIGHT - 1) / DISPLAY_TILE_HEIGHT;
+    if (_tilesX > DISPLAY_MAX_TILES_X) _tilesX = DISPLAY_MAX_TILES_X;
+    if (_tilesY > DISPLAY_MAX_TILES_Y) _tilesY = DISPLAY_MAX_TILES_Y;
+  } else {
+    // メモリ不足の場合は従来どおりパネルに直接描画する
+    _gfx = &M5.Display;
+    LOG_W(LOG_TAG_DISPLAY, "Canvas allocation failed, drawing directly to the panel");
+  }
+  invalidate();
+  
+  // Pre-render the compass rose and the glyphs used for numeric readouts
+  buildRoseCache(ROSE_RADIUS);
+  buildGlyphCache();
   
   // Note: Welcome screen is now handled by StartupScreen class
 }
 
 // Set pixel color (for RGB LED)
 void CompassDisplay::setPixelColor(uint32_t color) {
+  // Debug output (only when the color changes)
+  if (color != _currentColor) {
+    LOG_D(LOG_TAG_DISPLAY, "LED color set to 0x%06X", (unsigned)color);
+  }
+  
   // Save current color
   _currentColor = color;
   
-  // Debug output
-  Serial.print("LED color set to 0x");
-  Serial.println(color, HEX);
-  
   // Control LED using M5Unified
   // Extract RGB components
   uint8_t r = (color >> 16) & 0xFF;
@@ -56,7 +99,10 @@ void CompassDisplay::setPixelColor(uint32_t color) {
   // Control AtomS3 LED
   if (M5.getBoard() == m5::board_t::board_M5AtomS3) {
     // Draw a small circle to represent LED
-    M5.Display.fillCircle(5, 5, 5, rgb565);
+    if (_canvasReady) {
+      M5.Display.waitDMA();
+    }
+    _gfx->fillCircle(5, 5, 5, rgb565);
   }
 }
 
@@ -65,47 +111,258 @@ void CompassDisplay::blinkPixel(uint32_t color1, uint32_t color2, int count, int
   // Simplified implementation for now
   for (int i = 0; i < count; i++) {
     setPixelColor(color1);
+    swapBuffers();
     delay(delayMs);
     setPixelColor(color2);
+    swapBuffers();
     delay(delayMs);
   }
   // Return to the first color
   setPixelColor(color1);
+  swapBuffers();
+}
+
+// Force a full redraw on the next frame
+void CompassDisplay::invalidate() {
+  // 他のクラスがパネルに直接描画した後は、差分の基準が使えない
+  _tilesValid = false;
+}
+
+// Prepare the draw target for a new frame
+void CompassDisplay::beginFrame(uint32_t background) {
+  // 前のフレームのDMA転送中はキャンバスを書き換えない
+  if (_canvasReady) {
+    M5.Display.waitDMA();
+  }
+  
+  _gfx->fillScreen(background);
+}
+
+// Pre-render the compass circle and N/E/S/W labels
+void CompassDisplay::buildRoseCache(int radius) {
+  // 1ビットスプライト（0 = 透明、1 = 白）にして、背景の上に重ねて描画する
+  int margin = radius + ROSE_LABEL_MARGIN;
+  int size = margin * 2 + 1;
+  
+  _roseSprite.deleteSprite();
+  _roseSprite.setColorDepth(1);
+  _roseReady = _roseSprite.createSprite(size, size) != nullptr;
+  if (!_roseReady) {
+    LOG_W(LOG_TAG_DISPLAY, "Rose cache allocation failed");
+    return;
+  }
+  _roseSprite.createPalette();
+  _roseRadius = radius;
+  
+  _roseSprite.setPaletteColor(0, TFT_BLACK);
+  _roseSprite.setPaletteColor(1, TFT_WHITE);
+  _roseSprite.fillScreen(0);
+  
+  // Compass circle
+  _roseSprite.drawCircle(margin, margin, radius, 1);
+  
+  // Cardinal direction labels
+  _roseSprite.setTextColor(1);
+  _roseSprite.setTextSize(1);
+  _roseSprite.setCursor(margin - 3, margin - radius - 8);
+  _roseSprite.print("N");
+  _roseSprite.setCursor(margin + radius + 3, margin - 3);
+  _roseSprite.print("E");
+  _roseSprite.setCursor(margin - 3, margin + radius + 2);
+  _roseSprite.print("S");
+  _roseSprite.setCursor(margin - radius - 8, margin - 3);
+  _roseSprite.print("W");
+}
+
+// Draw the compass circle and labels centered at (centerX, centerY)
+void CompassDisplay::drawRose(int centerX, int centerY, int radius) {
+  if (!_roseReady || radius != _roseRadius) {
+    // キャッシュと半径が違う場合は円だけを描く
+    _gfx->drawCircle(centerX, centerY, radius, TFT_WHITE);
+    return;
+  }
+  
+  int margin = radius + ROSE_LABEL_MARGIN;
+  _roseSprite.pushSprite(_gfx, centerX - margin, centerY - margin, 0);
+}
+
+// Pre-render the glyphs used by numeric readouts
+void CompassDisplay::buildGlyphCache() {
+  _glyphsReady = true;
+  for (int i = 0; i < GLYPH_COUNT; i++) {
+    M5Canvas& glyph = _glyphs[i];
+    glyph.deleteSprite();
+    glyph.setColorDepth(1);
+    if (glyph.createSprite(GLYPH_WIDTH, GLYPH_HEIGHT) == nullptr) {
+      _glyphsReady = false;
+      LOG_W(LOG_TAG_DISPLAY, "Glyph cache allocation failed");
+      return;
+    }
+    glyph.createPalette();
+    glyph.setPaletteColor(0, TFT_BLACK);
+    glyph.setPaletteColor(1, TFT_WHITE);
+    glyph.fillScreen(0);
+    glyph.setTextColor(1);
+    glyph.setTextSize(1);
+    glyph.setCursor(0, 0);
+    glyph.print(GLYPH_CHARS[i]);
+  }
+}
+
+// Print a number at the cursor using the glyph cache
+void CompassDisplay::printValue(float value, int decimals, uint16_t color) {
+  char text[16];
+  snprintf(text, sizeof(text), "%.*f", decimals, value);
+  
+  if (!_glyphsReady) {
+    _gfx->setTextColor(color);
+    _gfx->print(text);
+    return;
+  }
+  
+  int x = _gfx->getCursorX();
+  int y = _gfx->getCursorY();
+  for (const char* c = text; *c; c++) {
+    const char* found = strchr(GLYPH_CHARS, *c);
+    if (found != nullptr) {
+      // パレットの1番を表示色に変えて、背景は透明のまま重ねる
+      M5Canvas& glyph = _glyphs[found - GLYPH_CHARS];
+      glyph.setPaletteColor(1, color);
+      glyph.pushSprite(_gfx, x, y, 0);
+    } else {
+      // キャッシュにない文字は通常の描画
+      _gfx->setTextColor(color);
+      _gfx->setCursor(x, y);
+      _gfx->print(*c);
+    }
+    x += GLYPH_WIDTH;
+  }
+  _gfx->setCursor(x, y);
+}
+
+// Sine from the lookup table (degrees, linear interpolation)
+float CompassDisplay::lutSin(float degrees) {
+  float index = degrees * (TRIG_LUT_SIZE / 360.0f);
+  index -= floorf(index / TRIG_LUT_SIZE) * TRIG_LUT_SIZE;  // 0〜TRIG_LUT_SIZEに正規化
+  
+  int i = (int)index;
+  if (i >= TRIG_LUT_SIZE) i = TRIG_LUT_SIZE - 1;
+  float fraction = index - i;
+  return _sinTable[i] + (_sinTable[i + 1] - _sinTable[i]) * fraction;
+}
+
+float CompassDisplay::lutCos(float degrees) {
+  return lutSin(degrees + 90.0f);
+}
+
+// Draw a needle from the center towards angleDegrees (0 = up, clockwise)
+void CompassDisplay::drawNeedle(int centerX, int centerY, int length, float angleDegrees, uint16_t color) {
+  int x = centerX + length * lutSin(angleDegrees);
+  int y = centerY - length * lutCos(angleDegrees);
+  _gfx->drawLine(centerX, centerY, x, y, color);
+}
+
+// Hash one tile of the canvas (FNV-1a over the 16-bit pixels)
+uint32_t CompassDisplay::hashTile(const uint16_t* pixels, int stride, int x, int y, int w, int h) {
+  uint32_t hash = 2166136261u;
+  for (int row = 0; row < h; row++) {
+    const uint16_t* p = pixels + (y + row) * stride + x;
+    for (int col = 0; col < w; col++) {
+      hash ^= p[col];
+      hash *= 16777619u;
+    }
+  }
+  return hash;
+}
+
+// Double buffering: push the tiles that changed since the last frame
+void CompassDisplay::swapBuffers() {
+  if (!_canvasReady) {
+    // 直接描画の場合は転送不要
+    return;
+  }
+  
+  PROFILE_SCOPE(PROFILE_PUSH);
+  const uint16_t* pixels = (const uint16_t*)_canvas.getBuffer();
+  int width = _canvas.width();
+  int height = _canvas.height();
+  uint32_t dirtyPixels = 0;
+  
+  M5.Display.startWrite();
+  
+  for (int ty = 0; ty < _tilesY; ty++) {
+    int y = ty * DISPLAY_TILE_HEIGHT;
+    int h = min(DISPLAY_TILE_HEIGHT, height - y);
+    
+    // 横に連続した変化タイルは1つの矩形にまとめて転送する
+    int runStart = -1;
+    for (int tx = 0; tx <= _tilesX; tx++) {
+      bool dirty = false;
+      if (tx < _tilesX) {
+        int x = tx * DISPLAY_TILE_WIDTH;
+        int w = min(DISPLAY_TILE_WIDTH, width - x);
+        uint32_t hash = hashTile(pixels, width, x, y, w, h);
+        dirty = !_tilesValid || hash != _tileHash[ty][tx];
+        _tileHash[ty][tx] = hash;
+      }
+      
+      if (dirty && runStart < 0) {
+        runStart = tx;
+      } else if (!dirty && runStart >= 0) {
+        int x = runStart * DISPLAY_TILE_WIDTH;
+        int w = min(tx * DISPLAY_TILE_WIDTH, width) - x;
+        
+        // クリップ矩形の範囲だけがキャンバスからDMAで転送される
+        M5.Display.setClipRect(x, y, w, h);
+        M5.Display.pushImageDMA(0, 0, width, height, (const lgfx::swap565_t*)pixels);
+        dirtyPixels += w * h;
+        runStart = -1;
+      }
+    }
+  }
+  
+  M5.Display.clearClipRect();
+  M5.Display.endWrite();
+  
+  _tilesValid = true;
+  _lastDirtyPixels = dirtyPixels;
 }
 
 // Show welcome screen
 void CompassDisplay::showWelcome() {
   // Clear display
-  M5.Display.fillScreen(TFT_NAVY);
+  beginFrame(TFT_NAVY);
   
   // Set text settings
-  M5.Display.setTextColor(TFT_WHITE);
-  M5.Display.setTextSize(2);
+  _gfx->setTextColor(TFT_WHITE);
+  _gfx->setTextSize(2);
   
   // Display title
-  M5.Display.setCursor(10, 30);
-  M5.Display.println("Polaris");
-  M5.Display.setCursor(10, 50);
-  M5.Display.println("Navigator");
+  _gfx->setCursor(10, 30);
+  _gfx->println("Polaris");
+  _gfx->setCursor(10, 50);
+  _gfx->println("Navigator");
   
   // Display version information
-  M5.Display.setTextSize(1);
-  M5.Display.setCursor(10, 80);
-  M5.Display.println("Version 1.0");
+  _gfx->setTextSize(1);
+  _gfx->setCursor(10, 80);
+  _gfx->println("Version 1.0");
   
   // Display copyright information
-  M5.Display.setCursor(10, 100);
-  M5.Display.println("(c) 2025 Kennel.org");
+  _gfx->setCursor(10, 100);
+  _gfx->println("(c) 2025 Kennel.org");
   
   // Startup animation
   for (int i = 0; i < 100; i += 5) {
-    M5.Display.drawRect(10, 120, 100, 10, TFT_WHITE);
-    M5.Display.fillRect(10, 120, i, 10, TFT_GREEN);
+    _gfx->drawRect(10, 120, 100, 10, TFT_WHITE);
+    _gfx->fillRect(10, 120, i, 10, TFT_GREEN);
+    swapBuffers();
     delay(50);
   }
   
   // Set LED to green
   setPixelColor(COLOR_GREEN);
+  swapBuffers();
   
   // Wait for a short time
   delay(1000);
@@ -114,194 +371,174 @@ void CompassDisplay::showWelcome() {
 // Display IMU data
 void CompassDisplay::showIMU() {
   // Clear display
-  M5.Display.fillScreen(TFT_BLACK);
+  beginFrame(TFT_BLACK);
   
   // Set text settings
-  M5.Display.setTextColor(TFT_WHITE);
-  M5.Display.setTextSize(1);
+  _gfx->setTextColor(TFT_WHITE);
+  _gfx->setTextSize(1);
   
   // Display title
-  M5.Display.setTextColor(TFT_MAGENTA);
-  M5.Display.setCursor(2, 0);
-  M5.Display.println("RAW IMU DATA:");
-  M5.Display.setTextColor(TFT_WHITE);
+  _gfx->setTextColor(TFT_MAGENTA);
+  _gfx->setCursor(2, 0);
+  _gfx->println("RAW IMU DATA:");
+  _gfx->setTextColor(TFT_WHITE);
   
   int y = 11;
   
   // Accelerometer data
-  M5.Display.setTextColor(TFT_YELLOW);
-  M5.Display.setCursor(2, y);
-  M5.Display.println("Accelerometer (G):");
-  M5.Display.setTextColor(TFT_WHITE);
+  _gfx->setTextColor(TFT_YELLOW);
+  _gfx->setCursor(2, y);
+  _gfx->println("Accelerometer (G):");
+  _gfx->setTextColor(TFT_WHITE);
   y += 9; 
   
   // Display X and Y on the same line
-  M5.Display.setCursor(2, y);
-  M5.Display.printf("X: %.3f  Y: %.3f", _imuData.accelX, _imuData.accelY);
+  _gfx->setCursor(2, y);
+  _gfx->printf("X: %.3f  Y: %.3f", _imuData.accelX, _imuData.accelY);
   y += 9; 
   
   // Display Z on its own line
-  M5.Display.setCursor(2, y);
-  M5.Display.printf("Z: %.3f", _imuData.accelZ);
+  _gfx->setCursor(2, y);
+  _gfx->printf("Z: %.3f", _imuData.accelZ);
   y += 12; 
   
   // Gyroscope data
-  M5.Display.setTextColor(TFT_YELLOW);
-  M5.Display.setCursor(2, y);
-  M5.Display.println("Gyroscope (deg/s):");
-  M5.Display.setTextColor(TFT_WHITE);
+  _gfx->setTextColor(TFT_YELLOW);
+  _gfx->setCursor(2, y);
+  _gfx->println("Gyroscope (deg/s):");
+  _gfx->setTextColor(TFT_WHITE);
   y += 9; 
   
   // Display X and Y on the same line
-  M5.Display.setCursor(2, y);
-  M5.Display.printf("X: %.3f  Y: %.3f", _imuData.gyroX, _imuData.gyroY);
+  _gfx->setCursor(2, y);
+  _gfx->printf("X: %.3f  Y: %.3f", _imuData.gyroX, _imuData.gyroY);
   y += 9; 
   
   // Display Z on its own line
-  M5.Display.setCursor(2, y);
-  M5.Display.printf("Z: %.3f", _imuData.gyroZ);
+  _gfx->setCursor(2, y);
+  _gfx->printf("Z: %.3f", _imuData.gyroZ);
   y += 12; 
   
   // Magnetometer data
-  M5.Display.setTextColor(TFT_YELLOW);
-  M5.Display.setCursor(2, y);
-  M5.Display.println("Magnetometer (uT):");
-  M5.Display.setTextColor(TFT_WHITE);
+  _gfx->setTextColor(TFT_YELLOW);
+  _gfx->setCursor(2, y);
+  _gfx->println("Magnetometer (uT):");
+  _gfx->setTextColor(TFT_WHITE);
   y += 9; 
   
   // Display X and Y on the same line
-  M5.Display.setCursor(2, y);
-  M5.Display.printf("X: %.3f  Y: %.3f", _imuData.magX, _imuData.magY);
+  _gfx->setCursor(2, y);
+  _gfx->printf("X: %.3f  Y: %.3f", _imuData.magX, _imuData.magY);
   y += 9; 
   
   // Display Z on its own line
-  M5.Display.setCursor(2, y);
-  M5.Display.printf("Z: %.3f", _imuData.magZ);
+  _gfx->setCursor(2, y);
+  _gfx->printf("Z: %.3f", _imuData.magZ);
   
   // Set LED to blue
   setPixelColor(COLOR_BLUE);
+  
+  // Push only the changed tiles to the panel
+  swapBuffers();
 }
 
 // Display compass
 void CompassDisplay::showCompass(float heading, float pitch, float roll, bool gpsValid, bool imuCalibrated) {
   // Clear display
-  M5.Display.fillScreen(TFT_BLACK);
+  beginFrame(TFT_BLACK);
   
   // Set text settings
-  M5.Display.setTextColor(TFT_WHITE);
-  M5.Display.setTextSize(1);
+  _gfx->setTextColor(TFT_WHITE);
+  _gfx->setTextSize(1);
   
   // Display title
-  M5.Display.setTextColor(TFT_GREEN);
-  M5.Display.setCursor(2, 0);
-  M5.Display.println("COMPASS");
-  M5.Display.setTextColor(TFT_WHITE);
+  _gfx->setTextColor(TFT_GREEN);
+  _gfx->setCursor(2, 0);
+  _gfx->println("COMPASS");
+  _gfx->setTextColor(TFT_WHITE);
   
   // Draw compass rose in the center of the screen
-  int centerX = M5.Display.width() / 2;
-  int centerY = M5.Display.height() / 2;
+  int centerX = _gfx->width() / 2;
+  int centerY = _gfx->height() / 2;
   int radius = 25; 
   
-  // Draw compass circle
-  M5.Display.drawCircle(centerX, centerY, radius, TFT_WHITE);
+  // Draw compass circle and cardinal direction labels (pre-rendered)
+  drawRose(centerX, centerY, radius);
   
   // Draw cardinal directions
   // 方位角の計算を修正 - 北が上になるように調整
   // 方位角は時計回りで、北が0度、東が90度、南が180度、西が270度
-  float angle = heading * DEG_TO_RAD; 
   
   // North - 北を指す針（赤色）
   // 画面上で北が上になるように描画（0度が上、時計回りに増加）
-  int nx = centerX + radius * sin(angle);
-  int ny = centerY - radius * cos(angle);
-  M5.Display.drawLine(centerX, centerY, nx, ny, TFT_RED);
+  drawNeedle(centerX, centerY, radius, heading, TFT_RED);
   
   // 北の方向を示すマーク（シンプルな表示）
   int northX = centerX;
   int northY = centerY - (radius * 0.7);
   
   // 北マークを描画（青い点）
-  M5.Display.fillCircle(northX, northY, 2, TFT_BLUE);
-  
-  // Add cardinal direction labels
-  M5.Display.setTextColor(TFT_WHITE);
-  M5.Display.setTextSize(1);
-  
-  // North label
-  M5.Display.setCursor(centerX - 3, centerY - radius - 8);
-  M5.Display.print("N");
-  
-  // East label
-  M5.Display.setCursor(centerX + radius + 3, centerY - 3);
-  M5.Display.print("E");
-  
-  // South label
-  M5.Display.setCursor(centerX - 3, centerY + radius + 2);
-  M5.Display.print("S");
-  
-  // West label
-  M5.Display.setCursor(centerX - radius - 8, centerY - 3);
-  M5.Display.print("W");
+  _gfx->fillCircle(northX, northY, 2, TFT_BLUE);
   
   // Display heading with larger text and centered
-  M5.Display.setTextSize(2);
+  _gfx->setTextSize(2);
   char headingStr[8];
   sprintf(headingStr, "%03.1f", heading);
   int textWidth = strlen(headingStr) * 12; // Approximate width of text
-  M5.Display.setCursor(centerX - textWidth/2, centerY - 8);
-  M5.Display.print(headingStr);
-  M5.Display.setTextSize(1);
+  _gfx->setCursor(centerX - textWidth/2, centerY - 8);
+  _gfx->print(headingStr);
+  _gfx->setTextSize(1);
   
   // Display numerical data below the compass
   int y = centerY + radius + 12;
   
   // Display heading, pitch and roll on separate lines
-  M5.Display.setTextColor(TFT_YELLOW);
-  M5.Display.setCursor(2, y);
-  M5.Display.print("Heading: ");
-  M5.Display.setTextColor(TFT_WHITE);
-  M5.Display.print(heading, 1);
-  M5.Display.println(" ");
+  _gfx->setTextColor(TFT_YELLOW);
+  _gfx->setCursor(2, y);
+  _gfx->print("Heading: ");
+  _gfx->setTextColor(TFT_WHITE);
+  printValue(heading, 1, TFT_WHITE);
+  _gfx->println(" ");
   y += 9;
   
-  M5.Display.setTextColor(TFT_YELLOW);
-  M5.Display.setCursor(2, y);
-  M5.Display.print("Pitch: ");
-  M5.Display.setTextColor(TFT_WHITE);
-  M5.Display.print(pitch, 1);
-  M5.Display.println(" ");
+  _gfx->setTextColor(TFT_YELLOW);
+  _gfx->setCursor(2, y);
+  _gfx->print("Pitch: ");
+  _gfx->setTextColor(TFT_WHITE);
+  printValue(pitch, 1, TFT_WHITE);
+  _gfx->println(" ");
   y += 9;
   
-  M5.Display.setTextColor(TFT_YELLOW);
-  M5.Display.setCursor(2, y);
-  M5.Display.print("Roll: ");
-  M5.Display.setTextColor(TFT_WHITE);
-  M5.Display.print(roll, 1);
-  M5.Display.println(" ");
+  _gfx->setTextColor(TFT_YELLOW);
+  _gfx->setCursor(2, y);
+  _gfx->print("Roll: ");
+  _gfx->setTextColor(TFT_WHITE);
+  printValue(roll, 1, TFT_WHITE);
+  _gfx->println(" ");
   y += 12;
   
   // Display status indicators with colored icons
-  M5.Display.setCursor(2, y);
-  M5.Display.setTextColor(TFT_WHITE);
-  M5.Display.print("GPS: ");
+  _gfx->setCursor(2, y);
+  _gfx->setTextColor(TFT_WHITE);
+  _gfx->print("GPS: ");
   if (gpsValid) {
-    M5.Display.setTextColor(TFT_GREEN);
-    M5.Display.println("OK");
+    _gfx->setTextColor(TFT_GREEN);
+    _gfx->println("OK");
   } else {
-    M5.Display.setTextColor(TFT_RED);
-    M5.Display.println("NO");
+    _gfx->setTextColor(TFT_RED);
+    _gfx->println("NO");
   }
   y += 9;
   
-  M5.Display.setCursor(2, y);
-  M5.Display.setTextColor(TFT_WHITE);
-  M5.Display.print("IMU: ");
+  _gfx->setCursor(2, y);
+  _gfx->setTextColor(TFT_WHITE);
+  _gfx->print("IMU: ");
   if (imuCalibrated) {
-    M5.Display.setTextColor(TFT_GREEN);
-    M5.Display.println("OK");
+    _gfx->setTextColor(TFT_GREEN);
+    _gfx->println("OK");
   } else {
-    M5.Display.setTextColor(TFT_YELLOW);
-    M5.Display.println("CAL");
+    _gfx->setTextColor(TFT_YELLOW);
+    _gfx->println("CAL");
   }
   
   // Set LED color based on GPS and IMU status
@@ -312,128 +549,107 @@ void CompassDisplay::showCompass(float heading, float pitch, float roll, bool gp
   } else {
     setPixelColor(COLOR_GREEN); 
   }
+  
+  // Push only the changed tiles to the panel
+  swapBuffers();
 }
 
 // Display polar alignment compass
 void CompassDisplay::showPolarAlignment(float heading, float polarisAz, float polarisAlt, float pitch, float roll) {
   // Clear display
-  M5.Display.fillScreen(TFT_BLACK);
+  beginFrame(TFT_BLACK);
   
   // Set text settings
-  M5.Display.setTextColor(TFT_WHITE);
-  M5.Display.setTextSize(1);
+  _gfx->setTextColor(TFT_WHITE);
+  _gfx->setTextSize(1);
   
   // Display title
-  M5.Display.setTextColor(TFT_MAGENTA);
-  M5.Display.setCursor(2, 0);
-  M5.Display.println("POLAR ALIGNMENT");
-  M5.Display.setTextColor(TFT_WHITE);
+  _gfx->setTextColor(TFT_MAGENTA);
+  _gfx->setCursor(2, 0);
+  _gfx->println("POLAR ALIGNMENT");
+  _gfx->setTextColor(TFT_WHITE);
   
   // Draw compass rose in the upper portion of the screen
-  int centerX = M5.Display.width() / 2;
+  int centerX = _gfx->width() / 2;
   int centerY = 45; 
   int radius = 25; 
   
-  // Draw compass circle
-  M5.Display.drawCircle(centerX, centerY, radius, TFT_WHITE);
+  // Draw compass circle and cardinal direction labels (pre-rendered)
+  drawRose(centerX, centerY, radius);
   
   // Draw cardinal directions
   // 方位角の計算を修正 - 北が常に上、デバイスの向きを赤い針で表示
   // 方位角は時計回りで、北が0度、東が90度、南が180度、西が270度
-  float angle = heading * DEG_TO_RAD; 
   
   // デバイスの向きを示す針（赤色）- 赤い針を北極星の青いマークに合わせることが目標
   // 画面上で現在の方位角を表示（0度が上、時計回りに増加）
-  int nx = centerX + radius * sin(angle);
-  int ny = centerY - radius * cos(angle);
-  M5.Display.drawLine(centerX, centerY, nx, ny, TFT_RED);
+  drawNeedle(centerX, centerY, radius, heading, TFT_RED);
   
   // 北極星の表示（天の北極を示す青いひし形マーク）- 目標位置
   // 実際の方位角と高度に基づいて表示
-  float polarisAzRad = polarisAz * DEG_TO_RAD;
   // 高度を考慮して半径を調整（高度が高いほど中心に近づく）
   float altFactor = (90.0 - polarisAlt) / 90.0; // 高度が90度で0、0度で1になる係数
   altFactor = constrain(altFactor, 0.0, 1.0); // 0〜1の範囲に制限
   
-  int px = centerX + radius * sin(polarisAzRad) * altFactor;
-  int py = centerY - radius * cos(polarisAzRad) * altFactor;
+  int px = centerX + radius * lutSin(polarisAz) * altFactor;
+  int py = centerY - radius * lutCos(polarisAz) * altFactor;
   
   // 北極星のマークをひし形に変更（より目立つように）
-  M5.Display.fillCircle(px, py, 2, TFT_CYAN);
+  _gfx->fillCircle(px, py, 2, TFT_CYAN);
   int diamondSize = 4;
-  M5.Display.fillTriangle(px, py-diamondSize, px+diamondSize, py, px, py+diamondSize, TFT_CYAN);
-  M5.Display.fillTriangle(px, py-diamondSize, px-diamondSize, py, px, py+diamondSize, TFT_CYAN);
-  
-  // Add cardinal direction labels
-  M5.Display.setTextColor(TFT_WHITE);
-  M5.Display.setTextSize(1);
-  
-  // North label
-  M5.Display.setCursor(centerX - 3, centerY - radius - 8);
-  M5.Display.print("N");
-  
-  // East label
-  M5.Display.setCursor(centerX + radius + 3, centerY - 3);
-  M5.Display.print("E");
-  
-  // South label
-  M5.Display.setCursor(centerX - 3, centerY + radius + 2);
-  M5.Display.print("S");
-  
-  // West label
-  M5.Display.setCursor(centerX - radius - 8, centerY - 3);
-  M5.Display.print("W");
+  _gfx->fillTriangle(px, py-diamondSize, px+diamondSize, py, px, py+diamondSize, TFT_CYAN);
+  _gfx->fillTriangle(px, py-diamondSize, px-diamondSize, py, px, py+diamondSize, TFT_CYAN);
   
   // 極軸合わせの説明を追加（画面下部に小さく表示）
-  M5.Display.setTextColor(TFT_YELLOW);
-  M5.Display.setCursor(2, M5.Display.height() - 9);
-  M5.Display.setTextSize(1);
-  M5.Display.print("Red=Current Blue=Target");
+  _gfx->setTextColor(TFT_YELLOW);
+  _gfx->setCursor(2, _gfx->height() - 9);
+  _gfx->setTextSize(1);
+  _gfx->print("Red=Current Blue=Target");
   
   // Display numerical data below the compass
   int y = centerY + radius + 12;
   
   // Display heading
-  M5.Display.setTextColor(TFT_YELLOW);
-  M5.Display.setCursor(2, y);
-  M5.Display.print("Heading: ");
-  M5.Display.setTextColor(TFT_WHITE);
-  M5.Display.print(heading, 1);
-  M5.Display.println(" ");
+  _gfx->setTextColor(TFT_YELLOW);
+  _gfx->setCursor(2, y);
+  _gfx->print("Heading: ");
+  _gfx->setTextColor(TFT_WHITE);
+  printValue(heading, 1, TFT_WHITE);
+  _gfx->println(" ");
   y += 9;
   
   // Display Polaris position
-  M5.Display.setTextColor(TFT_YELLOW);
-  M5.Display.setCursor(2, y);
-  M5.Display.print("Polaris Az: ");
-  M5.Display.setTextColor(TFT_WHITE);
-  M5.Display.print(polarisAz, 1);
-  M5.Display.println(" ");
+  _gfx->setTextColor(TFT_YELLOW);
+  _gfx->setCursor(2, y);
+  _gfx->print("Polaris Az: ");
+  _gfx->setTextColor(TFT_WHITE);
+  printValue(polarisAz, 1, TFT_WHITE);
+  _gfx->println(" ");
   y += 9;
   
-  M5.Display.setTextColor(TFT_YELLOW);
-  M5.Display.setCursor(2, y);
-  M5.Display.print("Polaris Alt: ");
-  M5.Display.setTextColor(TFT_WHITE);
-  M5.Display.print(polarisAlt, 1);
-  M5.Display.println(" ");
+  _gfx->setTextColor(TFT_YELLOW);
+  _gfx->setCursor(2, y);
+  _gfx->print("Polaris Alt: ");
+  _gfx->setTextColor(TFT_WHITE);
+  printValue(polarisAlt, 1, TFT_WHITE);
+  _gfx->println(" ");
   y += 9;
   
   // Display pitch and roll
-  M5.Display.setTextColor(TFT_YELLOW);
-  M5.Display.setCursor(2, y);
-  M5.Display.print("Pitch: ");
-  M5.Display.setTextColor(TFT_WHITE);
-  M5.Display.print(pitch, 1);
-  M5.Display.println(" ");
+  _gfx->setTextColor(TFT_YELLOW);
+  _gfx->setCursor(2, y);
+  _gfx->print("Pitch: ");
+  _gfx->setTextColor(TFT_WHITE);
+  printValue(pitch, 1, TFT_WHITE);
+  _gfx->println(" ");
   y += 9;
   
-  M5.Display.setTextColor(TFT_YELLOW);
-  M5.Display.setCursor(2, y);
-  M5.Display.print("Roll: ");
-  M5.Display.setTextColor(TFT_WHITE);
-  M5.Display.print(roll, 1);
-  M5.Display.println(" ");
+  _gfx->setTextColor(TFT_YELLOW);
+  _gfx->setCursor(2, y);
+  _gfx->print("Roll: ");
+  _gfx->setTextColor(TFT_WHITE);
+  printValue(roll, 1, TFT_WHITE);
+  _gfx->println(" ");
   
   // 仰角のグラフィック表示を追加
   // 垂直表示に変更（左側に配置）
@@ -445,16 +661,16 @@ void CompassDisplay::showPolarAlignment(float heading, float polarisAz, float po
   int barY = centerY - radius; // コンパスの円の上端と同じ高さに設定
   
   // 仰角インジケーターのタイトル
-  M5.Display.setTextColor(TFT_CYAN);
-  M5.Display.setCursor(barX, barY - 10);
-  M5.Display.println("Alt");
+  _gfx->setTextColor(TFT_CYAN);
+  _gfx->setCursor(barX, barY - 10);
+  _gfx->println("Alt");
   
   // 背景バー（グレー）
-  M5.Display.fillRect(barX, barY, barWidth, barHeight, TFT_DARKGREY);
+  _gfx->fillRect(barX, barY, barWidth, barHeight, TFT_DARKGREY);
   
   // 水平マーカー（白）- 0度を示す
   int horizontalY = barY + barHeight/2; // バーの中央（0度）
-  M5.Display.fillRect(barX - 2, horizontalY - 1, barWidth + 4, 2, TFT_WHITE);
+  _gfx->fillRect(barX - 2, horizontalY - 1, barWidth + 4, 2, TFT_WHITE);
   
   // 目標高度マーカー（シアン）
   // -90度から+90度の範囲で計算（0度が中央）
@@ -465,7 +681,7 @@ void CompassDisplay::showPolarAlignment(float heading, float polarisAz, float po
   int targetPosY = barY + barHeight - (int)(normalizedAlt * barHeight);
   targetPosY = constrain(targetPosY, barY + 2, barY + barHeight - 2);
   
-  M5.Display.fillRect(barX - 2, targetPosY - 1, barWidth + 4, 2, TFT_CYAN);
+  _gfx->fillRect(barX - 2, targetPosY - 1, barWidth + 4, 2, TFT_CYAN);
   
   // 現在の傾きインジケーター（黄色）
   // -90度から+90度の範囲で計算（0度が中央）
@@ -473,7 +689,7 @@ void CompassDisplay::showPolarAlignment(float heading, float polarisAz, float po
   float normalizedPitch = (pitch + 90.0) / 180.0; // 0.0（-90度）～1.0（+90度）に正規化
   int currentPosY = barY + barHeight - (int)(normalizedPitch * barHeight);
   currentPosY = constrain(currentPosY, barY + 2, barY + barHeight - 2);
-  M5.Display.fillTriangle(
+  _gfx->fillTriangle(
     barX - 4, currentPosY,
     barX - 8, currentPosY - 4,
     barX - 8, currentPosY + 4,
@@ -483,64 +699,145 @@ void CompassDisplay::showPolarAlignment(float heading, float polarisAz, float po
   // 仰角の数値表示
   // T:（Target）- 現在のピッチ角からのずれを表示（Nと同じ高さ、右詰め）
   float deviation = polarisAlt - pitch;
-  M5.Display.setTextColor(TFT_WHITE);
+  _gfx->setTextColor(TFT_WHITE);
   // Nの位置を計算（コンパスの上端）
   int northY = centerY - radius - 8;
-  M5.Display.setCursor(M5.Display.width() - 45, northY);
-  M5.Display.print("T:");
-  if (deviation > 0) M5.Display.print("+");
-  M5.Display.print(deviation, 1);
-  M5.Display.print(" "); // 単位を空白に変更
+  _gfx->setCursor(_gfx->width() - 45, northY);
+  _gfx->print("T:");
+  if (deviation > 0) _gfx->print("+");
+  printValue(deviation, 1, TFT_WHITE);
+  _gfx->print(" "); // 単位を空白に変更
   
   // C:（Current）- 現在のピッチ角を表示（Sと同じ高さ、右詰め）
-  M5.Display.setTextColor(TFT_YELLOW);
+  _gfx->setTextColor(TFT_YELLOW);
   // Sの位置を計算（コンパスの下端）
   int southY = centerY + radius + 2;
-  M5.Display.setCursor(M5.Display.width() - 45, southY);
-  M5.Display.print("C:");
-  M5.Display.print(pitch, 1);
-  M5.Display.print(" "); // 単位を空白に変更
+  _gfx->setCursor(_gfx->width() - 45, southY);
+  _gfx->print("C:");
+  printValue(pitch, 1, TFT_YELLOW);
+  _gfx->print(" "); // 単位を空白に変更
 
   // Set LED to blue
   setPixelColor(COLOR_BLUE);
+  
+  // Push only the changed tiles to the panel
+  swapBuffers();
+}
+
+// Display the zoomed polar alignment error
+void CompassDisplay::showFineAlignment(float azErrorArcmin, float altErrorArcmin, float sigmaArcmin,
+                                       float windowS, bool averaging) {
+  beginFrame(TFT_BLACK);
+  _gfx->setTextSize(1);
+  
+  // Display title
+  _gfx->setTextColor(TFT_MAGENTA);
+  _gfx->setCursor(2, 0);
+  _gfx->println("FINE ALIGNMENT");
+  
+  // 誤差が円に収まる最も細かいスケールを選ぶ（外側の2割は余白）
+  static const float scales[FINE_SCALE_COUNT] = FINE_SCALES_ARCMIN;
+  float error = sqrtf(azErrorArcmin * azErrorArcmin + altErrorArcmin * altErrorArcmin);
+  float scale = scales[0];
+  for (int i = 1; i < FINE_SCALE_COUNT; i++) {
+    if (error < scales[i] * 0.8f) {
+      scale = scales[i];
+    }
+  }
+  float pixelsPerArcmin = FINE_RADIUS / scale;
+  
+  // Crosshair: 中心が天の極、半径がスケールの誤差
+  int centerX = _gfx->width() / 2;
+  int centerY = 57;
+  _gfx->drawCircle(centerX, centerY, FINE_RADIUS, TFT_DARKGREY);
+  _gfx->drawCircle(centerX, centerY, FINE_RADIUS / 2, TFT_DARKGREY);
+  _gfx->drawFastHLine(centerX - FINE_RADIUS, centerY, FINE_RADIUS * 2 + 1, TFT_DARKGREY);
+  _gfx->drawFastVLine(centerX, centerY - FINE_RADIUS, FINE_RADIUS * 2 + 1, TFT_DARKGREY);
+  _gfx->fillCircle(centerX, centerY, 2, TFT_CYAN);
+  
+  // スケールの表示（円の右上）
+  char text[24];
+  snprintf(text, sizeof(text), "%.0f'", scale);
+  _gfx->setTextColor(TFT_DARKGREY);
+  _gfx->setCursor(centerX + FINE_RADIUS - 12, centerY - FINE_RADIUS);
+  _gfx->print(text);
+  
+  // 現在の向き（右が東寄り、上が高い）と平均の信頼円（2σ）
+  int px = centerX + (int)lroundf(constrain(azErrorArcmin * pixelsPerArcmin, -FINE_RADIUS, FINE_RADIUS));
+  int py = centerY - (int)lroundf(constrain(altErrorArcmin * pixelsPerArcmin, -FINE_RADIUS, FINE_RADIUS));
+  int sigmaRadius = (int)lroundf(2.0f * sigmaArcmin * pixelsPerArcmin);
+  if (averaging && sigmaRadius >= 2) {
+    _gfx->drawCircle(px, py, min(sigmaRadius, FINE_RADIUS), TFT_YELLOW);
+  }
+  _gfx->drawFastHLine(px - 4, py, 9, TFT_RED);
+  _gfx->drawFastVLine(px, py - 4, 9, TFT_RED);
+  
+  // 誤差の数値（0.1分角 = 6秒角単位）
+  int y = centerY + FINE_RADIUS + 4;
+  _gfx->setTextColor(TFT_YELLOW);
+  _gfx->setCursor(2, y);
+  _gfx->print("Az");
+  _gfx->setTextColor(TFT_WHITE);
+  snprintf(text, sizeof(text), "%+6.1f' ", azErrorArcmin);
+  _gfx->print(text);
+  _gfx->setTextColor(TFT_YELLOW);
+  _gfx->print("Alt");
+  _gfx->setTextColor(TFT_WHITE);
+  snprintf(text, sizeof(text), "%+6.1f'", altErrorArcmin);
+  _gfx->print(text);
+  y += 9;
+  
+  // 平均の状態（1σと窓の長さ、平均が求まるまでは待機表示）
+  _gfx->setCursor(2, y);
+  if (averaging) {
+    _gfx->setTextColor(TFT_GREEN);
+    snprintf(text, sizeof(text), "+/-%.1f' avg %.1fs", sigmaArcmin, windowS);
+  } else {
+    _gfx->setTextColor(TFT_DARKGREY);
+    snprintf(text, sizeof(text), "Averaging...");
+  }
+  _gfx->print(text);
+  
+  // 2σの円が中心を含めば緑、そうでなければ青
+  setPixelColor(averaging && error <= 2.0f * sigmaArcmin ? COLOR_GREEN : COLOR_BLUE);
+  
+  // Push only the changed tiles to the panel
+  swapBuffers();
 }
 
 // Display celestial overlay
 void CompassDisplay::showCelestialOverlay(float heading, float pitch, float roll, 
                                         float sunAz, float sunAlt, 
-                                        float moonAz, float moonAlt, float moonPhase) {
+                                        float moonAz, float moonAlt, float moonPhase,
+                                        bool timeValid) {
   // Clear display
-  M5.Display.fillScreen(TFT_BLACK);
+  beginFrame(TFT_BLACK);
   
   // Set text settings
-  M5.Display.setTextColor(TFT_WHITE);
-  M5.Display.setTextSize(1);
+  _gfx->setTextColor(TFT_WHITE);
+  _gfx->setTextSize(1);
   
   // Display title
-  M5.Display.setCursor(10, 0);
-  M5.Display.println("Celestial Overlay");
+  _gfx->setCursor(10, 0);
+  _gfx->println("Celestial Overlay");
   
   // Display heading
-  M5.Display.setCursor(10, 30); // 20から30に変更（10ピクセル下げる）
-  M5.Display.print("Heading: ");
-  M5.Display.print(heading, 1);
-  M5.Display.println(" ");
+  _gfx->setCursor(10, 30); // 20から30に変更（10ピクセル下げる）
+  _gfx->print("Heading: ");
+  printValue(heading, 1, TFT_WHITE);
+  _gfx->println(" ");
   
   // Draw compass rose
-  int centerX = M5.Display.width() / 2;
+  int centerX = _gfx->width() / 2;
   int centerY = 110;
   int radius = 40;
   
   // Draw compass circle
-  M5.Display.drawCircle(centerX, centerY, radius, TFT_WHITE);
+  _gfx->drawCircle(centerX, centerY, radius, TFT_WHITE);
   
   // Draw cardinal directions
-  float angle = -heading * PI / 180.0; 
-  
   // North
-  int nx = centerX + radius * sin(angle);
-  int ny = centerY - radius * cos(angle);
-  M5.Display.drawLine(centerX, centerY, nx, ny, TFT_RED);
+  drawNeedle(centerX, centerY, radius, -heading, TFT_RED);
   
   // Draw Polaris position
   // 北極星は常に北（0度）に位置するため、固定位置に表示
@@ -549,14 +846,27 @@ void CompassDisplay::showCelestialOverlay(float heading, float pitch, float roll
   
   // Draw Polaris marker
   uint16_t polarisColor = TFT_CYAN;
-  M5.Display.fillCircle(px, py, 3, polarisColor);
-  M5.Display.drawLine(px-4, py, px+4, py, polarisColor);
-  M5.Display.drawLine(px, py-4, px, py+4, polarisColor);
+  _gfx->fillCircle(px, py, 3, polarisColor);
+  _gfx->drawLine(px-4, py, px+4, py, polarisColor);
+  _gfx->drawLine(px, py-4, px, py+4, polarisColor);
+  
+  if (!timeValid) {
+    // 時刻がない間は太陽と月の位置を出さない
+    _gfx->setTextColor(TFT_YELLOW);
+    _gfx->setCursor(10, 160);
+    _gfx->print("Sun/Moon: no time");
+    _gfx->setCursor(10, 175);
+    _gfx->print("Waiting for GPS/NTP");
+    
+    setPixelColor(COLOR_PURPLE);
+    swapBuffers();
+    return;
+  }
   
   // Draw Sun position
-  float sunAngle = (sunAz - heading) * PI / 180.0;
-  int sx = centerX + radius * sin(sunAngle);
-  int sy = centerY - radius * cos(sunAngle);
+  float sunAngle = sunAz - heading;
+  int sx = centerX + radius * lutSin(sunAngle);
+  int sy = centerY - radius * lutCos(sunAngle);
   
   // Adjust for altitude (simple projection)
   float sunAltFactor = 1.0 - (sunAlt / 90.0) * 0.5;
@@ -565,12 +875,12 @@ void CompassDisplay::showCelestialOverlay(float heading, float pitch, float roll
   
   // Draw Sun marker
   uint16_t sunColor = (sunAlt < 0) ? TFT_DARKGREY : TFT_YELLOW;
-  M5.Display.fillCircle(sx, sy, 5, sunColor);
+  _gfx->fillCircle(sx, sy, 5, sunColor);
   
   // Draw Moon position
-  float moonAngle = (moonAz - heading) * PI / 180.0;
-  int mx = centerX + radius * sin(moonAngle);
-  int my = centerY - radius * cos(moonAngle);
+  float moonAngle = moonAz - heading;
+  int mx = centerX + radius * lutSin(moonAngle);
+  int my = centerY - radius * lutCos(moonAngle);
   
   // Adjust for altitude (simple projection)
   float moonAltFactor = 1.0 - (moonAlt / 90.0) * 0.5;
@@ -579,49 +889,152 @@ void CompassDisplay::showCelestialOverlay(float heading, float pitch, float roll
   
   // Draw Moon marker
   uint16_t moonColor = (moonAlt < 0) ? TFT_DARKGREY : TFT_WHITE;
-  M5.Display.fillCircle(mx, my, 4, moonColor);
+  _gfx->fillCircle(mx, my, 4, moonColor);
   
   // Display celestial information
-  M5.Display.setCursor(10, 160);
-  M5.Display.print("Sun: Az=");
-  M5.Display.print(sunAz, 1);
-  M5.Display.print(" Alt=");
-  M5.Display.print(sunAlt, 1);
-  
-  M5.Display.setCursor(10, 175);
-  M5.Display.print("Moon: Az=");
-  M5.Display.print(moonAz, 1);
-  M5.Display.print(" Alt=");
-  M5.Display.print(moonAlt, 1);
+  _gfx->setCursor(10, 160);
+  _gfx->print("Sun: Az=");
+  _gfx->print(sunAz, 1);
+  _gfx->print(" Alt=");
+  _gfx->print(sunAlt, 1);
+  
+  _gfx->setCursor(10, 175);
+  _gfx->print("Moon: Az=");
+  _gfx->print(moonAz, 1);
+  _gfx->print(" Alt=");
+  _gfx->print(moonAlt, 1);
   
   // Display moon phase
-  M5.Display.setCursor(10, 190);
-  M5.Display.print("Moon Phase: ");
-  M5.Display.print(moonPhase * 100.0, 0);
-  M5.Display.println("%");
+  _gfx->setCursor(10, 190);
+  _gfx->print("Moon Phase: ");
+  _gfx->print(moonPhase * 100.0, 0);
+  _gfx->println("%");
+  
+  // Set LED to purple
+  setPixelColor(COLOR_PURPLE);
+  
+  // Push only the changed tiles to the panel
+  swapBuffers();
+}
+
+// Display the Polaris hour-angle clock
+void CompassDisplay::showPolarisClock(float hourAngle, float latitude,
+                                      int minutesToSunrise, int minutesToSunset, bool timeValid) {
+  // Clear display
+  beginFrame(TFT_BLACK);
+  
+  // Set text settings
+  _gfx->setTextSize(1);
+  
+  // Display title
+  _gfx->setTextColor(TFT_CYAN);
+  _gfx->setCursor(2, 0);
+  _gfx->println("POLARIS CLOCK");
+  
+  int centerX = _gfx->width() / 2;
+  int centerY = 52;
+  int radius = 36;
+  
+  // Clock face: one tick per 2h of hour angle, labels every 6h
+  // 北を向いて見た配置（0hが天の北極の真上、時角が増えると反時計回り）
+  _gfx->drawCircle(centerX, centerY, radius, TFT_DARKGREY);
+  for (int h = 0; h < 24; h += 2) {
+    float angle = -h * 15.0f;
+    int inner = (h % 6 == 0) ? radius - 6 : radius - 3;
+    _gfx->drawLine(centerX + inner * lutSin(angle), centerY - inner * lutCos(angle),
+                   centerX + radius * lutSin(angle), centerY - radius * lutCos(angle),
+                   TFT_DARKGREY);
+  }
+  _gfx->setTextColor(TFT_DARKGREY);
+  _gfx->setCursor(centerX - 2, centerY - radius + 8);
+  _gfx->print("0");
+  _gfx->setCursor(centerX - radius + 8, centerY - 3);
+  _gfx->print("6");
+  _gfx->setCursor(centerX - 5, centerY + radius - 15);
+  _gfx->print("12");
+  _gfx->setCursor(centerX + radius - 19, centerY - 3);
+  _gfx->print("18");
+  
+  // Celestial pole
+  _gfx->drawLine(centerX - 3, centerY, centerX + 3, centerY, TFT_WHITE);
+  _gfx->drawLine(centerX, centerY - 3, centerX, centerY + 3, TFT_WHITE);
+  
+  int y = centerY + radius + 6;
+  if (!timeValid) {
+    // 時角と日の出入りは時刻が合うまで出さない
+    _gfx->setTextColor(TFT_YELLOW);
+    _gfx->setCursor(2, y);
+    _gfx->print("No time yet");
+    _gfx->setTextColor(TFT_WHITE);
+    _gfx->setCursor(2, y + 10);
+    _gfx->print("Waiting for GPS/NTP");
+    
+    setPixelColor(COLOR_PURPLE);
+    swapBuffers();
+    return;
+  }
+  if (latitude < 0.0f) {
+    // 南半球では北極星は見えない
+    _gfx->setTextColor(TFT_YELLOW);
+    _gfx->setCursor(2, y);
+    _gfx->print("Polaris not visible");
+  } else {
+    // Polaris on the clock face
+    float angle = -hourAngle * 15.0f;
+    int px = centerX + radius * lutSin(angle);
+    int py = centerY - radius * lutCos(angle);
+    _gfx->drawLine(centerX, centerY, px, py, TFT_NAVY);
+    _gfx->fillCircle(px, py, 3, TFT_CYAN);
+    
+    // Hour angle readout
+    int minutes = (int)(hourAngle * 60.0f + 0.5f) % (24 * 60);
+    _gfx->setTextColor(TFT_YELLOW);
+    _gfx->setCursor(2, y);
+    _gfx->print("Hour angle: ");
+    _gfx->setTextColor(TFT_WHITE);
+    _gfx->printf("%02dh%02dm", minutes / 60, minutes % 60);
+  }
+  y += 10;
+  
+  // Next sunrise or sunset
+  bool sunsetNext = minutesToSunset >= 0 &&
+                    (minutesToSunrise < 0 || minutesToSunset < minutesToSunrise);
+  int minutesToEvent = sunsetNext ? minutesToSunset : minutesToSunrise;
+  _gfx->setTextColor(TFT_YELLOW);
+  _gfx->setCursor(2, y);
+  if (minutesToEvent < 0) {
+    _gfx->print("No sunrise/sunset");
+  } else {
+    _gfx->print(sunsetNext ? "Sunset in:  " : "Sunrise in: ");
+    _gfx->setTextColor(TFT_WHITE);
+    _gfx->printf("%d:%02d", minutesToEvent / 60, minutesToEvent % 60);
+  }
   
   // Set LED to purple
   setPixelColor(COLOR_PURPLE);
+  
+  // Push only the changed tiles to the panel
+  swapBuffers();
 }
 
 // Display GPS information
 void CompassDisplay::showGPS(float latitude, float longitude, float altitude, int satellites, float hdop) {
   // Clear display
-  M5.Display.fillScreen(TFT_BLACK);
+  beginFrame(TFT_BLACK);
   
   // Set text settings
-  M5.Display.setTextColor(TFT_WHITE);
-  M5.Display.setTextSize(1);
+  _gfx->setTextColor(TFT_WHITE);
+  _gfx->setTextSize(1);
   
   // Display title
-  M5.Display.setTextColor(TFT_GREEN);
-  M5.Display.setCursor(2, 0);
-  M5.Display.println("RAW GPS DATA:");
+  _gfx->setTextColor(TFT_GREEN);
+  _gfx->setCursor(2, 0);
+  _gfx->println("RAW GPS DATA:");
   
   // Display GPS status in compact format
-  M5.Display.fillRect(80, 0, 48, 10, TFT_BLACK);
-  M5.Display.setCursor(80, 0);
-  M5.Display.print("GPS:");
+  _gfx->fillRect(80, 0, 48, 10, TFT_BLACK);
+  _gfx->setCursor(80, 0);
+  _gfx->print("GPS:");
   
   // Determine GPS status
   int gpsStatus = 0;
@@ -638,54 +1051,54 @@ void CompassDisplay::showGPS(float latitude, float longitude, float altitude, in
   // Display GPS status with color
   switch(gpsStatus) {
     case 0:
-      M5.Display.setTextColor(TFT_RED);
-      M5.Display.println("NO");
+      _gfx->setTextColor(TFT_RED);
+      _gfx->println("NO");
       break;
     case 1:
-      M5.Display.setTextColor(TFT_YELLOW);
-      M5.Display.println("NS");
+      _gfx->setTextColor(TFT_YELLOW);
+      _gfx->println("NS");
       break;
     case 2:
-      M5.Display.setTextColor(TFT_BLUE);
-      M5.Display.println("AQ");
+      _gfx->setTextColor(TFT_BLUE);
+      _gfx->println("AQ");
       break;
     case 3:
-      M5.Display.setTextColor(TFT_GREEN);
-      M5.Display.println("OK");
+      _gfx->setTextColor(TFT_GREEN);
+      _gfx->println("OK");
       break;
   }
   
-  M5.Display.setTextColor(TFT_WHITE);
+  _gfx->setTextColor(TFT_WHITE);
   int y = 15;
   
   // Satellites
-  M5.Display.setCursor(2, y);
-  M5.Display.print("Sats: ");
-  M5.Display.print(satellites);
+  _gfx->setCursor(2, y);
+  _gfx->print("Sats: ");
+  _gfx->print(satellites);
   y += 8;
   
   // Location
-  M5.Display.setCursor(2, y);
-  M5.Display.print("Lat: ");
-  M5.Display.print(latitude, 6);
+  _gfx->setCursor(2, y);
+  _gfx->print("Lat: ");
+  _gfx->print(latitude, 6);
   y += 8;
   
-  M5.Display.setCursor(2, y);
-  M5.Display.print("Lng: ");
-  M5.Display.print(longitude, 6);
+  _gfx->setCursor(2, y);
+  _gfx->print("Lng: ");
+  _gfx->print(longitude, 6);
   y += 8;
   
   // Altitude
-  M5.Display.setCursor(2, y);
-  M5.Display.print("Alt: ");
-  M5.Display.print(altitude, 1);
-  M5.Display.print("m");
+  _gfx->setCursor(2, y);
+  _gfx->print("Alt: ");
+  _gfx->print(altitude, 1);
+  _gfx->print("m");
   y += 8;
   
   // HDOP (Horizontal Dilution of Precision)
-  M5.Display.setCursor(2, y);
-  M5.Display.print("HDOP: ");
-  M5.Display.print(hdop, 1);
+  _gfx->setCursor(2, y);
+  _gfx->print("HDOP: ");
+  _gfx->print(hdop, 1);
   
   // Set LED color based on GPS status
   switch(gpsStatus) {
@@ -702,68 +1115,74 @@ void CompassDisplay::showGPS(float latitude, float longitude, float altitude, in
       setPixelColor(COLOR_GREEN);
       break;
   }
+  
+  // Push only the changed tiles to the panel
+  swapBuffers();
 }
 
 // Display GPS invalid message
 void CompassDisplay::showGPSInvalid() {
   // Clear display
-  M5.Display.fillScreen(TFT_BLACK);
+  beginFrame(TFT_BLACK);
   
   // Set text settings
-  M5.Display.setTextColor(TFT_WHITE);
-  M5.Display.setTextSize(1);
+  _gfx->setTextColor(TFT_WHITE);
+  _gfx->setTextSize(1);
   
   // Display title
-  M5.Display.setTextColor(TFT_RED);
-  M5.Display.setCursor(2, 0);
-  M5.Display.println("GPS STATUS");
+  _gfx->setTextColor(TFT_RED);
+  _gfx->setCursor(2, 0);
+  _gfx->println("GPS STATUS");
   
   // Display GPS status in compact format
-  M5.Display.fillRect(80, 0, 48, 10, TFT_BLACK);
-  M5.Display.setCursor(80, 0);
-  M5.Display.print("GPS:");
-  M5.Display.setTextColor(TFT_RED);
-  M5.Display.println("NO");
+  _gfx->fillRect(80, 0, 48, 10, TFT_BLACK);
+  _gfx->setCursor(80, 0);
+  _gfx->print("GPS:");
+  _gfx->setTextColor(TFT_RED);
+  _gfx->println("NO");
   
-  M5.Display.setTextColor(TFT_WHITE);
+  _gfx->setTextColor(TFT_WHITE);
   
   // Display error message with more compact layout
   int y = 20;
-  M5.Display.setCursor(2, y);
-  M5.Display.println("GPS Signal Invalid");
+  _gfx->setCursor(2, y);
+  _gfx->println("GPS Signal Invalid");
   y += 10;
   
-  M5.Display.setCursor(2, y);
-  M5.Display.println("Waiting for GPS fix...");
+  _gfx->setCursor(2, y);
+  _gfx->println("Waiting for GPS fix...");
   y += 10;
   
-  M5.Display.setCursor(2, y);
-  M5.Display.println("Check antenna connection");
+  _gfx->setCursor(2, y);
+  _gfx->println("Check antenna connection");
   y += 10;
   
-  M5.Display.setCursor(2, y);
-  M5.Display.println("Ensure clear sky view");
+  _gfx->setCursor(2, y);
+  _gfx->println("Ensure clear sky view");
   
   // Set LED to red
   setPixelColor(COLOR_RED);
+  
+  // Push only the changed tiles to the panel
+  swapBuffers();
 }
 
 // Display error message
 void CompassDisplay::showError(const char* message) {
   // Clear display
-  M5.Display.fillScreen(TFT_BLACK);
+  beginFrame(TFT_BLACK);
   
   // Set text settings
-  M5.Display.setTextColor(TFT_RED);
-  M5.Display.setTextSize(1);
+  _gfx->setTextColor(TFT_RED);
+  _gfx->setTextSize(1);
   
   // Display title
-  M5.Display.setCursor(10, 0);
-  M5.Display.println("Error");
+  _gfx->setCursor(10, 0);
+  _gfx->println("Error");
   
   // Display error message
-  M5.Display.setCursor(10, 20);
-  M5.Display.println(message);
+  _gfx->setCursor(10, 20);
+  _gfx->println(message);
   
   // Blink LED red
   blinkPixel(COLOR_RED, COLOR_BLACK, 3, 200);
@@ -27,6 +27,27 @@
 #define COLOR_WHITE  0xFFFFFF
 #define COLOR_BLACK  0x000000
 
+// Dirty-tile rendering
+// キャンバスをタイルに分割し、前フレームから変化したタイルだけをパネルに転送する
+#define DISPLAY_TILE_WIDTH   16   // タイル幅（ピクセル）
+#define DISPLAY_TILE_HEIGHT  8    // タイル高さ（ピクセル、1行の文字の高さ）
+#define DISPLAY_MAX_TILES_X  16   // 最大256ピクセル幅まで対応
+#define DISPLAY_MAX_TILES_Y  32   // 最大256ピクセル高さまで対応
+
+// Pre-rendered compass rose and glyph cache
+#define ROSE_RADIUS          25   // 極軸合わせ画面・コンパス画面の円の半径
+#define ROSE_LABEL_MARGIN    10   // N/E/S/Wラベル用の余白
+
+// Fine alignment view
+#define FINE_RADIUS          44   // 十字の円の半径（ピクセル）
+#define FINE_SCALE_COUNT     3
+#define FINE_SCALES_ARCMIN   {60.0f, 15.0f, 4.0f}  // 円の半径に対応する誤差（分角、誤差に合わせて選ぶ）
+#define TRIG_LUT_SIZE        360  // 正弦テーブルの分割数（1度刻み、線形補間）
+#define GLYPH_CHARS          "0123456789.-+ "
+#define GLYPH_COUNT          14   // GLYPH_CHARSの文字数
+#define GLYPH_WIDTH          6    // 標準フォントの文字幅
+#define GLYPH_HEIGHT         8    // 標準フォントの文字高さ
+
 // IMUデータ構造体
 struct IMUData {
   // ジャイロスコープデータ (BMI270)
@@ -65,10 +86,23 @@ public:
   // Display polar alignment compass
   void showPolarAlignment(float heading, float polarisAz, float polarisAlt, float pitch, float roll);
   
+  // Display the zoomed polar alignment error (arcminutes)
+  // azError/altError are pointing minus target; sigma is the 1σ of the average
+  void showFineAlignment(float azErrorArcmin, float altErrorArcmin, float sigmaArcmin,
+                         float windowS, bool averaging);
+  
   // Display celestial overlay
+  // timeValid = false: no GPS/NTP time yet, the Sun and Moon are not drawn
   void showCelestialOverlay(float heading, float pitch, float roll, 
                           float sunAz, float sunAlt, 
-                          float moonAz, float moonAlt, float moonPhase);
+                          float moonAz, float moonAlt, float moonPhase,
+                          bool timeValid);
+  
+  // Display the Polaris hour-angle clock (naked-eye view facing north)
+  // hourAngle in hours; minutes to the next sunrise/sunset are -1 if none
+  // timeValid = false: only the clock face is drawn, with a waiting message
+  void showPolarisClock(float hourAngle, float latitude,
+                        int minutesToSunrise, int minutesToSunset, bool timeValid);
   
   // Display GPS information
   void showGPS(float latitude, float longitude, float altitude, int satellites, float hdop);
@@ -82,9 +116,27 @@ public:
   // Display error message
   void showError(const char* message);
   
+  // Force a full redraw on the next frame
+  // (call after another class has drawn directly to the panel)
+  void invalidate();
+  
+  // Number of pixels pushed to the panel by the last frame
+  uint32_t getLastDirtyPixels() const { return _lastDirtyPixels; }
+  
 private:
   // Canvas for double buffering
   M5Canvas _canvas = M5Canvas(&M5.Display);
+  bool _canvasReady;
+  
+  // Draw target (canvas, or the panel itself if the canvas could not be allocated)
+  LovyanGFX* _gfx;
+  
+  // Hash of every tile as last pushed to the panel
+  uint32_t _tileHash[DISPLAY_MAX_TILES_Y][DISPLAY_MAX_TILES_X];
+  int _tilesX;
+  int _tilesY;
+  bool _tilesValid;
+  uint32_t _lastDirtyPixels;
   
   // Current animation color
   uint32_t _currentColor;
@@ -92,14 +144,27 @@ private:
   // Last animation time
   unsigned long _lastAnimationTime;
   
-  // Celestial overlay
-  CelestialOverlay _celestialOverlay;
-  
   // BMM150 magnetometer reference
   BMM150class* _bmm150;
   
-  // Draw compass rose
-  void drawCompassRose(float heading);
+  // Pre-rendered compass rose (circle + N/E/S/W labels, 1-bit)
+  M5Canvas _roseSprite = M5Canvas(&M5.Display);
+  int _roseRadius;
+  bool _roseReady;
+  void buildRoseCache(int radius);
+  void drawRose(int centerX, int centerY, int radius);
+  
+  // Glyph cache for numeric readouts (1-bit, recolored through the palette)
+  M5Canvas _glyphs[GLYPH_COUNT];
+  bool _glyphsReady;
+  void buildGlyphCache();
+  void printValue(float value, int decimals, uint16_t color);
+  
+  // Sine lookup table for needles and markers
+  float _sinTable[TRIG_LUT_SIZE + 1];
+  float lutSin(float degrees);
+  float lutCos(float degrees);
+  void drawNeedle(int centerX, int centerY, int length, float angleDegrees, uint16_t color);
   
   // Draw horizon line
   void drawHorizon(float pitch, float roll);
@@ -117,7 +182,14 @@ private:
   IMUData _imuData;
   
   // Double buffering
+  // Clear the draw target for a new frame
+  void beginFrame(uint32_t background);
+  
+  // Push the tiles that changed since the last frame
   void swapBuffers();
+  
+  // Hash one tile of the canvas
+  static uint32_t hashTile(const uint16_t* pixels, int stride, int x, int y, int w, int h);
 };
 
 #endif // COMPASS_DISPLAY_H
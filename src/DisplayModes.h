@@ -17,7 +17,8 @@ enum DisplayMode {
   IMU_DATA = 2,
   CELESTIAL_DATA = 3,
   RAW_DATA = 4,
-  CALIBRATION_MODE = 5
+  CALIBRATION_MODE = 5,
+  POLARIS_CLOCK = 6
 };
 
 // Raw data display modes
@@ -26,7 +27,8 @@ enum RawDataMode {
   RAW_GPS = 1,        // GPS raw data
   RAW_CELESTIAL = 2,  // Celestial data
   RAW_SYSTEM = 3,     // System information
-  DISPLAY_DEBUG = 4   // Debug mode (consistent naming)
+  DISPLAY_DEBUG = 4,  // Debug mode (consistent naming)
+  RAW_PERFORMANCE = 5 // Loop profiler
 };
 
 #endif // DISPLAY_MODES_H
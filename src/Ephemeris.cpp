@@ -0,0 +1,178 @@
+/*
+ * Ephemeris.cpp
+ * 
+ * Implementation of the cached celestial ephemeris
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "Ephemeris.h"
+#include <math.h>
+#include "celestial_math.h"
+#include "pole_star_table.h"
+
+// Constructor
+Ephemeris::Ephemeris() {
+  _latitude = 0.0f;
+  _longitude = 0.0f;
+  _hasLocation = false;
+  _locationChanged = false;
+  _timeBase = nullptr;
+  _liveTime = false;
+  _hasTime = false;
+  _refDate = -1;
+  _refSeconds = -1;
+  _timeRefMs = 0;
+  _jdRef = 0.0;
+  _gmstRef = 0.0;
+  _jd = 0.0;
+  _lst = 0.0;
+  _poleHourAngle = 0.0;
+  _elementsJd = 0.0;
+  _elementsValid = false;
+  _sunRa = _sunDec = 0.0;
+  _moonRa = _moonDec = 0.0;
+  _poleRa = _poleDec = 0.0;
+  _lastPositionMs = 0;
+  _positionsValid = false;
+  _poleAz = 0.0f;
+  _poleAlt = 0.0f;
+  _sunAz = _sunAlt = 0.0f;
+  _moonAz = _moonAlt = 0.0f;
+  _moonPhase = 0.0f;
+  _magField.declination = 0.0f;
+  _magField.inclination = 0.0f;
+  _magField.fieldStrength = 0.0f;
+  _temperature = REFRACTION_STANDARD_TEMPERATURE_C;
+  _pressure = REFRACTION_STANDARD_PRESSURE_HPA;
+}
+
+void Ephemeris::setLocation(float latitude, float longitude) {
+  if (_hasLocation &&
+      fabsf(latitude - _latitude) < EPHEMERIS_LOCATION_EPSILON &&
+      fabsf(longitude - _longitude) < EPHEMERIS_LOCATION_EPSILON) {
+    return;
+  }
+  
+  _latitude = latitude;
+  _longitude = longitude;
+  _hasLocation = true;
+  _locationChanged = true;
+  _elementsValid = false;  // 半球が変わると使う極星も変わる
+  
+  // 地磁気は位置だけで決まるため、ここで1回だけ計算する
+  ::getMagneticField(latitude, longitude, &_magField);
+}
+
+void Ephemeris::setAtmosphere(float temperatureC, float altitudeM) {
+  // 次の位置更新（約1Hz）から反映される
+  _temperature = temperatureC;
+  _pressure = pressureFromAltitude(altitudeM);
+}
+
+void Ephemeris::setTime(int year, int month, int day, int hour, int minute, int second) {
+  if (_timeBase && _timeBase->isValid()) {
+    return;  // GPSで合わせた時刻を優先する
+  }
+  
+  int32_t date = (int32_t)year * 10000 + month * 100 + day;
+  int32_t seconds = (int32_t)hour * 3600 + minute * 60 + second;
+  if (_hasTime && date == _refDate && seconds == _refSeconds) {
+    return;  // 同じ基準時刻（経過時間で進める）
+  }
+  
+  _refDate = date;
+  _refSeconds = seconds;
+  _timeRefMs = millis();
+  _jdRef = getJulianDateTime(year, month, day, hour, minute, second);
+  _gmstRef = getSiderealTime(_jdRef, 0.0);
+  _hasTime = true;
+  _liveTime = false;
+  
+  // 時刻が飛んだ可能性があるため、赤経赤緯から計算し直す
+  _elementsValid = false;
+  _positionsValid = false;
+}
+
+void Ephemeris::invalidate() {
+  _elementsValid = false;
+  _positionsValid = false;
+  _locationChanged = true;
+}
+
+bool Ephemeris::update() {
+  uint32_t now = millis();
+  
+  // ユリウス日と恒星時は基準時刻からの経過時間で進める（日付の解析なし）
+  double elapsed = 0.0;
+  if (_timeBase && _timeBase->isValid()) {
+    _jd = _timeBase->getJulianDate();
+    if (!_liveTime || fabs(_jd - _jdRef) > EPHEMERIS_SIDEREAL_REBASE_DAYS) {
+      if (!_liveTime) {
+        // millis()基準からの切り替え: 赤経赤緯から計算し直す
+        _elementsValid = false;
+        _positionsValid = false;
+      }
+      _jdRef = _jd;
+      _gmstRef = getSiderealTime(_jdRef, 0.0);
+      _liveTime = true;
+      _hasTime = true;
+    }
+    elapsed = (_jd - _jdRef) * 86400.0;
+  } else if (_hasTime) {
+    elapsed = (uint32_t)(now - _timeRefMs) / 1000.0;
+    _jd = _jdRef + elapsed / 86400.0;
+  }
+  
+  if (_hasTime) {
+    _lst = fmod(_gmstRef + _longitude + elapsed * SIDEREAL_DEG_PER_SEC, 360.0);
+    if (_lst < 0) _lst += 360.0;
+    
+    updatePoleHourAngle();
+  }
+  
+  // 位置の更新は約1Hz（位置が変わった場合は即時）
+  if (_positionsValid && !_locationChanged &&
+      now - _lastPositionMs < EPHEMERIS_POSITION_INTERVAL_MS) {
+    return false;
+  }
+  _lastPositionMs = now;
+  _locationChanged = false;
+  
+  if (_hasTime && (!_elementsValid || fabs(_jd - _elementsJd) * 86400.0 >= EPHEMERIS_ELEMENTS_INTERVAL_S)) {
+    updateElements();
+  }
+  updatePositions();
+  _positionsValid = true;
+  return true;
+}
+
+void Ephemeris::updateElements() {
+  calculateSunEquatorial(_jd, &_sunRa, &_sunDec);
+  calculateMoonEquatorial(_jd, &_moonRa, &_moonDec, &_moonPhase);
+  getPoleStarPlace(poleStarForLatitude(_latitude), _jd, &_poleRa, &_poleDec);
+  _elementsJd = _jd;
+  _elementsValid = true;
+  
+  // 極星が切り替わった場合に備えて、このtickの時角も取り直す
+  updatePoleHourAngle();
+}
+
+void Ephemeris::updatePoleHourAngle() {
+  _poleHourAngle = fmod(_lst - _poleRa, 360.0);
+  if (_poleHourAngle < 0) _poleHourAngle += 360.0;
+}
+
+void Ephemeris::updatePositions() {
+  if (!_hasTime) {
+    // 時刻がない場合は従来の計算（固定日時）で北極星の方位を求める
+    calculatePolePosition(_latitude, _longitude, &_poleAz, &_poleAlt);
+    return;
+  }
+  
+  calculatePolarisPosition(_latitude, _poleHourAngle, _poleDec, &_poleAz, &_poleAlt);
+  _poleAlt += getRefraction(_poleAlt, _temperature, _pressure);
+  equatorialToHorizontal(_latitude, _lst - _sunRa, _sunDec, &_sunAz, &_sunAlt);
+  equatorialToHorizontal(_latitude, _lst - _moonRa, _moonDec, &_moonAz, &_moonAlt);
+}
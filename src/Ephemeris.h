@@ -0,0 +1,142 @@
+/*
+ * Ephemeris.h
+ * 
+ * Cached celestial ephemeris for the Polaris Navigator
+ * Derives the Julian date and sidereal time once per tick from a UTC
+ * reference and refreshes each result only as often as it changes
+ * 
+ * TimeBaseが設定されていればGPSで合わせたUTCを使い、
+ * ない場合はsetTime()の基準からmillis()で時刻を進める。
+ * 
+ * 更新周期:
+ * - ユリウス日・恒星時: 毎tick（基準時刻からの経過時間を加算するだけ）
+ * - 極星の時角と方位、太陽・月の高度と方位: 約1Hz
+ * - 太陽・月・極星の赤経赤緯: 1分ごと（極星は事前計算した視位置の表を補間）
+ * - 地磁気（偏角・伏角・全磁力）: 位置が変わったときのみ
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef EPHEMERIS_H
+#define EPHEMERIS_H
+
+#include "hal.h"
+#include "TimeBase.h"
+#include "magnetic_model.h"
+
+// Update intervals
+#define EPHEMERIS_POSITION_INTERVAL_MS 1000    // 高度・方位の更新間隔（ミリ秒）
+#define EPHEMERIS_ELEMENTS_INTERVAL_S  60.0    // 赤経赤緯の更新間隔（秒）
+
+// 恒星時を直接計算し直す間隔（日）。その間は経過時間で補間する
+#define EPHEMERIS_SIDEREAL_REBASE_DAYS (1.0 / 24.0)
+
+// 位置がこれ以上変わったら地磁気と天体位置を再計算する（度）
+#define EPHEMERIS_LOCATION_EPSILON     0.01f
+
+class Ephemeris {
+public:
+  // Constructor
+  Ephemeris();
+  
+  // Set the observer location (cheap when unchanged)
+  void setLocation(float latitude, float longitude);
+  
+  // Set the ambient conditions used for the refraction of the pole altitude
+  // altitudeMは海抜高度（GPS）。気圧は標準大気から求める
+  void setAtmosphere(float temperatureC, float altitudeM);
+  
+  // Use a GPS-disciplined time base as the clock (nullptr to disable)
+  void setTimeBase(const TimeBase* timeBase) { _timeBase = timeBase; }
+  
+  // Set the UTC time reference (cheap when unchanged)
+  // 値が変わったときだけ基準を取り直し、以降はmillis()で時刻を進める
+  // TimeBaseが有効な間は無視される
+  void setTime(int year, int month, int day, int hour, int minute, int second);
+  
+  // Advance the clock and refresh whatever is due (call every loop)
+  // Returns true when positions were recomputed on this call
+  bool update();
+  
+  // Force every cached value to be recomputed on the next update()
+  void invalidate();
+  
+  // Time
+  bool hasTime() const { return _hasTime; }
+  double getJulianDate() const { return _jd; }
+  double getLocalSiderealTime() const { return _lst; }  // degrees
+  
+  // Celestial pole (altitude = apparent pole, azimuth = pole star)
+  // 南半球でははちぶんぎ座σ星の方位と時角になる
+  double getPoleHourAngle() const { return _poleHourAngle; }  // degrees
+  float getPoleAzimuth() const { return _poleAz; }
+  float getPoleAltitude() const { return _poleAlt; }
+  
+  // Sun and Moon (valid only when hasTime())
+  float getSunAzimuth() const { return _sunAz; }
+  float getSunAltitude() const { return _sunAlt; }
+  float getMoonAzimuth() const { return _moonAz; }
+  float getMoonAltitude() const { return _moonAlt; }
+  float getMoonPhase() const { return _moonPhase; }
+  
+  // Expected geomagnetic field for the current location (World Magnetic Model)
+  // 伏角と全磁力は較正や磁気干渉の検出の基準に使う
+  const MagneticField& getMagneticField() const { return _magField; }
+  float getMagneticDeclination() const { return _magField.declination; }
+  float getMagneticInclination() const { return _magField.inclination; }
+  float getMagneticFieldStrength() const { return _magField.fieldStrength; }  // uT
+
+private:
+  // Recompute the Sun/Moon/pole star equatorial coordinates
+  void updateElements();
+  
+  // Hour angle of the pole star from the current sidereal time
+  void updatePoleHourAngle();
+  
+  // Recompute altitude/azimuth from the cached coordinates
+  void updatePositions();
+  
+  // Location
+  float _latitude;
+  float _longitude;
+  bool _hasLocation;
+  bool _locationChanged;
+  
+  // Time reference
+  const TimeBase* _timeBase;
+  bool _liveTime;             // 現在の基準がTimeBaseから取ったものか
+  bool _hasTime;
+  int32_t _refDate;           // 基準時刻の年月日（変化の検出用）
+  int32_t _refSeconds;        // 基準時刻の0時からの秒数
+  uint32_t _timeRefMs;        // 基準時刻を設定したときのmillis()
+  double _jdRef;              // 基準時刻のユリウス日
+  double _gmstRef;            // 基準時刻のグリニッジ恒星時（度）
+  
+  // Per-tick values
+  double _jd;
+  double _lst;
+  double _poleHourAngle;
+  
+  // Cached coordinates
+  double _elementsJd;         // 赤経赤緯を計算したユリウス日
+  bool _elementsValid;
+  double _sunRa, _sunDec;
+  double _moonRa, _moonDec;
+  double _poleRa, _poleDec;   // 極星の視位置（GMST基準の赤経）
+  uint32_t _lastPositionMs;
+  bool _positionsValid;
+  
+  // Results
+  float _poleAz, _poleAlt;
+  float _sunAz, _sunAlt;
+  float _moonAz, _moonAlt;
+  float _moonPhase;
+  MagneticField _magField;
+  
+  // Atmosphere (refraction)
+  float _temperature;
+  float _pressure;
+};
+
+#endif // EPHEMERIS_H
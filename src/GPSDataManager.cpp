@@ -8,9 +8,15 @@
  */
 
 #include "GPSDataManager.h"
+#include "Logger.h"
+
+// 保存レコードの大きさの上限
+static_assert(sizeof(GPSData) <= PERSIST_MAX_RECORD_SIZE, "GPSData does not fit in a record");
 
 // コンストラクタ
-GPSDataManager::GPSDataManager() {
+GPSDataManager::GPSDataManager(PersistenceStore* store) {
+  _store = store;
+  memset(&_stored, 0, sizeof(_stored));
   _lastSaveTime = 0;
   _saveIntervalMs = 60 * 60 * 1000; // デフォルト: 60分（フラッシュメモリの寿命を考慮）
   _hasStoredData = false;
@@ -18,11 +24,20 @@ GPSDataManager::GPSDataManager() {
 
 // 初期化
 void GPSDataManager::begin() {
-  // Preferencesの初期化
-  _preferences.begin(NAMESPACE, false);
-  
-  // 保存されたデータがあるか確認
-  _hasStoredData = _preferences.getBool(KEY_HAS_DATA, false);
+  // 保存されたデータを取得（起動時にストアが読み込み済み）
+  _hasStoredData = _store->attach(PERSIST_GPS, &_stored, sizeof(_stored), GPS_RECORD_VERSION);
+  
+  // 旧形式から移行し、古い名前空間を消す
+  if (!_hasStoredData && loadLegacyGPSData()) {
+    _hasStoredData = true;
+    _store->requestSave(PERSIST_GPS);
+    _store->flush();
+    Preferences legacy;
+    legacy.begin(LEGACY_NAMESPACE, false);
+    legacy.clear();
+    legacy.end();
+    Serial.println("Migrated GPS data to the persistence store");
+  }
   
   Serial.print("GPS Data Manager initialized. Stored data: ");
   Serial.println(_hasStoredData ? "Yes" : "No");
@@ -39,28 +54,16 @@ bool GPSDataManager::saveGPSData(const GPSData& data) {
     return false;
   }
   
-  // 各データを保存
-  _preferences.putFloat(KEY_LATITUDE, data.latitude);
-  _preferences.putFloat(KEY_LONGITUDE, data.longitude);
-  _preferences.putFloat(KEY_ALTITUDE, data.altitude);
-  _preferences.putInt(KEY_SATELLITES, data.satellites);
-  _preferences.putFloat(KEY_HDOP, data.hdop);
-  
-  _preferences.putInt(KEY_YEAR, data.year);
-  _preferences.putInt(KEY_MONTH, data.month);
-  _preferences.putInt(KEY_DAY, data.day);
-  _preferences.putInt(KEY_HOUR, data.hour);
-  _preferences.putInt(KEY_MINUTE, data.minute);
-  _preferences.putInt(KEY_SECOND, data.second);
-  
-  _preferences.putULong(KEY_LAST_UPDATE, currentTime);
-  _preferences.putBool(KEY_HAS_DATA, true);
+  // ストアのレコードを更新（書き込みはまとめて行われる）
+  _stored = data;
+  _stored.lastUpdateTime = currentTime;
+  _store->requestSave(PERSIST_GPS);
   
   // 状態を更新
   _lastSaveTime = currentTime;
   _hasStoredData = true;
   
-  Serial.println("GPS data saved to flash memory");
+  Serial.println("GPS data queued for flash memory");
   Serial.print("Location: ");
   Serial.print(data.latitude, 6);
   Serial.print(", ");
@@ -77,28 +80,10 @@ bool GPSDataManager::loadGPSData(GPSData& data) {
     return false;
   }
   
-  // 各データを読み込み
-  data.latitude = _preferences.getFloat(KEY_LATITUDE, 0.0);
-  data.longitude = _preferences.getFloat(KEY_LONGITUDE, 0.0);
-  data.altitude = _preferences.getFloat(KEY_ALTITUDE, 0.0);
-  data.satellites = _preferences.getInt(KEY_SATELLITES, 0);
-  data.hdop = _preferences.getFloat(KEY_HDOP, 99.99);
-  
-  data.year = _preferences.getInt(KEY_YEAR, 2025);
-  data.month = _preferences.getInt(KEY_MONTH, 3);
-  data.day = _preferences.getInt(KEY_DAY, 29);
-  data.hour = _preferences.getInt(KEY_HOUR, 0);
-  data.minute = _preferences.getInt(KEY_MINUTE, 0);
-  data.second = _preferences.getInt(KEY_SECOND, 0);
-  
-  data.lastUpdateTime = _preferences.getULong(KEY_LAST_UPDATE, 0);
-  
-  Serial.println("Loaded GPS data from flash memory");
-  Serial.print("Location: ");
-  Serial.print(data.latitude, 6);
-  Serial.print(", ");
-  Serial.println(data.longitude, 6);
+  // RAM上のレコードをコピー（フラッシュは起動時に1回だけ読む）
+  data = _stored;
   
+  LOG_V_EVERY(LOG_TAG_GPS, 10000, "Using stored GPS data: %.6f, %.6f", data.latitude, data.longitude);
   return true;
 }
 
@@ -109,7 +94,7 @@ bool GPSDataManager::hasStoredData() {
 
 // 最終更新時刻の取得
 unsigned long GPSDataManager::getLastUpdateTime() {
-  return _preferences.getULong(KEY_LAST_UPDATE, 0);
+  return _stored.lastUpdateTime;
 }
 
 // 保存間隔の設定（分単位）
@@ -136,3 +121,32 @@ bool GPSDataManager::shouldSaveData(unsigned long currentTime) {
   // 保存間隔をチェック
   return (currentTime - _lastSaveTime) >= _saveIntervalMs;
 }
+
+// 旧形式（キーごとの保存）の読み込み
+bool GPSDataManager::loadLegacyGPSData() {
+  Preferences preferences;
+  if (!preferences.begin(LEGACY_NAMESPACE, true)) {
+    return false;
+  }
+  if (!preferences.getBool("has", false)) {
+    preferences.end();
+    return false;
+  }
+  
+  _stored.latitude = preferences.getFloat("lat", 0.0);
+  _stored.longitude = preferences.getFloat("lon", 0.0);
+  _stored.altitude = preferences.getFloat("alt", 0.0);
+  _stored.satellites = preferences.getInt("sat", 0);
+  _stored.hdop = preferences.getFloat("hdop", 99.99);
+  
+  _stored.year = preferences.getInt("year", 2025);
+  _stored.month = preferences.getInt("month", 3);
+  _stored.day = preferences.getInt("day", 29);
+  _stored.hour = preferences.getInt("hour", 0);
+  _stored.minute = preferences.getInt("min", 0);
+  _stored.second = preferences.getInt("sec", 0);
+  
+  _stored.lastUpdateTime = preferences.getULong("lupd", 0);
+  preferences.end();
+  return true;
+}
@@ -12,6 +12,10 @@
 
 #include <Arduino.h>
 #include <Preferences.h>
+#include "PersistenceStore.h"
+
+// Layout version of GPSData in the persistence store
+#define GPS_RECORD_VERSION 1
 
 // GPS情報の構造体
 struct GPSData {
@@ -36,7 +40,7 @@ struct GPSData {
 class GPSDataManager {
 public:
   // コンストラクタ
-  GPSDataManager();
+  GPSDataManager(PersistenceStore* store);
   
   // 初期化
   void begin();
@@ -58,30 +62,19 @@ public:
   
   // 保存間隔が経過したかどうか
   bool shouldSaveData(unsigned long currentTime);
-  
+
 private:
-  Preferences _preferences;
+  // 旧形式（キーごとの保存）の読み込み（移行用）
+  bool loadLegacyGPSData();
+  
+  PersistenceStore* _store;
+  GPSData _stored;               // 保存済みのデータ（ストアのレコード）
   unsigned long _lastSaveTime;
   unsigned long _saveIntervalMs; // 保存間隔（ミリ秒）
   bool _hasStoredData;
   
-  // 保存用の名前空間
-  const char* NAMESPACE = "gpsdata";
-  
-  // 保存キー
-  const char* KEY_LATITUDE = "lat";
-  const char* KEY_LONGITUDE = "lon";
-  const char* KEY_ALTITUDE = "alt";
-  const char* KEY_SATELLITES = "sat";
-  const char* KEY_HDOP = "hdop";
-  const char* KEY_YEAR = "year";
-  const char* KEY_MONTH = "month";
-  const char* KEY_DAY = "day";
-  const char* KEY_HOUR = "hour";
-  const char* KEY_MINUTE = "min";
-  const char* KEY_SECOND = "sec";
-  const char* KEY_LAST_UPDATE = "lupd";
-  const char* KEY_HAS_DATA = "has";
+  // 旧形式の名前空間
+  const char* LEGACY_NAMESPACE = "gpsdata";
 };
 
 #endif // GPS_DATA_MANAGER_H
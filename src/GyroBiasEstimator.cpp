@@ -0,0 +1,260 @@
+/*
+ * GyroBiasEstimator.cpp
+ * 
+ * Implementation of the background gyro bias estimator
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "GyroBiasEstimator.h"
+#include <math.h>
+#include "Logger.h"
+
+// Constructor
+GyroBiasEstimator::GyroBiasEstimator() {
+  memset(&_model, 0, sizeof(_model));
+  _model.version = GYRO_TC_MODEL_VERSION;
+  _fitValid = false;
+  _modelChanged = false;
+  _observations = 0;
+  reset();
+}
+
+void GyroBiasEstimator::reset() {
+  _statsValid = false;
+  _stillTime = 0.0f;
+  _segmentCount = 0;
+  _segmentTime = 0.0f;
+  _segmentTempSum = 0.0f;
+  _segmentTempCount = 0;
+  _segmentMagValid = false;
+  memset(_segmentSum, 0, sizeof(_segmentSum));
+  memset(_liveBias, 0, sizeof(_liveBias));
+  _liveTemperature = 0.0f;
+  _liveValid = false;
+}
+
+void GyroBiasEstimator::setModel(const GyroTempModel& model) {
+  if (model.version != GYRO_TC_MODEL_VERSION) {
+    LOG_W(LOG_TAG_IMU, "Ignoring gyro temperature model version %u", (unsigned)model.version);
+    return;
+  }
+  _model = model;
+  fitModel();
+}
+
+bool GyroBiasEstimator::takeModelChanged() {
+  bool changed = _modelChanged;
+  _modelChanged = false;
+  return changed;
+}
+
+void GyroBiasEstimator::update(const float gyro[3], const float acc[3], const float mag[3],
+                               float temperature, float dt) {
+  // 短時間の平均と分散（指数移動平均）
+  float alpha = dt / (GYRO_BIAS_STATS_TAU_S + dt);
+  if (!_statsValid) {
+    for (int i = 0; i < 3; i++) {
+      _gyroMean[i] = gyro[i];
+      _accMean[i] = acc[i];
+      _gyroVar[i] = GYRO_BIAS_STILL_GYRO_STD_DPS * GYRO_BIAS_STILL_GYRO_STD_DPS * 4.0f;
+      _accVar[i] = GYRO_BIAS_STILL_ACC_STD_G * GYRO_BIAS_STILL_ACC_STD_G * 4.0f;
+    }
+    _statsValid = true;
+  }
+  
+  bool still = true;
+  for (int i = 0; i < 3; i++) {
+    float dg = gyro[i] - _gyroMean[i];
+    float da = acc[i] - _accMean[i];
+    _gyroMean[i] += alpha * dg;
+    _accMean[i] += alpha * da;
+    _gyroVar[i] += alpha * (dg * dg - _gyroVar[i]);
+    _accVar[i] += alpha * (da * da - _accVar[i]);
+    
+    if (_gyroVar[i] > GYRO_BIAS_STILL_GYRO_STD_DPS * GYRO_BIAS_STILL_GYRO_STD_DPS ||
+        _accVar[i] > GYRO_BIAS_STILL_ACC_STD_G * GYRO_BIAS_STILL_ACC_STD_G ||
+        fabsf(_gyroMean[i]) > GYRO_BIAS_MAX_DPS) {
+      still = false;
+    }
+    // 一定速度の回転は分散が小さいので、既知のバイアスから大きく離れたものも除く
+    if (_liveValid && fabsf(_gyroMean[i] - _liveBias[i]) > GYRO_BIAS_MAX_STEP_DPS) {
+      still = false;
+    }
+  }
+  
+  if (!still) {
+    // 動いたら途中の区間は捨てる（分散の遅れの分だけ動きを含むため）
+    _stillTime = 0.0f;
+    _segmentCount = 0;
+    _segmentTime = 0.0f;
+    return;
+  }
+  
+  _stillTime += dt;
+  if (_stillTime < GYRO_BIAS_SETTLE_S) {
+    return;
+  }
+  
+  // 静止区間の平均を取る
+  if (_segmentCount == 0) {
+    memset(_segmentSum, 0, sizeof(_segmentSum));
+    _segmentTempSum = 0.0f;
+    _segmentTempCount = 0;
+    _segmentMagValid = mag != nullptr;
+    if (_segmentMagValid) {
+      _segmentMag[0] = mag[0];
+      _segmentMag[1] = mag[1];
+      _segmentMag[2] = mag[2];
+    }
+  }
+  for (int i = 0; i < 3; i++) {
+    _segmentSum[i] += gyro[i];
+  }
+  if (!isnan(temperature)) {
+    _segmentTempSum += temperature;
+    _segmentTempCount++;
+  }
+  _segmentCount++;
+  _segmentTime += dt;
+  
+  if (_segmentTime < GYRO_BIAS_SEGMENT_S) {
+    return;
+  }
+  
+  // 区間中に地磁気の向きが変わっていれば回転していた
+  bool turned = false;
+  if (_segmentMagValid && mag != nullptr) {
+    float dot = _segmentMag[0] * mag[0] + _segmentMag[1] * mag[1] + _segmentMag[2] * mag[2];
+    float n0 = _segmentMag[0] * _segmentMag[0] + _segmentMag[1] * _segmentMag[1] +
+               _segmentMag[2] * _segmentMag[2];
+    float n1 = mag[0] * mag[0] + mag[1] * mag[1] + mag[2] * mag[2];
+    if (n0 > 0.0f && n1 > 0.0f) {
+      float c = dot / sqrtf(n0 * n1);
+      turned = c < cosf(GYRO_BIAS_MAX_MAG_TURN_DEG * DEG_TO_RAD);
+    }
+  }
+  
+  if (!turned) {
+    float mean[3];
+    for (int i = 0; i < 3; i++) {
+      mean[i] = _segmentSum[i] / _segmentCount;
+    }
+    float segmentTemp = _segmentTempCount > 0 ? _segmentTempSum / _segmentTempCount : NAN;
+    addObservation(mean, segmentTemp);
+  } else {
+    LOG_D(LOG_TAG_IMU, "Gyro bias segment rejected (slow rotation)");
+  }
+  _segmentCount = 0;
+  _segmentTime = 0.0f;
+}
+
+void GyroBiasEstimator::addObservation(const float bias[3], float temperature) {
+  if (!_liveValid) {
+    for (int i = 0; i < 3; i++) {
+      _liveBias[i] = bias[i];
+    }
+    _liveValid = true;
+  } else {
+    for (int i = 0; i < 3; i++) {
+      _liveBias[i] += GYRO_BIAS_GAIN * (bias[i] - _liveBias[i]);
+    }
+  }
+  _liveTemperature = temperature;
+  _observations++;
+  
+  LOG_D(LOG_TAG_IMU, "Gyro bias: %.3f, %.3f, %.3f dps at %.1f C",
+        _liveBias[0], _liveBias[1], _liveBias[2], temperature);
+  
+  if (isnan(temperature)) {
+    return;
+  }
+  
+  // 該当する温度ビンの平均を更新（重みの上限で古い観測を置き換える）
+  int bin = (int)floorf((temperature - GYRO_TC_MIN_C) / GYRO_TC_BIN_C);
+  if (bin < 0 || bin >= GYRO_TC_BINS) {
+    return;
+  }
+  if (_model.weight[bin] < GYRO_TC_MAX_WEIGHT) {
+    _model.weight[bin]++;
+  }
+  float gain = 1.0f / _model.weight[bin];
+  for (int i = 0; i < 3; i++) {
+    _model.bias[bin][i] += gain * (bias[i] - _model.bias[bin][i]);
+  }
+  fitModel();
+  _modelChanged = true;
+}
+
+void GyroBiasEstimator::fitModel() {
+  // 重み付き最小二乗（ビンの中心温度に対する1次式）
+  float sw = 0.0f, st = 0.0f, stt = 0.0f;
+  float sb[3] = { 0.0f, 0.0f, 0.0f };
+  float stb[3] = { 0.0f, 0.0f, 0.0f };
+  float minT = 1e9f, maxT = -1e9f;
+  for (int bin = 0; bin < GYRO_TC_BINS; bin++) {
+    if (_model.weight[bin] == 0) {
+      continue;
+    }
+    float w = _model.weight[bin];
+    float t = GYRO_TC_MIN_C + (bin + 0.5f) * GYRO_TC_BIN_C;
+    sw += w;
+    st += w * t;
+    stt += w * t * t;
+    for (int i = 0; i < 3; i++) {
+      sb[i] += w * _model.bias[bin][i];
+      stb[i] += w * t * _model.bias[bin][i];
+    }
+    if (t < minT) minT = t;
+    if (t > maxT) maxT = t;
+  }
+  
+  _fitValid = sw > 0.0f;
+  if (!_fitValid) {
+    return;
+  }
+  
+  _fitTemperature = st / sw;
+  float var = stt / sw - _fitTemperature * _fitTemperature;
+  for (int i = 0; i < 3; i++) {
+    _fitOffset[i] = sb[i] / sw;
+    _fitSlope[i] = 0.0f;
+    
+    // 温度範囲が狭い間は傾きを求めない
+    if (maxT - minT >= GYRO_TC_MIN_SPAN_C && var > 0.0f) {
+      float slope = (stb[i] / sw - _fitTemperature * _fitOffset[i]) / var;
+      _fitSlope[i] = constrain(slope, -GYRO_TC_MAX_SLOPE, GYRO_TC_MAX_SLOPE);
+    }
+  }
+}
+
+bool GyroBiasEstimator::getBias(float temperature, float bias[3]) const {
+  bool hasTemp = !isnan(temperature);
+  
+  // 直近の静止観測を基準に、温度変化分だけ補正する
+  if (_liveValid) {
+    bool shift = hasTemp && !isnan(_liveTemperature) && _fitValid;
+    for (int i = 0; i < 3; i++) {
+      bias[i] = _liveBias[i] + (shift ? _fitSlope[i] * (temperature - _liveTemperature) : 0.0f);
+    }
+    return true;
+  }
+  
+  // 静止観測前は保存済みのモデルから求める
+  if (_fitValid) {
+    for (int i = 0; i < 3; i++) {
+      bias[i] = _fitOffset[i] + (hasTemp ? _fitSlope[i] * (temperature - _fitTemperature) : 0.0f);
+    }
+    return true;
+  }
+  
+  bias[0] = bias[1] = bias[2] = 0.0f;
+  return false;
+}
+
+void GyroBiasEstimator::getTemperatureSlope(float slope[3]) const {
+  for (int i = 0; i < 3; i++) {
+    slope[i] = _fitValid ? _fitSlope[i] : 0.0f;
+  }
+}
@@ -0,0 +1,122 @@
+/*
+ * GyroBiasEstimator.h
+ * 
+ * Background gyro bias estimation for the Polaris Navigator
+ * Detects stillness on the sensor stream, averages the gyro while the
+ * device sits on the mount and learns a bias-vs-temperature model
+ * 
+ * 静止判定: 角速度と加速度の短時間の分散が小さく、地磁気の向きも
+ * 変わっていない（ゆっくりした回転をバイアスと誤認しない）こと。
+ * 静止区間の平均をバイアスの観測とし、IMU温度ごとのビンに蓄積して
+ * 温度に対する1次式（オフセットと傾き）を最小二乗で求める。
+ * 
+ * 出力: 直近の静止観測をオフセットとし、温度変化分を傾きで補正する。
+ * 起動直後（静止観測前）は保存済みのモデルから温度で求める。
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef GYRO_BIAS_ESTIMATOR_H
+#define GYRO_BIAS_ESTIMATOR_H
+
+#include "hal.h"
+
+// Stillness detection
+#define GYRO_BIAS_STATS_TAU_S        0.25f   // 分散を求めるローパスの時定数（秒）
+#define GYRO_BIAS_STILL_GYRO_STD_DPS 0.2f    // 静止とみなす角速度の標準偏差（各軸、dps）
+#define GYRO_BIAS_STILL_ACC_STD_G    0.01f   // 静止とみなす加速度の標準偏差（各軸、g）
+#define GYRO_BIAS_MAX_DPS            5.0f    // これより大きい平均角速度はバイアスとみなさない
+#define GYRO_BIAS_MAX_STEP_DPS       0.5f    // 推定済みのバイアスからの最大の変化（dps）
+#define GYRO_BIAS_SETTLE_S           1.0f    // 静止してから平均を始めるまでの時間（秒）
+#define GYRO_BIAS_SEGMENT_S          5.0f    // 1回の観測の平均時間（秒）
+#define GYRO_BIAS_MAX_MAG_TURN_DEG   1.0f    // 観測中の地磁気の向きの変化の上限（度）
+#define GYRO_BIAS_GAIN               0.5f    // 観測ごとのバイアス更新の係数
+
+// Temperature model (温度ビン)
+#define GYRO_TC_MIN_C                -20.0f  // 最初のビンの下限温度
+#define GYRO_TC_BIN_C                2.0f    // ビンの幅（度C）
+#define GYRO_TC_BINS                 40      // -20〜60度C
+#define GYRO_TC_MAX_WEIGHT           50      // ビンの重みの上限（古い観測を徐々に置き換える）
+#define GYRO_TC_MIN_SPAN_C           4.0f    // 傾きを求めるのに必要な温度範囲
+#define GYRO_TC_MAX_SLOPE            0.1f    // 傾きの上限（dps/度C）
+#define GYRO_TC_MODEL_VERSION        1
+
+// Bias-vs-temperature observations (persisted as a blob)
+struct GyroTempModel {
+  uint8_t version;
+  uint8_t weight[GYRO_TC_BINS];      // ビンの観測数（0 = 未観測）
+  float bias[GYRO_TC_BINS][3];       // ビンごとのバイアス（dps、センサー座標系）
+};
+
+class GyroBiasEstimator {
+public:
+  // Constructor
+  GyroBiasEstimator();
+  
+  // Discard the live estimate and the stillness state (the model is kept)
+  void reset();
+  
+  // Use a stored temperature model / copy the current one
+  void setModel(const GyroTempModel& model);
+  const GyroTempModel& getModel() const { return _model; }
+  
+  // Feed one sample: gyro (dps), acc (g), corrected mag (uT, nullptr if
+  // unavailable), IMU temperature (NAN if unavailable) and dt (s)
+  void update(const float gyro[3], const float acc[3], const float mag[3],
+              float temperature, float dt);
+  
+  // Bias at the given temperature (dps). Returns false while nothing is known.
+  bool getBias(float temperature, float bias[3]) const;
+  
+  // Stillness / estimator state
+  bool isStationary() const { return _stillTime >= GYRO_BIAS_SETTLE_S; }
+  bool hasLiveEstimate() const { return _liveValid; }
+  uint32_t getObservationCount() const { return _observations; }
+  
+  // Temperature slope of the model (dps per degree C, 0 until learned)
+  void getTemperatureSlope(float slope[3]) const;
+  
+  // True once after the model changed (for persisting)
+  bool takeModelChanged();
+
+private:
+  // Add one still-segment average to the live estimate and the model
+  void addObservation(const float bias[3], float temperature);
+  
+  // Fit the linear model to the populated bins
+  void fitModel();
+  
+  // Short-term statistics for the stillness test
+  bool _statsValid;
+  float _gyroMean[3];
+  float _gyroVar[3];
+  float _accMean[3];
+  float _accVar[3];
+  float _stillTime;
+  
+  // Current still segment
+  float _segmentSum[3];
+  float _segmentTempSum;
+  uint16_t _segmentTempCount;
+  uint16_t _segmentCount;
+  float _segmentTime;
+  float _segmentMag[3];
+  bool _segmentMagValid;
+  
+  // Live estimate (直近の静止観測)
+  float _liveBias[3];
+  float _liveTemperature;
+  bool _liveValid;
+  uint32_t _observations;
+  
+  // Temperature model
+  GyroTempModel _model;
+  float _fitOffset[3];     // 基準温度でのバイアス
+  float _fitSlope[3];
+  float _fitTemperature;   // 基準温度（観測の重み付き平均）
+  bool _fitValid;
+  bool _modelChanged;
+};
+
+#endif // GYRO_BIAS_ESTIMATOR_H
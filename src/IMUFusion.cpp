@@ -8,37 +8,18 @@
  */
 
 #include "IMUFusion.h"
-#include "myMahonyAHRS.h"
 #include <math.h>
 #include <M5Unified.h>  // M5.update()を使用するために必要
 
-// Constants
-#define RAD_TO_DEG 57.2957795131  // 180/PI
-#define DEG_TO_RAD 0.01745329251  // PI/180
-
 IMUFusion::IMUFusion(BMI270 *bmi270, BMM150class *bmm150) {
   _bmi270 = bmi270;
   _bmm150 = bmm150;
   
-  // Initialize quaternion to identity
-  _q0 = 1.0f;
-  _q1 = 0.0f;
-  _q2 = 0.0f;
-  _q3 = 0.0f;
-  
-  // Initialize Euler angles
-  _yaw = 0.0f;
-  _pitch = 0.0f;
-  _roll = 0.0f;
-  
   // Default filter parameters
-  _filterGain = 0.05f;  // 95% gyro, 5% accel/mag
+  _filterGain = AHRS_MADGWICK_BETA;
   _magDeclination = 0.0f;
   
   _isCalibrated = false;
-  
-  // Initialize complementary filter values
-  _alpha = 0.98f;  // 98% gyro, 2% accel/mag for complementary filter
   _lastUpdate = 0;
 }
 
@@ -47,21 +28,21 @@ void IMUFusion::begin() {
   _bmi270->readAcceleration();
   _bmm150->readMagnetometer();
   
-  // Initialize MahonyAHRS algorithm
-  myIMU::MahonyAHRSinit();
-  
-  // Set default values for Mahony algorithm
-  myIMU::myKp = 8.0f;  // 比例ゲイン
-  myIMU::myKi = 0.0f;  // 積分ゲイン
-  
-  _lastUpdate = millis();
+  reset();
+}
+
+void IMUFusion::reset() {
+  // 次のupdate()で加速度・地磁気から姿勢を初期化し直す
+  _engine.reset();
+  _lastUpdate = micros();
 }
 
 void IMUFusion::update(float deltaTime) {
   // If deltaTime is not provided, calculate it
+  // millis()では1ms単位に丸められてdtが揺らぐため、micros()で計測する
   if (deltaTime <= 0) {
-    unsigned long now = millis();
-    deltaTime = (now - _lastUpdate) / 1000.0f;
+    unsigned long now = micros();
+    deltaTime = (now - _lastUpdate) / 1000000.0f;
     _lastUpdate = now;
     
     // Sanity check for deltaTime
@@ -76,44 +57,20 @@ void IMUFusion::update(float deltaTime) {
   _bmm150->readMagnetometer();
   
   // リンク先のコードを参考にした軸調整
-  float gx = _bmi270->gyr_y * DEG_TO_RAD;
-  float gy = -_bmi270->gyr_x * DEG_TO_RAD;
-  float gz = _bmi270->gyr_z * DEG_TO_RAD;
-  
-  float ax = _bmi270->acc_y;
-  float ay = -_bmi270->acc_x;
-  float az = _bmi270->acc_z;
-  
-  float mx = -_bmm150->mag_x;
-  float my = _bmm150->mag_y;
-  float mz = -_bmm150->mag_z;
+  float gyro[3] = {_bmi270->gyr_y, -_bmi270->gyr_x, _bmi270->gyr_z};
+  float acc[3] = {_bmi270->acc_y, -_bmi270->acc_x, _bmi270->acc_z};
+  float mag[3] = {-_bmm150->mag_x, _bmm150->mag_y, -_bmm150->mag_z};
   
-  // MahonyAHRSアルゴリズムを使用して姿勢を更新
-  myIMU::MahonyAHRSupdate(gx, gy, gz, ax, ay, az, mx, my, mz, deltaTime);
-  
-  // クォータニオンをコピー
-  _q0 = myIMU::q[0];
-  _q1 = myIMU::q[1];
-  _q2 = myIMU::q[2];
-  _q3 = myIMU::q[3];
-  
-  // クォータニオンからオイラー角を計算
-  updateEulerAngles();
+  _engine.update(acc, gyro, mag, deltaTime);
+}
+
+void IMUFusion::update(const float acc[3], const float gyro[3], const float mag[3], float deltaTime) {
+  _engine.update(acc, gyro, mag, deltaTime);
 }
 
 float IMUFusion::getYaw() {
-  // リンク先のコードを参考にした方位角計算
-  float yaw = atan2(2*(_q1*_q2 + _q0*_q3), _q0*_q0+_q1*_q1-_q2*_q2-_q3*_q3);
-  
-  // 調整（リンク先のコードと同様）
-  yaw = -yaw - PI/2;
-  
-  // 0〜2π（0〜360度）の範囲に正規化
-  if (yaw < 0) yaw += 2*PI;
-  if (yaw > 2*PI) yaw -= 2*PI;
-  
-  // ラジアンから度に変換
-  yaw *= RAD_TO_DEG;
+  float yaw, pitch, roll;
+  _engine.getEuler(&yaw, &pitch, &roll);
   
   // 磁気偏角の補正を適用
   yaw += _magDeclination;
@@ -126,18 +83,24 @@ float IMUFusion::getYaw() {
 }
 
 float IMUFusion::getPitch() {
-  return _pitch;
+  float yaw, pitch, roll;
+  _engine.getEuler(&yaw, &pitch, &roll);
+  return pitch;
 }
 
 float IMUFusion::getRoll() {
-  return _roll;
+  float yaw, pitch, roll;
+  _engine.getEuler(&yaw, &pitch, &roll);
+  return roll;
 }
 
 void IMUFusion::getQuaternion(float *q0, float *q1, float *q2, float *q3) {
-  *q0 = _q0;
-  *q1 = _q1;
-  *q2 = _q2;
-  *q3 = _q3;
+  float q[4];
+  _engine.getQuaternion(q);
+  *q0 = q[0];
+  *q1 = q[1];
+  *q2 = q[2];
+  *q3 = q[3];
 }
 
 void IMUFusion::calibrateMagnetometer() {
@@ -176,31 +139,14 @@ bool IMUFusion::isCalibrated() {
 void IMUFusion::setFilterGain(float gain) {
   if (gain >= 0.0f && gain <= 1.0f) {
     _filterGain = gain;
-    // Also update complementary filter alpha
-    _alpha = 1.0f - gain;
-    if (_alpha > 0.99f) _alpha = 0.99f;
-    if (_alpha < 0.5f) _alpha = 0.5f;
+    _engine.setMadgwickBeta(gain);
   }
 }
 
-void IMUFusion::setMagneticDeclination(float declination) {
-  _magDeclination = declination;
-}
-
-void IMUFusion::updateEulerAngles() {
-  // リンク先のコードを参考にしたオイラー角計算
-  _pitch = asin(-2 * _q1 * _q3 + 2 * _q0 * _q2) * RAD_TO_DEG;
-  _roll = atan2(2 * _q2 * _q3 + 2 * _q0 * _q1, -2 * _q1 * _q1 - 2 * _q2 * _q2 + 1) * RAD_TO_DEG;
-  
-  // ヨー角（方位角）は getYaw() メソッドで計算
+void IMUFusion::setAlgorithm(AHRSAlgorithm algorithm) {
+  _engine.setAlgorithm(algorithm);
 }
 
-void IMUFusion::normalizeQuaternion() {
-  float norm = sqrt(_q0 * _q0 + _q1 * _q1 + _q2 * _q2 + _q3 * _q3);
-  if (norm > 0.0f) {
-    _q0 /= norm;
-    _q1 /= norm;
-    _q2 /= norm;
-    _q3 /= norm;
-  }
+void IMUFusion::setMagneticDeclination(float declination) {
+  _magDeclination = declination;
 }
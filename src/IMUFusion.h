@@ -2,7 +2,8 @@
  * IMUFusion.h
  * 
  * Sensor fusion for BMI270 (accelerometer/gyroscope) and BMM150 (magnetometer)
- * Implements a complementary filter for orientation estimation
+ * Reads the sensors directly and estimates orientation with AHRSEngine
+ * (the sensor task runs its own AHRSEngine and does not use this class)
  * 
  * Created: 2025-03-23
  * GitHub: https://github.com/kennel-org/polaris-navigator
@@ -14,6 +15,7 @@
 #include <Arduino.h>
 #include "BMI270.h"
 #include "BMM150class.h"
+#include "AHRSEngine.h"
 
 class IMUFusion {
 public:
@@ -23,10 +25,19 @@ public:
   // Initialize fusion algorithm
   void begin();
   
+  // Reset filter state without touching the sensors
+  void reset();
+  
   // Update orientation (call this regularly)
   // If deltaTime is not provided (or <= 0), it will be calculated automatically
   void update(float deltaTime = 0);
   
+  // Update orientation from an externally sampled reading
+  // acc (g), gyro (dps) and mag (uT) must share the same body frame;
+  // mag may be nullptr for a 6-axis update. deltaTime is the measured
+  // sample interval in seconds.
+  void update(const float acc[3], const float gyro[3], const float mag[3], float deltaTime);
+  
   // Get orientation in Euler angles (degrees)
   float getYaw();    // Heading/Azimuth (0-360)
   float getPitch();  // Pitch (-90 to 90)
@@ -41,6 +52,10 @@ public:
   
   // Set filter parameters
   void setFilterGain(float gain);
+  void setAlgorithm(AHRSAlgorithm algorithm);
+  
+  // Attitude filter (confidence, gyro bias)
+  const AHRSEngine& getEngine() const { return _engine; }
   
   // Apply declination correction
   void setMagneticDeclination(float declination);
@@ -50,24 +65,18 @@ private:
   BMI270 *_bmi270;
   BMM150class *_bmm150;
   
-  // Orientation representation
-  float _q0, _q1, _q2, _q3;  // Quaternion
-  float _yaw, _pitch, _roll;  // Euler angles in degrees
+  // Attitude filter
+  AHRSEngine _engine;
   
   // Filter parameters
-  float _filterGain;  // Complementary filter gain (0.0-1.0)
-  float _alpha;       // Complementary filter alpha (gyro weight)
+  float _filterGain;  // Madgwick beta (0.0-1.0)
   float _magDeclination;  // Magnetic declination correction in degrees
   
   // Timing
-  unsigned long _lastUpdate;  // Last update timestamp in milliseconds
+  unsigned long _lastUpdate;  // Last update timestamp in microseconds
   
   // Calibration status
   bool _isCalibrated;
-  
-  // Helper functions
-  void updateEulerAngles();
-  void normalizeQuaternion();
 };
 
 #endif // IMU_FUSION_H
@@ -0,0 +1,101 @@
+/*
+ * ImageDecoder.cpp
+ * 
+ * Implementation of the streaming RGB565 image decoder
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "ImageDecoder.h"
+
+// Op codes (see tools/gen_logo.py)
+#define IMG_OP_DIFF 0x40
+#define IMG_OP_LUMA 0x80
+#define IMG_OP_RUN  0xC0
+#define IMG_OP_RAW  0xFE
+
+// Constructor
+ImageDecoder::ImageDecoder() {
+  begin(nullptr, 0, 0);
+}
+
+void ImageDecoder::begin(const uint8_t* data, size_t size, uint32_t pixels) {
+  _data = data;
+  _end = data + size;
+  _prev = 0;
+  memset(_index, 0, sizeof(_index));
+  _run = 0;
+  _remaining = pixels;
+  _truncated = false;
+}
+
+uint8_t ImageDecoder::hash(uint16_t color) {
+  uint8_t r = (color >> 11) & 0x1F;
+  uint8_t g = (color >> 5) & 0x3F;
+  uint8_t b = color & 0x1F;
+  return (r * 3 + g * 5 + b * 7) & 0x3F;
+}
+
+size_t ImageDecoder::decode(uint16_t* out, size_t count) {
+  size_t written = 0;
+  
+  while (written < count && _remaining > 0) {
+    if (_run == 0) {
+      if (_data >= _end) {
+        // データが足りない場合は直前の色で埋める
+        _truncated = true;
+        _run = 1;
+      } else {
+        uint8_t op = *_data++;
+        
+        if (op == IMG_OP_RAW) {
+          if (_end - _data < 2) {
+            _truncated = true;
+            _data = _end;
+            continue;
+          }
+          _prev = (uint16_t)((_data[0] << 8) | _data[1]);
+          _data += 2;
+        } else if (op >= IMG_OP_RUN) {
+          _run = (op & 0x3F) + 1;
+          continue;
+        } else if (op >= IMG_OP_LUMA) {
+          if (_data >= _end) {
+            _truncated = true;
+            continue;
+          }
+          int dg = (op & 0x3F) - 32;
+          uint8_t n = *_data++;
+          int half = dg >> 1;
+          int r = ((_prev >> 11) + (n >> 4) - 8 + half) & 0x1F;
+          int g = (((_prev >> 5) & 0x3F) + dg) & 0x3F;
+          int b = ((_prev & 0x1F) + (n & 0x0F) - 8 + half) & 0x1F;
+          _prev = (uint16_t)((r << 11) | (g << 5) | b);
+        } else if (op >= IMG_OP_DIFF) {
+          int r = ((_prev >> 11) + ((op >> 4) & 3) - 2) & 0x1F;
+          int g = (((_prev >> 5) & 0x3F) + ((op >> 2) & 3) - 2) & 0x3F;
+          int b = ((_prev & 0x1F) + (op & 3) - 2) & 0x1F;
+          _prev = (uint16_t)((r << 11) | (g << 5) | b);
+        } else {
+          _prev = _index[op];
+        }
+        
+        _index[hash(_prev)] = _prev;
+        out[written++] = (uint16_t)((_prev << 8) | (_prev >> 8));
+        _remaining--;
+        continue;
+      }
+    }
+    
+    // 連続: 次の操作を読まずに直前の色を書き続ける
+    uint16_t swapped = (uint16_t)((_prev << 8) | (_prev >> 8));
+    while (_run > 0 && written < count && _remaining > 0) {
+      out[written++] = swapped;
+      _run--;
+      _remaining--;
+    }
+  }
+  
+  return written;
+}
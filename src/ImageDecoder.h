@@ -0,0 +1,52 @@
+/*
+ * ImageDecoder.h
+ * 
+ * Streaming decoder for the compressed RGB565 images made by tools/gen_logo.py
+ * Decodes a flash-resident image a few lines at a time so that it can be
+ * pushed to the display without a full-frame buffer
+ * 
+ * 形式はQOIを RGB565 向けに直したもの（INDEX/DIFF/LUMA/RUN/RAW、詳細は
+ * tools/gen_logo.py）。連続（RUN）は行やブロックをまたぐので、decode()は
+ * 呼び出しの間で状態を持ち越す。出力はLovyanGFXのswap565_tと同じ
+ * バイト順（上位バイトが先）で、そのままpushImageDMAに渡せる。
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef IMAGE_DECODER_H
+#define IMAGE_DECODER_H
+
+#include "hal.h"
+
+class ImageDecoder {
+public:
+  // Constructor
+  ImageDecoder();
+  
+  // Start decoding an image of the given pixel count
+  void begin(const uint8_t* data, size_t size, uint32_t pixels);
+  
+  // Decode up to count pixels into out (byte-swapped RGB565)
+  // Returns the number of pixels written (0 once the image is complete)
+  size_t decode(uint16_t* out, size_t count);
+  
+  // Pixels not yet decoded
+  uint32_t getRemaining() const { return _remaining; }
+  
+  // True if the stream ended before the last pixel (truncated data)
+  bool isTruncated() const { return _truncated; }
+
+private:
+  static uint8_t hash(uint16_t color);
+  
+  const uint8_t* _data;
+  const uint8_t* _end;
+  uint16_t _prev;          // 直前の画素（RGB565、通常のバイト順）
+  uint16_t _index[64];     // 最近使った色の表
+  uint8_t _run;            // 残りの連続数
+  uint32_t _remaining;
+  bool _truncated;
+};
+
+#endif // IMAGE_DECODER_H
@@ -0,0 +1,67 @@
+/*
+ * Logger.cpp
+ * 
+ * Implementation of the lightweight logger
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "Logger.h"
+#include <stdarg.h>
+
+volatile bool Logger::_debugEnabled = false;
+volatile uint32_t Logger::_dropped = 0;
+
+// Level prefix characters
+static const char LOG_LEVEL_CHARS[] = {'-', 'E', 'W', 'I', 'D', 'V'};
+
+void Logger::write(uint8_t level, const char* tag, const char* format, ...) {
+  char line[LOG_LINE_MAX];
+  
+  int length = snprintf(line, sizeof(line), "[%c][%s] ",
+                        LOG_LEVEL_CHARS[level <= LOG_LEVEL_VERBOSE ? level : 0], tag);
+  if (length < 0) {
+    return;
+  }
+  
+  va_list args;
+  va_start(args, format);
+  int body = vsnprintf(line + length, sizeof(line) - length, format, args);
+  va_end(args);
+  if (body < 0) {
+    return;
+  }
+  
+  // 切り捨てられた場合も改行分の2文字を確保する
+  length += body;
+  if (length > (int)sizeof(line) - 3) {
+    length = sizeof(line) - 3;
+  }
+  line[length++] = '\r';
+  line[length++] = '\n';
+  
+#ifdef ARDUINO
+  // USB-CDCの送信バッファが空くのを待たない（ホスト未接続時にループが止まるため）
+  if (Serial.availableForWrite() < length) {
+    _dropped++;
+    return;
+  }
+  
+  Serial.write((const uint8_t*)line, length);
+#else
+  // ホストビルド（tools/host）では標準エラー出力へ
+  fwrite(line, 1, length, stderr);
+#endif
+}
+
+bool Logger::rateLimit(uint32_t* lastMs, uint32_t intervalMs) {
+  uint32_t now = millis();
+  if (*lastMs != 0 && now - *lastMs < intervalMs) {
+    return false;
+  }
+  
+  // 0は未出力を表すため、起動直後でも0にならないようにする
+  *lastMs = now ? now : 1;
+  return true;
+}
@@ -0,0 +1,132 @@
+/*
+ * Logger.h
+ * 
+ * Lightweight logging for the Polaris Navigator
+ * Compile-time log levels with per-module tags and rate-limited output
+ * 
+ * LOG_LEVELより詳細なログはプリプロセッサで削除され、引数の評価や
+ * 浮動小数点の整形も行われない。DEBUG/VERBOSEは実行時に
+ * 設定（Debug Output）で有効にした場合のみ出力される。
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef LOGGER_H
+#define LOGGER_H
+
+#include "hal.h"
+
+// Log levels
+#define LOG_LEVEL_NONE    0
+#define LOG_LEVEL_ERROR   1
+#define LOG_LEVEL_WARN    2
+#define LOG_LEVEL_INFO    3
+#define LOG_LEVEL_DEBUG   4
+#define LOG_LEVEL_VERBOSE 5
+
+// Compile-time log level
+// 開発時はビルドフラグ（-DLOG_LEVEL=5など）で変更する
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+// Output limits
+#define LOG_LINE_MAX      192   // 1行の最大長（超えた分は切り捨て）
+
+// Module tags
+#define LOG_TAG_MAIN      "MAIN"
+#define LOG_TAG_IMU       "IMU"
+#define LOG_TAG_GPS       "GPS"
+#define LOG_TAG_CELESTIAL "CEL"
+#define LOG_TAG_DISPLAY   "DISP"
+#define LOG_TAG_SETTINGS  "SET"
+#define LOG_TAG_TIME      "TIME"
+
+class Logger {
+public:
+  // Runtime gate for DEBUG/VERBOSE (SettingsManager::getEnableDebugOutput())
+  static void setDebugEnabled(bool enabled) { _debugEnabled = enabled; }
+  static bool isDebugEnabled() { return _debugEnabled; }
+  
+  // Check whether a level passes the runtime gate
+  static bool isEnabled(uint8_t level) {
+    return level <= LOG_LEVEL_INFO || _debugEnabled;
+  }
+  
+  // Format and write one line (dropped if the TX buffer is full)
+  static void write(uint8_t level, const char* tag, const char* format, ...)
+    __attribute__((format(printf, 3, 4)));
+  
+  // Returns true at most once per intervalMs for the given call site
+  static bool rateLimit(uint32_t* lastMs, uint32_t intervalMs);
+  
+  // Number of lines dropped because Serial could not accept them
+  static uint32_t getDropped() { return _dropped; }
+
+private:
+  static volatile bool _debugEnabled;
+  static volatile uint32_t _dropped;
+};
+
+// Internal helpers
+#define LOG_EMIT(level, tag, ...) \
+  do { \
+    if (Logger::isEnabled(level)) Logger::write(level, tag, __VA_ARGS__); \
+  } while (0)
+
+#define LOG_EMIT_EVERY(level, tag, intervalMs, ...) \
+  do { \
+    static uint32_t _logLastMs = 0; \
+    if (Logger::isEnabled(level) && Logger::rateLimit(&_logLastMs, intervalMs)) \
+      Logger::write(level, tag, __VA_ARGS__); \
+  } while (0)
+
+#define LOG_NOP(...) do { } while (0)
+
+// True when a level is compiled in and enabled at runtime
+// 複数行の出力をまとめて省略する場合に使う（コンパイル時に無効なら定数false）
+#define LOG_ACTIVE(level) (LOG_LEVEL >= (level) && Logger::isEnabled(level))
+
+// Logging macros: LOG_x(tag, format, ...) / LOG_x_EVERY(tag, intervalMs, format, ...)
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_E(tag, ...)             LOG_EMIT(LOG_LEVEL_ERROR, tag, __VA_ARGS__)
+#define LOG_E_EVERY(tag, ms, ...)   LOG_EMIT_EVERY(LOG_LEVEL_ERROR, tag, ms, __VA_ARGS__)
+#else
+#define LOG_E(...)                  LOG_NOP()
+#define LOG_E_EVERY(...)            LOG_NOP()
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_W(tag, ...)             LOG_EMIT(LOG_LEVEL_WARN, tag, __VA_ARGS__)
+#define LOG_W_EVERY(tag, ms, ...)   LOG_EMIT_EVERY(LOG_LEVEL_WARN, tag, ms, __VA_ARGS__)
+#else
+#define LOG_W(...)                  LOG_NOP()
+#define LOG_W_EVERY(...)            LOG_NOP()
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_I(tag, ...)             LOG_EMIT(LOG_LEVEL_INFO, tag, __VA_ARGS__)
+#define LOG_I_EVERY(tag, ms, ...)   LOG_EMIT_EVERY(LOG_LEVEL_INFO, tag, ms, __VA_ARGS__)
+#else
+#define LOG_I(...)                  LOG_NOP()
+#define LOG_I_EVERY(...)            LOG_NOP()
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_D(tag, ...)             LOG_EMIT(LOG_LEVEL_DEBUG, tag, __VA_ARGS__)
+#define LOG_D_EVERY(tag, ms, ...)   LOG_EMIT_EVERY(LOG_LEVEL_DEBUG, tag, ms, __VA_ARGS__)
+#else
+#define LOG_D(...)                  LOG_NOP()
+#define LOG_D_EVERY(...)            LOG_NOP()
+#endif
+
+#if LOG_LEVEL >= LOG_LEVEL_VERBOSE
+#define LOG_V(tag, ...)             LOG_EMIT(LOG_LEVEL_VERBOSE, tag, __VA_ARGS__)
+#define LOG_V_EVERY(tag, ms, ...)   LOG_EMIT_EVERY(LOG_LEVEL_VERBOSE, tag, ms, __VA_ARGS__)
+#else
+#define LOG_V(...)                  LOG_NOP()
+#define LOG_V_EVERY(...)            LOG_NOP()
+#endif
+
+#endif // LOGGER_H
@@ -0,0 +1,382 @@
+/*
+ * MagCalibrator.cpp
+ * 
+ * Implementation of the streaming ellipsoid-fit magnetometer calibration
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "MagCalibrator.h"
+#include <math.h>
+#include "Logger.h"
+
+// Eigen decomposition of a symmetric 3x3 matrix (cyclic Jacobi)
+// a is destroyed; eigenvalues in values, eigenvectors in the columns of vectors
+static void symmetricEigen3(float a[3][3], float values[3], float vectors[3][3]) {
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      vectors[i][j] = (i == j) ? 1.0f : 0.0f;
+    }
+  }
+  
+  for (int sweep = 0; sweep < 12; sweep++) {
+    float off = a[0][1] * a[0][1] + a[0][2] * a[0][2] + a[1][2] * a[1][2];
+    if (off < 1e-18f) {
+      break;
+    }
+    
+    for (int p = 0; p < 2; p++) {
+      for (int q = p + 1; q < 3; q++) {
+        if (fabsf(a[p][q]) < 1e-20f) {
+          continue;
+        }
+        
+        // Rotation that zeroes a[p][q]
+        float theta = (a[q][q] - a[p][p]) / (2.0f * a[p][q]);
+        float t = (theta >= 0.0f ? 1.0f : -1.0f) / (fabsf(theta) + sqrtf(theta * theta + 1.0f));
+        float c = 1.0f / sqrtf(t * t + 1.0f);
+        float s = t * c;
+        
+        for (int k = 0; k < 3; k++) {
+          float akp = a[k][p], akq = a[k][q];
+          a[k][p] = c * akp - s * akq;
+          a[k][q] = s * akp + c * akq;
+        }
+        for (int k = 0; k < 3; k++) {
+          float apk = a[p][k], aqk = a[q][k];
+          a[p][k] = c * apk - s * aqk;
+          a[q][k] = s * apk + c * aqk;
+        }
+        for (int k = 0; k < 3; k++) {
+          float vkp = vectors[k][p], vkq = vectors[k][q];
+          vectors[k][p] = c * vkp - s * vkq;
+          vectors[k][q] = s * vkp + c * vkq;
+        }
+      }
+    }
+  }
+  
+  for (int i = 0; i < 3; i++) {
+    values[i] = a[i][i];
+  }
+}
+
+// Constructor
+MagCalibrator::MagCalibrator() {
+  memset(&_calibration, 0, sizeof(_calibration));
+  for (int i = 0; i < 3; i++) {
+    _calibration.softIron[i][i] = 1.0f;
+  }
+  _calibration.valid = false;
+  _disturbed = false;
+  reset();
+}
+
+void MagCalibrator::reset() {
+  // 現在の較正値の中心を原点にする（未較正なら0）
+  clearStatistics(_calibration.offset);
+  _learning = true;
+  _rejectScore = 0;
+}
+
+void MagCalibrator::clearStatistics(const float reference[3]) {
+  memset(_s, 0, sizeof(_s));
+  memset(_t, 0, sizeof(_t));
+  _n = 0.0;
+  for (int i = 0; i < 3; i++) {
+    _reference[i] = reference[i];
+  }
+  _hasLast = false;
+  _sinceSolve = 0;
+  _coverage = 0.0f;
+}
+
+void MagCalibrator::setCalibration(const MagCalibration& calibration) {
+  _calibration = calibration;
+  if (_calibration.valid) {
+    _learning = false;
+  }
+}
+
+void MagCalibrator::apply(const float raw[3], float corrected[3]) const {
+  if (!_calibration.valid) {
+    corrected[0] = raw[0];
+    corrected[1] = raw[1];
+    corrected[2] = raw[2];
+    return;
+  }
+  
+  float d[3] = {
+    raw[0] - _calibration.offset[0],
+    raw[1] - _calibration.offset[1],
+    raw[2] - _calibration.offset[2]
+  };
+  for (int i = 0; i < 3; i++) {
+    corrected[i] = _calibration.softIron[i][0] * d[0] +
+                   _calibration.softIron[i][1] * d[1] +
+                   _calibration.softIron[i][2] * d[2];
+  }
+}
+
+float MagCalibrator::getProgress() const {
+  if (!_learning) {
+    return 1.0f;
+  }
+  
+  // サンプル数と網羅度の両方が揃うまでは1にしない
+  float samples = (float)_n / MAG_CAL_MIN_SAMPLES;
+  float coverage = _coverage / MAG_CAL_MIN_COVERAGE;
+  float progress = 0.5f * (samples < 1.0f ? samples : 1.0f) +
+                   0.5f * (coverage < 1.0f ? coverage : 1.0f);
+  return progress < 0.99f ? progress : 0.99f;
+}
+
+bool MagCalibrator::addSample(const float raw[3]) {
+  // 補正後の大きさで磁気干渉を判定する
+  bool outlier = false;
+  if (_calibration.valid) {
+    float c[3];
+    apply(raw, c);
+    float magnitude = sqrtf(c[0] * c[0] + c[1] * c[1] + c[2] * c[2]);
+    outlier = fabsf(magnitude / _calibration.fieldStrength - 1.0f) > MAG_CAL_OUTLIER_RATIO;
+  }
+  _disturbed = outlier;
+  
+  // 前回のサンプルから十分に動いていなければ使わない（同じ姿勢に重みが偏らないように）
+  if (_hasLast) {
+    float dx = raw[0] - _last[0], dy = raw[1] - _last[1], dz = raw[2] - _last[2];
+    if (dx * dx + dy * dy + dz * dz < MAG_CAL_MIN_SEPARATION_UT * MAG_CAL_MIN_SEPARATION_UT) {
+      return false;
+    }
+  }
+  _last[0] = raw[0];
+  _last[1] = raw[1];
+  _last[2] = raw[2];
+  _hasLast = true;
+  
+  if (!_learning) {
+    // 外れたサンプルが過半数の状態が続く場合は取り付け状態が変わったとみなして学習し直す
+    // （一時的な干渉では正常なサンプルでスコアが戻る）
+    if (outlier) {
+      if (++_rejectScore >= MAG_CAL_RELEARN_REJECTS) {
+        LOG_W(LOG_TAG_IMU, "Magnetic field changed, relearning calibration");
+        reset();
+      }
+      return false;
+    }
+    if (_rejectScore > 0) {
+      _rejectScore--;
+    }
+  }
+  
+  // Design vector of the normalized sample
+  double x = (raw[0] - _reference[0]) / MAG_CAL_SCALE_UT;
+  double y = (raw[1] - _reference[1]) / MAG_CAL_SCALE_UT;
+  double z = (raw[2] - _reference[2]) / MAG_CAL_SCALE_UT;
+  double d[9] = { x * x, y * y, z * z, 2.0 * y * z, 2.0 * x * z, 2.0 * x * y,
+                  2.0 * x, 2.0 * y, 2.0 * z };
+  
+  // 忘却係数で古いサンプルの重みを下げてから加算する
+  const double forget = 1.0 - 1.0 / MAG_CAL_WINDOW;
+  for (int i = 0; i < 9; i++) {
+    for (int j = i; j < 9; j++) {
+      _s[i][j] = _s[i][j] * forget + d[i] * d[j];
+    }
+    _t[i] = _t[i] * forget + d[i];
+  }
+  _n = _n * forget + 1.0;
+  
+  if (++_sinceSolve < MAG_CAL_SOLVE_INTERVAL || _n < MAG_CAL_MIN_SAMPLES) {
+    return false;
+  }
+  _sinceSolve = 0;
+  return solve();
+}
+
+bool MagCalibrator::solve() {
+  // Normal equations S v = t (Gaussian elimination with partial pivoting)
+  double m[9][10];
+  for (int i = 0; i < 9; i++) {
+    for (int j = 0; j < 9; j++) {
+      m[i][j] = i <= j ? _s[i][j] : _s[j][i];
+    }
+    m[i][9] = _t[i];
+  }
+  
+  bool singular = false;
+  for (int col = 0; col < 9 && !singular; col++) {
+    int pivot = col;
+    for (int row = col + 1; row < 9; row++) {
+      if (fabs(m[row][col]) > fabs(m[pivot][col])) {
+        pivot = row;
+      }
+    }
+    if (fabs(m[pivot][col]) < 1e-9 * _n) {
+      singular = true;
+      break;
+    }
+    if (pivot != col) {
+      for (int k = col; k < 10; k++) {
+        double tmp = m[col][k];
+        m[col][k] = m[pivot][k];
+        m[pivot][k] = tmp;
+      }
+    }
+    for (int row = col + 1; row < 9; row++) {
+      double factor = m[row][col] / m[col][col];
+      for (int k = col; k < 10; k++) {
+        m[row][k] -= factor * m[col][k];
+      }
+    }
+  }
+  
+  double v[9];
+  if (!singular) {
+    for (int row = 8; row >= 0; row--) {
+      double sum = m[row][9];
+      for (int k = row + 1; k < 9; k++) {
+        sum -= m[row][k] * v[k];
+      }
+      v[row] = sum / m[row][row];
+    }
+  }
+  
+  // Ellipsoid center: c = -A^-1 p, then (x - c)' (A / k) (x - c) = 1
+  double A[3][3] = {
+    { v[0], v[5], v[4] },
+    { v[5], v[1], v[3] },
+    { v[4], v[3], v[2] }
+  };
+  double p[3] = { v[6], v[7], v[8] };
+  double det = 0.0;
+  if (!singular) {
+    det = A[0][0] * (A[1][1] * A[2][2] - A[1][2] * A[2][1]) -
+          A[0][1] * (A[1][0] * A[2][2] - A[1][2] * A[2][0]) +
+          A[0][2] * (A[1][0] * A[2][1] - A[1][1] * A[2][0]);
+  }
+  
+  double k = 0.0;
+  double center[3] = { 0.0, 0.0, 0.0 };
+  if (!singular && fabs(det) > 1e-12) {
+    double inv[3][3];
+    inv[0][0] = (A[1][1] * A[2][2] - A[1][2] * A[2][1]) / det;
+    inv[0][1] = (A[0][2] * A[2][1] - A[0][1] * A[2][2]) / det;
+    inv[0][2] = (A[0][1] * A[1][2] - A[0][2] * A[1][1]) / det;
+    inv[1][1] = (A[0][0] * A[2][2] - A[0][2] * A[2][0]) / det;
+    inv[1][2] = (A[0][2] * A[1][0] - A[0][0] * A[1][2]) / det;
+    inv[2][2] = (A[0][0] * A[1][1] - A[0][1] * A[1][0]) / det;
+    inv[1][0] = inv[0][1];
+    inv[2][0] = inv[0][2];
+    inv[2][1] = inv[1][2];
+    for (int i = 0; i < 3; i++) {
+      center[i] = -(inv[i][0] * p[0] + inv[i][1] * p[1] + inv[i][2] * p[2]);
+    }
+    k = 1.0;
+    for (int i = 0; i < 3; i++) {
+      for (int j = 0; j < 3; j++) {
+        k += center[i] * A[i][j] * center[j];
+      }
+    }
+  }
+  
+  if (singular || fabs(k) < 1e-6) {
+    // 統計の原点が楕円体の面に近いと解けないため、サンプルの平均を原点に取り直す
+    if (_n >= 2.0 * MAG_CAL_MIN_SAMPLES) {
+      float mean[3];
+      for (int i = 0; i < 3; i++) {
+        mean[i] = _reference[i] + (float)(_t[6 + i] * 0.5 / _n) * MAG_CAL_SCALE_UT;
+      }
+      LOG_D(LOG_TAG_IMU, "Mag fit degenerate, re-centering statistics");
+      clearStatistics(mean);
+    }
+    return false;
+  }
+  
+  // Shape of the ellipsoid (M = A / k must be positive definite)
+  float M[3][3], values[3], vectors[3][3];
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      M[i][j] = (float)(A[i][j] / k);
+    }
+  }
+  symmetricEigen3(M, values, vectors);
+  if (values[0] <= 0.0f || values[1] <= 0.0f || values[2] <= 0.0f) {
+    return false;
+  }
+  
+  // Semi-axes (normalized units) and their geometric mean
+  float axes[3], minAxis = 1e9f, maxAxis = 0.0f;
+  for (int i = 0; i < 3; i++) {
+    axes[i] = 1.0f / sqrtf(values[i]);
+    if (axes[i] < minAxis) minAxis = axes[i];
+    if (axes[i] > maxAxis) maxAxis = axes[i];
+  }
+  float radius = cbrtf(axes[0] * axes[1] * axes[2]);
+  float field = radius * MAG_CAL_SCALE_UT;
+  
+  // Algebraic residual: e = v'd - 1, Σe² = v'Sv - 2v't + n
+  double sse = _n;
+  for (int i = 0; i < 9; i++) {
+    double row = 0.0;
+    for (int j = 0; j < 9; j++) {
+      row += (i <= j ? _s[i][j] : _s[j][i]) * v[j];
+    }
+    sse += v[i] * row - 2.0 * v[i] * _t[i];
+  }
+  // 面の近くでは e ≈ 2k·(半径の相対誤差)
+  float residual = (float)(sqrt(sse > 0.0 ? sse / _n : 0.0) / (2.0 * fabs(k)));
+  
+  // Coverage: eigenvalue ratio of the sample covariance
+  double mean[3] = { _t[6] * 0.5 / _n, _t[7] * 0.5 / _n, _t[8] * 0.5 / _n };
+  float cov[3][3];
+  cov[0][0] = (float)(_t[0] / _n - mean[0] * mean[0]);
+  cov[1][1] = (float)(_t[1] / _n - mean[1] * mean[1]);
+  cov[2][2] = (float)(_t[2] / _n - mean[2] * mean[2]);
+  cov[1][2] = cov[2][1] = (float)(_t[3] * 0.5 / _n - mean[1] * mean[2]);
+  cov[0][2] = cov[2][0] = (float)(_t[4] * 0.5 / _n - mean[0] * mean[2]);
+  cov[0][1] = cov[1][0] = (float)(_t[5] * 0.5 / _n - mean[0] * mean[1]);
+  float covValues[3], covVectors[3][3];
+  symmetricEigen3(cov, covValues, covVectors);
+  float covMin = covValues[0], covMax = covValues[0];
+  for (int i = 1; i < 3; i++) {
+    if (covValues[i] < covMin) covMin = covValues[i];
+    if (covValues[i] > covMax) covMax = covValues[i];
+  }
+  _coverage = covMax > 0.0f && covMin > 0.0f ? covMin / covMax : 0.0f;
+  
+  LOG_D(LOG_TAG_IMU, "Mag fit: field %.1f uT, residual %.3f, coverage %.2f, axis ratio %.2f",
+        field, residual, _coverage, maxAxis / minAxis);
+  
+  if (_coverage < MAG_CAL_MIN_COVERAGE || residual > MAG_CAL_MAX_RESIDUAL ||
+      maxAxis / minAxis > MAG_CAL_MAX_AXIS_RATIO ||
+      field < MAG_CAL_MIN_FIELD_UT || field > MAG_CAL_MAX_FIELD_UT) {
+    return false;
+  }
+  
+  // Soft-iron matrix W = V diag(sqrt(λ) * radius) V'（補正後の大きさ = 平均半径）
+  MagCalibration result = _calibration;
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      float sum = 0.0f;
+      for (int e = 0; e < 3; e++) {
+        sum += vectors[i][e] * sqrtf(values[e]) * radius * vectors[j][e];
+      }
+      result.softIron[i][j] = sum;
+    }
+    result.offset[i] = _reference[i] + (float)center[i] * MAG_CAL_SCALE_UT;
+  }
+  result.fieldStrength = field;
+  result.residual = residual;
+  result.coverage = _coverage;
+  result.fitCount = _calibration.fitCount + 1;
+  result.valid = true;
+  
+  if (_learning) {
+    LOG_I(LOG_TAG_IMU, "Magnetometer calibrated: field %.1f uT, residual %.1f%%",
+          field, residual * 100.0f);
+  }
+  _calibration = result;
+  _learning = false;
+  return true;
+}
@@ -0,0 +1,108 @@
+/*
+ * MagCalibrator.h
+ * 
+ * Streaming ellipsoid-fit magnetometer calibration for the Polaris Navigator
+ * Solves for the hard-iron offset and the full soft-iron matrix from
+ * running sums of the least-squares normal equations, so no samples are
+ * buffered and the fit keeps refining during normal operation
+ * 
+ * 楕円体 x'Ax + 2p'x = 1 の9パラメータを最小二乗で求める。
+ * 正規方程式の和（9x9）だけを保持し、忘却係数で古いサンプルの重みを下げる。
+ * 前回採用したサンプルから十分動いたサンプルのみを使い（静止中は蓄積しない）、
+ * 較正後は補正後の大きさが外れたサンプルを磁気干渉として捨てる。
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef MAG_CALIBRATOR_H
+#define MAG_CALIBRATOR_H
+
+#include "hal.h"
+
+// Sample selection
+#define MAG_CAL_MIN_SEPARATION_UT 2.0f    // 前回採用したサンプルからの最小距離（uT）
+#define MAG_CAL_WINDOW            800     // 忘却係数の実効サンプル数
+#define MAG_CAL_SOLVE_INTERVAL    25      // このサンプル数ごとに解き直す
+#define MAG_CAL_MIN_SAMPLES       100     // 解くのに必要な実効サンプル数
+
+// Fit acceptance
+#define MAG_CAL_MIN_COVERAGE      0.2f    // サンプル分布の共分散の固有値比（最小/最大）
+#define MAG_CAL_MAX_RESIDUAL      0.03f   // 楕円体からの残差（RMS、半径に対する比）
+#define MAG_CAL_MAX_AXIS_RATIO    1.6f    // 楕円体の長軸/短軸の上限
+#define MAG_CAL_MIN_FIELD_UT      15.0f   // 地磁気として妥当な半径（uT）
+#define MAG_CAL_MAX_FIELD_UT      120.0f
+
+// Outlier rejection after calibration
+#define MAG_CAL_OUTLIER_RATIO     0.12f   // 補正後の大きさの許容誤差（半径に対する比）
+#define MAG_CAL_RELEARN_REJECTS   300     // 外れた数 - 正常な数がこれに達したら学習し直す
+
+// Normalization of the statistics (値の桁をそろえて条件数を抑える)
+#define MAG_CAL_SCALE_UT          50.0f
+
+// Magnetometer calibration (corrected = softIron * (raw - offset))
+struct MagCalibration {
+  float offset[3];        // ハードアイアン（uT）
+  float softIron[3][3];   // ソフトアイアン補正行列（対称、平均半径を保つ）
+  float fieldStrength;    // 補正後の磁場の大きさ（uT）
+  float residual;         // 楕円体からの残差（RMS、半径に対する比）
+  float coverage;         // 姿勢の網羅度（共分散の固有値比 0-1）
+  uint32_t fitCount;      // 採用した解の数（更新の検出用）
+  bool valid;
+};
+
+class MagCalibrator {
+public:
+  // Constructor
+  MagCalibrator();
+  
+  // Discard the statistics and learn from scratch
+  // The current calibration stays in use until a new fit is accepted
+  void reset();
+  
+  // Use a stored calibration (statistics are kept)
+  void setCalibration(const MagCalibration& calibration);
+  const MagCalibration& getCalibration() const { return _calibration; }
+  
+  // Feed one raw sample (uT). Returns true when a new fit was accepted.
+  bool addSample(const float raw[3]);
+  
+  // Apply the current calibration (copies raw while not calibrated)
+  void apply(const float raw[3], float corrected[3]) const;
+  
+  // Learning progress since reset() (0-1, 1 once a fit has been accepted)
+  float getProgress() const;
+  bool isLearning() const { return _learning; }
+  
+  // Last sample disagreed with the calibrated field (magnetic interference)
+  bool isDisturbed() const { return _disturbed; }
+  
+  // Effective number of samples in the statistics
+  float getSampleCount() const { return (float)_n; }
+
+private:
+  // Clear the statistics around a reference point (uT)
+  void clearStatistics(const float reference[3]);
+  
+  // Solve the normal equations and check the ellipsoid
+  bool solve();
+  
+  // Running sums (double: 4次のモーメントを数百サンプル加算するため)
+  double _s[9][9];        // Σ d d'（上三角のみ更新）
+  double _t[9];           // Σ d
+  double _n;              // 実効サンプル数
+  float _reference[3];    // 統計の原点（uT）
+  
+  // Sample selection
+  float _last[3];
+  bool _hasLast;
+  uint16_t _sinceSolve;
+  uint16_t _rejectScore;
+  bool _learning;
+  bool _disturbed;
+  float _coverage;        // 直近に解いたときの網羅度
+  
+  MagCalibration _calibration;
+};
+
+#endif // MAG_CALIBRATOR_H
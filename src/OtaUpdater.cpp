@@ -0,0 +1,280 @@
+/*
+ * OtaUpdater.cpp
+ * 
+ * Implementation of the streaming firmware updater
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "OtaUpdater.h"
+#include <esp_idf_version.h>
+#include <esp_image_format.h>
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+#include <esp_app_desc.h>
+#endif
+#include "Logger.h"
+
+// アプリの記述子はイメージヘッダーと最初のセグメントヘッダーの直後にある
+#define OTA_APP_DESC_OFFSET (sizeof(esp_image_header_t) + sizeof(esp_image_segment_header_t))
+
+// 起動時にコアが自動で確定しないようにする（serviceBootCheck()で確定する）
+extern "C" bool verifyRollbackLater() {
+  return true;
+}
+
+static const esp_app_desc_t* runningDescription() {
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+  return esp_app_get_description();
+#else
+  return esp_ota_get_app_description();
+#endif
+}
+
+// Constructor
+OtaUpdater::OtaUpdater() {
+  _partition = nullptr;
+  _handle = 0;
+  memset(_expectedMd5, 0, sizeof(_expectedMd5));
+  _checkMd5 = false;
+  _state = OTA_IDLE;
+  _written = 0;
+  _imageSize = 0;
+  _error = "";
+  _pendingVerify = false;
+  _bootMs = 0;
+  _sectorFill = 0;
+}
+
+const char* OtaUpdater::getStateName(OtaState state) {
+  switch (state) {
+    case OTA_IDLE:    return "idle";
+    case OTA_WRITING: return "writing";
+    case OTA_READY:   return "ready";
+    case OTA_FAILED:  return "failed";
+  }
+  return "?";
+}
+
+bool OtaUpdater::parseMd5(const char* hex, uint8_t* md5) {
+  if (hex == nullptr) {
+    return false;
+  }
+  for (int i = 0; i < 32; i++) {
+    char c = hex[i];
+    int value;
+    if (c >= '0' && c <= '9') {
+      value = c - '0';
+    } else if (c >= 'a' && c <= 'f') {
+      value = c - 'a' + 10;
+    } else if (c >= 'A' && c <= 'F') {
+      value = c - 'A' + 10;
+    } else {
+      return false;
+    }
+    if ((i & 1) == 0) {
+      md5[i / 2] = (uint8_t)(value << 4);
+    } else {
+      md5[i / 2] |= (uint8_t)value;
+    }
+  }
+  return true;
+}
+
+void OtaUpdater::fail(const char* error) {
+  _error = error;
+  _state = OTA_FAILED;
+  LOG_E(LOG_TAG_MAIN, "OTA: %s", error);
+}
+
+bool OtaUpdater::begin(uint32_t imageSize, const uint8_t* md5) {
+  if (_state == OTA_WRITING) {
+    abort();
+  }
+  if (imageSize > OTA_MAX_IMAGE_SIZE) {
+    fail("image larger than the app partition");
+    return false;
+  }
+  
+  _partition = esp_ota_get_next_update_partition(nullptr);
+  if (_partition == nullptr) {
+    fail("no inactive app partition");
+    return false;
+  }
+  
+  // 順次書き込み: 書き込む直前にそのセクターだけを消去する
+  // （OTA_SIZE_UNKNOWNはパーティション全体を最初に消去し、長く止まる）
+  esp_err_t err = esp_ota_begin(_partition, OTA_WITH_SEQUENTIAL_WRITES, &_handle);
+  if (err != ESP_OK) {
+    fail(esp_err_to_name(err));
+    return false;
+  }
+  
+  _checkMd5 = md5 != nullptr;
+  if (_checkMd5) {
+    memcpy(_expectedMd5, md5, sizeof(_expectedMd5));
+  }
+  _md5.begin();
+  _imageSize = imageSize;
+  _written = 0;
+  _sectorFill = 0;
+  _error = "";
+  _state = OTA_WRITING;
+  
+  LOG_I(LOG_TAG_MAIN, "OTA: writing %lu bytes to %s", (unsigned long)imageSize, _partition->label);
+  return true;
+}
+
+bool OtaUpdater::write(const uint8_t* data, size_t length) {
+  if (_state != OTA_WRITING) {
+    return false;
+  }
+  if (_written + _sectorFill + length > OTA_MAX_IMAGE_SIZE) {
+    abort();
+    fail("image larger than the app partition");
+    return false;
+  }
+  
+  while (length > 0) {
+    size_t count = min(length, sizeof(_sector) - _sectorFill);
+    memcpy(_sector + _sectorFill, data, count);
+    _sectorFill += count;
+    data += count;
+    length -= count;
+    if (_sectorFill == sizeof(_sector) && !flushSector()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool OtaUpdater::flushSector() {
+  if (_sectorFill == 0) {
+    return true;
+  }
+  
+  // 最初のセクターで別のプロジェクトのイメージを弾く（消去前に判定する）
+  if (_written == 0 && !checkDescriptor(_sector, _sectorFill)) {
+    abort();
+    return false;
+  }
+  
+  _md5.add(_sector, _sectorFill);
+  esp_err_t err = esp_ota_write(_handle, _sector, _sectorFill);
+  if (err != ESP_OK) {
+    abort();
+    fail(esp_err_to_name(err));
+    return false;
+  }
+  _written += _sectorFill;
+  _sectorFill = 0;
+  
+  // 消去・書き込みの間はキャッシュが止まる。続けて行わずセンサータスクに時間を渡す
+  vTaskDelay(pdMS_TO_TICKS(OTA_SECTOR_GAP_MS));
+  return true;
+}
+
+bool OtaUpdater::checkDescriptor(const uint8_t* data, size_t length) {
+  if (length < OTA_APP_DESC_OFFSET + sizeof(esp_app_desc_t) || data[0] != ESP_IMAGE_HEADER_MAGIC) {
+    fail("not an ESP32 application image");
+    return false;
+  }
+  
+  esp_app_desc_t desc;
+  memcpy(&desc, data + OTA_APP_DESC_OFFSET, sizeof(desc));
+  const esp_app_desc_t* running = runningDescription();
+  if (desc.magic_word != ESP_APP_DESC_MAGIC_WORD ||
+      strncmp(desc.project_name, running->project_name, sizeof(desc.project_name)) != 0) {
+    fail("image is not a Polaris Navigator build");
+    return false;
+  }
+  
+  LOG_I(LOG_TAG_MAIN, "OTA: image %.32s %.32s (%.16s %.16s), running %.32s",
+        desc.project_name, desc.version, desc.date, desc.time, running->version);
+  return true;
+}
+
+bool OtaUpdater::end() {
+  if (_state != OTA_WRITING) {
+    return false;
+  }
+  if (!flushSector()) {
+    return false;
+  }
+  if (_imageSize != 0 && _written != _imageSize) {
+    abort();
+    fail("image is incomplete");
+    return false;
+  }
+  
+  if (_checkMd5) {
+    uint8_t md5[16];
+    _md5.calculate();
+    _md5.getBytes(md5);
+    if (memcmp(md5, _expectedMd5, sizeof(md5)) != 0) {
+      abort();
+      fail("MD5 mismatch");
+      return false;
+    }
+  }
+  
+  // esp_ota_end()はイメージのチェックサムと付加されたSHA-256を検証する
+  // （セキュアブートが有効なら署名も検証される）
+  esp_err_t err = esp_ota_end(_handle);
+  _handle = 0;
+  if (err != ESP_OK) {
+    fail(esp_err_to_name(err));
+    return false;
+  }
+  err = esp_ota_set_boot_partition(_partition);
+  if (err != ESP_OK) {
+    fail(esp_err_to_name(err));
+    return false;
+  }
+  
+  _state = OTA_READY;
+  LOG_I(LOG_TAG_MAIN, "OTA: %lu bytes verified, %s boots next", (unsigned long)_written,
+        _partition->label);
+  return true;
+}
+
+void OtaUpdater::abort() {
+  if (_handle != 0) {
+    esp_ota_abort(_handle);
+    _handle = 0;
+  }
+  _sectorFill = 0;
+  if (_state == OTA_WRITING) {
+    _error = "aborted";
+    _state = OTA_FAILED;
+  }
+}
+
+void OtaUpdater::beginBootCheck() {
+  esp_ota_img_states_t state;
+  const esp_partition_t* running = esp_ota_get_running_partition();
+  _pendingVerify = running != nullptr && esp_ota_get_state_partition(running, &state) == ESP_OK &&
+                   state == ESP_OTA_IMG_PENDING_VERIFY;
+  _bootMs = millis();
+  if (_pendingVerify) {
+    LOG_W(LOG_TAG_MAIN, "OTA: first boot of %s %s, waiting to confirm",
+          running->label, runningDescription()->version);
+  }
+}
+
+void OtaUpdater::serviceBootCheck(bool healthy) {
+  if (!_pendingVerify) {
+    return;
+  }
+  
+  uint32_t elapsed = millis() - _bootMs;
+  if (healthy && elapsed >= OTA_CONFIRM_AFTER_MS) {
+    esp_ota_mark_app_valid_cancel_rollback();
+    _pendingVerify = false;
+    LOG_I(LOG_TAG_MAIN, "OTA: firmware %s confirmed", runningDescription()->version);
+  } else if (elapsed >= OTA_CONFIRM_TIMEOUT_MS) {
+    // 戻らない（再起動して前のファームウェアで起動する）
+    LOG_E(LOG_TAG_MAIN, "OTA: firmware not healthy, rolling back");
+    esp_ota_mark_app_invalid_rollback_and_reboot();
+  }
+}
@@ -0,0 +1,107 @@
+/*
+ * OtaUpdater.h
+ * 
+ * Streaming firmware updates into the inactive app partition
+ * Writes the image in sector-sized chunks, checks that it is a Polaris
+ * Navigator build, verifies its MD5 and the image hash, and selects it
+ * for the next boot. The new firmware has to prove itself before it is
+ * kept; otherwise the bootloader returns to the previous one
+ * 
+ * 受信側（HTTPならWi-Fiアシストのタスク）がbegin() → write() → end()を
+ * 呼ぶ。書き込みは4KBごとに消去と書き込みを行い（パーティション全体を
+ * 先に消去しない）、各セクターの後に休んでセンサータスクがFIFOを読む
+ * 時間を空ける（フラッシュの消去中はキャッシュが止まるため）。
+ * 更新後の初回起動は検証待ちとなり、センサータスクが動いて姿勢が
+ * 得られた状態で一定時間動作したら確定する。その前にリセット・ウォッチ
+ * ドッグで再起動した場合や、期限までに確定できなかった場合は前の
+ * ファームウェアに戻る。
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef OTA_UPDATER_H
+#define OTA_UPDATER_H
+
+#include <Arduino.h>
+#include <MD5Builder.h>
+#include <esp_ota_ops.h>
+
+// Writing
+#define OTA_SECTOR_SIZE          4096       // フラッシュの消去単位
+#define OTA_SECTOR_GAP_MS        20         // セクターごとの休み（IMUのFIFOは約0.3秒分）
+#define OTA_MAX_IMAGE_SIZE       0x140000   // app0/app1の大きさ（partitions.csv）
+
+// Boot validation
+#define OTA_CONFIRM_AFTER_MS     30000      // 正常に動作したらこの時間で確定する（その前の電源断も戻す）
+#define OTA_CONFIRM_TIMEOUT_MS   300000     // これまでに確定できなければ前のファームウェアに戻す
+
+// Update progress
+enum OtaState {
+  OTA_IDLE,
+  OTA_WRITING,
+  OTA_READY,       // 次の起動で新しいファームウェアになる
+  OTA_FAILED
+};
+
+class OtaUpdater {
+public:
+  // Constructor
+  OtaUpdater();
+  
+  // Streaming writer (one task at a time)
+  // imageSize may be 0 when unknown; md5 is 16 bytes or nullptr to skip
+  bool begin(uint32_t imageSize, const uint8_t* md5);
+  bool write(const uint8_t* data, size_t length);
+  
+  // Verify the image and make it the boot partition
+  bool end();
+  
+  // Cancel a transfer (the inactive slot is left unbootable)
+  void abort();
+  
+  // Progress
+  OtaState getState() const { return _state; }
+  uint32_t getWritten() const { return _written; }
+  uint32_t getImageSize() const { return _imageSize; }
+  const char* getError() const { return _error; }
+  static const char* getStateName(OtaState state);
+  
+  // Boot validation (UI task)
+  // Call once in setup(), then every loop with whether the unit is healthy
+  void beginBootCheck();
+  void serviceBootCheck(bool healthy);
+  bool isPendingVerify() const { return _pendingVerify; }
+  
+  // Parse 32 hex digits into 16 bytes
+  static bool parseMd5(const char* hex, uint8_t* md5);
+
+private:
+  // Flush the sector buffer to flash
+  bool flushSector();
+  
+  // Reject images built for another project
+  bool checkDescriptor(const uint8_t* data, size_t length);
+  
+  void fail(const char* error);
+  
+  const esp_partition_t* _partition;
+  esp_ota_handle_t _handle;
+  MD5Builder _md5;
+  uint8_t _expectedMd5[16];
+  bool _checkMd5;
+  
+  volatile OtaState _state;
+  volatile uint32_t _written;
+  uint32_t _imageSize;
+  const char* _error;
+  
+  // Boot validation
+  bool _pendingVerify;
+  uint32_t _bootMs;
+  
+  uint8_t _sector[OTA_SECTOR_SIZE];
+  size_t _sectorFill;
+};
+
+#endif // OTA_UPDATER_H
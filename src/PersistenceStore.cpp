@@ -0,0 +1,210 @@
+/*
+ * PersistenceStore.cpp
+ * 
+ * Implementation of the coalesced NVS persistence
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "PersistenceStore.h"
+#include "Logger.h"
+
+// NVS keys (index = PersistRecord)
+static const char* const RECORD_KEYS[PERSIST_RECORD_COUNT] = {
+  "settings",
+  "calib",
+  "gyro_tc",
+  "gps",
+  "network"
+};
+
+// Constructor
+PersistenceStore::PersistenceStore() {
+  _open = false;
+  memset(_slots, 0, sizeof(_slots));
+  _pendingMask = 0;
+  _writes = 0;
+  _skipped = 0;
+}
+
+bool PersistenceStore::begin() {
+  if (_open) {
+    return true;
+  }
+  if (!_preferences.begin(PERSIST_NAMESPACE, false)) {
+    LOG_E(LOG_TAG_SETTINGS, "Failed to open NVS namespace %s", PERSIST_NAMESPACE);
+    return false;
+  }
+  _open = true;
+  
+  // 全レコードを1回で読み込む
+  uint8_t buffer[sizeof(RecordHeader) + PERSIST_MAX_RECORD_SIZE];
+  int loaded = 0;
+  for (int i = 0; i < PERSIST_RECORD_COUNT; i++) {
+    Slot& slot = _slots[i];
+    size_t length = _preferences.getBytesLength(RECORD_KEYS[i]);
+    if (length < sizeof(RecordHeader) || length > sizeof(buffer)) {
+      continue;
+    }
+    if (_preferences.getBytes(RECORD_KEYS[i], buffer, length) != length) {
+      continue;
+    }
+    
+    RecordHeader header;
+    memcpy(&header, buffer, sizeof(header));
+    const uint8_t* payload = buffer + sizeof(header);
+    if (header.magic != PERSIST_MAGIC || header.size != length - sizeof(header) ||
+        crc32(payload, header.size) != header.crc) {
+      LOG_W(LOG_TAG_SETTINGS, "Discarding corrupt record %s", RECORD_KEYS[i]);
+      continue;
+    }
+    
+    memcpy(_cache[i], payload, header.size);
+    slot.cachedSize = header.size;
+    slot.cachedVersion = header.version;
+    slot.valid = true;
+    loaded++;
+  }
+  
+  LOG_I(LOG_TAG_SETTINGS, "Loaded %d stored records, %u free NVS entries",
+        loaded, (unsigned)_preferences.freeEntries());
+  return true;
+}
+
+bool PersistenceStore::attach(PersistRecord record, void* data, size_t size, uint8_t version) {
+  if (record >= PERSIST_RECORD_COUNT || size > PERSIST_MAX_RECORD_SIZE) {
+    LOG_E(LOG_TAG_SETTINGS, "Cannot attach record %d (%u bytes)", (int)record, (unsigned)size);
+    return false;
+  }
+  
+  Slot& slot = _slots[record];
+  slot.data = data;
+  slot.size = (uint16_t)size;
+  slot.version = version;
+  
+  // 版または大きさが違う場合は構造体が変わったので使わない（所有者が既定値か旧形式から作る）
+  if (!slot.valid || slot.cachedVersion != version || slot.cachedSize != size) {
+    return false;
+  }
+  memcpy(data, _cache[record], size);
+  return true;
+}
+
+bool PersistenceStore::hasRecord(PersistRecord record) const {
+  return record < PERSIST_RECORD_COUNT && _slots[record].valid &&
+         _slots[record].cachedVersion == _slots[record].version &&
+         _slots[record].cachedSize == _slots[record].size;
+}
+
+void PersistenceStore::requestSave(PersistRecord record) {
+  if (record >= PERSIST_RECORD_COUNT || _slots[record].data == nullptr) {
+    return;
+  }
+  
+  uint32_t now = millis();
+  Slot& slot = _slots[record];
+  if (!(_pendingMask & (1 << record))) {
+    slot.firstRequestMs = now;
+    _pendingMask |= (1 << record);
+  }
+  slot.lastRequestMs = now;
+}
+
+void PersistenceStore::service() {
+  if (_pendingMask == 0) {
+    return;
+  }
+  
+  // 期限に達したレコードが1つでもあれば、保留中のものをまとめて書き込む
+  uint32_t now = millis();
+  bool due = false;
+  for (int i = 0; i < PERSIST_RECORD_COUNT; i++) {
+    if (!(_pendingMask & (1 << i))) {
+      continue;
+    }
+    const Slot& slot = _slots[i];
+    if (now - slot.lastRequestMs >= PERSIST_DEBOUNCE_MS ||
+        now - slot.firstRequestMs >= PERSIST_MAX_DELAY_MS) {
+      due = true;
+      break;
+    }
+  }
+  
+  if (due) {
+    flush();
+  }
+}
+
+void PersistenceStore::flush() {
+  for (int i = 0; i < PERSIST_RECORD_COUNT; i++) {
+    if (_pendingMask & (1 << i)) {
+      writeRecord((PersistRecord)i);
+    }
+  }
+  _pendingMask = 0;
+}
+
+void PersistenceStore::erase(PersistRecord record) {
+  if (record >= PERSIST_RECORD_COUNT) {
+    return;
+  }
+  _pendingMask &= ~(1 << record);
+  _slots[record].valid = false;
+  if (_open) {
+    _preferences.remove(RECORD_KEYS[record]);
+  }
+}
+
+void PersistenceStore::writeRecord(PersistRecord record) {
+  Slot& slot = _slots[record];
+  if (!_open || slot.data == nullptr) {
+    return;
+  }
+  
+  // 保存済みの内容と同じなら書き込まない
+  if (hasRecord(record) && memcmp(_cache[record], slot.data, slot.size) == 0) {
+    _skipped++;
+    return;
+  }
+  
+  uint8_t buffer[sizeof(RecordHeader) + PERSIST_MAX_RECORD_SIZE];
+  RecordHeader header;
+  header.magic = PERSIST_MAGIC;
+  header.version = slot.version;
+  header.reserved = 0;
+  header.size = slot.size;
+  header.reserved2 = 0;
+  header.crc = crc32(slot.data, slot.size);
+  memcpy(buffer, &header, sizeof(header));
+  memcpy(buffer + sizeof(header), slot.data, slot.size);
+  
+  size_t length = sizeof(header) + slot.size;
+  if (_preferences.putBytes(RECORD_KEYS[record], buffer, length) != length) {
+    LOG_E(LOG_TAG_SETTINGS, "Failed to write record %s", RECORD_KEYS[record]);
+    return;
+  }
+  
+  memcpy(_cache[record], slot.data, slot.size);
+  slot.cachedSize = slot.size;
+  slot.cachedVersion = slot.version;
+  slot.valid = true;
+  _writes++;
+  LOG_D(LOG_TAG_SETTINGS, "Wrote record %s (%u bytes)", RECORD_KEYS[record], (unsigned)length);
+}
+
+uint32_t PersistenceStore::crc32(const void* data, size_t length, uint32_t crc) {
+  // 4ビットずつの表引き（表は16エントリ）
+  static const uint32_t table[16] = {
+    0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+    0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+  };
+  
+  const uint8_t* p = (const uint8_t*)data;
+  crc = ~crc;
+  for (size_t i = 0; i < length; i++) {
+    crc = table[(crc ^ p[i]) & 0x0F] ^ (crc >> 4);
+    crc = table[(crc ^ (p[i] >> 4)) & 0x0F] ^ (crc >> 4);
+  }
+  return ~crc;
+}
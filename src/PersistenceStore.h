@@ -0,0 +1,116 @@
+/*
+ * PersistenceStore.h
+ * 
+ * Coalesced NVS persistence for the Polaris Navigator
+ * Stores each structure (settings, calibration, GPS cache) as a single
+ * versioned, CRC-checked blob in one Preferences namespace
+ * 
+ * 起動時に全レコードを1回で読み込んでRAMに保持し、各マネージャーは
+ * attach()で自分の構造体に読み込む。保存はrequestSave()で予約し、
+ * 最後の変更から一定時間後にservice()でまとめて書き込む。
+ * 前回書き込んだ内容と同じ場合は書き込まない（フラッシュの消耗を抑える）。
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef PERSISTENCE_STORE_H
+#define PERSISTENCE_STORE_H
+
+#include <Arduino.h>
+#include <Preferences.h>
+
+// Storage
+#define PERSIST_NAMESPACE        "polaris"
+#define PERSIST_MAX_RECORD_SIZE  576     // 1レコードの最大サイズ（バイト）
+#define PERSIST_MAGIC            0x504E  // "PN"
+
+// Write scheduling
+#define PERSIST_DEBOUNCE_MS      2000    // 最後の変更からこの時間が経ったら書き込む
+#define PERSIST_MAX_DELAY_MS     10000   // 変更が続いても最初の変更からこの時間で書き込む
+
+// Records (one NVS blob each)
+enum PersistRecord {
+  PERSIST_SETTINGS,     // UserSettings
+  PERSIST_CALIBRATION,  // CalibrationData
+  PERSIST_GYRO_MODEL,   // GyroTempModel（大きく更新頻度も異なるため別レコード）
+  PERSIST_GPS,          // GPSData
+  PERSIST_NETWORK,      // NetworkConfig（Wi-Fiの接続先）
+  PERSIST_RECORD_COUNT
+};
+
+class PersistenceStore {
+public:
+  // Constructor
+  PersistenceStore();
+  
+  // Open the namespace and read every record (call once before attach())
+  bool begin();
+  
+  // Bind an owner's structure to a record and copy the stored contents
+  // Returns true when a stored record with the same version and size
+  // passed the CRC check (data is left untouched otherwise)
+  bool attach(PersistRecord record, void* data, size_t size, uint8_t version);
+  
+  // Whether a valid record was loaded or written
+  bool hasRecord(PersistRecord record) const;
+  
+  // Schedule the attached structure to be written (debounced)
+  void requestSave(PersistRecord record);
+  
+  // Write the records whose debounce has expired (call every loop)
+  void service();
+  
+  // Write every pending record now (before restart or sleep)
+  void flush();
+  
+  // Remove a record from storage
+  void erase(PersistRecord record);
+  
+  // Statistics
+  uint32_t getWriteCount() const { return _writes; }
+  uint32_t getSkippedWrites() const { return _skipped; }
+  bool hasPending() const { return _pendingMask != 0; }
+  
+  // CRC-32 (IEEE 802.3)
+  static uint32_t crc32(const void* data, size_t length, uint32_t crc = 0);
+
+private:
+  // Blob header (payload follows)
+  struct RecordHeader {
+    uint16_t magic;
+    uint8_t version;
+    uint8_t reserved;
+    uint16_t size;
+    uint16_t reserved2;
+    uint32_t crc;       // payloadのCRC
+  };
+  
+  // Write one record if its contents changed
+  void writeRecord(PersistRecord record);
+  
+  Preferences _preferences;
+  bool _open;
+  
+  // Per-record state
+  struct Slot {
+    void* data;          // 所有者の構造体
+    uint16_t size;
+    uint8_t version;
+    bool valid;          // cacheが保存済みの内容と一致している
+    uint16_t cachedSize;
+    uint8_t cachedVersion;
+    uint32_t firstRequestMs;
+    uint32_t lastRequestMs;
+  };
+  Slot _slots[PERSIST_RECORD_COUNT];
+  
+  // Last stored payloads (read at boot, updated on write)
+  uint8_t _cache[PERSIST_RECORD_COUNT][PERSIST_MAX_RECORD_SIZE];
+  
+  uint8_t _pendingMask;
+  uint32_t _writes;
+  uint32_t _skipped;
+};
+
+#endif // PERSISTENCE_STORE_H
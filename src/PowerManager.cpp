@@ -0,0 +1,280 @@
+/*
+ * PowerManager.cpp
+ * 
+ * Implementation of the display and CPU power states
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "PowerManager.h"
+#include <M5Unified.h>
+#include <esp_idf_version.h>
+#include <esp_sleep.h>
+#include <driver/gpio.h>
+#include "Logger.h"
+
+// Constructor
+PowerManager::PowerManager() {
+  _uiTask = nullptr;
+  _state = POWER_ACTIVE;
+  _wakePending = 0;
+  _lastActivityMs = 0;
+  _dimTimeoutMs = 0;
+  _blankTimeoutMs = 0;
+  _brightness = 100;
+  _pmConfigured = false;
+  _lightSleepEnabled = false;
+  _lightSleepAllowed = false;
+  _cpuLock = nullptr;
+  _awakeLock = nullptr;
+  _cpuLockHeld = false;
+  _awakeLockHeld = false;
+}
+
+void PowerManager::begin() {
+  _uiTask = xTaskGetCurrentTaskHandle();
+  _lastActivityMs = millis();
+  
+  // ロックを先に取ってから設定する（設定した瞬間に低クロックへ落ちないように）
+  if (esp_pm_lock_create(ESP_PM_CPU_FREQ_MAX, 0, "ui", &_cpuLock) != ESP_OK ||
+      esp_pm_lock_create(ESP_PM_NO_LIGHT_SLEEP, 0, "display", &_awakeLock) != ESP_OK) {
+    _cpuLock = nullptr;
+    _awakeLock = nullptr;
+  }
+  applyLocks();
+  
+  if (configurePm(true)) {
+    _lightSleepEnabled = true;
+  } else if (!configurePm(false) && _cpuLock != nullptr) {
+    // ロックは作れても設定できない場合は使わない（applyLocks()は直接切り替えに戻る）
+    if (_cpuLockHeld) {
+      esp_pm_lock_release(_cpuLock);
+    }
+    if (_awakeLockHeld) {
+      esp_pm_lock_release(_awakeLock);
+    }
+    esp_pm_lock_delete(_cpuLock);
+    esp_pm_lock_delete(_awakeLock);
+    _cpuLock = nullptr;
+    _awakeLock = nullptr;
+    _cpuLockHeld = false;
+    _awakeLockHeld = false;
+    applyLocks();
+  }
+  
+  if (_lightSleepEnabled) {
+    // ライトスリープ中もボタンで起床する（GPIO41はRTC GPIOではないためレベル起床）
+    gpio_wakeup_enable((gpio_num_t)POWER_BUTTON_PIN, GPIO_INTR_LOW_LEVEL);
+    esp_sleep_enable_gpio_wakeup();
+  }
+  
+  LOG_I(LOG_TAG_MAIN, "Power: clock scaling %s, light sleep %s",
+        _pmConfigured ? "esp_pm" : "setCpuFrequencyMhz", _lightSleepEnabled ? "on" : "off");
+}
+
+bool PowerManager::configurePm(bool lightSleep) {
+  if (_cpuLock == nullptr || _awakeLock == nullptr) {
+    return false;
+  }
+
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+  esp_pm_config_t config = {};
+#else
+  esp_pm_config_esp32s3_t config = {};
+#endif
+  config.max_freq_mhz = POWER_MAX_CPU_MHZ;
+  config.min_freq_mhz = POWER_MIN_CPU_MHZ;
+  config.light_sleep_enable = lightSleep;
+  
+  // tickless idleなしのビルドではライトスリープ付きの設定はESP_ERR_NOT_SUPPORTEDになる
+  esp_err_t result = esp_pm_configure(&config);
+  if (result != ESP_OK) {
+    LOG_D(LOG_TAG_MAIN, "esp_pm_configure(light sleep %d) failed: %d", (int)lightSleep, (int)result);
+    return false;
+  }
+  _pmConfigured = true;
+  return true;
+}
+
+void PowerManager::setSleepTimeout(int seconds) {
+  if (seconds <= 0) {
+    _dimTimeoutMs = 0;
+    _blankTimeoutMs = 0;
+  } else {
+    // 減光は消灯までの半分（最大30秒）で行う
+    _blankTimeoutMs = (uint32_t)seconds * 1000UL;
+    _dimTimeoutMs = _blankTimeoutMs / 2;
+    if (_dimTimeoutMs > POWER_DIM_TIMEOUT_MS) {
+      _dimTimeoutMs = POWER_DIM_TIMEOUT_MS;
+    }
+  }
+  
+  LOG_I(LOG_TAG_MAIN, "Power: dim after %lu s, blank after %lu s (0 = never)",
+        (unsigned long)(_dimTimeoutMs / 1000), (unsigned long)(_blankTimeoutMs / 1000));
+  
+  // 設定の変更は操作として扱う（メニュー操作中に消灯しない）
+  notifyActivity(POWER_WAKE_SETTINGS);
+}
+
+void PowerManager::setBrightness(uint8_t brightness) {
+  _brightness = brightness;
+  if (_state == POWER_ACTIVE) {
+    M5.Display.setBrightness(_brightness);
+  }
+}
+
+bool PowerManager::notifyActivity(PowerWakeSource source) {
+  _lastActivityMs = millis();
+  if (_state == POWER_ACTIVE) {
+    return false;
+  }
+  
+  LOG_D(LOG_TAG_MAIN, "Power: wake by %s", source == POWER_WAKE_BUTTON ? "button" :
+        source == POWER_WAKE_MOTION ? "motion" : "settings");
+  setState(POWER_ACTIVE);
+  return true;
+}
+
+void PowerManager::requestWake(PowerWakeSource source) {
+  portENTER_CRITICAL(&_wakeLock);
+  _wakePending |= source;
+  portEXIT_CRITICAL(&_wakeLock);
+  
+  // 点灯中は最終操作時刻の更新だけでよい（UIタスクは次のループで拾う）
+  if (_state != POWER_ACTIVE && _uiTask != nullptr) {
+    xTaskNotifyGive(_uiTask);
+  }
+}
+
+void PowerManager::motionWake(void* arg) {
+  static_cast<PowerManager*>(arg)->requestWake(POWER_WAKE_MOTION);
+}
+
+void PowerManager::setLightSleepAllowed(bool allowed) {
+  if (allowed == _lightSleepAllowed) {
+    return;
+  }
+  _lightSleepAllowed = allowed;
+  applyLocks();
+}
+
+void PowerManager::update() {
+  portENTER_CRITICAL(&_wakeLock);
+  uint8_t pending = _wakePending;
+  _wakePending = 0;
+  portEXIT_CRITICAL(&_wakeLock);
+  
+  if (pending) {
+    notifyActivity((pending & POWER_WAKE_MOTION) ? POWER_WAKE_MOTION : (PowerWakeSource)pending);
+  }
+  
+  uint32_t idleMs = getIdleMs();
+  PowerState target = POWER_ACTIVE;
+  if (_blankTimeoutMs > 0 && idleMs >= _blankTimeoutMs) {
+    target = POWER_BLANKED;
+  } else if (_dimTimeoutMs > 0 && idleMs >= _dimTimeoutMs) {
+    target = POWER_DIMMED;
+  }
+  
+  // 復帰はnotifyActivity()のみが行い、ここでは暗くする方向だけ
+  if (target > _state) {
+    setState(target);
+  }
+}
+
+void PowerManager::idle(uint32_t maxMs) {
+  uint32_t limit = (_state == POWER_ACTIVE) ? POWER_IDLE_ACTIVE_MS : POWER_IDLE_SLEEP_MS;
+  if (maxMs > limit) {
+    maxMs = limit;
+  }
+  if (maxMs == 0) {
+    maxMs = 1;  // 同じ優先度の他タスクとアイドルタスクに必ず譲る
+  }
+  
+  // requestWake()の通知で早く戻る（ボタンはこの周期でポーリングされる）
+  if (_uiTask != nullptr) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(maxMs));
+  } else {
+    delay(maxMs);
+  }
+}
+
+uint32_t PowerManager::getFrameInterval(uint32_t activeIntervalMs) const {
+  return (_state == POWER_ACTIVE) ? activeIntervalMs : POWER_DIM_FRAME_MS;
+}
+
+uint32_t PowerManager::getIdleMs() const {
+  return millis() - _lastActivityMs;
+}
+
+const char* PowerManager::getStateName(PowerState state) {
+  switch (state) {
+    case POWER_ACTIVE:  return "Active";
+    case POWER_DIMMED:  return "Dimmed";
+    case POWER_BLANKED: return "Blanked";
+    default:            return "?";
+  }
+}
+
+void PowerManager::setState(PowerState state) {
+  PowerState previous = (PowerState)_state;
+  if (state == previous) {
+    return;
+  }
+  
+  // 表示を先に戻すと復帰が体感的に速い（クロックはその後に上げる）
+  if (previous == POWER_BLANKED) {
+    M5.Display.wakeup();
+  }
+  switch (state) {
+    case POWER_ACTIVE:
+      M5.Display.setBrightness(_brightness);
+      break;
+    case POWER_DIMMED:
+      M5.Display.setBrightness(_brightness < POWER_DIM_BRIGHTNESS ? _brightness : POWER_DIM_BRIGHTNESS);
+      break;
+    case POWER_BLANKED:
+      M5.Display.setBrightness(0);
+      M5.Display.sleep();
+      break;
+  }
+  
+  _state = state;
+  applyLocks();
+  
+  LOG_I(LOG_TAG_MAIN, "Power: %s -> %s after %lu s idle", getStateName(previous),
+        getStateName(state), (unsigned long)(getIdleMs() / 1000));
+}
+
+void PowerManager::applyLocks() {
+  bool wantCpu = (_state == POWER_ACTIVE);
+  // バックライトのPWMとGPSの受信はライトスリープ中に止まるため、消灯中かつ許可された場合のみ眠る
+  bool wantAwake = (_state != POWER_BLANKED) || !_lightSleepAllowed;
+  
+  if (_cpuLock == nullptr || _awakeLock == nullptr) {
+    // esp_pmが使えない場合はクロックを直接切り替える
+    uint32_t mhz = wantCpu ? POWER_MAX_CPU_MHZ : POWER_MIN_CPU_MHZ;
+    if (getCpuFrequencyMhz() != mhz) {
+      setCpuFrequencyMhz(mhz);
+    }
+    return;
+  }
+  
+  if (wantCpu != _cpuLockHeld) {
+    if (wantCpu) {
+      esp_pm_lock_acquire(_cpuLock);
+    } else {
+      esp_pm_lock_release(_cpuLock);
+    }
+    _cpuLockHeld = wantCpu;
+  }
+  if (wantAwake != _awakeLockHeld) {
+    if (wantAwake) {
+      esp_pm_lock_acquire(_awakeLock);
+    } else {
+      esp_pm_lock_release(_awakeLock);
+    }
+    _awakeLockHeld = wantAwake;
+  }
+}
@@ -0,0 +1,133 @@
+/*
+ * PowerManager.h
+ * 
+ * Power management for the Polaris Navigator
+ * Dims and blanks the display after inactivity, lowers the CPU clock while
+ * the screen is static and lets the chip light-sleep between sensor batches
+ * 
+ * 画面が点灯している間はCPUを最高クロックに保ち、減光中は80MHzに下げる。
+ * 消灯中はESP32-S3の自動ライトスリープを許可し、センサータスクの
+ * タイマー（FIFOのバッチ周期）とボタンで起床する。IMUの姿勢推定は
+ * 消灯中も止めない。ボタンまたはセンサータスクの動き検出で即座に点灯する。
+ * 
+ * 自動ライトスリープにはFreeRTOSのtickless idleを有効にしたビルドが必要。
+ * 使えない場合はクロック切り替え（DFS）のみ、それも使えない場合は
+ * setCpuFrequencyMhz()で切り替える。
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef POWER_MANAGER_H
+#define POWER_MANAGER_H
+
+#include <Arduino.h>
+#include <esp_pm.h>
+
+// Wake inputs
+#define POWER_BUTTON_PIN        41     // AtomS3RのボタンA（押下でLOW）
+
+// Inactivity timeouts
+#define POWER_DIM_TIMEOUT_MS    30000  // 操作・動きがない場合に減光するまでの時間（上限）
+#define POWER_DIM_BRIGHTNESS    8      // 減光中の輝度（0-255）
+
+// UI pacing per state
+#define POWER_DIM_FRAME_MS      1000   // 減光中の描画間隔
+#define POWER_IDLE_ACTIVE_MS    5      // 点灯中にloop()が待つ最大時間（ボタンの応答性）
+#define POWER_IDLE_SLEEP_MS     50     // 減光・消灯中にloop()が待つ最大時間
+
+// CPU clock (DFS)
+#define POWER_MAX_CPU_MHZ       240
+#define POWER_MIN_CPU_MHZ       80     // APBを80MHzに保てる最低値（UARTのボーレートが変わらない）
+
+// Power states
+enum PowerState {
+  POWER_ACTIVE,    // 通常の輝度、最高クロック
+  POWER_DIMMED,    // 減光、描画間隔を延ばしてクロックを下げる
+  POWER_BLANKED    // 消灯、ライトスリープを許可（IMUは動作を続ける）
+};
+
+// Activity sources
+enum PowerWakeSource {
+  POWER_WAKE_BUTTON   = 0x01,
+  POWER_WAKE_MOTION   = 0x02,
+  POWER_WAKE_SETTINGS = 0x04
+};
+
+class PowerManager {
+public:
+  // Constructor
+  PowerManager();
+  
+  // Configure clock scaling, light sleep and wake sources
+  // Call from the UI task (loop()), which is the task woken on activity
+  void begin();
+  
+  // Inactivity timeout from the settings (seconds, 0 = never dim or blank)
+  void setSleepTimeout(int seconds);
+  
+  // Normal display brightness (0-255), restored when waking
+  void setBrightness(uint8_t brightness);
+  
+  // Report activity from the UI task
+  // Returns true when the display was dimmed or blanked (the input only woke it)
+  bool notifyActivity(PowerWakeSource source);
+  
+  // Report activity from another task (sensor task); wakes the UI task
+  void requestWake(PowerWakeSource source);
+  
+  // Motion callback for SensorTask::setMotionCallback()
+  static void motionWake(void* arg);
+  
+  // Allow light sleep while blanked (e.g. once the clock has been synchronized,
+  // since the GPS UART loses sentences while the chip sleeps)
+  void setLightSleepAllowed(bool allowed);
+  
+  // Apply pending wakes and inactivity timeouts (call every loop)
+  void update();
+  
+  // Wait for the next loop iteration (returns early on a wake request)
+  void idle(uint32_t maxMs);
+  
+  // Display pacing
+  bool isDisplayOn() const { return _state != POWER_BLANKED; }
+  uint32_t getFrameInterval(uint32_t activeIntervalMs) const;
+  
+  // Status
+  PowerState getState() const { return (PowerState)_state; }
+  static const char* getStateName(PowerState state);
+  bool isClockScalingEnabled() const { return _pmConfigured; }
+  bool isLightSleepEnabled() const { return _lightSleepEnabled; }
+  uint32_t getIdleMs() const;
+
+private:
+  // Switch state (display and locks)
+  void setState(PowerState state);
+  
+  // Acquire or release the power-management locks for the current state
+  void applyLocks();
+  
+  // Try automatic light sleep, then clock scaling only
+  bool configurePm(bool lightSleep);
+  
+  TaskHandle_t _uiTask;
+  volatile uint8_t _state;
+  volatile uint8_t _wakePending;     // PowerWakeSourceのビット（他タスクから設定）
+  portMUX_TYPE _wakeLock = portMUX_INITIALIZER_UNLOCKED;
+  
+  uint32_t _lastActivityMs;
+  uint32_t _dimTimeoutMs;
+  uint32_t _blankTimeoutMs;
+  uint8_t _brightness;
+  
+  // Power management (esp_pm)
+  bool _pmConfigured;
+  bool _lightSleepEnabled;
+  bool _lightSleepAllowed;
+  esp_pm_lock_handle_t _cpuLock;     // 点灯中は最高クロックを保つ
+  esp_pm_lock_handle_t _awakeLock;   // 消灯するまでライトスリープを禁止する
+  bool _cpuLockHeld;
+  bool _awakeLockHeld;
+};
+
+#endif // POWER_MANAGER_H
@@ -0,0 +1,190 @@
+/*
+ * Profiler.cpp
+ * 
+ * Implementation of the loop profiler
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "Profiler.h"
+#include <stdarg.h>
+#include <esp_idf_version.h>
+#include <rom/ets_sys.h>
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+#include <esp_cpu.h>
+#else
+#include <hal/cpu_hal.h>
+#endif
+
+ProfileCounters Profiler::_counters[PROFILE_STAGE_COUNT];
+ProfileCounters Profiler::_previous[PROFILE_STAGE_COUNT];
+ProfileWindow Profiler::_window[PROFILE_STAGE_COUNT];
+uint32_t Profiler::_windowStartMs = 0;
+uint32_t Profiler::_previousUartBytes = 0;
+float Profiler::_uartPercent = 0.0f;
+uint32_t Profiler::_previousI2cBytes = 0;
+float Profiler::_i2cPercent = 0.0f;
+uint32_t Profiler::_minFreeHeap = 0;
+uint32_t Profiler::_largestFreeBlock = 0;
+
+// Stage names (ProfileStageの順)
+static const char* const STAGE_NAMES[PROFILE_STAGE_COUNT] = {
+  "loop", "gps", "imu read", "fusion", "ephemeris", "render", "spi push", "latency"
+};
+
+// Tasks reported by dump()
+static const char* const TASK_NAMES[] = {"loopTask", "SensorTask", "gps", "recorder"};
+
+uint32_t Profiler::cycles() {
+#if ESP_IDF_VERSION >= ESP_IDF_VERSION_VAL(5, 0, 0)
+  return (uint32_t)esp_cpu_get_cycle_count();
+#else
+  return cpu_hal_get_cycle_count();
+#endif
+}
+
+uint32_t Profiler::cyclesPerUs() {
+  // 周波数の切り替え時に更新される値（MHz）
+  uint32_t mhz = ets_get_cpu_frequency();
+  return mhz ? mhz : 1;
+}
+
+void Profiler::record(ProfileStage stage, uint32_t cycles) {
+  recordUs(stage, cycles / cyclesPerUs());
+}
+
+void Profiler::recordUs(ProfileStage stage, uint32_t us) {
+  ProfileCounters& c = _counters[stage];
+  
+  // log2のバケット（0-1usは0番）
+  int bucket = us > 1 ? 31 - __builtin_clz(us) : 0;
+  if (bucket >= PROFILER_BUCKETS) {
+    bucket = PROFILER_BUCKETS - 1;
+  }
+  
+  c.count++;
+  c.totalUs += us;
+  c.buckets[bucket]++;
+  if (us > c.maxUs) {
+    c.maxUs = us;
+  }
+}
+
+void Profiler::service(uint32_t uartBytes, uint32_t uartBytesPerS,
+                       uint32_t i2cBytes, uint32_t i2cBytesPerS) {
+  uint32_t now = millis();
+  if (_windowStartMs == 0) {
+    _windowStartMs = now;
+    _previousUartBytes = uartBytes;
+    _previousI2cBytes = i2cBytes;
+    memcpy(_previous, _counters, sizeof(_previous));
+    return;
+  }
+  uint32_t elapsedMs = now - _windowStartMs;
+  if (elapsedMs < PROFILER_WINDOW_MS) {
+    return;
+  }
+  
+  // センサータスクが記録中でも加算だけなので、差分は高々1件ずれる程度
+  for (int i = 0; i < PROFILE_STAGE_COUNT; i++) {
+    ProfileCounters current = _counters[i];
+    _counters[i].maxUs = 0;
+    const ProfileCounters& previous = _previous[i];
+    ProfileWindow& w = _window[i];
+    
+    w.count = current.count - previous.count;
+    uint32_t busyUs = current.totalUs - previous.totalUs;
+    w.ratePerS = w.count * 1000.0f / elapsedMs;
+    w.avgUs = w.count ? busyUs / w.count : 0;
+    w.maxUs = current.maxUs;
+    w.busyPercent = busyUs * 0.1f / elapsedMs;
+    
+    // 95パーセンタイル（該当するバケットの上端）
+    uint32_t target = w.count - w.count / 20;
+    uint32_t seen = 0;
+    w.p95Us = 0;
+    for (int b = 0; b < PROFILER_BUCKETS && w.count > 0; b++) {
+      seen += current.buckets[b] - previous.buckets[b];
+      if (seen >= target) {
+        w.p95Us = 2u << b;
+        break;
+      }
+    }
+    _previous[i] = current;
+  }
+  
+  // GPSのUART（受信バイト数 / 回線の最大）
+  uint32_t bytes = uartBytes - _previousUartBytes;
+  _previousUartBytes = uartBytes;
+  _uartPercent = uartBytesPerS ? bytes * 100000.0f / ((float)uartBytesPerS * elapsedMs) : 0.0f;
+  
+  // 内部I2C（センサータスクが転送したバイト数 / 回線の最大）
+  bytes = i2cBytes - _previousI2cBytes;
+  _previousI2cBytes = i2cBytes;
+  _i2cPercent = i2cBytesPerS ? bytes * 100000.0f / ((float)i2cBytesPerS * elapsedMs) : 0.0f;
+  
+  _minFreeHeap = ESP.getMinFreeHeap();
+  _largestFreeBlock = ESP.getMaxAllocHeap();
+  _windowStartMs = now;
+}
+
+uint32_t Profiler::getStackFree(const char* taskName) {
+  TaskHandle_t handle = xTaskGetHandle(taskName);
+  return handle ? uxTaskGetStackHighWaterMark(handle) : 0;
+}
+
+const char* Profiler::getStageName(ProfileStage stage) {
+  return stage < PROFILE_STAGE_COUNT ? STAGE_NAMES[stage] : "?";
+}
+
+// Format into a stack buffer and write it out
+// （Serial.printf()は64文字を超える行でヒープを確保するため使わない）
+static void printLine(const char* format, ...) __attribute__((format(printf, 1, 2)));
+static void printLine(const char* format, ...) {
+  char line[PROFILER_LINE_MAX];
+  va_list args;
+  va_start(args, format);
+  int length = vsnprintf(line, sizeof(line), format, args);
+  va_end(args);
+  if (length > 0) {
+    Serial.write((const uint8_t*)line, length < (int)sizeof(line) ? length : sizeof(line) - 1);
+  }
+}
+
+void Profiler::dump() {
+  // 1行ずつ出力する（Loggerの行長制限を避けるため直接Serialへ）
+  Serial.println("=== Profiler (window / since reset) ===");
+  for (int i = 0; i < PROFILE_STAGE_COUNT; i++) {
+    const ProfileWindow& w = _window[i];
+    const ProfileCounters& c = _counters[i];
+    printLine("%-10s %6.1f/s avg %6u us p95 <%6u us max %6u us busy %5.1f%% | total %u\n",
+              STAGE_NAMES[i], w.ratePerS, (unsigned)w.avgUs, (unsigned)w.p95Us,
+              (unsigned)w.maxUs, w.busyPercent, (unsigned)c.count);
+    
+    // ヒストグラム（空でないバケットのみ）
+    Serial.print("           ");
+    for (int b = 0; b < PROFILER_BUCKETS; b++) {
+      if (c.buckets[b] != 0) {
+        printLine(" <%uus:%u", (unsigned)(2u << b), (unsigned)c.buckets[b]);
+      }
+    }
+    Serial.println();
+  }
+  
+  printLine("I2C %.1f%%  UART %.1f%%  SPI %.1f%%\n",
+            getI2cPercent(), getUartPercent(), getSpiPercent());
+  printLine("heap: free %u, min free %u, largest block %u\n",
+            (unsigned)ESP.getFreeHeap(), (unsigned)ESP.getMinFreeHeap(),
+            (unsigned)ESP.getMaxAllocHeap());
+  Serial.print("stack free:");
+  for (const char* name : TASK_NAMES) {
+    printLine(" %s %u", name, (unsigned)getStackFree(name));
+  }
+  Serial.println();
+}
+
+void Profiler::reset() {
+  memset(_counters, 0, sizeof(_counters));
+  memset(_previous, 0, sizeof(_previous));
+}
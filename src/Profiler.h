@@ -0,0 +1,132 @@
+/*
+ * Profiler.h
+ * 
+ * Lightweight loop profiler for the Polaris Navigator
+ * Scoped cycle-counter timers with per-stage log2 histograms, bus
+ * utilisation and heap/stack high-water marks
+ * 
+ * 各ステージは1つのタスクだけが記録する（UIタスクまたはセンサータスク）。
+ * 記録は加算のみで、UIタスクのservice()が一定間隔で前回との差分から
+ * 区間の平均・95パーセンタイル・最大を求める。表示はRAW_PERFORMANCE画面、
+ * シリアルからは 'p' で全ステージのヒストグラムを出力する。
+ * 
+ * サイクルカウンタはコアごとのため、計測区間は同じタスク内で閉じること。
+ * 周波数はスコープの終わりの値で換算する（減光中の周波数切り替えを
+ * またいだ区間だけは誤差が出る）。
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+#include <Arduino.h>
+
+// Compile-time switch (0 removes every PROFILE_SCOPE)
+#ifndef PROFILER_ENABLED
+#define PROFILER_ENABLED 1
+#endif
+
+// Histogram: bucket i counts durations in [2^i, 2^(i+1)) microseconds
+#define PROFILER_BUCKETS    16           // 最後のバケットは32ms以上
+#define PROFILER_WINDOW_MS  2000         // 平均・パーセンタイルを求める区間
+#define PROFILER_LINE_MAX   128          // dump()の1行の最大長
+
+// Profiled stages
+enum ProfileStage {
+  PROFILE_LOOP,        // loop() 1回（待機を除く）
+  PROFILE_GPS,         // readGPS()
+  PROFILE_IMU_READ,    // センサータスク: FIFO・地磁気・温度の読み出し（I2C）
+  PROFILE_FUSION,      // センサータスク: バイアス推定とAHRS（1バッチ）
+  PROFILE_EPHEMERIS,   // calculateCelestialPositions()
+  PROFILE_RENDER,      // updateDisplay()（描画と転送）
+  PROFILE_PUSH,        // 変化したタイルのSPI転送
+  PROFILE_LATENCY,     // 表示の遅れ: 姿勢のサンプル時刻から転送完了まで（記録のみ）
+  PROFILE_STAGE_COUNT
+};
+
+// Cumulative counters of one stage (single writer)
+struct ProfileCounters {
+  uint32_t count;
+  uint32_t totalUs;      // 符号なしの差分で使うため桁あふれしてもよい
+  uint32_t maxUs;        // 区間内の最大（service()が0に戻す）
+  uint32_t buckets[PROFILER_BUCKETS];
+};
+
+// Statistics of the last window
+struct ProfileWindow {
+  uint32_t count;
+  float ratePerS;
+  uint32_t avgUs;
+  uint32_t p95Us;        // バケットの上端（2のべき乗の粒度）
+  uint32_t maxUs;
+  float busyPercent;     // 区間に占める割合
+};
+
+class Profiler {
+public:
+  // Record one duration (called by ProfileScope) / one measured in microseconds
+  static void record(ProfileStage stage, uint32_t cycles);
+  static void recordUs(ProfileStage stage, uint32_t us);
+  
+  // Current cycle counter and cycles per microsecond
+  static uint32_t cycles();
+  static uint32_t cyclesPerUs();
+  
+  // Roll the window when due (UI task, every loop)
+  // uartBytes / i2cBytes are running counts of bytes moved on each bus,
+  // the *PerS arguments the most each bus can carry
+  static void service(uint32_t uartBytes, uint32_t uartBytesPerS,
+                      uint32_t i2cBytes, uint32_t i2cBytesPerS);
+  
+  // Last window
+  static const ProfileWindow& getWindow(ProfileStage stage) { return _window[stage]; }
+  static float getI2cPercent() { return _i2cPercent; }
+  static float getSpiPercent() { return _window[PROFILE_PUSH].busyPercent; }
+  static float getUartPercent() { return _uartPercent; }
+  
+  // Heap and stack high-water marks (sampled by service())
+  static uint32_t getMinFreeHeap() { return _minFreeHeap; }
+  static uint32_t getLargestFreeBlock() { return _largestFreeBlock; }
+  static uint32_t getStackFree(const char* taskName);
+  
+  static const char* getStageName(ProfileStage stage);
+  
+  // Serial report (histograms since boot or reset()) / clear the histograms
+  static void dump();
+  static void reset();
+
+private:
+  static ProfileCounters _counters[PROFILE_STAGE_COUNT];
+  static ProfileCounters _previous[PROFILE_STAGE_COUNT];
+  static ProfileWindow _window[PROFILE_STAGE_COUNT];
+  static uint32_t _windowStartMs;
+  static uint32_t _previousUartBytes;
+  static float _uartPercent;
+  static uint32_t _previousI2cBytes;
+  static float _i2cPercent;
+  static uint32_t _minFreeHeap;
+  static uint32_t _largestFreeBlock;
+};
+
+// Times the enclosing block
+class ProfileScope {
+public:
+  explicit ProfileScope(ProfileStage stage) : _stage(stage), _start(Profiler::cycles()) {}
+  ~ProfileScope() { Profiler::record(_stage, Profiler::cycles() - _start); }
+
+private:
+  ProfileStage _stage;
+  uint32_t _start;
+};
+
+#if PROFILER_ENABLED
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b)  PROFILE_CONCAT_(a, b)
+#define PROFILE_SCOPE(stage)  ProfileScope PROFILE_CONCAT(_profileScope, __LINE__)(stage)
+#else
+#define PROFILE_SCOPE(stage)  do { } while (0)
+#endif
+
+#endif // PROFILER_H
@@ -8,8 +8,17 @@
  */
 
 #include "RawDataDisplay.h"
+#include "SensorTask.h"
+#include "BootSequencer.h"
+#include "Profiler.h"
 #include <math.h>
 
+// センサータスクのスナップショット（メインプログラムで定義）
+extern OrientationData orientation;
+
+// 起動時間の内訳（メインプログラムで定義）
+extern BootSequencer bootSequencer;
+
 // Constructor
 RawDataDisplay::RawDataDisplay() {
   _detailedView = false;
@@ -118,6 +127,17 @@ void RawDataDisplay::update(RawDataMode mode) {
       showSystemInfo();
       break;
       
+    case RAW_PERFORMANCE:
+      // Loop profiler display
+      M5.Display.fillScreen(TFT_BLACK);
+      M5.Display.setTextColor(TFT_CYAN);
+      M5.Display.setTextSize(1);
+      M5.Display.setCursor(2, 0);
+      M5.Display.println("PERFORMANCE");
+      // 直近の区間の統計を表示
+      showPerformance();
+      break;
+      
     case DISPLAY_DEBUG:
       M5.Display.fillScreen(TFT_BLACK);
       M5.Display.setTextColor(0xFD20);  // Orange color
@@ -153,6 +173,9 @@ void RawDataDisplay::update(RawDataMode mode) {
     case RAW_SYSTEM:
       setPixelColor(0xFFFF00); // Yellow
       break;
+    case RAW_PERFORMANCE:
+      setPixelColor(0x00FFFF); // Cyan
+      break;
     case DISPLAY_DEBUG:
       setPixelColor(0xFF8000); // Orange
       break;
@@ -167,14 +190,14 @@ void RawDataDisplay::showRawIMU() {
   // グローバル変数からIMUデータを取得
   extern float heading, pitch, roll;
   
-  // 直接センサーからデータを取得
-  float acc[3], gyro[3], mag[3];
-  bool accOk = false, gyroOk = false, magOk = false;
-  
-  // センサーデータを取得 - 毎回最新のデータを取得するために直接呼び出し
-  accOk = M5.Imu.getAccel(&acc[0], &acc[1], &acc[2]);    // 加速度 (g)
-  gyroOk = M5.Imu.getGyro(&gyro[0], &gyro[1], &gyro[2]);  // 角速度 (dps)
-  magOk = M5.Imu.getMag(&mag[0], &mag[1], &mag[2]);      // 地磁気 (μT)
+  // センサータスクのスナップショットからデータを取得
+  // （IMUへの直接アクセスはセンサータスクのみが行う）
+  const float* acc = orientation.acc;     // 加速度 (g)
+  const float* gyro = orientation.gyro;   // 角速度 (dps)
+  const float* mag = orientation.mag;     // 地磁気 (μT)
+  bool accOk = orientation.accOk;
+  bool gyroOk = orientation.gyroOk;
+  bool magOk = orientation.magOk;
   
   // テキスト設定
   M5.Display.setTextColor(TFT_WHITE);
@@ -452,9 +475,9 @@ void RawDataDisplay::showSystemInfo() {
   M5.Display.print("MB");
   y += 10;
   
-  // 温度情報（M5Unifiedから取得）
-  float temp = 0;
-  if (M5.Imu.getTemp(&temp)) {
+  // 温度情報（センサータスクのスナップショットから取得）
+  float temp = orientation.temperature;
+  if (orientation.temperatureOk) {
     M5.Display.setCursor(2, y);
     M5.Display.print("Temp: ");
     M5.Display.print(temp, 1);
@@ -478,16 +501,17 @@ void RawDataDisplay::showSystemInfo() {
     y += 10;
   }
   
-  // 実行時間
+  // 実行時間と起動にかかった時間（内訳は起動時にシリアルへ出力）
   M5.Display.setCursor(2, y);
-  M5.Display.print("Uptime: ");
+  M5.Display.print("Up ");
   unsigned long uptime = millis() / 1000; // 秒単位
   int hours = uptime / 3600;
   int mins = (uptime % 3600) / 60;
   int secs = uptime % 60;
   
-  char uptimeStr[16];
-  sprintf(uptimeStr, "%02d:%02d:%02d", hours, mins, secs);
+  char uptimeStr[24];
+  snprintf(uptimeStr, sizeof(uptimeStr), "%02d:%02d:%02d Boot %.1fs", hours, mins, secs,
+           bootSequencer.getTotalMs() / 1000.0f);
   M5.Display.print(uptimeStr);
   y += 10;
   
@@ -590,30 +614,77 @@ void RawDataDisplay::showRawCelestial(float sunAz, float sunAlt,
 }
 
 // デバッグ情報を表示する関数
+void RawDataDisplay::showPerformance() {
+  M5.Display.setTextColor(TFT_WHITE);
+  M5.Display.setTextSize(1);
+  
+  int y = 10;
+  
+  // ステージごとの平均 / 95パーセンタイル / 最大（単位はms、1ms未満はus）
+  M5.Display.setCursor(2, y);
+  M5.Display.print("stage   avg  p95  max");
+  y += 9;
+  for (int i = 0; i < PROFILE_STAGE_COUNT; i++) {
+    const ProfileWindow& w = Profiler::getWindow((ProfileStage)i);
+    char line[32];
+    char avg[8], p95[8], max[8];
+    formatDuration(avg, sizeof(avg), w.avgUs);
+    formatDuration(p95, sizeof(p95), w.p95Us);
+    formatDuration(max, sizeof(max), w.maxUs);
+    snprintf(line, sizeof(line), "%-6.6s%5s%5s%5s", Profiler::getStageName((ProfileStage)i),
+             avg, p95, max);
+    M5.Display.setCursor(2, y);
+    M5.Display.print(line);
+    y += 9;
+  }
+  
+  // I2C・UART・SPIの使用率
+  M5.Display.setCursor(2, y);
+  M5.Display.printf("I2C%3.0f UA%3.0f SPI%3.0f%%",
+                    Profiler::getI2cPercent(), Profiler::getUartPercent(),
+                    Profiler::getSpiPercent());
+  y += 10;
+  
+  // ヒープの最小空き容量と最大の連続領域
+  M5.Display.setCursor(2, y);
+  M5.Display.printf("Heap %uK blk %uK", (unsigned)(Profiler::getMinFreeHeap() / 1024),
+                    (unsigned)(Profiler::getLargestFreeBlock() / 1024));
+  y += 10;
+  
+  // スタックの残り（UI / センサータスク）
+  M5.Display.setCursor(2, y);
+  M5.Display.printf("Stack ui %u sns %u", (unsigned)Profiler::getStackFree("loopTask"),
+                    (unsigned)Profiler::getStackFree("SensorTask"));
+}
+
+void RawDataDisplay::formatDuration(char* buffer, size_t size, uint32_t us) {
+  if (us < 1000) {
+    snprintf(buffer, size, "%uu", (unsigned)us);
+  } else if (us < 10000) {
+    snprintf(buffer, size, "%.1fm", us / 1000.0f);
+  } else {
+    snprintf(buffer, size, "%um", (unsigned)(us / 1000));
+  }
+}
+
 void RawDataDisplay::showDebugInfo(const char* debugMessage) {
   // テキスト設定
   M5.Display.setTextColor(0xFD20); // オレンジ色
   M5.Display.setTextSize(1);
   
-  // グローバル変数からIMUデータを取得
-  extern BMI270 bmi270;
-  extern BMM150class bmm150;
-  extern float heading, pitch, roll;
-  
-  // 直接センサーからデータを取得
-  // 最新のデータを取得するために直接センサーから読み取り
-  bmi270.readAcceleration();
-  bmi270.readGyro();
-  bmm150.readMagnetometer();
+  // センサータスクのスナップショットからデータを取得
+  // （表示中にI2Cを直接読むとセンサータスクのサンプリングと競合するため）
+  const float* mag = orientation.mag;
+  const float* acc = orientation.acc;
   
   // XY, YZ, XZ平面の方位角を計算
-  float xy_angle = atan2(bmm150.mag_y, bmm150.mag_x) * 180.0 / PI;
+  float xy_angle = atan2(mag[1], mag[0]) * 180.0 / PI;
   if (xy_angle < 0) xy_angle += 360.0;
   
-  float yz_angle = atan2(bmm150.mag_z, bmm150.mag_y) * 180.0 / PI;
+  float yz_angle = atan2(mag[2], mag[1]) * 180.0 / PI;
   if (yz_angle < 0) yz_angle += 360.0;
   
-  float xz_angle = atan2(bmm150.mag_z, bmm150.mag_x) * 180.0 / PI;
+  float xz_angle = atan2(mag[2], mag[0]) * 180.0 / PI;
   if (xz_angle < 0) xz_angle += 360.0;
   
   // タイトル表示
@@ -694,28 +765,28 @@ void RawDataDisplay::showDebugInfo(const char* debugMessage) {
   M5.Display.setTextColor(TFT_CYAN);
   M5.Display.setCursor(2, y);
   M5.Display.print("Mag X: ");
-  M5.Display.print(bmm150.mag_x, 2);
+  M5.Display.print(mag[0], 2);
   M5.Display.setCursor(80, y);
   M5.Display.print("Y: ");
-  M5.Display.print(bmm150.mag_y, 2);
+  M5.Display.print(mag[1], 2);
   y += 10;
   M5.Display.setCursor(2, y);
   M5.Display.print("Mag Z: ");
-  M5.Display.print(bmm150.mag_z, 2);
+  M5.Display.print(mag[2], 2);
   y += 15;
   
   // 加速度計の生値
   M5.Display.setTextColor(TFT_YELLOW);
   M5.Display.setCursor(2, y);
   M5.Display.print("Acc X: ");
-  M5.Display.print(bmi270.acc_x, 2);
+  M5.Display.print(acc[0], 2);
   M5.Display.setCursor(80, y);
   M5.Display.print("Y: ");
-  M5.Display.print(bmi270.acc_y, 2);
+  M5.Display.print(acc[1], 2);
   y += 10;
   M5.Display.setCursor(2, y);
   M5.Display.print("Acc Z: ");
-  M5.Display.print(bmi270.acc_z, 2);
+  M5.Display.print(acc[2], 2);
   
   // LED色をシアンに設定
   setPixelColor(0x00FFFF); // シアン
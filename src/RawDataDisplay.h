@@ -51,6 +51,9 @@ public:
   // Display system information
   void showSystemInfo();
   
+  // Display loop profiler statistics
+  void showPerformance();
+  
   // Display debug information
   void showDebugInfo(const char* debugMessage);
   
@@ -72,6 +75,7 @@ private:
   void formatTimeValue(char* buffer, int hours, int minutes, int seconds);
   void formatDateValue(char* buffer, int year, int month, int day);
   void formatCoordinateValue(char* buffer, float value, bool isLatitude);
+  void formatDuration(char* buffer, size_t size, uint32_t us);
   
   // Serial output helpers
   void printRawIMUData(BMI270* bmi270, BMM150class* bmm150);
@@ -0,0 +1,95 @@
+/*
+ * RefreshScheduler.cpp
+ * 
+ * Implementation of the adaptive display refresh
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "RefreshScheduler.h"
+#include <math.h>
+
+// Constructor
+RefreshScheduler::RefreshScheduler() {
+  for (int i = 0; i < 4; i++) {
+    _renderedQuat[i] = (i == 0) ? 1.0f : 0.0f;
+    _observedQuat[i] = _renderedQuat[i];
+  }
+  _renderedValid = false;
+  _hasObserved = false;
+  _forced = true;
+  _lastRenderMs = 0;
+  _lastObserveMs = 0;
+  _changeDeg = 0.0f;
+  _rateDps = 0.0f;
+}
+
+float RefreshScheduler::angleBetween(const float a[4], const float b[4]) {
+  // 相対回転 conj(a)*b のベクトル部の大きさ = sin(角度/2)
+  // （小さな角度ではacos(内積)より桁落ちが少ない）
+  float x = a[0] * b[1] - a[1] * b[0] - a[2] * b[3] + a[3] * b[2];
+  float y = a[0] * b[2] + a[1] * b[3] - a[2] * b[0] - a[3] * b[1];
+  float z = a[0] * b[3] - a[1] * b[2] + a[2] * b[1] - a[3] * b[0];
+  float w = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+  float s = sqrtf(x * x + y * y + z * z);
+  return 2.0f * atan2f(s, fabsf(w)) * RAD_TO_DEG;
+}
+
+void RefreshScheduler::observe(const float quat[4], uint32_t nowMs) {
+  if (_hasObserved) {
+    // 新しいスナップショットが来た場合のみ速さを更新する
+    float step = angleBetween(_observedQuat, quat);
+    uint32_t dtMs = nowMs - _lastObserveMs;
+    if (step > 0.0f && dtMs > 0) {
+      float dt = dtMs * 0.001f;
+      float alpha = dt / (REFRESH_RATE_TAU_S + dt);
+      _rateDps += alpha * (step / dt - _rateDps);
+      _lastObserveMs = nowMs;
+    } else if (dtMs >= REFRESH_IDLE_MS) {
+      // 姿勢が更新されない間は止まっているとみなす
+      _rateDps = 0.0f;
+      _lastObserveMs = nowMs;
+    }
+  } else {
+    _lastObserveMs = nowMs;
+  }
+  
+  for (int i = 0; i < 4; i++) {
+    _observedQuat[i] = quat[i];
+  }
+  _hasObserved = true;
+  _changeDeg = _renderedValid ? angleBetween(_renderedQuat, quat) : 180.0f;
+}
+
+uint32_t RefreshScheduler::getInterval() const {
+  if (_changeDeg < REFRESH_VISIBLE_DEG) {
+    return REFRESH_IDLE_MS;
+  }
+  return (_rateDps >= REFRESH_FAST_RATE_DPS) ? REFRESH_FAST_MS : REFRESH_ACTIVE_MS;
+}
+
+bool RefreshScheduler::isDue(uint32_t nowMs, uint32_t frameIntervalMs) const {
+  if (_forced) {
+    return true;
+  }
+  
+  uint32_t elapsed = nowMs - _lastRenderMs;
+  
+  // 変化がなくても一定間隔で描く（時刻や衛星数などの更新）
+  uint32_t maxInterval = frameIntervalMs > REFRESH_IDLE_MS ? frameIntervalMs : REFRESH_IDLE_MS;
+  if (elapsed >= maxInterval) {
+    return true;
+  }
+  return _changeDeg >= REFRESH_VISIBLE_DEG && elapsed >= frameIntervalMs;
+}
+
+void RefreshScheduler::rendered(uint32_t nowMs) {
+  for (int i = 0; i < 4; i++) {
+    _renderedQuat[i] = _observedQuat[i];
+  }
+  _renderedValid = _hasObserved;
+  _forced = false;
+  _lastRenderMs = nowMs;
+  _changeDeg = 0.0f;
+}
@@ -0,0 +1,77 @@
+/*
+ * RefreshScheduler.h
+ * 
+ * Adaptive display refresh for the Polaris Navigator
+ * Redraws quickly while the attitude on screen is changing and drops to
+ * a slow refresh when nothing visible has moved
+ * 
+ * 描画のたびに表示した姿勢（クォータニオン）を記録し、最新の
+ * スナップショットとの回転角で変化を測る。変化が見える大きさになれば
+ * 回転の速さに応じて30Hzまたは60Hzで描画し、変化がなければ1Hzで
+ * 時刻などの表示だけを更新する。センサータスクの公開周期
+ * （FIFOモードでは25Hz）より速く描いても同じ姿勢になるため、
+ * 新しいスナップショットが来るまでは描画しない。
+ * 
+ * 減光中の間隔はPowerManager::getFrameInterval()が決める。
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef REFRESH_SCHEDULER_H
+#define REFRESH_SCHEDULER_H
+
+#include <Arduino.h>
+
+// Frame intervals
+#define REFRESH_FAST_MS        16      // 速く回している間（約60Hz）
+#define REFRESH_ACTIVE_MS      33      // 微調整中（約30Hz）
+#define REFRESH_IDLE_MS        1000    // 変化がない間（時計・GPS表示の更新）
+
+// Change detection
+#define REFRESH_VISIBLE_DEG    0.2f    // 前回の描画からこれ以上回転したら描き直す
+#define REFRESH_FAST_RATE_DPS  10.0f   // これより速い回転では最短間隔で描く
+#define REFRESH_RATE_TAU_S     0.2f    // 回転の速さのローパス時定数（秒）
+
+class RefreshScheduler {
+public:
+  // Constructor
+  RefreshScheduler();
+  
+  // Attitude the next frame would show (call every loop in attitude views)
+  void observe(const float quat[4], uint32_t nowMs);
+  
+  // Force the next check to redraw (mode change, menu, wake)
+  void requestRedraw() { _forced = true; }
+  
+  // Target interval for the current change rate
+  uint32_t getInterval() const;
+  
+  // True when a frame should be drawn now
+  // frameIntervalMs is the interval after power management (減光中は長い)
+  bool isDue(uint32_t nowMs, uint32_t frameIntervalMs) const;
+  
+  // Record that a frame was drawn with the last observed attitude
+  void rendered(uint32_t nowMs);
+  
+  // Status
+  uint32_t getLastRenderMs() const { return _lastRenderMs; }
+  float getChangeDeg() const { return _changeDeg; }
+  float getRateDps() const { return _rateDps; }
+
+private:
+  // Rotation angle between two unit quaternions (degrees)
+  static float angleBetween(const float a[4], const float b[4]);
+  
+  float _renderedQuat[4];   // 最後に描画した姿勢
+  float _observedQuat[4];   // 最後に観測した姿勢
+  bool _renderedValid;      // 最後の描画が姿勢を観測した後だったか
+  bool _hasObserved;
+  bool _forced;
+  uint32_t _lastRenderMs;
+  uint32_t _lastObserveMs;
+  float _changeDeg;         // 描画した姿勢から見た最新の姿勢の回転角
+  float _rateDps;           // 回転の速さ（ローパス後）
+};
+
+#endif // REFRESH_SCHEDULER_H
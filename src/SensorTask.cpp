@@ -0,0 +1,660 @@
+/*
+ * SensorTask.cpp
+ * 
+ * Implementation for the dedicated sensor task
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "SensorTask.h"
+#include <M5Unified.h>
+#include <math.h>
+#include "fast_math.h"
+#include "Profiler.h"
+
+// Constructor
+SensorTask::SensorTask(BMI270* bmi270) {
+  memset(&_work, 0, sizeof(_work));
+  _work.quat[0] = 1.0f;
+  _requestedAlgorithm = AHRS_MAHONY;
+  _magCalRequestSeen = 0;
+  _magCalResetRequested = false;
+  _alignRequested = false;
+  _alignActive = false;
+  _bmi270 = bmi270;
+  _fifoMode = false;
+  _fifoErrors = 0;
+  _axisSign[0] = SENSOR_FIFO_AXIS_SIGN_X;
+  _axisSign[1] = SENSOR_FIFO_AXIS_SIGN_Y;
+  _axisSign[2] = SENSOR_FIFO_AXIS_SIGN_Z;
+  _filterInitialized = false;
+  _lpfAlpha = 0.1f;
+  _lastValidHeadingRaw = 0.0f;
+  _filteredHeadingRaw = 0.0f;
+  _lastTempRead = 0;
+  _motionCallback = nullptr;
+  _motionArg = nullptr;
+  _motionAccMean[0] = _motionAccMean[1] = _motionAccMean[2] = 0.0f;
+  _motionMeanValid = false;
+  _lastMotionNotifyUs = 0;
+  _batchCallback = nullptr;
+  _batchArg = nullptr;
+  _lastSampleUs = 0;
+  _jitterWindowMax = 0;
+  _jitterWindowCount = 0;
+  _taskHandle = nullptr;
+  _timer = nullptr;
+  _rateHz = SENSOR_TASK_RATE_HZ;
+  _stopRequested = false;
+  _overruns = 0;
+  _i2cBytes = 0;
+}
+
+// Check whether a rate is supported
+bool SensorTask::isValidRate(uint16_t rateHz) {
+  return rateHz == SENSOR_RATE_100HZ ||
+         rateHz == SENSOR_RATE_200HZ ||
+         rateHz == SENSOR_RATE_400HZ;
+}
+
+// Start the sensor task
+bool SensorTask::begin(uint16_t rateHz) {
+  if (_taskHandle != nullptr) {
+    return true;  // 既に起動済み
+  }
+  
+  if (!isValidRate(rateHz)) {
+    Serial.print("Unsupported sensor rate ");
+    Serial.print(rateHz);
+    Serial.println(" Hz, using default");
+    rateHz = SENSOR_TASK_RATE_HZ;
+  }
+  _rateHz = rateHz;
+  _stopRequested = false;
+  
+  // FIFOモードを試す（タスク起動前なのでI2Cバスの競合はない）
+  _fifoMode = enableFifo(_rateHz);
+  Serial.print("BMI270 FIFO mode: ");
+  Serial.println(_fifoMode ? "enabled" : "unavailable, using register reads");
+  
+  // 周期タイマーを作成（ESP_TIMER_TASKディスパッチ、コールバックはタスク通知のみ）
+  if (_timer == nullptr) {
+    esp_timer_create_args_t timerArgs = {};
+    timerArgs.callback = timerCallback;
+    timerArgs.arg = this;
+    timerArgs.dispatch_method = ESP_TIMER_TASK;
+    timerArgs.name = "sensor_tick";
+    if (esp_timer_create(&timerArgs, &_timer) != ESP_OK) {
+      _timer = nullptr;
+      Serial.println("Failed to create sensor timer!");
+      return false;
+    }
+  }
+  
+  BaseType_t result = xTaskCreatePinnedToCore(
+    taskEntry,
+    "SensorTask",
+    SENSOR_TASK_STACK_SIZE,
+    this,
+    SENSOR_TASK_PRIORITY,
+    &_taskHandle,
+    SENSOR_TASK_CORE);
+  
+  if (result != pdPASS) {
+    _taskHandle = nullptr;
+    Serial.println("Failed to create sensor task!");
+    return false;
+  }
+  
+  if (!startTimer()) {
+    end();
+    return false;
+  }
+  
+  Serial.print("Sensor task started on core ");
+  Serial.print(SENSOR_TASK_CORE);
+  Serial.print(" at ");
+  Serial.print(_rateHz);
+  Serial.println(" Hz");
+  return true;
+}
+
+// Stop the sensor task
+void SensorTask::end() {
+  stopTimer();
+  
+  if (_taskHandle == nullptr) {
+    return;
+  }
+  
+  // タスク自身に終了させる（スナップショット書き込み途中で止めないため）
+  _stopRequested = true;
+  xTaskNotifyGive(_taskHandle);
+  for (int i = 0; i < 100 && _taskHandle != nullptr; i++) {
+    delay(1);
+  }
+}
+
+// Change the sampling rate while running
+bool SensorTask::setRate(uint16_t rateHz) {
+  if (!isValidRate(rateHz)) {
+    return false;
+  }
+  if (rateHz == _rateHz) {
+    return true;
+  }
+  
+  _rateHz = rateHz;
+  if (_taskHandle == nullptr) {
+    return true;  // 次回begin()時に反映
+  }
+  
+  // FIFOモードではODRの変更をタスク側で行い、読み出し周期は変わらない
+  if (_fifoMode) {
+    return true;
+  }
+  
+  // タイマーを新しい周期で再起動（フィルタ係数はタスク側で再計算）
+  stopTimer();
+  return startTimer();
+}
+
+// Select the AHRS algorithm
+void SensorTask::setAlgorithm(AHRSAlgorithm algorithm) {
+  if ((int)algorithm < 0 || (int)algorithm >= AHRS_ALGORITHM_COUNT) {
+    return;
+  }
+  // フィルタ状態はセンサータスクだけが触るため、切り替えはタスク側で行う
+  _requestedAlgorithm = (uint8_t)algorithm;
+}
+
+// Restart magnetometer calibration learning
+void SensorTask::startMagCalibration() {
+  _magCalResetRequested = true;
+}
+
+// Use a stored magnetometer calibration
+void SensorTask::setMagCalibration(const MagCalibration& calibration) {
+  // タスク開始前はそのまま設定する（起動時に保存値を読み込む場合）
+  if (_taskHandle == nullptr) {
+    _magCal.setCalibration(calibration);
+    _magCalPublished.write(calibration);
+    return;
+  }
+  _magCalRequest.write(calibration);
+}
+
+// Copy the latest accepted magnetometer calibration
+bool SensorTask::getMagCalibration(MagCalibration& calibration) const {
+  return _magCalPublished.read(calibration);
+}
+
+// Use a stored gyro temperature model
+void SensorTask::setGyroTempModel(const GyroTempModel& model) {
+  // 推定器はセンサータスクだけが触るため、開始前のみ受け付ける
+  if (_taskHandle != nullptr) {
+    return;
+  }
+  _gyroBias.setModel(model);
+}
+
+// Copy the latest learned gyro temperature model
+bool SensorTask::getGyroTempModel(GyroTempModel& model) const {
+  return _gyroModelPublished.read(model);
+}
+
+bool SensorTask::getAlignmentEstimate(AlignmentEstimate& estimate) const {
+  return _alignPublished.getWriteCount() != 0 && _alignPublished.read(estimate);
+}
+
+// Set the motion callback
+void SensorTask::setMotionCallback(SensorMotionCallback callback, void* arg) {
+  // コールバックはセンサータスクから呼ばれるため、開始前のみ受け付ける
+  if (_taskHandle != nullptr) {
+    return;
+  }
+  _motionCallback = callback;
+  _motionArg = arg;
+}
+
+// Set the raw sample callback
+void SensorTask::setBatchCallback(SensorBatchCallback callback, void* arg) {
+  if (_taskHandle != nullptr) {
+    return;
+  }
+  _batchCallback = callback;
+  _batchArg = arg;
+}
+
+// Copy the latest orientation snapshot
+bool SensorTask::getSnapshot(OrientationData& data) const {
+  return _snapshot.read(data);
+}
+
+// Bytes moved on the internal I2C bus
+uint32_t SensorTask::getI2cBytes() const {
+  return _i2cBytes + (_bmi270 != nullptr ? _bmi270->getBusBytes() : 0);
+}
+
+// esp_timer callback
+void SensorTask::timerCallback(void* param) {
+  SensorTask* self = static_cast<SensorTask*>(param);
+  if (self->_taskHandle != nullptr) {
+    xTaskNotifyGive(self->_taskHandle);
+  }
+}
+
+// Timer rate for the current mode
+uint16_t SensorTask::getTimerRate() const {
+  return _fifoMode ? SENSOR_FIFO_BATCH_HZ : _rateHz;
+}
+
+// Start the periodic timer
+bool SensorTask::startTimer() {
+  if (_timer == nullptr) {
+    return false;
+  }
+  uint64_t periodUs = 1000000ULL / getTimerRate();
+  if (esp_timer_start_periodic(_timer, periodUs) != ESP_OK) {
+    Serial.println("Failed to start sensor timer!");
+    return false;
+  }
+  return true;
+}
+
+// Stop the periodic timer
+void SensorTask::stopTimer() {
+  if (_timer != nullptr) {
+    esp_timer_stop(_timer);  // 停止中ならエラーを返すだけ
+  }
+}
+
+// Enable the FIFO and check its axes against M5Unified
+bool SensorTask::enableFifo(uint16_t rateHz) {
+  if (_bmi270 == nullptr || _bmi270->beginFifo(rateHz) != BMI270_OK) {
+    return false;
+  }
+  
+  // チップ座標系とM5Unifiedの座標系を比較し、重力がかかっている軸の符号を確認する
+  float m5acc[3];
+  if (!M5.Imu.getAccel(&m5acc[0], &m5acc[1], &m5acc[2])) {
+    _bmi270->endFifo();
+    return false;
+  }
+  _bmi270->readAccelGyro();
+  float chip[3] = {_bmi270->acc_x, _bmi270->acc_y, _bmi270->acc_z};
+  
+  for (int axis = 0; axis < 3; axis++) {
+    if (fabsf(m5acc[axis]) < 0.3f) {
+      continue;  // 重力成分が小さい軸は判定できないためデフォルトを使用
+    }
+    // 大きさが一致しない場合は軸の入れ替えがある（符号だけでは対応できない）
+    if (fabsf(fabsf(m5acc[axis]) - fabsf(chip[axis])) > 0.2f) {
+      Serial.println("BMI270 FIFO axes do not match M5Unified, disabling FIFO");
+      _bmi270->endFifo();
+      return false;
+    }
+    _axisSign[axis] = (m5acc[axis] * chip[axis] < 0) ? -1.0f : 1.0f;
+  }
+  return true;
+}
+
+// FreeRTOS entry point
+void SensorTask::taskEntry(void* param) {
+  static_cast<SensorTask*>(param)->run();
+}
+
+// Task body
+void SensorTask::run() {
+  uint16_t activeRate = 0;
+  uint16_t timerRate = 0;
+  uint32_t timerPeriodUs = 0;
+  int64_t lastWakeUs = 0;
+  
+  _lastSampleUs = 0;
+  _ahrs.setAlgorithm((AHRSAlgorithm)_requestedAlgorithm);
+  
+  while (!_stopRequested) {
+    // タイマーからの通知を待つ（通知数が2以上なら前回の処理が間に合わなかった）
+    uint32_t pending = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(100));
+    if (_stopRequested) {
+      break;
+    }
+    if (pending == 0) {
+      continue;  // タイマー再起動中など
+    }
+    if (pending > 1) {
+      _overruns += pending - 1;
+    }
+    
+    // アルゴリズムが変わったらフィルタを初期化し直す
+    if (_ahrs.getAlgorithm() != (AHRSAlgorithm)_requestedAlgorithm) {
+      _ahrs.setAlgorithm((AHRSAlgorithm)_requestedAlgorithm);
+    }
+    
+    // 周期が変わったらフィルタ係数を再計算（時定数は一定に保つ）
+    if (activeRate != _rateHz) {
+      bool rateChanged = (activeRate != 0);
+      activeRate = _rateHz;
+      _lpfAlpha = 1.0f - expf(-1.0f / (activeRate * SENSOR_HEADING_LPF_TAU));
+      _lastSampleUs = 0;
+      
+      // FIFOモードではODRを変更（起動時はbegin()で設定済み）
+      if (_fifoMode && rateChanged) {
+        _fifoMode = enableFifo(activeRate);
+        if (!_fifoMode) {
+          stopTimer();
+          startTimer();
+        }
+      }
+    }
+    if (timerRate != getTimerRate()) {
+      timerRate = getTimerRate();
+      timerPeriodUs = 1000000UL / timerRate;
+      lastWakeUs = 0;
+    }
+    
+    // 起床周期のずれを記録
+    int64_t now = esp_timer_get_time();
+    if (lastWakeUs != 0) {
+      uint32_t jitter = (uint32_t)llabs((now - lastWakeUs) - (int64_t)timerPeriodUs);
+      if (jitter > _jitterWindowMax) {
+        _jitterWindowMax = jitter;
+      }
+    }
+    lastWakeUs = now;
+    
+    // 1秒ごとに周期ずれの最大値を公開
+    if (++_jitterWindowCount >= timerRate) {
+      _work.maxJitterUs = _jitterWindowMax;
+      _jitterWindowMax = 0;
+      _jitterWindowCount = 0;
+    }
+    
+    if (_fifoMode) {
+      if (!sampleFifo(now)) {
+        continue;  // 新しいサンプルなし
+      }
+    } else {
+      sampleDirect(now);
+    }
+    
+    _work.fifoMode = _fifoMode;
+    _snapshot.write(_work);
+  }
+  
+  _taskHandle = nullptr;
+  vTaskDelete(nullptr);
+}
+
+// Read magnetometer/temperature
+void SensorTask::readAuxSensors() {
+  OrientationData& d = _work;
+  
+  // 地磁気 (μT) - BMM150はBMI270のAUXインターフェース経由でM5Unifiedが読み出す
+  d.magOk = M5.Imu.getMag(&d.magRaw[0], &d.magRaw[1], &d.magRaw[2]);
+  _i2cBytes += SENSOR_I2C_MAG_BYTES + BMI270_I2C_READ_OVERHEAD;
+  if (d.magOk) {
+    // 較正の統計は動いたときだけ更新される（静止中はほぼapply()のみ）
+    handleMagCalRequests();
+    if (_magCal.addSample(d.magRaw)) {
+      _magCalPublished.write(_magCal.getCalibration());
+    }
+    _magCal.apply(d.magRaw, d.mag);
+    
+    const MagCalibration& cal = _magCal.getCalibration();
+    d.magField = sqrtf(d.mag[0] * d.mag[0] + d.mag[1] * d.mag[1] + d.mag[2] * d.mag[2]);
+    d.magCalProgress = _magCal.getProgress();
+    d.magCalFitCount = cal.fitCount;
+    d.magCalValid = cal.valid;
+    d.magDisturbed = _magCal.isDisturbed();
+  }
+  
+  // 温度は変化が遅いため低頻度で読み出す
+  unsigned long now = millis();
+  if (_lastTempRead == 0 || now - _lastTempRead >= SENSOR_TEMP_INTERVAL_MS) {
+    _lastTempRead = now;
+    d.temperatureOk = M5.Imu.getTemp(&d.temperature);
+    _i2cBytes += SENSOR_I2C_TEMP_BYTES + BMI270_I2C_READ_OVERHEAD;
+  }
+}
+
+// Magnetometer reading of the current batch for the batch callback
+const SensorMagReading* SensorTask::getMagReading(SensorMagReading& reading) const {
+  if (!_work.magOk) {
+    return nullptr;
+  }
+  memcpy(reading.raw, _work.magRaw, sizeof(reading.raw));
+  reading.calibration = &_magCal.getCalibration();
+  reading.calibrationVersion = _magCalPublished.getWriteCount();
+  return &reading;
+}
+
+// Apply pending calibration requests
+void SensorTask::handleMagCalRequests() {
+  if (_magCalRequest.getWriteCount() != _magCalRequestSeen) {
+    MagCalibration calibration;
+    if (_magCalRequest.read(calibration)) {
+      _magCalRequestSeen = _magCalRequest.getWriteCount();
+      _magCal.setCalibration(calibration);
+      _magCalPublished.write(calibration);
+    }
+  }
+  
+  if (_magCalResetRequested) {
+    _magCalResetRequested = false;
+    _magCal.reset();
+  }
+}
+
+// Read accel/gyro/mag registers once and update orientation
+void SensorTask::sampleDirect(int64_t timestampUs) {
+  OrientationData& d = _work;
+  
+  // M5Unifiedライブラリを使用してIMUデータを取得
+  {
+    PROFILE_SCOPE(PROFILE_IMU_READ);
+    d.accOk = M5.Imu.getAccel(&d.acc[0], &d.acc[1], &d.acc[2]);    // 加速度 (g)
+    d.gyroOk = M5.Imu.getGyro(&d.gyro[0], &d.gyro[1], &d.gyro[2]);  // 角速度 (dps)
+    _i2cBytes += SENSOR_I2C_ACCEL_BYTES + SENSOR_I2C_GYRO_BYTES + 2 * BMI270_I2C_READ_OVERHEAD;
+    readAuxSensors();
+  }
+  
+  d.batchSize = 1;
+  {
+    PROFILE_SCOPE(PROFILE_FUSION);
+    processSample(d.acc, d.gyro, timestampUs);
+  }
+  
+  if (_batchCallback != nullptr && d.accOk && d.gyroOk) {
+    BMI270Sample sample;
+    memcpy(sample.acc, d.acc, sizeof(sample.acc));
+    memcpy(sample.gyr, d.gyro, sizeof(sample.gyr));
+    sample.timestampUs = (uint64_t)timestampUs;
+    SensorMagReading mag;
+    _batchCallback(_batchArg, &sample, 1, getMagReading(mag));
+  }
+}
+
+// Drain the BMI270 FIFO and update orientation for every sample
+bool SensorTask::sampleFifo(int64_t readTimeUs) {
+  OrientationData& d = _work;
+  
+  int count;
+  {
+    PROFILE_SCOPE(PROFILE_IMU_READ);
+    count = _bmi270->readFifo(_fifoSamples, SENSOR_FIFO_MAX_SAMPLES, (uint64_t)readTimeUs);
+  }
+  if (count < 0) {
+    // 連続してエラーになった場合はレジスタ読み出しに切り替える
+    if (++_fifoErrors >= SENSOR_FIFO_MAX_ERRORS) {
+      _fifoMode = false;
+      _bmi270->endFifo();
+      stopTimer();
+      startTimer();
+    }
+    return false;
+  }
+  _fifoErrors = 0;
+  if (count == 0) {
+    return false;
+  }
+  
+  // 地磁気はバッチごとに1回だけ読み出す（BMM150のODRはFIFOより低い）
+  {
+    PROFILE_SCOPE(PROFILE_IMU_READ);
+    readAuxSensors();
+  }
+  d.accOk = true;
+  d.gyroOk = true;
+  d.batchSize = (uint8_t)count;
+  
+  // 軸の向きはその場で補正する（記録側にもM5Unifiedと同じ軸で渡す）
+  {
+    PROFILE_SCOPE(PROFILE_FUSION);
+    for (int i = 0; i < count; i++) {
+      BMI270Sample& s = _fifoSamples[i];
+      for (int axis = 0; axis < 3; axis++) {
+        s.acc[axis] *= _axisSign[axis];
+        s.gyr[axis] *= _axisSign[axis];
+        d.acc[axis] = s.acc[axis];
+        d.gyro[axis] = s.gyr[axis];
+      }
+      processSample(d.acc, d.gyro, (int64_t)s.timestampUs);
+    }
+  }
+  
+  if (_batchCallback != nullptr) {
+    SensorMagReading mag;
+    _batchCallback(_batchArg, _fifoSamples, count, getMagReading(mag));
+  }
+  return true;
+}
+
+// Update orientation from one accel/gyro sample
+void SensorTask::processSample(const float acc[3], const float gyro[3], int64_t timestampUs) {
+  OrientationData& d = _work;
+  
+  // 実測dtを計算（異常値は公称周期に置き換える）
+  float nominalDt = 1.0f / _rateHz;
+  float dt = nominalDt;
+  if (_lastSampleUs != 0) {
+    dt = (timestampUs - _lastSampleUs) * 1e-6f;
+    if (dt <= 0.0f || dt > 0.1f) {
+      dt = nominalDt;
+    }
+  }
+  _lastSampleUs = timestampUs;
+  
+  // 静止中のジャイロバイアスを推定（センサー座標系、温度は約1Hzで更新される）
+  float temperature = d.temperatureOk ? d.temperature : NAN;
+  if (d.accOk && d.gyroOk) {
+    _gyroBias.update(gyro, acc, d.magOk ? d.mag : nullptr, temperature, dt);
+    if (_gyroBias.takeModelChanged()) {
+      _gyroModelPublished.write(_gyroBias.getModel());
+    }
+  }
+  d.gyroBiasValid = _gyroBias.getBias(temperature, d.gyroBias);
+  d.stationary = _gyroBias.isStationary();
+  if (d.accOk && d.gyroOk) {
+    detectMotion(acc, gyro, dt, timestampUs);
+  }
+  
+  // AtomS3R IMU座標系を極軸合わせ用の座標系に変換
+  float acc_adj[3], gyro_adj[3], mag_adj[3], bias_adj[3];
+  AHRSEngine::fromDeviceAxes(acc, acc_adj);
+  AHRSEngine::fromDeviceAxes(gyro, gyro_adj);
+  AHRSEngine::fromDeviceAxes(d.mag, mag_adj);
+  AHRSEngine::fromDeviceAxes(d.gyroBias, bias_adj);
+  _ahrs.setGyroBias(bias_adj);
+  
+  // 姿勢をAHRSで更新（オイラー角への変換は表示側で行う）
+  if (d.accOk && d.gyroOk) {
+    _ahrs.update(acc_adj, gyro_adj, d.magOk ? mag_adj : nullptr, dt);
+    _ahrs.getQuaternion(d.quat);
+    d.attitudeError = _ahrs.getErrorEstimate();
+    d.confidence = _ahrs.getConfidence();
+    d.attitudeValid = _ahrs.isInitialized();
+    
+    // 極軸の微調整中は全サンプルの姿勢を平均する（UIは結果を読むだけ）
+    bool alignRequested = _alignRequested;
+    if (alignRequested != _alignActive) {
+      _align.reset();
+      _alignActive = alignRequested;
+    }
+    if (_alignActive && d.attitudeValid && _align.addSample(d.quat, timestampUs)) {
+      _alignPublished.write(_align.getEstimate());
+    }
+  }
+  d.algorithm = (uint8_t)_ahrs.getAlgorithm();
+  
+  // 磁力計の生値から直接方位角を計算（傾き補正なし）
+  if (d.magOk) {
+    float headingRaw = fastAtan2Deg(mag_adj[1], mag_adj[0]);
+    if (headingRaw < 0) {
+      headingRaw += 360.0f;
+    }
+    
+    // 最初の有効サンプルでフィルタを初期化
+    if (!_filterInitialized) {
+      _lastValidHeadingRaw = _filteredHeadingRaw = headingRaw;
+      _filterInitialized = true;
+    }
+    
+    // 異常値チェック
+    if (isnan(headingRaw) || headingRaw < 0 || headingRaw > 360) {
+      headingRaw = _lastValidHeadingRaw;
+      d.invalidHeadings++;
+    } else {
+      _lastValidHeadingRaw = headingRaw;
+    }
+    
+    // 固定係数のローパスフィルタ（係数はサンプリング周期から事前計算）
+    _filteredHeadingRaw += _lpfAlpha * (headingRaw - _filteredHeadingRaw);
+    d.headingRaw = _filteredHeadingRaw;
+  }
+  
+  d.timestampUs = (uint64_t)timestampUs;
+  d.dt = dt;
+  d.sampleCount++;
+}
+
+// Detect motion that should wake the display
+// BMI270のany-motion割り込みの代わりに、FIFOから読んだ各サンプルで判定する
+// （消灯中もIMUの追跡は続けるため、センサータスクは常にバッチ周期で起床している）
+void SensorTask::detectMotion(const float acc[3], const float gyro[3], float dt, int64_t timestampUs) {
+  OrientationData& d = _work;
+  
+  if (!_motionMeanValid) {
+    memcpy(_motionAccMean, acc, sizeof(_motionAccMean));
+    _motionMeanValid = true;
+    return;
+  }
+  
+  float rate2 = 0.0f;
+  float accDev2 = 0.0f;
+  for (int axis = 0; axis < 3; axis++) {
+    float rate = gyro[axis] - d.gyroBias[axis];
+    float dev = acc[axis] - _motionAccMean[axis];
+    rate2 += rate * rate;
+    accDev2 += dev * dev;
+  }
+  
+  float alpha = dt / (SENSOR_MOTION_ACC_TAU + dt);
+  for (int axis = 0; axis < 3; axis++) {
+    _motionAccMean[axis] += alpha * (acc[axis] - _motionAccMean[axis]);
+  }
+  
+  if (rate2 < SENSOR_MOTION_GYRO_DPS * SENSOR_MOTION_GYRO_DPS &&
+      accDev2 < SENSOR_MOTION_ACC_G * SENSOR_MOTION_ACC_G) {
+    return;
+  }
+  
+  d.motionCount++;
+  if (_motionCallback != nullptr &&
+      timestampUs - _lastMotionNotifyUs >= (int64_t)SENSOR_MOTION_NOTIFY_MS * 1000LL) {
+    _lastMotionNotifyUs = timestampUs;
+    _motionCallback(_motionArg);
+  }
+}
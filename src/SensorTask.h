@@ -0,0 +1,316 @@
+/*
+ * SensorTask.h
+ * 
+ * Dedicated FreeRTOS sensor task for the Polaris Navigator
+ * Samples the IMU at a fixed rate on core 0, runs the AHRS engine on
+ * every sample and publishes the latest orientation through a seqlock
+ * so the UI task (loop() on core 1) never blocks sampling while it
+ * redraws the screen.
+ * 
+ * サンプリング周期はesp_timerの周期コールバックで生成し、
+ * 各サンプルにマイクロ秒単位のタイムスタンプと実測dtを付与する。
+ * 地磁気はMagCalibratorで常時較正し、補正後の値をAHRSに渡す。
+ * ジャイロバイアスは静止中にGyroBiasEstimatorで推定し、AHRSで差し引く。
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef SENSOR_TASK_H
+#define SENSOR_TASK_H
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_timer.h>
+#include "SeqLock.h"
+#include "AHRSEngine.h"
+#include "BMI270.h"
+#include "MagCalibrator.h"
+#include "GyroBiasEstimator.h"
+#include "AlignmentAverager.h"
+
+// Task configuration
+#define SENSOR_TASK_CORE        0     // センサータスクを実行するコア（UIはコア1）
+#define SENSOR_TASK_PRIORITY    5     // loopTask(1)より高い優先度
+#define SENSOR_TASK_STACK_SIZE  8192  // スタックサイズ（バイト、磁力計フィットの正規方程式・ESKF・ログ整形を含む）
+#define SENSOR_TEMP_INTERVAL_MS 1000  // 温度の読み出し間隔（ミリ秒）
+
+// Supported sampling rates (Hz)
+#define SENSOR_RATE_100HZ       100
+#define SENSOR_RATE_200HZ       200
+#define SENSOR_RATE_400HZ       400
+#define SENSOR_TASK_RATE_HZ     SENSOR_RATE_100HZ  // デフォルト
+
+// FIFO batch mode
+// FIFOモードではBMI270がODRでサンプルを蓄積し、タスクはこの周期でまとめて読み出す
+#define SENSOR_FIFO_BATCH_HZ    25    // バッチ読み出し周期（Hz）
+#define SENSOR_FIFO_MAX_SAMPLES 40    // 1バッチで処理する最大サンプル数
+#define SENSOR_FIFO_MAX_ERRORS  10    // 連続エラーでレジスタ読み出しに切り替え
+
+// Fixed-size reads made through M5Unified (data bytes, I2C framing added separately)
+#define SENSOR_I2C_ACCEL_BYTES  6     // 加速度 X/Y/Z
+#define SENSOR_I2C_GYRO_BYTES   6     // 角速度 X/Y/Z
+#define SENSOR_I2C_MAG_BYTES    8     // BMI270のAUXデータ（BMM150 X/Y/Z/RHALL）
+#define SENSOR_I2C_TEMP_BYTES   2     // 温度
+
+// Chip frame -> M5Unified frame default signs (AtomS3R: X/Z反転)
+// 起動時にM5.Imu.getAccel()と比較して、重力が十分にかかっている軸は実測で確認する
+#define SENSOR_FIFO_AXIS_SIGN_X -1.0f
+#define SENSOR_FIFO_AXIS_SIGN_Y  1.0f
+#define SENSOR_FIFO_AXIS_SIGN_Z -1.0f
+
+// Raw heading low-pass filter time constant (seconds)
+// 100Hzで係数0.1となる値（サンプリング周期を変えても応答速度は同じ）
+#define SENSOR_HEADING_LPF_TAU  0.095f
+
+// Motion detection (wakes the display from power saving)
+// 赤道儀の追尾（約0.004dps）では反応せず、手で触れたときに反応する値
+#define SENSOR_MOTION_GYRO_DPS  3.0f    // バイアス補正後の角速度
+#define SENSOR_MOTION_ACC_G     0.05f   // ゆっくりした平均からの加速度のずれ
+#define SENSOR_MOTION_ACC_TAU   1.0f    // 加速度の平均の時定数（秒）
+#define SENSOR_MOTION_NOTIFY_MS 200     // コールバックを呼ぶ最小間隔
+
+// Called from the sensor task when motion is detected
+typedef void (*SensorMotionCallback)(void* arg);
+
+// Magnetometer reading taken with a batch (device axes)
+struct SensorMagReading {
+  float raw[3];                     // 較正前の値（uT）
+  const MagCalibration* calibration; // この値に適用した較正（コールバックの間だけ有効）
+  uint32_t calibrationVersion;      // 較正が変わるたびに増える
+};
+
+// Called from the sensor task with every batch of raw samples (device axes)
+// mag is nullptr when the magnetometer could not be read for this batch
+typedef void (*SensorBatchCallback)(void* arg, const BMI270Sample* samples, int count,
+                                    const SensorMagReading* mag);
+
+// Orientation snapshot shared between the sensor task and the UI task
+struct OrientationData {
+  // 姿勢（AHRSEngineの出力、オイラー角への変換は表示時に行う）
+  float quat[4];       // w, x, y, z（体軸座標系→水平座標系）
+  float attitudeError; // 推定姿勢誤差（度、1σ）
+  float confidence;    // 姿勢の信頼度 (0-1)
+  uint8_t algorithm;   // 使用中のAHRSAlgorithm
+  bool attitudeValid;  // AHRSが初期化済みか
+  
+  // 磁力計の生値から計算した方位角（傾き補正なし、度 0-360）
+  float headingRaw;
+  
+  // センサー値（AtomS3R IMU座標系のまま）
+  float acc[3];        // 加速度 (g)
+  float gyro[3];       // 角速度 (dps、バイアス補正前)
+  float mag[3];        // 地磁気 (uT、ハード/ソフトアイアン補正後)
+  float magRaw[3];     // 地磁気 (uT、補正前)
+  bool accOk;
+  bool gyroOk;
+  bool magOk;
+  
+  // 地磁気の較正状態
+  float magField;           // 補正後の磁場の大きさ (uT)
+  float magCalProgress;     // startMagCalibration()からの学習の進み (0-1)
+  uint32_t magCalFitCount;  // 採用した楕円体の解の数（変化したら保存する）
+  bool magCalValid;
+  bool magDisturbed;        // 補正後の大きさが較正値から外れている（磁気干渉）
+  
+  // ジャイロバイアス（センサー座標系、AHRSで差し引く値）
+  float gyroBias[3];        // (dps)
+  bool gyroBiasValid;       // 静止観測または保存済みの温度モデルがある
+  bool stationary;          // 静止中（バイアスを推定している）
+  uint32_t motionCount;     // 動きを検出したサンプル数（省電力からの復帰用）
+  
+  // IMU内部温度（摂氏）
+  float temperature;
+  bool temperatureOk;
+  
+  // タイミング情報
+  uint64_t timestampUs;     // サンプル取得時刻（esp_timer、マイクロ秒）
+  float dt;                 // 前回サンプルからの実測間隔（秒）
+  uint32_t maxJitterUs;     // 直近1秒間の起床周期ずれの最大値（マイクロ秒）
+  uint8_t batchSize;        // 直近のFIFOバッチのサンプル数（レジスタ読み出し時は1）
+  bool fifoMode;            // BMI270 FIFOから読み出しているか
+  
+  // 統計情報
+  uint32_t sampleCount;     // 取得したサンプル数
+  uint32_t invalidHeadings; // 異常値として破棄した方位角の数
+};
+
+class SensorTask {
+public:
+  // Constructor
+  // bmi270 enables FIFO batch mode when the chip accepts the FIFO configuration
+  SensorTask(BMI270* bmi270 = nullptr);
+  
+  // Start the sensor task (IMU must already be initialized)
+  bool begin(uint16_t rateHz = SENSOR_TASK_RATE_HZ);
+  
+  // Stop the sensor task
+  void end();
+  
+  // Change the sampling rate while running (100/200/400 Hz)
+  bool setRate(uint16_t rateHz);
+  
+  // Select the AHRS algorithm (applied by the sensor task on its next sample)
+  void setAlgorithm(AHRSAlgorithm algorithm);
+  AHRSAlgorithm getAlgorithm() const { return (AHRSAlgorithm)_requestedAlgorithm; }
+  
+  // Magnetometer calibration (applied by the sensor task on its next sample)
+  // startMagCalibration() discards the learned statistics; the current
+  // correction stays in use until the new fit is accepted
+  void startMagCalibration();
+  void setMagCalibration(const MagCalibration& calibration);
+  
+  // Copy the latest accepted magnetometer calibration (lock-free)
+  // Returns false until a calibration has been set or learned
+  bool getMagCalibration(MagCalibration& calibration) const;
+  
+  // Gyro bias-vs-temperature model
+  // setGyroTempModel() must be called before begin(); the learned model is
+  // republished whenever a still segment updates it
+  void setGyroTempModel(const GyroTempModel& model);
+  bool getGyroTempModel(GyroTempModel& model) const;
+  uint32_t getGyroTempModelVersion() const { return _gyroModelPublished.getWriteCount(); }
+  
+  // Motion callback (e.g. PowerManager::motionWake), set before begin()
+  // Runs on the sensor task at most every SENSOR_MOTION_NOTIFY_MS
+  void setMotionCallback(SensorMotionCallback callback, void* arg);
+  
+  // Raw sample callback (e.g. SessionRecorder::imuBatchCallback), set before begin()
+  // Runs on the sensor task, so it must not block
+  void setBatchCallback(SensorBatchCallback callback, void* arg);
+  
+  // Fine alignment averaging of the fused attitude (applied on the next sample)
+  // 無効から有効にするたびに履歴を捨てて平均をやり直す
+  void setAlignmentAveraging(bool enabled) { _alignRequested = enabled; }
+  bool isAlignmentAveraging() const { return _alignRequested; }
+  
+  // Copy the latest averaged pointing (lock-free)
+  // Returns false until the first block has been published
+  bool getAlignmentEstimate(AlignmentEstimate& estimate) const;
+  
+  // Copy the latest orientation snapshot (lock-free)
+  // Returns false until the first sample has been published
+  bool getSnapshot(OrientationData& data) const;
+  
+  // Task state
+  bool isRunning() const { return _taskHandle != nullptr; }
+  uint16_t getRate() const { return _rateHz; }
+  
+  // Number of timer ticks missed because sampling was still busy
+  uint32_t getOverruns() const { return _overruns; }
+  
+  // Running count of bytes moved on the internal I2C bus by this task
+  // (FIFO bursts plus the fixed-size accel/gyro/magnetometer/temperature reads)
+  uint32_t getI2cBytes() const;
+  
+  // Whether accel/gyro are drained from the BMI270 FIFO
+  bool isFifoMode() const { return _fifoMode; }
+  
+  // Check whether a rate is supported
+  static bool isValidRate(uint16_t rateHz);
+
+private:
+  // esp_timer callback (runs in the esp_timer task)
+  static void timerCallback(void* param);
+  
+  // FreeRTOS entry point
+  static void taskEntry(void* param);
+  
+  // Task body
+  void run();
+  
+  // Read accel/gyro/mag registers once and update orientation
+  void sampleDirect(int64_t timestampUs);
+  
+  // Drain the BMI270 FIFO and update orientation for every sample
+  bool sampleFifo(int64_t readTimeUs);
+  
+  // Read magnetometer/temperature (shared by both modes)
+  void readAuxSensors();
+  const SensorMagReading* getMagReading(SensorMagReading& reading) const;
+  
+  // Apply pending calibration requests from the UI task
+  void handleMagCalRequests();
+  
+  // Update orientation from one accel/gyro sample
+  void processSample(const float acc[3], const float gyro[3], int64_t timestampUs);
+  
+  // Detect motion that should wake the display
+  void detectMotion(const float acc[3], const float gyro[3], float dt, int64_t timestampUs);
+  
+  // Enable the FIFO and check its axes against M5Unified
+  bool enableFifo(uint16_t rateHz);
+  
+  // Start/stop the periodic timer
+  bool startTimer();
+  void stopTimer();
+  uint16_t getTimerRate() const;
+  
+  // Latest published snapshot
+  SeqLock<OrientationData> _snapshot;
+  
+  // Working copy (sensor task only)
+  OrientationData _work;
+  
+  // Attitude filter (sensor task only)
+  AHRSEngine _ahrs;
+  volatile uint8_t _requestedAlgorithm;
+  
+  // Magnetometer calibration (sensor task only, requests through seqlocks)
+  MagCalibrator _magCal;
+  SeqLock<MagCalibration> _magCalPublished;   // センサータスクが書き込む
+  SeqLock<MagCalibration> _magCalRequest;     // UIタスクが書き込む
+  uint32_t _magCalRequestSeen;
+  volatile bool _magCalResetRequested;
+  
+  // Gyro bias (sensor task only after begin())
+  GyroBiasEstimator _gyroBias;
+  SeqLock<GyroTempModel> _gyroModelPublished;
+  
+  // Fine alignment averaging (sensor task only, result through a seqlock)
+  AlignmentAverager _align;
+  SeqLock<AlignmentEstimate> _alignPublished;
+  volatile bool _alignRequested;
+  bool _alignActive;
+  
+  // FIFO batch mode (sensor task only after begin())
+  BMI270* _bmi270;
+  volatile bool _fifoMode;
+  uint8_t _fifoErrors;
+  float _axisSign[3];
+  BMI270Sample _fifoSamples[SENSOR_FIFO_MAX_SAMPLES];
+  
+  // Filter state (sensor task only)
+  bool _filterInitialized;
+  float _lpfAlpha;
+  float _lastValidHeadingRaw;
+  float _filteredHeadingRaw;
+  unsigned long _lastTempRead;
+  
+  // Motion detection (sensor task only after begin())
+  SensorMotionCallback _motionCallback;
+  void* _motionArg;
+  float _motionAccMean[3];
+  bool _motionMeanValid;
+  int64_t _lastMotionNotifyUs;
+  
+  // Raw sample callback
+  SensorBatchCallback _batchCallback;
+  void* _batchArg;
+  
+  // Timing state (sensor task only)
+  int64_t _lastSampleUs;
+  uint32_t _jitterWindowMax;
+  uint16_t _jitterWindowCount;
+  
+  // Task state
+  TaskHandle_t _taskHandle;
+  esp_timer_handle_t _timer;
+  volatile uint16_t _rateHz;
+  volatile bool _stopRequested;
+  volatile uint32_t _overruns;
+  volatile uint32_t _i2cBytes;  // M5Unified経由の読み出し（FIFOはBMI270側で数える）
+};
+
+#endif // SENSOR_TASK_H
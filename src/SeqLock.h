@@ -0,0 +1,85 @@
+/*
+ * SeqLock.h
+ * 
+ * Single-writer sequence lock for sharing small POD snapshots
+ * between FreeRTOS tasks running on different cores.
+ * 
+ * 書き込み側（センサータスク）は決してブロックされず、
+ * 読み出し側（UIタスク）は書き込み中のデータを検出して再試行する。
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef SEQ_LOCK_H
+#define SEQ_LOCK_H
+
+#include "hal.h"
+#include <atomic>
+#include <string.h>
+#include <type_traits>
+
+template <typename T>
+class SeqLock {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "SeqLock requires a trivially copyable type");
+
+public:
+  // Constructor
+  SeqLock() : _seq(0) {
+    memset(&_data, 0, sizeof(T));
+  }
+  
+  // Publish a new value (single writer only)
+  void write(const T& value) {
+    uint32_t seq = _seq.load(std::memory_order_relaxed);
+    
+    // 奇数 = 書き込み中
+    _seq.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    
+    memcpy(&_data, &value, sizeof(T));
+    
+    // 偶数に戻して書き込み完了を通知
+    std::atomic_thread_fence(std::memory_order_release);
+    _seq.store(seq + 2, std::memory_order_release);
+  }
+  
+  // Copy the latest consistent value
+  // Returns false if nothing has been published yet or the writer kept
+  // the value busy for maxRetries attempts (out is left untouched then)
+  bool read(T& out, uint8_t maxRetries = 8) const {
+    T snapshot;
+    for (uint8_t attempt = 0; attempt < maxRetries; attempt++) {
+      uint32_t before = _seq.load(std::memory_order_acquire);
+      if (before == 0) {
+        return false;  // まだ一度も書き込まれていない
+      }
+      if (before & 1) {
+        continue;      // 書き込み中
+      }
+      
+      memcpy(&snapshot, &_data, sizeof(T));
+      
+      std::atomic_thread_fence(std::memory_order_acquire);
+      uint32_t after = _seq.load(std::memory_order_relaxed);
+      if (before == after) {
+        // 整合性を確認できたコピーだけを呼び出し側に渡す
+        out = snapshot;
+        return true;
+      }
+    }
+    return false;
+  }
+  
+  // Number of completed writes
+  uint32_t getWriteCount() const {
+    return _seq.load(std::memory_order_acquire) >> 1;
+  }
+
+private:
+  std::atomic<uint32_t> _seq;
+  T _data;
+};
+
+#endif // SEQ_LOCK_H
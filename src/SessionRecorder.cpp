@@ -0,0 +1,461 @@
+/*
+ * SessionRecorder.cpp
+ * 
+ * Implementation of the binary session recorder
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "SessionRecorder.h"
+#include <LittleFS.h>
+#include <esp_timer.h>
+#include "PersistenceStore.h"
+#include "Logger.h"
+
+// 解析ツール（tools/decode_session.py）と合わせるレイアウト
+static_assert(sizeof(SessionBlockHeader) == 16, "SessionBlockHeader layout changed");
+static_assert(sizeof(SessionInfoRecord) == 32, "SessionInfoRecord layout changed");
+static_assert(sizeof(SessionGpsRecord) == 24, "SessionGpsRecord layout changed");
+static_assert(sizeof(SessionOrientationRecord) == 28, "SessionOrientationRecord layout changed");
+static_assert(sizeof(SessionAlignmentRecord) == 16, "SessionAlignmentRecord layout changed");
+
+// Worst-case encoded size of one IMU sample (dt + 6 values, 5 bytes each)
+#define SESSION_IMU_SAMPLE_MAX 35
+
+// LEB128 varint
+static size_t putVarint(uint8_t* out, uint64_t value) {
+  size_t n = 0;
+  while (value >= 0x80) {
+    out[n++] = (uint8_t)(value | 0x80);
+    value >>= 7;
+  }
+  out[n++] = (uint8_t)value;
+  return n;
+}
+
+// Signed values as zigzag (small magnitudes stay short)
+static uint32_t zigzag(int32_t value) {
+  return ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+}
+
+static uint64_t zigzag64(int64_t value) {
+  return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+// Quantize with rounding and saturation to int16
+static int32_t quantize(float value, float scale) {
+  float q = value * scale;
+  q += (q >= 0.0f) ? 0.5f : -0.5f;
+  if (q > 32767.0f) return 32767;
+  if (q < -32768.0f) return -32768;
+  return (int32_t)q;
+}
+
+// Constructor
+SessionRecorder::SessionRecorder() {
+  _ring = nullptr;
+  _head = 0;
+  _tail = 0;
+  _fill = sizeof(SessionBlockHeader);
+  _sequence = 0;
+  _blocksInFile = 0;
+  _recording = false;
+  _stopRequested = false;
+  _rawImuEnabled = true;
+  memset(&_info, 0, sizeof(_info));
+  _startTimerUs = 0;
+  _taskHandle = nullptr;
+  _mounted = false;
+  _fileOpen = false;
+  _fileIndex = 0;
+  _maxFiles = SESSION_MIN_FILES;
+  _blocksWritten = 0;
+  _droppedRecords = 0;
+  _writeErrors = 0;
+  _blockRecords = 0;
+  _magCalVersion = 0;
+  _magCalPending = true;
+}
+
+bool SessionRecorder::begin() {
+  if (_taskHandle != nullptr) {
+    return true;
+  }
+  
+  // spiffsパーティションをLittleFSとして使う（初回はフォーマットする）
+  _mounted = LittleFS.begin(true, "/littlefs", 4, SESSION_PARTITION_LABEL);
+  if (!_mounted) {
+    LOG_E(LOG_TAG_MAIN, "Session recorder: LittleFS mount failed");
+    return false;
+  }
+  if (!LittleFS.exists(SESSION_DIR)) {
+    LittleFS.mkdir(SESSION_DIR);
+  }
+  
+  // 容量の3/4までをセッションに使い、残りは他の用途のために空けておく
+  uint32_t fileBytes = (uint32_t)SESSION_BLOCK_SIZE * SESSION_BLOCKS_PER_FILE;
+  _maxFiles = (uint32_t)(LittleFS.totalBytes() * 3 / 4) / fileBytes;
+  if (_maxFiles < SESSION_MIN_FILES) {
+    _maxFiles = SESSION_MIN_FILES;
+  }
+  _fileIndex = findLastFileIndex();
+  
+  _ring = (uint8_t*)calloc(SESSION_RING_BLOCKS, SESSION_BLOCK_SIZE);
+  if (_ring == nullptr) {
+    LOG_E(LOG_TAG_MAIN, "Session recorder: no memory for the ring buffer");
+    return false;
+  }
+  
+  BaseType_t result = xTaskCreatePinnedToCore(taskEntry, "recorder", SESSION_TASK_STACK_SIZE,
+                                              this, SESSION_TASK_PRIORITY, &_taskHandle,
+                                              SESSION_TASK_CORE);
+  if (result != pdPASS) {
+    _taskHandle = nullptr;
+    free(_ring);
+    _ring = nullptr;
+    LOG_E(LOG_TAG_MAIN, "Session recorder: writer task could not be created");
+    return false;
+  }
+  
+  LOG_I(LOG_TAG_MAIN, "Session recorder ready: %u KB used of %u KB, keeping %u files",
+        (unsigned)(LittleFS.usedBytes() / 1024), (unsigned)(LittleFS.totalBytes() / 1024),
+        (unsigned)_maxFiles);
+  return true;
+}
+
+bool SessionRecorder::start(uint16_t imuRateHz, int64_t startUtcUs) {
+  if (_ring == nullptr || _recording) {
+    return _recording;
+  }
+  
+  portENTER_CRITICAL(&_lock);
+  _startTimerUs = esp_timer_get_time();
+  _info.sessionId = _fileIndex + 1;
+  _info.part = 0;
+  _info.imuRateHz = imuRateHz;
+  _info.startTimerUs = _startTimerUs;
+  _info.startUtcUs = startUtcUs;
+  _info.accLsbPerG = SESSION_ACC_LSB_PER_G;
+  _info.gyroLsbPerDps = SESSION_GYRO_LSB_PER_DPS;
+  _sequence = 0;
+  _blocksInFile = 0;
+  _fill = sizeof(SessionBlockHeader);
+  _blockRecords = 0;
+  blockAt(_head)[2] = SESSION_BLOCK_FILE_START;   // SessionBlockHeader::flags
+  appendInfoLocked();
+  _magCalPending = true;
+  _stopRequested = false;
+  _recording = true;
+  portEXIT_CRITICAL(&_lock);
+  
+  LOG_I(LOG_TAG_MAIN, "Session %u recording started", (unsigned)_info.sessionId);
+  return true;
+}
+
+void SessionRecorder::stop() {
+  if (!_recording) {
+    return;
+  }
+  
+  // 書きかけのブロックを閉じて、書き込みタスクにファイルを閉じさせる
+  portENTER_CRITICAL(&_lock);
+  _recording = false;
+  if (_fill > sizeof(SessionBlockHeader)) {
+    if ((_head + 1) % SESSION_RING_BLOCKS != _tail) {
+      sealLocked();
+    } else {
+      // リングが満杯で閉じられないブロックの記録は失われる
+      _droppedRecords += _blockRecords;
+      _blockRecords = 0;
+    }
+  }
+  _stopRequested = true;
+  portEXIT_CRITICAL(&_lock);
+  
+  // UIタスクは待たない（ファイルを閉じる前にstart()が来ても、新しいセッションの
+  // 最初のブロックで書き込みタスクがファイルを切り替える）
+  xTaskNotifyGive(_taskHandle);
+  
+  LOG_I(LOG_TAG_MAIN, "Session %u stopping: %u blocks written, %u records dropped, %u write errors",
+        (unsigned)_info.sessionId, (unsigned)_blocksWritten, (unsigned)_droppedRecords,
+        (unsigned)_writeErrors);
+}
+
+uint32_t SessionRecorder::getSessionMs() const {
+  return (uint32_t)((esp_timer_get_time() - _startTimerUs) / 1000);
+}
+
+bool SessionRecorder::recordImuBatch(const BMI270Sample* samples, int count,
+                                     const SensorMagReading* mag) {
+  if (!_recording || !_rawImuEnabled || count <= 0) {
+    return false;
+  }
+  
+  // 地磁気の読み出しより前に、その値に適用した較正を記録する
+  if (mag != nullptr && (_magCalPending || mag->calibrationVersion != _magCalVersion)) {
+    SessionMagCalRecord record;
+    memset(&record, 0, sizeof(record));
+    record.timeMs = getSessionMs();
+    memcpy(record.offset, mag->calibration->offset, sizeof(record.offset));
+    memcpy(record.softIron, mag->calibration->softIron, sizeof(record.softIron));
+    record.valid = mag->calibration->valid ? 1 : 0;
+    if (append(SESSION_REC_MAG_CAL, (const uint8_t*)&record, sizeof(record))) {
+      _magCalVersion = mag->calibrationVersion;
+      _magCalPending = false;
+    }
+  }
+  
+  // バッファに収まらない大きなバッチは分割する（地磁気は各部分に付ける）
+  bool ok = true;
+  while (count > 0) {
+    size_t n = 0;
+    // start()直後の最初のバッチはセッション開始より前のサンプルを含むので符号付き
+    n += putVarint(_imuBuffer + n, zigzag64((int64_t)samples[0].timestampUs - _startTimerUs));
+    size_t countPos = n++;
+    _imuBuffer[n++] = mag != nullptr ? SESSION_IMU_FLAG_MAG : 0;
+    if (mag != nullptr) {
+      for (int axis = 0; axis < 3; axis++) {
+        n += putVarint(_imuBuffer + n, zigzag(quantize(mag->raw[axis], SESSION_MAG_LSB_PER_UT)));
+      }
+    }
+    
+    int32_t previous[6] = {0, 0, 0, 0, 0, 0};
+    uint64_t previousUs = samples[0].timestampUs;
+    int used = 0;
+    while (used < count && n + SESSION_IMU_SAMPLE_MAX <= sizeof(_imuBuffer) && used < 255) {
+      const BMI270Sample& s = samples[used];
+      n += putVarint(_imuBuffer + n, s.timestampUs - previousUs);
+      previousUs = s.timestampUs;
+      for (int axis = 0; axis < 3; axis++) {
+        int32_t acc = quantize(s.acc[axis], SESSION_ACC_LSB_PER_G);
+        int32_t gyr = quantize(s.gyr[axis], SESSION_GYRO_LSB_PER_DPS);
+        n += putVarint(_imuBuffer + n, zigzag(acc - previous[axis]));
+        n += putVarint(_imuBuffer + n, zigzag(gyr - previous[axis + 3]));
+        previous[axis] = acc;
+        previous[axis + 3] = gyr;
+      }
+      used++;
+    }
+    _imuBuffer[countPos] = (uint8_t)used;
+    
+    ok = append(SESSION_REC_IMU_BATCH, _imuBuffer, n) && ok;
+    samples += used;
+    count -= used;
+  }
+  return ok;
+}
+
+bool SessionRecorder::recordGps(const SessionGpsRecord& record) {
+  return append(SESSION_REC_GPS, (const uint8_t*)&record, sizeof(record));
+}
+
+bool SessionRecorder::recordOrientation(const SessionOrientationRecord& record) {
+  return append(SESSION_REC_ORIENTATION, (const uint8_t*)&record, sizeof(record));
+}
+
+bool SessionRecorder::recordAlignment(const SessionAlignmentRecord& record) {
+  return append(SESSION_REC_ALIGNMENT, (const uint8_t*)&record, sizeof(record));
+}
+
+void SessionRecorder::imuBatchCallback(void* arg, const BMI270Sample* samples, int count,
+                                       const SensorMagReading* mag) {
+  static_cast<SessionRecorder*>(arg)->recordImuBatch(samples, count, mag);
+}
+
+bool SessionRecorder::append(uint8_t type, const uint8_t* payload, size_t length) {
+  if (!_recording) {
+    return false;
+  }
+  
+  uint8_t prefix[4];
+  size_t prefixLength = 1;
+  prefix[0] = type;
+  prefixLength += putVarint(prefix + 1, length);
+  size_t total = prefixLength + length;
+  
+  bool notify = false;
+  bool stored = false;
+  portENTER_CRITICAL(&_lock);
+  if (_recording) {
+    if (_fill + total > SESSION_BLOCK_SIZE) {
+      if ((_head + 1) % SESSION_RING_BLOCKS != _tail) {
+        sealLocked();
+        notify = true;
+      }
+    }
+    if (_fill + total <= SESSION_BLOCK_SIZE) {
+      uint8_t* block = blockAt(_head);
+      memcpy(block + _fill, prefix, prefixLength);
+      memcpy(block + _fill + prefixLength, payload, length);
+      _fill += total;
+      _blockRecords++;
+      stored = true;
+    } else {
+      // 書き込みが追いつかずリングが満杯
+      _droppedRecords++;
+    }
+  }
+  portEXIT_CRITICAL(&_lock);
+  
+  if (notify && _taskHandle != nullptr) {
+    xTaskNotifyGive(_taskHandle);
+  }
+  return stored;
+}
+
+// Close the current block and move to the next one (lock held, ring not full)
+void SessionRecorder::sealLocked() {
+  SessionBlockHeader* header = (SessionBlockHeader*)blockAt(_head);
+  header->magic = SESSION_BLOCK_MAGIC;
+  header->version = SESSION_FORMAT_VERSION;
+  header->used = _fill;
+  header->sequence = _sequence++;
+  
+  _head = (_head + 1) % SESSION_RING_BLOCKS;
+  _fill = sizeof(SessionBlockHeader);
+  _blockRecords = 0;
+  
+  // ファイルの区切りでは次のブロックをセッション情報から始める
+  if (++_blocksInFile >= SESSION_BLOCKS_PER_FILE) {
+    _blocksInFile = 0;
+    _info.part++;
+    blockAt(_head)[2] = SESSION_BLOCK_FILE_START;
+    appendInfoLocked();
+    _magCalPending = true;
+  }
+}
+
+// Put the session info record at the start of the current block (lock held)
+void SessionRecorder::appendInfoLocked() {
+  uint8_t* block = blockAt(_head);
+  block[_fill++] = SESSION_REC_INFO;
+  _fill += putVarint(block + _fill, sizeof(_info));
+  memcpy(block + _fill, &_info, sizeof(_info));
+  _fill += sizeof(_info);
+}
+
+void SessionRecorder::taskEntry(void* param) {
+  static_cast<SessionRecorder*>(param)->run();
+}
+
+void SessionRecorder::run() {
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000));
+    
+    // 停止要求とその時点の末尾をまとめて取り出す。start()は要求を取り消すので、
+    // 要求が残っていれば末尾までのブロックはすべて停止したセッションのもの
+    portENTER_CRITICAL(&_lock);
+    bool stop = _stopRequested;
+    _stopRequested = false;
+    uint16_t end = _head;
+    portEXIT_CRITICAL(&_lock);
+    
+    drain(end);
+    if (stop && _fileOpen) {
+      _file.close();
+      _fileOpen = false;
+    }
+    drain(_head);
+  }
+}
+
+void SessionRecorder::drain(uint16_t end) {
+  while (_tail != end) {
+    uint8_t* block = blockAt(_tail);
+    SessionBlockHeader* header = (SessionBlockHeader*)block;
+    
+    // CRCは書き込みタスクで計算する（記録側のクリティカルセクションを短くする）
+    header->crc = PersistenceStore::crc32(block + sizeof(SessionBlockHeader),
+                                          header->used - sizeof(SessionBlockHeader));
+    
+    if ((header->flags & SESSION_BLOCK_FILE_START) || !_fileOpen) {
+      if (_fileOpen) {
+        _file.close();
+        _fileOpen = false;
+      }
+      openFile(_fileIndex + 1);
+    }
+    
+    if (_fileOpen) {
+      if (_file.write(block, SESSION_BLOCK_SIZE) == SESSION_BLOCK_SIZE) {
+        _blocksWritten++;
+      } else {
+        _writeErrors++;
+        LOG_W_EVERY(LOG_TAG_MAIN, 10000, "Session recorder: write failed (file %u)",
+                    (unsigned)_fileIndex);
+      }
+      // メタデータも更新して、電源断でも書いたブロックまでは読めるようにする
+      _file.flush();
+    }
+    
+    // 空いたブロックはゼロで埋めておく（末尾のパディングになる）
+    memset(block, 0, SESSION_BLOCK_SIZE);
+    _tail = (_tail + 1) % SESSION_RING_BLOCKS;
+  }
+}
+
+bool SessionRecorder::openFile(uint32_t index) {
+  _fileIndex = index;
+  enforceRetention();
+  
+  char path[32];
+  snprintf(path, sizeof(path), SESSION_DIR "/%06u.pnr", (unsigned)index);
+  _file = LittleFS.open(path, FILE_WRITE);
+  _fileOpen = (bool)_file;
+  if (!_fileOpen) {
+    _writeErrors++;
+    LOG_E(LOG_TAG_MAIN, "Session recorder: cannot create %s", path);
+    return false;
+  }
+  LOG_I(LOG_TAG_MAIN, "Session recorder: writing %s", path);
+  return true;
+}
+
+// Delete the oldest files so that the new one fits in the budget
+void SessionRecorder::enforceRetention() {
+  while (true) {
+    uint32_t count = 0;
+    uint32_t oldest = UINT32_MAX;
+    File dir = LittleFS.open(SESSION_DIR);
+    if (!dir) {
+      return;
+    }
+    for (File entry = dir.openNextFile(); entry; entry = dir.openNextFile()) {
+      uint32_t index = (uint32_t)strtoul(entry.name(), nullptr, 10);
+      if (index == 0) {
+        continue;
+      }
+      count++;
+      if (index < oldest) {
+        oldest = index;
+      }
+    }
+    dir.close();
+    
+    // 作成するファイルの分を空ける
+    if (count < _maxFiles || oldest == UINT32_MAX) {
+      return;
+    }
+    char path[32];
+    snprintf(path, sizeof(path), SESSION_DIR "/%06u.pnr", (unsigned)oldest);
+    LittleFS.remove(path);
+    LOG_I(LOG_TAG_MAIN, "Session recorder: removed %s", path);
+  }
+}
+
+uint32_t SessionRecorder::findLastFileIndex() {
+  uint32_t last = 0;
+  File dir = LittleFS.open(SESSION_DIR);
+  if (!dir) {
+    return 0;
+  }
+  for (File entry = dir.openNextFile(); entry; entry = dir.openNextFile()) {
+    uint32_t index = (uint32_t)strtoul(entry.name(), nullptr, 10);
+    if (index > last) {
+      last = index;
+    }
+  }
+  dir.close();
+  return last;
+}
@@ -0,0 +1,243 @@
+/*
+ * SessionRecorder.h
+ * 
+ * Binary session recorder for the Polaris Navigator
+ * Records raw IMU batches, GPS fixes, the fused orientation and the polar
+ * alignment error to LittleFS (spiffs partition) for analysis after a night out
+ * 
+ * 記録は4KBのブロック単位で、RAM上のリングに溜めてから低優先度の
+ * 書き込みタスクがファイルに追記する。レコードはブロックをまたがないため、
+ * 電源断などで壊れたブロックがあっても次のブロックから読み直せる。
+ * 各ファイルはSESSION_BLOCKS_PER_FILEブロックで、先頭はセッション情報の
+ * レコードから始まる（古いファイルから削除してローテーションする）。
+ * 解析は tools/decode_session.py で行う。
+ * 
+ * File layout: blocks of SESSION_BLOCK_SIZE bytes
+ *   SessionBlockHeader, then records, zero padding up to the block size
+ * Record: type (uint8_t), payload length (varint), payload
+ *   SESSION_REC_INFO         SessionInfoRecord (first record of every file)
+ *   SESSION_REC_IMU_BATCH    zigzag varint time (us since session start, may be
+ *                            negative for the first batch), uint8_t count,
+ *                            uint8_t flags (bit0: magnetometer reading follows),
+ *                            [3 zigzag varints of the raw magnetometer reading
+ *                            (1/SESSION_MAG_LSB_PER_UT uT), taken with the batch
+ *                            and used for all of its samples],
+ *                            per sample: varint dt (us), 6 zigzag varint deltas of
+ *                            acc (1/SESSION_ACC_LSB_PER_G g) and gyro
+ *                            (1/SESSION_GYRO_LSB_PER_DPS dps) from the previous sample
+ *   SESSION_REC_GPS          SessionGpsRecord
+ *   SESSION_REC_ORIENTATION  SessionOrientationRecord
+ *   SESSION_REC_ALIGNMENT    SessionAlignmentRecord
+ *   SESSION_REC_MAG_CAL      SessionMagCalRecord (the calibration in force for the
+ *                            magnetometer readings that follow)
+ * Multi-byte fields are little-endian. Varints are LEB128 (7 bits per byte).
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef SESSION_RECORDER_H
+#define SESSION_RECORDER_H
+
+#include <Arduino.h>
+#include <FS.h>
+#include "SensorTask.h"
+
+// Storage
+#define SESSION_DIR              "/sessions"
+#define SESSION_PARTITION_LABEL  "spiffs"   // partitions.csvのデータ領域
+#define SESSION_BLOCK_SIZE       4096       // LittleFSのブロックサイズに合わせる
+#define SESSION_BLOCKS_PER_FILE  64         // 1ファイル256KB
+#define SESSION_RING_BLOCKS      6          // RAM上のリング（24KB）
+#define SESSION_MIN_FILES        2          // 容量が少なくても残すファイル数
+
+// Writer task
+#define SESSION_TASK_CORE        1          // UIと同じコア（センサータスクを遅らせない）
+#define SESSION_TASK_PRIORITY    1          // loopTaskと同じ
+#define SESSION_TASK_STACK_SIZE  4096
+
+// Format
+#define SESSION_FORMAT_VERSION   3
+#define SESSION_BLOCK_MAGIC      0x4250     // "PB"
+#define SESSION_BLOCK_FILE_START 0x01       // ファイルの先頭ブロック
+#define SESSION_ACC_LSB_PER_G    4096.0f    // BMI270 ±8gの分解能
+#define SESSION_GYRO_LSB_PER_DPS 16.0f      // 0.0625 dps
+#define SESSION_MAG_LSB_PER_UT   16.0f      // BMM150の分解能（約0.3uT）より細かい
+#define SESSION_MAX_RECORD_SIZE  512        // 1レコードの上限（IMUバッチは分割される）
+
+// Record types
+enum SessionRecordType {
+  SESSION_REC_PADDING     = 0,
+  SESSION_REC_INFO        = 1,
+  SESSION_REC_IMU_BATCH   = 2,
+  SESSION_REC_GPS         = 3,
+  SESSION_REC_ORIENTATION = 4,
+  SESSION_REC_ALIGNMENT   = 5,
+  SESSION_REC_MAG_CAL     = 6
+};
+
+// IMU batch flags
+#define SESSION_IMU_FLAG_MAG     0x01
+
+// Block header (start of every block)
+struct SessionBlockHeader {
+  uint16_t magic;
+  uint8_t flags;           // SESSION_BLOCK_FILE_START
+  uint8_t version;         // SESSION_FORMAT_VERSION
+  uint16_t used;           // ヘッダーを含む使用バイト数
+  uint16_t reserved;
+  uint32_t sequence;       // セッション内の通し番号（欠けたブロックの検出用）
+  uint32_t crc;            // ヘッダーの後ろからusedまでのCRC-32
+};
+
+// First record of every file
+struct SessionInfoRecord {
+  uint32_t sessionId;      // セッション最初のファイル番号
+  uint16_t part;           // セッション内のファイル番号（0から）
+  uint16_t imuRateHz;
+  int64_t startTimerUs;    // セッション開始時のesp_timer
+  int64_t startUtcUs;      // セッション開始時のUTC（未同期なら0）
+  float accLsbPerG;
+  float gyroLsbPerDps;
+};
+
+// GPS fix
+struct SessionGpsRecord {
+  uint32_t timeMs;         // セッション開始からの時間
+  int32_t latitudeE7;      // 度 × 1e7
+  int32_t longitudeE7;
+  int32_t altitudeCm;
+  uint16_t hdopCenti;
+  uint8_t satellites;
+  uint8_t flags;           // bit0: 測位中（0 = 保存された位置）, bit1: 時刻同期済み
+  uint32_t utcSeconds;     // Unix時刻（未同期なら0）
+};
+
+// Fused orientation
+struct SessionOrientationRecord {
+  uint32_t timeMs;
+  int16_t quat[4];         // w, x, y, z × 16384
+  uint16_t headingRawCenti; // 磁力計の方位角 × 100
+  uint16_t errorCenti;     // 推定姿勢誤差（度 × 100）
+  int16_t gyroBias[3];     // ジャイロバイアス（mdps）
+  int16_t temperatureCenti;
+  uint8_t confidence;      // 0-255
+  uint8_t flags;           // bit0 attitudeValid, bit1 magCalValid, bit2 magDisturbed, bit3 stationary
+  uint16_t magFieldCenti;  // 補正後の磁場の大きさ（uT × 100）
+};
+
+// Polar alignment error (device pointing minus the pole)
+struct SessionAlignmentRecord {
+  uint32_t timeMs;
+  int16_t azimuthErrorCenti;   // 方位の誤差（度 × 100、-180〜180）
+  int16_t altitudeErrorCenti;  // 高度の誤差（度 × 100）
+  uint16_t poleAzimuthCenti;   // 目標位置
+  int16_t poleAltitudeCenti;
+  uint8_t displayMode;
+  uint8_t powerState;
+  uint16_t reserved;
+};
+
+// Magnetometer calibration (written before the first reading that uses it,
+// and again at the start of every file)
+struct SessionMagCalRecord {
+  uint32_t timeMs;
+  float offset[3];         // ハードアイアン（uT）
+  float softIron[3][3];    // ソフトアイアン補正行列
+  uint8_t valid;           // 0 = 未較正（生値をそのまま使う）
+  uint8_t reserved[3];
+};
+
+class SessionRecorder {
+public:
+  // Constructor
+  SessionRecorder();
+  
+  // Mount the filesystem and start the writer task
+  bool begin();
+  
+  // Start a new session (new file) / stop and flush the partial block
+  // stop() does not wait: the writer task closes the file after the last block
+  bool start(uint16_t imuRateHz, int64_t startUtcUs);
+  void stop();
+  bool isRecording() const { return _recording; }
+  
+  // Record from any task (returns false when the record was dropped)
+  bool recordImuBatch(const BMI270Sample* samples, int count,
+                      const SensorMagReading* mag = nullptr);
+  bool recordGps(const SessionGpsRecord& record);
+  bool recordOrientation(const SessionOrientationRecord& record);
+  bool recordAlignment(const SessionAlignmentRecord& record);
+  
+  // Raw IMU batches use most of the space; the sketch keeps them for the
+  // active display only (GPS, orientation and alignment are always recorded)
+  void setRawImuEnabled(bool enabled) { _rawImuEnabled = enabled; }
+  
+  // Callback for SensorTask::setBatchCallback()
+  static void imuBatchCallback(void* arg, const BMI270Sample* samples, int count,
+                               const SensorMagReading* mag);
+  
+  // Milliseconds since the session started (for record timestamps)
+  uint32_t getSessionMs() const;
+  
+  // Statistics
+  uint32_t getBlocksWritten() const { return _blocksWritten; }
+  uint32_t getDroppedRecords() const { return _droppedRecords; }
+  uint32_t getWriteErrors() const { return _writeErrors; }
+  uint32_t getFileIndex() const { return _fileIndex; }
+  bool isMounted() const { return _mounted; }
+
+private:
+  // Writer task
+  static void taskEntry(void* param);
+  void run();
+  
+  // Write sealed blocks up to (not including) end to flash (writer task)
+  void drain(uint16_t end);
+  bool openFile(uint32_t index);
+  void enforceRetention();
+  uint32_t findLastFileIndex();
+  
+  // Append an encoded record to the current block (any task)
+  bool append(uint8_t type, const uint8_t* payload, size_t length);
+  void sealLocked();
+  void appendInfoLocked();
+  uint8_t* blockAt(uint16_t index) { return _ring + (size_t)index * SESSION_BLOCK_SIZE; }
+  
+  // Ring of blocks: [_tail, _head) are sealed, _head is being filled
+  uint8_t* _ring;
+  volatile uint16_t _head;
+  volatile uint16_t _tail;
+  uint16_t _fill;
+  uint16_t _blockRecords;  // _headに書いた記録の数（閉じられずに失われた分の集計用）
+  uint32_t _sequence;
+  uint16_t _blocksInFile;
+  portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+  
+  // Session state
+  volatile bool _recording;
+  volatile bool _stopRequested;
+  volatile bool _rawImuEnabled;
+  SessionInfoRecord _info;
+  int64_t _startTimerUs;
+  
+  // IMU encoding buffer (sensor task only)
+  uint8_t _imuBuffer[SESSION_MAX_RECORD_SIZE];
+  uint32_t _magCalVersion;      // 最後に記録した較正（センサータスクのみ）
+  volatile bool _magCalPending; // 新しいファイルの先頭で較正を記録し直す
+  
+  // File state (writer task only)
+  TaskHandle_t _taskHandle;
+  bool _mounted;
+  fs::File _file;
+  bool _fileOpen;
+  uint32_t _fileIndex;
+  uint32_t _maxFiles;
+  
+  // Statistics
+  volatile uint32_t _blocksWritten;
+  volatile uint32_t _droppedRecords;
+  volatile uint32_t _writeErrors;
+};
+
+#endif // SESSION_RECORDER_H
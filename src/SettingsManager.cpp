@@ -8,20 +8,34 @@
  */
 
 #include "SettingsManager.h"
+#include "Logger.h"
+
+// 保存レコードの大きさの上限
+static_assert(sizeof(UserSettings) <= PERSIST_MAX_RECORD_SIZE, "UserSettings does not fit in a record");
 
 // Constructor
-SettingsManager::SettingsManager() {
+SettingsManager::SettingsManager(PersistenceStore* store, PowerManager* power) {
+  _store = store;
+  _power = power;
+  
   // Initialize with default settings
+  memset(&_settings, 0, sizeof(_settings));
   resetSettings();
 }
 
 // Initialize settings manager
 void SettingsManager::begin() {
-  // Initialize preferences for storing settings
-  _preferences.begin("polaris-set", false);
-  
-  // Try to load settings
-  loadSettings();
+  // Try to load settings (the store has already read them at boot)
+  if (!loadSettings() && loadLegacySettings()) {
+    // 旧形式（キーごとの保存）から移行し、古い名前空間を消す
+    _store->requestSave(PERSIST_SETTINGS);
+    _store->flush();
+    Preferences legacy;
+    legacy.begin("polaris-set", false);
+    legacy.clear();
+    legacy.end();
+    Serial.println("Migrated settings to the persistence store");
+  }
   
   // Apply settings
   applySettings();
@@ -29,83 +43,88 @@ void SettingsManager::begin() {
 
 // Load settings from storage
 bool SettingsManager::loadSettings() {
-  // Check if settings exist
-  if (!_preferences.isKey("settings_valid")) {
+  if (!_store->attach(PERSIST_SETTINGS, &_settings, sizeof(_settings), SETTINGS_RECORD_VERSION)) {
     Serial.println("No settings found, using defaults");
     return false;
   }
   
+  validateSettings();
+  Serial.println("Settings loaded");
+  return true;
+}
+
+// Replace out-of-range values with defaults
+void SettingsManager::validateSettings() {
+  if (_settings.imuSampleRate != 100 && _settings.imuSampleRate != 200 &&
+      _settings.imuSampleRate != 400) {
+    _settings.imuSampleRate = 100;
+  }
+  if ((int)_settings.ahrsAlgorithm < 0 || (int)_settings.ahrsAlgorithm >= AHRS_ALGORITHM_COUNT) {
+    _settings.ahrsAlgorithm = AHRS_MAHONY;
+  }
+}
+
+// Load settings saved by older firmware (one key per field)
+bool SettingsManager::loadLegacySettings() {
+  Preferences preferences;
+  if (!preferences.begin("polaris-set", true)) {
+    return false;
+  }
+  
+  // Check if settings exist
+  if (!preferences.isKey("settings_valid")) {
+    preferences.end();
+    return false;
+  }
+  
   // Load settings validity
-  bool valid = _preferences.getBool("settings_valid", false);
+  bool valid = preferences.getBool("settings_valid", false);
   if (!valid) {
-    Serial.println("Invalid settings, using defaults");
+    preferences.end();
     return false;
   }
   
   // Load display settings
-  _settings.brightness = (BrightnessLevel)_preferences.getUChar("brightness", BRIGHTNESS_MEDIUM);
-  _settings.nightMode = _preferences.getBool("night_mode", false);
+  _settings.brightness = (BrightnessLevel)preferences.getUChar("brightness", BRIGHTNESS_MEDIUM);
+  _settings.nightMode = preferences.getBool("night_mode", false);
   
   // Load location settings
-  _settings.locationSource = (LocationSource)_preferences.getUChar("loc_source", LOCATION_GPS);
-  _settings.manualLatitude = _preferences.getFloat("manual_lat", 0.0);
-  _settings.manualLongitude = _preferences.getFloat("manual_lon", 0.0);
-  _settings.manualAltitude = _preferences.getFloat("manual_alt", 0.0);
+  _settings.locationSource = (LocationSource)preferences.getUChar("loc_source", LOCATION_GPS);
+  _settings.manualLatitude = preferences.getFloat("manual_lat", 0.0);
+  _settings.manualLongitude = preferences.getFloat("manual_lon", 0.0);
+  _settings.manualAltitude = preferences.getFloat("manual_alt", 0.0);
   
   // Load time settings
-  _settings.timeSource = (TimeSource)_preferences.getUChar("time_source", TIME_GPS);
-  _settings.timeZoneOffset = _preferences.getInt("timezone", 0);
-  _settings.useDST = _preferences.getBool("use_dst", false);
+  _settings.timeSource = (TimeSource)preferences.getUChar("time_source", TIME_GPS);
+  _settings.timeZoneOffset = preferences.getInt("timezone", 0);
+  _settings.useDST = preferences.getBool("use_dst", false);
   
   // Load compass settings
-  _settings.useNorthReference = _preferences.getBool("use_true_north", true);
-  _settings.manualDeclination = _preferences.getFloat("declination", 0.0);
+  _settings.useNorthReference = preferences.getBool("use_true_north", true);
+  _settings.manualDeclination = preferences.getFloat("declination", 0.0);
+  
+  // Load sensor settings
+  _settings.imuSampleRate = preferences.getUShort("imu_rate", 100);
+  _settings.ahrsAlgorithm = (AHRSAlgorithm)preferences.getUChar("ahrs_algo", (uint8_t)AHRS_MAHONY);
   
   // Load power settings
-  _settings.sleepTimeout = _preferences.getInt("sleep_timeout", 300);
-  _settings.enableBluetooth = _preferences.getBool("enable_bt", false);
+  _settings.sleepTimeout = preferences.getInt("sleep_timeout", 300);
+  _settings.enableBluetooth = preferences.getBool("enable_bt", false);
   
   // Load debug settings
-  _settings.enableDebugOutput = _preferences.getBool("debug_output", false);
-  _settings.enableDataLogging = _preferences.getBool("data_logging", false);
+  _settings.enableDebugOutput = preferences.getBool("debug_output", false);
+  _settings.enableDataLogging = preferences.getBool("data_logging", false);
   
-  Serial.println("Settings loaded");
+  preferences.end();
+  validateSettings();
+  Serial.println("Legacy settings loaded");
   return true;
 }
 
 // Save settings to storage
+// 書き込みはPersistenceStoreが遅延してまとめて行う（メニュー操作の連続変更で何度も書かない）
 bool SettingsManager::saveSettings() {
-  // Save settings validity
-  _preferences.putBool("settings_valid", true);
-  
-  // Save display settings
-  _preferences.putUChar("brightness", (uint8_t)_settings.brightness);
-  _preferences.putBool("night_mode", _settings.nightMode);
-  
-  // Save location settings
-  _preferences.putUChar("loc_source", (uint8_t)_settings.locationSource);
-  _preferences.putFloat("manual_lat", _settings.manualLatitude);
-  _preferences.putFloat("manual_lon", _settings.manualLongitude);
-  _preferences.putFloat("manual_alt", _settings.manualAltitude);
-  
-  // Save time settings
-  _preferences.putUChar("time_source", (uint8_t)_settings.timeSource);
-  _preferences.putInt("timezone", _settings.timeZoneOffset);
-  _preferences.putBool("use_dst", _settings.useDST);
-  
-  // Save compass settings
-  _preferences.putBool("use_true_north", _settings.useNorthReference);
-  _preferences.putFloat("declination", _settings.manualDeclination);
-  
-  // Save power settings
-  _preferences.putInt("sleep_timeout", _settings.sleepTimeout);
-  _preferences.putBool("enable_bt", _settings.enableBluetooth);
-  
-  // Save debug settings
-  _preferences.putBool("debug_output", _settings.enableDebugOutput);
-  _preferences.putBool("data_logging", _settings.enableDataLogging);
-  
-  Serial.println("Settings saved");
+  _store->requestSave(PERSIST_SETTINGS);
   return true;
 }
 
@@ -130,6 +149,10 @@ void SettingsManager::resetSettings() {
   _settings.useNorthReference = true;
   _settings.manualDeclination = 0.0;
   
+  // Sensor settings
+  _settings.imuSampleRate = 100;
+  _settings.ahrsAlgorithm = AHRS_MAHONY;
+  
   // Power settings
   _settings.sleepTimeout = 300; // 5 minutes
   _settings.enableBluetooth = false;
@@ -198,6 +221,14 @@ float SettingsManager::getManualDeclination() {
   return _settings.manualDeclination;
 }
 
+float SettingsManager::resolveDeclination(float modelDeclination) {
+  // 手動の偏角は0.1度単位で設定されるため、0付近は未設定とみなす
+  if (fabs(_settings.manualDeclination) < 0.05f) {
+    return modelDeclination;
+  }
+  return _settings.manualDeclination;
+}
+
 int SettingsManager::getSleepTimeout() {
   return _settings.sleepTimeout;
 }
@@ -214,6 +245,14 @@ bool SettingsManager::getEnableDataLogging() {
   return _settings.enableDataLogging;
 }
 
+uint16_t SettingsManager::getImuSampleRate() {
+  return _settings.imuSampleRate;
+}
+
+AHRSAlgorithm SettingsManager::getAhrsAlgorithm() {
+  return _settings.ahrsAlgorithm;
+}
+
 // Individual setting setters
 void SettingsManager::setBrightness(BrightnessLevel brightness) {
   _settings.brightness = brightness;
@@ -278,6 +317,7 @@ void SettingsManager::setEnableBluetooth(bool enable) {
 
 void SettingsManager::setEnableDebugOutput(bool enable) {
   _settings.enableDebugOutput = enable;
+  Logger::setDebugEnabled(enable);
   saveSettings();
 }
 
@@ -286,12 +326,31 @@ void SettingsManager::setEnableDataLogging(bool enable) {
   saveSettings();
 }
 
+void SettingsManager::setImuSampleRate(uint16_t rateHz) {
+  // Only 100/200/400 Hz are supported by the sensor task
+  if (rateHz != 100 && rateHz != 200 && rateHz != 400) {
+    return;
+  }
+  _settings.imuSampleRate = rateHz;
+  saveSettings();
+}
+
+void SettingsManager::setAhrsAlgorithm(AHRSAlgorithm algorithm) {
+  if ((int)algorithm < 0 || (int)algorithm >= AHRS_ALGORITHM_COUNT) {
+    return;
+  }
+  _settings.ahrsAlgorithm = algorithm;
+  saveSettings();
+}
+
 // Apply settings
 void SettingsManager::applySettings() {
   applyDisplaySettings();
   applyPowerSettings();
   
   // Apply debug settings
+  // DEBUG/VERBOSEログの出力可否はこの設定で切り替える
+  Logger::setDebugEnabled(_settings.enableDebugOutput);
   if (_settings.enableDebugOutput) {
     Serial.println("Debug output enabled");
   }
@@ -322,8 +381,12 @@ void SettingsManager::applyDisplaySettings() {
   }
   
   // Set LED brightness
-  // M5Unifiedでは、ディスプレイの明るさを設定する方法が異なります
-  M5.Lcd.setBrightness(brightnessValue);
+  // 減光・消灯中は復帰時に反映されるよう、電源管理を通して設定する
+  if (_power != nullptr) {
+    _power->setBrightness(brightnessValue);
+  } else {
+    M5.Lcd.setBrightness(brightnessValue);
+  }
   
   // Apply night mode if enabled
   if (_settings.nightMode) {
@@ -334,16 +397,9 @@ void SettingsManager::applyDisplaySettings() {
 }
 
 void SettingsManager::applyPowerSettings() {
-  // Apply sleep timeout
-  if (_settings.sleepTimeout > 0) {
-    // Enable sleep mode with timeout
-    // Note: This is a placeholder, actual implementation depends on the hardware
-    Serial.print("Sleep timeout set to ");
-    Serial.print(_settings.sleepTimeout);
-    Serial.println(" seconds");
-  } else {
-    // Disable sleep mode
-    Serial.println("Sleep mode disabled");
+  // Apply sleep timeout (減光・消灯までの時間、0 = 無効)
+  if (_power != nullptr) {
+    _power->setSleepTimeout(_settings.sleepTimeout);
   }
   
   // Apply Bluetooth setting
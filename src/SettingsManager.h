@@ -13,6 +13,9 @@
 
 #include <M5Unified.h>
 #include <Preferences.h>
+#include "PersistenceStore.h"
+#include "PowerManager.h"
+#include "AHRSEngine.h"
 
 // Display brightness levels
 enum BrightnessLevel {
@@ -34,6 +37,10 @@ enum TimeSource {
   TIME_NTP
 };
 
+// Layout version of UserSettings in the persistence store
+// （フィールドを追加・変更したら上げる）
+#define SETTINGS_RECORD_VERSION 1
+
 // Settings structure
 struct UserSettings {
   // Display settings
@@ -53,7 +60,11 @@ struct UserSettings {
   
   // Compass settings
   bool useNorthReference; // true = true north, false = magnetic north
-  float manualDeclination; // manual magnetic declination in degrees
+  float manualDeclination; // manual magnetic declination in degrees (0 = World Magnetic Model)
+  
+  // Sensor settings
+  uint16_t imuSampleRate; // IMU sampling rate in Hz (100/200/400)
+  AHRSAlgorithm ahrsAlgorithm; // Attitude filter (Mahony/Madgwick/ESKF)
   
   // Power settings
   int sleepTimeout; // in seconds, 0 = never sleep
@@ -67,7 +78,8 @@ struct UserSettings {
 class SettingsManager {
 public:
   // Constructor
-  SettingsManager();
+  // power applies the brightness and sleep timeout (nullptr = brightness only)
+  SettingsManager(PersistenceStore* store, PowerManager* power = nullptr);
   
   // Initialize settings manager
   void begin();
@@ -99,6 +111,11 @@ public:
   bool getUseDST();
   bool getUseNorthReference();
   float getManualDeclination();
+  
+  // Declination to apply: the manual value, or modelDeclination when it is 0
+  float resolveDeclination(float modelDeclination);
+  uint16_t getImuSampleRate();
+  AHRSAlgorithm getAhrsAlgorithm();
   int getSleepTimeout();
   bool getEnableBluetooth();
   bool getEnableDebugOutput();
@@ -114,6 +131,8 @@ public:
   void setUseDST(bool useDST);
   void setUseNorthReference(bool useNorthReference);
   void setManualDeclination(float declination);
+  void setImuSampleRate(uint16_t rateHz);
+  void setAhrsAlgorithm(AHRSAlgorithm algorithm);
   void setSleepTimeout(int timeout);
   void setEnableBluetooth(bool enable);
   void setEnableDebugOutput(bool enable);
@@ -121,15 +140,20 @@ public:
   
   // Apply settings
   void applySettings();
-  
+
 private:
   // Settings data
   UserSettings _settings;
   
-  // Storage for settings
-  Preferences _preferences;
+  // Storage for settings (one blob in the persistence store)
+  PersistenceStore* _store;
+  
+  // Display dimming and sleep
+  PowerManager* _power;
   
   // Helper methods
+  bool loadLegacySettings();
+  void validateSettings();
   void applyDisplaySettings();
   void applyPowerSettings();
 };
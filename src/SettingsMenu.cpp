@@ -981,7 +981,11 @@ void SettingsMenu::formatBoolean(char* buffer, bool value) {
 }
 
 void SettingsMenu::formatDeclination(char* buffer, float declination) {
-  // Format declination as degrees with direction
+  // Format declination as degrees with direction (0 = World Magnetic Model)
+  if (fabs(declination) < 0.05f) {
+    strcpy(buffer, "Auto (WMM)");
+    return;
+  }
   sprintf(buffer, "%.1f°%s", fabs(declination), (declination >= 0 ? "E" : "W"));
 }
 
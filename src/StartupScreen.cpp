@@ -8,7 +8,9 @@
  */
 
 #include "StartupScreen.h"
-#include "icon.h" // ロゴ表示用のアイコンデータをインクルード
+#include <esp_heap_caps.h>
+#include "ImageDecoder.h"
+#include "logo_data.h" // 圧縮したロゴ画像（tools/gen_logo.pyで生成）
 
 // Color definitions
 #define COLOR_RED    0xFF0000
@@ -76,9 +78,9 @@ void StartupScreen::drawLogo() {
   int screenWidth = M5.Display.width();
   int screenHeight = M5.Display.height();
   
-  // ロゴのサイズ（icon.hから取得）
-  int logoWidth = width;
-  int logoHeight = height;
+  // ロゴのサイズ（logo_data.hから取得）
+  int logoWidth = LOGO_WIDTH;
+  int logoHeight = LOGO_HEIGHT;
   
   // ロゴの表示位置を計算（画面中央に配置）
   int x = (screenWidth - logoWidth) / 2;
@@ -91,24 +93,39 @@ void StartupScreen::drawLogo() {
   // 負の値にならないように調整
   if (y < 0) y = 0;
   
-  // アイコンデータの解析と描画
-  char *data = header_data;
-  uint8_t pixel[3]; // RGB値を格納する配列
-  
-  // メモリ使用量を抑えるため、1行ずつ描画
-  for (int row = 0; row < logoHeight; row++) {
-    for (int col = 0; col < logoWidth; col++) {
-      // ピクセルデータを取得
-      HEADER_PIXEL(data, pixel);
-      
-      // RGB565形式に変換
-      uint16_t color = ((pixel[0] & 0xF8) << 8) | ((pixel[1] & 0xFC) << 3) | (pixel[2] >> 3);
-      
-      // ピクセルを描画（透過処理：黒色は描画しない）
-      if (!(pixel[0] == 0 && pixel[1] == 0 && pixel[2] == 0)) {
-        M5.Display.drawPixel(x + col, y + row, color);
-      }
-    }
+  // LOGO_BLOCK_ROWS行ずつ展開し、2つのバッファを交互に使って
+  // 片方をDMAで転送している間にもう片方を展開する
+  size_t blockPixels = (size_t)logoWidth * LOGO_BLOCK_ROWS;
+  uint16_t* buffers[2];
+  buffers[0] = (uint16_t*)heap_caps_malloc(blockPixels * 2 * sizeof(uint16_t), MALLOC_CAP_DMA);
+  if (buffers[0] == nullptr) {
+    Serial.println("Logo: no DMA buffer");
+    return;
+  }
+  buffers[1] = buffers[0] + blockPixels;
+  
+  ImageDecoder decoder;
+  decoder.begin(LOGO_DATA, sizeof(LOGO_DATA), (uint32_t)logoWidth * logoHeight);
+  
+  // 背景は黒で消去済みなので、黒の画素もそのまま転送してよい
+  M5.Display.startWrite();
+  int current = 0;
+  for (int row = 0; row < logoHeight; row += LOGO_BLOCK_ROWS) {
+    int rows = min(LOGO_BLOCK_ROWS, logoHeight - row);
+    
+    // このバッファを使った2ブロック前の転送は、直前のブロックを送り始めた
+    // 時点で終わっている（pushImageDMAは前の転送の完了を待ってから始める）
+    decoder.decode(buffers[current], (size_t)logoWidth * rows);
+    M5.Display.pushImageDMA(x, y + row, logoWidth, rows, (const lgfx::swap565_t*)buffers[current]);
+    current ^= 1;
+  }
+  M5.Display.waitDMA();
+  M5.Display.endWrite();
+  
+  heap_caps_free(buffers[0]);
+  
+  if (decoder.isTruncated()) {
+    Serial.println("Logo: image data truncated");
   }
 }
 
@@ -162,8 +179,7 @@ void StartupScreen::showInitComplete() {
   // 描画エリアを消去（下部18ピクセルのみ）
   M5.Display.fillRect(0, M5.Display.height() - 18, M5.Display.width(), 18, TFT_BLACK);
   
-  // 輝度を明示的に再設定して一貫性を保つ
-  M5.Display.setBrightness(40);  // 40%に設定（setupHardwareと同じ値）
+  // 輝度はここでは変えない（設定の値をPowerManagerが適用済み）
   
   // 完了メッセージを中央に表示
   M5.Display.setTextColor(TFT_WHITE);
@@ -180,8 +196,7 @@ void StartupScreen::showInitComplete() {
   // Set LED to green to indicate success (輝度を抑えた緑色に設定)
   setLedColor(0x007F00);  // 暗めの緑色を使用
   
-  // Short delay to show completion
-  delay(1000);
+  // 待ち時間は設けない（最初のフレームが描画されるまで表示される）
 }
 
 // Show initialization error
@@ -13,6 +13,9 @@
 
 #include <M5Unified.h>
 
+// Logo streaming (DMAで転送する1ブロックの行数、2ブロック分を確保する)
+#define LOGO_BLOCK_ROWS 8
+
 class StartupScreen {
 public:
   // Constructor
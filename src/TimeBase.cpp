@@ -0,0 +1,326 @@
+/*
+ * TimeBase.cpp
+ * 
+ * Implementation of the GPS-disciplined time base
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "TimeBase.h"
+#include <sys/time.h>
+#include "Logger.h"
+
+// Constructor
+TimeBase::TimeBase() {
+  memset(&_work, 0, sizeof(_work));
+  _work.source = TIMEBASE_SOURCE_NONE;
+  _lastEpochUtcUs = 0;
+  _lastSyncTimerUs = 0;
+  _lastClockSetUs = 0;
+  _anchorUtcUs = 0;
+  _anchorTimerUs = 0;
+  _anchorSource = TIMEBASE_SOURCE_NONE;
+  _driftValid = false;
+  _ppsPin = -1;
+  _lastPpsUs = 0;
+  _ppsCount = 0;
+  _nmeaLatencyUs = 0;
+  _externalSeen = 0;
+}
+
+bool TimeBase::beginPps(int pin) {
+  if (pin < 0) {
+    LOG_I(LOG_TAG_TIME, "PPS not connected, using NMEA timing");
+    return false;
+  }
+  
+  _ppsPin = pin;
+  pinMode(pin, INPUT);
+  attachInterruptArg(digitalPinToInterrupt(pin), ppsIsr, this, RISING);
+  LOG_I(LOG_TAG_TIME, "PPS input on GPIO %d", pin);
+  return true;
+}
+
+// PPS interrupt handler (records the edge only)
+void IRAM_ATTR TimeBase::ppsIsr(void *arg) {
+  TimeBase *self = (TimeBase*)arg;
+  int64_t now = esp_timer_get_time();
+  
+  portENTER_CRITICAL_ISR(&self->_ppsLock);
+  self->_lastPpsUs = now;
+  self->_ppsCount++;
+  portEXIT_CRITICAL_ISR(&self->_ppsLock);
+}
+
+int64_t TimeBase::getLastPpsUs() const {
+  // 64ビット値は分割して書かれるため割り込みと排他する
+  portENTER_CRITICAL(&_ppsLock);
+  int64_t value = _lastPpsUs;
+  portEXIT_CRITICAL(&_ppsLock);
+  return value;
+}
+
+bool TimeBase::discipline(int year, int month, int day, int hour, int minute, int second,
+                          int centisecond, int64_t sentenceStartUs) {
+  // 受信機のRTCが未設定の場合などの明らかに異常な日時は使わない
+  if (year < 2024 || year > 2099 || month < 1 || month > 12 || day < 1 || day > 31) {
+    return false;
+  }
+  
+  int64_t utcUs = toUnixSeconds(year, month, day, hour, minute, second) * 1000000LL +
+                  (int64_t)centisecond * 10000LL;
+  
+  // 同じエポックを2回渡された場合は最初の観測だけを使う
+  if (utcUs == _lastEpochUtcUs) {
+    return false;
+  }
+  _lastEpochUtcUs = utcUs;
+  
+  // Observation time: the PPS edge that started this second, or the first '$'
+  int64_t timerUs = sentenceStartUs - TIMEBASE_NMEA_LATENCY_US;
+  TimeBaseSource source = TIMEBASE_SOURCE_NMEA;
+  if (_ppsPin >= 0 && centisecond == 0) {
+    int64_t ppsUs = getLastPpsUs();
+    int64_t lead = sentenceStartUs - ppsUs;
+    if (ppsUs != 0 && lead >= 0 && lead < 1000000LL) {
+      timerUs = ppsUs;
+      source = TIMEBASE_SOURCE_PPS;
+      _nmeaLatencyUs = (int32_t)lead;
+    }
+  }
+  
+  if (_work.source != TIMEBASE_SOURCE_NONE) {
+    // PPSは毎秒、NMEAのみの場合は再同期間隔ごとに基準を更新する
+    // （より精度の高いソースが使えるようになった場合や、受信機の時刻が
+    // 飛んだ場合（コールドスタート後のうるう秒の反映など）は即時）
+    bool upgrade = source > _work.source;
+    bool due = source == TIMEBASE_SOURCE_PPS ||
+               timerUs - _lastSyncTimerUs >= (int64_t)TIMEBASE_RESYNC_INTERVAL_MS * 1000LL;
+    if (!upgrade && !due && !isStep(predictionError(utcUs, timerUs))) {
+      return false;
+    }
+  }
+  
+  bool stepped = updateDrift(utcUs, timerUs, source);
+  publish(utcUs, timerUs, source, stepped);
+  return true;
+}
+
+void TimeBase::submit(int64_t utcUs, int64_t timerUs, TimeBaseSource source) {
+  ExternalTimeSample sample;
+  sample.utcUs = utcUs;
+  sample.timerUs = timerUs;
+  sample.source = (uint8_t)source;
+  _external.write(sample);
+}
+
+void TimeBase::service() {
+  if (_external.getWriteCount() == _externalSeen) {
+    return;
+  }
+  ExternalTimeSample sample;
+  if (!_external.read(sample)) {
+    return;
+  }
+  _externalSeen = _external.getWriteCount();
+  
+  // GPSの時刻が得られている間は、精度の低い観測で基準を動かさない
+  TimeBaseSource source = (TimeBaseSource)sample.source;
+  if (source < _work.source) {
+    LOG_D(LOG_TAG_TIME, "Ignored %s time, already synchronized from %s",
+          getSourceName(source), getSourceName((TimeBaseSource)_work.source));
+    return;
+  }
+  
+  bool stepped = updateDrift(sample.utcUs, sample.timerUs, source);
+  publish(sample.utcUs, sample.timerUs, source, stepped);
+}
+
+int64_t TimeBase::predictionError(int64_t utcUs, int64_t timerUs) const {
+  int64_t elapsed = timerUs - _work.timerUs;
+  int64_t predicted = _work.utcUs + elapsed + (int64_t)((float)elapsed * _work.driftPpm * 1e-6f);
+  return utcUs - predicted;
+}
+
+bool TimeBase::updateDrift(int64_t utcUs, int64_t timerUs, TimeBaseSource source) {
+  bool stepped = false;
+  if (_work.source != TIMEBASE_SOURCE_NONE) {
+    // 予測との差が大きい場合は時刻の飛びとしてドリフトの起点を取り直す
+    int64_t error = predictionError(utcUs, timerUs);
+    if (isStep(error)) {
+      LOG_W(LOG_TAG_TIME, "Time step of %lld ms, re-anchoring", (long long)(error / 1000));
+      _anchorSource = TIMEBASE_SOURCE_NONE;
+      stepped = true;
+    }
+  }
+  
+  // 起点と同じソースの観測どうしでのみ比較する（NMEAの遅延はPPSと異なるため）
+  if (_anchorSource != source) {
+    _anchorUtcUs = utcUs;
+    _anchorTimerUs = timerUs;
+    _anchorSource = source;
+    return stepped;
+  }
+  
+  int64_t span = timerUs - _anchorTimerUs;
+  if (span < TIMEBASE_MIN_DRIFT_SPAN_US) {
+    return stepped;
+  }
+  
+  float ppm = (float)((utcUs - _anchorUtcUs) - span) * 1e6f / (float)span;
+  if (ppm > TIMEBASE_MAX_DRIFT_PPM || ppm < -TIMEBASE_MAX_DRIFT_PPM) {
+    LOG_W(LOG_TAG_TIME, "Rejected drift estimate %.1f ppm", ppm);
+  } else if (!_driftValid) {
+    _work.driftPpm = ppm;
+    _driftValid = true;
+  } else {
+    _work.driftPpm += TIMEBASE_DRIFT_GAIN * (ppm - _work.driftPpm);
+  }
+  
+  _anchorUtcUs = utcUs;
+  _anchorTimerUs = timerUs;
+  return stepped;
+}
+
+void TimeBase::publish(int64_t utcUs, int64_t timerUs, TimeBaseSource source, bool stepped) {
+  bool first = _work.source == TIMEBASE_SOURCE_NONE;
+  bool sourceChanged = _work.source != source;
+  
+  _work.utcUs = utcUs;
+  _work.timerUs = timerUs;
+  _work.source = source;
+  _work.syncCount++;
+  _reference.write(_work);
+  _lastSyncTimerUs = timerUs;
+  
+  // システム時刻（ESP32のRTC）も合わせる。PPSでは毎秒更新されるため再同期間隔ごとに行う
+  int64_t now = esp_timer_get_time();
+  if (first || sourceChanged || stepped ||
+      now - _lastClockSetUs >= (int64_t)TIMEBASE_RESYNC_INTERVAL_MS * 1000LL) {
+    int64_t nowUtcUs = utcUs + (now - timerUs);
+    struct timeval tv;
+    tv.tv_sec = (time_t)(nowUtcUs / 1000000LL);
+    tv.tv_usec = (suseconds_t)(nowUtcUs % 1000000LL);
+    settimeofday(&tv, nullptr);
+    _lastClockSetUs = now;
+  }
+  
+  if (first || sourceChanged) {
+    LOG_I(LOG_TAG_TIME, "Time synchronized from %s", getSourceName(source));
+  } else if (source != TIMEBASE_SOURCE_PPS) {
+    LOG_D(LOG_TAG_TIME, "Time re-synchronized, drift %.2f ppm", _work.driftPpm);
+  }
+}
+
+bool TimeBase::isValid() const {
+  TimeReference ref;
+  return _reference.read(ref) && ref.source != TIMEBASE_SOURCE_NONE;
+}
+
+int64_t TimeBase::nowUtcUs() const {
+  TimeReference ref;
+  if (!_reference.read(ref) || ref.source == TIMEBASE_SOURCE_NONE) {
+    return 0;
+  }
+  
+  // 基準からの経過時間にドリフト補正を加える
+  int64_t elapsed = esp_timer_get_time() - ref.timerUs;
+  return ref.utcUs + elapsed + (int64_t)((float)elapsed * ref.driftPpm * 1e-6f);
+}
+
+double TimeBase::getJulianDate() const {
+  int64_t utcUs = nowUtcUs();
+  if (utcUs == 0) {
+    return 0.0;
+  }
+  
+  // Unixエポック（1970-01-01 00:00 UTC）のユリウス日は2440587.5
+  return 2440587.5 + (double)utcUs / 86400000000.0;
+}
+
+bool TimeBase::getUtc(int *year, int *month, int *day, int *hour, int *minute, int *second,
+                      int *millisecond) const {
+  int64_t utcUs = nowUtcUs();
+  if (utcUs == 0) {
+    return false;
+  }
+  
+  fromUnixSeconds(utcUs / 1000000LL, year, month, day, hour, minute, second);
+  if (millisecond) {
+    *millisecond = (int)((utcUs % 1000000LL) / 1000);
+  }
+  return true;
+}
+
+TimeBaseSource TimeBase::getSource() const {
+  TimeReference ref;
+  if (!_reference.read(ref)) {
+    return TIMEBASE_SOURCE_NONE;
+  }
+  return (TimeBaseSource)ref.source;
+}
+
+float TimeBase::getDriftPpm() const {
+  TimeReference ref;
+  return _reference.read(ref) ? ref.driftPpm : 0.0f;
+}
+
+uint32_t TimeBase::getSyncCount() const {
+  TimeReference ref;
+  return _reference.read(ref) ? ref.syncCount : 0;
+}
+
+uint32_t TimeBase::getSyncAgeMs() const {
+  TimeReference ref;
+  if (!_reference.read(ref) || ref.source == TIMEBASE_SOURCE_NONE) {
+    return UINT32_MAX;
+  }
+  return (uint32_t)((esp_timer_get_time() - ref.timerUs) / 1000);
+}
+
+const char* TimeBase::getSourceName(TimeBaseSource source) {
+  switch (source) {
+    case TIMEBASE_SOURCE_NTP:  return "NTP";
+    case TIMEBASE_SOURCE_NMEA: return "NMEA";
+    case TIMEBASE_SOURCE_PPS:  return "PPS";
+    default:                   return "none";
+  }
+}
+
+// Days since 1970-01-01 from a civil date (H. Hinnant's algorithm)
+int64_t TimeBase::toUnixSeconds(int year, int month, int day, int hour, int minute, int second) {
+  int y = year - (month <= 2 ? 1 : 0);
+  int era = (y >= 0 ? y : y - 399) / 400;
+  int yoe = y - era * 400;
+  int doy = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+  int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+  int64_t days = (int64_t)era * 146097 + doe - 719468;
+  
+  return days * 86400LL + hour * 3600 + minute * 60 + second;
+}
+
+void TimeBase::fromUnixSeconds(int64_t seconds, int *year, int *month, int *day,
+                               int *hour, int *minute, int *second) {
+  int64_t days = seconds / 86400;
+  int32_t secondsOfDay = (int32_t)(seconds - days * 86400);
+  if (secondsOfDay < 0) {
+    secondsOfDay += 86400;
+    days--;
+  }
+  
+  int64_t z = days + 719468;
+  int era = (int)((z >= 0 ? z : z - 146096) / 146097);
+  int doe = (int)(z - (int64_t)era * 146097);
+  int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+  int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+  int mp = (5 * doy + 2) / 153;
+  int m = mp < 10 ? mp + 3 : mp - 9;
+  
+  *year = yoe + era * 400 + (m <= 2 ? 1 : 0);
+  *month = m;
+  *day = doy - (153 * mp + 2) / 5 + 1;
+  *hour = secondsOfDay / 3600;
+  *minute = (secondsOfDay / 60) % 60;
+  *second = secondsOfDay % 60;
+}
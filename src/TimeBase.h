@@ -0,0 +1,159 @@
+/*
+ * TimeBase.h
+ * 
+ * GPS-disciplined UTC time base for the Polaris Navigator
+ * Maps the monotonic esp_timer clock to UTC so every consumer can read
+ * sub-second time without touching the GPS parser
+ * 
+ * GPSタスクがエポック最初のNMEA文（'$'の受信時刻）またはPPSのエッジで
+ * 基準を更新し、UIタスクはSeqLock経由で基準を読み出して補間する。
+ * NTPなどGPS以外の観測はsubmit()で預け、GPSタスクがservice()で
+ * 取り込む（基準を書き込むのは常にGPSタスクだけ）。GPSの時刻が
+ * 得られた後は、精度の低いソースの観測は使わない。
+ * 同期のたびにシステム時刻（ESP32のRTC）もsettimeofday()で合わせる。
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef TIME_BASE_H
+#define TIME_BASE_H
+
+#include "hal.h"
+#include "SeqLock.h"
+
+// PPS input (AtomicBase GPSのPPSは未配線のため既定では無効)
+#define TIMEBASE_PPS_PIN            -1
+
+// NMEA only: delay from the start of the second to the first '$' of the epoch
+// PPSを配線した場合はgetNmeaLatencyUs()の実測値で調整できる
+#define TIMEBASE_NMEA_LATENCY_US    0
+
+// NMEA only: re-sync interval after the first sync (drift estimation)
+#define TIMEBASE_RESYNC_INTERVAL_MS 600000
+
+// Drift estimation
+#define TIMEBASE_MIN_DRIFT_SPAN_US  10000000LL  // これより短い間隔ではドリフトを推定しない
+#define TIMEBASE_MAX_DRIFT_PPM      200.0f      // これを超える推定値は異常として捨てる
+#define TIMEBASE_DRIFT_GAIN         0.25f       // ドリフト推定のローパス係数
+
+// 予測との差がこれを超えたら時刻の飛び（受信機のリセットなど）として基準を取り直す
+#define TIMEBASE_STEP_THRESHOLD_US  500000LL
+
+// Time sources (in order of accuracy)
+enum TimeBaseSource {
+  TIMEBASE_SOURCE_NONE,
+  TIMEBASE_SOURCE_NTP,
+  TIMEBASE_SOURCE_NMEA,
+  TIMEBASE_SOURCE_PPS
+};
+
+// Mapping between esp_timer and UTC (published through a seqlock)
+struct TimeReference {
+  int64_t utcUs;        // 基準時点のUTC（Unixエポックからのマイクロ秒）
+  int64_t timerUs;      // 基準時点のesp_timer_get_time()
+  float driftPpm;       // esp_timerの進み（正 = 遅れているので補正で進める）
+  uint8_t source;       // TimeBaseSource
+  uint32_t syncCount;   // 基準を更新した回数
+};
+
+// Observation from a source other than the GPS (handed to the GPS task)
+struct ExternalTimeSample {
+  int64_t utcUs;        // 観測したUTC
+  int64_t timerUs;      // そのときのesp_timer_get_time()
+  uint8_t source;       // TimeBaseSource
+};
+
+class TimeBase {
+public:
+  // Constructor
+  TimeBase();
+  
+  // Attach the PPS interrupt (pin < 0 disables PPS)
+  bool beginPps(int pin = TIMEBASE_PPS_PIN);
+  
+  // Discipline from a GPS date and time whose epoch started with the '$'
+  // received at sentenceStartUs (esp_timer)
+  // Called by the GPS task only (single writer). Returns true when the
+  // reference was updated.
+  bool discipline(int year, int month, int day, int hour, int minute, int second,
+                  int centisecond, int64_t sentenceStartUs);
+  
+  // Hand over an observation from another source such as NTP
+  // Called by one task only (the Wi-Fi assist task); applied by service()
+  void submit(int64_t utcUs, int64_t timerUs, TimeBaseSource source);
+  
+  // Apply a submitted observation (GPS task only, like discipline())
+  void service();
+  
+  // True once the first time has been received
+  bool isValid() const;
+  
+  // Current UTC in microseconds since the Unix epoch (0 if not valid)
+  int64_t nowUtcUs() const;
+  
+  // Current Julian date (0 if not valid)
+  double getJulianDate() const;
+  
+  // Current UTC broken down (returns false if not valid)
+  bool getUtc(int *year, int *month, int *day, int *hour, int *minute, int *second,
+              int *millisecond = nullptr) const;
+  
+  // Status
+  TimeBaseSource getSource() const;
+  float getDriftPpm() const;
+  uint32_t getSyncCount() const;
+  uint32_t getSyncAgeMs() const;   // 最後に基準を更新してからの経過時間
+  uint32_t getPpsCount() const { return _ppsCount; }
+  int32_t getNmeaLatencyUs() const { return _nmeaLatencyUs; }
+  
+  // Display name of a source
+  static const char* getSourceName(TimeBaseSource source);
+  
+  // Calendar helpers (proleptic Gregorian, UTC)
+  static int64_t toUnixSeconds(int year, int month, int day, int hour, int minute, int second);
+  static void fromUnixSeconds(int64_t seconds, int *year, int *month, int *day,
+                              int *hour, int *minute, int *second);
+
+private:
+  // PPS interrupt handler
+  static void IRAM_ATTR ppsIsr(void *arg);
+  
+  // Copy the PPS timestamp consistently
+  int64_t getLastPpsUs() const;
+  
+  // Observed minus predicted UTC for an observation (reference must be set)
+  int64_t predictionError(int64_t utcUs, int64_t timerUs) const;
+  static bool isStep(int64_t errorUs) {
+    return errorUs > TIMEBASE_STEP_THRESHOLD_US || errorUs < -TIMEBASE_STEP_THRESHOLD_US;
+  }
+  
+  // Update the drift estimate from a new observation (returns true on a time step)
+  bool updateDrift(int64_t utcUs, int64_t timerUs, TimeBaseSource source);
+  
+  // Publish a new reference and set the system clock (at once after a step)
+  void publish(int64_t utcUs, int64_t timerUs, TimeBaseSource source, bool stepped);
+  
+  SeqLock<TimeReference> _reference;
+  SeqLock<ExternalTimeSample> _external;  // submit()からservice()へ
+  uint32_t _externalSeen;      // 取り込んだ_externalの書き込み回数
+  TimeReference _work;         // 書き込み側（GPSタスク）のコピー
+  int64_t _lastEpochUtcUs;     // 最後に処理したエポック（同じ秒の2文目は使わない）
+  int64_t _lastSyncTimerUs;    // 最後に基準を更新したesp_timer時刻
+  int64_t _lastClockSetUs;     // 最後にsettimeofday()したesp_timer時刻
+  
+  // Drift anchor (PPSでは毎秒基準を更新するため、ドリフトは別の起点から測る)
+  int64_t _anchorUtcUs;
+  int64_t _anchorTimerUs;
+  uint8_t _anchorSource;
+  bool _driftValid;
+  
+  // PPS state (written by the interrupt)
+  int _ppsPin;
+  volatile int64_t _lastPpsUs;
+  volatile uint32_t _ppsCount;
+  volatile int32_t _nmeaLatencyUs;
+  mutable portMUX_TYPE _ppsLock = portMUX_INITIALIZER_UNLOCKED;
+};
+
+#endif // TIME_BASE_H
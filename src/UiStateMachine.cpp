@@ -0,0 +1,112 @@
+/*
+ * UiStateMachine.cpp
+ * 
+ * Implementation of the table-driven UI state machine
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "UiStateMachine.h"
+#include "Logger.h"
+
+// Constructor
+UiStateMachine::UiStateMachine(const UiStateInfo* states, uint8_t stateCount,
+                               const UiTransition* transitions, uint8_t transitionCount,
+                               uint8_t initial) {
+  _states = states;
+  _stateCount = stateCount;
+  _transitions = transitions;
+  _transitionCount = transitionCount;
+  _initial = initial;
+  _state = initial;
+  _enteredMs = 0;
+  _dispatching = false;
+  _queueHead = 0;
+  _queueCount = 0;
+}
+
+bool UiStateMachine::dispatch(UiEvent event) {
+  // 処理関数の中から送られたイベントは、いまの遷移が終わってから処理する
+  if (_dispatching) {
+    if (_queueCount < UI_EVENT_QUEUE_SIZE) {
+      _queue[(_queueHead + _queueCount) % UI_EVENT_QUEUE_SIZE] = event;
+      _queueCount++;
+    } else {
+      LOG_W(LOG_TAG_MAIN, "UI event %u dropped: queue full", (unsigned)event);
+    }
+    return false;
+  }
+  
+  bool fired = false;
+  while (true) {
+    const UiTransition* transition = nullptr;
+    for (uint8_t i = 0; i < _transitionCount; i++) {
+      if (_transitions[i].state == _state && _transitions[i].event == event) {
+        transition = &_transitions[i];
+        break;
+      }
+    }
+    
+    if (transition != nullptr && transition->next < _stateCount) {
+      _dispatching = true;
+      if (_states[_state].onExit != nullptr) {
+        _states[_state].onExit();
+      }
+      if (transition->action != nullptr) {
+        transition->action();
+      }
+      _state = transition->next;
+      _enteredMs = millis();
+      if (_states[_state].onEnter != nullptr) {
+        _states[_state].onEnter();
+      }
+      _dispatching = false;
+      fired = true;
+    }
+    
+    if (!takeQueued(&event)) {
+      return fired;
+    }
+  }
+}
+
+// Pop the oldest event raised during a handler
+bool UiStateMachine::takeQueued(UiEvent* event) {
+  if (_queueCount == 0) {
+    return false;
+  }
+  *event = _queue[_queueHead];
+  _queueHead = (_queueHead + 1) % UI_EVENT_QUEUE_SIZE;
+  _queueCount--;
+  return true;
+}
+
+void UiStateMachine::tick() {
+  const UiStateInfo& info = _states[_state];
+  if (info.timeoutMs != 0 && millis() - _enteredMs >= info.timeoutMs) {
+    if (dispatch(UI_EVENT_TIMEOUT)) {
+      return;
+    }
+    // 表にタイムアウトの遷移がない状態は、時間を測り直して滞在を続ける
+    _enteredMs = millis();
+  }
+  if (info.onTick != nullptr) {
+    _dispatching = true;
+    info.onTick();
+    _dispatching = false;
+    UiEvent event;
+    if (takeQueued(&event)) {
+      dispatch(event);
+    }
+  }
+}
+
+uint32_t UiStateMachine::getTimeToDeadline() const {
+  uint32_t timeoutMs = _states[_state].timeoutMs;
+  if (timeoutMs == 0) {
+    return UINT32_MAX;
+  }
+  uint32_t elapsed = millis() - _enteredMs;
+  return elapsed >= timeoutMs ? 0 : timeoutMs - elapsed;
+}
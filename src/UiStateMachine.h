@@ -0,0 +1,91 @@
+/*
+ * UiStateMachine.h
+ * 
+ * Table-driven, non-blocking state machine for the UI flows
+ * (calibration, message toasts) ticked by the UI task
+ * 
+ * 状態ごとの設定（入ったとき・出るとき・滞在中に呼ぶ関数とタイムアウト）と
+ * 遷移（状態・イベント・次の状態・遷移時の処理）を定数の表で与える。
+ * delay()で待つ代わりにtick()がタイムアウトをイベントとして送るため、
+ * 待っている間もループ（GPSの読み出し・描画・保存）は止まらない。
+ * 表にない組み合わせのイベントは無視される。関数ポインタのみを使い、
+ * ヒープは使わない。
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef UI_STATE_MACHINE_H
+#define UI_STATE_MACHINE_H
+
+#include <Arduino.h>
+
+// Events raised from handlers while a transition runs (processed in order afterwards)
+#define UI_EVENT_QUEUE_SIZE 4
+
+// Events
+enum UiEvent : uint8_t {
+  UI_EVENT_START,        // フローを開始する
+  UI_EVENT_PRESS,        // ボタンの短押し
+  UI_EVENT_RELEASE,      // ボタンが離された
+  UI_EVENT_DONE,         // 処理が終わった（滞在中の関数が送る）
+  UI_EVENT_TIMEOUT       // 状態のタイムアウト（tick()が送る）
+};
+
+typedef void (*UiAction)();
+
+// Per-state behaviour (indexed by the state value)
+struct UiStateInfo {
+  uint32_t timeoutMs;    // 0 = タイムアウトなし
+  UiAction onEnter;      // nullptr可
+  UiAction onTick;       // 滞在中にtick()ごと
+  UiAction onExit;
+};
+
+// One transition
+struct UiTransition {
+  uint8_t state;
+  UiEvent event;
+  uint8_t next;
+  UiAction action;       // 出る処理と入る処理の間に呼ぶ（nullptr可）
+};
+
+class UiStateMachine {
+public:
+  // Tables must outlive the machine (normally static const arrays)
+  UiStateMachine(const UiStateInfo* states, uint8_t stateCount,
+                 const UiTransition* transitions, uint8_t transitionCount, uint8_t initial);
+  
+  // Deliver an event; returns true when a transition fired
+  // Re-entering the same state restarts its timeout and calls its handlers again
+  bool dispatch(UiEvent event);
+  
+  // Run the current state's tick handler and fire its timeout (UI task, every loop)
+  // A timeout without a matching transition restarts the state's timer
+  void tick();
+  
+  uint8_t getState() const { return _state; }
+  bool isIn(uint8_t state) const { return _state == state; }
+  bool isIdle() const { return _state == _initial; }
+  uint32_t getTimeInState() const { return millis() - _enteredMs; }
+  
+  // Milliseconds until the current state's timeout (UINT32_MAX without one)
+  uint32_t getTimeToDeadline() const;
+
+private:
+  const UiStateInfo* _states;
+  const UiTransition* _transitions;
+  uint8_t _stateCount;
+  uint8_t _transitionCount;
+  uint8_t _initial;
+  uint8_t _state;
+  uint32_t _enteredMs;
+  bool _dispatching;     // 処理中に送られたイベントは処理後に流す
+  UiEvent _queue[UI_EVENT_QUEUE_SIZE];
+  uint8_t _queueHead;
+  uint8_t _queueCount;
+  
+  bool takeQueued(UiEvent* event);
+};
+
+#endif // UI_STATE_MACHINE_H
@@ -0,0 +1,580 @@
+/*
+ * WifiAssist.cpp
+ * 
+ * Implementation of the Wi-Fi time and GPS assist task
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "WifiAssist.h"
+#include <WiFi.h>
+#include <WiFiUdp.h>
+#include <HTTPClient.h>
+#include <LittleFS.h>
+#include <esp_timer.h>
+#include <esp_random.h>
+#include "Logger.h"
+
+// 保存レコードの大きさの上限
+static_assert(sizeof(NetworkConfig) <= PERSIST_MAX_RECORD_SIZE, "NetworkConfig does not fit in a record");
+
+// NTP packet layout (RFC 5905)
+#define NTP_PACKET_SIZE          48
+#define NTP_OFFSET_ORIGINATE     24
+#define NTP_OFFSET_RECEIVE       32
+#define NTP_OFFSET_TRANSMIT      40
+#define NTP_UNIX_OFFSET_S        2208988800LL   // 1900年から1970年までの秒数
+
+// Cached assist data
+#define WIFI_ASSIST_MAGIC        0x53534741     // "AGSS"
+
+// Copy a string into a fixed field (always terminated)
+static void copyField(char* field, size_t size, const char* value) {
+  strncpy(field, value != nullptr ? value : "", size - 1);
+  field[size - 1] = '\0';
+}
+
+// Big-endian NTP timestamp to Unix microseconds
+static int64_t ntpToUnixUs(const uint8_t* p) {
+  uint32_t seconds = ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+  uint32_t fraction = ((uint32_t)p[4] << 24) | ((uint32_t)p[5] << 16) | ((uint32_t)p[6] << 8) | p[7];
+  
+  // 2036年に秒が一周する（最上位ビットが0なら次の時代とみなす）
+  int64_t ntpSeconds = seconds;
+  if ((seconds & 0x80000000UL) == 0) {
+    ntpSeconds += 0x100000000LL;
+  }
+  return (ntpSeconds - NTP_UNIX_OFFSET_S) * 1000000LL + (int64_t)(((uint64_t)fraction * 1000000ULL) >> 32);
+}
+
+// Constructor
+WifiAssist::WifiAssist(PersistenceStore* store, TimeBase* timeBase, AtomicBaseGPS* gps,
+                       OtaUpdater* updater) {
+  _store = store;
+  _timeBase = timeBase;
+  _gps = gps;
+  _updater = updater;
+  _taskHandle = nullptr;
+  memset(&_config, 0, sizeof(_config));
+  memset(_updateUrl, 0, sizeof(_updateUrl));
+  memset(_updateMd5, 0, sizeof(_updateMd5));
+  _updateHasMd5 = false;
+  _updateRequested = false;
+  _busy = false;
+  _state = WIFI_ASSIST_IDLE;
+  _lastRunMs = 0;
+  _ntpRttUs = 0;
+  _assistBytes = 0;
+}
+
+bool WifiAssist::begin() {
+  if (_taskHandle != nullptr) {
+    return true;
+  }
+  
+  // 保存された接続先を取得（起動時にストアが読み込み済み）
+  _store->attach(PERSIST_NETWORK, &_config, sizeof(_config), NETWORK_RECORD_VERSION);
+  _config.ssid[sizeof(_config.ssid) - 1] = '\0';
+  _config.password[sizeof(_config.password) - 1] = '\0';
+  _config.ntpServer[sizeof(_config.ntpServer) - 1] = '\0';
+  _config.assistUrl[sizeof(_config.assistUrl) - 1] = '\0';
+  
+  // タスクは起動時に作っておく（Wi-Fiはrequest()まで起動しない）
+  BaseType_t result = xTaskCreatePinnedToCore(taskEntry, "assist", WIFI_TASK_STACK_SIZE, this,
+                                              WIFI_TASK_PRIORITY, &_taskHandle, WIFI_TASK_CORE);
+  if (result != pdPASS) {
+    _taskHandle = nullptr;
+    LOG_E(LOG_TAG_MAIN, "Wi-Fi assist task could not be created");
+    return false;
+  }
+  
+  LOG_I(LOG_TAG_MAIN, "Wi-Fi assist ready (%s)", isConfigured() ? _config.ssid : "no network configured");
+  return true;
+}
+
+void WifiAssist::request() {
+  if (_taskHandle == nullptr || _busy) {
+    return;
+  }
+  _busy = true;
+  xTaskNotifyGive(_taskHandle);
+}
+
+bool WifiAssist::requestUpdate(const char* url, const char* md5) {
+  if (_taskHandle == nullptr || _busy || !isConfigured() || url == nullptr || url[0] == '\0') {
+    return false;
+  }
+  _updateHasMd5 = md5 != nullptr;
+  if (_updateHasMd5 && !OtaUpdater::parseMd5(md5, _updateMd5)) {
+    return false;
+  }
+  copyField(_updateUrl, sizeof(_updateUrl), url);
+
+  // タスクは通知で起きるまで要求を読まない
+  _updateRequested = true;
+  request();
+  return true;
+}
+
+void WifiAssist::setCredentials(const char* ssid, const char* password) {
+  portENTER_CRITICAL(&_configLock);
+  copyField(_config.ssid, sizeof(_config.ssid), ssid);
+  copyField(_config.password, sizeof(_config.password), password);
+  portEXIT_CRITICAL(&_configLock);
+  _store->requestSave(PERSIST_NETWORK);
+}
+
+void WifiAssist::setNtpServer(const char* server) {
+  portENTER_CRITICAL(&_configLock);
+  copyField(_config.ntpServer, sizeof(_config.ntpServer), server);
+  portEXIT_CRITICAL(&_configLock);
+  _store->requestSave(PERSIST_NETWORK);
+}
+
+void WifiAssist::setAssistUrl(const char* url) {
+  portENTER_CRITICAL(&_configLock);
+  copyField(_config.assistUrl, sizeof(_config.assistUrl), url);
+  portEXIT_CRITICAL(&_configLock);
+  _store->requestSave(PERSIST_NETWORK);
+}
+
+const char* WifiAssist::getStateName(WifiAssistState state) {
+  switch (state) {
+    case WIFI_ASSIST_IDLE:       return "idle";
+    case WIFI_ASSIST_CONNECTING: return "connecting";
+    case WIFI_ASSIST_SYNCING:    return "NTP";
+    case WIFI_ASSIST_FETCHING:   return "fetching";
+    case WIFI_ASSIST_SEEDING:    return "seeding";
+    case WIFI_ASSIST_UPDATING:   return "updating";
+    case WIFI_ASSIST_DONE:       return "done";
+    case WIFI_ASSIST_FAILED:     return "failed";
+  }
+  return "?";
+}
+
+void WifiAssist::taskEntry(void* param) {
+  static_cast<WifiAssist*>(param)->run();
+}
+
+void WifiAssist::run() {
+  while (true) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    runOnce();
+    _lastRunMs = millis();
+    _busy = false;
+  }
+}
+
+void WifiAssist::runOnce() {
+  // 設定はUIタスクが変更するため、実行中はコピーを使う
+  NetworkConfig config;
+  portENTER_CRITICAL(&_configLock);
+  config = _config;
+  portEXIT_CRITICAL(&_configLock);
+  
+  // ファームウェアの更新は単独で行う（時刻と補助データは次の実行で）
+  if (_updateRequested) {
+    _updateRequested = false;
+    _state = WIFI_ASSIST_CONNECTING;
+    bool ok = false;
+    if (connect(config)) {
+      _state = WIFI_ASSIST_UPDATING;
+      UBaseType_t priority = uxTaskPriorityGet(nullptr);
+      vTaskPrioritySet(nullptr, WIFI_OTA_PRIORITY);
+      uint8_t md5[16];
+      memcpy(md5, _updateMd5, sizeof(md5));
+      if (_updateHasMd5 || fetchMd5(_updateUrl, md5)) {
+        ok = downloadFirmware(_updateUrl, md5);
+      }
+      vTaskPrioritySet(nullptr, priority);
+      shutdown();
+    }
+    _state = ok ? WIFI_ASSIST_DONE : WIFI_ASSIST_FAILED;
+    return;
+  }
+
+  int64_t utcUs = 0;
+  int64_t timerUs = 0;
+  float timeAccS = 0.0f;
+  bool online = false;
+  
+  if (config.ssid[0] != '\0') {
+    _state = WIFI_ASSIST_CONNECTING;
+    online = connect(config);
+  }
+  
+  if (online) {
+    _state = WIFI_ASSIST_SYNCING;
+    const char* server = config.ntpServer[0] != '\0' ? config.ntpServer : WIFI_NTP_DEFAULT_SERVER;
+    if (syncNtp(server, utcUs, timerUs)) {
+      // 往復の非対称は最大で往復時間の半分
+      timeAccS = _ntpRttUs * 0.5e-6f + 0.01f;
+    }
+    
+    if (utcUs != 0 && config.assistUrl[0] != '\0') {
+      _state = WIFI_ASSIST_FETCHING;
+      fetchAssist(config.assistUrl, utcUs + (esp_timer_get_time() - timerUs));
+    }
+    shutdown();
+  }
+  
+  // NTPが使えなければ時刻基準の現在値（GPSの時刻がある場合は送る必要がない）
+  if (utcUs == 0 && _timeBase->isValid()) {
+    utcUs = _timeBase->nowUtcUs();
+    timerUs = esp_timer_get_time();
+    timeAccS = 1.0f;
+  }
+  
+  if (utcUs != 0 && _timeBase->getSource() < TIMEBASE_SOURCE_NMEA && AtomicBaseGPS::canSend()) {
+    _state = WIFI_ASSIST_SEEDING;
+    seedReceiver(utcUs, timerUs, timeAccS);
+  }
+  
+  _state = (online && utcUs != 0) ? WIFI_ASSIST_DONE : WIFI_ASSIST_FAILED;
+}
+
+bool WifiAssist::connect(const NetworkConfig& config) {
+  WiFi.mode(WIFI_STA);
+  WiFi.begin(config.ssid, config.password[0] != '\0' ? config.password : nullptr);
+  
+  uint32_t startMs = millis();
+  while (WiFi.status() != WL_CONNECTED) {
+    if (millis() - startMs > WIFI_CONNECT_TIMEOUT_MS) {
+      LOG_W(LOG_TAG_MAIN, "Wi-Fi: could not join %s", config.ssid);
+      shutdown();
+      return false;
+    }
+    vTaskDelay(pdMS_TO_TICKS(100));
+  }
+  
+  LOG_I(LOG_TAG_MAIN, "Wi-Fi: joined %s in %lu ms (RSSI %d)", config.ssid,
+        (unsigned long)(millis() - startMs), WiFi.RSSI());
+  return true;
+}
+
+void WifiAssist::shutdown() {
+  // 消費電力と2.4GHz帯の共用（BLE）のため、終わったらすぐに切る
+  WiFi.disconnect(true);
+  WiFi.mode(WIFI_OFF);
+}
+
+bool WifiAssist::syncNtp(const char* server, int64_t& utcUs, int64_t& timerUs) {
+  WiFiUDP udp;
+  if (!udp.begin(WIFI_NTP_LOCAL_PORT)) {
+    return false;
+  }
+  
+  uint8_t packet[NTP_PACKET_SIZE];
+  int64_t bestRttUs = (int64_t)WIFI_NTP_MAX_RTT_MS * 1000;
+  bool found = false;
+  
+  for (int sample = 0; sample < WIFI_NTP_SAMPLES; sample++) {
+    // クライアント要求（LI=0, VN=4, Mode=3）。送信時刻欄の値がOriginateで返される
+    memset(packet, 0, sizeof(packet));
+    packet[0] = 0x23;
+    uint32_t cookie = esp_random();
+    memcpy(packet + NTP_OFFSET_TRANSMIT, &cookie, sizeof(cookie));
+    
+    int64_t t1 = esp_timer_get_time();
+    if (!udp.beginPacket(server, WIFI_NTP_PORT) || udp.write(packet, sizeof(packet)) != sizeof(packet) ||
+        !udp.endPacket()) {
+      LOG_W(LOG_TAG_MAIN, "NTP: could not send to %s", server);
+      break;
+    }
+    
+    int64_t t4 = 0;
+    bool received = false;
+    while (esp_timer_get_time() - t1 < (int64_t)WIFI_NTP_TIMEOUT_MS * 1000) {
+      if (udp.parsePacket() >= NTP_PACKET_SIZE) {
+        t4 = esp_timer_get_time();
+        udp.read(packet, sizeof(packet));
+        received = true;
+        break;
+      }
+      vTaskDelay(1);
+    }
+    if (!received) {
+      continue;
+    }
+    
+    // 応答（Mode=4）、同期済み（stratum 1〜15）、自分の要求への応答か確認する
+    uint8_t mode = packet[0] & 0x07;
+    uint8_t leap = packet[0] >> 6;
+    uint8_t stratum = packet[1];
+    if (mode != 4 || leap == 3 || stratum == 0 || stratum > 15 ||
+        memcmp(packet + NTP_OFFSET_ORIGINATE, &cookie, sizeof(cookie)) != 0) {
+      LOG_D(LOG_TAG_MAIN, "NTP: rejected reply (mode %u, stratum %u)", mode, stratum);
+      continue;
+    }
+    
+    int64_t t2 = ntpToUnixUs(packet + NTP_OFFSET_RECEIVE);
+    int64_t t3 = ntpToUnixUs(packet + NTP_OFFSET_TRANSMIT);
+    int64_t rttUs = (t4 - t1) - (t3 - t2);
+    if (rttUs < 0 || rttUs >= bestRttUs) {
+      continue;
+    }
+    
+    // 往復の遅延が対称とみれば、受信時（t4）のUTCは T3 + 往復/2
+    bestRttUs = rttUs;
+    utcUs = t3 + rttUs / 2;
+    timerUs = t4;
+    found = true;
+  }
+  udp.stop();
+  
+  if (!found) {
+    LOG_W(LOG_TAG_MAIN, "NTP: no usable reply from %s", server);
+    return false;
+  }
+  
+  _ntpRttUs = (uint32_t)bestRttUs;
+  _timeBase->submit(utcUs, timerUs, TIMEBASE_SOURCE_NTP);
+  _gps->wake();  // GPSタスクのservice()ですぐに反映させる
+  LOG_I(LOG_TAG_MAIN, "NTP: %s, round trip %.1f ms", server, bestRttUs * 0.001f);
+  return true;
+}
+
+bool WifiAssist::readCacheHeader(CacheHeader& header) {
+  File file = LittleFS.open(WIFI_ASSIST_FILE, FILE_READ);
+  if (!file) {
+    return false;
+  }
+  bool ok = file.read((uint8_t*)&header, sizeof(header)) == sizeof(header) &&
+            header.magic == WIFI_ASSIST_MAGIC && header.length > 0 &&
+            header.length <= WIFI_ASSIST_MAX_BYTES && file.size() == sizeof(header) + header.length;
+  file.close();
+  return ok;
+}
+
+bool WifiAssist::fetchAssist(const char* url, int64_t utcUs) {
+  uint32_t utcSeconds = (uint32_t)(utcUs / 1000000LL);
+  
+  // キャッシュがまだ新しければ取得しない（サービスの利用回数を抑える）
+  CacheHeader header;
+  if (readCacheHeader(header) && utcSeconds >= header.fetchedUtc &&
+      utcSeconds - header.fetchedUtc < WIFI_ASSIST_MAX_AGE_S / 2) {
+    LOG_I(LOG_TAG_MAIN, "Assist: cached data is %lu min old",
+          (unsigned long)((utcSeconds - header.fetchedUtc) / 60));
+    return true;
+  }
+  
+  HTTPClient http;
+  http.setConnectTimeout(WIFI_ASSIST_HTTP_TIMEOUT_MS);
+  http.setTimeout(WIFI_ASSIST_HTTP_TIMEOUT_MS);
+  if (!http.begin(url)) {
+    LOG_W(LOG_TAG_MAIN, "Assist: invalid URL");
+    return false;
+  }
+  
+  int code = http.GET();
+  int size = http.getSize();
+  if (code != HTTP_CODE_OK || size <= 0 || size > WIFI_ASSIST_MAX_BYTES) {
+    LOG_W(LOG_TAG_MAIN, "Assist: HTTP %d, %d bytes", code, size);
+    http.end();
+    return false;
+  }
+  
+  if (!LittleFS.exists(WIFI_ASSIST_DIR)) {
+    LittleFS.mkdir(WIFI_ASSIST_DIR);
+  }
+  File file = LittleFS.open(WIFI_ASSIST_TEMP_FILE, FILE_WRITE);
+  if (!file) {
+    LOG_W(LOG_TAG_MAIN, "Assist: could not create %s", WIFI_ASSIST_TEMP_FILE);
+    http.end();
+    return false;
+  }
+  
+  // 先頭のヘッダーは受信後に書き直す（途中で切れたファイルは使われない）
+  memset(&header, 0, sizeof(header));
+  file.write((const uint8_t*)&header, sizeof(header));
+  
+  WiFiClient* stream = http.getStreamPtr();
+  uint32_t received = 0;
+  uint32_t crc = 0;
+  uint32_t lastDataMs = millis();
+  while (received < (uint32_t)size && millis() - lastDataMs < WIFI_ASSIST_HTTP_TIMEOUT_MS) {
+    int available = stream->available();
+    if (available <= 0) {
+      vTaskDelay(pdMS_TO_TICKS(5));
+      continue;
+    }
+    size_t wanted = min((size_t)available, min(sizeof(_chunk), (size_t)(size - received)));
+    int count = stream->read(_chunk, wanted);
+    if (count <= 0) {
+      continue;
+    }
+    if (file.write(_chunk, count) != (size_t)count) {
+      break;
+    }
+    crc = PersistenceStore::crc32(_chunk, count, crc);
+    received += count;
+    lastDataMs = millis();
+  }
+  http.end();
+  
+  if (received != (uint32_t)size) {
+    LOG_W(LOG_TAG_MAIN, "Assist: download stopped at %lu of %d bytes", (unsigned long)received, size);
+    file.close();
+    LittleFS.remove(WIFI_ASSIST_TEMP_FILE);
+    return false;
+  }
+  
+  header.magic = WIFI_ASSIST_MAGIC;
+  header.fetchedUtc = utcSeconds;
+  header.length = received;
+  header.crc = crc;
+  file.seek(0);
+  file.write((const uint8_t*)&header, sizeof(header));
+  file.close();
+  
+  // 完成したファイルで置き換える
+  LittleFS.remove(WIFI_ASSIST_FILE);
+  LittleFS.rename(WIFI_ASSIST_TEMP_FILE, WIFI_ASSIST_FILE);
+  LOG_I(LOG_TAG_MAIN, "Assist: cached %lu bytes", (unsigned long)received);
+  return true;
+}
+
+void WifiAssist::seedReceiver(int64_t utcUs, int64_t timerUs, float timeAccS) {
+  // 概略の位置と時刻（見える衛星の予測に使われる）
+  AssistPosition position;
+  bool hasPosition = _position.read(position) && position.valid;
+  int64_t nowUs = utcUs + (esp_timer_get_time() - timerUs);
+  if (hasPosition) {
+    _gps->sendAidIni(position.latitude, position.longitude, position.altitude,
+                     WIFI_AID_POSITION_ACC_M, nowUs, timeAccS);
+  } else {
+    _gps->sendAidIni(0.0, 0.0, 0.0, 0.0f, nowUs, timeAccS);   // 時刻のみ
+  }
+  
+  // キャッシュした補助データ（受信機のメッセージ列）をそのまま送る
+  _assistBytes = 0;
+  CacheHeader header;
+  if (!readCacheHeader(header)) {
+    return;
+  }
+  uint32_t utcSeconds = (uint32_t)(nowUs / 1000000LL);
+  if (utcSeconds < header.fetchedUtc || utcSeconds - header.fetchedUtc > WIFI_ASSIST_MAX_AGE_S) {
+    LOG_D(LOG_TAG_MAIN, "Assist: cached data expired");
+    return;
+  }
+  
+  File file = LittleFS.open(WIFI_ASSIST_FILE, FILE_READ);
+  if (!file) {
+    return;
+  }
+  
+  // 送る前にCRCを確認する（壊れたエフェメリスを渡さない）
+  uint32_t crc = 0;
+  file.seek(sizeof(header));
+  for (uint32_t done = 0; done < header.length; ) {
+    int count = file.read(_chunk, min((uint32_t)sizeof(_chunk), header.length - done));
+    if (count <= 0) {
+      break;
+    }
+    crc = PersistenceStore::crc32(_chunk, count, crc);
+    done += count;
+  }
+  if (crc != header.crc) {
+    LOG_W(LOG_TAG_MAIN, "Assist: cached data is corrupt");
+    file.close();
+    LittleFS.remove(WIFI_ASSIST_FILE);
+    return;
+  }
+  
+  file.seek(sizeof(header));
+  uint32_t sent = 0;
+  while (sent < header.length) {
+    int count = file.read(_chunk, min((uint32_t)sizeof(_chunk), header.length - sent));
+    if (count <= 0) {
+      break;
+    }
+    sent += _gps->sendRaw(_chunk, count);
+  }
+  file.close();
+  
+  _assistBytes = sent;
+  LOG_I(LOG_TAG_MAIN, "Assist: sent %lu bytes to the receiver", (unsigned long)sent);
+}
+
+bool WifiAssist::fetchMd5(const char* url, uint8_t* md5) {
+  char md5Url[WIFI_OTA_URL_SIZE + sizeof(WIFI_OTA_MD5_SUFFIX)];
+  snprintf(md5Url, sizeof(md5Url), "%s%s", url, WIFI_OTA_MD5_SUFFIX);
+
+  HTTPClient http;
+  http.setConnectTimeout(WIFI_ASSIST_HTTP_TIMEOUT_MS);
+  http.setTimeout(WIFI_ASSIST_HTTP_TIMEOUT_MS);
+  if (!http.begin(md5Url)) {
+    return false;
+  }
+
+  // md5sumの出力（先頭の32桁）を読む
+  char hex[33] = {0};
+  int code = http.GET();
+  if (code == HTTP_CODE_OK) {
+    WiFiClient* stream = http.getStreamPtr();
+    stream->setTimeout(WIFI_ASSIST_HTTP_TIMEOUT_MS);
+    stream->readBytes(hex, 32);
+  }
+  http.end();
+
+  if (code != HTTP_CODE_OK || !OtaUpdater::parseMd5(hex, md5)) {
+    LOG_W(LOG_TAG_MAIN, "OTA: no MD5 at %s (HTTP %d)", md5Url, code);
+    return false;
+  }
+  return true;
+}
+
+bool WifiAssist::downloadFirmware(const char* url, const uint8_t* md5) {
+  HTTPClient http;
+  http.setConnectTimeout(WIFI_ASSIST_HTTP_TIMEOUT_MS);
+  http.setTimeout(WIFI_ASSIST_HTTP_TIMEOUT_MS);
+  if (!http.begin(url)) {
+    LOG_W(LOG_TAG_MAIN, "OTA: invalid URL");
+    return false;
+  }
+
+  int code = http.GET();
+  int size = http.getSize();
+  if (code != HTTP_CODE_OK || size <= 0) {
+    LOG_W(LOG_TAG_MAIN, "OTA: HTTP %d, %d bytes", code, size);
+    http.end();
+    return false;
+  }
+  if (!_updater->begin((uint32_t)size, md5)) {
+    http.end();
+    return false;
+  }
+
+  WiFiClient* stream = http.getStreamPtr();
+  uint32_t received = 0;
+  uint32_t lastDataMs = millis();
+  bool ok = true;
+  while (ok && received < (uint32_t)size) {
+    if (millis() - lastDataMs > WIFI_ASSIST_HTTP_TIMEOUT_MS) {
+      LOG_W(LOG_TAG_MAIN, "OTA: download stopped at %lu of %d bytes", (unsigned long)received, size);
+      ok = false;
+      break;
+    }
+    int available = stream->available();
+    if (available <= 0) {
+      vTaskDelay(pdMS_TO_TICKS(5));
+      continue;
+    }
+    size_t wanted = min((size_t)available, min(sizeof(_chunk), (size_t)(size - received)));
+    int count = stream->read(_chunk, wanted);
+    if (count <= 0) {
+      continue;
+    }
+    ok = _updater->write(_chunk, count);
+    received += count;
+    lastDataMs = millis();
+  }
+  http.end();
+
+  if (!ok) {
+    _updater->abort();
+    return false;
+  }
+  return _updater->end();
+}
@@ -0,0 +1,174 @@
+/*
+ * WifiAssist.h
+ * 
+ * Optional Wi-Fi bring-up for NTP time and assisted GPS start
+ * Joins the configured network in the background, synchronizes the
+ * time base from NTP, refreshes the cached GPS assist data, seeds the
+ * receiver with it and turns Wi-Fi off again
+ * 
+ * 専用のタスクがrequest()で起床し、接続→NTP（最小の往復時間の観測を
+ * TimeBase::submit()で渡す）→補助データの取得（設定したURL、LittleFSに
+ * キャッシュ）→受信機への送信（概略の位置・時刻のAID-INIと補助データ）
+ * の順に行って電源を切る。接続できなくてもキャッシュが有効なら送る。
+ * 受信機への送信にはGPSの送信線（GPS_RX_PIN）の配線が必要。
+ * 接続先はシリアルの "wifi <ssid> <password>" などで設定し、NVSに保存する。
+ * requestUpdate()ではNTPの代わりにファームウェアをダウンロードして
+ * OtaUpdaterに渡す（優先度を下げて実行し、計測中でも姿勢の追従を続ける）。
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef WIFI_ASSIST_H
+#define WIFI_ASSIST_H
+
+#include <Arduino.h>
+#include "SeqLock.h"
+#include "TimeBase.h"
+#include "AtomicBaseGPS.h"
+#include "PersistenceStore.h"
+#include "OtaUpdater.h"
+
+// Network
+#define WIFI_CONNECT_TIMEOUT_MS  15000      // 接続を待つ最大時間
+#define WIFI_NTP_DEFAULT_SERVER  "pool.ntp.org"
+#define WIFI_NTP_PORT            123
+#define WIFI_NTP_LOCAL_PORT      2390
+#define WIFI_NTP_SAMPLES         4          // 往復時間が最小の観測を使う
+#define WIFI_NTP_TIMEOUT_MS      1000       // 1回の応答を待つ時間
+#define WIFI_NTP_MAX_RTT_MS      500        // これより遅い応答は使わない
+#define WIFI_NTP_RESYNC_MS       3600000    // GPSの時刻がない間の再同期間隔
+
+// Assist data cache (LittleFS, mounted by the session recorder)
+#define WIFI_ASSIST_DIR          "/assist"
+#define WIFI_ASSIST_FILE         "/assist/agnss.bin"
+#define WIFI_ASSIST_TEMP_FILE    "/assist/agnss.tmp"
+#define WIFI_ASSIST_MAX_BYTES    32768      // これより大きい応答は捨てる
+#define WIFI_ASSIST_MAX_AGE_S    14400      // 補助データ（エフェメリス）の有効期間（4時間）
+#define WIFI_ASSIST_HTTP_TIMEOUT_MS 10000
+#define WIFI_ASSIST_CHUNK_SIZE   256
+
+// Position seed accuracy for AID-INI
+#define WIFI_AID_POSITION_ACC_M  10000.0f   // 保存された位置（移動していれば数十km）
+
+// Assist task
+#define WIFI_TASK_CORE           1          // UIと同じコア（Wi-Fiドライバはコア0）
+#define WIFI_TASK_PRIORITY       1          // loopTaskと同じ
+#define WIFI_TASK_STACK_SIZE     8192       // HTTPクライアント用
+#define WIFI_OTA_PRIORITY        tskIDLE_PRIORITY // ファームウェアのダウンロード中の優先度
+
+// Firmware download
+#define WIFI_OTA_URL_SIZE        192
+#define WIFI_OTA_MD5_SUFFIX      ".md5"     // MD5を指定しなければ "<url>.md5" を読む
+
+// Persistent network configuration (PERSIST_NETWORK)
+#define NETWORK_RECORD_VERSION   1
+struct NetworkConfig {
+  char ssid[33];
+  char password[65];
+  char ntpServer[64];      // 空なら WIFI_NTP_DEFAULT_SERVER
+  char assistUrl[192];     // 補助データのURL（空なら取得しない）
+};
+
+// Approximate position for the receiver (published by the UI task)
+struct AssistPosition {
+  double latitude;
+  double longitude;
+  float altitude;
+  bool valid;
+};
+
+// Progress of the last run
+enum WifiAssistState {
+  WIFI_ASSIST_IDLE,
+  WIFI_ASSIST_CONNECTING,
+  WIFI_ASSIST_SYNCING,
+  WIFI_ASSIST_FETCHING,
+  WIFI_ASSIST_SEEDING,
+  WIFI_ASSIST_UPDATING,
+  WIFI_ASSIST_DONE,
+  WIFI_ASSIST_FAILED
+};
+
+class WifiAssist {
+public:
+  // Constructor
+  WifiAssist(PersistenceStore* store, TimeBase* timeBase, AtomicBaseGPS* gps, OtaUpdater* updater);
+  
+  // Load the configuration and start the assist task (Wi-Fi stays off)
+  bool begin();
+  
+  // Run once in the background (ignored while a run is in progress)
+  void request();
+  bool isBusy() const { return _busy; }
+
+  // Download a firmware image into the inactive slot (md5 is 32 hex digits,
+  // or nullptr to read "<url>.md5"); returns false while busy or unconfigured
+  bool requestUpdate(const char* url, const char* md5);
+  
+  // Configuration (UI task; saved through the persistence store)
+  bool isConfigured() const { return _config.ssid[0] != '\0'; }
+  void setCredentials(const char* ssid, const char* password);
+  void setNtpServer(const char* server);
+  void setAssistUrl(const char* url);
+  const char* getSsid() const { return _config.ssid; }
+  
+  // Last known position for the AID-INI seed (UI task only)
+  void setPosition(const AssistPosition& position) { _position.write(position); }
+  
+  // Status
+  WifiAssistState getState() const { return _state; }
+  static const char* getStateName(WifiAssistState state);
+  uint32_t getLastRunMs() const { return _lastRunMs; }
+  uint32_t getNtpRttUs() const { return _ntpRttUs; }
+  uint32_t getAssistBytes() const { return _assistBytes; }
+
+private:
+  // Assist task
+  static void taskEntry(void* param);
+  void run();
+  void runOnce();
+  
+  // Steps (assist task only)
+  bool connect(const NetworkConfig& config);
+  void shutdown();
+  bool syncNtp(const char* server, int64_t& utcUs, int64_t& timerUs);
+  bool fetchAssist(const char* url, int64_t utcUs);
+  void seedReceiver(int64_t utcUs, int64_t timerUs, float timeAccS);
+  bool downloadFirmware(const char* url, const uint8_t* md5);
+  bool fetchMd5(const char* url, uint8_t* md5);
+  
+  // Cached assist data header (followed by the data)
+  struct CacheHeader {
+    uint32_t magic;
+    uint32_t fetchedUtc;     // 取得時刻（Unix秒）
+    uint32_t length;
+    uint32_t crc;
+  };
+  bool readCacheHeader(CacheHeader& header);
+  
+  PersistenceStore* _store;
+  TimeBase* _timeBase;
+  AtomicBaseGPS* _gps;
+  OtaUpdater* _updater;
+  TaskHandle_t _taskHandle;
+  
+  NetworkConfig _config;       // UIタスクが変更し、タスクはロックしてコピーを使う
+  portMUX_TYPE _configLock = portMUX_INITIALIZER_UNLOCKED;
+  SeqLock<AssistPosition> _position;
+
+  // Firmware request (written by the UI task before the task is woken)
+  char _updateUrl[WIFI_OTA_URL_SIZE];
+  uint8_t _updateMd5[16];
+  bool _updateHasMd5;
+  volatile bool _updateRequested;
+  
+  volatile bool _busy;
+  volatile WifiAssistState _state;
+  volatile uint32_t _lastRunMs;
+  volatile uint32_t _ntpRttUs;
+  volatile uint32_t _assistBytes;
+  uint8_t _chunk[WIFI_ASSIST_CHUNK_SIZE];
+};
+
+#endif // WIFI_ASSIST_H
@@ -5,12 +5,13 @@
  */
 
 #include "celestial_math.h"
-#include <Arduino.h>
+#include "hal.h"
 #include <math.h>
-
-// Constants
-#define DEG_TO_RAD (PI / 180.0)
-#define RAD_TO_DEG (180.0 / PI)
+#include <sys/time.h>
+#include "Logger.h"
+#include "fast_math.h"
+#include "pole_star_table.h"
+#include "magnetic_model.h"
 
 // Time-related functions
 double getJulianDate(int year, int month, int day) {
@@ -52,93 +53,52 @@ double getSiderealTime(double jd, double longitude) {
   return LST;
 }
 
+double getJulianDateTime(int year, int month, int day, int hour, int minute, double second) {
+  return getJulianDate(year, month, day) + (hour - 12) / 24.0 + minute / 1440.0 + second / 86400.0;
+}
+
 // Celestial pole calculations
+bool getSystemJulianDate(double *jd) {
+  struct timeval tv;
+  gettimeofday(&tv, nullptr);
+  if (tv.tv_sec < SYSTEM_CLOCK_VALID_EPOCH) {
+    return false;
+  }
+  
+  // Unixエポック（1970-01-01 00:00 UTC）のユリウス日は2440587.5
+  *jd = 2440587.5 + ((double)tv.tv_sec + tv.tv_usec * 1e-6) / 86400.0;
+  return true;
+}
+
 void calculatePolePosition(float latitude, float longitude, float *azimuth, float *altitude) {
   // For the celestial pole, the altitude is equal to the latitude in the northern hemisphere
   // In the southern hemisphere, it's the negative of the latitude
   
   // デバッグ出力
-  Serial.print("Calculate Pole Position - Latitude: ");
-  Serial.print(latitude);
-  Serial.print(", Longitude: ");
-  Serial.println(longitude);
+  LOG_V_EVERY(LOG_TAG_CELESTIAL, 1000, "Calculate Pole Position - Latitude: %.2f, Longitude: %.2f",
+              latitude, longitude);
   
   // 緯度が0または未設定の場合、デフォルト値として日本の平均緯度を使用
   if (latitude < 0.1f && latitude > -0.1f) {
-    Serial.println("Warning: Latitude near zero, using default value for Japan (35.0)");
+    LOG_W_EVERY(LOG_TAG_CELESTIAL, 10000, "Latitude near zero, using default value for Japan (35.0)");
     latitude = 35.0f; // 日本の平均緯度
   }
   
-  if (latitude >= 0) {
-    // Northern hemisphere - North Celestial Pole
-    *altitude = latitude;
-    
-    // Calculate local sidereal time (LST) for current time
-    // Get current date and time from system
-    unsigned long currentTime = millis() / 1000; // seconds since startup
-    
-    // For a real implementation, you should use a real-time clock (RTC)
-    // Here we'll use a fixed date/time for demonstration
-    // In practice, this should be replaced with actual date/time
-    int year = 2025;
-    int month = 3;
-    int day = 23;
-    int hour = 20; // UTC time
-    int minute = 0;
-    int second = 0;
-    
-    // Calculate Julian Date
-    double jd = getJulianDate(year, month, day);
-    jd += (hour / 24.0) + (minute / 1440.0) + (second / 86400.0);
-    
-    // Calculate Local Sidereal Time
-    double lst = getSiderealTime(jd, longitude);
-    
-    // Polaris is at RA 02h 31m 49s and Dec +89° 15' 51" (J2000)
-    // Convert to radians
-    double polarisRA = (2.0 + 31.0/60.0 + 49.0/3600.0) * 15.0 * DEG_TO_RAD; // 15 deg per hour
-    double polarisDec = (89.0 + 15.0/60.0 + 51.0/3600.0) * DEG_TO_RAD;
-    
-    // Calculate hour angle of Polaris
-    double ha = lst * DEG_TO_RAD - polarisRA;
-    
-    // Calculate azimuth of Polaris
-    double latRad = latitude * DEG_TO_RAD;
-    double sinAlt = sin(polarisDec) * sin(latRad) + cos(polarisDec) * cos(latRad) * cos(ha);
-    double cosAlt = sqrt(1.0 - sinAlt * sinAlt);
-    double sinAz = -cos(polarisDec) * sin(ha) / cosAlt;
-    double cosAz = (sin(polarisDec) - sinAlt * sin(latRad)) / (cosAlt * cos(latRad));
-    
-    // Calculate azimuth in degrees
-    *azimuth = atan2(sinAz, cosAz) * RAD_TO_DEG;
-    
-    // Normalize to 0-360 degrees
-    while (*azimuth < 0) *azimuth += 360.0;
-    while (*azimuth >= 360.0) *azimuth -= 360.0;
-    
-    // Adjust altitude for atmospheric refraction (simplified)
-    float trueAltitude = asin(sinAlt) * RAD_TO_DEG;
-    float refraction = 0.0;
-    
-    if (trueAltitude > -0.575) {
-      refraction = 1.02 / tan((trueAltitude + 10.3 / (trueAltitude + 5.11)) * DEG_TO_RAD) / 60.0;
-    }
-    
-    // If we want the position of Polaris instead of the exact celestial pole
-    // we would use this altitude, but for polar alignment we want the pole
-    // float polarisAltitude = trueAltitude + refraction;
-    
-    // For polar alignment, we keep the altitude as the latitude
-    // *altitude = polarisAltitude;
-  } else {
-    // Southern hemisphere - South Celestial Pole
-    *altitude = -latitude;
-    
-    // In the southern hemisphere, Sigma Octantis is the closest visible star to the pole
-    // but it's much fainter than Polaris and harder to use for alignment
-    // For simplicity, we'll just use the true south direction
-    *azimuth = 180.0; // True South
+  // Calculate local sidereal time (LST) for current time
+  // システム時刻はTimeBaseがGPS時刻で合わせる。未設定の間だけ固定日時を使う
+  double jd;
+  if (!getSystemJulianDate(&jd)) {
+    jd = getJulianDateTime(2025, 3, 23, 20, 0, 0);  // UTC
   }
+  double lst = getSiderealTime(jd, longitude);
+  
+  // 北半球は北極星、南半球ははちぶんぎ座σ星の視位置（歳差・章動・光行差を含む表）
+  double ra, dec;
+  getPoleStarPlace(poleStarForLatitude(latitude), jd, &ra, &dec);
+  calculatePolarisPosition(latitude, lst - ra, dec, azimuth, altitude);
+  
+  // 天の極の見かけの高度（標準大気での大気差を加える）
+  *altitude += getRefraction(*altitude);
 }
 
 // Sun position calculations - simplified algorithm
@@ -255,71 +215,10 @@ void calculateMoonPosition(float latitude, float longitude,
 
 // Utility functions
 float calculateMagneticDeclination(float latitude, float longitude) {
-  // Simplified World Magnetic Model (WMM) calculation
-  // This is a simplified implementation based on WMM 2020
-  // Valid for approximately 2020-2025
-  
-  // Convert latitude and longitude to radians
-  float lat_rad = latitude * DEG_TO_RAD;
-  float lon_rad = longitude * DEG_TO_RAD;
-  
-  // Coefficients for simplified WMM 2020 (valid ~2020-2025)
-  // These are simplified coefficients and will give approximate results
-  const float g01 = -29404.5;  // Main dipole term
-  const float g11 = -1450.7;
-  const float h11 = 4652.9;
-  const float g02 = -2500.0;
-  const float g12 = 2982.0;
-  const float h12 = -2991.6;
-  
-  // Calculate magnetic field components
-  float P1 = 1.0;                      // Legendre polynomial P(1,0)
-  float P2 = sin(lat_rad);             // Legendre polynomial P(1,1)
-  float P3 = (3.0 * P1 * P1 - 1.0)/2.0; // Legendre polynomial P(2,0)
-  float P4 = 3.0 * P1 * P2;            // Legendre polynomial P(2,1)
-  
-  // North component (X)
-  float X = g01 * P1 + 
-            g11 * P2 * cos(lon_rad) + 
-            h11 * P2 * sin(lon_rad) +
-            g02 * P3 +
-            g12 * P4 * cos(lon_rad) +
-            h12 * P4 * sin(lon_rad);
-  
-  // East component (Y)
-  float Y = g11 * P1 * sin(lon_rad) - 
-            h11 * P1 * cos(lon_rad) +
-            g12 * P2 * sin(lon_rad) -
-            h12 * P2 * cos(lon_rad);
-  
-  // Calculate declination in degrees
-  float declination = atan2(Y, X) * RAD_TO_DEG;
-  
-  // Apply regional corrections (simplified)
-  // These corrections are very approximate and should be replaced with a proper model
-  // or lookup table for production use
-  
-  // North America correction
-  if (longitude >= -130.0 && longitude <= -60.0 && latitude >= 20.0 && latitude <= 60.0) {
-    declination += 5.0 * sin((longitude + 95.0) * DEG_TO_RAD);
-  }
-  
-  // Europe correction
-  if (longitude >= -10.0 && longitude <= 40.0 && latitude >= 35.0 && latitude <= 70.0) {
-    declination += 2.0 * sin((longitude - 15.0) * DEG_TO_RAD);
-  }
-  
-  // Asia correction
-  if (longitude >= 60.0 && longitude <= 150.0 && latitude >= 0.0 && latitude <= 60.0) {
-    declination -= 3.0 * sin((longitude - 105.0) * DEG_TO_RAD);
-  }
-  
-  // Japan specific correction (more accurate for the target region)
-  if (longitude >= 125.0 && longitude <= 150.0 && latitude >= 30.0 && latitude <= 45.0) {
-    declination = -7.5 + (latitude - 35.0) * 0.2 + (longitude - 135.0) * 0.1;
-  }
-  
-  return declination;
+  // World Magnetic Modelの格子（magnetic_model.h）から補間する
+  MagneticField field;
+  getMagneticField(latitude, longitude, &field);
+  return field.declination;
 }
 
 void applyMagneticDeclination(float *heading, float declination) {
@@ -331,101 +230,41 @@ void applyMagneticDeclination(float *heading, float declination) {
   while (*heading >= 360.0) *heading -= 360.0;
 }
 
+// Convert an event Julian date to a UTC hour and minute of the day starting at jdDay
+static void eventToHourMinute(double eventJd, double jdDay, int *hour, int *minute) {
+  if (eventJd == 0.0) {
+    *hour = -1;
+    *minute = 0;
+    return;
+  }
+  
+  int minutes = (int)floor((eventJd - jdDay) * 1440.0 + 0.5);
+  minutes = constrain(minutes, 0, 1439);
+  *hour = minutes / 60;
+  *minute = minutes % 60;
+}
+
 // Calculate sunrise and sunset times
 void calculateSunriseSunset(float latitude, float longitude, int year, int month, int day,
                            int* sunriseHour, int* sunriseMinute, int* sunsetHour, int* sunsetMinute) {
-  // Simple approximation for sunrise/sunset times
-  // This is a placeholder - for accurate calculations, use a proper astronomical library
-  
-  // Convert date to day of year
-  int dayOfYear = 0;
-  for (int m = 1; m < month; m++) {
-    if (m == 2) {
-      dayOfYear += 28;
-      // Check for leap year
-      if ((year % 4 == 0 && year % 100 != 0) || (year % 400 == 0)) {
-        dayOfYear += 1;
-      }
-    } else if (m == 4 || m == 6 || m == 9 || m == 11) {
-      dayOfYear += 30;
-    } else {
-      dayOfYear += 31;
-    }
-  }
-  dayOfYear += day;
-  
-  // Calculate approximate sunrise/sunset times based on latitude and day of year
-  // This is a very simplified model
-  float latRad = latitude * PI / 180.0;
-  
-  // Approximate solar declination
-  float declination = 23.45 * sin(2.0 * PI * (284 + dayOfYear) / 365.0) * PI / 180.0;
-  
-  // Calculate day length in hours
-  float dayLength = 24.0 - (24.0 / PI) * acos((sin(-0.83 * PI / 180.0) - sin(latRad) * sin(declination)) / 
-                                            (cos(latRad) * cos(declination)));
+  // UTCのその日の0時から24時間を探索する
+  double jdDay = getJulianDateTime(year, month, day, 0, 0, 0);
+  double riseJd, setJd;
+  findRiseSet(CELESTIAL_SUN, latitude, longitude, jdDay, 1.0, &riseJd, &setJd);
   
-  // Calculate noon time (solar noon)
-  float solarNoon = 12.0 - longitude / 15.0;
-  
-  // Calculate sunrise and sunset times
-  float sunrise = solarNoon - dayLength / 2.0;
-  float sunset = solarNoon + dayLength / 2.0;
-  
-  // Convert to hours and minutes
-  *sunriseHour = (int)sunrise;
-  *sunriseMinute = (int)((sunrise - *sunriseHour) * 60);
-  
-  *sunsetHour = (int)sunset;
-  *sunsetMinute = (int)((sunset - *sunsetHour) * 60);
-  
-  // Handle edge cases
-  if (*sunriseHour < 0) {
-    *sunriseHour += 24;
-  } else if (*sunriseHour >= 24) {
-    *sunriseHour -= 24;
-  }
-  
-  if (*sunsetHour < 0) {
-    *sunsetHour += 24;
-  } else if (*sunsetHour >= 24) {
-    *sunsetHour -= 24;
-  }
+  eventToHourMinute(riseJd, jdDay, sunriseHour, sunriseMinute);
+  eventToHourMinute(setJd, jdDay, sunsetHour, sunsetMinute);
 }
 
 // Calculate moonrise and moonset times
 void calculateMoonriseMoonset(float latitude, float longitude, int year, int month, int day,
                              int* moonriseHour, int* moonriseMinute, int* moonsetHour, int* moonsetMinute) {
-  // Simple approximation for moonrise/moonset times
-  // This is a placeholder - for accurate calculations, use a proper astronomical library
-  
-  // For this simple implementation, we'll offset from sunrise/sunset
-  // with a phase shift based on moon phase
-  int sunriseHour, sunriseMinute, sunsetHour, sunsetMinute;
-  calculateSunriseSunset(latitude, longitude, year, month, day, 
-                        &sunriseHour, &sunriseMinute, &sunsetHour, &sunsetMinute);
-  
-  // Get moon phase
-  float moonPhase = calculateMoonPhase(year, month, day);
-  
-  // Calculate offset in hours based on moon phase (0.0 to 1.0)
-  // This creates a full cycle over the lunar month
-  float phaseOffset = moonPhase * 24.0;
+  double jdDay = getJulianDateTime(year, month, day, 0, 0, 0);
+  double riseJd, setJd;
+  findRiseSet(CELESTIAL_MOON, latitude, longitude, jdDay, 1.0, &riseJd, &setJd);
   
-  // Convert sunrise/sunset to decimal hours
-  float sunriseDecimal = sunriseHour + sunriseMinute / 60.0;
-  float sunsetDecimal = sunsetHour + sunsetMinute / 60.0;
-  
-  // Calculate moonrise/moonset with offset
-  float moonriseDecimal = fmod(sunriseDecimal + phaseOffset, 24.0);
-  float moonsetDecimal = fmod(sunsetDecimal + phaseOffset, 24.0);
-  
-  // Convert back to hours and minutes
-  *moonriseHour = (int)moonriseDecimal;
-  *moonriseMinute = (int)((moonriseDecimal - *moonriseHour) * 60);
-  
-  *moonsetHour = (int)moonsetDecimal;
-  *moonsetMinute = (int)((moonsetDecimal - *moonsetHour) * 60);
+  eventToHourMinute(riseJd, jdDay, moonriseHour, moonriseMinute);
+  eventToHourMinute(setJd, jdDay, moonsetHour, moonsetMinute);
 }
 
 // Calculate moon phase (0.0 to 1.0)
@@ -476,3 +315,240 @@ float calculateMoonPhase(int year, int month, int day) {
   
   return phase;
 }
+
+// Azimuth of the pole star and altitude of the celestial pole
+void calculatePolarisPosition(float latitude, double hourAngle, double declination,
+                              float *azimuth, float *altitude) {
+  // calculatePolePosition()と同じく、緯度が0付近の場合は日本の平均緯度を使用
+  if (latitude < 0.1f && latitude > -0.1f) {
+    latitude = 35.0f;
+  }
+  
+  // 極軸合わせでは天の極の高度（=緯度）を使い、方位のみ極星の位置を使う
+  float starAltitude;
+  equatorialToHorizontal(latitude, hourAngle, declination, azimuth, &starAltitude);
+  *altitude = fabsf(latitude);
+}
+
+// Sun equatorial coordinates (low-precision almanac algorithm, ~0.01 deg)
+void calculateSunEquatorial(double jd, double *ra, double *dec) {
+  double n = jd - 2451545.0;
+  
+  // Mean longitude and mean anomaly
+  double L = fmod(280.460 + 0.9856474 * n, 360.0);
+  double g = fmod(357.528 + 0.9856003 * n, 360.0) * DEG_TO_RAD;
+  
+  // Ecliptic longitude and obliquity
+  double lambda = (L + 1.915 * sin(g) + 0.020 * sin(2.0 * g)) * DEG_TO_RAD;
+  double epsilon = (23.439 - 0.0000004 * n) * DEG_TO_RAD;
+  
+  double alpha = atan2(cos(epsilon) * sin(lambda), cos(lambda)) * RAD_TO_DEG;
+  if (alpha < 0) alpha += 360.0;
+  *ra = alpha;
+  *dec = asin(sin(epsilon) * sin(lambda)) * RAD_TO_DEG;
+}
+
+// Moon equatorial coordinates (same simplified model as calculateMoonPosition())
+void calculateMoonEquatorial(double jd, double *ra, double *dec, float *phase) {
+  double d = jd - 2451545.0;
+  
+  // Mean orbital elements of the Moon
+  double L = fmod(218.316 + 13.176396 * d, 360.0) * DEG_TO_RAD; // Mean longitude
+  double M = fmod(134.963 + 13.064993 * d, 360.0) * DEG_TO_RAD; // Mean anomaly
+  double F = fmod(93.272 + 13.229350 * d, 360.0) * DEG_TO_RAD;  // Mean distance
+  
+  // Simplified longitude and latitude of the Moon
+  double lon = L + 6.289 * sin(M) * DEG_TO_RAD;
+  double lat = 5.128 * sin(F) * DEG_TO_RAD;
+  
+  // Convert to equatorial coordinates (simplified)
+  double alpha = atan2(sin(lon) * cos(23.4 * DEG_TO_RAD) - tan(lat) * sin(23.4 * DEG_TO_RAD), cos(lon)) * RAD_TO_DEG;
+  if (alpha < 0) alpha += 360.0;
+  *ra = alpha;
+  *dec = asin(sin(lat) * cos(23.4 * DEG_TO_RAD) + cos(lat) * sin(23.4 * DEG_TO_RAD) * sin(lon)) * RAD_TO_DEG;
+  
+  // 月齢は2000年1月6日18:14 UTCの新月を基準にする（J2000.0は新月ではない）
+  double age = fmod(jd - 2451550.26, 29.530589);
+  if (age < 0) age += 29.530589;
+  *phase = age / 29.530589;
+}
+
+// Equatorial to horizontal coordinates (azimuth from north through east)
+void equatorialToHorizontal(float latitude, double hourAngle, double dec, float *azimuth, float *altitude) {
+  // 時角は0-360度に正規化してからfloatで計算する（1Hz更新で十分な精度）
+  double haNorm = fmod(hourAngle, 360.0);
+  if (haNorm < 0) haNorm += 360.0;
+  float ha = (float)haNorm * FM_DEG_TO_RAD;
+  float d = (float)dec * FM_DEG_TO_RAD;
+  float lat = latitude * FM_DEG_TO_RAD;
+  
+  float sinHa = sinf(ha), cosHa = cosf(ha);
+  float sinDec = sinf(d), cosDec = cosf(d);
+  float sinLat = sinf(lat), cosLat = cosf(lat);
+  
+  float sinAlt = sinDec * sinLat + cosDec * cosLat * cosHa;
+  sinAlt = constrain(sinAlt, -1.0f, 1.0f);
+  *altitude = asinf(sinAlt) * FM_RAD_TO_DEG;
+  
+  float az = atan2f(-cosDec * sinHa, sinDec * cosLat - cosDec * sinLat * cosHa) * FM_RAD_TO_DEG;
+  if (az < 0.0f) az += 360.0f;
+  if (az >= 360.0f) az -= 360.0f;
+  *azimuth = az;
+}
+
+// Equatorial coordinates of a body for the batch API
+static void bodyEquatorial(CelestialBody body, double jd, double *ra, double *dec) {
+  switch (body) {
+    case CELESTIAL_SUN:
+      calculateSunEquatorial(jd, ra, dec);
+      break;
+    case CELESTIAL_MOON: {
+      float phase;
+      calculateMoonEquatorial(jd, ra, dec, &phase);
+      break;
+    }
+    case CELESTIAL_POLARIS:
+    default:
+      getPoleStarPlace(POLE_STAR_POLARIS, jd, ra, dec);
+      break;
+  }
+}
+
+void calculateTrack(CelestialBody body, float latitude, float longitude,
+                    double jdStart, double stepDays, int count,
+                    float *azimuth, float *altitude) {
+  if (count <= 0) {
+    return;
+  }
+  if (stepDays < 0.0) {
+    stepDays = 0.0;
+  }
+  
+  // Terms shared by every sample
+  float sinLat, cosLat;
+  fastSinCos(latitude * FM_DEG_TO_RAD, &sinLat, &cosLat);
+  double lst0 = getSiderealTime(jdStart, longitude);
+  double lstStep = stepDays * 86400.0 * SIDEREAL_DEG_PER_SEC;
+  
+  // Pass 1: hour angle and declination of each sample (written to the output
+  // buffers: azimuth <- hour angle, altitude <- declination)
+  // 補間区間ごとにdoubleで起点を求め、区間内はfloatの加算のみ
+  // 北極星の視位置は1日で1秒角程度しか変わらないため、起点の値を通して使う
+  bool fixed = body == CELESTIAL_POLARIS;
+  double nodeJd = jdStart;
+  double raA, decA;
+  bodyEquatorial(body, nodeJd, &raA, &decA);
+  
+  int i = 0;
+  while (i < count) {
+    double nextJd = nodeJd + CELESTIAL_TRACK_NODE_DAYS;
+    double raB = raA, decB = decA;
+    int end = count;
+    if (!fixed) {
+      bodyEquatorial(body, nextJd, &raB, &decB);
+      if (raB - raA > 180.0) raB -= 360.0;
+      else if (raB - raA < -180.0) raB += 360.0;
+      
+      if (stepDays > 0.0) {
+        end = (int)ceil((nextJd - jdStart) / stepDays);
+        end = constrain(end, i + 1, count);
+      }
+    }
+    
+    // Linear terms over this interval
+    double t0 = (jdStart + i * stepDays - nodeJd) / CELESTIAL_TRACK_NODE_DAYS;
+    double tStep = stepDays / CELESTIAL_TRACK_NODE_DAYS;
+    double ha0 = fmod(lst0 + i * lstStep - (raA + (raB - raA) * t0), 360.0);
+    if (ha0 < 0.0) ha0 += 360.0;
+    float haStart = (float)ha0;
+    float haStep = (float)(lstStep - (raB - raA) * tStep);
+    float decStart = (float)(decA + (decB - decA) * t0);
+    float decStep = (float)((decB - decA) * tStep);
+    
+    for (int k = 0; i < end; i++, k++) {
+      azimuth[i] = haStart + k * haStep;
+      altitude[i] = decStart + k * decStep;
+    }
+    
+    nodeJd = nextJd;
+    raA = raB;
+    decA = decB;
+  }
+  
+  // Pass 2: horizontal coordinates (float only, no branches in the body)
+  for (int j = 0; j < count; j++) {
+    float sinHa, cosHa, sinDec, cosDec;
+    fastSinCos(azimuth[j] * FM_DEG_TO_RAD, &sinHa, &cosHa);
+    fastSinCos(altitude[j] * FM_DEG_TO_RAD, &sinDec, &cosDec);
+    
+    float sinAlt = sinDec * sinLat + cosDec * cosLat * cosHa;
+    sinAlt = fminf(fmaxf(sinAlt, -1.0f), 1.0f);
+    float az = fastAtan2Deg(-cosDec * sinHa, sinDec * cosLat - cosDec * sinLat * cosHa);
+    
+    altitude[j] = asinf(sinAlt) * FM_RAD_TO_DEG;
+    azimuth[j] = az + (az < 0.0f ? 360.0f : 0.0f);
+  }
+}
+
+// Altitude above the event horizon at one instant
+static float altitudeAboveHorizon(CelestialBody body, float latitude, float longitude,
+                                  double jd, float horizon) {
+  float azimuth, altitude;
+  calculateTrack(body, latitude, longitude, jd, 0.0, 1, &azimuth, &altitude);
+  return altitude - horizon;
+}
+
+bool findRiseSet(CelestialBody body, float latitude, float longitude,
+                 double jdStart, double spanDays, double *riseJd, double *setJd) {
+  float horizon = body == CELESTIAL_SUN  ? CELESTIAL_SUN_HORIZON :
+                  body == CELESTIAL_MOON ? CELESTIAL_MOON_HORIZON : CELESTIAL_STAR_HORIZON;
+  *riseJd = 0.0;
+  *setJd = 0.0;
+  
+  float azimuth[CELESTIAL_SEARCH_CHUNK];
+  float altitude[CELESTIAL_SEARCH_CHUNK];
+  int total = (int)ceil(spanDays / CELESTIAL_SEARCH_STEP_DAYS) + 1;
+  float previous = 0.0f;
+  
+  // 粗い刻みでまとめて高度を求め、地平線を横切る区間だけ詳しく調べる
+  for (int start = 0; start < total; start += CELESTIAL_SEARCH_CHUNK) {
+    int count = total - start < CELESTIAL_SEARCH_CHUNK ? total - start : CELESTIAL_SEARCH_CHUNK;
+    double chunkJd = jdStart + start * CELESTIAL_SEARCH_STEP_DAYS;
+    calculateTrack(body, latitude, longitude, chunkJd, CELESTIAL_SEARCH_STEP_DAYS, count,
+                   azimuth, altitude);
+    
+    for (int j = 0; j < count; j++) {
+      float current = altitude[j] - horizon;
+      if (start + j > 0 && (previous < 0.0f) != (current < 0.0f)) {
+        bool rising = current >= 0.0f;
+        double *event = rising ? riseJd : setJd;
+        if (*event == 0.0) {
+          // Regula falsi inside the bracketing step
+          double t0 = chunkJd + (j - 1) * CELESTIAL_SEARCH_STEP_DAYS;
+          double t1 = t0 + CELESTIAL_SEARCH_STEP_DAYS;
+          float f0 = previous, f1 = current;
+          double t = t0;
+          for (int n = 0; n < CELESTIAL_SEARCH_REFINE; n++) {
+            t = t0 - f0 * (t1 - t0) / (f1 - f0);
+            float f = altitudeAboveHorizon(body, latitude, longitude, t, horizon);
+            if ((f < 0.0f) == (f0 < 0.0f)) {
+              t0 = t;
+              f0 = f;
+            } else {
+              t1 = t;
+              f1 = f;
+            }
+          }
+          *event = t;
+        }
+        
+        if (*riseJd != 0.0 && *setJd != 0.0) {
+          return true;
+        }
+      }
+      previous = current;
+    }
+  }
+  
+  return *riseJd != 0.0 || *setJd != 0.0;
+}
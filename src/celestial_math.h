@@ -14,6 +14,64 @@ double getJulianDate(int year, int month, int day);
 double getJulianCentury(double jd);
 double getSiderealTime(double jd, double longitude);
 
+// Julian date for a UTC date and time
+// getJulianDate()は正午の通日を返すため、時刻は12時間ずらして加算する
+double getJulianDateTime(int year, int month, int day, int hour, int minute, double second);
+
+// Julian date from the system clock (set by TimeBase from GPS time)
+// Returns false while the clock has not been set
+// 2024年より前のシステム時刻は未設定とみなす
+#define SYSTEM_CLOCK_VALID_EPOCH 1704067200L  // 2024-01-01 00:00 UTC
+bool getSystemJulianDate(double *jd);
+
+// Sidereal rate (degrees of sidereal time per SI second)
+#define SIDEREAL_DEG_PER_SEC (360.98564736629 / 86400.0)
+
+// Building blocks for the Ephemeris service (angles in degrees)
+// 日付の解析やユリウス日の計算を含まず、事前に求めた値から位置を計算する
+// 極星（北: 北極星、南: はちぶんぎ座σ星）の方位と天の極の高度（|緯度|、大気差なし）
+// hourAngle/declination are the pole star's apparent place (pole_star_table.h)
+void calculatePolarisPosition(float latitude, double hourAngle, double declination,
+                              float *azimuth, float *altitude);
+void calculateSunEquatorial(double jd, double *ra, double *dec);
+void calculateMoonEquatorial(double jd, double *ra, double *dec, float *phase);
+void equatorialToHorizontal(float latitude, double hourAngle, double dec, float *azimuth, float *altitude);
+
+// Batch ephemeris API
+// 多数の時刻の位置をまとめて計算する（日の出入りの探索、夜間の軌跡の描画用）
+enum CelestialBody {
+  CELESTIAL_SUN,
+  CELESTIAL_MOON,
+  CELESTIAL_POLARIS
+};
+
+// 赤経赤緯はこの間隔で計算し、その間は線形補間する（月で誤差0.01度未満）
+#define CELESTIAL_TRACK_NODE_DAYS   (1.0 / 24.0)
+
+// Rise/set search
+#define CELESTIAL_SEARCH_STEP_DAYS  (10.0 / 1440.0)  // 粗い探索の刻み（10分）
+#define CELESTIAL_SEARCH_CHUNK      36               // calculateTrack()1回あたりのサンプル数
+#define CELESTIAL_SEARCH_REFINE     3                // 符号が変わった区間の割線法の反復回数
+
+// Altitude of the body's center at rise/set (degrees)
+#define CELESTIAL_SUN_HORIZON      -0.833f  // 大気差 + 視半径
+#define CELESTIAL_MOON_HORIZON      0.125f  // 視差 - 大気差 - 視半径
+#define CELESTIAL_STAR_HORIZON     -0.567f  // 大気差のみ
+
+// Altitude/azimuth of a body at jdStart + i * stepDays (i = 0 .. count-1, stepDays >= 0)
+// Fills struct-of-arrays output buffers (azimuth and altitude, count entries each).
+// 日付の解析は行わず、赤経赤緯と恒星時はまとめて計算し、
+// サンプルごとのループはfloatのみ・分岐なしで回す
+void calculateTrack(CelestialBody body, float latitude, float longitude,
+                    double jdStart, double stepDays, int count,
+                    float *azimuth, float *altitude);
+
+// Next rise and set within spanDays of jdStart
+// riseJd/setJd are 0 when the event does not occur in the span
+// (circumpolar or never rising). Returns true if either event was found.
+bool findRiseSet(CelestialBody body, float latitude, float longitude,
+                 double jdStart, double spanDays, double *riseJd, double *setJd);
+
 // Celestial pole calculations
 void calculatePolePosition(float latitude, float longitude, float *azimuth, float *altitude);
 
@@ -29,11 +87,12 @@ void calculateMoonPosition(float latitude, float longitude,
                            int hour, int minute, int second,
                            float *azimuth, float *altitude, float *phase);
 
-// Sunrise and sunset calculations
+// Sunrise and sunset calculations (UTC date and times)
+// 該当する現象がない日は時を-1にする
 void calculateSunriseSunset(float latitude, float longitude, int year, int month, int day,
                            int* sunriseHour, int* sunriseMinute, int* sunsetHour, int* sunsetMinute);
 
-// Moonrise and moonset calculations
+// Moonrise and moonset calculations (UTC date and times)
 void calculateMoonriseMoonset(float latitude, float longitude, int year, int month, int day,
                              int* moonriseHour, int* moonriseMinute, int* moonsetHour, int* moonsetMinute);
 
@@ -41,6 +100,7 @@ void calculateMoonriseMoonset(float latitude, float longitude, int year, int mon
 float calculateMoonPhase(int year, int month, int day);
 
 // Utility functions
+// 偏角はWorld Magnetic Modelの格子から求める（伏角・全磁力はmagnetic_model.h）
 float calculateMagneticDeclination(float latitude, float longitude);
 void applyMagneticDeclination(float *heading, float declination);
 
@@ -0,0 +1,128 @@
+/*
+ * fast_math.cpp
+ * 
+ * Implementation of the single-precision math helpers
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "fast_math.h"
+#include <math.h>
+#include <string.h>
+
+#if FM_USE_SIN_TABLE
+// Sine table with one extra entry so interpolation never wraps
+static float sinTable[FM_SIN_TABLE_SIZE + 1];
+
+static bool buildSinTable() {
+  for (int i = 0; i <= FM_SIN_TABLE_SIZE; i++) {
+    sinTable[i] = sinf(i * (FM_TWO_PI / FM_SIN_TABLE_SIZE));
+  }
+  return true;
+}
+
+// タスクが起動する前（静的初期化時）にテーブルを作成する
+static const bool sinTableReady = buildSinTable();
+
+// Sine of an angle given in table steps (any sign or magnitude)
+static inline float tableSin(float steps) {
+  // 1周期に正規化（FM_SIN_TABLE_SIZEは2のべき乗）
+  float whole = floorf(steps);
+  float fraction = steps - whole;
+  int index = (int)whole & (FM_SIN_TABLE_SIZE - 1);
+  return sinTable[index] + (sinTable[index + 1] - sinTable[index]) * fraction;
+}
+#endif
+
+float fastAtan2(float y, float x) {
+  float absX = fabsf(x);
+  float absY = fabsf(y);
+  
+  if (absX == 0.0f && absY == 0.0f) {
+    return 0.0f;
+  }
+  
+  // 0〜1の範囲で多項式近似し、象限を戻す
+  bool swap = absY > absX;
+  float z = swap ? absX / absY : absY / absX;
+  float z2 = z * z;
+  float angle = z * (0.99997726f + z2 * (-0.33262347f + z2 * (0.19354346f +
+                z2 * (-0.11643287f + z2 * (0.05265332f + z2 * -0.01172120f)))));
+  
+  if (swap) angle = FM_HALF_PI - angle;
+  if (x < 0.0f) angle = FM_PI - angle;
+  if (y < 0.0f) angle = -angle;
+  
+  return angle;
+}
+
+float fastInvSqrt(float x) {
+  // Initial guess from the exponent bits, then two Newton iterations
+  float half = 0.5f * x;
+  uint32_t bits;
+  memcpy(&bits, &x, sizeof(bits));
+  bits = 0x5f375a86u - (bits >> 1);
+  float y;
+  memcpy(&y, &bits, sizeof(y));
+  
+  y = y * (1.5f - half * y * y);
+  y = y * (1.5f - half * y * y);
+  return y;
+}
+
+void fastSinCos(float radians, float *sinValue, float *cosValue) {
+#if FM_USE_SIN_TABLE
+  (void)sinTableReady;
+  float steps = radians * (FM_SIN_TABLE_SIZE / FM_TWO_PI);
+  *sinValue = tableSin(steps);
+  *cosValue = tableSin(steps + FM_SIN_TABLE_SIZE / 4);
+#else
+  *sinValue = sinf(radians);
+  *cosValue = cosf(radians);
+#endif
+}
+
+bool fastMathSelfTest(float *maxAtan2Error, float *maxInvSqrtError, float *maxSinCosError) {
+  float atan2Error = 0.0f;
+  float invSqrtError = 0.0f;
+  float sinCosError = 0.0f;
+  
+  // atan2: a full circle at several radii
+  for (int i = 0; i < 3600; i++) {
+    float angle = -FM_PI + i * (FM_TWO_PI / 3600);
+    for (float radius = 0.01f; radius < 200.0f; radius *= 10.0f) {
+      float y = radius * sinf(angle);
+      float x = radius * cosf(angle);
+      float error = fabsf(fastAtan2(y, x) - atan2f(y, x));
+      
+      // -PIと+PIの境界は同じ角度
+      if (error > FM_PI) error = FM_TWO_PI - error;
+      if (error > atan2Error) atan2Error = error;
+    }
+  }
+  
+  // invsqrt: relative error from 1e-4 to 1e4
+  for (float x = 1.0e-4f; x < 1.0e4f; x *= 1.01f) {
+    float exact = 1.0f / sqrtf(x);
+    float error = fabsf(fastInvSqrt(x) - exact) / exact;
+    if (error > invSqrtError) invSqrtError = error;
+  }
+  
+  // sincos: several turns in both directions
+  for (int i = -7200; i <= 7200; i++) {
+    float angle = i * (FM_PI / 1800);
+    float s, c;
+    fastSinCos(angle, &s, &c);
+    float error = fmaxf(fabsf(s - sinf(angle)), fabsf(c - cosf(angle)));
+    if (error > sinCosError) sinCosError = error;
+  }
+  
+  if (maxAtan2Error) *maxAtan2Error = atan2Error;
+  if (maxInvSqrtError) *maxInvSqrtError = invSqrtError;
+  if (maxSinCosError) *maxSinCosError = sinCosError;
+  
+  return atan2Error < FM_ATAN2_MAX_ERROR &&
+         invSqrtError < FM_INVSQRT_MAX_ERROR &&
+         sinCosError < FM_SINCOS_MAX_ERROR;
+}
@@ -0,0 +1,68 @@
+/*
+ * fast_math.h
+ * 
+ * Single-precision math helpers for the heading path
+ * The ESP32-S3 FPU only supports float, so every double operation is
+ * emulated in software. These helpers stay in float and trade a small,
+ * bounded error for speed.
+ * 
+ * 誤差の上限（fastMathSelfTest()でlibmと比較、tools/host/polaris_host benchで確認）:
+ * - fastAtan2:   1.0e-5 rad 未満（約0.0006度）
+ * - fastInvSqrt: 相対誤差 1.0e-5 未満（ニュートン法2回）
+ * - fastSinCos:  2.0e-5 未満（512分割テーブル＋線形補間）
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef FAST_MATH_H
+#define FAST_MATH_H
+
+#include <stdint.h>
+
+// Float constants (Arduino's PI/RAD_TO_DEG are double)
+#define FM_PI          3.14159265f
+#define FM_TWO_PI      6.28318531f
+#define FM_HALF_PI     1.57079633f
+#define FM_RAD_TO_DEG  57.2957795f
+#define FM_DEG_TO_RAD  0.0174532925f
+
+// Sine table resolution (entries per full turn, power of two)
+#define FM_SIN_TABLE_SIZE 512
+
+// Error bounds checked by fastMathSelfTest()
+#define FM_ATAN2_MAX_ERROR    1.0e-5f
+#define FM_INVSQRT_MAX_ERROR  1.0e-5f
+#define FM_SINCOS_MAX_ERROR   2.0e-5f
+
+// Use the lookup table for fastSinCos (0 = call sinf/cosf)
+#ifndef FM_USE_SIN_TABLE
+#define FM_USE_SIN_TABLE 1
+#endif
+
+// atan2 in radians (-PI to PI), polynomial approximation
+float fastAtan2(float y, float x);
+
+// atan2 in degrees (-180 to 180)
+inline float fastAtan2Deg(float y, float x) {
+  return fastAtan2(y, x) * FM_RAD_TO_DEG;
+}
+
+// 1/sqrt(x) for x > 0
+float fastInvSqrt(float x);
+
+// sqrt(x) for x >= 0
+inline float fastSqrt(float x) {
+  return x > 0.0f ? x * fastInvSqrt(x) : 0.0f;
+}
+
+// Sine and cosine of an angle in radians
+void fastSinCos(float radians, float *sinValue, float *cosValue);
+
+// Compare the approximations against libm over their input ranges
+// Returns true when every function is within its documented error bound
+bool fastMathSelfTest(float *maxAtan2Error = nullptr,
+                      float *maxInvSqrtError = nullptr,
+                      float *maxSinCosError = nullptr);
+
+#endif // FAST_MATH_H
@@ -0,0 +1,70 @@
+/*
+ * hal.h
+ * 
+ * Thin platform layer for the Polaris Navigator math modules
+ * On the device this is just Arduino.h and esp_timer; on a native (host)
+ * build it supplies the few Arduino/ESP-IDF pieces the math code uses
+ * 
+ * 姿勢推定・較正・天体計算のモジュールはArduino.hの代わりにこのヘッダーを使う。
+ * ホスト側（tools/host）では時計を仮想時計にして、記録したセッションを
+ * 決定的に再生できるようにする。ホストビルドはシングルスレッドのため、
+ * クリティカルセクションは何もしない。
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef HAL_H
+#define HAL_H
+
+#ifdef ARDUINO
+
+#include <Arduino.h>
+#include <esp_timer.h>
+
+#else  // Host build
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <algorithm>
+
+// Arduino constants and helpers
+#define PI         3.1415926535897932384626433832795
+#define HALF_PI    1.5707963267948966192313216916398
+#define TWO_PI     6.283185307179586476925286766559
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+#define RAD_TO_DEG 57.295779513082320876798154814105
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+using std::min;
+using std::max;
+
+#define IRAM_ATTR
+#define INPUT  0x01
+#define RISING 0x01
+
+// Virtual clock (advanced by the replay, see tools/host/hal_host.cpp)
+unsigned long millis();
+unsigned long micros();
+int64_t esp_timer_get_time();
+void halHostSetTimeUs(int64_t timeUs);
+
+// GPIO (no pins on the host)
+inline void pinMode(int, int) {}
+inline int digitalPinToInterrupt(int pin) { return pin; }
+inline void attachInterruptArg(int, void (*)(void*), void*, int) {}
+
+// FreeRTOS critical sections
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED 0
+#define portENTER_CRITICAL(mux)     ((void)(mux))
+#define portEXIT_CRITICAL(mux)      ((void)(mux))
+#define portENTER_CRITICAL_ISR(mux) ((void)(mux))
+#define portEXIT_CRITICAL_ISR(mux)  ((void)(mux))
+
+#endif // ARDUINO
+
+#endif // HAL_H
@@ -0,0 +1,898 @@
+/*
+ * logo_data.h
+ * 
+ * Generated by tools/gen_logo.py from tools/assets/icon.h - do not edit
+ * Startup logo, RGB565 coded for ImageDecoder (QOI-style, 13997 bytes for 128x110)
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef LOGO_DATA_H
+#define LOGO_DATA_H
+
+#include <Arduino.h>
+
+#define LOGO_WIDTH  128
+#define LOGO_HEIGHT 110
+
+// const配列はESP32ではフラッシュ（rodata）に配置される
+static const uint8_t LOGO_DATA[13997] PROGMEM = {
+  0xA5, 0x7A, 0xED, 0x6E, 0x6B, 0x7E, 0x3D, 0x52, 0x61, 0x61, 0x69, 0xA2, 0x77, 0xA3, 0xA7, 0xA5,
+  0x97, 0xA5, 0x97, 0xA3, 0x98, 0xA3, 0x97, 0xA3, 0xA8, 0xA3, 0x87, 0x6B, 0xC0, 0x1D, 0x56, 0x9D,
+  0x8A, 0x9D, 0x89, 0x9C, 0x89, 0x9B, 0x8B, 0x9B, 0x7A, 0x11, 0x07, 0x0E, 0x1F, 0xA2, 0x88, 0x04,
+  0x0C, 0x04, 0x38, 0xEE, 0xA2, 0x78, 0xC4, 0x04, 0x09, 0x04, 0x09, 0x04, 0xC0, 0x09, 0xC5, 0x04,
+  0x09, 0xC5, 0x6B, 0x09, 0xC0, 0x10, 0xC6, 0x09, 0x10, 0xC2, 0x09, 0x10, 0x7E, 0xC0, 0x04, 0x9D,
+  0x99, 0x60, 0x6E, 0xA5, 0x96, 0x3B, 0x00, 0xA9, 0xA5, 0xA7, 0xA7, 0xA4, 0x96, 0xA2, 0x98, 0xA2,
+  0x87, 0xA4, 0x67, 0xC1, 0x62, 0x65, 0xC0, 0xA2, 0x78, 0x22, 0x1D, 0x22, 0x0C, 0x52, 0x42, 0x06,
+  0x98, 0x7A, 0x2C, 0x97, 0x7C, 0x35, 0x9C, 0x7A, 0x1F, 0x30, 0x10, 0x7E, 0xC0, 0x10, 0xC6, 0x09,
+  0xC0, 0x10, 0x09, 0x10, 0x09, 0xC2, 0x10, 0x09, 0xC0, 0x10, 0x09, 0xC0, 0x10, 0x09, 0xC1, 0x04,
+  0xC1, 0x09, 0x04, 0xC2, 0x09, 0x04, 0xC3, 0x09, 0x04, 0xC1, 0x09, 0xC2, 0x04, 0x09, 0xE3, 0x18,
+  0xC0, 0x04, 0x1F, 0x13, 0x29, 0x3B, 0xAB, 0xB5, 0xAB, 0xA5, 0xA8, 0x96, 0xA4, 0x87, 0xC0, 0x07,
+  0x9D, 0x99, 0xA2, 0x88, 0xC0, 0x9C, 0x89, 0xFE, 0xB2, 0x65, 0x7E, 0xA4, 0x76, 0x21, 0x02, 0x3F,
+  0x8B, 0xDF, 0x96, 0xAC, 0xA2, 0x87, 0x56, 0x21, 0x07, 0x02, 0x9D, 0x99, 0x02, 0xA2, 0x77, 0xC0,
+  0x9B, 0x8A, 0x98, 0x6B, 0x95, 0x7B, 0x94, 0x6C, 0x97, 0x7C, 0x13, 0xA2, 0x79, 0x10, 0x7E, 0x10,
+  0x09, 0xD7, 0xA2, 0x98, 0x09, 0x66, 0xC1, 0x09, 0xC0, 0x04, 0xC0, 0x09, 0x04, 0xC5, 0x09, 0xC7,
+  0x10, 0x09, 0xC7, 0x04, 0x10, 0xC1, 0x09, 0x10, 0xCB, 0x09, 0xC0, 0x10, 0x18, 0x66, 0x30, 0x9D,
+  0xA8, 0xA4, 0x85, 0xAC, 0xB4, 0xAF, 0xA4, 0x23, 0xA6, 0x87, 0xC0, 0x02, 0x29, 0x9C, 0x99, 0x41,
+  0x66, 0x98, 0x8A, 0xAB, 0x76, 0x07, 0x2E, 0x90, 0xBE, 0x8C, 0xCF, 0x99, 0xBB, 0xA9, 0x65, 0x21,
+  0x07, 0x98, 0x9B, 0xFE, 0xA9, 0xC4, 0x94, 0xBC, 0xFE, 0xD3, 0xC6, 0x3A, 0x02, 0x9B, 0x8A, 0x95,
+  0xAA, 0xA7, 0x97, 0x6E, 0xA2, 0x88, 0x29, 0x07, 0x18, 0x66, 0x99, 0x7A, 0x93, 0x6C, 0x91, 0x7E,
+  0x96, 0x6B, 0x9E, 0x8B, 0xA4, 0x78, 0xA3, 0x88, 0xC0, 0x56, 0x69, 0x10, 0xC4, 0x04, 0x09, 0xC4,
+  0x10, 0xC0, 0x09, 0xC2, 0x04, 0x18, 0xFE, 0x9C, 0xB2, 0x20, 0x04, 0x09, 0xC5, 0x04, 0x09, 0xC4,
+  0x10, 0xC2, 0x09, 0x10, 0xC2, 0x18, 0x10, 0xC5, 0x09, 0x7B, 0x20, 0x09, 0x10, 0xCF, 0x18, 0x09,
+  0x9B, 0xA9, 0x11, 0xA9, 0xB5, 0xB2, 0xA2, 0x23, 0xA6, 0x87, 0x0C, 0x9C, 0xA9, 0x9D, 0x89, 0x52,
+  0x3C, 0xC0, 0x37, 0xC0, 0x3C, 0x3A, 0xA7, 0x88, 0x02, 0x56, 0xA6, 0x66, 0xFE, 0xB2, 0x44, 0x92,
+  0xCD, 0xC0, 0x03, 0xFE, 0xED, 0x28, 0xAB, 0x55, 0xFE, 0xC2, 0xC5, 0x8D, 0xCF, 0xFE, 0xED, 0x68,
+  0x07, 0x02, 0x9A, 0x89, 0x98, 0x9A, 0x0B, 0x69, 0x0B, 0xC1, 0x6E, 0xA2, 0x88, 0x02, 0x18, 0x0C,
+  0x97, 0x7C, 0x90, 0x5C, 0x90, 0x6E, 0x9A, 0x7B, 0xA3, 0x79, 0xA4, 0x88, 0xC0, 0x56, 0xC3, 0x09,
+  0xA3, 0x99, 0x18, 0x09, 0x10, 0xCA, 0x20, 0x09, 0xC1, 0x10, 0xC0, 0x09, 0xC2, 0x18, 0x66, 0x09,
+  0xC1, 0x10, 0x09, 0x10, 0xC6, 0x65, 0x30, 0x10, 0xC5, 0x04, 0x2C, 0xAA, 0x97, 0x92, 0x69, 0xA2,
+  0x88, 0x10, 0xCC, 0x18, 0xC0, 0x9B, 0x98, 0x11, 0xAE, 0xB3, 0xB4, 0xB2, 0x07, 0x6E, 0x9D, 0xA9,
+  0x9C, 0x89, 0x66, 0x0B, 0x10, 0x0B, 0xC1, 0x3C, 0x37, 0x3C, 0x98, 0x8A, 0xA6, 0x77, 0x02, 0x52,
+  0x02, 0xFE, 0xB1, 0xE4, 0x96, 0xAB, 0xA2, 0x78, 0x9C, 0x99, 0xA6, 0x76, 0xFE, 0xF5, 0xA9, 0x8B,
+  0xDF, 0x13, 0xFE, 0xED, 0x08, 0x02, 0xC0, 0x0D, 0x0E, 0x0B, 0xC0, 0x10, 0xC1, 0x15, 0xC0, 0x10,
+  0x15, 0x7F, 0x02, 0xA3, 0x78, 0x9C, 0x89, 0x92, 0x5C, 0x8D, 0x6E, 0x11, 0x2B, 0xA5, 0x88, 0xC0,
+  0x56, 0xC0, 0x18, 0x9D, 0x89, 0xFE, 0x84, 0x30, 0x8E, 0x7A, 0x3C, 0xA3, 0x88, 0x10, 0xC9, 0x09,
+  0x10, 0xC5, 0x18, 0x30, 0xB2, 0x97, 0x9C, 0x88, 0x3C, 0xA2, 0x98, 0x10, 0xC8, 0x01, 0xA7, 0xA8,
+  0xAF, 0xA7, 0x01, 0xA2, 0x98, 0x10, 0xC5, 0x09, 0x10, 0xC3, 0x15, 0x18, 0x10, 0xC5, 0x15, 0x18,
+  0x30, 0x9D, 0xA7, 0xAE, 0xA3, 0x32, 0xAB, 0xA5, 0x07, 0x9C, 0x99, 0x9D, 0x99, 0xC1, 0x6E, 0xC0,
+  0x10, 0xC0, 0x0B, 0x59, 0x66, 0xC0, 0x0B, 0x0E, 0x2C, 0x02, 0x51, 0x07, 0x21, 0x6E, 0xB1, 0x53,
+  0xFE, 0x90, 0x62, 0xC0, 0x21, 0xA5, 0x77, 0x91, 0xCD, 0x17, 0x02, 0xC0, 0x99, 0x9A, 0x9A, 0x89,
+  0x10, 0x0B, 0xC0, 0x10, 0xC0, 0x15, 0xC5, 0xA3, 0x98, 0x0C, 0x07, 0x94, 0x5C, 0x8B, 0x5F, 0x93,
+  0x7D, 0x30, 0xA4, 0x88, 0x5A, 0x66, 0xC0, 0x18, 0x10, 0xD6, 0x7A, 0x10, 0xC7, 0x15, 0x10, 0xC0,
+  0x15, 0x09, 0xA4, 0x88, 0x38, 0x94, 0x79, 0x15, 0x10, 0xC5, 0x15, 0x10, 0x15, 0x10, 0xC0, 0x15,
+  0x10, 0x51, 0x15, 0x10, 0xC0, 0x15, 0x10, 0x15, 0x7E, 0x04, 0x0C, 0x1A, 0xB7, 0xC1, 0xAE, 0xA4,
+  0x07, 0x24, 0x55, 0x66, 0x15, 0xC2, 0x10, 0xC4, 0x61, 0x52, 0x2D, 0xA7, 0x87, 0x02, 0x2E, 0x02,
+  0x21, 0x61, 0xFE, 0xFE, 0x49, 0xFE, 0xCB, 0x86, 0xFE, 0x90, 0x62, 0xA2, 0x87, 0xC0, 0x6E, 0x17,
+  0xA5, 0x87, 0x02, 0x99, 0x8A, 0x96, 0xAA, 0x3F, 0xA2, 0x78, 0x7E, 0xC0, 0x15, 0xC2, 0x18, 0xC0,
+  0x6E, 0x15, 0xC1, 0x29, 0x07, 0x0C, 0x92, 0x6C, 0xFE, 0x31, 0x62, 0x96, 0x7D, 0x04, 0xA3, 0x88,
+  0x56, 0x66, 0xC1, 0x15, 0xC3, 0x10, 0xC0, 0x15, 0x10, 0xC4, 0x15, 0x10, 0xC0, 0x15, 0x10, 0xC9,
+  0x15, 0xC6, 0x10, 0x3C, 0x15, 0xCB, 0x7A, 0x41, 0xA8, 0xA8, 0xB6, 0x95, 0x09, 0x15, 0xC0, 0x10,
+  0x18, 0xC0, 0x9A, 0x98, 0xA3, 0xA5, 0xB8, 0xB0, 0x07, 0xC0, 0x9C, 0x99, 0x51, 0xC6, 0x7A, 0x6E,
+  0x18, 0x9C, 0x89, 0x9A, 0x7A, 0x98, 0x7A, 0x99, 0x7B, 0x9B, 0x6A, 0x99, 0x6B, 0xFE, 0x9B, 0x85,
+  0x07, 0x29, 0xA7, 0x66, 0xFE, 0xB1, 0xE4, 0x56, 0xFE, 0xFE, 0x29, 0x0C, 0x8C, 0xCF, 0xFE, 0x90,
+  0x82, 0x25, 0x6F, 0xFE, 0xED, 0x08, 0x3A, 0x07, 0x8F, 0x6E, 0x87, 0x6F, 0xA7, 0xA6, 0xA6, 0xA6,
+  0xA8, 0xA6, 0xA7, 0x96, 0x3F, 0xA3, 0x88, 0x24, 0xC0, 0x55, 0xC1, 0x7E, 0xC0, 0x18, 0x15, 0xC0,
+  0x24, 0x07, 0xC0, 0x8D, 0x5E, 0xFE, 0x18, 0xA1, 0x1F, 0xA6, 0x78, 0xC0, 0x10, 0x6E, 0xD2, 0x10,
+  0x15, 0xC1, 0x10, 0xC0, 0x15, 0xCB, 0x18, 0x15, 0xCC, 0x10, 0xA3, 0x98, 0x38, 0x10, 0x15, 0xC0,
+  0x7E, 0x04, 0x9B, 0xA7, 0xB0, 0xA2, 0xFE, 0xE5, 0x68, 0xA5, 0x97, 0x9B, 0xAA, 0x51, 0xC1, 0x7A,
+  0x15, 0xC2, 0x24, 0x18, 0x32, 0x98, 0x6A, 0x95, 0x6C, 0x98, 0x6B, 0x9B, 0x6B, 0x42, 0x5B, 0xA3,
+  0x78, 0x9B, 0xB9, 0xFE, 0x83, 0x05, 0xB7, 0xC1, 0x9B, 0x9A, 0x8C, 0xCF, 0x8E, 0xCE, 0xC0, 0xB0,
+  0x53, 0x21, 0x07, 0x8C, 0xBF, 0xFE, 0x90, 0x42, 0xA3, 0x77, 0x17, 0xA4, 0x76, 0x07, 0x0B, 0xFE,
+  0x00, 0x02, 0xA4, 0x67, 0x61, 0x7D, 0xA2, 0xB7, 0xA6, 0xA5, 0xA9, 0xB6, 0xAA, 0x94, 0xA8, 0x96,
+  0xA4, 0x87, 0x6F, 0x66, 0x15, 0xC0, 0x1D, 0xC1, 0x15, 0xC0, 0x29, 0xA5, 0x77, 0x9A, 0x7A, 0x03,
+  0x90, 0x6E, 0x04, 0xA3, 0x88, 0x56, 0xD2, 0x7A, 0xC0, 0x15, 0xD8, 0x18, 0x15, 0xC4, 0x10, 0x51,
+  0x15, 0xC0, 0x7F, 0x2B, 0xA1, 0xA5, 0xFE, 0x9B, 0xA5, 0x0C, 0x36, 0x9C, 0x89, 0xC5, 0x7E, 0xC0,
+  0x9D, 0x9A, 0x06, 0x94, 0x6B, 0x96, 0x4C, 0x9A, 0x6B, 0x47, 0x30, 0x04, 0xA2, 0x78, 0x7E, 0x6F,
+  0x99, 0xA8, 0xAF, 0xD1, 0xFE, 0xFE, 0x49, 0x3D, 0x92, 0xBC, 0x66, 0x16, 0x6F, 0xAF, 0x53, 0xC0,
+  0xA2, 0x77, 0x96, 0xCC, 0xC0, 0x07, 0xC0, 0x0C, 0xFE, 0x49, 0xC2, 0x30, 0x29, 0x1D, 0x56, 0x04,
+  0x24, 0x18, 0xA2, 0xA6, 0xA5, 0xB6, 0x2C, 0xAD, 0xA4, 0xA8, 0x96, 0xA2, 0x78, 0x66, 0x55, 0xC0,
+  0x7E, 0xC0, 0x18, 0x15, 0x6B, 0x36, 0xA3, 0x78, 0x8D, 0x6F, 0x21, 0x9F, 0x7B, 0xA6, 0x78, 0x56,
+  0xC4, 0x10, 0x15, 0xCA, 0x3C, 0xC0, 0xA3, 0x98, 0x15, 0xD7, 0x51, 0x15, 0xC5, 0x18, 0x15, 0x18,
+  0x99, 0xA8, 0x1A, 0xFE, 0xD5, 0x07, 0x0C, 0x9A, 0xAA, 0x55, 0xC4, 0x24, 0x69, 0x9C, 0x89, 0x2A,
+  0x92, 0x5D, 0x96, 0x4C, 0x9E, 0x6A, 0xA3, 0x79, 0xA3, 0x89, 0x7F, 0xC1, 0x15, 0xC2, 0x19, 0xFE,
+  0x93, 0x65, 0xA9, 0x96, 0x6E, 0x7E, 0x2A, 0x56, 0x9B, 0x9A, 0x34, 0xC0, 0x6E, 0x56, 0x9C, 0x99,
+  0x6E, 0x03, 0x94, 0x5E, 0x24, 0xC0, 0x59, 0x76, 0x24, 0xC0, 0x69, 0x51, 0x30, 0x60, 0xA3, 0xB6,
+  0x38, 0xAE, 0xB3, 0x0B, 0x29, 0x66, 0x55, 0x7A, 0x6E, 0xC0, 0x15, 0xC0, 0x29, 0x0C, 0x07, 0xFE,
+  0x39, 0x62, 0x96, 0x6D, 0xA7, 0x79, 0xC0, 0x5A, 0xC0, 0x10, 0xA3, 0x98, 0xAC, 0x97, 0x10, 0x15,
+  0xC7, 0x18, 0x9D, 0x89, 0xB6, 0xA6, 0x51, 0x8C, 0x6A, 0x18, 0x15, 0xCF, 0x04, 0xAA, 0x58, 0x65,
+  0x04, 0x15, 0xC0, 0x7E, 0xA9, 0x98, 0x18, 0x15, 0xC4, 0x1D, 0x15, 0x98, 0xB7, 0xB3, 0xB1, 0xFE,
+  0xF5, 0xC9, 0x02, 0x9B, 0x99, 0xC5, 0x7E, 0x9D, 0x99, 0x95, 0x8C, 0x91, 0x4E, 0x96, 0x4C, 0x4B,
+  0xA3, 0x8A, 0xA3, 0x89, 0x41, 0x7E, 0xC3, 0x6F, 0xC0, 0x24, 0x09, 0x9A, 0xA7, 0xC0, 0x65, 0xCA,
+  0xA4, 0x79, 0x6E, 0x6F, 0x09, 0x15, 0x24, 0xC0, 0x21, 0x79, 0x24, 0x1D, 0x04, 0x9D, 0x98, 0x1C,
+  0xA9, 0xD4, 0x2A, 0xAC, 0x95, 0xA2, 0x88, 0x69, 0x56, 0xC0, 0x7A, 0xC0, 0x15, 0xC0, 0xA5, 0x87,
+  0x3F, 0xFE, 0x6A, 0x84, 0x0C, 0xA6, 0x6A, 0xA2, 0x88, 0x55, 0xC0, 0x7A, 0xA2, 0x88, 0x15, 0xC8,
+  0x18, 0x01, 0xAF, 0xB8, 0x55, 0x01, 0x18, 0x15, 0xCE, 0x24, 0x9C, 0x97, 0xB5, 0x39, 0xC0, 0x8B,
+  0xE9, 0xA4, 0x77, 0x15, 0x24, 0xAC, 0x96, 0x15, 0xC4, 0x24, 0x04, 0x9B, 0xA7, 0xFE, 0x8B, 0x65,
+  0xB5, 0xC2, 0x9C, 0xA9, 0x9D, 0x89, 0x66, 0x15, 0xC0, 0x10, 0x15, 0x7A, 0x10, 0x97, 0x8A, 0x90,
+  0x5E, 0x95, 0x4D, 0x9F, 0x6B, 0x09, 0xA2, 0x89, 0xC0, 0x55, 0xAF, 0xA7, 0x2C, 0x15, 0x6E, 0x21,
+  0x24, 0x15, 0x04, 0x60, 0x65, 0x19, 0xC0, 0x1C, 0x6E, 0x7F, 0x6E, 0x7A, 0xC0, 0x6E, 0xC0, 0x7A,
+  0x3D, 0xC1, 0x30, 0x65, 0x1C, 0x19, 0xC0, 0x6F, 0xA2, 0x79, 0xA2, 0x89, 0x6F, 0x5A, 0x79, 0x15,
+  0x21, 0x15, 0x9B, 0xA8, 0x1C, 0xAC, 0xD3, 0x06, 0xAA, 0x85, 0x7F, 0x15, 0xC0, 0x7A, 0xC0, 0x15,
+  0xC0, 0x29, 0x0C, 0x8C, 0x5E, 0xFE, 0x00, 0x21, 0x04, 0xA3, 0x89, 0x55, 0xCC, 0x1D, 0x01, 0xC0,
+  0x1D, 0x15, 0xCF, 0x24, 0x9C, 0x98, 0xBD, 0x09, 0x7E, 0x04, 0x24, 0x15, 0xC0, 0x01, 0x15, 0xC3,
+  0x24, 0x04, 0x19, 0xFE, 0xAC, 0x26, 0xAF, 0xB4, 0x29, 0x10, 0xC1, 0x6E, 0x10, 0x15, 0x18, 0x9B,
+  0x8A, 0x90, 0x6C, 0x91, 0x3F, 0x9E, 0x5A, 0x09, 0x24, 0xC0, 0x1A, 0x7A, 0x56, 0xAA, 0x97, 0x98,
+  0x79, 0x21, 0x24, 0x04, 0x9E, 0x96, 0x14, 0xC0, 0xA2, 0x97, 0x38, 0xA2, 0x88, 0x7E, 0x7F, 0x6E,
+  0x7A, 0xCA, 0x28, 0x23, 0x0C, 0x30, 0x1C, 0x56, 0xA2, 0x79, 0xA4, 0x78, 0x0D, 0xAD, 0xA7, 0xC0,
+  0x0D, 0x29, 0x9D, 0x98, 0x9B, 0xA8, 0xA3, 0xC6, 0xAF, 0xD3, 0xAF, 0xB4, 0xA7, 0x86, 0xC0, 0x56,
+  0x7A, 0x15, 0xC1, 0x7F, 0xA6, 0x66, 0x92, 0x6C, 0x1C, 0xA2, 0x5A, 0xA4, 0x89, 0x55, 0xCC, 0x7E,
+  0xC0, 0x15, 0xCD, 0x1A, 0x24, 0xC0, 0x15, 0xC0, 0xFE, 0x4D, 0x37, 0x6F, 0x24, 0x55, 0x24, 0xC1,
+  0x15, 0x1A, 0x15, 0xC0, 0x29, 0x9B, 0xA8, 0x9F, 0xA6, 0xFE, 0xC4, 0xA7, 0x0C, 0x9A, 0x9A, 0x10,
+  0xC3, 0x6E, 0x10, 0x95, 0x8B, 0x8E, 0x3E, 0x97, 0x4D, 0x04, 0x29, 0x24, 0x1A, 0xC0, 0x6B, 0xC0,
+  0x1D, 0x0D, 0x7E, 0x3D, 0x9D, 0xA7, 0x65, 0x30, 0xA3, 0x98, 0x23, 0x2B, 0xC2, 0x28, 0xC5, 0x23,
+  0xC0, 0x28, 0xC5, 0x2B, 0xC0, 0x28, 0x0C, 0x9C, 0x88, 0x0D, 0x20, 0xA6, 0x79, 0xA2, 0x79, 0x21,
+  0x1A, 0x7B, 0xC0, 0x3D, 0x11, 0xA9, 0xE4, 0x32, 0x10, 0xA2, 0x88, 0x55, 0xC2, 0x10, 0x15, 0xA6,
+  0x77, 0x97, 0x7B, 0xFE, 0x18, 0xA1, 0x35, 0xA5, 0x89, 0x51, 0xC0, 0x1A, 0xC0, 0x15, 0xCC, 0x1A,
+  0x15, 0xC2, 0x21, 0x1A, 0xC3, 0x15, 0x66, 0x04, 0xC0, 0x3F, 0xAF, 0x48, 0xB9, 0x29, 0xC0, 0x88,
+  0xE8, 0x90, 0xD7, 0x6F, 0x6E, 0x15, 0x1A, 0xC0, 0x15, 0x29, 0x04, 0x9E, 0xA5, 0x3A, 0x07, 0x9A,
+  0x99, 0x66, 0xC3, 0x18, 0x9C, 0x89, 0x90, 0x5D, 0x90, 0x3E, 0x9E, 0x5B, 0x1D, 0x29, 0x56, 0xC0,
+  0x7A, 0x21, 0x1A, 0x24, 0xC0, 0x60, 0x19, 0x0D, 0xA4, 0x98, 0x23, 0x2B, 0xC0, 0x28, 0xD6, 0x2B,
+  0xC0, 0x41, 0x30, 0x9C, 0x78, 0xA2, 0x89, 0xA5, 0x7A, 0x21, 0xC0, 0x1A, 0x29, 0x1D, 0x9A, 0x98,
+  0x2C, 0xB1, 0xE2, 0x37, 0xA5, 0x88, 0x15, 0xC2, 0x10, 0x15, 0x07, 0x97, 0x8B, 0xFE, 0x18, 0xA1,
+  0x3F, 0xA5, 0x78, 0x51, 0x1A, 0xC2, 0x15, 0x7F, 0xC0, 0x1A, 0xC5, 0x15, 0x1A, 0xC0, 0x15, 0x1A,
+  0xC1, 0x21, 0xC3, 0x1A, 0xC0, 0xA4, 0x89, 0xA6, 0x68, 0xA6, 0x68, 0xA9, 0x68, 0xA9, 0x69, 0x7F,
+  0xC0, 0x1A, 0x04, 0x35, 0x99, 0xB8, 0x9A, 0x98, 0x9D, 0x98, 0x15, 0xA2, 0x88, 0x9D, 0x98, 0x19,
+  0xFE, 0xC4, 0x86, 0x07, 0x9A, 0x99, 0x10, 0xC3, 0x7E, 0x98, 0x8A, 0x8C, 0x3E, 0x11, 0xA4, 0x7A,
+  0xA4, 0x78, 0x24, 0x21, 0xC2, 0x1A, 0x21, 0x1D, 0x9B, 0xA8, 0x0D, 0x38, 0x23, 0x2B, 0x28, 0x23,
+  0x28, 0xD7, 0x23, 0x28, 0x2B, 0xC0, 0x14, 0x9B, 0x79, 0x52, 0xA4, 0x69, 0x24, 0xC0, 0x1A, 0x24,
+  0x29, 0x01, 0x14, 0x00, 0xB3, 0xC2, 0xA8, 0x86, 0x15, 0xC1, 0x10, 0xC1, 0x3B, 0x96, 0x6C, 0x19,
+  0x04, 0x29, 0x1A, 0xC0, 0x6B, 0x1A, 0x24, 0x01, 0x7F, 0x24, 0x21, 0xC0, 0x1A, 0x21, 0x1A, 0xC0,
+  0x24, 0xC0, 0x1A, 0xC1, 0x24, 0x69, 0x21, 0x24, 0xC0, 0x21, 0x24, 0x1A, 0x24, 0xB2, 0x37, 0xAE,
+  0x49, 0xA6, 0x68, 0xA2, 0x88, 0x2E, 0x55, 0xC0, 0x2E, 0x13, 0x9D, 0x99, 0x99, 0xB8, 0x91, 0xC8,
+  0x1A, 0x24, 0x55, 0x99, 0xB7, 0xFE, 0xB4, 0x26, 0x07, 0x9A, 0x99, 0x62, 0x6E, 0xC2, 0x18, 0x32,
+  0xFE, 0x39, 0x01, 0x9A, 0x4C, 0x1D, 0x6F, 0x1A, 0x66, 0x24, 0x21, 0x24, 0x21, 0x29, 0x9D, 0x98,
+  0x14, 0xA2, 0x87, 0xA5, 0xA8, 0x2B, 0x28, 0x23, 0x28, 0xD3, 0x23, 0xC0, 0x2B, 0x28, 0xC5, 0x2B,
+  0x28, 0x9C, 0x89, 0x0D, 0x20, 0x1D, 0x24, 0x5A, 0xC0, 0x29, 0x15, 0x18, 0xA8, 0xD3, 0xB5, 0xD1,
+  0xAA, 0x96, 0x5A, 0x10, 0x15, 0x10, 0xC1, 0x3B, 0x11, 0x0C, 0x09, 0x24, 0x1A, 0x21, 0x24, 0x51,
+  0xB1, 0xA7, 0x98, 0x79, 0x10, 0x24, 0xC2, 0x21, 0x24, 0x55, 0xC0, 0x24, 0xC1, 0x21, 0xC0, 0x24,
+  0x21, 0x24, 0xC1, 0x21, 0x24, 0x10, 0x15, 0xA6, 0x78, 0xA8, 0x58, 0xB0, 0x49, 0x2E, 0xC0, 0x99,
+  0xA8, 0x8E, 0xD8, 0x99, 0xA9, 0x9B, 0xA8, 0x10, 0x24, 0xC0, 0x0C, 0xFE, 0x9B, 0x85, 0xB3, 0xB3,
+  0x99, 0xAA, 0x0B, 0x10, 0xC2, 0x18, 0x92, 0x7C, 0x2F, 0x9E, 0x4B, 0xA7, 0x79, 0x66, 0x21, 0x29,
+  0xA2, 0x88, 0x21, 0x24, 0x21, 0x29, 0x9C, 0x97, 0x0D, 0xA4, 0x98, 0xA5, 0x98, 0x2B, 0x28, 0xD6,
+  0x9D, 0x89, 0x9D, 0x89, 0x0C, 0x2B, 0x28, 0xC6, 0x2B, 0x23, 0x9A, 0x68, 0x52, 0xA6, 0x6A, 0xA2,
+  0x68, 0x66, 0xC0, 0x29, 0xC0, 0x99, 0xA7, 0xA4, 0xC5, 0xFE, 0xB3, 0x84, 0xAD, 0x95, 0xC0, 0x10,
+  0xC3, 0x3B, 0x8F, 0x5E, 0xFE, 0x00, 0x01, 0xA9, 0x69, 0x24, 0x21, 0x24, 0x41, 0xB7, 0xB6, 0x95,
+  0x8A, 0x0D, 0x24, 0xC3, 0x55, 0xA6, 0x98, 0x41, 0x15, 0x24, 0x21, 0xC1, 0x24, 0x21, 0xC0, 0x0D,
+  0x21, 0x24, 0xC0, 0x6E, 0x24, 0x15, 0x9D, 0xA9, 0xAA, 0x58, 0x2E, 0xC0, 0x1A, 0x3F, 0x15, 0x24,
+  0xC0, 0x29, 0x97, 0xB8, 0xB4, 0xC0, 0x3B, 0x9B, 0x9A, 0x0B, 0xC0, 0x10, 0xC1, 0x7A, 0x92, 0x7C,
+  0xFE, 0x20, 0x81, 0xA1, 0x4B, 0x29, 0x21, 0x24, 0x55, 0xA6, 0x88, 0xA7, 0xA8, 0x15, 0x29, 0xC0,
+  0x9C, 0x97, 0x9C, 0xA6, 0x0C, 0xA4, 0x97, 0x28, 0xD8, 0x2B, 0x23, 0x9C, 0x68, 0xC0, 0x28, 0xC0,
+  0x23, 0x28, 0xC3, 0x23, 0x2B, 0x28, 0x9A, 0x79, 0x9D, 0x89, 0xA6, 0x6A, 0x26, 0x21, 0xC1, 0x29,
+  0x9A, 0x97, 0xA1, 0xC5, 0xFE, 0xAB, 0x44, 0x10, 0x6E, 0x10, 0xC1, 0x0B, 0x10, 0x3B, 0x2F, 0xFE,
+  0x00, 0x22, 0xA9, 0x69, 0x21, 0xC0, 0x24, 0x01, 0xA2, 0x88, 0x24, 0x21, 0x24, 0x21, 0xC0, 0x24,
+  0x15, 0xAA, 0x97, 0x9C, 0x89, 0x15, 0x24, 0x21, 0xC0, 0x24, 0xC0, 0x21, 0x29, 0x35, 0x29, 0x21,
+  0x24, 0xC1, 0x29, 0xC0, 0x24, 0xFE, 0x4D, 0x37, 0xC0, 0x24, 0x29, 0x24, 0x21, 0xA2, 0x87, 0x98,
+  0xA8, 0xA9, 0xC3, 0xFE, 0xFD, 0x88, 0x9D, 0x99, 0x0B, 0xC2, 0x10, 0xC0, 0x91, 0x8C, 0xFE, 0x18,
+  0x81, 0x01, 0x29, 0x21, 0xC1, 0x29, 0x21, 0x66, 0x29, 0xC0, 0x3D, 0x0D, 0x0C, 0x2B, 0x23, 0x28,
+  0xDA, 0x2B, 0x9C, 0x79, 0x45, 0x28, 0xC6, 0x23, 0x28, 0x2B, 0x38, 0x9C, 0x79, 0xA6, 0x6A, 0x29,
+  0x21, 0xC1, 0x29, 0x9B, 0x98, 0x9F, 0xD5, 0x1D, 0x10, 0x6E, 0x10, 0xC0, 0x0B, 0xC0, 0x15, 0x36,
+  0xFE, 0x49, 0xA2, 0x96, 0x4E, 0x2E, 0x21, 0xC0, 0x29, 0xC0, 0x21, 0x7A, 0xC2, 0x21, 0x29, 0x51,
+  0xC0, 0x24, 0x21, 0xC1, 0x24, 0xC0, 0x21, 0x29, 0xB6, 0xB6, 0x2E, 0x21, 0x24, 0xC0, 0x21, 0x24,
+  0x29, 0x9D, 0x98, 0xBC, 0x19, 0xC0, 0x09, 0x29, 0x21, 0x29, 0x9C, 0x98, 0x9F, 0xB5, 0xFE, 0xDD,
+  0x07, 0xA3, 0xA8, 0x9C, 0x88, 0x0B, 0xC1, 0x10, 0xC0, 0x1D, 0xFE, 0x18, 0x81, 0xA2, 0x4B, 0xA5,
+  0x89, 0x21, 0x7E, 0x26, 0xC0, 0x21, 0x29, 0xC0, 0x6B, 0x3D, 0x0D, 0x0C, 0x2B, 0x23, 0x28, 0xDB,
+  0x23, 0x2B, 0x0C, 0xC0, 0x2B, 0x23, 0x28, 0xC6, 0x2B, 0x9A, 0x69, 0x14, 0xA7, 0x6B, 0x26, 0x29,
+  0x21, 0xC0, 0x35, 0x9A, 0x97, 0x25, 0xFE, 0xAB, 0x43, 0x10, 0xC2, 0x0B, 0x59, 0xA3, 0x98, 0x46,
+  0xFE, 0x18, 0xC1, 0x04, 0x29, 0x21, 0x24, 0xC3, 0x29, 0x24, 0xC0, 0x21, 0x29, 0x24, 0x21, 0xC1,
+  0x24, 0xC1, 0x29, 0x21, 0x51, 0x21, 0x29, 0xC4, 0x04, 0xB6, 0x28, 0x61, 0x04, 0x29, 0xC1, 0x97,
+  0xB7, 0xFE, 0xAB, 0xE5, 0x36, 0x9A, 0x8A, 0x75, 0x0B, 0xC1, 0x7E, 0x94, 0x6B, 0x20, 0x35, 0xA6,
+  0x79, 0x21, 0x26, 0x29, 0x26, 0xC0, 0x29, 0xC0, 0x6B, 0x09, 0x9B, 0xB6, 0xA6, 0x98, 0x2B, 0x23,
+  0x28, 0xDF, 0x23, 0x28, 0xC9, 0x2B, 0x99, 0x79, 0x47, 0x29, 0xC1, 0x26, 0x29, 0x35, 0x9A, 0x97,
+  0x25, 0x2A, 0x10, 0xC0, 0x0B, 0xC0, 0x69, 0x56, 0x31, 0x94, 0x5C, 0xFE, 0x00, 0x21, 0xA8, 0x6A,
+  0x29, 0x24, 0x29, 0xC7, 0x26, 0x29, 0xCE, 0x15, 0x33, 0x51, 0x15, 0x29, 0x6F, 0x97, 0xB8, 0xB0,
+  0xC0, 0x36, 0x0B, 0x3C, 0x0B, 0xC1, 0xA2, 0x77, 0x96, 0x9B, 0xFE, 0x28, 0xC1, 0x9E, 0x4B, 0x35,
+  0x65, 0xC5, 0x30, 0x18, 0x0D, 0xA6, 0x98, 0x2B, 0xA2, 0x88, 0x7E, 0x28, 0xC4, 0x23, 0xC0, 0x28,
+  0xD0, 0x23, 0x28, 0xC9, 0x23, 0x28, 0xC5, 0x23, 0x98, 0x78, 0xA3, 0x6A, 0x35, 0x26, 0x29, 0x1C,
+  0x69, 0x35, 0x99, 0xA7, 0xA3, 0xD5, 0xFE, 0xCB, 0xE4, 0xAA, 0x76, 0x66, 0x0B, 0xC0, 0x55, 0x08,
+  0x36, 0xFE, 0x6A, 0x63, 0x1F, 0x35, 0x65, 0xC8, 0x26, 0x29, 0xD1, 0x26, 0x35, 0x9B, 0xA8, 0xA1,
+  0xB4, 0x15, 0x1D, 0x3C, 0x7A, 0x0B, 0x69, 0x10, 0x9B, 0x99, 0xFE, 0x49, 0x41, 0x99, 0x3D, 0x35,
+  0x26, 0x29, 0xC4, 0x30, 0x24, 0x99, 0xB6, 0xA5, 0x97, 0x2B, 0x07, 0xA4, 0x88, 0x9D, 0x88, 0x9B,
+  0x8A, 0x28, 0xC2, 0x2B, 0x9D, 0x79, 0x23, 0x28, 0xD0, 0x51, 0x23, 0x28, 0xC8, 0x7E, 0x28, 0xC5,
+  0x14, 0x38, 0x0D, 0xA6, 0x5B, 0x35, 0x9D, 0x88, 0xAC, 0xA7, 0xC0, 0x12, 0x35, 0x1D, 0xA8, 0xE3,
+  0xFE, 0xDC, 0x65, 0xA6, 0x77, 0x0B, 0xC0, 0x04, 0x3C, 0xA3, 0x98, 0x15, 0x36, 0x9F, 0x6D, 0x35,
+  0x29, 0xDD, 0x97, 0xB7, 0xFE, 0xAB, 0xC5, 0xAE, 0xB4, 0x3C, 0xC1, 0x7E, 0x0B, 0x3F, 0x8B, 0x4F,
+  0x0C, 0x29, 0xC7, 0x6B, 0x20, 0xA2, 0x97, 0x28, 0xA2, 0x98, 0xA4, 0x97, 0xC0, 0x9B, 0x7A, 0x51,
+  0x28, 0xC2, 0x23, 0x9C, 0x78, 0x2B, 0x28, 0xC0, 0x23, 0x28, 0xCC, 0x2B, 0x9C, 0x79, 0x23, 0x28,
+  0xC6, 0x23, 0xC0, 0xA6, 0xA7, 0x45, 0x23, 0x28, 0xC1, 0x2B, 0x14, 0x3D, 0x07, 0x9D, 0x88, 0x20,
+  0x35, 0x21, 0xA6, 0x97, 0x6F, 0x21, 0x35, 0x29, 0x98, 0xA6, 0xFE, 0x7A, 0x22, 0xB5, 0xC2, 0xA2,
+  0x78, 0x04, 0xC0, 0x3C, 0xC0, 0x31, 0x92, 0x5C, 0xFE, 0x00, 0x21, 0x29, 0xDC, 0x35, 0x99, 0xA8,
+  0xAB, 0xD1, 0x31, 0x08, 0x61, 0x3C, 0xC0, 0x04, 0x10, 0x91, 0x7C, 0xFE, 0x08, 0x40, 0xA6, 0x5B,
+  0x35, 0x29, 0xC1, 0x6B, 0x29, 0xC1, 0x35, 0x9A, 0xA6, 0x70, 0x28, 0xC0, 0xA4, 0x98, 0xA2, 0x97,
+  0x52, 0x9B, 0x79, 0xA3, 0x98, 0x2B, 0x28, 0xC0, 0x2B, 0x9B, 0x69, 0x3D, 0x2B, 0x23, 0xC0, 0xA2,
+  0x87, 0x28, 0x23, 0x28, 0xCB, 0x9A, 0x79, 0x14, 0x28, 0xC5, 0x23, 0xA4, 0x97, 0x41, 0xA3, 0x98,
+  0xA2, 0x99, 0x3F, 0x23, 0x28, 0xC0, 0x14, 0x3D, 0x7B, 0x69, 0x5B, 0x0D, 0xA5, 0x6A, 0xA4, 0x7A,
+  0x21, 0xC0, 0x35, 0x29, 0x35, 0x15, 0x1C, 0x0E, 0x10, 0x0B, 0x69, 0xC0, 0x3C, 0x08, 0xA5, 0x97,
+  0xFE, 0x49, 0xC2, 0x96, 0x4F, 0x35, 0x29, 0xC1, 0x26, 0x52, 0x29, 0xD4, 0x35, 0x21, 0x9A, 0xB5,
+  0xFE, 0xCC, 0x86, 0xA6, 0xA6, 0x37, 0x3C, 0xC1, 0x10, 0x98, 0x8A, 0xFE, 0x30, 0xE1, 0x9E, 0x3C,
+  0xA6, 0x79, 0x65, 0x35, 0xC0, 0x66, 0xC1, 0x29, 0x35, 0x15, 0x0D, 0x14, 0x2B, 0x28, 0xA5, 0xA8,
+  0x7E, 0x2B, 0x7F, 0x23, 0x2B, 0x56, 0x2B, 0x14, 0x99, 0x7A, 0xA6, 0xA7, 0x2B, 0x23, 0xA2, 0x87,
+  0xA5, 0xA8, 0x30, 0x52, 0xC0, 0x28, 0xCA, 0x1C, 0x0F, 0x2B, 0x28, 0xC4, 0x23, 0x1B, 0x0C, 0x3F,
+  0xA4, 0x97, 0x1B, 0x28, 0x66, 0x41, 0x00, 0x07, 0x00, 0xC0, 0x07, 0x41, 0x19, 0x29, 0x35, 0xC0,
+  0x66, 0x35, 0x29, 0x35, 0x9A, 0x97, 0x3C, 0x0E, 0x10, 0x04, 0xC0, 0x56, 0x37, 0x1D, 0x9A, 0x6A,
+  0x19, 0xA7, 0x6B, 0x30, 0x29, 0xC0, 0x6F, 0xA8, 0x97, 0x29, 0xC2, 0x30, 0x29, 0xC2, 0x30, 0xC3,
+  0x35, 0x29, 0x35, 0x21, 0x26, 0x35, 0x30, 0x29, 0xA2, 0x78, 0x97, 0xB8, 0xB0, 0xD0, 0x31, 0x3C,
+  0x37, 0x3C, 0xC0, 0x0B, 0x37, 0x8A, 0x4F, 0x94, 0x1E, 0x35, 0x30, 0x35, 0x21, 0x26, 0x35, 0xC2,
+  0x30, 0x19, 0x3D, 0x2B, 0x28, 0xC0, 0x3F, 0x55, 0x23, 0x30, 0xC0, 0x23, 0x28, 0xC0, 0x99, 0x79,
+  0x14, 0xA7, 0xA7, 0x2B, 0x23, 0xA5, 0x97, 0xA2, 0x98, 0x3F, 0x28, 0x30, 0x28, 0xC8, 0x2B, 0x14,
+  0x05, 0x3D, 0x2B, 0x28, 0xC4, 0x66, 0xA2, 0x98, 0x16, 0x28, 0xA5, 0xA8, 0x7E, 0x99, 0x7A, 0x9C,
+  0x78, 0x7E, 0xC4, 0x07, 0x9B, 0x89, 0xA4, 0x59, 0x35, 0x29, 0x35, 0xC1, 0x66, 0x35, 0x97, 0xB7,
+  0xAD, 0xF2, 0x3C, 0x0B, 0x3C, 0xC0, 0x37, 0x3C, 0x31, 0xFE, 0x62, 0x23, 0xFE, 0x00, 0x64, 0xA9,
+  0x68, 0x29, 0x30, 0x35, 0xA9, 0xA8, 0x30, 0xC8, 0x35, 0xC1, 0x26, 0x66, 0x35, 0x21, 0x10, 0x25,
+  0x21, 0x35, 0xC0, 0x21, 0x9B, 0xC5, 0xFE, 0xD4, 0xA6, 0xA4, 0xA7, 0x9B, 0x9A, 0x3C, 0xC1, 0x04,
+  0x92, 0x6C, 0x1C, 0xA6, 0x4B, 0x35, 0xC0, 0x41, 0xB0, 0xB6, 0x99, 0x8A, 0x21, 0x35, 0xC0, 0x3A,
+  0x3D, 0x1C, 0x28, 0xC2, 0x23, 0xC0, 0x28, 0x23, 0xC0, 0x28, 0x7A, 0x38, 0x19, 0x7E, 0x14, 0x28,
+  0x23, 0x16, 0xA2, 0x87, 0x9B, 0x7A, 0x3F, 0x23, 0x28, 0xC7, 0x66, 0x2B, 0x07, 0x40, 0x66, 0x28,
+  0xC8, 0x23, 0x2B, 0xA3, 0x98, 0x23, 0x9B, 0x79, 0xA2, 0x87, 0x7A, 0xC2, 0x3D, 0x7B, 0x30, 0x19,
+  0x35, 0xC5, 0x50, 0x1C, 0xFE, 0xAB, 0x44, 0xAE, 0x94, 0x51, 0xC1, 0x66, 0x18, 0x9B, 0x6A, 0x19,
+  0x26, 0x35, 0xC0, 0x66, 0x1E, 0x35, 0xCA, 0x26, 0xA4, 0x98, 0xA3, 0x98, 0x26, 0xC0, 0x11, 0x51,
+  0x26, 0x30, 0x3A, 0x98, 0xA8, 0xAE, 0xE0, 0xFE, 0xFD, 0x88, 0x37, 0xC0, 0x3C, 0xC0, 0x0B, 0x9B,
+  0x99, 0xFE, 0x41, 0x21, 0x9C, 0x2D, 0x3A, 0x66, 0xC0, 0x56, 0xA5, 0x98, 0x51, 0x2D, 0x35, 0xC0,
+  0x65, 0x98, 0xB6, 0x0F, 0x2B, 0x28, 0xC6, 0x2B, 0x41, 0x21, 0xFE, 0x93, 0x27, 0x8C, 0x3D, 0x14,
+  0x28, 0x23, 0xA4, 0x97, 0xA3, 0x98, 0x2B, 0x6E, 0x3F, 0x9D, 0x89, 0x28, 0xC7, 0x2B, 0x99, 0x7A,
+  0xB2, 0xC3, 0x8F, 0x4C, 0x14, 0xA2, 0x98, 0x28, 0xC7, 0x23, 0xC0, 0x2B, 0x38, 0x56, 0xA2, 0x98,
+  0x00, 0xC2, 0x07, 0x59, 0x0D, 0xA6, 0x5A, 0x3A, 0x35, 0xC3, 0x3A, 0x98, 0xA8, 0x0C, 0xFE, 0xDC,
+  0x65, 0x0B, 0x3C, 0xC0, 0x37, 0x3C, 0x31, 0xFE, 0x5A, 0x23, 0x30, 0x3A, 0x62, 0x35, 0xCC, 0x2D,
+  0x09, 0xA2, 0x87, 0x26, 0x35, 0x26, 0x2D, 0x35, 0xC0, 0x30, 0x20, 0xFE, 0xCC, 0x66, 0x18, 0x9B,
+  0x8A, 0x37, 0xC0, 0x3C, 0x04, 0x8E, 0x6E, 0xFE, 0x00, 0x41, 0x35, 0xC3, 0x26, 0x2D, 0x35, 0xC0,
+  0x3A, 0x9A, 0xA7, 0x9E, 0xB6, 0x2B, 0x28, 0xC7, 0x2B, 0x11, 0xFE, 0x93, 0x07, 0xAA, 0xC6, 0x19,
+  0xA7, 0xB8, 0x28, 0x23, 0x2B, 0x7F, 0x28, 0xC0, 0x23, 0x28, 0xC7, 0x2B, 0x23, 0x1C, 0xFE, 0xDC,
+  0x6A, 0xFE, 0x51, 0xA4, 0x97, 0x5B, 0xA8, 0xA6, 0x56, 0xCA, 0x55, 0x21, 0x07, 0x00, 0x07, 0x00,
+  0xC1, 0x07, 0x1C, 0xA2, 0x69, 0xA7, 0x6A, 0x35, 0xC4, 0x69, 0x97, 0xC7, 0xFE, 0x92, 0xC3, 0xB1,
+  0xB4, 0x3C, 0xC1, 0x37, 0xA5, 0x87, 0x98, 0x6B, 0xFE, 0x08, 0x61, 0x35, 0xCF, 0x2D, 0x26, 0x35,
+  0xC3, 0x3A, 0x9A, 0x98, 0xA8, 0xE1, 0xFE, 0xFD, 0x67, 0x37, 0x66, 0x37, 0xC0, 0x04, 0x9A, 0x8A,
+  0xFE, 0x30, 0xE1, 0x01, 0x3A, 0x35, 0xC7, 0x19, 0xA5, 0xA8, 0x2B, 0x28, 0xC6, 0x30, 0x99, 0x7A,
+  0xA7, 0xB7, 0xFE, 0xFC, 0xEB, 0x98, 0x6A, 0x21, 0xA5, 0xA8, 0x28, 0xC1, 0x23, 0x28, 0xCA, 0x7E,
+  0x38, 0x14, 0x2D, 0x96, 0x4A, 0x19, 0x28, 0xCB, 0x2B, 0x9A, 0x69, 0x38, 0x07, 0x00, 0xC1, 0x5A,
+  0x07, 0x30, 0x19, 0x35, 0xC1, 0x41, 0xFE, 0x8C, 0x51, 0x90, 0x5A, 0x97, 0x89, 0xA3, 0x89, 0x9A,
+  0x96, 0xA2, 0xE4, 0xFE, 0xD4, 0x45, 0xA5, 0x98, 0x55, 0xC0, 0x37, 0x3C, 0xA5, 0x97, 0x22, 0x9A,
+  0x3E, 0xA6, 0x79, 0x35, 0xD4, 0x6E, 0x97, 0xB8, 0xFE, 0xAB, 0xA5, 0xAD, 0xC4, 0x2F, 0x32, 0x37,
+  0xC0, 0x7E, 0x8F, 0x5E, 0x11, 0x35, 0xC7, 0x01, 0x0E, 0x9B, 0xC7, 0x28, 0xC7, 0x2B, 0x23, 0x9A,
+  0x68, 0xFE, 0xCC, 0x09, 0xA7, 0xA8, 0x9C, 0x69, 0xFE, 0x18, 0x81, 0xA5, 0x98, 0x28, 0xCA, 0x23,
+  0xC0, 0x28, 0xC0, 0x7E, 0x96, 0x6A, 0xB1, 0xE5, 0xB3, 0xE4, 0xC0, 0xFE, 0x49, 0x84, 0x99, 0x6A,
+  0xA7, 0xA7, 0x28, 0xC9, 0x2B, 0x07, 0x41, 0x07, 0x00, 0xC1, 0x3D, 0x07, 0x38, 0x14, 0xA8, 0x5A,
+  0x3A, 0x35, 0x5A, 0xA3, 0xA8, 0x3A, 0x35, 0xC1, 0x14, 0xFE, 0x92, 0xC3, 0xB1, 0xB3, 0x3C, 0x37,
+  0xC1, 0x20, 0x91, 0x4D, 0xFE, 0x00, 0x42, 0x3A, 0x35, 0xD3, 0x3A, 0x9D, 0x99, 0x00, 0x10, 0x04,
+  0x2F, 0x37, 0xC0, 0x3C, 0x16, 0xFE, 0x39, 0x01, 0x9E, 0x2D, 0xA7, 0x79, 0x35, 0xC4, 0x3A, 0x35,
+  0x6F, 0x99, 0xB6, 0x38, 0xA6, 0x97, 0x28, 0xC6, 0x30, 0x97, 0x7A, 0xB1, 0xD5, 0xFE, 0xFC, 0xCB,
+  0xA7, 0x4A, 0x9B, 0xA8, 0x38, 0x0C, 0xA3, 0xA8, 0x5A, 0xC8, 0x2B, 0x0C, 0x7E, 0x28, 0x2B, 0x55,
+  0x98, 0x6A, 0xFE, 0xBB, 0xA8, 0xAE, 0x97, 0x9C, 0x98, 0x97, 0x7A, 0xFE, 0x10, 0x61, 0x28, 0xC3,
+  0x51, 0x28, 0xC4, 0x2B, 0x14, 0x9B, 0x79, 0x07, 0x00, 0xC1, 0x3D, 0x00, 0x5B, 0x0D, 0xA6, 0x5A,
+  0x01, 0x35, 0xC0, 0x32, 0x35, 0xC1, 0x06, 0x99, 0xA7, 0xA3, 0xF4, 0xFE, 0xDC, 0x65, 0xA4, 0x87,
+  0x37, 0xC0, 0x66, 0x04, 0x5B, 0xFE, 0x20, 0xE1, 0xA2, 0x4D, 0xA3, 0x88, 0x35, 0xC1, 0x3A, 0x35,
+  0xC0, 0x3A, 0xC0, 0x35, 0xC1, 0x3A, 0xC2, 0x35, 0x3A, 0xC1, 0x35, 0x06, 0x97, 0xB8, 0xAF, 0xE0,
+  0xFE, 0xFD, 0x67, 0x2F, 0xC0, 0x37, 0xC0, 0x3F, 0x91, 0x6D, 0x19, 0x35, 0x3A, 0xC1, 0x35, 0xC1,
+  0x3A, 0x35, 0x3A, 0x35, 0x19, 0x14, 0xA3, 0x98, 0x52, 0x07, 0x28, 0xC3, 0x2B, 0x14, 0x3D, 0xFE,
+  0xE4, 0x4A, 0xA7, 0x78, 0xAA, 0x49, 0x16, 0xFE, 0x49, 0x63, 0x9A, 0x5A, 0xA7, 0xA7, 0x28, 0xC8,
+  0x2B, 0x38, 0xA4, 0x87, 0x28, 0x30, 0x99, 0x7A, 0xA5, 0xA7, 0xFE, 0xF4, 0xCB, 0xAB, 0x4A, 0x9A,
+  0x98, 0x9B, 0xD7, 0xFE, 0x6A, 0x25, 0x93, 0x4C, 0xA8, 0xA6, 0x23, 0x6E, 0xC0, 0x9D, 0x89, 0x28,
+  0xC5, 0x23, 0x9A, 0x68, 0x00, 0xC4, 0x07, 0x9C, 0x78, 0xA3, 0x6A, 0xA6, 0x6A, 0x3A, 0xC5, 0x35,
+  0x98, 0xB5, 0xFE, 0xA3, 0x23, 0xAE, 0xA4, 0x37, 0xC1, 0x2F, 0xA7, 0x96, 0x1B, 0xFE, 0x00, 0x84,
+  0x06, 0x35, 0x3A, 0xC0, 0x56, 0xC0, 0x3A, 0x35, 0x3A, 0xCB, 0x01, 0x97, 0xB6, 0xFE, 0xBC, 0x05,
+  0xA9, 0xB6, 0x9A, 0x89, 0x2F, 0x7A, 0x37, 0x65, 0xFE, 0x51, 0x81, 0x99, 0x2F, 0x06, 0x3A, 0xC1,
+  0x66, 0xC0, 0x3A, 0xC1, 0x01, 0x9D, 0x98, 0x1C, 0x28, 0x7A, 0x99, 0x7A, 0x6E, 0xA7, 0xA7, 0x28,
+  0xC2, 0x30, 0x1C, 0xB3, 0xE4, 0xB0, 0xD5, 0xAA, 0x39, 0xA2, 0x89, 0x9C, 0xA7, 0x86, 0x5A, 0x19,
+  0x30, 0x28, 0xC8, 0x66, 0x9B, 0x79, 0x28, 0xC0, 0x7A, 0x96, 0x5A, 0xFE, 0x92, 0xE6, 0x16, 0x1C,
+  0x10, 0x95, 0xC8, 0x9D, 0x98, 0xFE, 0x20, 0xE2, 0x7F, 0x2B, 0x23, 0x2B, 0x0C, 0x23, 0x28, 0xC5,
+  0x99, 0x7A, 0x3D, 0x00, 0x3D, 0x00, 0xC1, 0x07, 0x9D, 0x78, 0xA2, 0x6A, 0x06, 0x3A, 0xC5, 0x06,
+  0x97, 0xB7, 0xA9, 0xF2, 0x37, 0x3C, 0x37, 0xC0, 0x2F, 0x18, 0x96, 0x6B, 0x1D, 0xA9, 0x6B, 0x3A,
+  0xC0, 0x52, 0xAA, 0x97, 0xA2, 0x87, 0x94, 0x69, 0x3A, 0xCB, 0x01, 0x9D, 0x98, 0x36, 0xFE, 0xED,
+  0x07, 0x3C, 0x9D, 0x99, 0x32, 0xC0, 0x3F, 0x97, 0x7B, 0x24, 0x21, 0x01, 0x3A, 0x06, 0x1E, 0xB5,
+  0xB6, 0x7F, 0x1E, 0x01, 0x3A, 0x06, 0x9B, 0xA7, 0x24, 0xA8, 0x97, 0x9A, 0x69, 0x9C, 0x78, 0xA5,
+  0xA8, 0x2B, 0x5A, 0xC1, 0x2B, 0x14, 0xC0, 0xFE, 0xF4, 0xAA, 0xA8, 0x59, 0xA7, 0x59, 0x9D, 0x99,
+  0x75, 0x8E, 0xA9, 0xFE, 0x10, 0x81, 0x28, 0xC8, 0x2B, 0x14, 0x9C, 0x79, 0x2B, 0xC0, 0x9C, 0x69,
+  0x38, 0x09, 0xAC, 0x59, 0xA3, 0x78, 0x66, 0x9D, 0x98, 0x98, 0xD7, 0x97, 0x5A, 0x21, 0xA7, 0xA8,
+  0xC0, 0x2B, 0x0C, 0x14, 0x2B, 0x28, 0xC3, 0x2B, 0x9A, 0x69, 0x38, 0x00, 0x3D, 0xC0, 0x00, 0x3D,
+  0x07, 0x24, 0xA1, 0x6A, 0x3A, 0x06, 0xC0, 0x3A, 0xC3, 0x06, 0x9C, 0x98, 0x9C, 0xD4, 0xFE, 0xC3,
+  0xC4, 0xA9, 0x96, 0x37, 0xC0, 0x2F, 0x3C, 0xA2, 0x88, 0xFE, 0x29, 0x02, 0x21, 0x01, 0x69, 0x5A,
+  0x06, 0x7A, 0x37, 0x3A, 0xCB, 0x06, 0x99, 0xA8, 0xAA, 0xE0, 0xFE, 0xFD, 0x67, 0x98, 0x8B, 0x23,
+  0x2F, 0x7A, 0xA2, 0x87, 0x8D, 0x5E, 0xFE, 0x00, 0x62, 0x06, 0x3A, 0xC0, 0x6B, 0x37, 0xA3, 0xA9,
+  0x6E, 0x9B, 0x89, 0x3A, 0xC0, 0x06, 0x99, 0xB7, 0x38, 0x0C, 0x9A, 0x78, 0x6B, 0xA5, 0x97, 0x2B,
+  0x28, 0xC1, 0x7E, 0x99, 0x7A, 0xA8, 0xB6, 0xB0, 0xC5, 0xA8, 0x59, 0xA9, 0x97, 0x26, 0xC0, 0x94,
+  0xD7, 0xFE, 0x41, 0x43, 0x07, 0x2B, 0x56, 0x28, 0xC4, 0x23, 0x2B, 0x3D, 0xC0, 0x2B, 0xC0, 0x97,
+  0x5A, 0xFE, 0x92, 0xE7, 0xB3, 0xC5, 0xA7, 0x4A, 0x15, 0x26, 0x6F, 0x97, 0xA8, 0x96, 0xB8, 0x8D,
+  0x2D, 0x95, 0x6A, 0x2B, 0x6E, 0x9C, 0x79, 0xC0, 0x2B, 0x28, 0xC3, 0x2B, 0x9A, 0x69, 0xC0, 0x07,
+  0x3D, 0xC0, 0x00, 0x3D, 0x07, 0x30, 0x14, 0x6E, 0xA2, 0x79, 0xA5, 0x69, 0x06, 0x3A, 0xC0, 0x37,
+  0x51, 0x01, 0xC0, 0x97, 0xB6, 0xFE, 0x8A, 0xA3, 0x3F, 0x56, 0xC0, 0x66, 0x2F, 0xA6, 0x96, 0xFE,
+  0x62, 0x03, 0xFE, 0x00, 0xA5, 0x06, 0x3A, 0xC0, 0x5A, 0xC0, 0x3A, 0xC7, 0x01, 0x3A, 0x01, 0xC0,
+  0x3A, 0x06, 0x96, 0xB7, 0xFE, 0x9B, 0x44, 0x18, 0x9A, 0x89, 0xC0, 0x2F, 0x7E, 0x23, 0xFE, 0x49,
+  0x41, 0x9C, 0x1E, 0x06, 0x3A, 0x6B, 0xC1, 0x55, 0xC0, 0x01, 0x3A, 0xC0, 0x06, 0x99, 0xB7, 0x9F,
+  0xC7, 0x41, 0xA4, 0x59, 0x19, 0x00, 0x2B, 0x28, 0xC1, 0x66, 0x38, 0xA6, 0x97, 0x95, 0x6A, 0x66,
+  0x21, 0xAE, 0x96, 0xB5, 0xA7, 0xAB, 0xC5, 0x87, 0xAB, 0x1C, 0x30, 0x28, 0xC6, 0x2B, 0x9A, 0x69,
+  0x0C, 0xA4, 0x98, 0x38, 0xA5, 0xA7, 0xFE, 0xEC, 0xAA, 0xAC, 0x49, 0xA4, 0x69, 0x99, 0x99, 0x92,
+  0x6A, 0x92, 0x6A, 0x96, 0x79, 0x05, 0x00, 0xC0, 0x19, 0xA9, 0xB7, 0x0C, 0x07, 0x2B, 0x28, 0xC3,
+  0x2B, 0x9A, 0x69, 0xC0, 0x07, 0x59, 0xC0, 0x7A, 0xC0, 0x07, 0x30, 0x19, 0xA6, 0xA7, 0x38, 0x9C,
+  0x78, 0xA4, 0x6A, 0x06, 0x55, 0xA2, 0x98, 0xAB, 0xA8, 0x92, 0x69, 0xA3, 0x88, 0x97, 0xB8, 0xA6,
+  0xF2, 0xFE, 0xE4, 0x86, 0xA2, 0x77, 0x66, 0x32, 0x55, 0x18, 0x17, 0xFE, 0x00, 0x63, 0x06, 0x3A,
+  0x01, 0xC2, 0x3A, 0xC1, 0x01, 0xC4, 0x06, 0x01, 0xC1, 0x59, 0x98, 0xD6, 0xFE, 0xCC, 0x66, 0x04,
+  0x9B, 0x9A, 0x23, 0x2F, 0x7E, 0x99, 0x8A, 0xFE, 0x20, 0x81, 0xA6, 0x2B, 0x06, 0x01, 0xC2, 0x06,
+  0xC0, 0x01, 0xC0, 0x69, 0x06, 0x02, 0x9B, 0xC7, 0xA2, 0x69, 0x3A, 0x97, 0xC7, 0xA4, 0x96, 0xA5,
+  0xA8, 0x56, 0xC0, 0x30, 0x07, 0xA4, 0x96, 0xFE, 0xFD, 0x0C, 0xA2, 0x2A, 0x90, 0x5B, 0x8C, 0x6A,
+  0x9A, 0x89, 0xC0, 0x29, 0xFE, 0xCC, 0x2A, 0xFE, 0x39, 0x43, 0x14, 0x2B, 0x28, 0xC5, 0x66, 0x9A,
+  0x69, 0x23, 0xC0, 0x21, 0xFE, 0xD4, 0x09, 0xAE, 0x68, 0x9C, 0x3A, 0x8B, 0x7B, 0x90, 0x6A, 0x00,
+  0xC0, 0x19, 0xAB, 0xA7, 0xA9, 0xA7, 0xA1, 0xB7, 0x98, 0x7A, 0x19, 0x3D, 0xC0, 0x2B, 0x5A, 0xC3,
+  0x2B, 0x9A, 0x69, 0xC0, 0x07, 0x3D, 0x7A, 0x3D, 0xC0, 0x07, 0x30, 0x19, 0x23, 0xA2, 0x87, 0x23,
+  0x9A, 0x78, 0x25, 0x3A, 0x0B, 0xA6, 0xA8, 0x98, 0x68, 0x06, 0x9C, 0x98, 0x2C, 0xFE, 0xC3, 0xC4,
+  0x3C, 0x32, 0xC0, 0x55, 0x04, 0x9B, 0x7B, 0x25, 0xA8, 0x5A, 0x6B, 0xC9, 0x06, 0x37, 0xA4, 0x98,
+  0xAB, 0xA8, 0x90, 0x69, 0x06, 0xC0, 0x21, 0xA0, 0xD3, 0xFE, 0xED, 0x07, 0x9C, 0x99, 0x1E, 0x23,
+  0x2F, 0x7E, 0x91, 0x6D, 0x20, 0x06, 0x01, 0xC0, 0x06, 0x01, 0x06, 0x01, 0xC0, 0x06, 0xC0, 0x01,
+  0x06, 0x9B, 0xA7, 0x99, 0xC7, 0xA5, 0x6A, 0xA8, 0x5A, 0x97, 0xC6, 0xA0, 0xB7, 0x30, 0x52, 0x28,
+  0x30, 0x2D, 0xAE, 0xE4, 0xFE, 0xFD, 0x6E, 0xA9, 0x49, 0x6F, 0x9B, 0x99, 0x8C, 0x5A, 0x35, 0x9A,
+  0x89, 0x35, 0xA5, 0xA7, 0x9A, 0x7A, 0xA7, 0xA7, 0x23, 0x28, 0xC3, 0x2B, 0x14, 0x9C, 0x79, 0xA7,
+  0xB8, 0x98, 0x59, 0xB2, 0xE3, 0x3E, 0x8F, 0x1D, 0x00, 0xC0, 0x19, 0xAE, 0x96, 0xB0, 0xB6, 0xAC,
+  0x96, 0xA6, 0x98, 0xA2, 0x77, 0x9A, 0xB8, 0x97, 0xD8, 0x91, 0x2C, 0x8C, 0x3C, 0xA3, 0x98, 0xA5,
+  0xA8, 0x5A, 0xC3, 0x2B, 0x30, 0xC0, 0x07, 0x38, 0xC0, 0x7E, 0x5A, 0x07, 0x30, 0x19, 0x00, 0x23,
+  0x2B, 0x6E, 0x99, 0x79, 0x25, 0x06, 0x51, 0x06, 0xC0, 0x65, 0x19, 0xFE, 0x9A, 0xE3, 0x3F, 0x52,
+  0xC0, 0x55, 0x37, 0xA2, 0x88, 0xFE, 0x29, 0x02, 0xA2, 0x3C, 0x06, 0x66, 0x06, 0x01, 0x06, 0xC0,
+  0x01, 0xC1, 0x06, 0xC5, 0x01, 0xA2, 0x77, 0x98, 0xA8, 0xA9, 0xF1, 0xFE, 0xF5, 0x47, 0x23, 0xC1,
+  0x6F, 0x79, 0x8A, 0x3F, 0xFE, 0x00, 0xA4, 0x0B, 0x06, 0xC9, 0x61, 0x97, 0xC6, 0xA8, 0x59, 0x12,
+  0x0E, 0x24, 0xA7, 0xA8, 0x28, 0xC0, 0x2B, 0x99, 0x69, 0xFE, 0xAB, 0x68, 0xB4, 0x87, 0xA2, 0x68,
+  0x61, 0xA2, 0x88, 0xA3, 0x78, 0x99, 0x89, 0x8A, 0x6C, 0x19, 0x9D, 0x99, 0xA3, 0x98, 0xA7, 0x97,
+  0x30, 0x0C, 0x0F, 0x2B, 0x28, 0xC0, 0x2B, 0x38, 0x0C, 0x7E, 0x05, 0xAB, 0xB7, 0x00, 0xC0, 0xAB,
+  0x87, 0x02, 0xAF, 0xB7, 0xA8, 0x97, 0x26, 0x10, 0x55, 0x3C, 0x6F, 0x9B, 0xA8, 0x9C, 0xC6, 0x91,
+  0x3C, 0x8C, 0x2D, 0xA8, 0xA6, 0x56, 0xC3, 0x2B, 0x9A, 0x69, 0x6E, 0xA1, 0xA8, 0xC0, 0x30, 0x38,
+  0x00, 0x07, 0x24, 0x1C, 0x00, 0x07, 0x28, 0xC0, 0x2B, 0x1C, 0xA3, 0x6A, 0x12, 0x06, 0xC0, 0x0B,
+  0x96, 0xB7, 0xFE, 0x72, 0x02, 0x37, 0xC0, 0x32, 0x59, 0x67, 0x18, 0xFE, 0x51, 0xC2, 0xFE, 0x00,
+  0xC6, 0x0B, 0x62, 0x06, 0xCD, 0x12, 0x96, 0xB7, 0xFE, 0x82, 0xC3, 0xB3, 0xE3, 0x99, 0x7A, 0x23,
+  0xC0, 0x7F, 0x9D, 0x89, 0xFE, 0x39, 0x21, 0x9F, 0x2E, 0x0B, 0x06, 0x56, 0x06, 0xC8, 0x61, 0x06,
+  0xC0, 0x35, 0x1C, 0xA7, 0xA8, 0x6E, 0xC1, 0x9A, 0x78, 0xFE, 0xD4, 0x4B, 0x21, 0x26, 0x6E, 0x26,
+  0x21, 0xA4, 0x67, 0x98, 0xA9, 0x8C, 0xA9, 0x94, 0x5A, 0x92, 0x3B, 0x7F, 0xAA, 0xA6, 0x0C, 0x9C,
+  0x78, 0x28, 0xC2, 0x9A, 0x79, 0x07, 0x9C, 0x68, 0x05, 0x66, 0xAC, 0x97, 0xB4, 0xB4, 0xAB, 0xC6,
+  0x26, 0xA2, 0x78, 0x26, 0x66, 0x69, 0xC0, 0x21, 0xC0, 0x2B, 0x9D, 0xA8, 0x87, 0xAB, 0xFE, 0x10,
+  0x81, 0xA8, 0xA7, 0x28, 0xC4, 0x21, 0x38, 0x6E, 0xC0, 0x38, 0x21, 0x3D, 0x0C, 0x21, 0xC0, 0x0C,
+  0x3D, 0x0C, 0x28, 0x7A, 0x46, 0x98, 0x78, 0xA9, 0x5B, 0x06, 0xC0, 0x6F, 0x99, 0xA7, 0xFE, 0x49,
+  0x41, 0x1E, 0xA3, 0x88, 0x32, 0x2F, 0x65, 0x18, 0x8B, 0x4F, 0xFE, 0x00, 0x84, 0x12, 0x65, 0xCE,
+  0x6E, 0x95, 0xC8, 0xFE, 0xA3, 0x84, 0xAC, 0xC5, 0x1B, 0x23, 0xC0, 0x32, 0x9A, 0x79, 0x2C, 0xA6,
+  0x2C, 0x06, 0xC0, 0xA2, 0x88, 0x06, 0xCB, 0x0B, 0x25, 0xA3, 0xB7, 0x2B, 0x28, 0xC0, 0x0D, 0xFE,
+  0xCC, 0xCD, 0xA9, 0x78, 0x93, 0x7A, 0x98, 0x7A, 0x9C, 0x88, 0x56, 0xA4, 0x87, 0xA2, 0x88, 0xC0,
+  0xA5, 0xE6, 0x61, 0xFE, 0x31, 0x23, 0x1C, 0x14, 0x99, 0x7A, 0x07, 0xA4, 0x97, 0x28, 0x66, 0x97,
+  0x79, 0x3D, 0xA4, 0x88, 0xA3, 0x98, 0xB2, 0xC4, 0xAA, 0xD6, 0xA2, 0x78, 0x17, 0x9B, 0x5A, 0x97,
+  0x7A, 0x9A, 0x78, 0x9C, 0x89, 0x9C, 0x89, 0xC0, 0x6E, 0x31, 0x0D, 0xAE, 0x96, 0x9B, 0xA9, 0x19,
+  0xA9, 0xB7, 0x28, 0xC3, 0x23, 0x21, 0x00, 0x0C, 0xC1, 0x9D, 0x89, 0xC0, 0x38, 0x14, 0x1C, 0x38,
+  0xC0, 0x3D, 0x23, 0x2B, 0x6E, 0x99, 0x8A, 0xA0, 0x59, 0xA9, 0x5B, 0x06, 0x0B, 0x9C, 0x98, 0x9C,
+  0xE4, 0xFE, 0xCB, 0xE4, 0x37, 0x2F, 0xC0, 0x65, 0x13, 0x92, 0x4C, 0xFE, 0x00, 0x63, 0x0B, 0x06,
+  0xCF, 0x97, 0xC6, 0xFE, 0xC4, 0x25, 0xA5, 0xB7, 0x1E, 0x23, 0xC0, 0x7F, 0x95, 0x7B, 0x19, 0x06,
+  0xC0, 0x56, 0xAD, 0xB7, 0x96, 0x69, 0x41, 0x06, 0xC4, 0x03, 0x06, 0xC1, 0x51, 0x06, 0x9B, 0xA7,
+  0x9C, 0xC6, 0x2B, 0xC0, 0x56, 0x96, 0x69, 0xFE, 0xBC, 0xAE, 0x97, 0x69, 0x00, 0xC3, 0x6E, 0xA5,
+  0x98, 0xA3, 0x98, 0xFE, 0xB3, 0xA8, 0xAC, 0xB6, 0xFE, 0x5A, 0x26, 0x05, 0x21, 0x05, 0xA8, 0xA7,
+  0xA3, 0x99, 0x38, 0x19, 0xFE, 0xBC, 0xCE, 0xAB, 0xA7, 0x7E, 0x9D, 0xA7, 0x8F, 0xAA, 0x95, 0x2D,
+  0x95, 0x6A, 0x05, 0x00, 0xC6, 0xB5, 0xB6, 0x25, 0xFE, 0x08, 0x41, 0x30, 0x28, 0xC2, 0x2B, 0x23,
+  0x1C, 0x6F, 0x19, 0x65, 0x14, 0x21, 0x7F, 0x09, 0x11, 0x7F, 0xC0, 0x09, 0x30, 0x1C, 0xA6, 0x97,
+  0x2B, 0x14, 0x19, 0xA9, 0x5B, 0xA2, 0x78, 0xC0, 0x51, 0x21, 0xFE, 0xAB, 0x43, 0xAB, 0xA6, 0x2F,
+  0xC0, 0x65, 0x3F, 0x9A, 0x5A, 0xFE, 0x08, 0x62, 0x06, 0xCE, 0x0B, 0x52, 0x35, 0x2F, 0x37, 0x1E,
+  0x23, 0xC0, 0x7F, 0x90, 0x5C, 0xFE, 0x00, 0x83, 0x12, 0x06, 0xC0, 0x3E, 0x06, 0xC3, 0x0B, 0x3E,
+  0xA7, 0xA8, 0xA8, 0x96, 0x90, 0x5A, 0x12, 0x9A, 0xB6, 0x9D, 0xB6, 0x30, 0x46, 0x9D, 0x98, 0x14,
+  0xA3, 0x98, 0x52, 0x00, 0xB9, 0xB5, 0xB8, 0xB5, 0x19, 0xBA, 0x97, 0xAE, 0x97, 0x9B, 0x89, 0x9A,
+  0x89, 0x86, 0x79, 0x9B, 0x98, 0x05, 0x00, 0xFE, 0x8A, 0xE7, 0x15, 0x01, 0x00, 0xB1, 0xA6, 0x91,
+  0x7A, 0x23, 0x9A, 0x68, 0xFE, 0xB4, 0x6D, 0xB0, 0x96, 0x9C, 0xA8, 0x46, 0xFE, 0x51, 0xE5, 0x00,
+  0xA2, 0x78, 0xA6, 0x98, 0x9D, 0x88, 0x1C, 0x5A, 0xA4, 0x88, 0x19, 0xB6, 0x97, 0xB0, 0x78, 0x91,
+  0xA9, 0x8A, 0x78, 0x8D, 0xE3, 0x93, 0x7A, 0x19, 0x30, 0x56, 0xC2, 0x2B, 0x14, 0x21, 0xA8, 0xB6,
+  0xA8, 0x88, 0xAA, 0x87, 0xA7, 0x88, 0xA5, 0xA8, 0xA3, 0x98, 0xA3, 0x98, 0xA3, 0x98, 0x6E, 0x52,
+  0x05, 0x41, 0x95, 0x8B, 0xFE, 0x10, 0x81, 0x23, 0x2B, 0x1C, 0xA6, 0x4A, 0x12, 0x06, 0x0B, 0x20,
+  0xFE, 0x92, 0xA3, 0x37, 0x56, 0xC0, 0x65, 0x37, 0x46, 0xFE, 0x18, 0xA2, 0xA7, 0x3B, 0x0B, 0x06,
+  0xC5, 0x0B, 0xC5, 0x12, 0x9D, 0x98, 0x9D, 0xE4, 0xFE, 0xE4, 0xC6, 0x2F, 0x1E, 0x23, 0xC0, 0x7F,
+  0x8C, 0x4E, 0xFE, 0x00, 0xA4, 0xAA, 0x59, 0x06, 0x0B, 0xC6, 0x06, 0x12, 0x7E, 0x06, 0x0B, 0x20,
+  0xFE, 0xAB, 0x68, 0xA7, 0xB7, 0x9D, 0x79, 0x95, 0x5B, 0x8F, 0x3C, 0xA9, 0xB7, 0x14, 0x97, 0x7A,
+  0xAF, 0xA6, 0xFE, 0xFE, 0xD4, 0x28, 0x81, 0x88, 0xB3, 0x78, 0x65, 0x98, 0xA9, 0xAF, 0x6A, 0x9D,
+  0x98, 0xA4, 0x88, 0xA8, 0x88, 0x2D, 0xFE, 0xED, 0xD0, 0xA2, 0x88, 0xFE, 0x6A, 0xC8, 0x01, 0x8A,
+  0x4B, 0x00, 0xAE, 0x96, 0x26, 0x9B, 0xA9, 0xA2, 0x88, 0x99, 0x89, 0x8E, 0x3C, 0xB3, 0x89, 0xAB,
+  0x98, 0x9C, 0x88, 0xB3, 0x7A, 0x9D, 0x99, 0x69, 0x92, 0xA6, 0x8B, 0x8A, 0x5A, 0xFE, 0xFF, 0xFF,
+  0x25, 0x82, 0x88, 0xFE, 0xFE, 0xF4, 0x89, 0x8C, 0x1C, 0xA9, 0xA7, 0x28, 0xC2, 0x30, 0x38, 0xA9,
+  0xB7, 0xFE, 0xFC, 0xEB, 0xA7, 0x5A, 0x37, 0x66, 0x3C, 0xC0, 0x9B, 0xAA, 0x9A, 0x79, 0x79, 0x15,
+  0x6B, 0xA6, 0x57, 0x85, 0x8C, 0x0D, 0x2B, 0x30, 0x38, 0xA0, 0x5A, 0xA9, 0x5A, 0x06, 0x17, 0x95,
+  0xC7, 0xFE, 0x7A, 0x22, 0xB4, 0xB2, 0x2F, 0xC0, 0x65, 0x7F, 0xA2, 0x77, 0xFE, 0x28, 0xE1, 0xA4,
+  0x2D, 0x12, 0x06, 0x0B, 0xC0, 0x06, 0x0B, 0xC8, 0x17, 0x9B, 0x98, 0xA0, 0xF3, 0xFE, 0xED, 0x06,
+  0x9B, 0x9A, 0x1E, 0x23, 0xC0, 0x7E, 0xFE, 0x59, 0xA1, 0xFE, 0x00, 0xC5, 0x17, 0x0B, 0xC9, 0x03,
+  0x0B, 0x17, 0x95, 0xC7, 0xFE, 0x72, 0x25, 0x2D, 0x9D, 0x89, 0xA4, 0x88, 0xFE, 0x49, 0x84, 0x98,
+  0x5A, 0xA6, 0xA7, 0x14, 0xA6, 0x87, 0x8B, 0xE3, 0x89, 0x6B, 0xAB, 0x6B, 0xB5, 0x97, 0x62, 0x93,
+  0x89, 0x14, 0x55, 0xAE, 0x97, 0x86, 0xA7, 0xB9, 0x79, 0xFE, 0xED, 0xD1, 0xA3, 0x98, 0xA2, 0x77,
+  0x9D, 0xA9, 0x26, 0x91, 0x7A, 0x66, 0x1A, 0x9D, 0x9A, 0x7A, 0x04, 0xA9, 0x4B, 0xA3, 0x7B, 0xA2,
+  0x78, 0x8A, 0x99, 0x00, 0xA4, 0x87, 0x14, 0xBD, 0x97, 0x8F, 0x99, 0xA7, 0x88, 0x89, 0x89, 0x83,
+  0x98, 0x97, 0xB6, 0xFE, 0xFF, 0x14, 0x87, 0x9C, 0xFE, 0x10, 0x61, 0x30, 0x56, 0xC2, 0x30, 0x99,
+  0x7A, 0x3B, 0xB1, 0xF5, 0x04, 0xA5, 0x69, 0x9B, 0x99, 0x92, 0x6A, 0x94, 0x79, 0x9D, 0x98, 0xA3,
+  0xB8, 0xA8, 0xB6, 0xAF, 0x88, 0xA9, 0x58, 0x90, 0x8A, 0x00, 0xA9, 0xA7, 0xA2, 0x98, 0xC0, 0x9C,
+  0x78, 0x9D, 0x6A, 0x12, 0x69, 0x17, 0x97, 0xB7, 0xFE, 0x61, 0xC1, 0xFE, 0xE4, 0x85, 0x2F, 0x66,
+  0x69, 0x2A, 0xA4, 0x86, 0xFE, 0x39, 0x22, 0xA0, 0x1D, 0x17, 0x9D, 0x88, 0xAC, 0xB8, 0x55, 0x95,
+  0x6A, 0x12, 0x0B, 0xC0, 0x12, 0xC2, 0x0B, 0xC1, 0x17, 0x1E, 0xFE, 0x49, 0x82, 0x13, 0x9A, 0x89,
+  0xC1, 0x23, 0xC0, 0xFE, 0x49, 0x41, 0x9E, 0x0E, 0x17, 0x0B, 0xC2, 0x6B, 0xC3, 0x0B, 0x12, 0xC0,
+  0x0B, 0x17, 0x9C, 0x98, 0x1C, 0xFE, 0xCC, 0x09, 0xA4, 0xA8, 0x3E, 0xA7, 0xA7, 0xFE, 0x29, 0x02,
+  0x1C, 0x7F, 0x59, 0xFE, 0xDD, 0x4F, 0xA3, 0x98, 0x9F, 0x4D, 0xAF, 0x88, 0x6F, 0x3C, 0xB4, 0x69,
+  0xA2, 0x88, 0x21, 0xA2, 0x89, 0xA6, 0x96, 0xFE, 0xFE, 0x52, 0x61, 0x5A, 0x7F, 0x66, 0xA3, 0x78,
+  0xC0, 0x10, 0xC1, 0x04, 0xA3, 0x6B, 0xA6, 0x5A, 0xA4, 0x78, 0x88, 0x89, 0xBB, 0x8A, 0xA4, 0x87,
+  0x19, 0x00, 0xC0, 0xB7, 0x98, 0x88, 0x77, 0x82, 0x98, 0xA6, 0xD4, 0xAE, 0x76, 0x89, 0x7C, 0x1C,
+  0xA9, 0xA7, 0x56, 0xC2, 0x30, 0x21, 0xFE, 0xA3, 0x27, 0x1B, 0x9F, 0x4B, 0x8F, 0x6B, 0x93, 0x89,
+  0xA3, 0xB8, 0xAC, 0xC5, 0xA8, 0xA6, 0x20, 0xA7, 0x69, 0xA9, 0x49, 0x98, 0x89, 0xFE, 0x10, 0xA2,
+  0x38, 0x30, 0x28, 0x7A, 0x9D, 0x89, 0x9C, 0x59, 0xAA, 0x4A, 0xC0, 0x6F, 0x98, 0xA8, 0xFE, 0x51,
+  0x61, 0x23, 0x7F, 0x23, 0xC1, 0xA5, 0x88, 0xFE, 0x41, 0x82, 0x9C, 0x2F, 0x17, 0x0B, 0x17, 0x66,
+  0x0B, 0xC1, 0x12, 0xC5, 0x03, 0xA3, 0x88, 0x98, 0xA8, 0xA6, 0xF1, 0x13, 0x9A, 0x79, 0x1E, 0x23,
+  0xC0, 0x1E, 0xFE, 0x41, 0x21, 0xA0, 0x0D, 0xA6, 0x79, 0xC3, 0x66, 0xC7, 0x0B, 0x1C, 0x95, 0xC8,
+  0xA6, 0xE4, 0xFE, 0xFC, 0xEB, 0x93, 0x4C, 0x30, 0x9B, 0x79, 0x9B, 0x8A, 0xA4, 0x87, 0x14, 0xFE,
+  0xA4, 0x4C, 0xB0, 0xB6, 0x2C, 0xA7, 0x5B, 0xA2, 0x87, 0x94, 0x89, 0x14, 0x6E, 0x7A, 0x00, 0xAD,
+  0xA7, 0xFE, 0xFE, 0x52, 0x62, 0x6E, 0xC3, 0x15, 0x10, 0xC0, 0x04, 0xA2, 0x7A, 0xA7, 0x4C, 0xA4,
+  0x77, 0x88, 0x89, 0x00, 0x21, 0x19, 0x7F, 0x00, 0xBD, 0x97, 0x82, 0x77, 0x2C, 0x9C, 0xA5, 0xA5,
+  0x79, 0x86, 0x6C, 0x1C, 0x30, 0x56, 0xC3, 0x9A, 0x79, 0xFE, 0xA3, 0x47, 0x97, 0x5C, 0x98, 0x59,
+  0x98, 0x89, 0xFE, 0x8A, 0xC6, 0xB4, 0xC4, 0x9C, 0x99, 0x9D, 0x99, 0xA7, 0x59, 0xAA, 0x59, 0x9C,
+  0x88, 0x11, 0x14, 0xA8, 0xA7, 0x28, 0xC0, 0x2B, 0x41, 0x9A, 0x69, 0xAB, 0x4B, 0x6B, 0xA2, 0x77,
+  0x99, 0xA8, 0xFE, 0x41, 0x21, 0x1E, 0xA2, 0x88, 0x55, 0xC1, 0x13, 0xFE, 0x51, 0xC2, 0x9A, 0x1F,
+  0x1C, 0x62, 0xC6, 0x6E, 0xC1, 0x12, 0x17, 0x7E, 0x17, 0x0D, 0xA8, 0xF0, 0x13, 0x1B, 0x1E, 0x23,
+  0xC0, 0x52, 0xFE, 0x39, 0x01, 0xA3, 0x1E, 0xA5, 0x79, 0x9C, 0x97, 0x9D, 0xA8, 0xC0, 0xA3, 0x89,
+  0x17, 0x23, 0x17, 0x12, 0xC0, 0x17, 0xC0, 0x12, 0x17, 0x12, 0x17, 0xC0, 0x93, 0xD6, 0xFE, 0x8A,
+  0xC6, 0xB3, 0xD5, 0x93, 0x6B, 0xFE, 0x10, 0x61, 0xA3, 0x88, 0xA2, 0x98, 0x9A, 0x79, 0xB7, 0xB5,
+  0xFE, 0xFE, 0x72, 0x9C, 0x99, 0xA9, 0x4D, 0xA3, 0x88, 0x9B, 0x89, 0xB0, 0x7A, 0x9C, 0x87, 0x21,
+  0x9D, 0x89, 0xAD, 0xA7, 0xFE, 0xFE, 0x73, 0x9D, 0xA9, 0x10, 0x15, 0xC4, 0x10, 0xC1, 0xA8, 0x3C,
+  0xA4, 0x78, 0x8C, 0x89, 0x00, 0x1C, 0x19, 0x7E, 0x00, 0x11, 0x12, 0x93, 0xE5, 0x61, 0xA5, 0x78,
+  0xFE, 0x6A, 0xC8, 0x8E, 0x7A, 0xA8, 0x97, 0x56, 0xC2, 0x66, 0x9A, 0x68, 0x3D, 0xAA, 0xC6, 0xFE,
+  0xEC, 0xAB, 0x8F, 0x3C, 0xA2, 0x98, 0xB1, 0xE4, 0x9B, 0x8A, 0xA8, 0x58, 0xA9, 0x69, 0x51, 0xFE,
+  0x31, 0x84, 0x95, 0x9A, 0x0C, 0x07, 0x28, 0xC0, 0x2B, 0x41, 0x19, 0xAB, 0x4B, 0x17, 0x6E, 0x9A,
+  0xA8, 0x9D, 0xF4, 0x16, 0xA3, 0x98, 0x55, 0xC1, 0x13, 0xFE, 0x61, 0xE2, 0xFE, 0x01, 0x06, 0xA8,
+  0x69, 0x61, 0x17, 0xC0, 0x12, 0x17, 0xC5, 0x51, 0xA9, 0xA8, 0xAB, 0xA7, 0x8D, 0x5B, 0x9A, 0xA7,
+  0xFE, 0x62, 0x02, 0x13, 0x1B, 0x7A, 0x6E, 0xC0, 0x16, 0xFE, 0x39, 0x21, 0x9D, 0x3D, 0x74, 0x7A,
+  0xA2, 0x98, 0xC0, 0x9D, 0x88, 0x5B, 0xA6, 0x69, 0x0B, 0xA2, 0x79, 0x17, 0xC1, 0x7F, 0x17, 0xC2,
+  0x61, 0x19, 0xFE, 0xBB, 0xA8, 0x3E, 0xFE, 0x41, 0x83, 0x98, 0x6B, 0x0C, 0x9B, 0x89, 0xAE, 0x96,
+  0x15, 0x9C, 0x98, 0xA4, 0x7A, 0x39, 0xA2, 0x88, 0xB4, 0x79, 0x00, 0x28, 0x00, 0xB3, 0xA6, 0xFE,
+  0xFE, 0x93, 0x9D, 0x99, 0x15, 0xC1, 0x6B, 0x15, 0xC1, 0x10, 0xC0, 0x65, 0xA6, 0x4B, 0xA6, 0x6A,
+  0x96, 0x98, 0xB1, 0x7A, 0x5A, 0x1C, 0x56, 0x35, 0x91, 0xA8, 0x9E, 0xB5, 0x30, 0x6F, 0x1A, 0x31,
+  0x92, 0x7A, 0xA7, 0xA7, 0x56, 0xC1, 0x2B, 0x41, 0x41, 0xFE, 0xDC, 0x4A, 0xA5, 0xA7, 0xC0, 0x8E,
+  0x2C, 0xA7, 0xA7, 0xA9, 0xD7, 0xA5, 0x59, 0xA9, 0x69, 0x51, 0xFE, 0x41, 0xA5, 0x05, 0x0C, 0x3D,
+  0xC0, 0xA3, 0xA9, 0x28, 0x2B, 0x14, 0x9A, 0x6A, 0x17, 0x0F, 0x17, 0x9C, 0x98, 0x9C, 0xF3, 0xFE,
+  0xCC, 0x05, 0xA4, 0x97, 0x55, 0xC1, 0x13, 0xFE, 0x59, 0xE2, 0xFE, 0x00, 0xE6, 0xA9, 0x69, 0x17,
+  0xCC, 0x23, 0x12, 0xFE, 0x61, 0xE2, 0x13, 0x1B, 0x1E, 0xC0, 0xA2, 0x87, 0x0E, 0xFE, 0x20, 0xA0,
+  0xA0, 0x6A, 0xAB, 0x99, 0xA5, 0x89, 0x7E, 0xC0, 0x9D, 0x99, 0x98, 0x87, 0x97, 0x88, 0x19, 0xA4,
+  0x69, 0x06, 0x23, 0xC0, 0xA8, 0xA6, 0x17, 0xC2, 0x23, 0x9B, 0xA7, 0x24, 0xFE, 0xBB, 0xC9, 0x91,
+  0x4C, 0x96, 0x5A, 0x0C, 0x9C, 0x89, 0xA9, 0x97, 0x10, 0x55, 0x75, 0xA3, 0x6B, 0xAC, 0x3B, 0x88,
+  0x89, 0xBA, 0x89, 0xA4, 0x88, 0x00, 0xFE, 0x93, 0xCB, 0xB7, 0xA5, 0x9C, 0x99, 0x15, 0x6B, 0xC2,
+  0x15, 0xC1, 0x10, 0xC0, 0x6B, 0xA8, 0x3B, 0xA4, 0x79, 0xB5, 0x89, 0x00, 0xA4, 0x87, 0x00, 0x80,
+  0x88, 0xB9, 0xB4, 0x95, 0xD6, 0x01, 0x66, 0x15, 0xFE, 0x49, 0xE5, 0x97, 0x8A, 0xA6, 0x97, 0x56,
+  0xC1, 0x30, 0x9B, 0x7A, 0x33, 0xFE, 0xF4, 0xCB, 0x9D, 0x89, 0xA2, 0x88, 0x92, 0x3B, 0xAB, 0xD6,
+  0xA9, 0x79, 0xA8, 0x58, 0x9D, 0x89, 0xFE, 0x39, 0xA5, 0x94, 0x79, 0x0C, 0x65, 0x5A, 0xC0, 0xA1,
+  0xA9, 0x28, 0x7A, 0x0F, 0x9C, 0x59, 0xAB, 0x4B, 0xA2, 0x98, 0x6F, 0x99, 0x98, 0x9C, 0xF3, 0x0E,
+  0xA4, 0x97, 0x55, 0xC1, 0x13, 0xFE, 0x59, 0xE2, 0xFE, 0x00, 0xE6, 0xA9, 0x69, 0x17, 0xCC, 0xA2,
+  0x78, 0x12, 0x3A, 0xFE, 0xF5, 0x06, 0x9A, 0x8A, 0xC1, 0x6E, 0xFE, 0x39, 0x41, 0x9E, 0x6D, 0xAE,
+  0x87, 0x9A, 0x88, 0x9A, 0x88, 0x51, 0x7F, 0xA9, 0x88, 0xA4, 0x89, 0x96, 0x87, 0x9A, 0x88, 0xC0,
+  0x9D, 0x88, 0x02, 0x06, 0xA3, 0x79, 0xC0, 0x65, 0xC2, 0x28, 0x98, 0xB7, 0x99, 0xC7, 0xA3, 0x97,
+  0xA3, 0x99, 0xC0, 0x9D, 0x89, 0xA4, 0x87, 0xFE, 0xF5, 0xF1, 0x7E, 0xC0, 0x3F, 0xA3, 0x79, 0xA5,
+  0x5B, 0x2D, 0x8E, 0x89, 0xAA, 0x87, 0xFE, 0xE5, 0xD1, 0xA4, 0x97, 0x56, 0x1C, 0xC5, 0x15, 0x66,
+  0xC0, 0x04, 0x1C, 0xA7, 0x5B, 0x99, 0x7A, 0x1D, 0x19, 0xB5, 0xA7, 0xFE, 0xFE, 0x95, 0x3F, 0x5E,
+  0x04, 0x3C, 0x10, 0xFE, 0x39, 0x84, 0x07, 0xA5, 0x97, 0x56, 0xC1, 0x30, 0x99, 0x7A, 0xAC, 0xC5,
+  0xFE, 0xFC, 0xCB, 0x9E, 0x69, 0x69, 0x52, 0xA9, 0x79, 0x26, 0x99, 0x9A, 0xFE, 0x31, 0x44, 0x98,
+  0x78, 0x0C, 0x65, 0x3D, 0x00, 0x07, 0x55, 0xA4, 0x98, 0xA2, 0x87, 0x00, 0x9F, 0x5A, 0xA9, 0x4B,
+  0xA5, 0xA8, 0xC0, 0x96, 0x88, 0xFE, 0x30, 0xE1, 0xFE, 0xCC, 0x05, 0x32, 0x55, 0xC1, 0xA5, 0x97,
+  0x3A, 0x12, 0xA9, 0x69, 0x17, 0xC5, 0x6E, 0x17, 0xC2, 0x1C, 0x17, 0x28, 0x98, 0xA8, 0xFE, 0x49,
+  0x82, 0xFE, 0xEC, 0xE6, 0x9B, 0x9A, 0x16, 0xA4, 0x97, 0xFE, 0x59, 0xC2, 0x99, 0x3E, 0xAF, 0xA8,
+  0x93, 0x88, 0x9B, 0x99, 0x19, 0x7E, 0xA2, 0x79, 0x28, 0xAD, 0x88, 0xA3, 0x99, 0x94, 0x88, 0xA6,
+  0x79, 0x65, 0x9B, 0x98, 0x28, 0xA2, 0x69, 0xA6, 0x69, 0xA4, 0x69, 0x6E, 0x17, 0xC1, 0x28, 0x06,
+  0x96, 0xC6, 0x0F, 0x6E, 0x38, 0x5A, 0xFE, 0xDD, 0x90, 0xA5, 0xA8, 0x55, 0x7B, 0x69, 0x6E, 0x5B,
+  0x98, 0x79, 0xA6, 0x97, 0xA4, 0x88, 0x10, 0x26, 0x62, 0xC6, 0x69, 0x10, 0xC1, 0x04, 0x21, 0x9D,
+  0x99, 0x1D, 0x21, 0x04, 0xC1, 0x5A, 0x04, 0x39, 0xFE, 0x29, 0x03, 0x14, 0x2B, 0x5A, 0xC1, 0x30,
+  0x98, 0x69, 0xFE, 0x93, 0x07, 0xAF, 0xE5, 0x9C, 0x79, 0xA2, 0x88, 0xA8, 0x59, 0xA8, 0x57, 0x94,
+  0x8A, 0xFE, 0x20, 0xE3, 0x9C, 0x88, 0x0C, 0x55, 0x00, 0xC1, 0x6B, 0x21, 0x07, 0xA5, 0x98, 0x99,
+  0x89, 0xA3, 0x4A, 0xA9, 0x5A, 0x9D, 0x99, 0x23, 0x9B, 0xA8, 0x3C, 0xFE, 0xD4, 0x05, 0xA4, 0x87,
+  0x55, 0xC1, 0xA4, 0x87, 0xFE, 0x51, 0xA2, 0x9C, 0x0F, 0x28, 0x17, 0xC3, 0x6E, 0x17, 0x1C, 0xC5,
+  0x28, 0x99, 0xA9, 0xFE, 0x41, 0x42, 0x04, 0x1B, 0xA2, 0x97, 0x95, 0x6D, 0x20, 0xB2, 0x98, 0x93,
+  0x88, 0x9C, 0x88, 0xC0, 0xA5, 0x79, 0xA9, 0x89, 0xA3, 0x99, 0x99, 0x88, 0x98, 0xA7, 0xB0, 0x88,
+  0x24, 0xC0, 0xA5, 0x89, 0x56, 0x65, 0x9C, 0x88, 0x28, 0x5F, 0x3A, 0xA5, 0x69, 0x66, 0x69, 0x66,
+  0x28, 0x95, 0xD7, 0xA2, 0xB5, 0xA2, 0x89, 0x38, 0x21, 0xFE, 0xD5, 0x2F, 0xA9, 0x97, 0x51, 0x0B,
+  0x6E, 0xC1, 0xA2, 0x78, 0x15, 0x56, 0xA4, 0x78, 0x8C, 0x6A, 0xA6, 0xA8, 0xAE, 0x86, 0x9D, 0xA9,
+  0xC4, 0x15, 0xC2, 0x10, 0x0B, 0x10, 0x15, 0x01, 0x0B, 0xC0, 0x69, 0x01, 0x10, 0x9B, 0x79, 0xFE,
+  0x18, 0xC2, 0xA4, 0xA8, 0x6E, 0xC2, 0x7A, 0x99, 0x69, 0xFE, 0xC3, 0xE9, 0xA6, 0xB7, 0x4A, 0xAC,
+  0x58, 0x26, 0x8C, 0x6B, 0xFE, 0x08, 0x61, 0x21, 0x0C, 0x55, 0xC0, 0x07, 0x00, 0x07, 0x3D, 0x19,
+  0x35, 0x30, 0x97, 0x7A, 0xA8, 0x3A, 0xA5, 0x7A, 0x69, 0x6F, 0x9A, 0xA8, 0xFE, 0x39, 0x01, 0x16,
+  0xA3, 0x98, 0x55, 0xC1, 0xA4, 0x87, 0xFE, 0x49, 0x62, 0x9F, 0x0E, 0x28, 0x17, 0x1C, 0xC4, 0x6B,
+  0xC2, 0x1C, 0x23, 0x1C, 0x28, 0x9B, 0xA8, 0x9C, 0xF3, 0xFE, 0xE4, 0xC6, 0x9D, 0x99, 0x7E, 0xFE,
+  0x31, 0x21, 0xA5, 0x6D, 0x7D, 0x95, 0x99, 0xC0, 0xAA, 0x88, 0x84, 0x86, 0x94, 0x89, 0x8B, 0x7B,
+  0xA4, 0x88, 0x92, 0x97, 0xAB, 0x98, 0x0C, 0x9D, 0x89, 0xA9, 0x99, 0x9C, 0x77, 0x62, 0x10, 0xC0,
+  0x24, 0x28, 0x36, 0x17, 0x6F, 0x1C, 0x6F, 0x95, 0xD7, 0x00, 0xA4, 0x88, 0x07, 0x19, 0xFE, 0xBC,
+  0xAE, 0x15, 0x51, 0x0B, 0x6E, 0xC2, 0x0D, 0xA3, 0x88, 0x95, 0x8A, 0xFE, 0x29, 0x44, 0xFE, 0xF6,
+  0x53, 0x7E, 0x66, 0xC5, 0x15, 0xC1, 0x10, 0xC6, 0x55, 0x15, 0x96, 0x79, 0xFE, 0x10, 0x81, 0x28,
+  0xC2, 0x7A, 0x14, 0x00, 0xFE, 0xDC, 0x4A, 0xA5, 0x98, 0xAC, 0x39, 0x99, 0x89, 0xFE, 0x52, 0x26,
+  0x8F, 0x7B, 0xA5, 0x98, 0xA3, 0x98, 0x55, 0xC1, 0x7A, 0x3D, 0x07, 0x45, 0x9C, 0x88, 0x30, 0x14,
+  0x9A, 0x69, 0x17, 0x23, 0x69, 0x6F, 0x99, 0xA8, 0xFE, 0x41, 0x21, 0xFE, 0xDC, 0x45, 0xA2, 0x78,
+  0x65, 0xC1, 0xA3, 0x98, 0xFE, 0x41, 0x42, 0xA1, 0x0E, 0x28, 0x1C, 0x6B, 0xC6, 0x55, 0x56, 0x23,
+  0xC1, 0x28, 0x9C, 0x98, 0x9A, 0xE3, 0xFE, 0xDC, 0x86, 0x7E, 0x96, 0x6B, 0xFE, 0x10, 0x82, 0xB0,
+  0x88, 0x93, 0x88, 0x52, 0xC0, 0x88, 0xA6, 0xB2, 0x65, 0x8F, 0xBB, 0xFE, 0x32, 0x2A, 0xA5, 0x98,
+  0x93, 0xA8, 0xA7, 0x98, 0x56, 0x24, 0xAC, 0x89, 0x0F, 0x59, 0x9D, 0x99, 0x18, 0x56, 0xC0, 0x30,
+  0xA1, 0x6A, 0xAB, 0x4A, 0x65, 0x28, 0x0E, 0x38, 0xA6, 0x97, 0x9C, 0x79, 0x99, 0x89, 0xFE, 0x9C,
+  0x0C, 0x21, 0x9D, 0x98, 0x7F, 0xC4, 0x21, 0x9B, 0x89, 0xFE, 0x52, 0x67, 0x31, 0x21, 0x66, 0x21,
+  0xC1, 0x1C, 0xC2, 0x69, 0x1C, 0x15, 0xC1, 0x10, 0xC3, 0x01, 0x21, 0x91, 0x7A, 0xFE, 0x10, 0x61,
+  0x30, 0x56, 0xC1, 0x30, 0x9B, 0x7A, 0xA7, 0xB6, 0xFE, 0xFD, 0x4D, 0x31, 0x8E, 0x5A, 0x89, 0x6C,
+  0x9B, 0x99, 0xA4, 0x87, 0xA3, 0x98, 0xC1, 0x7A, 0x3D, 0xC0, 0x00, 0xC0, 0x1C, 0xA4, 0x59, 0x9E,
+  0xB7, 0x69, 0x0E, 0xA9, 0x5A, 0x65, 0xC0, 0xA2, 0x78, 0x97, 0xB9, 0xFE, 0x51, 0x61, 0xFE, 0xDC,
+  0x65, 0x2F, 0x23, 0xC0, 0x2F, 0x37, 0xFE, 0x31, 0x01, 0xA4, 0x1D, 0x28, 0x66, 0xC5, 0x28, 0x14,
+  0xA6, 0xA8, 0xAC, 0xA6, 0x14, 0x28, 0x23, 0x28, 0x9D, 0x99, 0x98, 0xE3, 0x1B, 0xA5, 0xA7, 0x8B,
+  0x3F, 0xFE, 0x19, 0x25, 0xA9, 0xA8, 0x92, 0x88, 0x6E, 0xA9, 0x7A, 0xFE, 0xC5, 0xD6, 0xA8, 0x96,
+  0xFE, 0x63, 0x6E, 0x98, 0x79, 0x1D, 0x93, 0xA8, 0x25, 0x9D, 0x99, 0x9A, 0x88, 0xAC, 0x88, 0x6B,
+  0x6E, 0xC0, 0x0F, 0x2C, 0x18, 0x51, 0x96, 0x97, 0x3A, 0xA6, 0x59, 0xC0, 0x97, 0xC7, 0x9C, 0xD5,
+  0xA7, 0x98, 0x9D, 0x89, 0x99, 0x79, 0xB6, 0xA6, 0x26, 0x9C, 0x98, 0x7F, 0xC3, 0x15, 0x10, 0x26,
+  0x99, 0x8A, 0x51, 0x26, 0x62, 0x6E, 0xC2, 0x1C, 0xC4, 0x69, 0xC2, 0x10, 0xC1, 0x56, 0x26, 0x8A,
+  0x6B, 0x85, 0x6C, 0x30, 0x56, 0xC1, 0x30, 0x99, 0x7A, 0xAD, 0xD5, 0xA7, 0x88, 0x90, 0x3C, 0x98,
+  0x98, 0x0D, 0x1C, 0x5A, 0x3D, 0xC4, 0x7B, 0x9D, 0x88, 0xA2, 0x59, 0x17, 0x0D, 0xA2, 0x79, 0x17,
+  0x23, 0xC0, 0x69, 0x34, 0x96, 0xB7, 0xFE, 0x61, 0xA1, 0xFE, 0xE4, 0x85, 0x2F, 0x65, 0xC0, 0x32,
+  0x2F, 0xFE, 0x28, 0xE1, 0xA7, 0x1D, 0xA3, 0x89, 0x55, 0x7B, 0xC2, 0x28, 0x23, 0x28, 0x56, 0xA5,
+  0xA8, 0xA9, 0xB7, 0x20, 0x28, 0xC1, 0x1C, 0x2D, 0xFE, 0xC4, 0x05, 0xA7, 0xB6, 0xFE, 0x41, 0x61,
+  0xA3, 0x5E, 0x0C, 0x96, 0x88, 0xA2, 0x88, 0xAE, 0x69, 0x1D, 0x7A, 0x09, 0x7F, 0xC0, 0x15, 0xAB,
+  0x99, 0x98, 0x88, 0x9B, 0x89, 0xA8, 0x88, 0x6E, 0xA3, 0x99, 0x0F, 0x6E, 0xC0, 0x65, 0x00, 0x15,
+  0x0D, 0x02, 0xA7, 0x6A, 0x3A, 0x24, 0xA8, 0x97, 0x9D, 0x89, 0x9B, 0x79, 0xA8, 0x97, 0xFE, 0xFE,
+  0x52, 0x61, 0x6F, 0xC3, 0x15, 0x6B, 0x15, 0x6F, 0x26, 0x1C, 0x21, 0xC5, 0x1C, 0x10, 0x26, 0x21,
+  0x15, 0xC2, 0x10, 0xC1, 0x56, 0x26, 0xFE, 0x73, 0x09, 0x8C, 0x6A, 0x30, 0x56, 0xC2, 0x9A, 0x79,
+  0x21, 0xC0, 0xA2, 0x98, 0x9D, 0x89, 0xA5, 0x6A, 0x25, 0x65, 0x38, 0x3D, 0xC2, 0x7B, 0x38, 0x0D,
+  0xAB, 0x4C, 0xA3, 0x78, 0x93, 0xE7, 0xAA, 0x49, 0xA4, 0x69, 0x23, 0x28, 0x23, 0x34, 0x94, 0xC6,
+  0xFE, 0x72, 0x22, 0x32, 0x55, 0xC1, 0x32, 0x1B, 0x35, 0x17, 0x28, 0xA3, 0x98, 0x52, 0x51, 0x28,
+  0xC4, 0x23, 0x41, 0x28, 0xC3, 0x25, 0xFE, 0xB3, 0xA4, 0xA9, 0xB6, 0xFE, 0x29, 0x01, 0xA9, 0x7C,
+  0x9C, 0x87, 0x20, 0xA6, 0x87, 0xAD, 0x7B, 0x65, 0xC0, 0x6E, 0x24, 0x9C, 0x97, 0x97, 0xA8, 0xAD,
+  0x88, 0x92, 0x88, 0xA2, 0x88, 0xA5, 0x89, 0x51, 0x6F, 0x18, 0xA3, 0x99, 0x0F, 0xC0, 0x1C, 0x04,
+  0x98, 0x87, 0xA3, 0x99, 0x9C, 0x88, 0x25, 0x75, 0xA8, 0xA7, 0x56, 0x07, 0x9B, 0x79, 0xFE, 0xBC,
+  0xAD, 0xAE, 0x97, 0x01, 0x7F, 0xC2, 0x6E, 0xC0, 0x6B, 0x15, 0x5B, 0x21, 0xC3, 0x1C, 0xC1, 0x21,
+  0xA4, 0x68, 0x93, 0x9A, 0x31, 0x21, 0x15, 0xC0, 0x10, 0xC2, 0x08, 0x26, 0xFE, 0x5A, 0x26, 0x30,
+  0xA7, 0xA7, 0x56, 0xC0, 0x2B, 0x41, 0x9A, 0x79, 0x07, 0x6E, 0x9A, 0x88, 0x0E, 0xAB, 0x4A, 0x94,
+  0xE6, 0x9B, 0xA7, 0x35, 0xA1, 0xA8, 0x5A, 0xC1, 0x07, 0x1C, 0xA3, 0x6A, 0x34, 0x61, 0x69, 0x6F,
+  0x23, 0x28, 0xC1, 0x6E, 0x92, 0xE7, 0xFE, 0x92, 0xA2, 0xB0, 0xA4, 0x51, 0xC1, 0x37, 0x9A, 0x7A,
+  0x25, 0x28, 0x56, 0xA9, 0xB7, 0x9D, 0x89, 0x20, 0x28, 0xC5, 0x6E, 0x28, 0xC2, 0x7F, 0x93, 0xC7,
+  0xFE, 0x9B, 0x04, 0xAF, 0xC3, 0xFE, 0x29, 0x02, 0xA9, 0x7B, 0x9B, 0x98, 0x97, 0x88, 0xA6, 0x89,
+  0xAE, 0x69, 0x1D, 0xC0, 0x66, 0xA3, 0x88, 0x93, 0xA8, 0xA4, 0x98, 0xA5, 0x88, 0x91, 0x88, 0x04,
+  0x7F, 0x5A, 0xC0, 0x69, 0x04, 0xA2, 0x88, 0xA3, 0x98, 0xA4, 0x78, 0x98, 0x98, 0x3C, 0xAA, 0x89,
+  0x04, 0x1C, 0x2D, 0x65, 0xA3, 0x98, 0x7F, 0x9C, 0x89, 0xA6, 0x77, 0x01, 0x7F, 0x56, 0x10, 0xC1,
+  0x15, 0xC0, 0x6B, 0x26, 0xA2, 0x78, 0x9D, 0xA9, 0x1C, 0xC2, 0x21, 0xA2, 0x78, 0xA2, 0x77, 0x9B,
+  0xAA, 0x8A, 0x5B, 0x92, 0x79, 0xFE, 0xDD, 0xD1, 0x21, 0x15, 0xC0, 0x10, 0xC2, 0x15, 0x9B, 0xB9,
+  0xFE, 0x39, 0x43, 0x9D, 0x8A, 0xA5, 0x97, 0x56, 0xC0, 0x7A, 0x3D, 0x9D, 0x89, 0xA2, 0x98, 0x9C,
+  0x78, 0x0E, 0xA9, 0x5A, 0xC0, 0x0B, 0x94, 0xD6, 0x21, 0xA3, 0x99, 0x3D, 0xC2, 0x0D, 0xAA, 0x4A,
+  0xA6, 0x5A, 0x28, 0xC1, 0x51, 0xA8, 0xA8, 0xA6, 0x97, 0x14, 0x28, 0x93, 0xF6, 0xFE, 0xAB, 0x43,
+  0xAB, 0xA6, 0x23, 0xC1, 0x3F, 0x94, 0x5C, 0xFE, 0x00, 0x83, 0x34, 0x65, 0x20, 0x28, 0xCC, 0xA2,
+  0x88, 0x94, 0xB8, 0xFE, 0x7A, 0x63, 0xFE, 0xFD, 0x27, 0xFE, 0x41, 0x62, 0xA3, 0x5D, 0x7D, 0x94,
+  0x88, 0xA5, 0x89, 0xAE, 0x79, 0xC1, 0xA2, 0x89, 0x99, 0x98, 0x98, 0x96, 0xAD, 0x9A, 0x97, 0x87,
+  0x2D, 0x18, 0x10, 0xC4, 0x65, 0x27, 0x24, 0xC0, 0xAB, 0x89, 0x2C, 0x56, 0x50, 0x9C, 0x98, 0x9C,
+  0x88, 0x9D, 0x98, 0xA3, 0x98, 0x9C, 0x79, 0xAD, 0x96, 0xFE, 0xFE, 0x52, 0x66, 0x55, 0x10, 0xC2,
+  0x32, 0x8E, 0x7A, 0x9C, 0x79, 0xB3, 0xB6, 0xA2, 0x88, 0xC0, 0x65, 0x32, 0x9C, 0x99, 0x97, 0x79,
+  0x93, 0x6A, 0x98, 0x79, 0xA9, 0xA7, 0x19, 0x26, 0x10, 0x15, 0xC0, 0x10, 0xC2, 0x61, 0x96, 0xB7,
+  0xFE, 0x20, 0xE2, 0xA2, 0x98, 0x2B, 0x5A, 0x66, 0x28, 0x99, 0x7A, 0x50, 0x6F, 0x33, 0x34, 0x65,
+  0xC0, 0x34, 0x99, 0xC7, 0x96, 0xC6, 0xA3, 0x98, 0x07, 0x3D, 0xC0, 0x38, 0x19, 0x17, 0x28, 0xC3,
+  0x6E, 0x7A, 0x34, 0x9C, 0x98, 0x98, 0xF3, 0xFE, 0xC3, 0xC4, 0x37, 0x51, 0xC1, 0xA4, 0x87, 0x8D,
+  0x4F, 0xFE, 0x00, 0xC5, 0xAD, 0x59, 0x28, 0xC0, 0x2D, 0x28, 0xC3, 0x34, 0xC1, 0x2D, 0x34, 0x2D,
+  0x34, 0x28, 0x3C, 0x97, 0xA8, 0xFE, 0x51, 0xA2, 0x1B, 0xFE, 0x6A, 0x22, 0xFE, 0x19, 0x05, 0xAC,
+  0x97, 0x91, 0x88, 0x0D, 0x18, 0xAA, 0x69, 0x61, 0x9A, 0x87, 0x96, 0x97, 0xAC, 0x89, 0x08, 0x90,
+  0x88, 0xA7, 0x89, 0x18, 0x56, 0xC5, 0x18, 0x97, 0x98, 0xA5, 0x88, 0xAB, 0x89, 0x66, 0x66, 0x3B,
+  0x27, 0x18, 0x30, 0x2D, 0x38, 0x9C, 0x79, 0x06, 0xFE, 0xEE, 0x12, 0x21, 0x9D, 0x98, 0x7F, 0xC1,
+  0x21, 0x9A, 0x79, 0x8B, 0x6B, 0x9A, 0x79, 0xA4, 0x98, 0xAF, 0x96, 0xAA, 0xA7, 0x89, 0x5B, 0x9B,
+  0x99, 0xA3, 0x88, 0xAC, 0xA7, 0x05, 0xA6, 0x77, 0x9C, 0xA9, 0x10, 0x15, 0xC0, 0x10, 0xC1, 0x5A,
+  0x79, 0x1D, 0xFE, 0x51, 0xC4, 0x95, 0x5B, 0xA8, 0xA7, 0xC1, 0x2B, 0x41, 0x99, 0x7A, 0xA4, 0x69,
+  0xAA, 0x49, 0x34, 0x65, 0xC2, 0x34, 0x9A, 0xB7, 0x19, 0x7A, 0xA4, 0x87, 0x07, 0x38, 0x19, 0x17,
+  0x34, 0x28, 0xC4, 0xA2, 0x88, 0x97, 0xB8, 0xFE, 0x41, 0x21, 0xFE, 0xDC, 0x45, 0xA3, 0x88, 0x51,
+  0xC1, 0x04, 0xFE, 0x51, 0xA2, 0x9C, 0x0F, 0x3C, 0x28, 0xC3, 0x6E, 0x34, 0x28, 0x34, 0xC4, 0x28,
+  0xC0, 0x3C, 0x9B, 0x98, 0xFE, 0x28, 0xE1, 0xFE, 0xEC, 0xC6, 0x96, 0x6B, 0x19, 0xB1, 0x99, 0x9D,
+  0x88, 0x94, 0x98, 0x55, 0xA6, 0x79, 0x66, 0x65, 0xAA, 0x88, 0xA3, 0x99, 0x10, 0x55, 0x18, 0x56,
+  0xC6, 0x13, 0x96, 0x87, 0xA6, 0x89, 0x18, 0xA2, 0x88, 0x08, 0x6F, 0xC0, 0x51, 0x2C, 0x9C, 0x88,
+  0x97, 0x97, 0xA2, 0x88, 0x9B, 0x89, 0xA8, 0x97, 0xFE, 0xBC, 0xEE, 0xAD, 0xA7, 0x9D, 0xA9, 0x56,
+  0x10, 0xC0, 0xA2, 0x78, 0xA3, 0x78, 0x0D, 0x9B, 0x8A, 0xA2, 0x87, 0x0D, 0x9B, 0x89, 0x0D, 0x32,
+  0xC0, 0x9D, 0xA9, 0x0D, 0x15, 0xC0, 0x10, 0xC1, 0x08, 0x15, 0xC0, 0x8D, 0xA9, 0xFE, 0x29, 0x02,
+  0x98, 0x7A, 0x30, 0xA6, 0xA7, 0x5A, 0xC0, 0x66, 0x38, 0x9D, 0x7A, 0xAF, 0x2B, 0xC0, 0x65, 0xC2,
+  0x34, 0x28, 0x34, 0x60, 0x97, 0xC7, 0x9C, 0xB7, 0x7E, 0x38, 0x9C, 0x78, 0x2E, 0x34, 0x28, 0x2D,
+  0x28, 0xC0, 0x2D, 0x28, 0x3C, 0x93, 0xC8, 0xFE, 0x69, 0xC1, 0xB7, 0xC2, 0x56, 0x69, 0x66, 0x6B,
+  0x37, 0x3E, 0xA5, 0x2E, 0xA6, 0x68, 0x61, 0x6F, 0xC0, 0x2D, 0x34, 0x28, 0x56, 0x34, 0xC4, 0x20,
+  0xA9, 0xB8, 0xC0, 0x98, 0x58, 0x2D, 0x92, 0xF6, 0xFE, 0xC3, 0xE5, 0xA6, 0xA6, 0xFE, 0x41, 0x41,
+  0x9C, 0x4D, 0x17, 0x59, 0x2C, 0x50, 0x7F, 0x14, 0x0F, 0x95, 0x97, 0x19, 0xA7, 0x99, 0x04, 0x13,
+  0x5A, 0xC4, 0x13, 0x9D, 0x88, 0x28, 0x10, 0xC0, 0x04, 0x10, 0x27, 0xA3, 0x88, 0x14, 0xC1, 0x93,
+  0x98, 0x19, 0x28, 0x9D, 0x88, 0x7F, 0xB7, 0xA5, 0xB7, 0xC5, 0xA4, 0x88, 0x9D, 0xA9, 0x5A, 0x10,
+  0x0D, 0x15, 0x21, 0xC0, 0x15, 0x21, 0x15, 0x0D, 0x10, 0xC4, 0x08, 0x7A, 0x26, 0x9B, 0xA9, 0xFE,
+  0x6A, 0x46, 0x8E, 0x4B, 0x14, 0x19, 0x38, 0xA5, 0xA8, 0xC0, 0x41, 0x3D, 0x9D, 0x89, 0x1C, 0x2E,
+  0x39, 0x61, 0xC1, 0x2D, 0x52, 0x28, 0xC0, 0x34, 0xC0, 0x9C, 0xA7, 0x0E, 0x9C, 0xB7, 0x50, 0xA3,
+  0x7A, 0x34, 0xC5, 0x2D, 0x91, 0xF7, 0xFE, 0x92, 0xA3, 0x3A, 0x2F, 0x69, 0x23, 0x37, 0x9B, 0x7A,
+  0xFE, 0x10, 0x82, 0xAD, 0x2B, 0x6F, 0xC3, 0x28, 0xA4, 0x88, 0xA2, 0x98, 0x28, 0x39, 0xC0, 0x34,
+  0xC2, 0x7E, 0x7E, 0x34, 0xA2, 0x88, 0x91, 0xD7, 0xFE, 0x93, 0x03, 0x3F, 0x95, 0x7C, 0xFE, 0x28,
+  0xE1, 0x9D, 0x6C, 0xAB, 0x98, 0xA5, 0x98, 0x0F, 0x65, 0x9B, 0x88, 0x98, 0x88, 0x51, 0xA5, 0x88,
+  0x66, 0xC0, 0xA2, 0x89, 0xA3, 0x88, 0x6F, 0xC2, 0x69, 0x18, 0x96, 0x87, 0xA3, 0x99, 0x18, 0x09,
+  0x6B, 0xC0, 0x04, 0xC0, 0x18, 0xA2, 0x88, 0xA5, 0x88, 0x93, 0xA8, 0x5B, 0xA3, 0x99, 0x9B, 0x87,
+  0x21, 0x00, 0xA9, 0x97, 0xB8, 0xB5, 0xB1, 0xB6, 0x6F, 0x9D, 0xA9, 0x5A, 0x7E, 0xC9, 0x08, 0x10,
+  0x26, 0x15, 0x8E, 0x5B, 0x86, 0x5B, 0xA5, 0xB7, 0xA5, 0x98, 0x91, 0x6C, 0xA2, 0x77, 0xA5, 0xA8,
+  0xA3, 0xA8, 0xC0, 0x3D, 0x19, 0xA2, 0x98, 0x38, 0x9C, 0x79, 0xAB, 0x4A, 0xA6, 0x5A, 0x34, 0xC0,
+  0x55, 0xAD, 0xD7, 0x96, 0x5A, 0x9D, 0x88, 0x34, 0x28, 0x34, 0x6E, 0x28, 0x60, 0x6F, 0x34, 0xC4,
+  0x39, 0x9B, 0xB8, 0x95, 0xF5, 0xFE, 0xBB, 0xA4, 0x37, 0x55, 0xC0, 0x23, 0xA3, 0x98, 0x93, 0x5D,
+  0xFE, 0x00, 0xA3, 0xAE, 0x4A, 0x34, 0xC3, 0x25, 0x27, 0xA4, 0x97, 0x95, 0x6A, 0x9D, 0xB8, 0xA2,
+  0x78, 0x39, 0xC0, 0x34, 0xC3, 0xA2, 0x88, 0x1E, 0xFE, 0x61, 0xE2, 0xFE, 0xEC, 0xE6, 0x97, 0x8B,
+  0x9D, 0x89, 0x3D, 0x96, 0x4C, 0x43, 0xA2, 0x87, 0xC0, 0x66, 0xA2, 0x88, 0xA3, 0x89, 0x65, 0x6E,
+  0x10, 0xC1, 0xA2, 0x88, 0xA2, 0x89, 0xA2, 0x78, 0x13, 0x6E, 0x9C, 0x88, 0x99, 0x97, 0xA9, 0x8A,
+  0x10, 0xC5, 0x04, 0x18, 0x3C, 0x04, 0x2C, 0x9C, 0x89, 0x98, 0x96, 0x21, 0x05, 0xC0, 0xAC, 0x97,
+  0xB6, 0xC5, 0xAF, 0xA6, 0x6F, 0x9D, 0xA9, 0x5A, 0x7E, 0xC4, 0x08, 0xC0, 0x10, 0x26, 0x15, 0x91,
+  0x6B, 0x87, 0x5C, 0x05, 0xFE, 0x82, 0xA6, 0xB3, 0xE5, 0x95, 0x6B, 0x05, 0xA2, 0x98, 0xA7, 0xA8,
+  0x2B, 0x23, 0x1C, 0x19, 0x7E, 0xA3, 0x99, 0x30, 0x19, 0xA7, 0x6A, 0xA7, 0x5A, 0x34, 0xC0, 0x27,
+  0x9C, 0x78, 0x34, 0xC2, 0x69, 0x34, 0x6E, 0x34, 0xC3, 0x25, 0x34, 0xA2, 0x88, 0x94, 0xB7, 0xFE,
+  0x41, 0x21, 0xFE, 0xDC, 0x65, 0x7F, 0x2F, 0x69, 0x23, 0xA4, 0x87, 0xFE, 0x62, 0x02, 0x12, 0x08,
+  0x34, 0xC4, 0x66, 0x25, 0x34, 0x96, 0xC7, 0xC0, 0xA2, 0x78, 0x17, 0x39, 0xC0, 0x34, 0xC1, 0x08,
+  0x9A, 0x98, 0x9A, 0xF2, 0x37, 0x9B, 0x8A, 0x1E, 0xA3, 0xA8, 0x42, 0x97, 0x5B, 0x93, 0x4E, 0x19,
+  0x35, 0xA2, 0x89, 0x6F, 0xC0, 0x69, 0x10, 0x15, 0xC0, 0x10, 0xC0, 0x1C, 0xA2, 0x88, 0x3F, 0x21,
+  0x10, 0x18, 0x56, 0xC7, 0x96, 0x97, 0xAC, 0x88, 0xA6, 0x78, 0x9D, 0x99, 0x01, 0x1C, 0x30, 0x21,
+  0xA3, 0x5B, 0x9C, 0xA7, 0xA8, 0xB6, 0xB6, 0xA5, 0xB1, 0xB6, 0x6F, 0x61, 0x55, 0x6B, 0x01, 0xC0,
+  0x10, 0xA2, 0x77, 0x6F, 0x9C, 0x88, 0x35, 0x8A, 0x5B, 0x95, 0x8A, 0xAA, 0xB6, 0xFE, 0xD4, 0x2A,
+  0xA6, 0xA6, 0x9C, 0x79, 0xC0, 0x38, 0x9D, 0x89, 0x28, 0x7E, 0x38, 0x42, 0xA3, 0x97, 0x9C, 0x79,
+  0x1C, 0xC0, 0x0D, 0x66, 0x33, 0xA7, 0x5A, 0x34, 0x55, 0x34, 0xCA, 0x3C, 0xA9, 0xA8, 0x34, 0x3C,
+  0x1D, 0xFE, 0x82, 0x62, 0xB2, 0xC3, 0x46, 0x32, 0x23, 0x2F, 0x37, 0xFE, 0x31, 0x01, 0x0F, 0xA5,
+  0x89, 0x34, 0xC5, 0x3C, 0x34, 0x97, 0xC8, 0xC0, 0x69, 0x66, 0xA3, 0x79, 0xA6, 0x68, 0xA3, 0x79,
+  0x39, 0xC2, 0x92, 0xE6, 0xFE, 0xBB, 0xC4, 0xA6, 0xA7, 0x1E, 0x7F, 0x7E, 0xA3, 0x97, 0x99, 0x7B,
+  0xFE, 0x20, 0xA1, 0x36, 0x75, 0x1C, 0xA3, 0x89, 0xA2, 0x88, 0x6F, 0xC0, 0x10, 0xC1, 0x1C, 0x10,
+  0x9C, 0x87, 0x2D, 0x10, 0x1C, 0xA3, 0x88, 0x7F, 0x13, 0xC0, 0x5A, 0xC0, 0x04, 0x13, 0x9D, 0x88,
+  0x2D, 0x10, 0x18, 0xA4, 0x88, 0x94, 0x98, 0x04, 0xAA, 0x88, 0x95, 0x98, 0x9A, 0x78, 0xAD, 0x3B,
+  0x96, 0xB8, 0x99, 0xB6, 0xA8, 0xA6, 0xB6, 0xB6, 0xAF, 0xA6, 0xA4, 0x88, 0xC0, 0x26, 0x21, 0x51,
+  0x96, 0x79, 0x91, 0x6B, 0x90, 0x6A, 0x98, 0x89, 0xA4, 0x97, 0xFE, 0x9B, 0x28, 0xAD, 0xD5, 0x52,
+  0x55, 0xA3, 0xA8, 0x9D, 0x69, 0xFE, 0x28, 0xE2, 0x42, 0xA8, 0x97, 0x9C, 0x88, 0x99, 0x7A, 0xA2,
+  0x98, 0x07, 0x9C, 0x78, 0xA5, 0x5A, 0xA6, 0x69, 0x65, 0xA3, 0x79, 0xA3, 0x79, 0x34, 0xC2, 0x7E,
+  0x34, 0xC5, 0x39, 0x3C, 0x34, 0x39, 0xA3, 0xA9, 0x41, 0x9A, 0x97, 0x96, 0xF4, 0xFE, 0xC3, 0xA4,
+  0xA9, 0x86, 0x32, 0xC0, 0x59, 0x7F, 0x99, 0x6A, 0x31, 0x39, 0x66, 0x39, 0xC0, 0x34, 0xC2, 0x39,
+  0x34, 0xC0, 0x97, 0xC8, 0xC2, 0x15, 0xC0, 0x0B, 0xA5, 0x6A, 0xC0, 0x34, 0xA3, 0x88, 0x92, 0xC8,
+  0xFE, 0x7A, 0x62, 0xB4, 0xC2, 0x99, 0x8B, 0x35, 0x56, 0x6E, 0x35, 0x8F, 0x4E, 0x9D, 0x0F, 0xAB,
+  0x5A, 0x3F, 0x9A, 0xA7, 0x9C, 0xB7, 0x6F, 0xA3, 0x99, 0xA2, 0x78, 0xC1, 0x50, 0x9C, 0x98, 0x6E,
+  0xA5, 0x8A, 0xC0, 0x65, 0xC1, 0x1C, 0xA2, 0x88, 0xA2, 0x88, 0x6F, 0xC0, 0x7E, 0x97, 0x98, 0x1C,
+  0x18, 0x04, 0x10, 0x28, 0x04, 0xA6, 0x88, 0xA2, 0x88, 0x90, 0x97, 0xAA, 0x2B, 0xA6, 0x69, 0x60,
+  0x98, 0xA8, 0x11, 0xA6, 0x96, 0xAD, 0xA7, 0xAB, 0xB8, 0x41, 0x97, 0x7A, 0x95, 0x8A, 0x98, 0x79,
+  0x51, 0x14, 0xB0, 0xC4, 0x06, 0x25, 0x51, 0x25, 0x11, 0x93, 0x4C, 0x8F, 0x3C, 0x9C, 0x69, 0x20,
+  0x7A, 0x21, 0xA1, 0x8A, 0x50, 0x34, 0x9D, 0x97, 0xA7, 0x6A, 0xAC, 0x2B, 0x61, 0x39, 0xC1, 0x66,
+  0xC1, 0x51, 0x34, 0xC1, 0x39, 0xC1, 0x34, 0xA3, 0x98, 0xA6, 0xA8, 0x34, 0x39, 0x62, 0x08, 0x93,
+  0xC7, 0xFE, 0x59, 0x81, 0xFE, 0xE4, 0x85, 0x37, 0x66, 0xC0, 0x55, 0xA4, 0x87, 0x8B, 0x4F, 0xFE,
+  0x00, 0xE6, 0xAE, 0x48, 0x34, 0x39, 0xC0, 0x34, 0x39, 0x6F, 0x00, 0x39, 0xC1, 0x96, 0xC8, 0xC4,
+  0x15, 0xA3, 0x79, 0x34, 0x00, 0x08, 0x0F, 0xFE, 0x31, 0x01, 0x37, 0x56, 0x23, 0x56, 0x0E, 0x7A,
+  0x96, 0x6B, 0x19, 0x34, 0x0D, 0x08, 0x9D, 0x98, 0x22, 0x9A, 0xA7, 0x79, 0x6B, 0x65, 0x31, 0x16,
+  0x28, 0x1C, 0xA3, 0x89, 0x55, 0xC1, 0x28, 0xC0, 0xA3, 0x88, 0xA2, 0x99, 0xA3, 0x78, 0x9D, 0x99,
+  0x28, 0xA7, 0x89, 0xA2, 0x88, 0x18, 0x9B, 0x98, 0x2D, 0xA9, 0x8A, 0x04, 0x18, 0x96, 0x97, 0xA9,
+  0x3B, 0x00, 0xC0, 0x60, 0x2D, 0x52, 0x5F, 0x61, 0x60, 0xC1, 0x14, 0xAD, 0xC5, 0xB1, 0xE5, 0xA8,
+  0xA7, 0x65, 0x56, 0x9B, 0x7A, 0x95, 0x5A, 0x92, 0x3B, 0x9A, 0x6A, 0xA2, 0x89, 0x21, 0xA5, 0xA8,
+  0x9A, 0x79, 0xA4, 0x6A, 0x7A, 0x9E, 0x76, 0xAF, 0x2C, 0x28, 0xC0, 0x34, 0xC0, 0x6E, 0xC3, 0x7A,
+  0xAB, 0xB7, 0x3C, 0x34, 0x39, 0xC0, 0x34, 0x39, 0xC1, 0x34, 0x39, 0xC0, 0x03, 0x54, 0x19, 0xFE,
+  0xA3, 0x03, 0xAE, 0xA4, 0x37, 0x66, 0xC0, 0x2F, 0x37, 0xFE, 0x31, 0x01, 0xA6, 0x0E, 0xA6, 0x78,
+  0x39, 0xC1, 0x6B, 0x28, 0x9D, 0xA8, 0x51, 0x65, 0x66, 0x6F, 0x61, 0xC5, 0x15, 0x21, 0x34, 0x08,
+  0x00, 0x2C, 0xFE, 0xB3, 0xA4, 0xA8, 0xA6, 0x23, 0x7F, 0xC0, 0xA2, 0x77, 0x9B, 0x9A, 0xFE, 0x39,
+  0x00, 0x2B, 0x08, 0x39, 0x05, 0xC0, 0x39, 0x9C, 0xA7, 0x61, 0x0B, 0x39, 0x08, 0x39, 0x3F, 0x19,
+  0xA2, 0x88, 0xA2, 0x88, 0x6B, 0x7E, 0xC0, 0x2D, 0x7F, 0xC0, 0x19, 0x10, 0xC0, 0x6F, 0xC0, 0x9B,
+  0x98, 0x35, 0xA3, 0x99, 0x13, 0x04, 0x97, 0x88, 0xAE, 0x2A, 0x00, 0x39, 0x25, 0x7F, 0xA4, 0x7A,
+  0x69, 0x3C, 0x28, 0x14, 0xAD, 0xC5, 0xAA, 0xC7, 0xA8, 0xA6, 0x9D, 0x89, 0x9A, 0x69, 0x1A, 0x96,
+  0x5A, 0x30, 0x9D, 0x7A, 0xA4, 0x78, 0x27, 0x9D, 0x97, 0x9D, 0xA7, 0xC0, 0x0C, 0x20, 0x66, 0x19,
+  0xA7, 0x6A, 0xA7, 0x5A, 0x05, 0xC0, 0x65, 0xC4, 0x7A, 0xAD, 0xB7, 0x94, 0x59, 0x52, 0x39, 0xC7,
+  0x0D, 0x26, 0xFE, 0x41, 0x21, 0xFE, 0xDC, 0x45, 0xA4, 0x77, 0x37, 0x32, 0x5A, 0x3A, 0x97, 0x6B,
+  0x2C, 0x03, 0x39, 0xC0, 0x05, 0x28, 0x9B, 0xA8, 0x9D, 0xA8, 0x15, 0xC0, 0x1A, 0xC0, 0x15, 0x26,
+  0xC3, 0x21, 0xC0, 0x26, 0x1A, 0x21, 0x17, 0xA7, 0x69, 0x93, 0xC8, 0xFE, 0x6A, 0x02, 0xFE, 0xEC,
+  0xC6, 0x23, 0x6E, 0x2F, 0x7E, 0xC0, 0x8F, 0x6D, 0xFE, 0x08, 0x82, 0xB0, 0x2B, 0x39, 0xC0, 0xA2,
+  0x98, 0x42, 0x08, 0xC1, 0x39, 0x08, 0x9C, 0x97, 0x97, 0xC7, 0x9D, 0xB8, 0xA2, 0x88, 0x6E, 0x3C,
+  0x55, 0xC0, 0xA2, 0x89, 0x28, 0x50, 0x7F, 0x3C, 0x01, 0x30, 0x41, 0xA5, 0x99, 0xA2, 0x78, 0x7F,
+  0xA4, 0x88, 0x98, 0x97, 0xA1, 0x5A, 0xAC, 0x4A, 0x5A, 0x9D, 0xA8, 0x19, 0x1B, 0xC1, 0x2D, 0x19,
+  0xA5, 0xA7, 0xA9, 0xB7, 0x9D, 0x99, 0x9D, 0x69, 0x9C, 0x79, 0x25, 0x52, 0xA2, 0x89, 0xA3, 0x88,
+  0x20, 0xC0, 0x1B, 0x9C, 0x96, 0xC0, 0xA3, 0x8A, 0x20, 0x1B, 0x20, 0x9C, 0x97, 0x0D, 0x6B, 0x36,
+  0xA7, 0x6A, 0x39, 0xA2, 0x88, 0x00, 0x39, 0xC2, 0x51, 0x7F, 0x39, 0xC9, 0x91, 0xF6, 0xFE, 0x92,
+  0xA2, 0xB1, 0xB4, 0x37, 0xC1, 0x2F, 0x3F, 0xFE, 0x61, 0xE2, 0x1E, 0x0D, 0x39, 0x6F, 0x9A, 0xB8,
+  0x1A, 0x15, 0x6F, 0xC1, 0x1A, 0x21, 0xC0, 0x26, 0xC5, 0x21, 0x26, 0x21, 0x1A, 0xA3, 0x89, 0x56,
+  0x9B, 0xE4, 0xFE, 0xD4, 0x45, 0x2F, 0xC0, 0x7A, 0xC0, 0xA2, 0x77, 0x9A, 0x89, 0xFE, 0x30, 0xC0,
+  0xA6, 0x0D, 0x0D, 0x62, 0xAB, 0xB7, 0x03, 0x39, 0xC1, 0x08, 0x9C, 0x97, 0x14, 0x10, 0xA5, 0x89,
+  0x6F, 0x13, 0x10, 0x04, 0x24, 0x9C, 0x88, 0x19, 0x0B, 0x9D, 0xA8, 0x9B, 0xB7, 0x55, 0x36, 0x75,
+  0x65, 0x7F, 0x01, 0x9D, 0xA9, 0x25, 0xAF, 0x2B, 0xA2, 0x89, 0x08, 0x17, 0x19, 0xA3, 0x8A, 0x20,
+  0x66, 0xC1, 0x51, 0x41, 0xC0, 0x7E, 0x07, 0x1B, 0x20, 0xC0, 0x1B, 0xC2, 0x0C, 0x1B, 0xC3, 0x28,
+  0x00, 0xA2, 0x79, 0x9C, 0xA7, 0x50, 0x25, 0xA8, 0x59, 0x39, 0x0D, 0x05, 0xC0, 0x39, 0x7A, 0x05,
+  0xC0, 0x39, 0xC6, 0x0D, 0x96, 0xB8, 0xFE, 0x30, 0xC0, 0x16, 0xA5, 0x87, 0x66, 0xC1, 0x66, 0x9D,
+  0x79, 0xFE, 0x18, 0xA1, 0xAC, 0x1C, 0x0D, 0x34, 0x9A, 0xA7, 0x15, 0x6F, 0xC6, 0x26, 0xC9, 0x1A,
+  0x7F, 0x99, 0xA7, 0xFE, 0x8A, 0xE3, 0x3F, 0x23, 0x32, 0x6E, 0xC1, 0x8D, 0x6E, 0xFE, 0x00, 0x83,
+  0x08, 0x56, 0x34, 0x00, 0xC1, 0x39, 0xA2, 0x89, 0x22, 0x9C, 0xB7, 0xAA, 0x79, 0x61, 0x10, 0xC0,
+  0x13, 0xC1, 0x10, 0x9A, 0x97, 0x36, 0x0D, 0x08, 0x00, 0x08, 0x34, 0x9B, 0xB7, 0x9B, 0xB8, 0x60,
+  0x22, 0x08, 0x55, 0x2E, 0x9A, 0xB7, 0x19, 0x7F, 0xC0, 0x11, 0x1B, 0xC2, 0x20, 0xC1, 0x1B, 0xCA,
+  0x0C, 0x28, 0x34, 0x1B, 0xC0, 0x27, 0x55, 0x9D, 0xA8, 0x9D, 0x97, 0xA2, 0x77, 0x33, 0xA4, 0x6A,
+  0x3A, 0x26, 0xC0, 0x3A, 0x17, 0x00, 0x08, 0x00, 0xC2, 0x05, 0x08, 0xC0, 0x1D, 0xFE, 0x82, 0x62,
+  0xB3, 0xC3, 0x5A, 0x37, 0xC0, 0x56, 0x3F, 0x8E, 0x4E, 0xFE, 0x00, 0xC5, 0x0D, 0x17, 0x26, 0x1A,
+  0x26, 0x21, 0xC6, 0x26, 0xC5, 0x1A, 0x26, 0xC2, 0x6E, 0x06, 0xA1, 0xE4, 0x2F, 0x65, 0x32, 0x37,
+  0xC0, 0x3F, 0x9A, 0x7A, 0x30, 0xA6, 0x0D, 0xAA, 0x59, 0x08, 0xC0, 0x00, 0xC1, 0xA2, 0x88, 0x22,
+  0x9C, 0xB7, 0xA4, 0x88, 0x9D, 0x88, 0x3C, 0x01, 0xA2, 0x89, 0xA3, 0x98, 0x13, 0x5A, 0x7E, 0x95,
+  0xA8, 0xA9, 0x3A, 0x14, 0x00, 0x08, 0xC0, 0x14, 0x0D, 0x19, 0x08, 0x2E, 0x98, 0xB6, 0x61, 0x28,
+  0xA4, 0x6A, 0x1B, 0x28, 0x0C, 0x1B, 0xD0, 0x50, 0x9E, 0x96, 0x34, 0x1B, 0xC0, 0x18, 0xC1, 0x1B,
+  0x18, 0x3B, 0x9D, 0x96, 0x6B, 0xA4, 0x69, 0x26, 0x66, 0x1A, 0x15, 0x26, 0xA6, 0x69, 0xA4, 0x78,
+  0xC1, 0x56, 0x23, 0x17, 0x99, 0xA8, 0xFE, 0x38, 0xE1, 0x16, 0xA6, 0x86, 0x52, 0xC1, 0x2F, 0x66,
+  0xFE, 0x28, 0xE1, 0x12, 0xA3, 0x88, 0x1A, 0x21, 0x26, 0xC0, 0x21, 0xC0, 0x26, 0x21, 0xC3, 0x26,
+  0xC4, 0x15, 0x3D, 0x26, 0xC3, 0x7A, 0x98, 0xA7, 0xFE, 0x93, 0x04, 0x37, 0x2F, 0x37, 0xC0, 0x6E,
+  0x7A, 0x8E, 0x5D, 0xFE, 0x00, 0x62, 0xAA, 0x59, 0x3A, 0x23, 0x08, 0xC0, 0x00, 0xA2, 0x87, 0x9B,
+  0xA8, 0x92, 0xE5, 0x28, 0xC0, 0x19, 0xC0, 0x14, 0xA2, 0x87, 0x01, 0xA6, 0x89, 0xA2, 0x88, 0x97,
+  0x97, 0xA9, 0x3B, 0xA6, 0x6A, 0x00, 0x08, 0x03, 0x08, 0xC0, 0x2E, 0x19, 0xC0, 0x28, 0xC0, 0x1B,
+  0x5A, 0xC0, 0x28, 0x0C, 0x1B, 0xCE, 0x0C, 0x34, 0x28, 0x34, 0x1B, 0x18, 0x1B, 0x27, 0x6E, 0x7F,
+  0x6E, 0xC0, 0x3B, 0x27, 0x9B, 0x96, 0x0D, 0x36, 0x26, 0xC1, 0x1A, 0xC0, 0xA3, 0x79, 0xA5, 0x79,
+  0x17, 0x26, 0x1A, 0x15, 0x9A, 0xB6, 0xFE, 0x9A, 0xE3, 0xAF, 0xB4, 0x3C, 0x66, 0xC0, 0x2F, 0x37,
+  0x0A, 0xFE, 0x00, 0x42, 0x26, 0xD2, 0x02, 0x3D, 0x15, 0x26, 0xC2, 0x2B, 0x9B, 0xA9, 0xA2, 0xC3,
+  0xFE, 0xDC, 0x65, 0xC0, 0x37, 0xC1, 0xA2, 0x87, 0x9B, 0x9A, 0xFE, 0x49, 0x41, 0x1D, 0x1A, 0x15,
+  0xA3, 0x89, 0xA7, 0x59, 0x08, 0xC0, 0x6F, 0x2E, 0x97, 0xC7, 0xA4, 0x78, 0xA6, 0x88, 0x66, 0x9D,
+  0x88, 0x9C, 0x98, 0x19, 0xA3, 0x98, 0xA3, 0x8A, 0x99, 0x88, 0xB0, 0x3B, 0xA3, 0x78, 0x08, 0xC1,
+  0x03, 0x36, 0x28, 0xA7, 0x7A, 0x3B, 0x25, 0x0C, 0x6F, 0xC0, 0x1B, 0x9D, 0x97, 0xC0, 0x20, 0x1B,
+  0xC9, 0x20, 0xC0, 0x0C, 0x34, 0xC0, 0x6F, 0x34, 0x18, 0x27, 0x3B, 0x6F, 0x7E, 0xC2, 0x5A, 0xC0,
+  0x7B, 0x0C, 0x34, 0x9C, 0x97, 0xA4, 0x69, 0x26, 0xC0, 0x66, 0x26, 0x1A, 0xC2, 0x2E, 0x99, 0xA8,
+  0xA7, 0xE3, 0x23, 0xA4, 0x77, 0x3C, 0x66, 0x3C, 0x2F, 0x2A, 0x3E, 0x06, 0x2B, 0x26, 0xC8, 0x21,
+  0xC0, 0x26, 0xC3, 0x6F, 0x15, 0x3D, 0xC0, 0x02, 0x26, 0xC3, 0x2E, 0x97, 0xB8, 0xFE, 0x82, 0xC3,
+  0x37, 0x2F, 0x3C, 0x37, 0x3C, 0x04, 0x94, 0x7C, 0xFE, 0x18, 0x81, 0xA3, 0x5B, 0x26, 0x15, 0x21,
+  0xA9, 0x59, 0xA3, 0x89, 0x65, 0xA2, 0x78, 0x39, 0xA4, 0x98, 0xA4, 0x79, 0x65, 0x10, 0x1C, 0x2D,
+  0x9C, 0x88, 0xA2, 0x98, 0xA7, 0xA7, 0x9E, 0x4B, 0x14, 0x03, 0x08, 0x14, 0x36, 0x76, 0xA9, 0x7B,
+  0x6E, 0x9A, 0x97, 0x60, 0x3B, 0x9C, 0x87, 0x6F, 0xC0, 0x00, 0x28, 0x00, 0xA2, 0x89, 0xC6, 0x20,
+  0xC0, 0x1B, 0x54, 0x34, 0xC0, 0x0C, 0x20, 0x34, 0x1B, 0x07, 0x0F, 0xC0, 0x5A, 0xC4, 0x7F, 0x9D,
+  0x97, 0x08, 0x05, 0x61, 0x9D, 0x97, 0x31, 0x26, 0xC5, 0x60, 0x9B, 0xC7, 0x25, 0xAC, 0x94, 0x3C,
+  0xC1, 0x37, 0xC0, 0x91, 0x5D, 0xFE, 0x00, 0x42, 0xA9, 0x6A, 0x26, 0xC9, 0x0E, 0x3D, 0x26, 0xC1,
+  0x32, 0xC0, 0x26, 0x3D, 0xC0, 0x02, 0x3D, 0x15, 0xA2, 0x79, 0x26, 0xC1, 0x32, 0x09, 0x9E, 0xC5,
+  0xFE, 0xCC, 0x25, 0x23, 0x37, 0xC0, 0x3C, 0xC0, 0x3F, 0x8C, 0x4E, 0x90, 0x1F, 0x1A, 0x26, 0x1A,
+  0xC0, 0xA7, 0x6A, 0xA5, 0x78, 0x99, 0xA8, 0x11, 0xA7, 0x99, 0xA3, 0x99, 0xA2, 0x88, 0x10, 0x24,
+  0x9A, 0x78, 0xA8, 0xC5, 0xFE, 0xCC, 0x2A, 0x9D, 0x89, 0x1D, 0xB0, 0x3A, 0x6F, 0x19, 0x22, 0x98,
+  0xB7, 0x1B, 0x0F, 0x0C, 0x34, 0x0C, 0x1B, 0x3B, 0x9D, 0x98, 0x00, 0x6F, 0x1B, 0x34, 0x69, 0x0C,
+  0x1B, 0xC0, 0x20, 0x1B, 0xC1, 0x0C, 0x39, 0x2D, 0x34, 0x0C, 0x1B, 0x20, 0x00, 0x20, 0x16, 0x59,
+  0xC2, 0x0F, 0x0C, 0xC0, 0x0F, 0x0C, 0x9A, 0xA6, 0x39, 0xA4, 0x8A, 0x0C, 0x9D, 0x99, 0x00, 0x9C,
+  0x96, 0x09, 0xA3, 0x7A, 0x26, 0xC2, 0x7A, 0x11, 0xAF, 0xF2, 0x37, 0x6E, 0xC2, 0x9D, 0x99, 0x56,
+  0xFE, 0x20, 0xC1, 0x09, 0x32, 0x26, 0xC9, 0x02, 0x3D, 0x0E, 0x26, 0x32, 0x9D, 0xA8, 0x32, 0x15,
+  0x3D, 0x02, 0xC1, 0x3D, 0x26, 0xC3, 0x35, 0x98, 0xA7, 0xAE, 0xE1, 0xB3, 0xE2, 0x5A, 0x3C, 0xC1,
+  0x04, 0x23, 0xFE, 0x49, 0x61, 0x24, 0x2E, 0x26, 0xC0, 0x65, 0x9B, 0xB8, 0xA7, 0xA6, 0xA2, 0x88,
+  0x9D, 0x89, 0x9C, 0x88, 0x53, 0x1C, 0xC0, 0x28, 0xFE, 0xD4, 0x2A, 0xA8, 0x96, 0x8A, 0x3C, 0x90,
+  0x1D, 0x2E, 0xA2, 0x79, 0x17, 0x93, 0xE5, 0xA8, 0x6A, 0xA4, 0x8A, 0xC0, 0x9A, 0x96, 0xC0, 0x1B,
+  0x0C, 0x1B, 0x9C, 0x97, 0x00, 0xA2, 0x89, 0x5A, 0x1B, 0x55, 0x34, 0xC5, 0x6E, 0x05, 0x14, 0x1B,
+  0x18, 0x27, 0x20, 0x00, 0x0F, 0x5A, 0xC5, 0x0F, 0x3B, 0x39, 0x14, 0x0F, 0x16, 0x0C, 0x07, 0x27,
+  0x9C, 0x97, 0x9E, 0x86, 0x21, 0x26, 0xC1, 0x7F, 0x99, 0xA7, 0xA5, 0xE4, 0xFE, 0xD4, 0x45, 0x04,
+  0x3C, 0xC1, 0x52, 0x37, 0x8D, 0x4F, 0xFE, 0x00, 0x43, 0x35, 0x26, 0xC3, 0x1A, 0xC0, 0x2D, 0x26,
+  0xC0, 0x2D, 0x15, 0x3D, 0xC1, 0xA5, 0x6A, 0x21, 0x3D, 0x1A, 0x09, 0x02, 0xC1, 0x09, 0x3D, 0x0E,
+  0x32, 0x2D, 0x26, 0xC0, 0x32, 0x21, 0x99, 0xC6, 0xFE, 0xB3, 0x84, 0x23, 0x37, 0x3C, 0xC1, 0x04,
+  0x97, 0x8B, 0xFE, 0x28, 0xC1, 0x9F, 0x4C, 0xA6, 0x79, 0xC0, 0x29, 0xAF, 0xC5, 0xFE, 0xFE, 0xD5,
+  0x9D, 0xA9, 0x55, 0x9C, 0x78, 0x93, 0x7A, 0x8B, 0x6B, 0x95, 0x8B, 0xAB, 0xB6, 0xFE, 0xF4, 0xAB,
+  0x56, 0xFE, 0x39, 0x23, 0x9D, 0x3C, 0xA5, 0x88, 0x26, 0x9A, 0xB6, 0x7A, 0x16, 0x0F, 0x07, 0x99,
+  0xA6, 0xA8, 0x6A, 0x0F, 0x0C, 0x0F, 0x9B, 0x97, 0xA4, 0x79, 0x07, 0x50, 0x27, 0x65, 0xC0, 0x5A,
+  0x65, 0xC0, 0x39, 0x0C, 0x18, 0x1B, 0xC1, 0x27, 0xA2, 0x88, 0x16, 0x08, 0xA4, 0x79, 0x0F, 0x5A,
+  0xC2, 0x0F, 0x0C, 0x7F, 0x3B, 0x9A, 0x96, 0xA5, 0x8A, 0x1B, 0x0C, 0xC2, 0x51, 0x18, 0x9B, 0xA7,
+  0xA2, 0x78, 0xA6, 0x5A, 0x26, 0x35, 0x09, 0x9D, 0xD5, 0xFE, 0xBB, 0x84, 0x04, 0x3C, 0xC1, 0x37,
+  0x23, 0x9B, 0x7B, 0xFE, 0x10, 0x61, 0x21, 0x32, 0x26, 0x6B, 0x26, 0xC0, 0x32, 0x09, 0xC0, 0x32,
+  0xC0, 0x2D, 0xC0, 0x09, 0x3D, 0xC1, 0x32, 0x0E, 0x02, 0x09, 0xC5, 0x15, 0x32, 0x2D, 0x0E, 0x26,
+  0xC0, 0xA2, 0x78, 0x99, 0xB8, 0xA5, 0xD3, 0x1E, 0x5A, 0x3C, 0xC2, 0x7A, 0x93, 0x7C, 0xFE, 0x18,
+  0x81, 0x09, 0xA5, 0x79, 0x1D, 0xFE, 0xD5, 0x70, 0xAB, 0x87, 0x9D, 0xA9, 0xC1, 0x37, 0x97, 0xC9,
+  0xFE, 0x61, 0xE4, 0x97, 0x4B, 0xFE, 0xE4, 0x6A, 0x56, 0xFE, 0x18, 0xA2, 0x1A, 0xA2, 0x78, 0x26,
+  0x99, 0xC6, 0xA5, 0x8B, 0x0F, 0x6F, 0x05, 0x7B, 0x1B, 0x0C, 0x1B, 0x2F, 0x55, 0x1B, 0x65, 0xC1,
+  0x07, 0x3B, 0xC1, 0x9D, 0x98, 0xC0, 0x2C, 0xC0, 0x3B, 0xC0, 0x0C, 0xC0, 0x7F, 0x2F, 0x08, 0x1B,
+  0x0C, 0xC4, 0x0F, 0x00, 0x34, 0x3B, 0x1B, 0x0C, 0xC3, 0x00, 0x9C, 0x98, 0x55, 0x0D, 0x1A, 0xA3,
+  0x79, 0x9C, 0xA8, 0x9A, 0xB6, 0xFE, 0x9A, 0xC3, 0x3F, 0x5A, 0xC2, 0x23, 0xC0, 0xFE, 0x41, 0x62,
+  0x9A, 0x3D, 0x3A, 0x26, 0x32, 0xC0, 0x2D, 0x32, 0x26, 0x02, 0x3D, 0x26, 0xC0, 0x32, 0x61, 0x3D,
+  0x02, 0xC0, 0x3D, 0x1A, 0x61, 0xC7, 0x26, 0x32, 0x21, 0x3D, 0x1A, 0x32, 0xC0, 0x3A, 0x96, 0xB7,
+  0xB2, 0xE0, 0x23, 0xC0, 0x3C, 0xC2, 0x66, 0x91, 0x6D, 0xFE, 0x10, 0x41, 0x15, 0x25, 0xFE, 0xBC,
+  0xCE, 0xA9, 0x98, 0x51, 0xA2, 0x98, 0xA5, 0x87, 0x6F, 0x92, 0xE7, 0x75, 0xFE, 0x49, 0xA4, 0xA4,
+  0xA7, 0xB2, 0xD4, 0x19, 0xA7, 0x5B, 0x6F, 0x09, 0x19, 0xA8, 0x6B, 0xA3, 0x99, 0x50, 0x98, 0x96,
+  0x07, 0x0F, 0xC1, 0x08, 0x07, 0x0F, 0x5A, 0xC1, 0x0F, 0xC1, 0x0C, 0x9B, 0xA7, 0x0F, 0xC4, 0x0C,
+  0xC0, 0x05, 0x00, 0x0F, 0x0C, 0x0F, 0xC4, 0x99, 0x96, 0xA5, 0x8A, 0x1B, 0x0C, 0xC4, 0x07, 0x20,
+  0xC0, 0x9A, 0x97, 0xA2, 0x78, 0x26, 0x98, 0xB6, 0xB0, 0xF1, 0x37, 0x3C, 0xC2, 0x9D, 0x9A, 0x79,
+  0x92, 0x3D, 0xFE, 0x00, 0x63, 0x3A, 0x32, 0xC4, 0x9D, 0xA8, 0x60, 0x02, 0x15, 0x09, 0xA3, 0x79,
+  0x60, 0x02, 0x09, 0x02, 0xC0, 0x0E, 0x09, 0xC7, 0x15, 0x32, 0x0E, 0x02, 0x0E, 0x32, 0xC1, 0x26,
+  0x19, 0xFE, 0xB3, 0x84, 0xA5, 0xA7, 0xA3, 0x88, 0x3C, 0x37, 0xC0, 0x3C, 0x61, 0x90, 0x5D, 0xFE,
+  0x08, 0x41, 0xA3, 0x88, 0xA8, 0x97, 0xA5, 0x98, 0xA2, 0x88, 0x55, 0x7A, 0xA8, 0x97, 0xA7, 0xF5,
+  0xA7, 0xA7, 0x94, 0x5B, 0xFE, 0x29, 0x02, 0xFE, 0xCC, 0x29, 0xFE, 0x08, 0x81, 0x26, 0x32, 0x99,
+  0xC6, 0x7F, 0x3B, 0x1B, 0x98, 0x96, 0xC0, 0x1B, 0x0C, 0x1B, 0x9C, 0x97, 0x55, 0x1B, 0x0C, 0xC4,
+  0x7B, 0x20, 0x6E, 0x1B, 0x0C, 0xC1, 0x0F, 0x0C, 0x1B, 0x2F, 0x50, 0x1B, 0x0C, 0x0F, 0x0C, 0xC0,
+  0x0F, 0x0C, 0x1B, 0x99, 0xA7, 0x20, 0x1B, 0x07, 0x0C, 0xC5, 0x20, 0x56, 0x65, 0x19, 0x11, 0xAD,
+  0xF3, 0x23, 0x3C, 0xC2, 0x37, 0x9D, 0x99, 0x9B, 0x6A, 0xFE, 0x10, 0x81, 0x26, 0x32, 0xC5, 0x09,
+  0x02, 0x09, 0xC1, 0x0E, 0x09, 0xC3, 0x0E, 0x09, 0xC8, 0xA2, 0x79, 0x09, 0xC1, 0x26, 0xA2, 0x78,
+  0x32, 0x7F, 0x9B, 0x98, 0x9F, 0xE4, 0xFE, 0xC3, 0xE4, 0x7F, 0xA5, 0x97, 0xC2, 0x3C, 0x23, 0x8E,
+  0x5E, 0x93, 0x2F, 0xFE, 0xC5, 0x50, 0xAD, 0x97, 0x9C, 0xA8, 0x66, 0x9A, 0x69, 0x8C, 0x89, 0x91,
+  0x6A, 0xAD, 0xD7, 0x98, 0x59, 0xC0, 0xFE, 0xE4, 0x6A, 0x2D, 0x26, 0xC0, 0x19, 0xA4, 0x7B, 0x3B,
+  0xA2, 0x78, 0x19, 0x3B, 0x16, 0x69, 0x1B, 0x14, 0xA4, 0x79, 0x0F, 0xC2, 0x0C, 0x0F, 0xC0, 0x0C,
+  0x9A, 0xA7, 0x0C, 0x7A, 0x0C, 0xC1, 0x0F, 0x0C, 0x16, 0x08, 0x3B, 0x0F, 0x0C, 0x0F, 0xC1, 0x0C,
+  0x16, 0x9D, 0x97, 0x9D, 0x87, 0x16, 0x0C, 0xC3, 0x0F, 0xC0, 0x3B, 0x50, 0x18, 0x27, 0x54, 0x99,
+  0xA8, 0xAE, 0xE2, 0x1E, 0x3C, 0x37, 0x3C, 0xC0, 0x37, 0x9C, 0x89, 0x66, 0xFE, 0x31, 0x01, 0x9F,
+  0x3E, 0xA5, 0x89, 0x32, 0xC0, 0x61, 0x32, 0xC1, 0x1A, 0x02, 0x6B, 0xC8, 0x6E, 0x09, 0x0E, 0x09,
+  0xC2, 0x0E, 0x09, 0xC5, 0x0E, 0xA4, 0x69, 0xC0, 0x32, 0xA2, 0x88, 0x35, 0xA6, 0xE2, 0x11, 0x5A,
+  0xA5, 0x97, 0xC2, 0x3C, 0x23, 0x8D, 0x5F, 0x28, 0xFE, 0xC5, 0x30, 0xAD, 0x96, 0x9B, 0xB9, 0xA2,
+  0x78, 0x97, 0xD7, 0x98, 0x89, 0xFE, 0x20, 0xE2, 0x51, 0xFE, 0xEC, 0x8B, 0x01, 0x30, 0xA5, 0x4C,
+  0x9C, 0xA5, 0x72, 0xA4, 0x69, 0x3B, 0x14, 0x28, 0x1B, 0x55, 0x1B, 0x3B, 0x14, 0x1B, 0x0C, 0x0F,
+  0x0C, 0x0F, 0xC0, 0x0C, 0x1B, 0x9C, 0x97, 0x14, 0x1B, 0x0C, 0xC0, 0x0F, 0x0C, 0xC0, 0x1B, 0x3B,
+  0x9C, 0x96, 0x1B, 0x0C, 0xC1, 0x0F, 0xC0, 0x0C, 0x0F, 0x99, 0x97, 0x3B, 0x0F, 0x0C, 0xC2, 0x0F,
+  0x55, 0x27, 0x18, 0xC0, 0x20, 0x14, 0x9A, 0x87, 0xAC, 0xE3, 0x1E, 0x3C, 0x66, 0xC2, 0x0E, 0x1E,
+  0xFE, 0x51, 0xA2, 0x97, 0x3F, 0x06, 0x32, 0x6E, 0x9D, 0xA9, 0x02, 0x26, 0x32, 0xC0, 0x9D, 0xA7,
+  0x09, 0xC9, 0x0E, 0xCB, 0x09, 0xC0, 0x15, 0x32, 0x37, 0xC1, 0x06, 0x24, 0xAD, 0xE1, 0x16, 0x56,
+  0xA5, 0x97, 0xC2, 0x3C, 0x23, 0x8D, 0x5F, 0x93, 0x2E, 0xFE, 0xAC, 0x8E, 0xB1, 0xA6, 0x9D, 0xA8,
+  0x93, 0xE8, 0x7E, 0x99, 0x5A, 0xFE, 0x31, 0x23, 0xFE, 0xE4, 0x8A, 0x01, 0xFE, 0x18, 0xC2, 0x1A,
+  0x19, 0xA4, 0x7A, 0x18, 0x3B, 0x99, 0xA6, 0xA4, 0x79, 0x1B, 0x55, 0x1B, 0x9B, 0x97, 0xA2, 0x88,
+  0x1B, 0x0C, 0x0F, 0xC3, 0x1B, 0x14, 0x3B, 0x0F, 0x0C, 0x0F, 0xC1, 0x0C, 0x1B, 0x14, 0x25, 0x1B,
+  0x0C, 0xC1, 0x0F, 0x0C, 0x1B, 0x25, 0x9D, 0xA8, 0x1B, 0x0C, 0xC1, 0x0F, 0x0C, 0x2C, 0x61, 0x18,
+  0xC0, 0x27, 0x50, 0x9A, 0x97, 0x38, 0x16, 0x3C, 0x37, 0xC2, 0x16, 0x7A, 0x91, 0x3D, 0x24, 0xA9,
+  0x6A, 0x59, 0xC0, 0x66, 0x9D, 0xA7, 0x09, 0x6F, 0xA4, 0x69, 0x26, 0x09, 0xCA, 0x0E, 0xCC, 0x09,
+  0x1A, 0x3E, 0x37, 0x3E, 0xC1, 0x3A, 0x96, 0xB7, 0xB1, 0xF1, 0xAD, 0xD4, 0x5A, 0xA5, 0x97, 0xC2,
+  0x3C, 0x23, 0x8F, 0x6E, 0x90, 0x2E, 0xA9, 0x79, 0xA8, 0xC6, 0xA4, 0xB6, 0xAC, 0xC5, 0x7E, 0x3D,
+  0xFE, 0xD4, 0x2A, 0x69, 0xFE, 0x10, 0xA2, 0x5B, 0x61, 0xA6, 0x79, 0x1B, 0xC0, 0x9B, 0x96, 0x00,
+  0x0F, 0x5A, 0x0F, 0x14, 0x0C, 0x0F, 0xC3, 0x0C, 0x0F, 0x00, 0x08, 0x0F, 0x0C, 0xC2, 0x0F, 0xC0,
+  0x0C, 0x9A, 0x96, 0x07, 0x0F, 0xC1, 0x0C, 0x00, 0x0F, 0xC0, 0x99, 0x97, 0x3B, 0x0F, 0x0C, 0xC0,
+  0x0F, 0x0C, 0x27, 0x55, 0x1B, 0xC0, 0x27, 0x00, 0x9B, 0x98, 0xAE, 0xE2, 0xB3, 0xC2, 0x3C, 0x66,
+  0xC2, 0x9C, 0x79, 0x16, 0x94, 0x5C, 0xFE, 0x00, 0x42, 0xAA, 0x49, 0x3E, 0x37, 0x3E, 0x26, 0x9D,
+  0xA8, 0x6E, 0x09, 0xA4, 0x69, 0x15, 0x09, 0x0E, 0x09, 0x0E, 0xC1, 0x09, 0x0E, 0xC0, 0x09, 0xC1,
+  0x0E, 0xCE, 0x32, 0x3E, 0x32, 0x26, 0xC0, 0x3E, 0x32, 0x97, 0xC6, 0x31, 0xAA, 0xB4, 0x6F, 0xA5,
+  0x97, 0xC2, 0x3C, 0x2B, 0x93, 0x6D, 0x8C, 0x2F, 0xA2, 0x79, 0xAC, 0xB5, 0x99, 0x7A, 0x51, 0xA6,
+  0x97, 0xFE, 0xFD, 0x0C, 0x93, 0x5B, 0x11, 0x19, 0xA3, 0x8A, 0xA2, 0x89, 0x20, 0x9C, 0x97, 0xC0,
+  0xA9, 0x7B, 0x55, 0x1B, 0x9D, 0x97, 0x50, 0x1B, 0x0F, 0xC3, 0x0C, 0x1B, 0x25, 0x20, 0x1B, 0x0C,
+  0xC1, 0x0F, 0x0C, 0x7B, 0x34, 0x14, 0x1B, 0x0C, 0xC0, 0x0F, 0x3B, 0x34, 0x1B, 0x34, 0x9C, 0x97,
+  0x1B, 0x0C, 0x0F, 0xC0, 0x3B, 0x9D, 0x98, 0xC1, 0x20, 0xC0, 0x9C, 0x87, 0x9D, 0xA8, 0xB0, 0xE1,
+  0x23, 0x3C, 0x37, 0xC2, 0x0E, 0x79, 0x96, 0x4C, 0x11, 0xA6, 0x6A, 0x26, 0xC0, 0xA2, 0x79, 0xC0,
+  0x9D, 0xA7, 0x09, 0x6E, 0xC0, 0x15, 0x0E, 0xC9, 0x09, 0x0E, 0xC7, 0x15, 0xC0, 0x0E, 0x15, 0xC0,
+  0x0E, 0x15, 0x0E, 0x1A, 0xA3, 0x79, 0x1A, 0x0E, 0x15, 0xC0, 0x32, 0x26, 0x14, 0xFE, 0x8A, 0xA3,
+  0x02, 0x6F, 0xA5, 0x97, 0xC2, 0x3C, 0x37, 0x96, 0x7B, 0x8E, 0x2E, 0xA4, 0x89, 0xA5, 0xA7, 0x94,
+  0x5B, 0xFE, 0xE4, 0x8A, 0xA3, 0xA8, 0xFE, 0x72, 0x45, 0x8E, 0x3C, 0x28, 0xA4, 0x6A, 0x1B, 0x20,
+  0x9A, 0x97, 0x1B, 0xA6, 0x79, 0x0C, 0x1B, 0x9B, 0x97, 0x34, 0x1B, 0x0F, 0xC4, 0x1B, 0x9A, 0x96,
+  0x3B, 0x0F, 0x0C, 0x0F, 0x0C, 0x0F, 0x0C, 0x1B, 0x20, 0xC0, 0x1B, 0x0C, 0xC0, 0x16, 0x2F, 0xC0,
+  0x1B, 0x99, 0xA7, 0x2C, 0x1B, 0x65, 0xC0, 0x34, 0x18, 0xC0, 0x7A, 0x20, 0x14, 0x9A, 0x88, 0xA3,
+  0xB6, 0x01, 0x2B, 0x3C, 0x37, 0xC2, 0x9B, 0x8A, 0x75, 0x36, 0xFE, 0x08, 0x41, 0xA5, 0x6A, 0x1A,
+  0x65, 0xC0, 0x32, 0xC0, 0x09, 0x0E, 0xCF, 0x15, 0xCF, 0x1A, 0x15, 0xC2, 0x0E, 0x1A, 0x09, 0x14,
+  0x31, 0x02, 0x6F, 0x37, 0xC4, 0x02, 0x8E, 0x3E, 0x96, 0x4D, 0x38, 0xFE, 0xEC, 0xAA, 0x66, 0x38,
+  0x9C, 0x78, 0xA3, 0x8A, 0x20, 0x1B, 0x5A, 0x14, 0x3B, 0xA2, 0x89, 0x0C, 0x0F, 0x9B, 0x97, 0x07,
+  0x0F, 0xC0, 0x0C, 0xC0, 0x0F, 0xC1, 0x0C, 0x08, 0x0F, 0xC1, 0x0C, 0x0F, 0xC1, 0x6F, 0x08, 0x3B,
+  0x0F, 0xC0, 0x0C, 0x1B, 0x20, 0x6B, 0x0F, 0x99, 0x97, 0x07, 0x0F, 0xC0, 0x9D, 0x88, 0x18, 0x7A,
+  0x20, 0xC0, 0x9C, 0x88, 0x9D, 0xA7, 0xA9, 0xD4, 0xB1, 0xD3, 0x37, 0xC2, 0x66, 0x37, 0x02, 0xC0,
+  0x31, 0xFE, 0x00, 0x41, 0x09, 0x1A, 0x65, 0x15, 0x0E, 0x1A, 0xC0, 0x0E, 0xD0, 0x15, 0xD6, 0x1A,
+  0x09, 0x11, 0x21, 0xAB, 0xD4, 0x02, 0x32, 0x37, 0x32, 0x37, 0xC0, 0x3C, 0x23, 0x94, 0x7C, 0x90,
+  0x2E, 0xA3, 0x89, 0xA4, 0x97, 0x93, 0x5B, 0xA2, 0x98, 0xA4, 0x6A, 0x1B, 0xC0, 0x50, 0x9D, 0x97,
+  0x2C, 0x0F, 0x6F, 0x50, 0x9C, 0x97, 0x1B, 0x55, 0x0F, 0xC2, 0x0C, 0x1B, 0x9D, 0x97, 0x14, 0x1B,
+  0x0C, 0x0F, 0x0C, 0xC0, 0x0F, 0xC0, 0x07, 0x9B, 0x96, 0x0C, 0x0F, 0xC0, 0x0C, 0x1B, 0x20, 0x51,
+  0x2C, 0x9D, 0xA8, 0x16, 0x59, 0x2C, 0x18, 0x7A, 0x20, 0x51, 0x9B, 0x98, 0xA4, 0xB5, 0xAE, 0xD2,
+  0x1E, 0xA4, 0x77, 0x37, 0xC0, 0x32, 0x37, 0x56, 0x02, 0xC0, 0x95, 0x5D, 0x11, 0x09, 0x1A, 0x0E,
+  0x15, 0xC2, 0x0E, 0x15, 0x0E, 0xC0, 0x15, 0xC2, 0x0E, 0x15, 0xC0, 0x0E, 0xC0, 0x15, 0xC0, 0x0E,
+  0xC2, 0x15, 0xCE, 0x1A, 0xC0, 0x15, 0xC5, 0x1A, 0x0E, 0x99, 0xB8, 0xAE, 0xD2, 0xAE, 0xD3, 0x6E,
+  0x23, 0x37, 0x32, 0xC0, 0x37, 0xC1, 0x02, 0x90, 0x4E, 0x0D, 0x0C, 0xA3, 0x88, 0x27, 0x1B, 0xC0,
+  0x9D, 0x97, 0x28, 0x1B, 0x20, 0xA4, 0x89, 0x9D, 0x98, 0x20, 0xA5, 0x8A, 0x55, 0x0F, 0xC2, 0x0C,
+  0x1B, 0x20, 0xC0, 0x1B, 0x0F, 0xC1, 0x0C, 0xC0, 0x7E, 0x3B, 0x9C, 0x97, 0x16, 0x0C, 0x7A, 0x0C,
+  0x1B, 0x2F, 0x9C, 0x87, 0xC0, 0x20, 0x1B, 0x2C, 0x61, 0x20, 0x56, 0x9B, 0x98, 0x1C, 0xAB, 0xD4,
+  0xAF, 0xC3, 0x37, 0x3C, 0x37, 0x66, 0x2B, 0x37, 0x23, 0x3A, 0x7A, 0x92, 0x3D, 0x11, 0x09, 0x1A,
+  0x15, 0xD5, 0x0E, 0xC0, 0x1A, 0xC8, 0x15, 0xCE, 0x1A, 0x15, 0x9A, 0xA7, 0xA9, 0xD4, 0x2D, 0x35,
+  0xA4, 0x87, 0x37, 0x32, 0xC2, 0x37, 0x32, 0x97, 0x7B, 0x91, 0x4E, 0x1C, 0x4B, 0xA4, 0x89, 0x27,
+  0x9B, 0xA6, 0x34, 0xA4, 0x79, 0x55, 0x20, 0x61, 0xA4, 0x78, 0xA3, 0x8A, 0x65, 0xC0, 0x5A, 0xC2,
+  0x7B, 0x9B, 0x96, 0x34, 0x16, 0x0C, 0xC3, 0x1B, 0x2F, 0x14, 0x1B, 0x0C, 0x0F, 0x0C, 0x0F, 0x2C,
+  0x9B, 0xA7, 0xC0, 0x20, 0x3B, 0x9D, 0x98, 0x11, 0x9C, 0x98, 0x19, 0xA8, 0xC4, 0xAE, 0xC3, 0x23,
+  0x3C, 0x37, 0xC0, 0x32, 0xC0, 0x37, 0x9C, 0x89, 0x35, 0x2D, 0x8F, 0x3F, 0x18, 0xA6, 0x68, 0x1A,
+  0x15, 0xD6, 0x0E, 0xC0, 0xA3, 0x79, 0xC6, 0x26, 0x2B, 0x26, 0xC2, 0x69, 0xC1, 0x1A, 0xC3, 0x15,
+  0xC4, 0x1A, 0x24, 0xA4, 0xB4, 0xB2, 0xE1, 0x35, 0x02, 0xA5, 0x87, 0x37, 0x32, 0xC1, 0x37, 0x3C,
+  0x23, 0x95, 0x7C, 0x19, 0x97, 0x5D, 0x1D, 0x79, 0xA4, 0x79, 0x27, 0x1B, 0xC0, 0x34, 0xA3, 0x89,
+  0xA2, 0x79, 0x3B, 0x07, 0x0C, 0x0F, 0xC2, 0x08, 0x0C, 0x0F, 0xC0, 0x0C, 0xC0, 0x0F, 0xC0, 0x6F,
+  0x9B, 0x97, 0x6E, 0x1B, 0x0C, 0xC0, 0x3B, 0x20, 0x56, 0x34, 0x69, 0xA3, 0x8B, 0x00, 0x24, 0x74,
+  0xA7, 0xC5, 0x01, 0x16, 0x37, 0x3C, 0x37, 0x32, 0xC0, 0x37, 0x28, 0x02, 0x35, 0x0E, 0x39, 0x24,
+  0xA6, 0x78, 0x15, 0xD4, 0x1A, 0xC4, 0x2B, 0xD4, 0x26, 0x1F, 0xC1, 0x1A, 0xC0, 0x15, 0x1A, 0x9B,
+  0xA9, 0x1C, 0xB0, 0xD1, 0x35, 0x3A, 0xA4, 0x87, 0x37, 0x65, 0xC0, 0x32, 0xC0, 0x37, 0x7E, 0x1E,
+  0x09, 0x93, 0x5D, 0x99, 0x5C, 0x9E, 0x6A, 0xA2, 0x89, 0xA3, 0x88, 0x7F, 0x60, 0x1B, 0xC0, 0x5A,
+  0x1B, 0x20, 0x27, 0x2C, 0x3B, 0xC0, 0x05, 0x07, 0x6E, 0xC2, 0x07, 0xC1, 0x9B, 0xA7, 0x1B, 0x3B,
+  0x27, 0x20, 0x1B, 0x20, 0xC0, 0x34, 0x51, 0x56, 0xA1, 0xA7, 0xA8, 0xB4, 0xAB, 0xD5, 0x16, 0x37,
+  0xC1, 0x32, 0xC1, 0x37, 0x9D, 0x89, 0x35, 0xC0, 0x1A, 0x1C, 0xA2, 0x5A, 0x1D, 0x15, 0xC9, 0x6E,
+  0xC2, 0x1F, 0xC2, 0x26, 0xC1, 0x6E, 0x26, 0x2B, 0xE0, 0x1F, 0x7B, 0x50, 0x18, 0x19, 0xAF, 0xD3,
+  0xA3, 0xA8, 0xA2, 0x77, 0x23, 0x37, 0x32, 0xC2, 0x37, 0x7E, 0x23, 0x2A, 0x96, 0x6B, 0x97, 0x6C,
+  0x9C, 0x5A, 0x20, 0x5A, 0xA3, 0x89, 0xA2, 0x89, 0x7E, 0xC1, 0x66, 0xC1, 0x55, 0x64, 0x1B, 0xC6,
+  0x39, 0x0F, 0x20, 0x1B, 0x0C, 0x3D, 0x61, 0x65, 0x24, 0xA5, 0xA6, 0xA8, 0xB5, 0xAA, 0xB4, 0xA7,
+  0xA7, 0x3F, 0x5A, 0x37, 0x32, 0xC1, 0x37, 0x23, 0x3A, 0x35, 0x16, 0x91, 0x3E, 0x97, 0x5E, 0xA5,
+  0x79, 0x1A, 0x66, 0xC3, 0x1A, 0xC1, 0x1F, 0xC0, 0x26, 0xC0, 0x2B, 0xCE, 0x26, 0xC0, 0x2B, 0xC7,
+  0x1F, 0xC0, 0x2B, 0xD2, 0x7A, 0xC0, 0x99, 0xA8, 0x24, 0xAD, 0xE3, 0xAB, 0xB4, 0x35, 0x02, 0x23,
+  0x32, 0xC2, 0x37, 0xC0, 0x3F, 0x37, 0x1E, 0x9A, 0x7A, 0x99, 0x6A, 0x98, 0x6C, 0x9A, 0x5A, 0x9D,
+  0x7A, 0x20, 0x5B, 0xA2, 0x88, 0x6F, 0x0C, 0x6F, 0x0C, 0x64, 0xA3, 0x8A, 0xC2, 0x1B, 0xC0, 0x18,
+  0x0C, 0x2C, 0xC0, 0x29, 0x75, 0x21, 0xA3, 0xA7, 0xA5, 0xB6, 0xA7, 0xB6, 0xA8, 0xA6, 0xA6, 0x96,
+  0x37, 0x3F, 0x37, 0xC0, 0x32, 0xC1, 0x37, 0x56, 0x9C, 0x88, 0x35, 0x2D, 0x96, 0x5B, 0x92, 0x3E,
+  0x9F, 0x6B, 0x1A, 0xC0, 0x66, 0x1A, 0xC0, 0x1F, 0xC0, 0x6B, 0x2B, 0xD4, 0x26, 0xC1, 0x2B, 0xC5,
+  0x26, 0x1A, 0xC1, 0x1F, 0x2B, 0xC0, 0x1F, 0x26, 0x2B, 0xCF, 0x7E, 0x15, 0x9B, 0xA7, 0xA5, 0xD5,
+  0xAE, 0xC3, 0xA6, 0xB6, 0x35, 0xA3, 0x88, 0x28, 0x37, 0x32, 0x69, 0x32, 0xC0, 0x37, 0xC0, 0x3F,
+  0xC0, 0x2B, 0x07, 0x9A, 0x7A, 0x9A, 0x7A, 0x9A, 0x6A, 0x9C, 0x6A, 0x9D, 0x7A, 0x9D, 0x8A, 0x1C,
+  0x5A, 0xC0, 0x20, 0xC3, 0x19, 0x7E, 0x7E, 0x39, 0xA3, 0xB7, 0xA5, 0xA6, 0x25, 0x16, 0x02, 0x23,
+  0x3F, 0xC0, 0x3C, 0x37, 0xC0, 0x32, 0xC0, 0x37, 0xC0, 0x2F, 0x0E, 0x35, 0xC0, 0x99, 0x6B, 0x92,
+  0x3D, 0x9A, 0x5C, 0xA6, 0x68, 0x2E, 0x1F, 0x26, 0x6E, 0xCB, 0x1F, 0x1A, 0x2B, 0xCA, 0x1F, 0x1A,
+  0x2B, 0xC1, 0x1A, 0x2B, 0x1F, 0x2B, 0xC0, 0x1F, 0x1A, 0xC2, 0x1F, 0x2B, 0x1A, 0xC1, 0x1F, 0xC0,
+  0x2B, 0xCE, 0x33, 0xC0, 0x9B, 0x99, 0x19, 0xA8, 0xC4, 0xAC, 0xC4, 0x30, 0x35, 0x02, 0x23, 0x37,
+  0x32, 0x69, 0xC0, 0x32, 0x37, 0xC1, 0x3C, 0x3F, 0xC0, 0x2B, 0x1E, 0x07, 0x9D, 0x8A, 0x16, 0x42,
+  0x39, 0x25, 0xC2, 0x6F, 0x01, 0xA2, 0x97, 0x32, 0x02, 0x1E, 0x2B, 0x3F, 0xC0, 0x3C, 0xC0, 0x37,
+  0xC0, 0x66, 0xC1, 0x37, 0xC0, 0x23, 0x9D, 0x8A, 0x35, 0xC0, 0x9B, 0x7A, 0x19, 0x98, 0x4C, 0xA3,
+  0x6A, 0x33, 0xC0, 0x56, 0xCD, 0x1F, 0x65, 0x1A, 0x1F, 0x26, 0x2B, 0x26, 0x2B, 0xC6, 0x1A, 0xC0,
+  0x1F, 0xC0, 0x1A, 0x13, 0x1A, 0xC0, 0x1F, 0xC0, 0x1A, 0xC3, 0x1F, 0xC0, 0x13, 0x1A, 0xC0, 0x13,
+  0x1F, 0x2B, 0x1A, 0xC0, 0x1F, 0x2B, 0xCC, 0x33, 0x2E, 0x9A, 0x98, 0x19, 0xA8, 0xC4, 0x39, 0xA6,
+  0xA5, 0x7F, 0xA2, 0x77, 0xA3, 0x98, 0xA2, 0x97, 0x37, 0xC0, 0x32, 0x2B, 0x32, 0x37, 0xC2, 0x3C,
+  0xC0, 0x7A, 0xCB, 0x3C, 0x37, 0xC2, 0x32, 0xC1, 0x37, 0xC1, 0x1B, 0x02, 0x35, 0x26, 0x01, 0x95,
+  0x5C, 0x1C, 0xA2, 0x5A, 0x2E, 0x33, 0x56, 0xCC, 0x1F, 0x1A, 0x1F, 0x1A, 0x13, 0x1A, 0xC0, 0x1F,
+  0xC0, 0x1A, 0xC0, 0x2B, 0xC2, 0x1A, 0x1F, 0xC0, 0x13, 0x1A, 0x13, 0xC1, 0x1A, 0xC9, 0x13, 0x1A,
+  0xC6, 0x1F, 0xC2, 0x2B, 0xCB, 0x7F, 0x2B, 0x35, 0x9E, 0xA6, 0xA6, 0xB5, 0xAA, 0xC4, 0xA8, 0xA5,
+  0xA2, 0x98, 0xC0, 0x07, 0xA2, 0x98, 0x32, 0x37, 0xD3, 0x32, 0xC2, 0x37, 0xC1, 0x32, 0x23, 0x0E,
+  0x51, 0x35, 0x16, 0x1D, 0x96, 0x5C, 0x19, 0xA2, 0x6A, 0x1F, 0x33, 0x2B, 0xCC, 0x66, 0x1F, 0xC0,
+  0x13, 0x1A, 0xC1, 0x13, 0x1A, 0xC2, 0x1F, 0x2B, 0xC1, 0x1F, 0x13, 0x1A, 0x13, 0x1A, 0x13, 0xC1,
+  0x1A, 0xC6, 0x13, 0x1A, 0xD0, 0x2B, 0xCB, 0x7F, 0x2B, 0x9B, 0xA9, 0x9D, 0xA7, 0xA3, 0xC6, 0xA8,
+  0xB5, 0xA8, 0xB5, 0xA5, 0x96, 0xA2, 0x98, 0x6E, 0x02, 0xA2, 0x88, 0x23, 0x32, 0x37, 0xC8, 0x32,
+  0xC0, 0x37, 0xC6, 0x2F, 0x23, 0x16, 0x02, 0x3A, 0x30, 0x1E, 0x39, 0x97, 0x6C, 0x98, 0x5B, 0x18,
+  0xA4, 0x68, 0x2B, 0x33, 0x2E, 0x2B, 0xCA, 0x1F, 0xC2, 0x1A, 0xC5, 0x13, 0x1A, 0xC1, 0x1F, 0xC1,
+  0x2B, 0x1F, 0x13, 0x1A, 0x13, 0xC4, 0x1A, 0x13, 0xC2, 0x1A, 0x13, 0xC6, 0x1A, 0xC9, 0x13, 0x1A,
+  0x2B, 0xCC, 0x33, 0xC0, 0x15, 0x9C, 0x97, 0x20, 0xA4, 0xB5, 0x38, 0xA7, 0xB5, 0xA4, 0xA7, 0xA3,
+  0x87, 0x35, 0x6E, 0x02, 0x0E, 0x16, 0x1B, 0x23, 0x28, 0x2F, 0x32, 0x37, 0xC0, 0x32, 0xC1, 0x2F,
+  0x28, 0x23, 0x1B, 0x16, 0x0E, 0x61, 0x3A, 0x35, 0x26, 0x11, 0x2D, 0x38, 0x3C, 0x19, 0xA0, 0x7A,
+  0xA4, 0x78, 0x1F, 0xC1, 0x2B, 0xC0, 0x1F, 0x1A, 0x1F, 0x2B, 0xC6, 0x1A, 0x13, 0xC1, 0x1A, 0xC4,
+  0x13, 0xC0, 0x1A, 0xC2, 0x13, 0xC2, 0x1A, 0xC0, 0x13, 0xC4, 0x1A, 0xDA, 0x1F, 0x2B, 0xCD, 0x33,
+  0x6F, 0x2B, 0x9D, 0x99, 0x9D, 0xA8, 0x74, 0xA2, 0xA6, 0xA4, 0xA7, 0xA6, 0xA5, 0xA4, 0xA7, 0xA3,
+  0x97, 0x11, 0x1E, 0x26, 0xC0, 0x7B, 0x6E, 0xC5, 0x30, 0x5A, 0x26, 0x66, 0x56, 0x11, 0x01, 0x9D,
+  0x7A, 0x9B, 0x7A, 0x18, 0x31, 0x25, 0x5B, 0xA3, 0x79, 0x1A, 0x7E, 0x1F, 0x1A, 0xC1, 0x1F, 0x1A,
+  0xC1, 0x1F, 0xC0, 0x6B, 0x2B, 0xC6, 0x1F, 0x1A, 0xD7, 0x65, 0xC2, 0x09, 0xC0, 0x0E, 0xC3, 0x09,
+  0xC0, 0x0E, 0xC3, 0x09, 0xC1, 0x0E, 0xC1, 0x09, 0x0E, 0xC2, 0x1A, 0xCF, 0x1F, 0x22, 0x2E, 0x1F,
+  0x09, 0x29, 0x61, 0x69, 0x1C, 0x31, 0xA3, 0xA8, 0xA3, 0xA7, 0x3D, 0x0D, 0xA2, 0x98, 0x2C, 0x7E,
+  0xC1, 0x2C, 0x5A, 0x51, 0x05, 0x3D, 0x28, 0x9D, 0x79, 0x31, 0x1C, 0x11, 0x1D, 0xA2, 0x78, 0xA2,
+  0x89, 0x1A, 0x22, 0x13, 0x0E, 0xC9, 0x09, 0x0E, 0x1A, 0xC7, 0x13, 0x0E, 0xC1, 0x09, 0x0E, 0xC0,
+  0x09, 0xC3, 0x0E, 0xC0, 0x09, 0xC0, 0x0E, 0xC2, 0x09, 0xC0, 0x0E, 0x09, 0xC0
+};
+
+#endif // LOGO_DATA_H
@@ -0,0 +1,2303 @@
+/*
+ * magnetic_grid_data.h
+ * 
+ * Generated by tools/gen_magnetic_grid.py - do not edit
+ * WMM2020 (degree 8) magnetic field grid for magnetic_model.cpp (epoch 2025.5, height 0)
+ * 
+ * 値は { 偏角 (0.01度), 伏角 (0.01度), 全磁力 (0.01uT) } のint16
+ * 行は南緯90度から北緯90度、列は西経180度から東経180度（両端を含む）
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef MAGNETIC_GRID_DATA_H
+#define MAGNETIC_GRID_DATA_H
+
+#include <stdint.h>
+
+// const配列はESP32ではフラッシュ（rodata）に配置される
+#define MAGNETIC_GRID_EPOCH     2025.5f
+#define MAGNETIC_GRID_STEP      2.0f
+#define MAGNETIC_GRID_ROWS      91
+#define MAGNETIC_GRID_COLUMNS   181
+
+static const int16_t MAGNETIC_GRID[MAGNETIC_GRID_ROWS][MAGNETIC_GRID_COLUMNS][3] = {
+  {  // -90
+    {14808,-7180,5452},{14608,-7180,5452},{14408,-7180,5452},{14208,-7180,5452},{14008,-7180,5452},{13808,-7180,5452},{13608,-7180,5452},{13408,-7180,5452},
+    {13208,-7180,5452},{13008,-7180,5452},{12808,-7180,5452},{12608,-7180,5452},{12408,-7180,5452},{12208,-7180,5452},{12008,-7180,5452},{11808,-7180,5452},
+    {11608,-7180,5452},{11408,-7180,5452},{11208,-7180,5452},{11008,-7180,5452},{10808,-7180,5452},{10608,-7180,5452},{10408,-7180,5452},{10208,-7180,5452},
+    {10008,-7180,5452},{9808,-7180,5452},{9608,-7180,5452},{9408,-7180,5452},{9208,-7180,5451},{9008,-7180,5451},{8808,-7180,5451},{8608,-7180,5451},
+    {8408,-7180,5451},{8208,-7180,5451},{8008,-7180,5451},{7808,-7180,5451},{7608,-7180,5451},{7408,-7180,5451},{7208,-7180,5451},{7008,-7180,5451},
+    {6808,-7180,5451},{6608,-7180,5451},{6408,-7180,5451},{6208,-7180,5451},{6008,-7180,5451},{5808,-7180,5451},{5608,-7180,5451},{5408,-7180,5451},
+    {5208,-7180,5451},{5008,-7180,5451},{4808,-7180,5451},{4608,-7180,5451},{4408,-7180,5451},{4208,-7180,5451},{4008,-7180,5451},{3808,-7180,5451},
+    {3608,-7180,5451},{3408,-7180,5451},{3208,-7180,5451},{3008,-7180,5451},{2808,-7180,5451},{2608,-7180,5451},{2408,-7180,5451},{2208,-7180,5451},
+    {2008,-7180,5451},{1808,-7180,5451},{1608,-7180,5451},{1408,-7180,5451},{1208,-7180,5451},{1008,-7180,5451},{808,-7180,5451},{608,-7180,5451},
+    {408,-7180,5451},{208,-7180,5451},{8,-7180,5451},{-192,-7180,5451},{-392,-7180,5451},{-592,-7180,5451},{-792,-7180,5451},{-992,-7180,5451},
+    {-1192,-7180,5451},{-1392,-7180,5451},{-1592,-7180,5451},{-1792,-7180,5451},{-1992,-7180,5451},{-2192,-7180,5451},{-2392,-7180,5451},{-2592,-7180,5451},
+    {-2792,-7180,5451},{-2992,-7180,5451},{-3192,-7180,5451},{-3392,-7180,5451},{-3592,-7180,5451},{-3792,-7180,5451},{-3992,-7180,5451},{-4192,-7180,5451},
+    {-4392,-7180,5451},{-4592,-7180,5451},{-4792,-7180,5451},{-4992,-7180,5451},{-5192,-7180,5451},{-5392,-7180,5451},{-5592,-7180,5451},{-5792,-7180,5451},
+    {-5992,-7180,5451},{-6192,-7180,5451},{-6392,-7180,5451},{-6592,-7180,5451},{-6792,-7180,5451},{-6992,-7180,5451},{-7192,-7180,5451},{-7392,-7180,5451},
+    {-7592,-7180,5451},{-7792,-7180,5451},{-7992,-7180,5451},{-8192,-7180,5451},{-8392,-7180,5451},{-8592,-7180,5451},{-8792,-7180,5451},{-8992,-7180,5451},
+    {-9192,-7180,5451},{-9392,-7180,5451},{-9592,-7180,5451},{-9792,-7180,5451},{-9992,-7180,5451},{-10192,-7180,5451},{-10392,-7180,5451},{-10592,-7180,5451},
+    {-10792,-7180,5451},{-10992,-7180,5451},{-11192,-7180,5451},{-11392,-7180,5451},{-11592,-7180,5452},{-11792,-7180,5452},{-11992,-7180,5452},{-12192,-7180,5452},
+    {-12392,-7180,5452},{-12592,-7180,5452},{-12792,-7180,5452},{-12992,-7180,5452},{-13192,-7180,5452},{-13392,-7180,5452},{-13592,-7180,5452},{-13792,-7180,5452},
+    {-13992,-7180,5452},{-14192,-7180,5452},{-14392,-7180,5452},{-14592,-7180,5452},{-14792,-7180,5452},{-14992,-7180,5452},{-15192,-7180,5452},{-15392,-7180,5452},
+    {-15592,-7180,5452},{-15792,-7180,5452},{-15992,-7180,5452},{-16192,-7180,5452},{-16392,-7180,5452},{-16592,-7180,5452},{-16792,-7180,5452},{-16992,-7180,5452},
+    {-17192,-7180,5452},{-17392,-7180,5452},{-17592,-7180,5452},{-17792,-7180,5452},{-17992,-7180,5452},{17808,-7180,5452},{17608,-7180,5452},{17408,-7180,5452},
+    {17208,-7180,5452},{17008,-7180,5452},{16808,-7180,5452},{16608,-7180,5452},{16408,-7180,5452},{16208,-7180,5452},{16008,-7180,5452},{15808,-7180,5452},
+    {15608,-7180,5452},{15408,-7180,5452},{15208,-7180,5452},{15008,-7180,5452},{14808,-7180,5452}
+  },
+  {  // -88
+    {14548,-7317,5597},{14339,-7315,5595},{14129,-7312,5593},{13920,-7310,5590},{13711,-7307,5588},{13503,-7305,5585},{13295,-7302,5582},{13088,-7299,5579},
+    {12881,-7296,5575},{12675,-7292,5572},{12468,-7289,5568},{12263,-7285,5564},{12058,-7282,5561},{11853,-7278,5557},{11649,-7274,5552},{11445,-7270,5548},
+    {11242,-7266,5544},{11039,-7262,5539},{10837,-7257,5535},{10635,-7253,5530},{10433,-7248,5525},{10233,-7244,5520},{10032,-7239,5515},{9832,-7234,5510},
+    {9633,-7230,5505},{9434,-7225,5500},{9235,-7220,5494},{9037,-7215,5489},{8839,-7210,5484},{8642,-7205,5478},{8445,-7200,5473},{8249,-7195,5467},
+    {8053,-7190,5462},{7857,-7185,5456},{7662,-7180,5451},{7467,-7175,5445},{7273,-7170,5440},{7079,-7165,5434},{6885,-7160,5429},{6692,-7155,5423},
+    {6499,-7150,5418},{6306,-7145,5412},{6114,-7140,5407},{5922,-7136,5401},{5730,-7131,5396},{5538,-7126,5391},{5347,-7122,5386},{5156,-7117,5381},
+    {4966,-7113,5376},{4775,-7108,5371},{4585,-7104,5366},{4395,-7100,5361},{4205,-7096,5356},{4016,-7092,5352},{3826,-7088,5347},{3637,-7084,5343},
+    {3448,-7081,5339},{3259,-7077,5335},{3070,-7074,5331},{2881,-7070,5327},{2693,-7067,5323},{2504,-7064,5320},{2316,-7061,5317},{2127,-7059,5313},
+    {1939,-7056,5310},{1751,-7053,5307},{1562,-7051,5305},{1374,-7049,5302},{1186,-7047,5300},{998,-7045,5298},{809,-7043,5295},{621,-7042,5294},
+    {433,-7040,5292},{244,-7039,5291},{56,-7038,5289},{-133,-7037,5288},{-321,-7036,5287},{-510,-7036,5287},{-699,-7035,5286},{-888,-7035,5286},
+    {-1077,-7035,5286},{-1266,-7035,5286},{-1455,-7035,5286},{-1645,-7035,5286},{-1834,-7036,5287},{-2024,-7037,5288},{-2214,-7037,5289},{-2405,-7039,5290},
+    {-2595,-7040,5292},{-2786,-7041,5294},{-2977,-7043,5295},{-3168,-7044,5297},{-3359,-7046,5300},{-3551,-7048,5302},{-3743,-7050,5305},{-3935,-7053,5307},
+    {-4128,-7055,5310},{-4321,-7058,5314},{-4514,-7060,5317},{-4707,-7063,5320},{-4901,-7066,5324},{-5095,-7070,5328},{-5289,-7073,5332},{-5484,-7076,5336},
+    {-5679,-7080,5340},{-5874,-7084,5344},{-6070,-7088,5349},{-6266,-7092,5353},{-6463,-7096,5358},{-6660,-7100,5363},{-6857,-7104,5368},{-7054,-7108,5373},
+    {-7252,-7113,5378},{-7451,-7117,5383},{-7650,-7122,5389},{-7849,-7127,5394},{-8049,-7132,5400},{-8249,-7136,5405},{-8449,-7141,5411},{-8650,-7146,5416},
+    {-8851,-7151,5422},{-9053,-7156,5428},{-9255,-7162,5433},{-9457,-7167,5439},{-9660,-7172,5445},{-9864,-7177,5451},{-10068,-7182,5456},{-10272,-7187,5462},
+    {-10476,-7193,5468},{-10681,-7198,5474},{-10887,-7203,5479},{-11093,-7208,5485},{-11299,-7213,5490},{-11506,-7218,5496},{-11713,-7223,5501},{-11920,-7228,5507},
+    {-12128,-7233,5512},{-12336,-7238,5517},{-12545,-7243,5522},{-12754,-7248,5527},{-12963,-7252,5532},{-13173,-7257,5537},{-13383,-7261,5542},{-13593,-7266,5547},
+    {-13804,-7270,5551},{-14015,-7274,5555},{-14226,-7278,5559},{-14437,-7282,5564},{-14649,-7286,5567},{-14861,-7289,5571},{-15073,-7293,5575},{-15286,-7296,5578},
+    {-15498,-7299,5581},{-15711,-7302,5585},{-15924,-7305,5588},{-16137,-7308,5590},{-16350,-7310,5593},{-16564,-7313,5595},{-16777,-7315,5597},{-16991,-7317,5599},
+    {-17204,-7319,5601},{-17418,-7320,5603},{-17631,-7322,5604},{-17845,-7323,5606},{17942,-7324,5607},{17729,-7325,5608},{17515,-7326,5608},{17302,-7327,5609},
+    {17089,-7327,5609},{16876,-7327,5609},{16663,-7327,5609},{16451,-7327,5609},{16238,-7326,5608},{16026,-7326,5608},{15814,-7325,5607},{15602,-7324,5606},
+    {15391,-7323,5604},{15180,-7322,5603},{14969,-7320,5601},{14759,-7318,5599},{14548,-7317,5597}
+  },
+  {  // -86
+    {14235,-7451,5732},{14014,-7446,5727},{13795,-7441,5723},{13576,-7436,5717},{13359,-7431,5712},{13142,-7425,5706},{12927,-7419,5700},{12712,-7413,5694},
+    {12499,-7406,5687},{12286,-7399,5680},{12075,-7392,5673},{11865,-7384,5665},{11656,-7377,5658},{11448,-7369,5650},{11241,-7361,5641},{11035,-7352,5633},
+    {10830,-7344,5624},{10626,-7335,5615},{10423,-7326,5606},{10222,-7317,5597},{10021,-7308,5588},{9821,-7299,5578},{9622,-7289,5568},{9425,-7280,5558},
+    {9228,-7270,5548},{9032,-7260,5538},{8837,-7250,5528},{8643,-7241,5517},{8449,-7231,5507},{8257,-7221,5496},{8065,-7211,5485},{7875,-7201,5475},
+    {7685,-7191,5464},{7495,-7181,5453},{7307,-7171,5442},{7119,-7161,5431},{6932,-7151,5420},{6745,-7142,5410},{6559,-7132,5399},{6374,-7122,5388},
+    {6189,-7113,5377},{6005,-7103,5367},{5821,-7094,5356},{5638,-7085,5346},{5455,-7076,5335},{5273,-7067,5325},{5091,-7058,5315},{4910,-7049,5305},
+    {4729,-7041,5295},{4548,-7033,5285},{4368,-7024,5275},{4188,-7017,5266},{4008,-7009,5257},{3829,-7001,5248},{3650,-6994,5239},{3471,-6987,5230},
+    {3292,-6980,5222},{3114,-6973,5214},{2935,-6967,5206},{2757,-6961,5198},{2579,-6955,5191},{2401,-6949,5184},{2223,-6944,5177},{2046,-6938,5171},
+    {1868,-6933,5165},{1690,-6929,5159},{1512,-6924,5153},{1335,-6920,5148},{1157,-6916,5143},{979,-6913,5139},{801,-6910,5134},{623,-6907,5131},
+    {445,-6904,5127},{267,-6901,5124},{89,-6899,5121},{-90,-6897,5119},{-268,-6896,5117},{-447,-6895,5115},{-626,-6894,5114},{-805,-6893,5113},
+    {-985,-6893,5113},{-1165,-6893,5113},{-1345,-6893,5113},{-1525,-6894,5114},{-1706,-6895,5115},{-1887,-6896,5117},{-2068,-6897,5119},{-2250,-6899,5121},
+    {-2432,-6901,5124},{-2614,-6904,5127},{-2797,-6906,5131},{-2981,-6910,5135},{-3164,-6913,5139},{-3349,-6917,5144},{-3533,-6921,5149},{-3718,-6925,5154},
+    {-3904,-6929,5160},{-4090,-6934,5166},{-4277,-6939,5173},{-4464,-6945,5180},{-4651,-6951,5187},{-4839,-6957,5194},{-5028,-6963,5202},{-5218,-6969,5210},
+    {-5408,-6976,5219},{-5598,-6983,5228},{-5789,-6991,5237},{-5981,-6998,5246},{-6173,-7006,5255},{-6366,-7014,5265},{-6560,-7023,5275},{-6754,-7031,5285},
+    {-6949,-7040,5296},{-7145,-7049,5306},{-7341,-7058,5317},{-7539,-7067,5328},{-7736,-7077,5339},{-7935,-7086,5351},{-8134,-7096,5362},{-8334,-7106,5373},
+    {-8535,-7116,5385},{-8737,-7126,5396},{-8939,-7136,5408},{-9143,-7147,5420},{-9347,-7157,5432},{-9551,-7167,5443},{-9757,-7178,5455},{-9964,-7188,5467},
+    {-10171,-7199,5478},{-10379,-7210,5490},{-10588,-7220,5501},{-10798,-7231,5513},{-11009,-7241,5524},{-11221,-7251,5535},{-11434,-7262,5546},{-11647,-7272,5557},
+    {-11861,-7282,5568},{-12077,-7292,5578},{-12293,-7302,5589},{-12510,-7312,5599},{-12727,-7322,5609},{-12946,-7331,5618},{-13165,-7340,5628},{-13386,-7349,5637},
+    {-13607,-7358,5646},{-13828,-7367,5654},{-14051,-7375,5663},{-14274,-7383,5671},{-14498,-7391,5679},{-14723,-7398,5686},{-14948,-7406,5693},{-15174,-7413,5700},
+    {-15401,-7419,5706},{-15628,-7425,5712},{-15855,-7431,5718},{-16083,-7437,5723},{-16311,-7442,5728},{-16540,-7447,5733},{-16769,-7452,5737},{-16998,-7456,5741},
+    {-17227,-7460,5744},{-17457,-7463,5747},{-17686,-7466,5750},{-17916,-7468,5752},{17855,-7471,5754},{17625,-7472,5755},{17396,-7474,5756},{17167,-7475,5757},
+    {16938,-7475,5757},{16710,-7475,5757},{16482,-7475,5757},{16254,-7474,5756},{16027,-7473,5755},{15801,-7472,5753},{15575,-7470,5751},{15349,-7468,5749},
+    {15125,-7465,5746},{14901,-7462,5743},{14678,-7459,5740},{14456,-7455,5736},{14235,-7451,5732}
+  },
+  {  // -84
+    {13854,-7580,5853},{13623,-7573,5846},{13393,-7565,5839},{13165,-7557,5831},{12939,-7548,5823},{12715,-7538,5814},{12493,-7529,5805},{12272,-7519,5795},
+    {12054,-7508,5786},{11837,-7497,5775},{11622,-7486,5764},{11409,-7474,5753},{11198,-7462,5742},{10989,-7450,5730},{10782,-7437,5718},{10576,-7424,5705},
+    {10372,-7411,5692},{10170,-7398,5679},{9969,-7384,5666},{9770,-7371,5652},{9573,-7357,5638},{9377,-7343,5624},{9183,-7328,5610},{8990,-7314,5595},
+    {8798,-7299,5581},{8608,-7285,5566},{8419,-7270,5550},{8231,-7256,5535},{8045,-7241,5520},{7859,-7226,5504},{7675,-7211,5489},{7492,-7197,5473},
+    {7309,-7182,5457},{7128,-7167,5441},{6948,-7153,5425},{6769,-7138,5409},{6590,-7124,5393},{6412,-7109,5378},{6235,-7095,5362},{6059,-7081,5346},
+    {5883,-7067,5330},{5708,-7054,5314},{5534,-7040,5299},{5360,-7027,5283},{5187,-7014,5268},{5014,-7001,5253},{4842,-6988,5238},{4670,-6976,5223},
+    {4499,-6964,5208},{4328,-6952,5194},{4157,-6940,5180},{3987,-6929,5166},{3817,-6918,5152},{3648,-6908,5139},{3478,-6897,5126},{3309,-6887,5113},
+    {3140,-6877,5101},{2971,-6868,5089},{2803,-6859,5077},{2634,-6850,5066},{2466,-6842,5055},{2298,-6834,5044},{2130,-6827,5034},{1962,-6819,5024},
+    {1794,-6812,5015},{1626,-6806,5006},{1457,-6800,4998},{1289,-6794,4990},{1121,-6789,4983},{953,-6784,4976},{784,-6779,4969},{616,-6775,4963},
+    {447,-6771,4958},{278,-6768,4953},{109,-6765,4949},{-61,-6762,4945},{-231,-6760,4942},{-401,-6758,4940},{-571,-6757,4938},{-742,-6756,4936},
+    {-913,-6755,4935},{-1084,-6755,4935},{-1256,-6756,4935},{-1428,-6756,4936},{-1601,-6757,4938},{-1774,-6759,4940},{-1948,-6761,4943},{-2122,-6763,4946},
+    {-2296,-6766,4950},{-2472,-6769,4954},{-2647,-6773,4959},{-2824,-6777,4965},{-3001,-6782,4971},{-3178,-6787,4978},{-3356,-6792,4986},{-3535,-6798,4994},
+    {-3714,-6804,5002},{-3894,-6811,5011},{-4075,-6818,5021},{-4256,-6826,5031},{-4438,-6834,5042},{-4621,-6842,5053},{-4804,-6851,5065},{-4989,-6861,5077},
+    {-5174,-6870,5090},{-5359,-6881,5103},{-5546,-6891,5116},{-5733,-6902,5130},{-5921,-6913,5145},{-6110,-6925,5160},{-6300,-6937,5175},{-6490,-6950,5190},
+    {-6682,-6962,5206},{-6874,-6975,5222},{-7067,-6989,5238},{-7261,-7002,5255},{-7456,-7016,5272},{-7652,-7031,5289},{-7849,-7045,5306},{-8047,-7060,5324},
+    {-8246,-7075,5341},{-8446,-7090,5359},{-8648,-7105,5377},{-8850,-7121,5394},{-9053,-7137,5412},{-9258,-7152,5430},{-9464,-7168,5448},{-9671,-7184,5466},
+    {-9879,-7200,5483},{-10088,-7216,5501},{-10299,-7232,5518},{-10511,-7248,5536},{-10725,-7264,5553},{-10939,-7280,5570},{-11156,-7296,5586},{-11373,-7312,5603},
+    {-11592,-7328,5619},{-11813,-7343,5635},{-12035,-7358,5650},{-12258,-7374,5666},{-12483,-7388,5681},{-12710,-7403,5695},{-12938,-7417,5709},{-13167,-7431,5723},
+    {-13398,-7445,5736},{-13630,-7458,5749},{-13864,-7471,5761},{-14100,-7484,5773},{-14336,-7496,5784},{-14574,-7508,5795},{-14814,-7519,5806},{-15054,-7530,5816},
+    {-15296,-7540,5825},{-15539,-7550,5834},{-15783,-7559,5842},{-16028,-7567,5849},{-16273,-7575,5856},{-16520,-7583,5863},{-16767,-7590,5869},{-17015,-7596,5874},
+    {-17264,-7602,5879},{-17512,-7607,5883},{-17761,-7611,5886},{17990,-7615,5889},{17741,-7618,5892},{17492,-7620,5894},{17243,-7622,5895},{16995,-7623,5895},
+    {16747,-7623,5895},{16500,-7623,5895},{16253,-7622,5894},{16008,-7621,5892},{15763,-7619,5890},{15520,-7616,5887},{15278,-7613,5884},{15037,-7609,5880},
+    {14797,-7604,5876},{14559,-7599,5871},{14323,-7593,5865},{14088,-7587,5860},{13854,-7580,5853}
+  },
+  {  // -82
+    {13393,-7702,5961},{13151,-7691,5951},{12912,-7680,5941},{12675,-7668,5931},{12442,-7655,5920},{12212,-7642,5908},{11985,-7628,5896},{11761,-7614,5883},
+    {11540,-7599,5870},{11322,-7584,5856},{11107,-7569,5842},{10894,-7553,5827},{10684,-7536,5812},{10477,-7519,5797},{10273,-7502,5781},{10071,-7485,5764},
+    {9871,-7467,5748},{9674,-7449,5731},{9479,-7431,5713},{9286,-7412,5695},{9095,-7393,5677},{8906,-7375,5659},{8719,-7356,5640},{8534,-7336,5621},
+    {8350,-7317,5602},{8168,-7298,5582},{7988,-7279,5563},{7809,-7259,5543},{7631,-7240,5523},{7455,-7220,5503},{7280,-7201,5482},{7106,-7182,5462},
+    {6934,-7162,5441},{6762,-7143,5421},{6591,-7124,5400},{6422,-7105,5379},{6253,-7086,5358},{6085,-7068,5338},{5917,-7050,5317},{5751,-7031,5296},
+    {5585,-7014,5276},{5419,-6996,5255},{5254,-6979,5235},{5090,-6961,5215},{4926,-6945,5195},{4763,-6928,5175},{4600,-6912,5155},{4438,-6897,5136},
+    {4276,-6881,5117},{4114,-6866,5098},{3953,-6852,5079},{3792,-6837,5061},{3631,-6824,5043},{3471,-6810,5026},{3311,-6797,5008},{3150,-6785,4992},
+    {2991,-6773,4975},{2831,-6761,4960},{2671,-6750,4944},{2512,-6740,4929},{2352,-6729,4915},{2193,-6720,4901},{2034,-6710,4887},{1875,-6702,4875},
+    {1715,-6693,4862},{1556,-6685,4851},{1397,-6678,4840},{1237,-6671,4829},{1078,-6665,4819},{918,-6659,4810},{758,-6653,4801},{598,-6648,4794},
+    {438,-6643,4786},{277,-6639,4780},{116,-6636,4774},{-45,-6632,4769},{-207,-6630,4765},{-369,-6628,4761},{-531,-6626,4758},{-694,-6624,4756},
+    {-857,-6624,4754},{-1021,-6623,4754},{-1185,-6624,4754},{-1350,-6624,4755},{-1516,-6625,4756},{-1682,-6627,4759},{-1848,-6629,4762},{-2016,-6632,4766},
+    {-2184,-6635,4771},{-2352,-6639,4777},{-2522,-6644,4783},{-2692,-6649,4790},{-2863,-6654,4798},{-3034,-6660,4807},{-3206,-6667,4817},{-3380,-6674,4827},
+    {-3553,-6681,4838},{-3728,-6690,4850},{-3904,-6699,4863},{-4080,-6708,4876},{-4257,-6718,4891},{-4435,-6729,4905},{-4613,-6740,4921},{-4793,-6752,4937},
+    {-4973,-6764,4954},{-5154,-6777,4971},{-5337,-6790,4989},{-5520,-6804,5008},{-5703,-6819,5027},{-5888,-6834,5047},{-6074,-6849,5067},{-6260,-6865,5088},
+    {-6448,-6882,5109},{-6636,-6899,5131},{-6826,-6917,5153},{-7016,-6935,5176},{-7208,-6953,5198},{-7400,-6972,5221},{-7594,-6991,5245},{-7789,-7010,5268},
+    {-7985,-7030,5292},{-8182,-7050,5316},{-8381,-7071,5340},{-8581,-7091,5364},{-8782,-7112,5388},{-8984,-7133,5412},{-9188,-7155,5436},{-9394,-7176,5460},
+    {-9601,-7198,5484},{-9810,-7219,5507},{-10020,-7241,5531},{-10232,-7263,5554},{-10446,-7284,5577},{-10662,-7306,5600},{-10879,-7328,5622},{-11099,-7349,5644},
+    {-11321,-7370,5666},{-11545,-7391,5687},{-11771,-7412,5708},{-11999,-7433,5728},{-12229,-7453,5748},{-12462,-7473,5767},{-12697,-7493,5786},{-12935,-7512,5804},
+    {-13174,-7531,5822},{-13417,-7549,5839},{-13662,-7567,5855},{-13909,-7584,5870},{-14158,-7601,5885},{-14410,-7617,5899},{-14665,-7632,5913},{-14921,-7647,5925},
+    {-15180,-7661,5937},{-15441,-7674,5948},{-15704,-7687,5959},{-15969,-7699,5968},{-16235,-7710,5977},{-16503,-7720,5985},{-16773,-7729,5992},{-17044,-7737,5999},
+    {-17315,-7744,6005},{-17588,-7751,6010},{-17861,-7757,6014},{17866,-7761,6017},{17592,-7765,6020},{17319,-7768,6021},{17046,-7769,6022},{16774,-7770,6023},
+    {16502,-7770,6022},{16232,-7769,6021},{15963,-7767,6019},{15696,-7765,6016},{15431,-7761,6013},{15167,-7756,6008},{14906,-7751,6004},{14647,-7745,5998},
+    {14391,-7738,5992},{14137,-7730,5985},{13886,-7721,5977},{13638,-7712,5969},{13393,-7702,5961}
+  },
+  {  // -80
+    {12835,-7813,6053},{12584,-7798,6041},{12337,-7783,6028},{12096,-7767,6015},{11859,-7750,6001},{11626,-7733,5987},{11398,-7715,5971},{11175,-7696,5956},
+    {10955,-7677,5939},{10740,-7658,5922},{10528,-7637,5905},{10320,-7617,5887},{10116,-7596,5868},{9916,-7575,5849},{9718,-7553,5830},{9524,-7531,5810},
+    {9333,-7509,5789},{9144,-7486,5768},{8958,-7463,5747},{8775,-7440,5725},{8594,-7417,5703},{8416,-7394,5681},{8239,-7370,5658},{8065,-7346,5635},
+    {7892,-7323,5612},{7721,-7299,5588},{7552,-7275,5564},{7384,-7251,5540},{7217,-7227,5516},{7052,-7203,5491},{6888,-7180,5466},{6725,-7156,5441},
+    {6564,-7132,5416},{6403,-7109,5391},{6243,-7086,5366},{6083,-7063,5340},{5925,-7040,5315},{5767,-7017,5290},{5610,-6995,5264},{5453,-6973,5239},
+    {5297,-6951,5214},{5141,-6930,5189},{4986,-6909,5164},{4831,-6889,5140},{4676,-6868,5115},{4522,-6849,5091},{4368,-6830,5067},{4215,-6811,5043},
+    {4062,-6793,5019},{3909,-6775,4996},{3756,-6758,4974},{3603,-6741,4951},{3451,-6725,4929},{3299,-6709,4908},{3147,-6694,4887},{2995,-6680,4866},
+    {2843,-6666,4846},{2692,-6653,4827},{2540,-6640,4808},{2389,-6628,4790},{2237,-6617,4772},{2086,-6606,4755},{1935,-6595,4738},{1784,-6585,4722},
+    {1633,-6576,4707},{1481,-6567,4693},{1330,-6559,4679},{1179,-6551,4666},{1027,-6544,4654},{875,-6538,4643},{723,-6532,4632},{571,-6526,4622},
+    {419,-6521,4613},{266,-6516,4605},{113,-6512,4597},{-41,-6509,4591},{-195,-6506,4585},{-349,-6503,4581},{-504,-6501,4577},{-660,-6500,4574},
+    {-816,-6499,4572},{-972,-6499,4571},{-1130,-6499,4570},{-1288,-6499,4571},{-1447,-6500,4573},{-1606,-6502,4576},{-1767,-6505,4579},{-1928,-6507,4584},
+    {-2090,-6511,4590},{-2253,-6515,4596},{-2416,-6520,4604},{-2581,-6525,4612},{-2746,-6531,4622},{-2913,-6538,4633},{-3080,-6545,4644},{-3248,-6553,4657},
+    {-3417,-6562,4671},{-3587,-6572,4685},{-3758,-6582,4701},{-3930,-6593,4717},{-4103,-6604,4734},{-4276,-6617,4753},{-4451,-6630,4772},{-4626,-6644,4792},
+    {-4803,-6658,4813},{-4980,-6673,4835},{-5158,-6690,4857},{-5337,-6706,4881},{-5517,-6724,4905},{-5698,-6742,4930},{-5879,-6761,4955},{-6062,-6780,4981},
+    {-6245,-6801,5008},{-6430,-6821,5035},{-6616,-6843,5063},{-6802,-6865,5091},{-6990,-6887,5120},{-7178,-6911,5149},{-7368,-6934,5178},{-7559,-6958,5208},
+    {-7751,-6983,5238},{-7944,-7008,5268},{-8139,-7034,5298},{-8335,-7059,5329},{-8532,-7086,5359},{-8731,-7112,5389},{-8932,-7139,5420},{-9134,-7166,5450},
+    {-9338,-7193,5480},{-9544,-7220,5510},{-9751,-7247,5539},{-9961,-7274,5569},{-10173,-7302,5598},{-10388,-7329,5626},{-10604,-7357,5654},{-10824,-7384,5682},
+    {-11046,-7411,5709},{-11270,-7438,5736},{-11498,-7464,5762},{-11729,-7490,5787},{-11962,-7516,5811},{-12199,-7542,5835},{-12440,-7567,5859},{-12684,-7592,5881},
+    {-12931,-7616,5902},{-13182,-7639,5923},{-13437,-7662,5943},{-13696,-7684,5962},{-13959,-7705,5980},{-14225,-7726,5997},{-14495,-7746,6013},{-14769,-7765,6028},
+    {-15047,-7783,6043},{-15329,-7800,6056},{-15614,-7816,6068},{-15902,-7831,6080},{-16194,-7844,6090},{-16489,-7857,6099},{-16786,-7869,6107},{-17085,-7879,6115},
+    {-17386,-7888,6121},{-17689,-7896,6126},{-17993,-7902,6131},{17702,-7907,6134},{17397,-7911,6136},{17093,-7914,6138},{16789,-7915,6138},{16486,-7915,6138},
+    {16186,-7914,6136},{15887,-7912,6134},{15591,-7908,6131},{15297,-7904,6127},{15007,-7898,6122},{14721,-7891,6116},{14438,-7882,6109},{14160,-7873,6102},
+    {13886,-7863,6094},{13616,-7852,6085},{13351,-7840,6075},{13090,-7827,6064},{12835,-7813,6053}
+  },
+  {  // -78
+    {12166,-7910,6130},{11911,-7891,6115},{11663,-7871,6100},{11421,-7850,6084},{11185,-7829,6067},{10956,-7807,6050},{10733,-7785,6032},{10515,-7762,6013},
+    {10303,-7738,5994},{10096,-7714,5974},{9893,-7690,5953},{9695,-7665,5932},{9502,-7640,5910},{9313,-7614,5888},{9127,-7588,5865},{8945,-7562,5841},
+    {8766,-7535,5817},{8591,-7508,5793},{8418,-7481,5768},{8248,-7454,5743},{8081,-7427,5717},{7916,-7399,5691},{7753,-7371,5664},{7591,-7343,5638},
+    {7432,-7315,5610},{7274,-7287,5583},{7118,-7259,5555},{6963,-7231,5527},{6810,-7203,5498},{6657,-7175,5469},{6505,-7148,5440},{6354,-7120,5411},
+    {6204,-7092,5382},{6055,-7065,5353},{5906,-7038,5323},{5758,-7011,5293},{5610,-6984,5264},{5463,-6958,5234},{5316,-6932,5204},{5169,-6906,5175},
+    {5023,-6881,5145},{4876,-6856,5116},{4730,-6832,5087},{4584,-6808,5058},{4439,-6785,5029},{4293,-6762,5001},{4148,-6740,4972},{4002,-6719,4944},
+    {3857,-6698,4917},{3712,-6678,4890},{3566,-6659,4863},{3421,-6640,4837},{3277,-6622,4811},{3132,-6605,4786},{2987,-6588,4761},{2842,-6572,4737},
+    {2698,-6557,4714},{2553,-6543,4691},{2409,-6529,4669},{2265,-6516,4647},{2121,-6503,4626},{1977,-6492,4606},{1833,-6481,4587},{1689,-6470,4569},
+    {1545,-6461,4551},{1401,-6452,4534},{1257,-6443,4518},{1113,-6435,4503},{969,-6428,4488},{824,-6421,4475},{680,-6415,4462},{535,-6410,4450},
+    {390,-6405,4440},{245,-6400,4430},{99,-6396,4421},{-47,-6393,4413},{-194,-6389,4406},{-341,-6387,4400},{-489,-6385,4395},{-638,-6383,4392},
+    {-787,-6382,4389},{-937,-6382,4387},{-1088,-6382,4387},{-1239,-6382,4387},{-1392,-6383,4389},{-1545,-6385,4392},{-1700,-6387,4396},{-1855,-6390,4401},
+    {-2012,-6394,4407},{-2169,-6398,4414},{-2328,-6403,4423},{-2487,-6408,4433},{-2648,-6415,4444},{-2810,-6422,4456},{-2973,-6430,4470},{-3137,-6438,4484},
+    {-3302,-6448,4500},{-3468,-6458,4517},{-3635,-6469,4535},{-3803,-6481,4555},{-3972,-6494,4575},{-4142,-6508,4597},{-4313,-6522,4620},{-4485,-6538,4644},
+    {-4658,-6555,4669},{-4832,-6572,4695},{-5006,-6590,4721},{-5182,-6610,4749},{-5358,-6630,4778},{-5535,-6651,4808},{-5713,-6673,4839},{-5892,-6696,4870},
+    {-6072,-6719,4902},{-6252,-6744,4935},{-6434,-6769,4969},{-6616,-6795,5003},{-6799,-6822,5037},{-6983,-6849,5072},{-7169,-6877,5108},{-7355,-6906,5144},
+    {-7542,-6935,5180},{-7730,-6965,5217},{-7920,-6995,5253},{-8111,-7026,5290},{-8303,-7057,5327},{-8497,-7089,5363},{-8693,-7121,5400},{-8890,-7153,5437},
+    {-9089,-7186,5473},{-9290,-7219,5509},{-9493,-7252,5545},{-9698,-7285,5580},{-9906,-7318,5615},{-10116,-7351,5649},{-10330,-7384,5683},{-10546,-7417,5716},
+    {-10765,-7449,5748},{-10988,-7482,5780},{-11215,-7514,5811},{-11445,-7546,5841},{-11679,-7578,5871},{-11918,-7609,5899},{-12161,-7640,5926},{-12409,-7670,5953},
+    {-12662,-7699,5978},{-12920,-7728,6002},{-13184,-7756,6026},{-13453,-7783,6048},{-13729,-7810,6069},{-14010,-7835,6089},{-14297,-7859,6107},{-14590,-7883,6125},
+    {-14890,-7905,6141},{-15195,-7926,6156},{-15507,-7945,6170},{-15824,-7963,6183},{-16147,-7980,6194},{-16474,-7995,6204},{-16807,-8009,6213},{-17143,-8021,6221},
+    {-17483,-8031,6227},{-17826,-8040,6233},{17829,-8047,6237},{17484,-8052,6240},{17138,-8056,6241},{16792,-8058,6242},{16449,-8058,6242},{16107,-8057,6240},
+    {15769,-8054,6237},{15435,-8049,6234},{15106,-8043,6229},{14782,-8035,6223},{14464,-8026,6217},{14152,-8015,6209},{13847,-8004,6200},{13549,-7991,6191},
+    {13258,-7976,6180},{12974,-7961,6169},{12698,-7945,6157},{12428,-7928,6144},{12166,-7910,6130}
+  },
+  {  // -76
+    {11382,-7987,6191},{11130,-7963,6174},{10887,-7939,6156},{10653,-7914,6137},{10427,-7888,6118},{10209,-7862,6097},{9997,-7835,6076},{9793,-7808,6055},
+    {9594,-7780,6032},{9402,-7752,6010},{9215,-7724,5986},{9032,-7695,5962},{8855,-7666,5937},{8682,-7636,5911},{8513,-7606,5885},{8347,-7576,5859},
+    {8185,-7546,5832},{8026,-7515,5804},{7870,-7484,5776},{7716,-7453,5748},{7565,-7422,5718},{7416,-7391,5689},{7268,-7359,5659},{7123,-7328,5628},
+    {6979,-7296,5598},{6836,-7264,5566},{6694,-7232,5535},{6554,-7201,5503},{6414,-7169,5471},{6275,-7137,5438},{6136,-7105,5405},{5998,-7074,5372},
+    {5861,-7043,5339},{5724,-7011,5305},{5586,-6980,5272},{5449,-6950,5238},{5313,-6920,5204},{5176,-6890,5171},{5039,-6860,5137},{4902,-6831,5103},
+    {4765,-6803,5070},{4627,-6775,5036},{4490,-6748,5003},{4352,-6721,4970},{4215,-6695,4937},{4077,-6669,4904},{3939,-6645,4872},{3800,-6621,4840},
+    {3662,-6598,4809},{3524,-6576,4778},{3385,-6555,4748},{3247,-6534,4718},{3108,-6515,4689},{2970,-6496,4660},{2831,-6478,4632},{2693,-6461,4605},
+    {2554,-6445,4578},{2416,-6430,4552},{2278,-6416,4527},{2140,-6403,4503},{2002,-6390,4479},{1864,-6378,4456},{1726,-6367,4435},{1589,-6357,4414},
+    {1451,-6348,4394},{1314,-6339,4374},{1177,-6331,4356},{1039,-6324,4339},{902,-6317,4323},{765,-6311,4307},{627,-6305,4293},{490,-6300,4279},
+    {352,-6295,4267},{213,-6291,4256},{75,-6287,4246},{-64,-6284,4237},{-204,-6282,4229},{-344,-6279,4222},{-485,-6277,4216},{-627,-6276,4211},
+    {-769,-6275,4208},{-913,-6274,4206},{-1057,-6274,4205},{-1202,-6275,4205},{-1349,-6276,4206},{-1497,-6277,4209},{-1646,-6279,4213},{-1796,-6282,4218},
+    {-1947,-6285,4225},{-2100,-6289,4233},{-2254,-6294,4243},{-2409,-6299,4254},{-2565,-6306,4266},{-2723,-6313,4279},{-2882,-6320,4295},{-3043,-6329,4311},
+    {-3204,-6339,4329},{-3367,-6350,4348},{-3531,-6362,4369},{-3696,-6374,4391},{-3862,-6388,4415},{-4030,-6403,4439},{-4198,-6419,4466},{-4367,-6436,4493},
+    {-4537,-6454,4522},{-4708,-6474,4552},{-4879,-6494,4583},{-5052,-6516,4616},{-5225,-6538,4649},{-5399,-6562,4684},{-5573,-6587,4720},{-5748,-6613,4757},
+    {-5924,-6640,4794},{-6101,-6667,4833},{-6278,-6696,4872},{-6456,-6726,4912},{-6634,-6757,4952},{-6814,-6788,4993},{-6994,-6821,5035},{-7175,-6854,5077},
+    {-7356,-6888,5120},{-7539,-6922,5162},{-7723,-6957,5205},{-7908,-6993,5248},{-8094,-7029,5292},{-8281,-7066,5335},{-8470,-7103,5378},{-8660,-7141,5420},
+    {-8853,-7179,5463},{-9047,-7217,5505},{-9243,-7255,5547},{-9442,-7294,5588},{-9643,-7332,5629},{-9847,-7371,5669},{-10054,-7410,5708},{-10264,-7448,5746},
+    {-10478,-7486,5784},{-10696,-7525,5821},{-10918,-7563,5857},{-11144,-7600,5892},{-11376,-7638,5925},{-11613,-7674,5958},{-11855,-7711,5989},{-12104,-7746,6020},
+    {-12360,-7781,6049},{-12623,-7816,6076},{-12893,-7849,6103},{-13171,-7881,6128},{-13457,-7913,6151},{-13753,-7943,6174},{-14057,-7972,6195},{-14371,-8000,6214},
+    {-14695,-8027,6232},{-15028,-8051,6248},{-15372,-8075,6263},{-15725,-8096,6277},{-16087,-8116,6289},{-16458,-8134,6300},{-16838,-8149,6309},{-17224,-8163,6317},
+    {-17617,-8174,6323},{17986,-8184,6328},{17586,-8191,6332},{17184,-8195,6334},{16782,-8198,6335},{16383,-8198,6334},{15987,-8196,6332},{15596,-8192,6329},
+    {15212,-8185,6325},{14836,-8177,6320},{14468,-8167,6313},{14111,-8155,6306},{13764,-8142,6297},{13428,-8127,6287},{13103,-8110,6276},{12789,-8092,6264},
+    {12487,-8073,6252},{12195,-8053,6238},{11913,-8032,6223},{11643,-8010,6208},{11382,-7987,6191}
+  },
+  {  // -74
+    {10491,-8042,6237},{10255,-8013,6217},{10028,-7984,6196},{9812,-7955,6175},{9604,-7925,6152},{9405,-7894,6129},{9214,-7864,6106},{9029,-7832,6081},
+    {8851,-7801,6056},{8679,-7769,6030},{8512,-7737,6004},{8350,-7705,5977},{8193,-7673,5949},{8040,-7640,5921},{7891,-7607,5892},{7745,-7573,5863},
+    {7602,-7540,5833},{7463,-7506,5802},{7325,-7472,5771},{7190,-7438,5740},{7057,-7404,5708},{6925,-7369,5675},{6795,-7334,5642},{6667,-7300,5608},
+    {6539,-7265,5574},{6412,-7230,5540},{6286,-7194,5505},{6161,-7159,5469},{6035,-7124,5433},{5910,-7089,5397},{5786,-7054,5361},{5661,-7019,5324},
+    {5536,-6984,5287},{5411,-6949,5250},{5285,-6915,5213},{5160,-6881,5175},{5033,-6847,5138},{4907,-6814,5100},{4780,-6781,5062},{4652,-6749,5025},
+    {4524,-6718,4987},{4395,-6687,4950},{4265,-6656,4913},{4135,-6627,4876},{4005,-6598,4839},{3874,-6570,4803},{3743,-6543,4767},{3611,-6517,4731},
+    {3478,-6492,4697},{3346,-6468,4662},{3213,-6445,4628},{3080,-6424,4595},{2947,-6403,4563},{2813,-6383,4531},{2680,-6365,4500},{2546,-6347,4469},
+    {2413,-6331,4440},{2280,-6316,4411},{2147,-6302,4384},{2014,-6288,4357},{1881,-6276,4331},{1748,-6265,4306},{1616,-6255,4282},{1484,-6246,4259},
+    {1352,-6237,4236},{1221,-6229,4215},{1090,-6222,4195},{958,-6216,4176},{827,-6211,4158},{697,-6205,4141},{566,-6201,4126},{435,-6197,4111},
+    {304,-6193,4097},{172,-6190,4085},{41,-6188,4073},{-91,-6185,4063},{-224,-6183,4054},{-357,-6181,4046},{-491,-6180,4039},{-626,-6179,4034},
+    {-762,-6178,4030},{-899,-6178,4027},{-1037,-6178,4025},{-1176,-6178,4025},{-1317,-6179,4027},{-1459,-6180,4029},{-1602,-6182,4033},{-1747,-6184,4039},
+    {-1894,-6187,4046},{-2042,-6190,4054},{-2192,-6194,4064},{-2343,-6199,4076},{-2496,-6205,4089},{-2650,-6212,4104},{-2806,-6219,4121},{-2964,-6228,4139},
+    {-3122,-6238,4158},{-3282,-6248,4180},{-3444,-6260,4203},{-3607,-6274,4228},{-3770,-6288,4254},{-3935,-6304,4282},{-4101,-6321,4311},{-4268,-6339,4342},
+    {-4436,-6358,4375},{-4604,-6379,4409},{-4773,-6402,4444},{-4943,-6425,4481},{-5114,-6450,4520},{-5284,-6476,4559},{-5456,-6504,4600},{-5628,-6533,4642},
+    {-5800,-6563,4685},{-5972,-6594,4729},{-6145,-6626,4774},{-6319,-6660,4819},{-6492,-6694,4866},{-6666,-6730,4913},{-6841,-6766,4961},{-7016,-6804,5009},
+    {-7191,-6842,5058},{-7368,-6881,5107},{-7545,-6921,5156},{-7722,-6961,5205},{-7901,-7003,5255},{-8080,-7044,5304},{-8261,-7086,5353},{-8443,-7129,5402},
+    {-8627,-7172,5450},{-8812,-7215,5499},{-9000,-7259,5546},{-9189,-7303,5593},{-9381,-7347,5639},{-9576,-7391,5685},{-9774,-7435,5730},{-9975,-7479,5773},
+    {-10180,-7522,5816},{-10390,-7566,5858},{-10604,-7610,5898},{-10823,-7653,5938},{-11047,-7696,5976},{-11278,-7738,6012},{-11516,-7780,6048},{-11762,-7821,6081},
+    {-12015,-7861,6114},{-12278,-7901,6145},{-12551,-7940,6174},{-12834,-7978,6201},{-13129,-8015,6227},{-13437,-8050,6252},{-13758,-8084,6274},{-14093,-8117,6295},
+    {-14444,-8148,6315},{-14810,-8177,6332},{-15192,-8204,6348},{-15591,-8229,6362},{-16006,-8252,6375},{-16436,-8272,6385},{-16881,-8290,6394},{-17338,-8305,6402},
+    {-17806,-8317,6408},{17718,-8326,6412},{17238,-8332,6415},{16757,-8335,6416},{16278,-8334,6415},{15805,-8331,6413},{15342,-8325,6410},{14890,-8317,6405},
+    {14452,-8306,6399},{14030,-8292,6392},{13625,-8277,6383},{13238,-8259,6374},{12868,-8240,6363},{12516,-8219,6350},{12181,-8197,6337},{11863,-8173,6323},
+    {11561,-8149,6307},{11273,-8123,6291},{11000,-8097,6274},{10739,-8070,6256},{10491,-8042,6237}
+  },
+  {  // -72
+    {9529,-8069,6267},{9319,-8036,6244},{9120,-8003,6221},{8931,-7970,6197},{8750,-7936,6172},{8577,-7902,6146},{8412,-7868,6120},{8253,-7834,6093},
+    {8100,-7800,6065},{7952,-7765,6037},{7810,-7731,6008},{7671,-7696,5978},{7537,-7660,5948},{7407,-7625,5917},{7279,-7590,5886},{7155,-7554,5854},
+    {7033,-7518,5821},{6913,-7482,5788},{6796,-7445,5754},{6680,-7409,5720},{6566,-7372,5685},{6453,-7335,5650},{6341,-7297,5614},{6229,-7260,5577},
+    {6118,-7222,5540},{6008,-7184,5503},{5898,-7146,5465},{5788,-7108,5426},{5677,-7070,5387},{5566,-7032,5348},{5455,-6994,5308},{5344,-6956,5268},
+    {5231,-6918,5228},{5118,-6880,5187},{5004,-6842,5146},{4890,-6805,5105},{4774,-6768,5064},{4657,-6732,5022},{4539,-6696,4981},{4420,-6661,4940},
+    {4300,-6626,4899},{4179,-6592,4858},{4057,-6559,4817},{3934,-6527,4776},{3810,-6495,4736},{3685,-6465,4696},{3560,-6436,4657},{3433,-6408,4618},
+    {3306,-6381,4580},{3178,-6356,4542},{3050,-6331,4505},{2921,-6308,4469},{2792,-6287,4433},{2662,-6267,4398},{2533,-6248,4365},{2403,-6230,4332},
+    {2274,-6214,4300},{2144,-6199,4269},{2015,-6186,4239},{1886,-6173,4210},{1757,-6162,4182},{1629,-6153,4155},{1502,-6144,4129},{1374,-6136,4104},
+    {1247,-6129,4080},{1121,-6123,4058},{995,-6118,4036},{870,-6114,4016},{744,-6110,3996},{620,-6107,3978},{495,-6104,3961},{371,-6102,3945},
+    {246,-6100,3931},{122,-6098,3917},{-3,-6097,3905},{-128,-6096,3894},{-254,-6095,3884},{-380,-6094,3875},{-507,-6093,3867},{-635,-6093,3861},
+    {-764,-6093,3857},{-894,-6092,3853},{-1026,-6092,3851},{-1159,-6093,3850},{-1294,-6093,3851},{-1430,-6094,3854},{-1569,-6095,3858},{-1709,-6097,3863},
+    {-1851,-6099,3870},{-1994,-6102,3879},{-2140,-6105,3889},{-2288,-6109,3902},{-2437,-6114,3916},{-2589,-6120,3932},{-2742,-6127,3949},{-2897,-6135,3969},
+    {-3054,-6145,3990},{-3212,-6155,4014},{-3371,-6167,4039},{-3532,-6180,4066},{-3694,-6195,4095},{-3858,-6211,4125},{-4022,-6228,4158},{-4187,-6247,4192},
+    {-4353,-6268,4229},{-4519,-6290,4267},{-4687,-6314,4306},{-4854,-6340,4347},{-5022,-6367,4390},{-5190,-6395,4434},{-5359,-6425,4480},{-5527,-6457,4527},
+    {-5696,-6490,4575},{-5864,-6524,4625},{-6033,-6560,4675},{-6201,-6597,4727},{-6370,-6635,4779},{-6538,-6674,4832},{-6707,-6715,4886},{-6876,-6757,4940},
+    {-7044,-6799,4995},{-7213,-6843,5050},{-7382,-6887,5105},{-7552,-6932,5161},{-7722,-6978,5216},{-7893,-7024,5272},{-8064,-7071,5327},{-8236,-7118,5382},
+    {-8410,-7166,5436},{-8585,-7214,5490},{-8761,-7263,5544},{-8939,-7312,5596},{-9120,-7361,5648},{-9303,-7410,5699},{-9488,-7459,5749},{-9677,-7508,5797},
+    {-9870,-7557,5845},{-10067,-7606,5891},{-10268,-7655,5936},{-10475,-7703,5979},{-10688,-7751,6021},{-10908,-7799,6062},{-11136,-7846,6101},{-11372,-7893,6138},
+    {-11617,-7939,6173},{-11874,-7984,6207},{-12143,-8028,6238},{-12426,-8072,6268},{-12724,-8114,6296},{-13039,-8155,6322},{-13373,-8194,6347},{-13728,-8232,6369},
+    {-14107,-8268,6389},{-14510,-8302,6407},{-14940,-8334,6424},{-15398,-8363,6438},{-15885,-8389,6450},{-16400,-8412,6461},{-16942,-8431,6470},{-17508,-8447,6476},
+    {17908,-8458,6481},{17312,-8466,6484},{16712,-8469,6486},{16114,-8468,6485},{15528,-8463,6483},{14960,-8454,6480},{14415,-8442,6475},{13898,-8426,6468},
+    {13410,-8408,6460},{12952,-8387,6450},{12524,-8364,6439},{12125,-8340,6427},{11753,-8313,6413},{11407,-8286,6399},{11083,-8257,6383},{10782,-8227,6366},
+    {10499,-8197,6348},{10234,-8166,6329},{9985,-8134,6309},{9751,-8102,6288},{9529,-8069,6267}
+  },
+  {  // -70
+    {8549,-8069,6282},{8376,-8032,6256},{8211,-7996,6230},{8055,-7960,6204},{7906,-7923,6176},{7764,-7887,6148},{7627,-7850,6119},{7496,-7814,6090},
+    {7370,-7777,6060},{7249,-7741,6029},{7131,-7704,5998},{7017,-7667,5966},{6906,-7630,5933},{6798,-7593,5900},{6693,-7556,5866},{6590,-7518,5832},
+    {6489,-7481,5797},{6390,-7443,5762},{6292,-7405,5726},{6195,-7366,5689},{6099,-7327,5652},{6004,-7288,5614},{5910,-7249,5575},{5815,-7209,5536},
+    {5721,-7170,5497},{5627,-7129,5456},{5532,-7089,5416},{5437,-7049,5374},{5341,-7008,5332},{5244,-6967,5290},{5147,-6926,5247},{5048,-6885,5204},
+    {4948,-6845,5161},{4847,-6804,5117},{4744,-6763,5072},{4640,-6723,5028},{4534,-6683,4983},{4426,-6644,4939},{4317,-6605,4894},{4207,-6566,4849},
+    {4095,-6529,4805},{3981,-6492,4760},{3865,-6456,4716},{3749,-6421,4672},{3630,-6387,4628},{3511,-6355,4585},{3390,-6324,4542},{3268,-6294,4500},
+    {3144,-6265,4459},{3020,-6238,4418},{2895,-6213,4378},{2770,-6189,4339},{2644,-6167,4301},{2517,-6146,4264},{2390,-6128,4228},{2263,-6110,4192},
+    {2137,-6095,4158},{2010,-6081,4125},{1883,-6069,4093},{1757,-6058,4062},{1632,-6048,4033},{1507,-6041,4004},{1383,-6034,3977},{1259,-6028,3951},
+    {1136,-6024,3926},{1014,-6020,3902},{893,-6018,3880},{773,-6016,3858},{653,-6015,3838},{534,-6014,3819},{415,-6014,3801},{297,-6014,3784},
+    {179,-6015,3769},{61,-6015,3755},{-57,-6016,3741},{-175,-6017,3730},{-293,-6018,3719},{-412,-6018,3710},{-532,-6019,3701},{-653,-6019,3695},
+    {-776,-6019,3689},{-899,-6020,3685},{-1024,-6020,3683},{-1151,-6020,3681},{-1280,-6020,3682},{-1411,-6021,3684},{-1544,-6021,3687},{-1679,-6022,3693},
+    {-1816,-6023,3700},{-1956,-6025,3709},{-2098,-6028,3719},{-2242,-6031,3732},{-2389,-6035,3747},{-2538,-6039,3763},{-2689,-6045,3782},{-2842,-6053,3803},
+    {-2996,-6061,3825},{-3153,-6071,3850},{-3311,-6082,3878},{-3471,-6095,3907},{-3632,-6109,3938},{-3794,-6125,3972},{-3957,-6143,4007},{-4121,-6163,4045},
+    {-4286,-6184,4084},{-4451,-6208,4126},{-4616,-6233,4170},{-4782,-6260,4215},{-4948,-6289,4262},{-5113,-6319,4311},{-5279,-6352,4362},{-5444,-6386,4414},
+    {-5609,-6422,4467},{-5773,-6459,4522},{-5937,-6498,4578},{-6101,-6538,4635},{-6264,-6580,4693},{-6427,-6623,4752},{-6589,-6668,4811},{-6751,-6713,4872},
+    {-6912,-6760,4932},{-7073,-6807,4993},{-7234,-6856,5055},{-7394,-6905,5116},{-7554,-6955,5178},{-7715,-7006,5239},{-7876,-7058,5300},{-8037,-7110,5361},
+    {-8198,-7162,5421},{-8361,-7215,5480},{-8524,-7268,5539},{-8689,-7321,5597},{-8855,-7375,5654},{-9024,-7429,5710},{-9194,-7483,5764},{-9367,-7536,5818},
+    {-9544,-7590,5870},{-9724,-7644,5920},{-9908,-7697,5969},{-10098,-7751,6017},{-10293,-7804,6062},{-10495,-7857,6106},{-10705,-7909,6148},{-10924,-7961,6188},
+    {-11153,-8012,6226},{-11394,-8062,6262},{-11650,-8112,6296},{-11921,-8161,6328},{-12211,-8209,6358},{-12524,-8255,6385},{-12861,-8300,6411},{-13229,-8344,6434},
+    {-13631,-8385,6455},{-14072,-8425,6473},{-14559,-8461,6490},{-15096,-8495,6504},{-15687,-8525,6516},{-16335,-8551,6526},{-17037,-8572,6534},{-17785,-8587,6540},
+    {17432,-8597,6543},{16634,-8601,6545},{15843,-8598,6545},{15077,-8590,6543},{14355,-8576,6539},{13685,-8558,6533},{13072,-8536,6526},{12517,-8511,6517},
+    {12015,-8483,6506},{11563,-8453,6494},{11155,-8422,6481},{10785,-8389,6466},{10449,-8355,6450},{10142,-8320,6433},{9860,-8285,6414},{9601,-8250,6394},
+    {9361,-8214,6374},{9138,-8178,6352},{8929,-8142,6329},{8733,-8105,6306},{8549,-8069,6282}
+  },
+  {  // -68
+    {7612,-8041,6282},{7477,-8002,6254},{7349,-7964,6226},{7227,-7925,6197},{7110,-7887,6167},{6998,-7849,6136},{6890,-7811,6105},{6786,-7773,6073},
+    {6686,-7735,6041},{6589,-7697,6008},{6495,-7659,5975},{6404,-7621,5941},{6315,-7583,5906},{6229,-7545,5871},{6144,-7507,5835},{6061,-7468,5799},
+    {5979,-7429,5762},{5899,-7390,5724},{5819,-7351,5686},{5740,-7311,5647},{5662,-7271,5608},{5584,-7231,5568},{5506,-7190,5527},{5428,-7149,5486},
+    {5349,-7108,5444},{5270,-7066,5401},{5190,-7024,5358},{5110,-6981,5314},{5028,-6938,5270},{4944,-6895,5225},{4860,-6852,5179},{4773,-6809,5133},
+    {4685,-6765,5087},{4595,-6722,5040},{4503,-6679,4993},{4409,-6635,4945},{4313,-6593,4897},{4214,-6550,4850},{4114,-6508,4802},{4011,-6467,4754},
+    {3906,-6427,4706},{3799,-6387,4658},{3689,-6349,4610},{3578,-6311,4563},{3465,-6275,4516},{3349,-6240,4470},{3232,-6207,4424},{3114,-6175,4379},
+    {2994,-6145,4335},{2872,-6117,4292},{2750,-6090,4249},{2627,-6066,4208},{2502,-6044,4167},{2378,-6023,4128},{2252,-6005,4089},{2127,-5988,4052},
+    {2002,-5974,4016},{1877,-5961,3981},{1752,-5951,3948},{1628,-5942,3916},{1504,-5935,3885},{1382,-5929,3855},{1260,-5925,3827},{1139,-5923,3800},
+    {1020,-5922,3774},{901,-5922,3750},{784,-5922,3727},{668,-5924,3705},{553,-5926,3684},{439,-5929,3664},{326,-5932,3646},{214,-5936,3629},
+    {102,-5939,3613},{-9,-5943,3598},{-120,-5946,3585},{-231,-5949,3572},{-343,-5952,3561},{-455,-5954,3551},{-567,-5956,3542},{-681,-5958,3535},
+    {-796,-5959,3529},{-912,-5960,3524},{-1031,-5961,3521},{-1151,-5961,3519},{-1274,-5961,3519},{-1399,-5961,3521},{-1526,-5961,3524},{-1657,-5961,3529},
+    {-1790,-5961,3536},{-1925,-5962,3545},{-2064,-5963,3555},{-2205,-5964,3568},{-2349,-5967,3583},{-2495,-5970,3600},{-2644,-5975,3620},{-2796,-5981,3641},
+    {-2949,-5988,3665},{-3105,-5996,3692},{-3262,-6007,3721},{-3421,-6019,3752},{-3582,-6033,3785},{-3743,-6048,3821},{-3905,-6066,3860},{-4069,-6086,3900},
+    {-4232,-6108,3943},{-4396,-6132,3989},{-4560,-6158,4036},{-4724,-6187,4085},{-4888,-6217,4137},{-5051,-6250,4190},{-5213,-6284,4246},{-5375,-6321,4303},
+    {-5537,-6359,4361},{-5697,-6399,4421},{-5856,-6441,4482},{-6015,-6485,4545},{-6172,-6530,4609},{-6328,-6577,4673},{-6484,-6625,4738},{-6638,-6674,4804},
+    {-6791,-6725,4871},{-6943,-6776,4938},{-7095,-6829,5005},{-7245,-6882,5072},{-7395,-6936,5139},{-7544,-6991,5206},{-7693,-7047,5272},{-7841,-7103,5339},
+    {-7990,-7160,5404},{-8138,-7217,5469},{-8286,-7274,5533},{-8435,-7332,5596},{-8585,-7389,5657},{-8736,-7447,5718},{-8888,-7505,5777},{-9042,-7563,5835},
+    {-9198,-7621,5891},{-9357,-7679,5946},{-9519,-7737,5998},{-9686,-7795,6049},{-9857,-7852,6098},{-10033,-7910,6145},{-10216,-7966,6190},{-10408,-8023,6233},
+    {-10609,-8079,6273},{-10821,-8134,6311},{-11047,-8189,6347},{-11290,-8243,6381},{-11554,-8296,6412},{-11842,-8348,6440},{-12161,-8400,6466},{-12518,-8449,6490},
+    {-12924,-8497,6511},{-13389,-8543,6530},{-13930,-8586,6546},{-14565,-8626,6560},{-15314,-8661,6571},{-16193,-8690,6581},{-17205,-8713,6587},{17670,-8726,6592},
+    {16489,-8731,6594},{15327,-8725,6594},{14253,-8710,6592},{13306,-8688,6588},{12495,-8661,6582},{11808,-8629,6574},{11227,-8594,6564},{10732,-8558,6553},
+    {10307,-8519,6540},{9938,-8480,6525},{9613,-8440,6509},{9324,-8400,6491},{9065,-8360,6473},{8830,-8320,6452},{8615,-8279,6431},{8417,-8239,6409},
+    {8234,-8199,6385},{8064,-8159,6361},{7904,-8120,6335},{7754,-8080,6309},{7612,-8041,6282}
+  },
+  {  // -66
+    {6761,-7990,6269},{6663,-7950,6239},{6568,-7910,6208},{6477,-7870,6176},{6388,-7831,6144},{6303,-7792,6111},{6221,-7753,6078},{6141,-7714,6044},
+    {6064,-7675,6010},{5988,-7637,5975},{5915,-7599,5939},{5844,-7560,5904},{5774,-7522,5867},{5706,-7483,5830},{5639,-7444,5792},{5574,-7405,5754},
+    {5509,-7366,5716},{5445,-7326,5676},{5382,-7286,5636},{5319,-7246,5596},{5257,-7205,5555},{5194,-7164,5513},{5131,-7122,5470},{5068,-7080,5427},
+    {5004,-7037,5383},{4939,-6994,5338},{4873,-6951,5293},{4805,-6907,5247},{4736,-6862,5200},{4666,-6817,5153},{4593,-6772,5105},{4518,-6727,5056},
+    {4442,-6681,5007},{4362,-6635,4958},{4280,-6589,4908},{4196,-6544,4857},{4109,-6498,4807},{4019,-6453,4756},{3926,-6408,4705},{3831,-6364,4654},
+    {3732,-6321,4603},{3631,-6278,4552},{3528,-6237,4501},{3421,-6197,4451},{3312,-6159,4401},{3201,-6122,4352},{3087,-6086,4304},{2971,-6053,4256},
+    {2853,-6021,4209},{2734,-5992,4163},{2613,-5965,4118},{2491,-5940,4074},{2368,-5917,4032},{2244,-5897,3990},{2119,-5879,3950},{1994,-5864,3912},
+    {1869,-5851,3874},{1745,-5840,3838},{1620,-5832,3804},{1497,-5825,3771},{1374,-5821,3739},{1253,-5819,3709},{1133,-5819,3680},{1014,-5820,3652},
+    {897,-5823,3626},{781,-5827,3601},{667,-5832,3578},{555,-5837,3556},{444,-5844,3535},{335,-5851,3515},{227,-5858,3497},{120,-5866,3480},
+    {15,-5873,3464},{-90,-5880,3449},{-194,-5886,3435},{-298,-5893,3422},{-402,-5898,3411},{-506,-5903,3400},{-611,-5907,3391},{-718,-5910,3383},
+    {-825,-5913,3377},{-934,-5915,3372},{-1046,-5916,3368},{-1159,-5916,3366},{-1276,-5916,3365},{-1395,-5916,3366},{-1517,-5915,3369},{-1642,-5914,3373},
+    {-1770,-5913,3380},{-1902,-5912,3388},{-2037,-5911,3399},{-2175,-5911,3411},{-2317,-5912,3426},{-2461,-5914,3444},{-2609,-5916,3464},{-2759,-5920,3486},
+    {-2911,-5926,3511},{-3066,-5933,3539},{-3223,-5942,3569},{-3382,-5953,3602},{-3542,-5966,3638},{-3703,-5981,3676},{-3865,-5998,3717},{-4027,-6018,3761},
+    {-4190,-6040,3807},{-4353,-6065,3855},{-4516,-6092,3906},{-4678,-6121,3960},{-4840,-6153,4016},{-5001,-6187,4073},{-5161,-6224,4133},{-5319,-6262,4195},
+    {-5476,-6303,4258},{-5632,-6346,4323},{-5787,-6391,4390},{-5940,-6438,4458},{-6091,-6486,4527},{-6240,-6536,4597},{-6388,-6587,4667},{-6534,-6640,4739},
+    {-6679,-6694,4811},{-6821,-6749,4883},{-6963,-6806,4956},{-7102,-6863,5028},{-7240,-6921,5101},{-7377,-6980,5173},{-7513,-7039,5245},{-7647,-7099,5316},
+    {-7780,-7159,5387},{-7913,-7220,5456},{-8044,-7281,5525},{-8176,-7342,5592},{-8306,-7404,5659},{-8437,-7465,5724},{-8568,-7527,5787},{-8699,-7589,5849},
+    {-8831,-7650,5909},{-8964,-7712,5967},{-9098,-7773,6023},{-9235,-7835,6077},{-9374,-7896,6129},{-9516,-7957,6179},{-9662,-8017,6226},{-9814,-8077,6271},
+    {-9972,-8137,6313},{-10137,-8197,6353},{-10313,-8256,6391},{-10501,-8315,6425},{-10706,-8373,6457},{-10931,-8430,6487},{-11184,-8487,6513},{-11475,-8543,6537},
+    {-11818,-8597,6558},{-12236,-8650,6577},{-12763,-8701,6593},{-13459,-8750,6606},{-14419,-8793,6616},{-15779,-8830,6624},{-17655,-8853,6630},{16106,-8859,6632},
+    {14016,-8845,6633},{12424,-8816,6631},{11301,-8779,6627},{10501,-8737,6621},{9910,-8693,6613},{9453,-8647,6602},{9086,-8601,6590},{8783,-8555,6576},
+    {8524,-8509,6560},{8298,-8464,6543},{8098,-8418,6524},{7917,-8373,6503},{7752,-8329,6482},{7600,-8285,6459},{7459,-8241,6435},{7327,-8198,6409},
+    {7202,-8156,6383},{7084,-8113,6356},{6971,-8072,6328},{6864,-8031,6299},{6761,-7990,6269}
+  },
+  {  // -64
+    {6019,-7919,6244},{5951,-7878,6212},{5883,-7838,6178},{5817,-7798,6144},{5753,-7758,6110},{5690,-7718,6075},{5628,-7679,6040},{5568,-7640,6004},
+    {5509,-7601,5967},{5452,-7563,5931},{5396,-7524,5893},{5341,-7486,5856},{5287,-7447,5818},{5234,-7408,5779},{5182,-7369,5740},{5131,-7330,5700},
+    {5081,-7291,5660},{5031,-7251,5619},{4982,-7211,5578},{4933,-7170,5536},{4884,-7129,5493},{4834,-7088,5449},{4785,-7046,5405},{4734,-7003,5360},
+    {4683,-6960,5315},{4631,-6916,5268},{4578,-6871,5221},{4523,-6826,5173},{4466,-6780,5125},{4407,-6734,5075},{4346,-6687,5025},{4282,-6640,4974},
+    {4216,-6592,4923},{4147,-6544,4871},{4075,-6496,4818},{3999,-6448,4765},{3921,-6400,4712},{3839,-6352,4658},{3754,-6305,4605},{3665,-6258,4551},
+    {3573,-6212,4497},{3478,-6167,4443},{3379,-6123,4390},{3277,-6080,4337},{3172,-6039,4284},{3064,-6000,4233},{2953,-5963,4181},{2839,-5927,4131},
+    {2723,-5894,4082},{2604,-5864,4034},{2484,-5836,3987},{2362,-5811,3941},{2239,-5788,3897},{2115,-5768,3854},{1990,-5751,3812},{1864,-5737,3772},
+    {1739,-5726,3733},{1613,-5718,3697},{1489,-5712,3661},{1365,-5709,3628},{1242,-5709,3596},{1121,-5710,3565},{1001,-5714,3536},{884,-5720,3508},
+    {768,-5727,3482},{654,-5736,3458},{543,-5746,3435},{433,-5757,3413},{326,-5768,3392},{221,-5780,3373},{118,-5792,3355},{17,-5804,3338},
+    {-82,-5816,3322},{-181,-5827,3307},{-278,-5838,3293},{-375,-5847,3280},{-471,-5856,3269},{-568,-5864,3258},{-665,-5871,3249},{-764,-5876,3241},
+    {-863,-5880,3234},{-965,-5883,3228},{-1069,-5885,3224},{-1176,-5886,3221},{-1285,-5886,3220},{-1398,-5885,3220},{-1514,-5884,3222},{-1634,-5882,3226},
+    {-1758,-5879,3232},{-1886,-5877,3240},{-2017,-5875,3250},{-2152,-5873,3262},{-2292,-5871,3277},{-2434,-5871,3295},{-2580,-5871,3315},{-2729,-5873,3338},
+    {-2881,-5877,3364},{-3036,-5882,3393},{-3192,-5889,3424},{-3351,-5898,3459},{-3511,-5910,3496},{-3672,-5924,3536},{-3834,-5941,3580},{-3996,-5960,3626},
+    {-4158,-5982,3675},{-4320,-6006,3727},{-4482,-6034,3782},{-4643,-6064,3839},{-4802,-6097,3899},{-4960,-6132,3961},{-5117,-6170,4025},{-5272,-6211,4091},
+    {-5425,-6254,4160},{-5576,-6299,4230},{-5725,-6347,4301},{-5872,-6396,4374},{-6017,-6448,4448},{-6159,-6501,4523},{-6299,-6555,4599},{-6436,-6611,4676},
+    {-6571,-6669,4753},{-6704,-6727,4831},{-6834,-6787,4909},{-6962,-6848,4986},{-7088,-6909,5064},{-7211,-6971,5141},{-7332,-7034,5218},{-7451,-7097,5294},
+    {-7568,-7160,5369},{-7683,-7224,5443},{-7796,-7288,5516},{-7907,-7353,5588},{-8016,-7417,5658},{-8124,-7482,5727},{-8230,-7546,5794},{-8335,-7611,5859},
+    {-8439,-7675,5922},{-8541,-7740,5983},{-8642,-7804,6043},{-8743,-7868,6099},{-8842,-7932,6154},{-8941,-7996,6206},{-9039,-8059,6255},{-9137,-8122,6302},
+    {-9234,-8185,6346},{-9332,-8247,6388},{-9430,-8309,6426},{-9529,-8371,6462},{-9630,-8432,6494},{-9732,-8493,6524},{-9838,-8553,6551},{-9949,-8613,6575},
+    {-10068,-8673,6596},{-10201,-8732,6614},{-10360,-8790,6629},{-10572,-8848,6641},{-10936,-8905,6650},{-12088,-8960,6657},{11016,-8978,6661},{8505,-8925,6662},
+    {8023,-8871,6661},{7779,-8817,6657},{7610,-8763,6650},{7475,-8711,6642},{7357,-8659,6631},{7250,-8607,6618},{7149,-8556,6603},{7054,-8507,6587},
+    {6963,-8457,6568},{6874,-8409,6548},{6788,-8361,6526},{6704,-8314,6503},{6622,-8267,6478},{6541,-8222,6453},{6462,-8177,6426},{6385,-8132,6398},
+    {6309,-8089,6369},{6234,-8045,6339},{6161,-8003,6308},{6090,-7961,6277},{6019,-7919,6244}
+  },
+  {  // -62
+    {5388,-7834,6208},{5342,-7793,6173},{5296,-7752,6138},{5250,-7712,6101},{5203,-7672,6065},{5157,-7632,6028},{5112,-7593,5991},{5067,-7554,5953},
+    {5023,-7515,5915},{4979,-7477,5876},{4936,-7438,5838},{4894,-7400,5798},{4853,-7362,5759},{4812,-7323,5719},{4772,-7284,5678},{4733,-7245,5637},
+    {4694,-7206,5596},{4656,-7167,5554},{4618,-7127,5511},{4580,-7086,5468},{4542,-7045,5424},{4504,-7004,5379},{4466,-6962,5333},{4427,-6919,5287},
+    {4387,-6875,5240},{4346,-6831,5192},{4304,-6785,5143},{4260,-6739,5094},{4214,-6693,5044},{4166,-6645,4992},{4115,-6597,4940},{4062,-6548,4888},
+    {4006,-6499,4834},{3946,-6449,4780},{3883,-6399,4725},{3817,-6349,4670},{3747,-6298,4614},{3673,-6248,4558},{3595,-6198,4502},{3512,-6149,4445},
+    {3426,-6100,4389},{3336,-6052,4333},{3242,-6006,4277},{3144,-5961,4221},{3042,-5917,4166},{2937,-5876,4112},{2828,-5836,4058},{2716,-5799,4006},
+    {2600,-5765,3954},{2482,-5733,3904},{2362,-5705,3855},{2240,-5679,3808},{2116,-5657,3762},{1990,-5638,3718},{1864,-5622,3675},{1737,-5610,3634},
+    {1610,-5601,3595},{1483,-5595,3557},{1357,-5593,3522},{1232,-5593,3488},{1108,-5597,3456},{986,-5603,3425},{866,-5612,3397},{748,-5622,3369},
+    {633,-5635,3344},{521,-5649,3320},{411,-5665,3297},{304,-5682,3276},{200,-5699,3256},{99,-5716,3237},{0,-5734,3220},{-96,-5751,3203},
+    {-190,-5768,3188},{-282,-5785,3174},{-372,-5800,3160},{-462,-5814,3148},{-551,-5826,3136},{-640,-5838,3126},{-729,-5847,3116},{-819,-5855,3108},
+    {-911,-5862,3101},{-1005,-5866,3094},{-1101,-5869,3090},{-1200,-5871,3086},{-1302,-5871,3084},{-1409,-5870,3084},{-1519,-5868,3085},{-1633,-5865,3088},
+    {-1752,-5862,3093},{-1876,-5857,3101},{-2004,-5853,3110},{-2136,-5849,3122},{-2273,-5846,3137},{-2414,-5843,3154},{-2558,-5841,3175},{-2706,-5840,3198},
+    {-2858,-5841,3224},{-3012,-5844,3254},{-3169,-5849,3286},{-3327,-5856,3322},{-3487,-5866,3361},{-3649,-5878,3404},{-3810,-5894,3449},{-3972,-5912,3498},
+    {-4134,-5933,3550},{-4295,-5958,3605},{-4456,-5985,3663},{-4614,-6016,3724},{-4772,-6049,3787},{-4927,-6086,3854},{-5081,-6125,3922},{-5232,-6168,3993},
+    {-5381,-6212,4066},{-5527,-6260,4140},{-5670,-6310,4217},{-5810,-6362,4295},{-5947,-6416,4374},{-6082,-6471,4454},{-6213,-6529,4535},{-6341,-6588,4617},
+    {-6466,-6648,4699},{-6588,-6710,4781},{-6706,-6773,4864},{-6821,-6836,4946},{-6933,-6900,5028},{-7042,-6965,5110},{-7148,-7031,5191},{-7250,-7097,5271},
+    {-7349,-7163,5351},{-7445,-7230,5429},{-7538,-7296,5506},{-7627,-7363,5581},{-7713,-7430,5655},{-7796,-7497,5727},{-7875,-7563,5797},{-7950,-7630,5866},
+    {-8021,-7696,5932},{-8088,-7763,5996},{-8151,-7828,6057},{-8209,-7894,6116},{-8262,-7960,6173},{-8308,-8025,6227},{-8348,-8089,6278},{-8379,-8153,6326},
+    {-8401,-8217,6372},{-8411,-8281,6414},{-8406,-8343,6453},{-8382,-8406,6490},{-8333,-8467,6523},{-8251,-8528,6553},{-8122,-8587,6579},{-7924,-8646,6603},
+    {-7620,-8703,6623},{-7144,-8757,6641},{-6370,-8807,6655},{-5069,-8850,6666},{-2952,-8878,6674},{-238,-8882,6679},{2039,-8859,6681},{3474,-8821,6680},
+    {4326,-8775,6677},{4848,-8727,6671},{5181,-8676,6662},{5398,-8625,6651},{5543,-8575,6638},{5638,-8524,6623},{5698,-8474,6605},{5733,-8424,6586},
+    {5750,-8375,6564},{5752,-8326,6541},{5743,-8278,6517},{5726,-8231,6491},{5702,-8184,6463},{5673,-8138,6435},{5640,-8093,6405},{5603,-8048,6374},
+    {5563,-8004,6343},{5521,-7961,6310},{5478,-7918,6277},{5433,-7875,6243},{5388,-7834,6208}
+  },
+  {  // -60
+    {4856,-7737,6162},{4827,-7696,6125},{4796,-7655,6087},{4765,-7615,6049},{4732,-7576,6011},{4699,-7536,5972},{4666,-7497,5933},{4632,-7458,5893},
+    {4599,-7420,5854},{4566,-7381,5814},{4533,-7343,5773},{4500,-7305,5733},{4469,-7267,5692},{4437,-7229,5651},{4406,-7190,5609},{4376,-7152,5567},
+    {4346,-7113,5524},{4317,-7074,5481},{4288,-7034,5437},{4260,-6994,5393},{4231,-6953,5348},{4202,-6912,5302},{4174,-6870,5255},{4144,-6827,5208},
+    {4114,-6784,5160},{4083,-6739,5111},{4050,-6694,5061},{4016,-6647,5010},{3980,-6600,4958},{3941,-6552,4905},{3900,-6503,4852},{3857,-6453,4797},
+    {3809,-6402,4742},{3759,-6351,4686},{3705,-6299,4629},{3647,-6247,4572},{3584,-6195,4514},{3517,-6142,4456},{3446,-6090,4397},{3370,-6038,4339},
+    {3290,-5986,4280},{3205,-5936,4221},{3115,-5887,4163},{3021,-5839,4105},{2922,-5794,4048},{2819,-5750,3991},{2711,-5709,3936},{2600,-5670,3881},
+    {2485,-5634,3828},{2367,-5601,3776},{2246,-5572,3725},{2123,-5546,3676},{1997,-5524,3629},{1870,-5506,3584},{1741,-5492,3540},{1612,-5482,3499},
+    {1483,-5475,3459},{1353,-5473,3421},{1225,-5474,3386},{1097,-5478,3352},{972,-5486,3320},{848,-5498,3290},{727,-5512,3262},{608,-5528,3236},
+    {493,-5547,3211},{381,-5567,3188},{272,-5589,3167},{167,-5612,3147},{66,-5636,3128},{-32,-5660,3110},{-127,-5684,3093},{-218,-5707,3078},
+    {-307,-5730,3063},{-393,-5752,3050},{-477,-5772,3037},{-559,-5791,3025},{-640,-5808,3014},{-721,-5823,3003},{-802,-5836,2994},{-884,-5847,2985},
+    {-968,-5856,2978},{-1053,-5863,2971},{-1141,-5868,2966},{-1233,-5871,2962},{-1328,-5871,2959},{-1427,-5871,2958},{-1531,-5868,2958},{-1640,-5864,2960},
+    {-1753,-5860,2965},{-1872,-5854,2971},{-1997,-5848,2980},{-2126,-5842,2992},{-2260,-5836,3006},{-2399,-5830,3023},{-2542,-5826,3043},{-2690,-5822,3066},
+    {-2841,-5820,3093},{-2995,-5820,3123},{-3151,-5823,3156},{-3310,-5827,3193},{-3470,-5835,3234},{-3632,-5845,3278},{-3793,-5859,3326},{-3955,-5875,3377},
+    {-4116,-5896,3431},{-4276,-5919,3489},{-4435,-5946,3551},{-4592,-5977,3615},{-4747,-6011,3682},{-4899,-6048,3752},{-5049,-6088,3825},{-5196,-6132,3900},
+    {-5339,-6178,3977},{-5480,-6227,4056},{-5616,-6279,4137},{-5750,-6333,4220},{-5879,-6390,4303},{-6005,-6448,4388},{-6127,-6508,4474},{-6245,-6570,4560},
+    {-6359,-6633,4647},{-6469,-6697,4734},{-6575,-6762,4821},{-6677,-6828,4908},{-6775,-6895,4994},{-6868,-6962,5080},{-6957,-7030,5165},{-7042,-7098,5249},
+    {-7122,-7167,5332},{-7197,-7235,5414},{-7268,-7304,5494},{-7334,-7372,5573},{-7394,-7440,5650},{-7449,-7509,5725},{-7499,-7577,5798},{-7542,-7644,5869},
+    {-7578,-7712,5937},{-7607,-7779,6003},{-7627,-7845,6067},{-7638,-7911,6128},{-7639,-7977,6186},{-7627,-8041,6242},{-7601,-8106,6294},{-7558,-8169,6343},
+    {-7494,-8232,6390},{-7405,-8293,6433},{-7284,-8354,6472},{-7124,-8413,6509},{-6912,-8470,6542},{-6634,-8526,6572},{-6267,-8578,6598},{-5783,-8627,6621},
+    {-5146,-8672,6641},{-4316,-8709,6657},{-3271,-8736,6670},{-2040,-8752,6680},{-732,-8753,6686},{503,-8741,6690},{1553,-8717,6690},{2389,-8684,6688},
+    {3032,-8646,6682},{3520,-8603,6674},{3891,-8558,6663},{4174,-8512,6649},{4390,-8464,6634},{4555,-8416,6616},{4682,-8368,6596},{4777,-8320,6573},
+    {4848,-8272,6549},{4900,-8225,6524},{4936,-8178,6496},{4960,-8131,6468},{4972,-8085,6437},{4976,-8040,6406},{4973,-7995,6374},{4963,-7950,6340},
+    {4949,-7907,6306},{4930,-7863,6271},{4908,-7821,6236},{4883,-7779,6199},{4856,-7737,6162}
+  },
+  {  // -58
+    {4408,-7632,6108},{4391,-7591,6068},{4372,-7551,6029},{4351,-7511,5988},{4329,-7471,5948},{4305,-7432,5908},{4281,-7393,5867},{4256,-7355,5826},
+    {4231,-7316,5785},{4205,-7278,5743},{4180,-7240,5702},{4155,-7202,5660},{4130,-7164,5618},{4105,-7127,5575},{4082,-7089,5533},{4058,-7050,5489},
+    {4035,-7012,5446},{4013,-6973,5402},{3991,-6934,5357},{3969,-6895,5312},{3948,-6854,5266},{3926,-6813,5219},{3905,-6772,5172},{3883,-6729,5124},
+    {3861,-6686,5075},{3838,-6642,5025},{3814,-6597,4974},{3788,-6550,4922},{3761,-6503,4869},{3731,-6454,4815},{3699,-6404,4760},{3663,-6354,4705},
+    {3625,-6302,4648},{3583,-6250,4590},{3537,-6196,4532},{3486,-6142,4473},{3431,-6088,4413},{3371,-6034,4353},{3307,-5979,4293},{3237,-5925,4232},
+    {3162,-5871,4171},{3082,-5818,4110},{2996,-5767,4050},{2905,-5717,3990},{2809,-5668,3930},{2708,-5622,3872},{2602,-5579,3814},{2491,-5539,3758},
+    {2377,-5501,3703},{2258,-5468,3649},{2136,-5438,3598},{2011,-5412,3547},{1883,-5391,3499},{1753,-5373,3453},{1621,-5361,3409},{1489,-5353,3367},
+    {1356,-5349,3327},{1224,-5350,3290},{1092,-5355,3254},{961,-5364,3221},{833,-5377,3190},{707,-5394,3161},{583,-5414,3134},{463,-5437,3109},
+    {347,-5462,3085},{235,-5489,3064},{127,-5518,3044},{23,-5548,3025},{-77,-5579,3007},{-172,-5610,2991},{-263,-5641,2976},{-350,-5671,2961},
+    {-433,-5700,2948},{-514,-5728,2935},{-591,-5754,2923},{-666,-5778,2912},{-740,-5800,2901},{-813,-5820,2891},{-886,-5837,2882},{-959,-5852,2873},
+    {-1034,-5864,2866},{-1111,-5874,2859},{-1191,-5880,2853},{-1274,-5885,2848},{-1361,-5886,2845},{-1453,-5886,2843},{-1551,-5884,2842},{-1653,-5879,2844},
+    {-1762,-5874,2847},{-1876,-5867,2853},{-1996,-5859,2861},{-2122,-5851,2871},{-2253,-5842,2885},{-2390,-5834,2901},{-2532,-5826,2921},{-2678,-5820,2944},
+    {-2829,-5815,2971},{-2983,-5812,3001},{-3139,-5811,3035},{-3298,-5813,3073},{-3458,-5817,3115},{-3619,-5825,3160},{-3780,-5836,3210},{-3941,-5851,3263},
+    {-4102,-5869,3320},{-4260,-5892,3381},{-4417,-5918,3445},{-4572,-5948,3513},{-4724,-5981,3584},{-4873,-6019,3657},{-5018,-6060,3734},{-5160,-6104,3813},
+    {-5298,-6152,3894},{-5433,-6202,3978},{-5563,-6256,4063},{-5688,-6312,4150},{-5810,-6370,4238},{-5926,-6430,4327},{-6039,-6492,4417},{-6146,-6556,4508},
+    {-6249,-6621,4599},{-6346,-6688,4690},{-6439,-6755,4781},{-6526,-6823,4872},{-6609,-6892,4962},{-6686,-6961,5051},{-6757,-7031,5140},{-6823,-7100,5227},
+    {-6883,-7170,5314},{-6937,-7240,5398},{-6984,-7310,5481},{-7025,-7379,5563},{-7059,-7448,5642},{-7085,-7517,5720},{-7102,-7585,5795},{-7111,-7653,5868},
+    {-7110,-7720,5938},{-7098,-7786,6006},{-7074,-7852,6071},{-7036,-7917,6134},{-6983,-7981,6193},{-6911,-8044,6249},{-6818,-8106,6303},{-6701,-8166,6353},
+    {-6554,-8225,6399},{-6371,-8283,6443},{-6147,-8338,6483},{-5871,-8390,6519},{-5534,-8440,6552},{-5125,-8486,6581},{-4631,-8527,6607},{-4042,-8562,6629},
+    {-3357,-8591,6648},{-2583,-8611,6663},{-1748,-8622,6675},{-893,-8623,6683},{-65,-8615,6688},{696,-8598,6690},{1367,-8573,6688},{1941,-8542,6684},
+    {2422,-8507,6676},{2821,-8469,6666},{3149,-8428,6653},{3418,-8385,6637},{3638,-8340,6619},{3817,-8295,6598},{3963,-8250,6575},{4081,-8204,6551},
+    {4177,-8158,6524},{4253,-8112,6496},{4312,-8066,6466},{4358,-8021,6434},{4392,-7976,6402},{4417,-7931,6368},{4433,-7887,6333},{4441,-7843,6297},
+    {4444,-7800,6261},{4441,-7757,6223},{4434,-7715,6185},{4423,-7673,6147},{4408,-7632,6108}
+  },
+  {  // -56
+    {4029,-7521,6046},{4021,-7480,6004},{4010,-7440,5963},{3997,-7400,5921},{3982,-7361,5879},{3966,-7322,5837},{3948,-7283,5794},{3930,-7245,5752},
+    {3911,-7206,5709},{3891,-7168,5667},{3871,-7130,5624},{3851,-7093,5581},{3831,-7055,5538},{3812,-7017,5494},{3793,-6980,5451},{3774,-6942,5407},
+    {3756,-6904,5362},{3739,-6866,5317},{3722,-6827,5272},{3706,-6788,5226},{3690,-6748,5180},{3674,-6708,5132},{3658,-6667,5084},{3643,-6625,5036},
+    {3627,-6582,4986},{3611,-6538,4935},{3594,-6493,4884},{3575,-6447,4831},{3555,-6400,4777},{3533,-6351,4722},{3508,-6302,4667},{3481,-6250,4610},
+    {3450,-6198,4552},{3415,-6145,4493},{3377,-6090,4433},{3334,-6035,4373},{3286,-5979,4312},{3233,-5923,4250},{3174,-5866,4188},{3110,-5810,4125},
+    {3041,-5754,4063},{2965,-5699,4000},{2883,-5645,3938},{2795,-5592,3876},{2702,-5542,3815},{2603,-5494,3755},{2498,-5448,3695},{2388,-5406,3637},
+    {2273,-5368,3581},{2153,-5333,3526},{2029,-5303,3473},{1902,-5277,3422},{1771,-5256,3373},{1638,-5240,3326},{1503,-5229,3282},{1367,-5224,3240},
+    {1231,-5223,3200},{1094,-5228,3163},{958,-5237,3128},{824,-5251,3096},{692,-5270,3066},{562,-5293,3038},{436,-5319,3012},{314,-5349,2989},
+    {196,-5381,2967},{83,-5416,2947},{-25,-5452,2928},{-129,-5490,2911},{-227,-5528,2895},{-320,-5566,2881},{-408,-5604,2867},{-491,-5642,2854},
+    {-569,-5678,2842},{-644,-5712,2830},{-715,-5745,2819},{-784,-5775,2809},{-850,-5802,2799},{-915,-5827,2790},{-980,-5849,2781},{-1045,-5868,2772},
+    {-1111,-5884,2764},{-1179,-5896,2757},{-1250,-5906,2751},{-1325,-5912,2746},{-1404,-5916,2742},{-1488,-5916,2739},{-1578,-5914,2738},{-1674,-5910,2738},
+    {-1777,-5904,2740},{-1886,-5896,2745},{-2001,-5886,2752},{-2124,-5876,2762},{-2252,-5865,2774},{-2387,-5854,2790},{-2527,-5844,2809},{-2672,-5834,2832},
+    {-2821,-5826,2859},{-2974,-5819,2889},{-3130,-5815,2923},{-3289,-5813,2962},{-3449,-5814,3005},{-3609,-5819,3052},{-3770,-5827,3103},{-3930,-5839,3158},
+    {-4089,-5855,3217},{-4246,-5876,3281},{-4401,-5900,3348},{-4552,-5929,3418},{-4701,-5962,3492},{-4846,-5999,3569},{-4986,-6040,3650},{-5123,-6084,3732},
+    {-5255,-6133,3818},{-5383,-6184,3905},{-5505,-6239,3995},{-5623,-6296,4086},{-5735,-6356,4178},{-5842,-6417,4271},{-5944,-6481,4365},{-6040,-6547,4460},
+    {-6130,-6614,4555},{-6215,-6682,4649},{-6294,-6751,4744},{-6366,-6820,4838},{-6432,-6890,4932},{-6492,-6961,5024},{-6545,-7032,5116},{-6592,-7102,5206},
+    {-6631,-7173,5295},{-6662,-7243,5382},{-6685,-7313,5468},{-6700,-7383,5551},{-6706,-7452,5633},{-6702,-7520,5712},{-6687,-7588,5789},{-6661,-7654,5863},
+    {-6622,-7720,5935},{-6569,-7785,6004},{-6501,-7848,6070},{-6415,-7911,6134},{-6310,-7972,6194},{-6182,-8031,6251},{-6029,-8088,6304},{-5847,-8144,6354},
+    {-5631,-8197,6401},{-5378,-8248,6445},{-5082,-8295,6484},{-4738,-8339,6520},{-4342,-8379,6553},{-3890,-8414,6581},{-3384,-8443,6606},{-2827,-8466,6628},
+    {-2228,-8482,6645},{-1604,-8490,6659},{-973,-8491,6669},{-356,-8485,6676},{229,-8472,6679},{769,-8452,6679},{1256,-8428,6676},{1687,-8398,6669},
+    {2064,-8365,6660},{2390,-8329,6647},{2671,-8291,6632},{2911,-8251,6614},{3116,-8209,6593},{3290,-8167,6570},{3437,-8124,6545},{3560,-8080,6518},
+    {3664,-8036,6489},{3750,-7992,6458},{3821,-7947,6426},{3879,-7903,6392},{3926,-7859,6357},{3963,-7816,6321},{3990,-7773,6284},{4011,-7730,6246},
+    {4025,-7687,6207},{4033,-7645,6167},{4036,-7603,6127},{4034,-7562,6087},{4029,-7521,6046}
+  },
+  {  // -54
+    {3706,-7404,5977},{3704,-7364,5934},{3700,-7324,5891},{3693,-7284,5847},{3683,-7245,5804},{3672,-7206,5760},{3660,-7167,5717},{3646,-7129,5673},
+    {3631,-7090,5629},{3616,-7052,5585},{3600,-7015,5541},{3584,-6977,5497},{3568,-6939,5453},{3552,-6902,5409},{3536,-6864,5364},{3521,-6827,5319},
+    {3506,-6789,5274},{3492,-6751,5229},{3479,-6713,5183},{3466,-6675,5136},{3454,-6635,5089},{3443,-6596,5042},{3432,-6555,4993},{3421,-6514,4944},
+    {3410,-6472,4894},{3399,-6429,4843},{3387,-6384,4791},{3375,-6339,4737},{3361,-6292,4683},{3345,-6244,4628},{3327,-6194,4571},{3307,-6143,4514},
+    {3283,-6090,4455},{3256,-6036,4396},{3224,-5981,4335},{3188,-5925,4273},{3146,-5867,4211},{3100,-5810,4148},{3047,-5751,4084},{2989,-5693,4020},
+    {2924,-5635,3956},{2853,-5578,3892},{2775,-5522,3828},{2690,-5467,3765},{2599,-5414,3702},{2501,-5364,3640},{2398,-5317,3580},{2288,-5273,3520},
+    {2172,-5233,3463},{2051,-5197,3407},{1925,-5167,3353},{1796,-5141,3301},{1662,-5121,3252},{1525,-5106,3205},{1386,-5097,3160},{1246,-5094,3118},
+    {1105,-5097,3079},{964,-5106,3043},{823,-5120,3009},{685,-5140,2977},{548,-5164,2949},{415,-5193,2922},{286,-5227,2898},{161,-5263,2876},
+    {41,-5303,2856},{-74,-5346,2838},{-183,-5390,2822},{-286,-5435,2806},{-383,-5482,2792},{-474,-5528,2780},{-560,-5574,2768},{-639,-5619,2756},
+    {-714,-5662,2746},{-783,-5703,2736},{-849,-5743,2726},{-911,-5779,2717},{-970,-5813,2708},{-1027,-5843,2699},{-1084,-5870,2691},{-1140,-5894,2682},
+    {-1198,-5914,2675},{-1257,-5930,2668},{-1319,-5943,2661},{-1385,-5952,2655},{-1456,-5958,2650},{-1532,-5960,2647},{-1615,-5959,2645},{-1704,-5955,2644},
+    {-1800,-5949,2646},{-1903,-5940,2649},{-2013,-5930,2655},{-2131,-5918,2664},{-2256,-5905,2675},{-2388,-5892,2690},{-2525,-5878,2709},{-2669,-5865,2731},
+    {-2817,-5853,2757},{-2969,-5843,2787},{-3124,-5834,2822},{-3282,-5828,2861},{-3441,-5826,2904},{-3600,-5827,2952},{-3760,-5831,3005},{-3919,-5840,3062},
+    {-4075,-5853,3123},{-4230,-5871,3188},{-4382,-5893,3258},{-4530,-5920,3331},{-4675,-5952,3408},{-4815,-5988,3489},{-4950,-6028,3572},{-5081,-6073,3659},
+    {-5206,-6121,3748},{-5327,-6173,3839},{-5441,-6228,3932},{-5550,-6286,4027},{-5653,-6346,4123},{-5750,-6409,4220},{-5840,-6474,4317},{-5924,-6541,4415},
+    {-6002,-6609,4514},{-6073,-6678,4612},{-6137,-6748,4710},{-6194,-6819,4807},{-6244,-6890,4903},{-6286,-6961,4999},{-6320,-7032,5093},{-6346,-7103,5185},
+    {-6363,-7174,5276},{-6371,-7244,5365},{-6370,-7314,5453},{-6358,-7383,5538},{-6336,-7450,5621},{-6302,-7517,5701},{-6255,-7583,5779},{-6194,-7648,5855},
+    {-6119,-7711,5927},{-6027,-7772,5997},{-5918,-7832,6064},{-5789,-7891,6127},{-5638,-7947,6188},{-5464,-8001,6245},{-5263,-8053,6298},{-5033,-8102,6348},
+    {-4773,-8148,6395},{-4479,-8190,6438},{-4149,-8229,6477},{-3784,-8263,6512},{-3384,-8293,6544},{-2951,-8317,6572},{-2489,-8336,6596},{-2007,-8349,6616},
+    {-1513,-8356,6632},{-1016,-8357,6644},{-529,-8352,6653},{-60,-8342,6658},{384,-8326,6660},{795,-8305,6658},{1173,-8280,6653},{1514,-8252,6644},
+    {1820,-8221,6633},{2093,-8187,6618},{2334,-8151,6601},{2546,-8113,6580},{2732,-8074,6558},{2894,-8033,6533},{3035,-7992,6505},{3157,-7950,6476},
+    {3261,-7908,6445},{3351,-7866,6412},{3427,-7823,6377},{3491,-7780,6341},{3544,-7738,6304},{3588,-7695,6266},{3623,-7653,6227},{3651,-7610,6187},
+    {3673,-7568,6146},{3688,-7527,6104},{3698,-7486,6062},{3704,-7445,6020},{3706,-7404,5977}
+  },
+  {  // -52
+    {3427,-7283,5903},{3430,-7243,5859},{3430,-7203,5814},{3427,-7163,5769},{3422,-7124,5724},{3415,-7085,5679},{3407,-7046,5634},{3397,-7008,5589},
+    {3385,-6969,5544},{3373,-6931,5499},{3360,-6893,5454},{3347,-6856,5409},{3334,-6818,5364},{3320,-6780,5319},{3307,-6743,5274},{3294,-6705,5228},
+    {3282,-6668,5182},{3270,-6630,5136},{3259,-6592,5090},{3249,-6554,5043},{3239,-6516,4996},{3231,-6477,4948},{3223,-6437,4899},{3215,-6396,4850},
+    {3208,-6355,4799},{3201,-6313,4748},{3194,-6269,4696},{3186,-6224,4642},{3177,-6178,4588},{3167,-6130,4532},{3155,-6081,4475},{3140,-6030,4417},
+    {3123,-5977,4358},{3101,-5923,4298},{3076,-5867,4237},{3046,-5811,4174},{3011,-5752,4111},{2970,-5693,4047},{2924,-5634,3982},{2870,-5574,3917},
+    {2810,-5514,3852},{2743,-5455,3787},{2669,-5396,3722},{2588,-5340,3657},{2499,-5285,3593},{2403,-5232,3530},{2300,-5183,3468},{2190,-5138,3408},
+    {2074,-5097,3349},{1951,-5061,3292},{1823,-5029,3238},{1691,-5004,3186},{1554,-4985,3136},{1413,-4971,3089},{1270,-4965,3045},{1125,-4965,3003},
+    {979,-4971,2965},{832,-4984,2929},{687,-5004,2896},{544,-5029,2866},{403,-5060,2839},{265,-5096,2814},{132,-5136,2792},{4,-5181,2772},
+    {-119,-5228,2754},{-235,-5279,2738},{-345,-5331,2724},{-449,-5385,2711},{-546,-5439,2699},{-635,-5494,2688},{-718,-5548,2678},{-795,-5600,2669},
+    {-866,-5651,2660},{-931,-5700,2652},{-991,-5747,2643},{-1046,-5790,2635},{-1099,-5830,2627},{-1149,-5866,2619},{-1197,-5899,2611},{-1246,-5928,2604},
+    {-1294,-5953,2596},{-1345,-5973,2589},{-1399,-5990,2583},{-1456,-6003,2577},{-1518,-6011,2571},{-1586,-6016,2567},{-1660,-6017,2564},{-1741,-6014,2563},
+    {-1830,-6009,2563},{-1927,-6000,2566},{-2032,-5989,2570},{-2145,-5976,2578},{-2265,-5961,2589},{-2393,-5945,2603},{-2527,-5929,2620},{-2668,-5913,2641},
+    {-2814,-5897,2667},{-2964,-5882,2697},{-3118,-5870,2731},{-3274,-5860,2770},{-3432,-5853,2814},{-3590,-5849,2863},{-3747,-5849,2916},{-3904,-5854,2974},
+    {-4058,-5864,3037},{-4210,-5878,3105},{-4358,-5897,3176},{-4502,-5922,3252},{-4642,-5951,3332},{-4777,-5985,3415},{-4907,-6024,3502},{-5031,-6068,3592},
+    {-5149,-6115,3684},{-5261,-6167,3778},{-5367,-6222,3875},{-5467,-6280,3973},{-5559,-6341,4073},{-5645,-6405,4173},{-5724,-6470,4274},{-5796,-6537,4375},
+    {-5861,-6606,4477},{-5917,-6676,4578},{-5966,-6746,4678},{-6007,-6817,4778},{-6040,-6889,4877},{-6064,-6960,4974},{-6079,-7031,5070},{-6084,-7102,5165},
+    {-6079,-7172,5257},{-6064,-7241,5348},{-6038,-7309,5437},{-6000,-7376,5523},{-5950,-7442,5607},{-5887,-7507,5688},{-5809,-7570,5767},{-5717,-7631,5842},
+    {-5608,-7691,5915},{-5482,-7748,5985},{-5337,-7803,6052},{-5173,-7856,6115},{-4987,-7907,6175},{-4778,-7954,6232},{-4546,-7999,6285},{-4289,-8040,6335},
+    {-4007,-8078,6380},{-3700,-8112,6422},{-3369,-8142,6461},{-3015,-8167,6495},{-2641,-8188,6525},{-2252,-8204,6552},{-1851,-8215,6575},{-1445,-8220,6593},
+    {-1039,-8221,6608},{-639,-8217,6619},{-252,-8208,6627},{119,-8194,6630},{471,-8177,6630},{799,-8155,6627},{1104,-8131,6620},{1384,-8103,6609},
+    {1640,-8073,6596},{1871,-8041,6579},{2080,-8007,6560},{2268,-7971,6538},{2436,-7934,6513},{2585,-7896,6486},{2717,-7857,6457},{2834,-7817,6426},
+    {2936,-7776,6392},{3025,-7735,6358},{3102,-7694,6321},{3169,-7653,6283},{3225,-7611,6244},{3273,-7570,6204},{3313,-7528,6163},{3346,-7487,6121},
+    {3373,-7446,6079},{3393,-7405,6035},{3409,-7364,5992},{3420,-7323,5948},{3427,-7283,5903}
+  },
+  {  // -50
+    {3183,-7157,5825},{3190,-7117,5779},{3193,-7077,5733},{3194,-7038,5687},{3193,-6998,5641},{3189,-6959,5594},{3183,-6920,5548},{3176,-6882,5502},
+    {3168,-6843,5456},{3158,-6805,5410},{3147,-6766,5364},{3136,-6728,5318},{3125,-6690,5272},{3113,-6653,5226},{3102,-6615,5180},{3090,-6578,5134},
+    {3079,-6540,5088},{3069,-6502,5041},{3060,-6465,4995},{3051,-6427,4947},{3043,-6389,4900},{3036,-6350,4852},{3030,-6311,4803},{3024,-6272,4753},
+    {3020,-6231,4703},{3015,-6189,4652},{3011,-6147,4599},{3007,-6103,4546},{3002,-6057,4492},{2997,-6010,4436},{2989,-5962,4379},{2980,-5911,4321},
+    {2967,-5859,4262},{2952,-5805,4201},{2932,-5749,4139},{2908,-5692,4077},{2879,-5633,4013},{2844,-5573,3948},{2802,-5513,3883},{2754,-5451,3817},
+    {2699,-5390,3751},{2636,-5329,3685},{2565,-5269,3619},{2486,-5210,3553},{2400,-5153,3488},{2305,-5099,3424},{2203,-5048,3362},{2093,-5001,3300},
+    {1976,-4959,3241},{1852,-4922,3184},{1722,-4891,3129},{1586,-4866,3076},{1445,-4847,3026},{1301,-4836,2980},{1153,-4831,2936},{1003,-4834,2895},
+    {851,-4845,2857},{700,-4863,2823},{549,-4887,2791},{401,-4918,2763},{255,-4956,2737},{113,-4999,2714},{-24,-5047,2694},{-156,-5099,2676},
+    {-281,-5155,2661},{-400,-5214,2647},{-512,-5275,2635},{-616,-5337,2624},{-712,-5400,2615},{-801,-5463,2606},{-882,-5525,2599},{-956,-5586,2591},
+    {-1023,-5645,2584},{-1084,-5701,2577},{-1139,-5755,2571},{-1189,-5805,2564},{-1236,-5852,2557},{-1279,-5895,2550},{-1320,-5933,2543},{-1361,-5968,2536},
+    {-1401,-5998,2529},{-1443,-6024,2523},{-1488,-6045,2516},{-1537,-6062,2510},{-1590,-6074,2504},{-1649,-6082,2500},{-1715,-6085,2496},{-1788,-6085,2494},
+    {-1869,-6081,2493},{-1958,-6073,2495},{-2056,-6062,2498},{-2163,-6048,2505},{-2278,-6032,2514},{-2401,-6015,2527},{-2531,-5996,2544},{-2668,-5976,2564},
+    {-2811,-5957,2589},{-2959,-5938,2618},{-3110,-5921,2652},{-3264,-5906,2691},{-3419,-5894,2735},{-3575,-5886,2784},{-3730,-5881,2838},{-3883,-5881,2897},
+    {-4034,-5886,2961},{-4182,-5896,3030},{-4326,-5912,3104},{-4466,-5933,3182},{-4600,-5959,3264},{-4729,-5991,3350},{-4852,-6028,3439},{-4969,-6069,3531},
+    {-5079,-6116,3627},{-5183,-6166,3724},{-5280,-6221,3824},{-5370,-6278,3925},{-5452,-6339,4028},{-5527,-6402,4131},{-5594,-6468,4235},{-5653,-6535,4339},
+    {-5704,-6604,4443},{-5746,-6674,4547},{-5780,-6744,4649},{-5804,-6815,4751},{-5820,-6886,4852},{-5825,-6956,4951},{-5820,-7027,5049},{-5805,-7096,5145},
+    {-5779,-7165,5238},{-5741,-7232,5330},{-5691,-7299,5419},{-5628,-7363,5506},{-5552,-7426,5590},{-5462,-7487,5672},{-5356,-7547,5750},{-5235,-7604,5826},
+    {-5098,-7659,5899},{-4944,-7711,5968},{-4771,-7760,6034},{-4581,-7807,6097},{-4371,-7851,6156},{-4143,-7891,6212},{-3895,-7928,6264},{-3629,-7962,6313},
+    {-3345,-7991,6358},{-3045,-8017,6399},{-2731,-8039,6435},{-2405,-8056,6469},{-2070,-8069,6498},{-1730,-8078,6523},{-1387,-8082,6544},{-1047,-8082,6561},
+    {-711,-8078,6575},{-384,-8070,6584},{-68,-8058,6590},{234,-8043,6592},{521,-8025,6590},{791,-8003,6585},{1044,-7979,6576},{1279,-7952,6564},
+    {1496,-7924,6549},{1696,-7893,6531},{1879,-7860,6510},{2046,-7827,6486},{2198,-7791,6460},{2334,-7755,6431},{2458,-7717,6400},{2568,-7679,6367},
+    {2666,-7640,6332},{2753,-7601,6296},{2830,-7561,6258},{2897,-7521,6218},{2955,-7481,6178},{3005,-7440,6136},{3048,-7400,6093},{3084,-7359,6050},
+    {3114,-7318,6006},{3138,-7278,5961},{3157,-7237,5916},{3172,-7197,5871},{3183,-7157,5825}
+  },
+  {  // -48
+    {2967,-7027,5743},{2977,-6987,5696},{2983,-6947,5649},{2987,-6907,5601},{2988,-6868,5554},{2987,-6828,5507},{2984,-6789,5460},{2979,-6750,5413},
+    {2973,-6711,5365},{2966,-6672,5319},{2957,-6634,5272},{2948,-6595,5225},{2938,-6557,5178},{2927,-6519,5131},{2917,-6481,5085},{2906,-6443,5038},
+    {2896,-6405,4991},{2887,-6368,4944},{2878,-6330,4897},{2870,-6292,4850},{2862,-6255,4802},{2856,-6217,4754},{2851,-6178,4705},{2847,-6139,4655},
+    {2844,-6099,4605},{2841,-6059,4554},{2839,-6017,4502},{2838,-5974,4449},{2836,-5929,4395},{2834,-5883,4340},{2830,-5836,4283},{2825,-5786,4225},
+    {2817,-5734,4166},{2806,-5681,4105},{2791,-5625,4044},{2772,-5568,3981},{2748,-5509,3917},{2718,-5449,3852},{2682,-5387,3787},{2638,-5325,3720},
+    {2587,-5262,3654},{2528,-5199,3587},{2461,-5137,3520},{2385,-5077,3454},{2301,-5018,3388},{2208,-4962,3324},{2106,-4910,3260},{1996,-4862,3199},
+    {1878,-4819,3139},{1752,-4781,3081},{1620,-4749,3026},{1481,-4725,2974},{1336,-4707,2924},{1187,-4698,2878},{1035,-4696,2834},{880,-4703,2794},
+    {723,-4717,2758},{566,-4740,2724},{410,-4770,2695},{256,-4808,2668},{105,-4852,2644},{-41,-4902,2623},{-182,-4958,2605},{-318,-5019,2590},
+    {-446,-5083,2577},{-567,-5151,2565},{-680,-5220,2556},{-785,-5291,2548},{-882,-5363,2540},{-970,-5434,2534},{-1049,-5504,2529},{-1121,-5573,2524},
+    {-1185,-5640,2519},{-1242,-5704,2514},{-1293,-5765,2509},{-1339,-5822,2504},{-1379,-5876,2498},{-1416,-5926,2492},{-1451,-5971,2487},{-1484,-6012,2480},
+    {-1517,-6048,2474},{-1551,-6079,2468},{-1587,-6105,2461},{-1627,-6127,2455},{-1671,-6144,2449},{-1721,-6155,2445},{-1778,-6163,2440},{-1842,-6165,2438},
+    {-1915,-6163,2436},{-1996,-6157,2437},{-2086,-6147,2440},{-2186,-6133,2445},{-2294,-6117,2454},{-2411,-6098,2465},{-2536,-6077,2481},{-2668,-6054,2500},
+    {-2806,-6031,2524},{-2950,-6008,2552},{-3097,-5987,2585},{-3247,-5967,2624},{-3399,-5949,2667},{-3552,-5935,2716},{-3703,-5925,2771},{-3853,-5920,2830},
+    {-4000,-5920,2895},{-4143,-5925,2965},{-4282,-5936,3040},{-4416,-5953,3120},{-4545,-5975,3204},{-4667,-6003,3292},{-4783,-6037,3383},{-4892,-6077,3478},
+    {-4994,-6121,3576},{-5089,-6169,3676},{-5177,-6222,3778},{-5256,-6279,3882},{-5328,-6339,3988},{-5391,-6401,4094},{-5446,-6466,4200},{-5492,-6533,4306},
+    {-5529,-6601,4413},{-5557,-6670,4518},{-5575,-6740,4623},{-5583,-6809,4727},{-5581,-6879,4829},{-5569,-6949,4929},{-5545,-7017,5028},{-5510,-7085,5125},
+    {-5463,-7152,5219},{-5403,-7217,5311},{-5331,-7280,5401},{-5245,-7341,5487},{-5145,-7401,5571},{-5031,-7458,5653},{-4902,-7513,5731},{-4757,-7565,5806},
+    {-4598,-7614,5878},{-4422,-7660,5946},{-4231,-7703,6011},{-4024,-7743,6073},{-3803,-7780,6131},{-3567,-7813,6186},{-3317,-7842,6236},{-3056,-7868,6284},
+    {-2783,-7890,6327},{-2502,-7908,6366},{-2215,-7922,6402},{-1922,-7932,6433},{-1628,-7939,6461},{-1334,-7942,6484},{-1043,-7941,6504},{-756,-7937,6519},
+    {-476,-7929,6531},{-204,-7918,6539},{58,-7905,6543},{309,-7888,6543},{548,-7869,6540},{775,-7848,6533},{988,-7824,6523},{1189,-7799,6510},
+    {1377,-7771,6493},{1551,-7742,6473},{1713,-7711,6451},{1863,-7679,6426},{2000,-7645,6398},{2126,-7610,6368},{2240,-7575,6335},{2344,-7538,6301},
+    {2437,-7501,6265},{2521,-7463,6227},{2596,-7424,6188},{2663,-7385,6147},{2721,-7346,6105},{2772,-7306,6062},{2817,-7267,6018},{2855,-7227,5974},
+    {2887,-7187,5928},{2914,-7147,5883},{2936,-7107,5836},{2953,-7067,5790},{2967,-7027,5743}
+  },
+  {  // -46
+    {2774,-6891,5657},{2786,-6851,5609},{2795,-6811,5561},{2801,-6771,5513},{2805,-6732,5465},{2806,-6692,5417},{2805,-6652,5369},{2802,-6613,5321},
+    {2798,-6573,5273},{2792,-6534,5225},{2785,-6495,5177},{2777,-6456,5130},{2768,-6417,5082},{2759,-6378,5035},{2749,-6340,4988},{2739,-6301,4940},
+    {2729,-6263,4893},{2720,-6225,4846},{2711,-6188,4798},{2703,-6150,4751},{2696,-6112,4703},{2690,-6075,4655},{2685,-6037,4606},{2682,-5998,4557},
+    {2679,-5959,4507},{2678,-5919,4456},{2677,-5879,4405},{2677,-5837,4352},{2677,-5793,4298},{2677,-5748,4244},{2676,-5702,4187},{2674,-5653,4130},
+    {2670,-5602,4071},{2663,-5550,4011},{2653,-5495,3950},{2639,-5438,3888},{2619,-5379,3824},{2593,-5318,3759},{2561,-5256,3693},{2522,-5192,3627},
+    {2475,-5129,3560},{2420,-5065,3493},{2356,-5001,3427},{2283,-4939,3360},{2201,-4879,3294},{2109,-4822,3229},{2008,-4768,3166},{1898,-4718,3104},
+    {1779,-4674,3044},{1651,-4636,2986},{1516,-4605,2931},{1374,-4581,2879},{1226,-4565,2829},{1073,-4557,2784},{916,-4558,2741},{755,-4568,2702},
+    {593,-4587,2667},{431,-4615,2635},{270,-4651,2607},{111,-4695,2582},{-45,-4747,2560},{-196,-4805,2542},{-342,-4869,2526},{-480,-4938,2513},
+    {-612,-5011,2502},{-735,-5087,2493},{-850,-5165,2486},{-955,-5245,2480},{-1052,-5325,2476},{-1139,-5405,2472},{-1218,-5483,2469},{-1288,-5560,2466},
+    {-1349,-5635,2463},{-1403,-5707,2460},{-1450,-5775,2457},{-1491,-5840,2453},{-1527,-5901,2449},{-1559,-5957,2445},{-1587,-6009,2440},{-1614,-6056,2435},
+    {-1640,-6099,2430},{-1666,-6136,2424},{-1695,-6168,2418},{-1726,-6195,2412},{-1761,-6217,2407},{-1802,-6233,2402},{-1850,-6245,2398},{-1904,-6251,2395},
+    {-1967,-6252,2393},{-2039,-6249,2393},{-2120,-6240,2395},{-2211,-6228,2399},{-2311,-6211,2406},{-2420,-6192,2417},{-2538,-6169,2431},{-2663,-6144,2449},
+    {-2796,-6118,2472},{-2934,-6091,2499},{-3076,-6065,2531},{-3222,-6040,2569},{-3369,-6017,2612},{-3517,-5997,2660},{-3664,-5981,2714},{-3809,-5969,2774},
+    {-3951,-5963,2839},{-4089,-5963,2910},{-4222,-5968,2986},{-4350,-5980,3067},{-4472,-5998,3152},{-4587,-6022,3241},{-4696,-6052,3335},{-4797,-6088,3432},
+    {-4891,-6129,3532},{-4976,-6175,3634},{-5054,-6226,3739},{-5123,-6280,3845},{-5184,-6339,3952},{-5235,-6400,4060},{-5278,-6463,4169},{-5311,-6528,4277},
+    {-5334,-6595,4385},{-5348,-6663,4493},{-5351,-6731,4599},{-5343,-6799,4704},{-5325,-6868,4807},{-5295,-6935,4908},{-5253,-7002,5008},{-5199,-7067,5105},
+    {-5133,-7131,5199},{-5053,-7192,5291},{-4961,-7252,5380},{-4854,-7310,5467},{-4734,-7365,5550},{-4600,-7417,5630},{-4452,-7466,5708},{-4290,-7513,5781},
+    {-4115,-7556,5852},{-3926,-7595,5919},{-3725,-7632,5983},{-3512,-7665,6043},{-3288,-7694,6099},{-3054,-7719,6152},{-2812,-7741,6201},{-2564,-7760,6246},
+    {-2311,-7774,6288},{-2054,-7786,6325},{-1796,-7793,6359},{-1538,-7798,6389},{-1282,-7799,6414},{-1029,-7797,6436},{-781,-7792,6454},{-538,-7785,6468},
+    {-302,-7774,6478},{-74,-7762,6484},{147,-7747,6487},{358,-7730,6485},{561,-7710,6481},{754,-7689,6472},{937,-7666,6461},{1110,-7641,6446},
+    {1274,-7615,6428},{1428,-7587,6407},{1572,-7558,6383},{1707,-7527,6357},{1832,-7495,6328},{1947,-7462,6297},{2054,-7428,6264},{2151,-7393,6228},
+    {2240,-7357,6191},{2321,-7320,6152},{2394,-7283,6112},{2459,-7245,6070},{2517,-7207,6027},{2568,-7168,5983},{2613,-7129,5938},{2652,-7090,5893},
+    {2686,-7050,5847},{2714,-7010,5800},{2738,-6971,5753},{2758,-6931,5705},{2774,-6891,5657}
+  },
+  {  // -44
+    {2600,-6749,5569},{2614,-6709,5520},{2624,-6669,5471},{2632,-6629,5423},{2638,-6589,5374},{2641,-6549,5325},{2642,-6509,5276},{2641,-6469,5227},
+    {2638,-6429,5178},{2634,-6389,5130},{2628,-6349,5081},{2621,-6309,5033},{2614,-6270,4985},{2605,-6230,4937},{2596,-6191,4889},{2586,-6152,4842},
+    {2577,-6114,4794},{2568,-6075,4746},{2559,-6037,4699},{2550,-5999,4651},{2543,-5962,4603},{2537,-5924,4555},{2531,-5886,4507},{2527,-5848,4458},
+    {2525,-5810,4408},{2523,-5771,4358},{2523,-5731,4307},{2524,-5690,4255},{2525,-5648,4202},{2527,-5605,4148},{2528,-5559,4093},{2528,-5511,4036},
+    {2527,-5462,3978},{2524,-5410,3919},{2517,-5356,3859},{2506,-5299,3797},{2490,-5240,3734},{2469,-5180,3669},{2441,-5117,3604},{2406,-5053,3538},
+    {2363,-4989,3472},{2311,-4924,3405},{2250,-4859,3338},{2179,-4796,3271},{2099,-4734,3206},{2008,-4675,3141},{1908,-4620,3077},{1797,-4570,3015},
+    {1678,-4525,2955},{1549,-4486,2898},{1411,-4455,2843},{1266,-4431,2791},{1115,-4417,2743},{957,-4411,2698},{795,-4416,2656},{630,-4430,2618},
+    {463,-4453,2584},{295,-4486,2554},{129,-4529,2528},{-36,-4580,2505},{-196,-4639,2485},{-351,-4705,2469},{-501,-4777,2456},{-643,-4855,2445},
+    {-777,-4936,2437},{-902,-5021,2431},{-1018,-5108,2426},{-1124,-5197,2423},{-1221,-5285,2421},{-1308,-5373,2419},{-1385,-5460,2418},{-1453,-5545,2418},
+    {-1513,-5628,2417},{-1564,-5707,2416},{-1608,-5783,2415},{-1645,-5855,2413},{-1677,-5923,2411},{-1704,-5986,2408},{-1727,-6045,2405},{-1748,-6099,2401},
+    {-1768,-6148,2396},{-1788,-6192,2392},{-1808,-6230,2387},{-1831,-6263,2382},{-1858,-6291,2377},{-1890,-6312,2372},{-1927,-6329,2368},{-1972,-6340,2365},
+    {-2024,-6345,2363},{-2085,-6344,2362},{-2156,-6339,2364},{-2236,-6328,2367},{-2326,-6312,2374},{-2426,-6293,2383},{-2535,-6269,2396},{-2652,-6242,2412},
+    {-2776,-6214,2434},{-2907,-6183,2459},{-3043,-6153,2490},{-3182,-6122,2527},{-3323,-6094,2568},{-3465,-6068,2616},{-3607,-6045,2669},{-3746,-6028,2729},
+    {-3882,-6015,2794},{-4014,-6008,2865},{-4142,-6007,2941},{-4263,-6013,3022},{-4378,-6025,3108},{-4486,-6044,3199},{-4587,-6070,3294},{-4680,-6101,3392},
+    {-4765,-6139,3494},{-4842,-6182,3598},{-4909,-6229,3704},{-4968,-6281,3812},{-5018,-6337,3921},{-5058,-6395,4031},{-5089,-6457,4141},{-5109,-6520,4251},
+    {-5119,-6585,4361},{-5119,-6651,4469},{-5107,-6717,4577},{-5085,-6783,4682},{-5050,-6849,4786},{-5004,-6914,4888},{-4946,-6977,4987},{-4875,-7040,5084},
+    {-4791,-7100,5179},{-4694,-7158,5270},{-4584,-7213,5359},{-4461,-7266,5444},{-4325,-7316,5526},{-4176,-7363,5605},{-4015,-7407,5681},{-3842,-7447,5753},
+    {-3657,-7484,5822},{-3462,-7517,5887},{-3258,-7546,5949},{-3046,-7572,6007},{-2827,-7594,6061},{-2603,-7613,6112},{-2376,-7627,6159},{-2146,-7639,6202},
+    {-1915,-7647,6241},{-1684,-7652,6277},{-1455,-7655,6308},{-1230,-7654,6336},{-1008,-7651,6359},{-790,-7645,6379},{-578,-7637,6395},{-371,-7626,6407},
+    {-171,-7614,6415},{23,-7600,6420},{210,-7584,6421},{390,-7567,6418},{563,-7547,6412},{729,-7526,6402},{888,-7504,6389},{1040,-7480,6373},
+    {1184,-7455,6354},{1321,-7429,6332},{1450,-7401,6308},{1572,-7371,6281},{1686,-7341,6251},{1793,-7309,6219},{1892,-7277,6185},{1984,-7243,6149},
+    {2068,-7208,6111},{2145,-7173,6071},{2215,-7137,6030},{2279,-7100,5988},{2336,-7062,5944},{2387,-7024,5900},{2432,-6986,5854},{2472,-6947,5808},
+    {2506,-6908,5761},{2536,-6868,5714},{2561,-6829,5666},{2582,-6789,5617},{2600,-6749,5569}
+  },
+  {  // -42
+    {2441,-6601,5478},{2456,-6561,5429},{2469,-6520,5379},{2478,-6480,5330},{2485,-6440,5280},{2490,-6399,5231},{2492,-6358,5181},{2493,-6318,5132},
+    {2492,-6277,5083},{2489,-6236,5034},{2484,-6196,4985},{2479,-6155,4936},{2472,-6115,4887},{2464,-6074,4839},{2455,-6034,4790},{2446,-5995,4742},
+    {2437,-5955,4694},{2427,-5916,4646},{2418,-5878,4598},{2409,-5840,4551},{2401,-5802,4503},{2394,-5764,4455},{2388,-5726,4407},{2383,-5689,4358},
+    {2380,-5651,4310},{2378,-5613,4260},{2378,-5574,4210},{2379,-5534,4159},{2380,-5493,4107},{2383,-5450,4054},{2385,-5406,4000},{2387,-5360,3944},
+    {2388,-5311,3887},{2387,-5260,3829},{2383,-5207,3770},{2375,-5151,3709},{2363,-5093,3646},{2345,-5032,3583},{2320,-4970,3519},{2288,-4906,3453},
+    {2249,-4840,3387},{2200,-4775,3321},{2141,-4709,3255},{2073,-4644,3189},{1994,-4581,3123},{1905,-4521,3059},{1805,-4465,2995},{1695,-4414,2934},
+    {1574,-4368,2874},{1444,-4329,2818},{1304,-4298,2763},{1156,-4276,2712},{1001,-4263,2665},{840,-4260,2620},{673,-4267,2580},{503,-4285,2544},
+    {331,-4313,2511},{159,-4352,2483},{-12,-4401,2458},{-181,-4459,2437},{-346,-4526,2420},{-505,-4600,2406},{-658,-4681,2395},{-802,-4767,2387},
+    {-939,-4858,2381},{-1066,-4952,2377},{-1183,-5048,2375},{-1289,-5145,2375},{-1386,-5242,2375},{-1472,-5338,2376},{-1548,-5433,2377},{-1615,-5526,2379},
+    {-1673,-5616,2380},{-1722,-5703,2382},{-1763,-5787,2382},{-1797,-5866,2383},{-1825,-5941,2382},{-1848,-6011,2381},{-1867,-6077,2379},{-1884,-6137,2377},
+    {-1898,-6193,2374},{-1911,-6243,2371},{-1925,-6288,2367},{-1940,-6327,2363},{-1958,-6361,2359},{-1981,-6389,2355},{-2008,-6410,2351},{-2041,-6426,2348},
+    {-2082,-6436,2346},{-2132,-6440,2345},{-2190,-6437,2346},{-2258,-6429,2349},{-2336,-6415,2355},{-2424,-6396,2363},{-2522,-6372,2375},{-2628,-6345,2390},
+    {-2743,-6314,2410},{-2865,-6280,2434},{-2992,-6246,2463},{-3123,-6211,2498},{-3257,-6177,2538},{-3392,-6145,2584},{-3527,-6116,2636},{-3660,-6091,2695},
+    {-3790,-6071,2759},{-3916,-6057,2829},{-4037,-6050,2905},{-4151,-6049,2987},{-4259,-6055,3073},{-4360,-6068,3164},{-4453,-6088,3260},{-4538,-6115,3359},
+    {-4615,-6148,3462},{-4682,-6186,3567},{-4741,-6230,3675},{-4790,-6279,3784},{-4829,-6331,3894},{-4858,-6387,4005},{-4877,-6445,4117},{-4885,-6506,4228},
+    {-4883,-6568,4338},{-4870,-6631,4448},{-4845,-6695,4556},{-4808,-6758,4662},{-4760,-6821,4766},{-4699,-6883,4868},{-4626,-6943,4967},{-4540,-7001,5063},
+    {-4441,-7058,5157},{-4330,-7111,5247},{-4207,-7162,5335},{-4071,-7210,5419},{-3924,-7255,5500},{-3765,-7296,5577},{-3596,-7334,5651},{-3417,-7367,5721},
+    {-3229,-7398,5788},{-3035,-7424,5850},{-2834,-7447,5910},{-2629,-7466,5965},{-2420,-7481,6017},{-2210,-7493,6065},{-2000,-7501,6110},{-1790,-7507,6150},
+    {-1582,-7509,6187},{-1377,-7509,6220},{-1176,-7506,6249},{-979,-7501,6274},{-787,-7494,6295},{-600,-7485,6313},{-418,-7475,6327},{-242,-7462,6337},
+    {-71,-7448,6344},{95,-7433,6346},{255,-7416,6346},{409,-7399,6342},{559,-7380,6334},{703,-7359,6324},{842,-7338,6310},{975,-7315,6293},
+    {1103,-7291,6273},{1226,-7266,6250},{1342,-7239,6225},{1453,-7211,6197},{1558,-7182,6167},{1657,-7152,6134},{1749,-7121,6100},{1836,-7088,6063},
+    {1916,-7055,6025},{1989,-7020,5985},{2057,-6985,5943},{2119,-6949,5901},{2175,-6912,5857},{2225,-6875,5812},{2269,-6837,5766},{2309,-6798,5719},
+    {2344,-6759,5672},{2374,-6720,5624},{2400,-6680,5576},{2422,-6641,5527},{2441,-6601,5478}
+  },
+  {  // -40
+    {2296,-6444,5384},{2312,-6404,5335},{2325,-6363,5285},{2336,-6323,5235},{2344,-6282,5185},{2350,-6241,5136},{2354,-6200,5086},{2356,-6158,5036},
+    {2356,-6117,4986},{2355,-6075,4936},{2351,-6034,4887},{2347,-5992,4838},{2341,-5951,4788},{2334,-5910,4739},{2325,-5869,4691},{2317,-5828,4642},
+    {2307,-5788,4594},{2297,-5748,4546},{2288,-5709,4498},{2278,-5670,4450},{2269,-5632,4403},{2261,-5594,4355},{2254,-5556,4308},{2249,-5519,4260},
+    {2244,-5481,4211},{2242,-5444,4163},{2241,-5405,4114},{2241,-5367,4064},{2242,-5327,4013},{2245,-5285,3961},{2248,-5242,3908},{2251,-5197,3854},
+    {2253,-5150,3798},{2253,-5100,3741},{2251,-5048,3683},{2246,-4993,3624},{2236,-4935,3563},{2221,-4875,3500},{2199,-4812,3437},{2171,-4748,3373},
+    {2134,-4682,3308},{2087,-4616,3243},{2032,-4549,3177},{1965,-4483,3112},{1888,-4419,3047},{1800,-4358,2983},{1701,-4301,2921},{1590,-4248,2860},
+    {1469,-4202,2801},{1337,-4163,2745},{1195,-4132,2692},{1045,-4111,2641},{886,-4100,2595},{721,-4099,2552},{551,-4110,2513},{376,-4132,2478},
+    {200,-4166,2447},{23,-4211,2420},{-152,-4266,2397},{-325,-4332,2379},{-493,-4406,2363},{-656,-4489,2352},{-811,-4579,2343},{-958,-4674,2338},
+    {-1096,-4773,2334},{-1224,-4876,2333},{-1341,-4981,2334},{-1448,-5087,2336},{-1544,-5192,2338},{-1630,-5297,2342},{-1705,-5400,2346},{-1770,-5501,2349},
+    {-1826,-5599,2353},{-1873,-5693,2356},{-1911,-5783,2359},{-1943,-5870,2361},{-1968,-5951,2363},{-1988,-6028,2364},{-2004,-6101,2364},{-2016,-6168,2363},
+    {-2025,-6230,2362},{-2033,-6287,2360},{-2040,-6338,2358},{-2048,-6384,2355},{-2058,-6424,2352},{-2071,-6458,2349},{-2087,-6485,2346},{-2110,-6507,2344},
+    {-2138,-6521,2343},{-2174,-6529,2342},{-2219,-6531,2343},{-2273,-6526,2345},{-2337,-6514,2350},{-2411,-6497,2357},{-2495,-6474,2368},{-2589,-6446,2382},
+    {-2691,-6414,2400},{-2802,-6378,2422},{-2919,-6340,2449},{-3041,-6301,2482},{-3166,-6261,2521},{-3293,-6223,2565},{-3420,-6188,2615},{-3546,-6157,2672},
+    {-3669,-6130,2735},{-3789,-6108,2804},{-3903,-6094,2879},{-4011,-6086,2960},{-4112,-6085,3046},{-4206,-6092,3137},{-4292,-6105,3233},{-4369,-6126,3332},
+    {-4437,-6154,3435},{-4497,-6187,3541},{-4546,-6226,3650},{-4586,-6271,3760},{-4615,-6319,3871},{-4635,-6371,3983},{-4643,-6426,4095},{-4641,-6483,4207},
+    {-4627,-6542,4318},{-4602,-6602,4427},{-4565,-6662,4535},{-4516,-6722,4642},{-4455,-6781,4746},{-4382,-6840,4847},{-4297,-6896,4946},{-4199,-6950,5041},
+    {-4089,-7002,5134},{-3967,-7051,5223},{-3834,-7097,5309},{-3690,-7140,5391},{-3536,-7179,5470},{-3372,-7214,5545},{-3200,-7246,5617},{-3020,-7274,5684},
+    {-2835,-7297,5748},{-2645,-7317,5809},{-2453,-7333,5865},{-2258,-7346,5918},{-2063,-7355,5967},{-1869,-7361,6012},{-1677,-7364,6054},{-1488,-7364,6091},
+    {-1303,-7361,6125},{-1122,-7356,6155},{-946,-7349,6182},{-775,-7340,6204},{-608,-7330,6223},{-447,-7318,6239},{-291,-7306,6251},{-140,-7291,6259},
+    {6,-7276,6263},{148,-7260,6265},{286,-7243,6262},{420,-7226,6257},{550,-7207,6248},{676,-7187,6237},{798,-7166,6222},{916,-7145,6204},
+    {1030,-7122,6184},{1140,-7098,6161},{1246,-7073,6135},{1347,-7046,6107},{1444,-7019,6076},{1536,-6990,6043},{1623,-6960,6008},{1704,-6928,5972},
+    {1780,-6896,5933},{1851,-6862,5893},{1916,-6827,5852},{1975,-6792,5809},{2030,-6755,5765},{2079,-6718,5720},{2123,-6680,5674},{2162,-6642,5627},
+    {2197,-6603,5579},{2227,-6564,5531},{2254,-6524,5483},{2276,-6484,5434},{2296,-6444,5384}
+  },
+  {  // -38
+    {2162,-6279,5288},{2179,-6238,5239},{2193,-6197,5189},{2204,-6156,5139},{2214,-6115,5089},{2221,-6073,5039},{2226,-6031,4988},{2229,-5989,4938},
+    {2230,-5947,4888},{2230,-5905,4838},{2227,-5862,4788},{2224,-5820,4739},{2219,-5778,4689},{2212,-5735,4640},{2205,-5693,4591},{2196,-5652,4542},
+    {2187,-5611,4494},{2177,-5570,4446},{2167,-5530,4398},{2157,-5490,4350},{2147,-5451,4303},{2138,-5413,4256},{2130,-5375,4209},{2123,-5337,4161},
+    {2117,-5300,4114},{2113,-5263,4066},{2111,-5225,4018},{2110,-5187,3969},{2111,-5148,3920},{2113,-5108,3870},{2116,-5066,3818},{2119,-5022,3765},
+    {2121,-4976,3712},{2123,-4927,3656},{2122,-4876,3600},{2119,-4822,3542},{2111,-4764,3482},{2098,-4705,3422},{2079,-4642,3360},{2053,-4578,3297},
+    {2018,-4512,3233},{1974,-4445,3169},{1920,-4377,3105},{1856,-4310,3041},{1780,-4245,2977},{1693,-4183,2914},{1594,-4125,2853},{1484,-4072,2793},
+    {1361,-4025,2735},{1228,-3986,2680},{1085,-3956,2628},{932,-3936,2579},{770,-3926,2533},{602,-3929,2492},{428,-3943,2454},{250,-3970,2421},
+    {70,-4009,2392},{-111,-4060,2367},{-290,-4122,2346},{-466,-4195,2329},{-637,-4278,2316},{-802,-4369,2307},{-959,-4468,2301},{-1107,-4572,2298},
+    {-1246,-4681,2297},{-1375,-4792,2298},{-1492,-4906,2301},{-1599,-5021,2305},{-1694,-5135,2310},{-1778,-5248,2316},{-1852,-5359,2322},{-1915,-5467,2328},
+    {-1969,-5572,2334},{-2014,-5674,2340},{-2050,-5771,2345},{-2079,-5864,2349},{-2102,-5953,2352},{-2119,-6036,2355},{-2131,-6115,2357},{-2140,-6189,2359},
+    {-2145,-6257,2359},{-2148,-6321,2359},{-2149,-6378,2359},{-2150,-6430,2358},{-2151,-6476,2356},{-2155,-6516,2355},{-2161,-6550,2354},{-2171,-6576,2352},
+    {-2186,-6596,2351},{-2207,-6609,2351},{-2237,-6615,2352},{-2275,-6614,2355},{-2323,-6605,2359},{-2381,-6590,2366},{-2449,-6568,2375},{-2528,-6540,2387},
+    {-2616,-6507,2404},{-2713,-6470,2424},{-2818,-6429,2449},{-2929,-6386,2480},{-3044,-6342,2516},{-3162,-6299,2558},{-3281,-6258,2606},{-3400,-6219,2661},
+    {-3516,-6185,2722},{-3629,-6157,2789},{-3736,-6134,2862},{-3838,-6119,2942},{-3933,-6111,3027},{-4021,-6111,3117},{-4100,-6118,3212},{-4171,-6132,3312},
+    {-4232,-6153,3415},{-4284,-6181,3520},{-4325,-6215,3629},{-4357,-6254,3739},{-4378,-6298,3851},{-4388,-6346,3963},{-4388,-6397,4075},{-4376,-6450,4187},
+    {-4352,-6505,4298},{-4317,-6561,4408},{-4271,-6617,4516},{-4212,-6674,4621},{-4141,-6729,4725},{-4058,-6783,4825},{-3963,-6835,4923},{-3857,-6885,5018},
+    {-3739,-6932,5109},{-3610,-6976,5196},{-3471,-7017,5280},{-3323,-7054,5360},{-3166,-7088,5437},{-3001,-7117,5510},{-2831,-7143,5579},{-2655,-7165,5644},
+    {-2476,-7183,5705},{-2294,-7196,5762},{-2112,-7207,5816},{-1931,-7213,5865},{-1751,-7217,5911},{-1574,-7217,5953},{-1401,-7214,5991},{-1232,-7210,6026},
+    {-1068,-7203,6057},{-909,-7194,6084},{-755,-7183,6107},{-606,-7171,6127},{-462,-7158,6144},{-324,-7144,6157},{-190,-7129,6166},{-60,-7114,6172},
+    {66,-7098,6175},{188,-7081,6175},{307,-7064,6171},{424,-7047,6164},{537,-7028,6155},{647,-7009,6142},{755,-6990,6127},{861,-6969,6108},
+    {963,-6947,6088},{1063,-6925,6064},{1159,-6901,6038},{1253,-6876,6010},{1342,-6849,5979},{1428,-6821,5946},{1509,-6792,5912},{1586,-6762,5875},
+    {1659,-6730,5837},{1726,-6697,5797},{1789,-6663,5755},{1846,-6627,5713},{1899,-6591,5669},{1947,-6554,5624},{1990,-6516,5578},{2029,-6478,5531},
+    {2063,-6439,5483},{2093,-6399,5435},{2120,-6360,5387},{2142,-6319,5338},{2162,-6279,5288}
+  },
+  {  // -36
+    {2039,-6103,5190},{2056,-6062,5140},{2070,-6021,5090},{2082,-5979,5040},{2092,-5937,4990},{2100,-5895,4940},{2106,-5852,4890},{2110,-5810,4840},
+    {2112,-5767,4789},{2113,-5724,4739},{2111,-5680,4689},{2109,-5637,4639},{2105,-5594,4590},{2099,-5550,4540},{2092,-5507,4491},{2084,-5465,4443},
+    {2074,-5422,4394},{2064,-5380,4346},{2054,-5339,4298},{2043,-5299,4251},{2033,-5259,4204},{2023,-5220,4157},{2013,-5182,4111},{2005,-5144,4064},
+    {1998,-5106,4018},{1993,-5069,3971},{1989,-5032,3924},{1987,-4995,3877},{1987,-4956,3829},{1988,-4917,3780},{1990,-4876,3730},{1993,-4833,3679},
+    {1995,-4788,3627},{1997,-4740,3574},{1997,-4690,3519},{1995,-4637,3463},{1988,-4580,3405},{1977,-4521,3347},{1960,-4459,3287},{1935,-4394,3225},
+    {1902,-4328,3163},{1860,-4260,3101},{1808,-4192,3038},{1746,-4124,2975},{1671,-4058,2913},{1585,-3995,2852},{1486,-3935,2792},{1376,-3881,2733},
+    {1253,-3834,2677},{1119,-3795,2623},{973,-3766,2572},{818,-3747,2524},{655,-3740,2480},{483,-3745,2440},{307,-3763,2404},{126,-3795,2373},
+    {-58,-3839,2345},{-241,-3897,2322},{-423,-3966,2304},{-601,-4047,2289},{-775,-4139,2278},{-941,-4239,2271},{-1099,-4346,2267},{-1249,-4460,2266},
+    {-1387,-4578,2268},{-1515,-4699,2271},{-1632,-4821,2277},{-1738,-4945,2283},{-1831,-5067,2291},{-1914,-5189,2299},{-1986,-5308,2307},{-2047,-5423,2315},
+    {-2099,-5536,2323},{-2141,-5644,2331},{-2176,-5748,2338},{-2202,-5848,2345},{-2223,-5942,2350},{-2237,-6032,2355},{-2246,-6117,2360},{-2251,-6197,2363},
+    {-2252,-6272,2366},{-2250,-6341,2368},{-2245,-6405,2370},{-2239,-6463,2371},{-2233,-6514,2371},{-2226,-6560,2371},{-2221,-6599,2372},{-2218,-6631,2372},
+    {-2219,-6657,2372},{-2226,-6674,2373},{-2238,-6684,2374},{-2259,-6687,2377},{-2289,-6681,2381},{-2328,-6668,2387},{-2379,-6648,2395},{-2440,-6621,2406},
+    {-2512,-6588,2421},{-2594,-6550,2439},{-2685,-6507,2462},{-2783,-6461,2490},{-2888,-6414,2523},{-2996,-6366,2563},{-3107,-6319,2608},{-3217,-6274,2660},
+    {-3327,-6233,2718},{-3433,-6198,2783},{-3535,-6168,2855},{-3632,-6145,2932},{-3722,-6129,3016},{-3804,-6121,3104},{-3878,-6121,3198},{-3942,-6129,3296},
+    {-3998,-6144,3399},{-4044,-6165,3504},{-4079,-6193,3612},{-4104,-6227,3722},{-4118,-6266,3833},{-4121,-6309,3945},{-4113,-6355,4057},{-4094,-6404,4168},
+    {-4063,-6454,4279},{-4020,-6506,4388},{-3966,-6558,4496},{-3899,-6610,4601},{-3821,-6661,4703},{-3732,-6710,4803},{-3631,-6758,4899},{-3519,-6803,4992},
+    {-3397,-6846,5081},{-3265,-6885,5167},{-3124,-6921,5249},{-2975,-6953,5327},{-2819,-6981,5401},{-2657,-7005,5471},{-2491,-7025,5537},{-2322,-7041,5599},
+    {-2152,-7053,5657},{-1981,-7062,5711},{-1812,-7066,5761},{-1644,-7068,5807},{-1480,-7066,5849},{-1320,-7061,5888},{-1164,-7054,5923},{-1014,-7045,5954},
+    {-869,-7034,5981},{-729,-7022,6005},{-595,-7008,6026},{-466,-6993,6043},{-342,-6978,6057},{-223,-6962,6067},{-108,-6946,6074},{4,-6929,6078},
+    {112,-6913,6079},{218,-6896,6077},{321,-6879,6072},{422,-6861,6065},{521,-6844,6054},{619,-6826,6041},{714,-6807,6025},{809,-6787,6006},
+    {901,-6767,5985},{992,-6745,5961},{1081,-6723,5935},{1167,-6699,5907},{1250,-6673,5877},{1331,-6646,5844},{1408,-6618,5810},{1481,-6588,5773},
+    {1550,-6557,5735},{1614,-6524,5696},{1675,-6490,5655},{1730,-6455,5612},{1781,-6419,5568},{1828,-6382,5524},{1870,-6344,5478},{1907,-6305,5431},
+    {1941,-6265,5384},{1971,-6225,5336},{1997,-6185,5288},{2019,-6144,5239},{2039,-6103,5190}
+  },
+  {  // -34
+    {1925,-5917,5088},{1942,-5875,5039},{1956,-5833,4990},{1968,-5790,4940},{1978,-5748,4890},{1987,-5705,4840},{1993,-5662,4790},{1998,-5618,4740},
+    {2001,-5575,4690},{2002,-5531,4640},{2002,-5487,4590},{2001,-5442,4540},{1997,-5398,4490},{1992,-5354,4441},{1986,-5309,4392},{1978,-5265,4343},
+    {1969,-5222,4295},{1959,-5179,4247},{1948,-5137,4200},{1937,-5095,4153},{1926,-5054,4106},{1915,-5014,4060},{1904,-4975,4014},{1895,-4937,3969},
+    {1886,-4900,3923},{1879,-4862,3878},{1874,-4825,3832},{1871,-4788,3786},{1869,-4750,3740},{1869,-4712,3693},{1870,-4672,3645},{1872,-4630,3596},
+    {1874,-4585,3546},{1876,-4539,3494},{1876,-4489,3442},{1874,-4437,3388},{1868,-4381,3332},{1858,-4322,3276},{1842,-4260,3218},{1819,-4195,3158},
+    {1788,-4128,3098},{1747,-4060,3038},{1697,-3991,2977},{1635,-3922,2916},{1562,-3855,2855},{1476,-3791,2796},{1378,-3730,2737},{1267,-3676,2680},
+    {1144,-3628,2626},{1009,-3590,2573},{862,-3561,2524},{706,-3543,2478},{540,-3538,2436},{366,-3547,2397},{187,-3569,2363},{4,-3605,2333},
+    {-182,-3656,2308},{-367,-3720,2286},{-551,-3797,2270},{-731,-3886,2257},{-905,-3986,2248},{-1072,-4095,2243},{-1231,-4212,2242},{-1379,-4335,2243},
+    {-1518,-4462,2247},{-1645,-4593,2252},{-1760,-4725,2260},{-1863,-4857,2269},{-1955,-4988,2279},{-2035,-5117,2289},{-2105,-5244,2299},{-2164,-5367,2310},
+    {-2213,-5487,2320},{-2253,-5602,2330},{-2284,-5712,2339},{-2308,-5818,2348},{-2326,-5919,2356},{-2337,-6015,2363},{-2343,-6105,2370},{-2344,-6191,2376},
+    {-2341,-6271,2381},{-2334,-6346,2385},{-2323,-6415,2389},{-2310,-6478,2393},{-2295,-6535,2395},{-2279,-6586,2398},{-2263,-6631,2400},{-2247,-6668,2401},
+    {-2233,-6698,2403},{-2223,-6720,2405},{-2218,-6734,2407},{-2220,-6740,2410},{-2230,-6738,2414},{-2250,-6728,2420},{-2281,-6710,2427},{-2324,-6684,2437},
+    {-2378,-6651,2450},{-2443,-6613,2466},{-2519,-6569,2487},{-2603,-6521,2512},{-2696,-6470,2542},{-2794,-6418,2579},{-2896,-6366,2621},{-2999,-6316,2670},
+    {-3102,-6268,2725},{-3203,-6226,2787},{-3300,-6189,2855},{-3392,-6158,2930},{-3477,-6135,3011},{-3556,-6120,3098},{-3625,-6112,3190},{-3686,-6113,3286},
+    {-3737,-6121,3387},{-3779,-6136,3491},{-3810,-6158,3598},{-3830,-6186,3707},{-3839,-6219,3817},{-3837,-6256,3928},{-3824,-6297,4040},{-3799,-6341,4150},
+    {-3762,-6387,4260},{-3714,-6434,4368},{-3655,-6482,4475},{-3584,-6529,4579},{-3502,-6576,4680},{-3408,-6621,4778},{-3304,-6664,4873},{-3190,-6704,4964},
+    {-3067,-6742,5051},{-2935,-6777,5135},{-2795,-6807,5214},{-2649,-6834,5289},{-2497,-6857,5360},{-2341,-6876,5427},{-2182,-6891,5490},{-2022,-6902,5549},
+    {-1862,-6909,5603},{-1703,-6912,5654},{-1547,-6912,5700},{-1394,-6909,5743},{-1245,-6902,5782},{-1100,-6893,5817},{-962,-6882,5848},{-828,-6869,5875},
+    {-701,-6855,5900},{-579,-6840,5920},{-462,-6823,5938},{-350,-6806,5952},{-244,-6789,5963},{-141,-6772,5971},{-42,-6754,5976},{54,-6737,5978},
+    {147,-6720,5977},{239,-6703,5973},{328,-6686,5967},{416,-6669,5958},{503,-6652,5947},{590,-6635,5933},{675,-6617,5916},{760,-6599,5897},
+    {844,-6579,5876},{927,-6559,5853},{1009,-6538,5827},{1089,-6515,5799},{1167,-6490,5769},{1243,-6464,5737},{1316,-6436,5703},{1386,-6407,5667},
+    {1452,-6376,5630},{1514,-6343,5590},{1572,-6309,5550},{1626,-6274,5508},{1675,-6237,5464},{1720,-6200,5420},{1761,-6161,5375},{1797,-6122,5329},
+    {1830,-6082,5282},{1859,-6041,5234},{1884,-6000,5186},{1906,-5958,5137},{1925,-5917,5088}
+  },
+  {  // -32
+    {1821,-5718,4985},{1837,-5675,4936},{1851,-5632,4887},{1862,-5589,4837},{1872,-5546,4788},{1881,-5502,4738},{1888,-5458,4689},{1893,-5414,4639},
+    {1897,-5370,4589},{1899,-5325,4539},{1899,-5280,4490},{1899,-5235,4440},{1896,-5190,4391},{1892,-5144,4342},{1886,-5099,4293},{1879,-5054,4244},
+    {1870,-5009,4196},{1860,-4965,4149},{1850,-4921,4102},{1838,-4878,4055},{1826,-4836,4010},{1814,-4796,3964},{1803,-4756,3919},{1792,-4717,3875},
+    {1782,-4679,3830},{1773,-4641,3786},{1767,-4604,3742},{1762,-4567,3698},{1758,-4529,3653},{1757,-4491,3608},{1757,-4452,3562},{1757,-4410,3515},
+    {1759,-4367,3467},{1760,-4321,3418},{1760,-4272,3368},{1758,-4220,3316},{1753,-4165,3263},{1743,-4106,3208},{1728,-4044,3153},{1706,-3979,3096},
+    {1676,-3912,3038},{1636,-3843,2980},{1587,-3773,2921},{1526,-3703,2862},{1453,-3635,2804},{1368,-3570,2746},{1270,-3508,2690},{1159,-3453,2635},
+    {1036,-3405,2582},{900,-3367,2531},{752,-3339,2484},{594,-3323,2440},{427,-3320,2399},{252,-3331,2362},{71,-3358,2330},{-114,-3399,2302},
+    {-300,-3456,2278},{-487,-3527,2259},{-672,-3612,2244},{-852,-3709,2233},{-1027,-3818,2226},{-1193,-3937,2223},{-1351,-4063,2224},{-1499,-4196,2227},
+    {-1635,-4333,2233},{-1760,-4473,2241},{-1873,-4614,2251},{-1974,-4755,2261},{-2063,-4895,2273},{-2140,-5032,2286},{-2207,-5167,2298},{-2262,-5298,2311},
+    {-2308,-5424,2323},{-2345,-5546,2335},{-2373,-5662,2347},{-2394,-5774,2358},{-2408,-5880,2368},{-2416,-5981,2378},{-2418,-6077,2387},{-2415,-6168,2395},
+    {-2407,-6253,2403},{-2395,-6333,2410},{-2378,-6407,2417},{-2358,-6475,2422},{-2334,-6537,2428},{-2308,-6592,2432},{-2280,-6641,2436},{-2250,-6683,2440},
+    {-2222,-6717,2444},{-2195,-6743,2447},{-2172,-6761,2450},{-2155,-6771,2454},{-2145,-6771,2458},{-2145,-6764,2463},{-2155,-6747,2470},{-2177,-6723,2479},
+    {-2212,-6691,2490},{-2260,-6652,2504},{-2320,-6608,2522},{-2390,-6558,2544},{-2470,-6505,2572},{-2557,-6449,2605},{-2650,-6393,2644},{-2746,-6338,2689},
+    {-2843,-6285,2740},{-2939,-6236,2799},{-3032,-6193,2864},{-3121,-6155,2936},{-3204,-6125,3014},{-3279,-6102,3097},{-3347,-6087,3187},{-3405,-6080,3281},
+    {-3454,-6081,3379},{-3493,-6090,3482},{-3521,-6105,3587},{-3538,-6127,3694},{-3544,-6154,3803},{-3539,-6186,3913},{-3523,-6222,4023},{-3495,-6260,4132},
+    {-3456,-6301,4241},{-3405,-6344,4348},{-3344,-6387,4453},{-3271,-6430,4555},{-3187,-6472,4655},{-3093,-6512,4751},{-2989,-6551,4844},{-2875,-6587,4933},
+    {-2754,-6620,5018},{-2624,-6650,5099},{-2488,-6676,5175},{-2347,-6698,5248},{-2202,-6717,5316},{-2054,-6731,5380},{-1904,-6741,5439},{-1754,-6748,5495},
+    {-1605,-6750,5546},{-1459,-6749,5592},{-1315,-6744,5635},{-1176,-6737,5674},{-1041,-6726,5709},{-912,-6714,5740},{-788,-6699,5767},{-671,-6683,5791},
+    {-559,-6665,5812},{-452,-6647,5829},{-351,-6628,5843},{-254,-6610,5855},{-162,-6591,5863},{-74,-6572,5868},{11,-6554,5871},{93,-6536,5871},
+    {173,-6519,5868},{252,-6502,5863},{330,-6486,5856},{407,-6469,5846},{484,-6453,5834},{561,-6437,5819},{637,-6420,5802},{714,-6403,5784},
+    {791,-6385,5762},{868,-6366,5739},{943,-6345,5714},{1018,-6323,5686},{1092,-6299,5657},{1164,-6274,5625},{1233,-6247,5592},{1300,-6217,5556},
+    {1363,-6186,5519},{1423,-6154,5481},{1479,-6119,5441},{1531,-6083,5399},{1579,-6046,5357},{1622,-6007,5313},{1662,-5968,5268},{1697,-5928,5222},
+    {1729,-5886,5176},{1756,-5845,5129},{1781,-5803,5081},{1802,-5761,5033},{1821,-5718,4985}
+  },
+  {  // -30
+    {1724,-5506,4878},{1739,-5462,4830},{1753,-5418,4782},{1764,-5374,4733},{1774,-5330,4684},{1782,-5286,4635},{1789,-5241,4586},{1794,-5196,4537},
+    {1798,-5151,4488},{1801,-5106,4438},{1802,-5060,4389},{1802,-5014,4340},{1800,-4968,4291},{1797,-4921,4243},{1792,-4875,4194},{1785,-4828,4146},
+    {1777,-4782,4099},{1767,-4737,4052},{1757,-4692,4006},{1745,-4648,3960},{1733,-4604,3915},{1720,-4562,3870},{1707,-4522,3826},{1695,-4482,3783},
+    {1684,-4443,3740},{1674,-4405,3697},{1666,-4367,3655},{1659,-4330,3612},{1655,-4293,3569},{1651,-4255,3526},{1650,-4216,3482},{1650,-4175,3437},
+    {1650,-4132,3392},{1650,-4086,3345},{1650,-4038,3297},{1647,-3986,3248},{1642,-3931,3197},{1632,-3872,3146},{1617,-3810,3093},{1596,-3745,3038},
+    {1566,-3677,2983},{1527,-3607,2927},{1479,-3536,2871},{1418,-3466,2815},{1346,-3396,2758},{1262,-3330,2703},{1164,-3268,2649},{1053,-3212,2596},
+    {929,-3164,2545},{793,-3126,2497},{645,-3098,2451},{486,-3084,2409},{318,-3084,2370},{142,-3099,2335},{-40,-3129,2305},{-226,-3176,2278},
+    {-413,-3239,2257},{-600,-3317,2239},{-785,-3410,2226},{-965,-3516,2217},{-1138,-3634,2212},{-1304,-3762,2211},{-1460,-3898,2213},{-1605,-4040,2218},
+    {-1739,-4187,2226},{-1861,-4337,2236},{-1971,-4488,2247},{-2068,-4638,2260},{-2154,-4786,2274},{-2227,-4932,2289},{-2290,-5074,2303},{-2342,-5212,2318},
+    {-2384,-5345,2333},{-2417,-5473,2347},{-2441,-5596,2361},{-2458,-5713,2374},{-2468,-5825,2387},{-2472,-5931,2399},{-2469,-6032,2410},{-2461,-6127,2421},
+    {-2448,-6216,2432},{-2429,-6300,2441},{-2406,-6378,2451},{-2378,-6450,2459},{-2345,-6516,2467},{-2309,-6576,2474},{-2269,-6628,2480},{-2226,-6674,2486},
+    {-2183,-6711,2492},{-2140,-6741,2496},{-2099,-6762,2501},{-2063,-6774,2505},{-2033,-6777,2510},{-2012,-6772,2515},{-2002,-6757,2521},{-2005,-6734,2529},
+    {-2020,-6703,2539},{-2050,-6664,2551},{-2093,-6619,2567},{-2149,-6568,2586},{-2216,-6513,2610},{-2293,-6455,2640},{-2377,-6395,2675},{-2465,-6336,2716},
+    {-2557,-6278,2764},{-2649,-6224,2818},{-2739,-6174,2879},{-2825,-6130,2947},{-2906,-6093,3022},{-2980,-6063,3102},{-3047,-6041,3188},{-3105,-6028,3279},
+    {-3153,-6022,3375},{-3191,-6024,3475},{-3218,-6032,3577},{-3235,-6048,3683},{-3240,-6069,3789},{-3235,-6095,3897},{-3218,-6126,4005},{-3189,-6159,4113},
+    {-3150,-6195,4220},{-3099,-6233,4325},{-3037,-6271,4428},{-2965,-6309,4529},{-2882,-6347,4626},{-2789,-6383,4721},{-2688,-6418,4811},{-2578,-6450,4898},
+    {-2460,-6479,4981},{-2336,-6504,5059},{-2206,-6526,5133},{-2072,-6544,5202},{-1934,-6559,5267},{-1795,-6569,5328},{-1655,-6575,5384},{-1516,-6577,5435},
+    {-1379,-6575,5483},{-1244,-6570,5526},{-1113,-6562,5565},{-987,-6551,5599},{-866,-6537,5630},{-750,-6521,5658},{-641,-6503,5681},{-537,-6484,5702},
+    {-438,-6464,5719},{-346,-6444,5733},{-258,-6423,5743},{-175,-6403,5752},{-96,-6383,5757},{-20,-6363,5760},{53,-6344,5760},{123,-6326,5758},
+    {192,-6309,5754},{260,-6292,5748},{328,-6277,5739},{395,-6261,5728},{463,-6246,5716},{532,-6231,5701},{601,-6215,5684},{671,-6199,5665},
+    {741,-6182,5644},{812,-6164,5621},{883,-6144,5596},{954,-6123,5569},{1024,-6100,5540},{1092,-6075,5509},{1159,-6048,5476},{1223,-6019,5442},
+    {1284,-5987,5406},{1342,-5954,5368},{1396,-5919,5328},{1446,-5882,5287},{1493,-5844,5245},{1535,-5804,5202},{1573,-5763,5158},{1606,-5722,5113},
+    {1637,-5679,5067},{1663,-5636,5021},{1686,-5593,4974},{1707,-5550,4926},{1724,-5506,4878}
+  },
+  {  // -28
+    {1636,-5280,4770},{1650,-5235,4722},{1662,-5190,4675},{1673,-5145,4627},{1682,-5100,4579},{1689,-5055,4531},{1696,-5009,4482},{1701,-4964,4434},
+    {1706,-4918,4385},{1709,-4872,4337},{1711,-4825,4289},{1711,-4778,4240},{1710,-4731,4192},{1707,-4683,4144},{1703,-4636,4097},{1697,-4588,4049},
+    {1689,-4541,4003},{1680,-4494,3957},{1669,-4447,3911},{1657,-4402,3866},{1645,-4358,3822},{1632,-4314,3779},{1619,-4272,3736},{1606,-4231,3694},
+    {1593,-4192,3652},{1582,-4153,3611},{1572,-4115,3570},{1564,-4077,3529},{1558,-4040,3488},{1553,-4001,3447},{1550,-3962,3406},{1548,-3922,3363},
+    {1547,-3879,3320},{1547,-3834,3276},{1545,-3785,3231},{1542,-3734,3184},{1536,-3678,3136},{1526,-3619,3087},{1512,-3557,3037},{1490,-3491,2985},
+    {1461,-3423,2933},{1422,-3352,2880},{1374,-3280,2826},{1314,-3209,2773},{1242,-3138,2719},{1158,-3071,2666},{1061,-3008,2614},{950,-2951,2564},
+    {826,-2903,2515},{689,-2865,2469},{541,-2839,2426},{382,-2826,2386},{213,-2828,2349},{37,-2847,2316},{-145,-2882,2287},{-331,-2934,2263},
+    {-518,-3003,2243},{-705,-3089,2227},{-889,-3190,2215},{-1067,-3305,2208},{-1239,-3432,2205},{-1402,-3569,2205},{-1556,-3716,2209},{-1698,-3868,2216},
+    {-1828,-4025,2225},{-1947,-4184,2237},{-2053,-4344,2250},{-2146,-4504,2265},{-2227,-4661,2281},{-2296,-4815,2297},{-2354,-4965,2314},{-2401,-5110,2330},
+    {-2439,-5250,2347},{-2467,-5384,2363},{-2487,-5513,2379},{-2499,-5635,2395},{-2504,-5752,2410},{-2502,-5862,2425},{-2494,-5967,2439},{-2480,-6066,2453},
+    {-2461,-6159,2466},{-2436,-6247,2478},{-2405,-6328,2490},{-2368,-6403,2501},{-2327,-6473,2512},{-2280,-6535,2521},{-2228,-6590,2530},{-2173,-6638,2538},
+    {-2115,-6678,2546},{-2057,-6710,2552},{-1999,-6734,2558},{-1945,-6748,2564},{-1897,-6753,2569},{-1857,-6749,2574},{-1828,-6736,2580},{-1812,-6713,2587},
+    {-1809,-6683,2595},{-1821,-6644,2605},{-1848,-6598,2619},{-1889,-6547,2635},{-1944,-6490,2656},{-2009,-6430,2682},{-2084,-6368,2713},{-2166,-6305,2750},
+    {-2252,-6243,2794},{-2340,-6184,2844},{-2427,-6129,2901},{-2512,-6079,2965},{-2592,-6036,3035},{-2666,-6000,3111},{-2733,-5971,3194},{-2792,-5951,3281},
+    {-2841,-5938,3374},{-2880,-5934,3470},{-2908,-5936,3570},{-2926,-5946,3672},{-2933,-5961,3776},{-2928,-5982,3882},{-2913,-6007,3988},{-2886,-6035,4093},
+    {-2848,-6067,4198},{-2799,-6100,4301},{-2740,-6134,4402},{-2670,-6168,4500},{-2591,-6201,4595},{-2502,-6233,4687},{-2405,-6264,4775},{-2301,-6292,4860},
+    {-2189,-6317,4939},{-2071,-6339,5015},{-1949,-6357,5086},{-1823,-6372,5152},{-1694,-6382,5214},{-1565,-6389,5271},{-1435,-6391,5324},{-1307,-6390,5371},
+    {-1180,-6385,5415},{-1057,-6377,5454},{-938,-6365,5489},{-824,-6351,5520},{-716,-6334,5547},{-612,-6315,5571},{-515,-6295,5590},{-423,-6273,5607},
+    {-337,-6251,5620},{-257,-6229,5631},{-181,-6207,5639},{-109,-6185,5644},{-42,-6164,5646},{23,-6144,5647},{85,-6124,5645},{145,-6106,5641},
+    {204,-6089,5635},{263,-6073,5627},{322,-6058,5618},{381,-6044,5606},{441,-6030,5593},{503,-6016,5578},{566,-6001,5561},{630,-5986,5542},
+    {695,-5971,5522},{761,-5953,5499},{828,-5935,5475},{895,-5914,5448},{962,-5892,5420},{1027,-5867,5390},{1091,-5840,5358},{1153,-5810,5324},
+    {1213,-5778,5288},{1269,-5744,5251},{1321,-5708,5212},{1370,-5670,5172},{1415,-5630,5131},{1456,-5589,5088},{1492,-5547,5045},{1525,-5503,5001},
+    {1553,-5459,4955},{1578,-5415,4910},{1600,-5370,4863},{1619,-5325,4817},{1636,-5280,4770}
+  },
+  {  // -26
+    {1555,-5039,4659},{1567,-4992,4612},{1579,-4946,4566},{1588,-4900,4519},{1596,-4854,4472},{1603,-4807,4425},{1609,-4761,4378},{1615,-4715,4330},
+    {1619,-4668,4283},{1622,-4621,4236},{1624,-4574,4188},{1625,-4526,4141},{1624,-4478,4094},{1622,-4430,4047},{1618,-4381,4000},{1613,-4332,3954},
+    {1606,-4284,3908},{1597,-4235,3863},{1587,-4188,3819},{1575,-4141,3775},{1563,-4095,3732},{1549,-4051,3690},{1535,-4007,3649},{1522,-3965,3608},
+    {1509,-3924,3568},{1496,-3885,3528},{1485,-3846,3489},{1476,-3808,3450},{1468,-3769,3411},{1462,-3731,3372},{1457,-3692,3333},{1454,-3651,3293},
+    {1452,-3608,3253},{1450,-3563,3211},{1447,-3514,3168},{1443,-3462,3125},{1437,-3407,3080},{1426,-3348,3034},{1411,-3285,2986},{1389,-3218,2938},
+    {1360,-3149,2888},{1322,-3077,2838},{1274,-3004,2787},{1214,-2931,2737},{1143,-2860,2686},{1058,-2791,2636},{961,-2728,2587},{850,-2671,2539},
+    {726,-2622,2493},{590,-2585,2449},{441,-2560,2408},{282,-2549,2370},{114,-2554,2335},{-63,-2576,2304},{-244,-2615,2277},{-429,-2673,2254},
+    {-616,-2749,2236},{-801,-2842,2221},{-983,-2951,2211},{-1159,-3075,2206},{-1328,-3211,2204},{-1488,-3359,2206},{-1638,-3515,2211},{-1777,-3677,2219},
+    {-1903,-3844,2230},{-2017,-4014,2243},{-2118,-4183,2258},{-2207,-4352,2274},{-2283,-4518,2292},{-2347,-4680,2310},{-2399,-4838,2328},{-2441,-4990,2347},
+    {-2473,-5137,2366},{-2496,-5277,2384},{-2510,-5411,2402},{-2516,-5538,2420},{-2515,-5659,2438},{-2507,-5774,2455},{-2493,-5882,2471},{-2473,-5985,2488},
+    {-2446,-6081,2503},{-2414,-6171,2519},{-2375,-6255,2533},{-2330,-6333,2547},{-2279,-6404,2560},{-2222,-6468,2573},{-2160,-6525,2584},{-2093,-6575,2595},
+    {-2022,-6617,2604},{-1950,-6650,2612},{-1878,-6675,2620},{-1808,-6690,2626},{-1744,-6697,2632},{-1687,-6693,2638},{-1641,-6681,2643},{-1607,-6659,2649},
+    {-1588,-6628,2656},{-1584,-6590,2665},{-1595,-6544,2676},{-1623,-6491,2690},{-1665,-6433,2708},{-1720,-6371,2730},{-1785,-6307,2757},{-1860,-6241,2790},
+    {-1940,-6176,2829},{-2024,-6113,2875},{-2109,-6053,2927},{-2192,-5999,2986},{-2272,-5950,3052},{-2347,-5908,3124},{-2415,-5874,3202},{-2475,-5847,3286},
+    {-2526,-5829,3374},{-2567,-5818,3467},{-2598,-5815,3563},{-2619,-5819,3662},{-2628,-5828,3763},{-2627,-5844,3866},{-2614,-5864,3969},{-2591,-5888,4071},
+    {-2557,-5914,4173},{-2512,-5943,4274},{-2457,-5973,4372},{-2392,-6003,4468},{-2317,-6033,4561},{-2234,-6061,4650},{-2143,-6088,4735},{-2045,-6113,4817},
+    {-1941,-6135,4894},{-1831,-6153,4966},{-1717,-6168,5034},{-1599,-6180,5097},{-1480,-6187,5156},{-1360,-6191,5209},{-1241,-6190,5258},{-1123,-6186,5303},
+    {-1007,-6178,5342},{-895,-6167,5378},{-788,-6153,5409},{-685,-6136,5436},{-587,-6116,5459},{-495,-6095,5479},{-409,-6073,5495},{-328,-6049,5508},
+    {-253,-6025,5518},{-183,-6002,5525},{-117,-5978,5529},{-56,-5955,5532},{2,-5934,5532},{56,-5913,5530},{109,-5894,5526},{161,-5876,5520},
+    {211,-5859,5513},{262,-5844,5504},{313,-5830,5493},{365,-5816,5481},{419,-5803,5467},{474,-5791,5452},{531,-5778,5435},{590,-5764,5416},
+    {651,-5749,5396},{714,-5733,5374},{777,-5715,5350},{841,-5696,5324},{905,-5673,5297},{968,-5649,5267},{1031,-5621,5236},{1091,-5591,5203},
+    {1149,-5558,5168},{1203,-5523,5132},{1255,-5486,5094},{1302,-5446,5054},{1345,-5404,5014},{1385,-5361,4972},{1420,-5317,4929},{1451,-5271,4886},
+    {1478,-5225,4841},{1502,-5179,4796},{1522,-5132,4751},{1540,-5085,4705},{1555,-5039,4659}
+  },
+  {  // -24
+    {1481,-4782,4547},{1492,-4734,4501},{1502,-4686,4456},{1510,-4638,4410},{1517,-4591,4364},{1523,-4544,4319},{1529,-4497,4273},{1533,-4450,4227},
+    {1537,-4402,4181},{1541,-4355,4135},{1543,-4306,4089},{1544,-4258,4043},{1544,-4209,3997},{1542,-4160,3951},{1539,-4110,3906},{1534,-4060,3861},
+    {1527,-4010,3816},{1519,-3961,3773},{1509,-3912,3729},{1498,-3864,3687},{1485,-3817,3645},{1472,-3771,3605},{1458,-3726,3565},{1444,-3683,3526},
+    {1430,-3641,3487},{1417,-3600,3450},{1405,-3560,3412},{1394,-3521,3375},{1385,-3482,3339},{1377,-3443,3302},{1372,-3403,3265},{1367,-3362,3228},
+    {1363,-3319,3190},{1360,-3273,3151},{1356,-3224,3111},{1351,-3172,3070},{1344,-3116,3028},{1333,-3056,2985},{1317,-2992,2941},{1295,-2925,2895},
+    {1265,-2855,2849},{1227,-2782,2802},{1178,-2708,2754},{1119,-2634,2707},{1047,-2562,2659},{963,-2492,2612},{866,-2428,2566},{755,-2370,2521},
+    {632,-2322,2477},{495,-2285,2436},{347,-2261,2397},{188,-2252,2361},{20,-2260,2329},{-155,-2286,2300},{-336,-2330,2274},{-520,-2394,2253},
+    {-705,-2476,2236},{-888,-2576,2223},{-1067,-2693,2214},{-1241,-2826,2209},{-1406,-2972,2209},{-1563,-3129,2212},{-1708,-3295,2218},{-1842,-3468,2227},
+    {-1964,-3645,2240},{-2073,-3824,2254},{-2168,-4004,2270},{-2251,-4181,2288},{-2322,-4356,2307},{-2380,-4527,2326},{-2426,-4692,2347},{-2462,-4851,2367},
+    {-2488,-5004,2388},{-2504,-5150,2408},{-2511,-5289,2428},{-2511,-5421,2448},{-2503,-5546,2468},{-2489,-5665,2488},{-2468,-5776,2507},{-2440,-5881,2526},
+    {-2406,-5980,2544},{-2366,-6072,2562},{-2319,-6157,2579},{-2266,-6237,2596},{-2206,-6309,2612},{-2140,-6374,2626},{-2067,-6433,2640},{-1990,-6483,2653},
+    {-1908,-6526,2665},{-1825,-6559,2675},{-1740,-6585,2684},{-1658,-6600,2691},{-1580,-6607,2698},{-1510,-6604,2704},{-1449,-6591,2710},{-1401,-6569,2715},
+    {-1367,-6539,2721},{-1348,-6500,2728},{-1347,-6453,2737},{-1361,-6399,2749},{-1391,-6341,2763},{-1436,-6277,2782},{-1492,-6211,2806},{-1559,-6143,2834},
+    {-1633,-6075,2869},{-1713,-6009,2910},{-1794,-5945,2957},{-1876,-5886,3012},{-1955,-5833,3072},{-2031,-5786,3140},{-2100,-5746,3213},{-2162,-5714,3292},
+    {-2216,-5690,3376},{-2260,-5674,3465},{-2295,-5666,3557},{-2319,-5664,3652},{-2333,-5669,3750},{-2335,-5679,3849},{-2327,-5695,3948},{-2309,-5714,4048},
+    {-2279,-5737,4146},{-2240,-5761,4244},{-2190,-5788,4339},{-2131,-5814,4432},{-2063,-5841,4522},{-1987,-5866,4609},{-1903,-5890,4691},{-1812,-5912,4770},
+    {-1716,-5931,4844},{-1614,-5947,4913},{-1509,-5959,4978},{-1401,-5968,5038},{-1291,-5973,5093},{-1181,-5974,5143},{-1071,-5971,5188},{-963,-5965,5229},
+    {-857,-5954,5265},{-756,-5941,5297},{-658,-5924,5324},{-565,-5905,5347},{-478,-5884,5367},{-396,-5860,5383},{-319,-5836,5395},{-248,-5811,5404},
+    {-183,-5786,5411},{-122,-5761,5415},{-66,-5736,5417},{-14,-5713,5416},{35,-5691,5413},{82,-5670,5409},{126,-5651,5403},{170,-5633,5396},
+    {213,-5618,5387},{257,-5603,5377},{301,-5590,5366},{347,-5578,5353},{395,-5566,5339},{445,-5555,5323},{498,-5544,5306},{553,-5531,5288},
+    {610,-5518,5268},{669,-5503,5247},{730,-5486,5223},{791,-5466,5198},{853,-5444,5171},{915,-5419,5142},{976,-5391,5112},{1034,-5361,5080},
+    {1091,-5327,5046},{1144,-5290,5010},{1195,-5251,4973},{1241,-5209,4934},{1283,-5165,4894},{1321,-5120,4853},{1355,-5073,4811},{1384,-5026,4769},
+    {1410,-4977,4725},{1432,-4928,4681},{1451,-4879,4637},{1467,-4831,4592},{1481,-4782,4547}
+  },
+  {  // -22
+    {1414,-4509,4433},{1423,-4459,4389},{1432,-4409,4345},{1439,-4360,4301},{1444,-4311,4257},{1450,-4263,4212},{1454,-4215,4168},{1458,-4167,4123},
+    {1461,-4119,4079},{1464,-4070,4034},{1466,-4022,3990},{1468,-3972,3946},{1468,-3923,3901},{1466,-3872,3857},{1464,-3822,3813},{1460,-3771,3770},
+    {1454,-3720,3727},{1446,-3670,3685},{1436,-3619,3643},{1425,-3570,3602},{1413,-3521,3563},{1400,-3474,3523},{1386,-3428,3485},{1371,-3383,3448},
+    {1357,-3340,3411},{1343,-3298,3375},{1330,-3257,3340},{1319,-3217,3305},{1309,-3177,3271},{1300,-3137,3237},{1293,-3097,3202},{1287,-3055,3167},
+    {1282,-3011,3132},{1277,-2965,3096},{1272,-2916,3059},{1266,-2863,3021},{1258,-2806,2982},{1246,-2745,2942},{1229,-2681,2901},{1206,-2613,2859},
+    {1176,-2541,2816},{1137,-2467,2772},{1088,-2392,2728},{1029,-2317,2683},{957,-2244,2639},{873,-2174,2595},{776,-2109,2552},{665,-2051,2509},
+    {542,-2003,2469},{406,-1967,2430},{258,-1945,2394},{100,-1938,2360},{-67,-1949,2330},{-241,-1978,2302},{-421,-2027,2279},{-603,-2096,2259},
+    {-785,-2185,2243},{-965,-2293,2231},{-1142,-2418,2223},{-1311,-2559,2219},{-1473,-2714,2219},{-1625,-2881,2223},{-1766,-3057,2230},{-1895,-3240,2240},
+    {-2011,-3427,2253},{-2114,-3616,2269},{-2204,-3805,2286},{-2281,-3991,2305},{-2345,-4175,2325},{-2396,-4353,2346},{-2436,-4526,2368},{-2465,-4692,2390},
+    {-2484,-4852,2412},{-2493,-5003,2435},{-2493,-5147,2457},{-2486,-5283,2479},{-2471,-5412,2501},{-2449,-5534,2523},{-2420,-5648,2544},{-2385,-5755,2565},
+    {-2343,-5855,2586},{-2295,-5948,2607},{-2240,-6035,2626},{-2179,-6115,2646},{-2111,-6187,2664},{-2036,-6253,2681},{-1956,-6311,2697},{-1870,-6361,2712},
+    {-1780,-6404,2726},{-1687,-6437,2738},{-1593,-6462,2748},{-1501,-6477,2757},{-1413,-6483,2765},{-1332,-6480,2771},{-1261,-6467,2777},{-1201,-6444,2782},
+    {-1156,-6413,2787},{-1126,-6373,2793},{-1112,-6326,2800},{-1115,-6271,2809},{-1134,-6211,2821},{-1168,-6147,2836},{-1216,-6079,2856},{-1274,-6009,2881},
+    {-1342,-5938,2911},{-1416,-5869,2947},{-1494,-5803,2990},{-1574,-5740,3039},{-1652,-5683,3095},{-1727,-5631,3157},{-1798,-5587,3226},{-1862,-5551,3300},
+    {-1918,-5522,3379},{-1966,-5501,3463},{-2004,-5487,3551},{-2033,-5481,3642},{-2051,-5481,3735},{-2059,-5488,3830},{-2056,-5499,3926},{-2043,-5514,4022},
+    {-2019,-5533,4117},{-1986,-5554,4211},{-1943,-5577,4303},{-1891,-5601,4393},{-1830,-5625,4480},{-1761,-5648,4563},{-1685,-5669,4643},{-1602,-5688,4718},
+    {-1514,-5705,4789},{-1421,-5719,4855},{-1324,-5730,4917},{-1225,-5736,4973},{-1124,-5739,5025},{-1023,-5738,5072},{-923,-5734,5114},{-824,-5725,5151},
+    {-728,-5713,5183},{-636,-5697,5211},{-547,-5679,5235},{-464,-5658,5255},{-385,-5635,5271},{-312,-5610,5283},{-244,-5584,5292},{-182,-5558,5298},
+    {-125,-5532,5301},{-73,-5506,5302},{-25,-5481,5301},{20,-5457,5298},{61,-5434,5293},{100,-5414,5287},{137,-5395,5279},{174,-5379,5270},
+    {211,-5364,5260},{248,-5350,5249},{287,-5339,5236},{328,-5328,5223},{371,-5318,5209},{417,-5308,5193},{465,-5298,5176},{517,-5287,5158},
+    {571,-5275,5139},{628,-5261,5118},{686,-5245,5095},{746,-5226,5070},{806,-5204,5044},{866,-5178,5016},{926,-5150,4986},{984,-5118,4955},
+    {1039,-5083,4921},{1092,-5044,4886},{1141,-5003,4850},{1186,-4959,4812},{1227,-4913,4773},{1264,-4865,4733},{1297,-4816,4692},{1325,-4765,4650},
+    {1349,-4714,4607},{1370,-4662,4564},{1387,-4611,4521},{1402,-4560,4477},{1414,-4509,4433}
+  },
+  {  // -20
+    {1353,-4219,4320},{1361,-4167,4277},{1368,-4115,4235},{1373,-4064,4192},{1378,-4014,4149},{1382,-3964,4107},{1385,-3915,4064},{1388,-3866,4021},
+    {1391,-3817,3979},{1393,-3768,3936},{1395,-3719,3893},{1396,-3669,3851},{1396,-3619,3808},{1396,-3568,3766},{1393,-3516,3724},{1390,-3465,3683},
+    {1384,-3413,3641},{1377,-3361,3601},{1368,-3310,3561},{1358,-3259,3522},{1346,-3209,3484},{1333,-3161,3447},{1319,-3113,3410},{1304,-3067,3375},
+    {1290,-3023,3340},{1276,-2979,3307},{1262,-2937,3274},{1250,-2896,3241},{1238,-2855,3209},{1229,-2814,3177},{1220,-2773,3145},{1213,-2730,3113},
+    {1207,-2686,3080},{1201,-2639,3047},{1195,-2588,3013},{1188,-2535,2978},{1178,-2477,2942},{1165,-2416,2905},{1147,-2350,2868},{1124,-2281,2829},
+    {1093,-2209,2789},{1054,-2134,2749},{1004,-2058,2708},{945,-1982,2667},{873,-1908,2626},{789,-1837,2585},{691,-1772,2545},{581,-1715,2506},
+    {458,-1667,2468},{323,-1632,2432},{176,-1611,2398},{18,-1607,2367},{-148,-1621,2338},{-320,-1654,2312},{-498,-1708,2290},{-677,-1782,2271},
+    {-857,-1877,2256},{-1034,-1992,2245},{-1207,-2125,2238},{-1372,-2275,2235},{-1530,-2439,2235},{-1677,-2615,2239},{-1812,-2800,2247},{-1935,-2993,2258},
+    {-2046,-3189,2271},{-2142,-3388,2287},{-2226,-3586,2306},{-2296,-3782,2325},{-2353,-3974,2347},{-2398,-4160,2369},{-2430,-4340,2392},{-2452,-4513,2415},
+    {-2463,-4678,2439},{-2465,-4835,2463},{-2458,-4983,2487},{-2443,-5124,2511},{-2420,-5256,2535},{-2390,-5380,2559},{-2354,-5496,2582},{-2311,-5604,2606},
+    {-2261,-5705,2629},{-2206,-5799,2652},{-2143,-5886,2674},{-2075,-5966,2695},{-2000,-6038,2716},{-1918,-6103,2735},{-1831,-6160,2754},{-1738,-6210,2771},
+    {-1642,-6251,2786},{-1543,-6283,2800},{-1443,-6307,2812},{-1345,-6321,2822},{-1250,-6326,2830},{-1162,-6321,2837},{-1083,-6307,2843},{-1016,-6284,2848},
+    {-961,-6252,2852},{-922,-6211,2857},{-898,-6162,2863},{-891,-6107,2870},{-901,-6046,2879},{-925,-5980,2891},{-964,-5910,2908},{-1014,-5838,2928},
+    {-1075,-5766,2954},{-1143,-5695,2986},{-1217,-5625,3024},{-1293,-5560,3068},{-1369,-5499,3119},{-1444,-5444,3176},{-1514,-5396,3239},{-1580,-5355,3308},
+    {-1638,-5322,3382},{-1689,-5297,3461},{-1731,-5279,3544},{-1764,-5269,3631},{-1787,-5265,3719},{-1800,-5267,3810},{-1803,-5275,3902},{-1796,-5287,3994},
+    {-1779,-5303,4085},{-1752,-5321,4176},{-1716,-5341,4264},{-1671,-5363,4350},{-1617,-5384,4434},{-1556,-5405,4514},{-1488,-5424,4590},{-1413,-5442,4662},
+    {-1333,-5457,4730},{-1249,-5469,4793},{-1161,-5478,4851},{-1070,-5484,4904},{-978,-5485,4953},{-886,-5483,4996},{-795,-5476,5035},{-705,-5466,5069},
+    {-617,-5453,5098},{-533,-5436,5122},{-453,-5416,5143},{-378,-5394,5159},{-308,-5369,5171},{-243,-5343,5180},{-183,-5316,5186},{-128,-5289,5189},
+    {-79,-5262,5189},{-34,-5235,5188},{7,-5210,5184},{45,-5186,5178},{79,-5164,5171},{112,-5144,5163},{143,-5126,5153},{174,-5110,5143},
+    {205,-5096,5132},{237,-5084,5120},{271,-5074,5107},{307,-5065,5093},{346,-5057,5078},{388,-5049,5063},{433,-5040,5046},{482,-5031,5028},
+    {534,-5020,5009},{588,-5007,4988},{645,-4991,4966},{703,-4973,4942},{762,-4951,4916},{822,-4925,4889},{880,-4896,4860},{937,-4863,4829},
+    {992,-4826,4796},{1044,-4785,4762},{1093,-4742,4726},{1137,-4695,4689},{1178,-4646,4651},{1213,-4595,4612},{1245,-4543,4571},{1272,-4489,4530},
+    {1295,-4435,4489},{1314,-4381,4447},{1330,-4326,4405},{1343,-4272,4362},{1353,-4219,4320}
+  },
+  {  // -18
+    {1298,-3913,4207},{1305,-3858,4166},{1310,-3804,4125},{1314,-3751,4084},{1317,-3699,4043},{1319,-3648,4003},{1322,-3598,3962},{1324,-3548,3921},
+    {1326,-3498,3880},{1327,-3448,3840},{1329,-3398,3799},{1330,-3348,3759},{1330,-3297,3718},{1329,-3245,3678},{1327,-3193,3638},{1324,-3141,3599},
+    {1319,-3088,3560},{1312,-3036,3521},{1304,-2983,3484},{1294,-2932,3447},{1283,-2881,3411},{1270,-2831,3376},{1256,-2782,3341},{1242,-2735,3308},
+    {1228,-2689,3276},{1213,-2644,3244},{1199,-2601,3213},{1186,-2559,3183},{1175,-2517,3153},{1164,-2475,3124},{1155,-2432,3094},{1147,-2389,3065},
+    {1139,-2343,3035},{1132,-2295,3004},{1125,-2244,2973},{1116,-2189,2942},{1105,-2131,2909},{1091,-2068,2875},{1073,-2002,2841},{1048,-1932,2806},
+    {1016,-1859,2769},{976,-1783,2732},{927,-1707,2695},{866,-1630,2657},{794,-1555,2620},{710,-1484,2582},{613,-1419,2545},{503,-1362,2509},
+    {380,-1316,2474},{245,-1282,2441},{99,-1263,2409},{-57,-1262,2380},{-221,-1279,2353},{-392,-1316,2329},{-567,-1374,2308},{-744,-1454,2291},
+    {-921,-1555,2276},{-1094,-1676,2266},{-1263,-1816,2259},{-1424,-1974,2256},{-1576,-2146,2256},{-1718,-2331,2261},{-1848,-2525,2268},{-1965,-2727,2279},
+    {-2069,-2933,2293},{-2159,-3140,2309},{-2235,-3347,2328},{-2299,-3552,2348},{-2349,-3752,2370},{-2386,-3946,2393},{-2411,-4133,2417},{-2425,-4312,2442},
+    {-2429,-4483,2467},{-2423,-4644,2492},{-2408,-4797,2518},{-2385,-4941,2544},{-2354,-5076,2569},{-2317,-5202,2595},{-2272,-5319,2621},{-2222,-5429,2646},
+    {-2165,-5530,2671},{-2102,-5624,2696},{-2033,-5710,2720},{-1958,-5789,2743},{-1877,-5860,2766},{-1791,-5924,2788},{-1699,-5980,2808},{-1602,-6028,2827},
+    {-1502,-6067,2844},{-1399,-6098,2859},{-1296,-6119,2872},{-1194,-6132,2884},{-1096,-6135,2893},{-1004,-6129,2901},{-920,-6114,2907},{-847,-6089,2911},
+    {-787,-6055,2915},{-741,-6014,2919},{-710,-5964,2923},{-694,-5907,2928},{-695,-5845,2936},{-711,-5777,2945},{-741,-5706,2958},{-783,-5633,2976},
+    {-837,-5559,2998},{-898,-5485,3025},{-966,-5413,3058},{-1038,-5345,3098},{-1111,-5281,3143},{-1184,-5223,3195},{-1254,-5172,3253},{-1320,-5128,3317},
+    {-1381,-5091,3386},{-1434,-5062,3459},{-1479,-5040,3537},{-1516,-5026,3619},{-1544,-5019,3703},{-1562,-5018,3789},{-1570,-5023,3876},{-1569,-5032,3964},
+    {-1558,-5045,4051},{-1538,-5061,4137},{-1509,-5079,4222},{-1471,-5099,4304},{-1425,-5118,4384},{-1372,-5138,4461},{-1311,-5156,4533},{-1245,-5172,4602},
+    {-1173,-5186,4667},{-1097,-5197,4726},{-1017,-5205,4781},{-935,-5209,4832},{-851,-5210,4877},{-767,-5206,4917},{-684,-5199,4952},{-602,-5188,4983},
+    {-522,-5173,5009},{-446,-5155,5030},{-374,-5134,5047},{-306,-5111,5060},{-243,-5086,5070},{-185,-5059,5076},{-133,-5031,5078},{-85,-5003,5079},
+    {-42,-4976,5076},{-4,-4949,5072},{31,-4923,5066},{62,-4900,5058},{91,-4878,5049},{117,-4858,5039},{143,-4841,5028},{169,-4827,5016},
+    {195,-4815,5004},{223,-4805,4991},{252,-4796,4977},{285,-4789,4963},{320,-4783,4948},{359,-4776,4932},{402,-4770,4916},{448,-4762,4898},
+    {498,-4752,4879},{551,-4740,4859},{606,-4725,4837},{663,-4707,4814},{722,-4685,4789},{781,-4659,4762},{839,-4629,4733},{895,-4594,4703},
+    {950,-4555,4671},{1001,-4513,4637},{1049,-4467,4602},{1093,-4417,4566},{1133,-4365,4529},{1168,-4311,4490},{1198,-4255,4451},{1224,-4198,4411},
+    {1246,-4141,4371},{1264,-4083,4330},{1278,-4025,4289},{1290,-3969,4248},{1298,-3913,4207}
+  },
+  {  // -16
+    {1249,-3589,4096},{1254,-3531,4057},{1258,-3475,4017},{1260,-3420,3979},{1262,-3366,3940},{1263,-3314,3901},{1264,-3262,3862},{1265,-3211,3824},
+    {1266,-3161,3786},{1267,-3110,3747},{1268,-3059,3709},{1268,-3008,3671},{1268,-2957,3633},{1268,-2905,3595},{1266,-2853,3557},{1263,-2800,3520},
+    {1258,-2747,3483},{1252,-2693,3447},{1245,-2640,3412},{1235,-2588,3377},{1224,-2536,3343},{1212,-2485,3310},{1199,-2435,3278},{1185,-2387,3247},
+    {1171,-2339,3217},{1156,-2294,3188},{1142,-2249,3160},{1129,-2206,3132},{1117,-2163,3104},{1106,-2120,3077},{1096,-2076,3051},{1087,-2031,3024},
+    {1078,-1985,2997},{1070,-1936,2969},{1061,-1883,2941},{1052,-1828,2913},{1040,-1769,2883},{1024,-1705,2853},{1004,-1638,2822},{979,-1567,2790},
+    {946,-1493,2757},{905,-1417,2724},{855,-1340,2690},{794,-1263,2656},{721,-1188,2621},{637,-1118,2587},{540,-1053,2553},{430,-997,2520},
+    {308,-952,2488},{173,-920,2458},{28,-903,2428},{-126,-904,2401},{-289,-925,2376},{-458,-966,2353},{-630,-1028,2333},{-804,-1113,2317},
+    {-977,-1219,2303},{-1146,-1347,2292},{-1310,-1494,2286},{-1467,-1658,2282},{-1614,-1838,2283},{-1750,-2031,2287},{-1873,-2234,2294},{-1984,-2444,2304},
+    {-2082,-2658,2318},{-2165,-2874,2334},{-2235,-3090,2353},{-2290,-3302,2373},{-2333,-3510,2396},{-2363,-3711,2419},{-2380,-3904,2444},{-2387,-4089,2470},
+    {-2383,-4265,2496},{-2369,-4431,2522},{-2346,-4588,2549},{-2315,-4735,2576},{-2277,-4872,2603},{-2231,-5000,2631},{-2180,-5118,2658},{-2122,-5228,2685},
+    {-2059,-5329,2711},{-1990,-5422,2738},{-1915,-5508,2764},{-1835,-5585,2789},{-1750,-5654,2814},{-1659,-5716,2837},{-1564,-5769,2859},{-1465,-5815,2879},
+    {-1363,-5852,2898},{-1259,-5881,2915},{-1155,-5900,2929},{-1053,-5911,2941},{-954,-5912,2952},{-860,-5904,2960},{-775,-5887,2966},{-699,-5861,2971},
+    {-635,-5825,2974},{-583,-5782,2978},{-547,-5731,2981},{-525,-5673,2984},{-518,-5609,2990},{-526,-5541,2997},{-548,-5468,3007},{-583,-5393,3021},
+    {-629,-5317,3040},{-683,-5242,3063},{-745,-5168,3092},{-812,-5097,3127},{-882,-5031,3167},{-952,-4970,3214},{-1020,-4915,3267},{-1086,-4868,3325},
+    {-1147,-4828,3389},{-1202,-4796,3457},{-1250,-4771,3530},{-1290,-4754,3606},{-1322,-4744,3685},{-1345,-4741,3766},{-1359,-4743,3849},{-1363,-4750,3932},
+    {-1358,-4761,4015},{-1345,-4775,4097},{-1322,-4791,4177},{-1292,-4809,4256},{-1253,-4827,4332},{-1207,-4845,4405},{-1154,-4863,4474},{-1095,-4878,4539},
+    {-1031,-4891,4600},{-963,-4902,4657},{-891,-4909,4709},{-817,-4913,4756},{-741,-4913,4798},{-664,-4909,4835},{-588,-4901,4867},{-514,-4889,4895},
+    {-442,-4874,4917},{-373,-4855,4936},{-308,-4833,4950},{-247,-4809,4960},{-190,-4783,4967},{-139,-4756,4970},{-93,-4728,4970},{-51,-4700,4968},
+    {-14,-4672,4963},{19,-4645,4956},{47,-4620,4948},{73,-4596,4938},{96,-4575,4928},{118,-4557,4916},{139,-4541,4904},{160,-4528,4891},
+    {182,-4518,4878},{206,-4510,4864},{232,-4503,4850},{261,-4498,4835},{294,-4494,4820},{330,-4490,4804},{371,-4485,4787},{415,-4479,4770},
+    {463,-4471,4751},{515,-4460,4731},{570,-4446,4710},{626,-4428,4687},{684,-4406,4662},{742,-4379,4636},{800,-4347,4608},{857,-4311,4578},
+    {911,-4271,4547},{963,-4226,4514},{1010,-4177,4479},{1054,-4124,4444},{1093,-4069,4407},{1127,-4011,4370},{1157,-3952,4332},{1182,-3891,4293},
+    {1203,-3830,4254},{1219,-3769,4214},{1232,-3708,4175},{1242,-3648,4135},{1249,-3589,4096}
+  },
+  {  // -14
+    {1205,-3249,3988},{1209,-3188,3950},{1211,-3129,3913},{1212,-3072,3876},{1212,-3017,3840},{1212,-2962,3803},{1211,-2909,3767},{1211,-2857,3731},
+    {1211,-2806,3695},{1211,-2755,3659},{1212,-2703,3623},{1212,-2652,3587},{1212,-2600,3552},{1211,-2548,3517},{1209,-2495,3482},{1206,-2442,3447},
+    {1202,-2388,3413},{1197,-2335,3379},{1189,-2281,3346},{1181,-2228,3314},{1170,-2175,3283},{1159,-2123,3252},{1146,-2073,3223},{1133,-2023,3194},
+    {1119,-1975,3166},{1105,-1929,3140},{1091,-1883,3114},{1077,-1838,3088},{1065,-1794,3063},{1053,-1750,3039},{1042,-1705,3015},{1033,-1660,2991},
+    {1023,-1612,2967},{1014,-1562,2942},{1004,-1509,2917},{993,-1452,2892},{980,-1392,2866},{963,-1328,2839},{942,-1260,2811},{916,-1189,2782},
+    {882,-1114,2753},{840,-1038,2723},{789,-961,2693},{727,-884,2662},{654,-810,2631},{569,-740,2600},{472,-677,2570},{362,-622,2540},
+    {241,-579,2510},{107,-549,2482},{-37,-534,2455},{-190,-538,2430},{-350,-562,2406},{-517,-607,2385},{-686,-673,2366},{-857,-762,2349},
+    {-1026,-874,2336},{-1191,-1006,2325},{-1350,-1159,2318},{-1502,-1330,2314},{-1643,-1516,2314},{-1773,-1716,2317},{-1891,-1927,2324},{-1995,-2144,2334},
+    {-2085,-2366,2346},{-2162,-2590,2362},{-2224,-2813,2380},{-2273,-3032,2401},{-2308,-3247,2423},{-2330,-3455,2447},{-2340,-3654,2472},{-2339,-3845,2498},
+    {-2327,-4025,2525},{-2305,-4195,2552},{-2275,-4355,2580},{-2236,-4504,2608},{-2191,-4643,2636},{-2138,-4772,2665},{-2080,-4891,2693},{-2016,-5001,2722},
+    {-1946,-5102,2750},{-1872,-5193,2778},{-1793,-5277,2805},{-1709,-5352,2832},{-1621,-5419,2858},{-1528,-5478,2882},{-1431,-5529,2906},{-1332,-5572,2927},
+    {-1230,-5606,2947},{-1127,-5632,2965},{-1024,-5649,2981},{-922,-5657,2994},{-824,-5656,3005},{-732,-5646,3014},{-646,-5627,3020},{-569,-5599,3025},
+    {-503,-5563,3029},{-449,-5518,3031},{-409,-5465,3034},{-382,-5406,3036},{-369,-5341,3040},{-370,-5271,3045},{-385,-5197,3053},{-412,-5121,3065},
+    {-451,-5043,3080},{-499,-4966,3100},{-554,-4890,3124},{-615,-4817,3155},{-680,-4748,3191},{-747,-4685,3233},{-813,-4628,3281},{-877,-4577,3334},
+    {-938,-4535,3392},{-994,-4500,3455},{-1044,-4472,3523},{-1087,-4453,3594},{-1122,-4440,3667},{-1149,-4434,3743},{-1168,-4434,3821},{-1177,-4439,3899},
+    {-1178,-4448,3977},{-1171,-4461,4055},{-1155,-4476,4131},{-1131,-4493,4206},{-1099,-4511,4278},{-1060,-4528,4346},{-1014,-4545,4412},{-963,-4560,4474},
+    {-906,-4573,4531},{-845,-4583,4585},{-781,-4590,4633},{-714,-4594,4677},{-645,-4593,4716},{-576,-4589,4751},{-507,-4581,4780},{-439,-4569,4805},
+    {-374,-4553,4825},{-312,-4534,4840},{-253,-4512,4852},{-198,-4488,4860},{-148,-4461,4864},{-102,-4434,4864},{-61,-4405,4862},{-25,-4377,4858},
+    {6,-4349,4851},{34,-4323,4842},{57,-4298,4832},{78,-4276,4821},{97,-4256,4809},{114,-4239,4796},{131,-4225,4782},{148,-4213,4768},
+    {166,-4205,4754},{187,-4199,4740},{210,-4195,4725},{236,-4192,4710},{266,-4190,4694},{301,-4188,4678},{340,-4185,4662},{383,-4181,4644},
+    {430,-4175,4625},{481,-4165,4606},{534,-4152,4584},{591,-4134,4562},{648,-4112,4537},{707,-4084,4511},{765,-4052,4484},{821,-4014,4455},
+    {876,-3972,4424},{927,-3924,4392},{974,-3872,4358},{1018,-3817,4324},{1057,-3758,4288},{1091,-3697,4251},{1120,-3633,4214},{1144,-3569,4177},
+    {1164,-3504,4139},{1179,-3439,4101},{1191,-3374,4063},{1199,-3311,4025},{1205,-3249,3988}
+  },
+  {  // -12
+    {1166,-2893,3884},{1168,-2829,3848},{1169,-2768,3813},{1168,-2708,3779},{1167,-2650,3744},{1166,-2595,3710},{1164,-2540,3676},{1163,-2487,3643},
+    {1162,-2435,3609},{1161,-2383,3576},{1161,-2331,3543},{1160,-2279,3510},{1160,-2227,3477},{1159,-2175,3445},{1157,-2122,3412},{1154,-2069,3380},
+    {1151,-2015,3349},{1145,-1961,3318},{1139,-1907,3288},{1131,-1854,3258},{1121,-1800,3229},{1110,-1748,3202},{1098,-1697,3175},{1085,-1647,3149},
+    {1072,-1598,3123},{1058,-1551,3099},{1044,-1504,3076},{1031,-1459,3053},{1018,-1413,3031},{1006,-1368,3009},{995,-1322,2988},{985,-1276,2967},
+    {975,-1227,2945},{964,-1176,2924},{954,-1122,2902},{941,-1065,2879},{927,-1004,2857},{909,-939,2833},{886,-871,2808},{858,-800,2783},
+    {823,-725,2758},{780,-649,2731},{728,-572,2704},{666,-497,2677},{592,-423,2650},{507,-355,2622},{410,-293,2594},{300,-240,2567},
+    {179,-199,2541},{47,-171,2515},{-96,-160,2490},{-248,-167,2466},{-406,-193,2444},{-570,-241,2423},{-737,-312,2405},{-904,-405,2389},
+    {-1069,-520,2375},{-1229,-657,2364},{-1384,-815,2356},{-1530,-991,2352},{-1665,-1183,2350},{-1789,-1389,2352},{-1900,-1605,2358},{-1998,-1829,2366},
+    {-2082,-2058,2378},{-2151,-2288,2393},{-2206,-2518,2410},{-2248,-2744,2430},{-2275,-2964,2452},{-2290,-3178,2476},{-2292,-3383,2501},{-2283,-3578,2527},
+    {-2264,-3762,2554},{-2235,-3936,2582},{-2197,-4098,2610},{-2151,-4250,2639},{-2099,-4390,2668},{-2040,-4519,2697},{-1975,-4638,2727},{-1906,-4747,2756},
+    {-1831,-4847,2785},{-1753,-4937,2814},{-1670,-5018,2843},{-1584,-5091,2871},{-1493,-5155,2897},{-1400,-5212,2923},{-1303,-5260,2948},{-1205,-5299,2970},
+    {-1104,-5331,2991},{-1003,-5353,3010},{-903,-5368,3027},{-804,-5373,3041},{-708,-5370,3052},{-618,-5357,3062},{-534,-5336,3069},{-458,-5306,3074},
+    {-391,-5268,3078},{-336,-5222,3080},{-293,-5168,3082},{-262,-5107,3084},{-245,-5041,3086},{-241,-4969,3090},{-249,-4894,3096},{-270,-4816,3105},
+    {-301,-4737,3117},{-342,-4658,3134},{-391,-4580,3155},{-447,-4505,3182},{-506,-4434,3214},{-569,-4369,3251},{-632,-4309,3294},{-694,-4256,3342},
+    {-754,-4211,3396},{-810,-4174,3453},{-861,-4144,3516},{-905,-4122,3581},{-943,-4107,3650},{-974,-4099,3721},{-997,-4097,3793},{-1011,-4101,3866},
+    {-1017,-4109,3940},{-1015,-4120,4013},{-1005,-4135,4084},{-987,-4151,4155},{-962,-4168,4222},{-930,-4185,4287},{-891,-4202,4349},{-846,-4217,4407},
+    {-796,-4230,4462},{-742,-4240,4512},{-684,-4248,4557},{-624,-4251,4598},{-562,-4251,4634},{-500,-4247,4666},{-437,-4239,4692},{-376,-4227,4715},
+    {-317,-4211,4732},{-261,-4192,4745},{-208,-4170,4755},{-158,-4145,4760},{-114,-4119,4762},{-74,-4091,4761},{-38,-4063,4757},{-7,-4035,4750},
+    {20,-4008,4742},{42,-3982,4731},{62,-3958,4720},{78,-3937,4707},{93,-3918,4693},{106,-3903,4679},{119,-3891,4665},{133,-3882,4650},
+    {148,-3875,4635},{165,-3872,4620},{186,-3870,4604},{210,-3870,4589},{238,-3870,4573},{271,-3871,4557},{308,-3871,4540},{350,-3868,4522},
+    {397,-3864,4503},{447,-3855,4484},{500,-3843,4463},{556,-3826,4440},{614,-3803,4416},{673,-3775,4390},{731,-3742,4363},{788,-3702,4335},
+    {842,-3658,4304},{894,-3608,4273},{942,-3553,4240},{985,-3494,4206},{1024,-3432,4172},{1057,-3367,4136},{1086,-3299,4100},{1110,-3231,4064},
+    {1129,-3162,4028},{1143,-3093,3991},{1154,-3025,3955},{1161,-2958,3919},{1166,-2893,3884}
+  },
+  {  // -10
+    {1131,-2522,3785},{1132,-2455,3752},{1132,-2391,3719},{1130,-2329,3687},{1128,-2269,3655},{1125,-2212,3623},{1122,-2156,3592},{1120,-2102,3561},
+    {1118,-2048,3530},{1116,-1996,3500},{1115,-1944,3470},{1114,-1892,3439},{1113,-1840,3409},{1112,-1788,3380},{1110,-1735,3350},{1107,-1682,3321},
+    {1104,-1628,3293},{1099,-1574,3264},{1093,-1520,3237},{1085,-1467,3210},{1076,-1413,3184},{1066,-1361,3159},{1055,-1309,3135},{1042,-1259,3112},
+    {1029,-1210,3089},{1016,-1162,3068},{1003,-1115,3047},{990,-1068,3027},{977,-1022,3008},{965,-976,2989},{954,-930,2970},{943,-882,2952},
+    {932,-833,2933},{921,-781,2915},{909,-726,2896},{895,-668,2877},{879,-607,2857},{860,-542,2836},{836,-474,2815},{807,-403,2794},
+    {770,-329,2771},{726,-254,2748},{673,-178,2725},{609,-103,2701},{535,-32,2677},{450,35,2652},{352,95,2628},{243,145,2603},
+    {122,184,2579},{-9,209,2555},{-151,217,2532},{-301,208,2510},{-457,178,2489},{-618,127,2469},{-781,53,2451},{-945,-43,2435},
+    {-1106,-162,2421},{-1262,-303,2409},{-1411,-464,2400},{-1551,-644,2395},{-1681,-841,2392},{-1799,-1051,2392},{-1903,-1272,2396},{-1994,-1501,2403},
+    {-2071,-1735,2414},{-2134,-1971,2427},{-2182,-2205,2443},{-2216,-2437,2462},{-2236,-2662,2483},{-2243,-2881,2506},{-2239,-3090,2530},{-2222,-3289,2556},
+    {-2196,-3477,2583},{-2160,-3653,2611},{-2115,-3818,2640},{-2063,-3970,2669},{-2004,-4111,2698},{-1939,-4241,2728},{-1869,-4359,2758},{-1795,-4467,2788},
+    {-1717,-4565,2818},{-1635,-4653,2848},{-1550,-4732,2877},{-1461,-4801,2905},{-1370,-4863,2933},{-1277,-4916,2959},{-1182,-4960,2984},{-1085,-4997,3008},
+    {-987,-5025,3030},{-889,-5044,3049},{-792,-5055,3066},{-697,-5058,3081},{-605,-5052,3094},{-518,-5037,3104},{-436,-5014,3111},{-362,-4982,3117},
+    {-297,-4942,3121},{-241,-4894,3123},{-197,-4839,3125},{-164,-4777,3126},{-142,-4710,3128},{-134,-4637,3130},{-137,-4560,3135},{-151,-4481,3142},
+    {-176,-4400,3152},{-211,-4320,3166},{-254,-4240,3185},{-303,-4164,3208},{-358,-4091,3236},{-415,-4023,3269},{-475,-3961,3308},{-535,-3906,3351},
+    {-593,-3859,3399},{-648,-3819,3452},{-699,-3787,3509},{-745,-3763,3570},{-785,-3746,3633},{-818,-3737,3699},{-844,-3733,3766},{-863,-3736,3834},
+    {-874,-3743,3903},{-877,-3754,3971},{-872,-3767,4038},{-860,-3783,4104},{-840,-3800,4168},{-814,-3818,4229},{-781,-3834,4287},{-743,-3850,4341},
+    {-699,-3863,4392},{-652,-3874,4439},{-600,-3881,4481},{-546,-3886,4519},{-491,-3886,4553},{-434,-3882,4582},{-378,-3874,4606},{-323,-3862,4626},
+    {-269,-3847,4641},{-219,-3828,4652},{-171,-3806,4660},{-127,-3782,4663},{-88,-3756,4663},{-52,-3729,4660},{-22,-3701,4655},{5,-3673,4647},
+    {27,-3647,4637},{46,-3622,4625},{61,-3599,4612},{73,-3579,4598},{84,-3563,4583},{94,-3549,4568},{104,-3539,4553},{115,-3532,4537},
+    {127,-3528,4521},{142,-3527,4505},{160,-3529,4489},{182,-3531,4473},{209,-3535,4457},{240,-3538,4440},{277,-3540,4423},{318,-3540,4405},
+    {364,-3537,4386},{414,-3530,4366},{467,-3518,4345},{523,-3502,4323},{581,-3479,4299},{640,-3451,4274},{698,-3416,4247},{756,-3376,4219},
+    {811,-3329,4189},{862,-3276,4158},{911,-3219,4126},{954,-3157,4093},{993,-3091,4059},{1027,-3022,4025},{1055,-2951,3991},{1079,-2878,3956},
+    {1097,-2806,3921},{1111,-2733,3887},{1121,-2661,3852},{1128,-2590,3818},{1131,-2522,3785}
+  },
+  {  // -8
+    {1100,-2138,3692},{1100,-2068,3662},{1099,-2001,3631},{1096,-1937,3602},{1093,-1875,3572},{1089,-1816,3543},{1085,-1759,3515},{1082,-1703,3487},
+    {1079,-1649,3459},{1076,-1596,3431},{1074,-1544,3404},{1073,-1492,3376},{1071,-1440,3349},{1069,-1388,3323},{1067,-1335,3296},{1065,-1282,3270},
+    {1061,-1229,3244},{1057,-1176,3219},{1051,-1122,3195},{1044,-1069,3171},{1036,-1016,3148},{1026,-964,3126},{1016,-913,3104},{1004,-862,3084},
+    {992,-813,3064},{979,-764,3046},{966,-717,3028},{954,-670,3010},{941,-624,2994},{929,-577,2978},{917,-530,2962},{906,-482,2946},
+    {894,-431,2931},{882,-379,2915},{869,-324,2899},{855,-266,2883},{837,-205,2867},{817,-140,2850},{791,-72,2832},{760,-1,2813},
+    {722,71,2794},{677,145,2775},{622,220,2755},{558,292,2734},{483,362,2713},{397,426,2691},{299,483,2669},{190,531,2647},
+    {70,567,2626},{-61,588,2604},{-201,594,2582},{-349,581,2561},{-503,548,2541},{-661,494,2522},{-821,418,2504},{-981,319,2488},
+    {-1137,198,2473},{-1289,54,2460},{-1433,-109,2450},{-1567,-292,2443},{-1691,-491,2439},{-1803,-704,2437},{-1901,-929,2439},{-1985,-1161,2445},
+    {-2055,-1399,2453},{-2111,-1638,2464},{-2152,-1877,2479},{-2179,-2112,2496},{-2192,-2342,2516},{-2192,-2564,2538},{-2180,-2776,2561},{-2157,-2978,2586},
+    {-2124,-3169,2613},{-2081,-3347,2640},{-2030,-3513,2669},{-1972,-3666,2698},{-1908,-3807,2727},{-1838,-3936,2757},{-1764,-4054,2787},{-1686,-4160,2817},
+    {-1604,-4255,2848},{-1520,-4341,2877},{-1433,-4417,2907},{-1344,-4484,2936},{-1254,-4542,2964},{-1161,-4591,2991},{-1068,-4632,3016},{-974,-4665,3040},
+    {-879,-4689,3062},{-785,-4706,3083},{-692,-4714,3100},{-601,-4713,3116},{-514,-4705,3129},{-430,-4688,3139},{-352,-4662,3147},{-281,-4628,3153},
+    {-217,-4587,3158},{-162,-4537,3160},{-117,-4481,3162},{-82,-4418,3163},{-58,-4349,3165},{-46,-4275,3167},{-44,-4197,3170},{-54,-4117,3176},
+    {-73,-4035,3185},{-102,-3953,3197},{-139,-3872,3212},{-183,-3793,3233},{-232,-3719,3257},{-285,-3649,3287},{-340,-3585,3322},{-397,-3529,3361},
+    {-453,-3479,3405},{-507,-3437,3453},{-557,-3403,3505},{-604,-3378,3560},{-645,-3359,3619},{-681,-3348,3679},{-710,-3343,3742},{-732,-3345,3805},
+    {-746,-3351,3868},{-754,-3361,3932},{-754,-3375,3995},{-747,-3391,4056},{-733,-3408,4115},{-712,-3425,4172},{-685,-3442,4227},{-652,-3458,4277},
+    {-614,-3472,4325},{-573,-3484,4368},{-527,-3492,4408},{-479,-3497,4443},{-429,-3497,4474},{-379,-3494,4500},{-328,-3487,4522},{-278,-3476,4540},
+    {-230,-3461,4554},{-184,-3442,4563},{-142,-3421,4568},{-103,-3397,4570},{-68,-3372,4569},{-37,-3345,4565},{-11,-3318,4558},{11,-3291,4549},
+    {29,-3266,4537},{44,-3242,4525},{55,-3221,4511},{64,-3203,4496},{72,-3188,4480},{79,-3177,4464},{86,-3169,4448},{94,-3165,4431},
+    {104,-3164,4415},{116,-3166,4398},{133,-3170,4381},{153,-3176,4365},{179,-3182,4348},{209,-3188,4330},{244,-3193,4313},{285,-3195,4294},
+    {331,-3194,4275},{380,-3189,4255},{434,-3179,4234},{490,-3163,4211},{549,-3140,4188},{608,-3112,4162},{667,-3076,4136},{724,-3034,4108},
+    {780,-2985,4079},{832,-2930,4049},{881,-2870,4017},{925,-2805,3985},{964,-2736,3953},{998,-2663,3920},{1027,-2588,3887},{1050,-2512,3854},
+    {1068,-2435,3821},{1082,-2359,3788},{1092,-2283,3756},{1097,-2209,3724},{1100,-2138,3692}
+  },
+  {  // -6
+    {1073,-1742,3608},{1072,-1670,3579},{1070,-1600,3552},{1066,-1534,3524},{1062,-1470,3498},{1057,-1409,3472},{1053,-1351,3446},{1048,-1295,3420},
+    {1044,-1240,3395},{1041,-1187,3371},{1038,-1134,3346},{1036,-1082,3322},{1034,-1030,3298},{1032,-979,3274},{1030,-927,3251},{1027,-874,3228},
+    {1024,-822,3205},{1020,-769,3183},{1015,-716,3162},{1008,-664,3141},{1000,-612,3121},{992,-560,3102},{982,-509,3083},{971,-459,3066},
+    {959,-410,3049},{947,-362,3033},{935,-314,3018},{923,-267,3004},{910,-220,2990},{898,-173,2977},{886,-126,2964},{874,-77,2951},
+    {862,-27,2938},{849,26,2926},{835,81,2913},{819,139,2900},{800,200,2887},{778,264,2873},{751,331,2858},{718,401,2843},
+    {679,472,2827},{632,544,2811},{576,616,2794},{510,686,2776},{435,753,2758},{348,814,2739},{250,868,2720},{141,913,2700},
+    {21,945,2680},{-109,964,2660},{-247,966,2640},{-393,951,2620},{-545,915,2601},{-700,859,2582},{-857,780,2564},{-1012,680,2547},
+    {-1164,557,2531},{-1311,412,2518},{-1449,247,2506},{-1578,63,2497},{-1696,-137,2491},{-1801,-352,2487},{-1893,-578,2487},{-1971,-812,2490},
+    {-2034,-1051,2496},{-2083,-1293,2506},{-2117,-1534,2518},{-2137,-1772,2533},{-2144,-2004,2551},{-2137,-2228,2571},{-2119,-2443,2593},{-2090,-2647,2618},
+    {-2050,-2839,2643},{-2002,-3018,2670},{-1945,-3184,2698},{-1882,-3338,2726},{-1813,-3478,2755},{-1739,-3606,2785},{-1661,-3722,2815},{-1579,-3826,2845},
+    {-1496,-3919,2875},{-1410,-4002,2904},{-1322,-4075,2934},{-1233,-4138,2963},{-1144,-4192,2991},{-1053,-4238,3018},{-962,-4275,3044},{-871,-4304,3068},
+    {-780,-4325,3090},{-691,-4338,3111},{-602,-4343,3129},{-516,-4339,3145},{-433,-4328,3158},{-353,-4309,3170},{-279,-4281,3178},{-211,-4245,3185},
+    {-149,-4202,3190},{-96,-4151,3193},{-51,-4094,3195},{-15,-4029,3196},{10,-3959,3198},{26,-3885,3200},{31,-3806,3203},{26,-3725,3208},
+    {11,-3642,3215},{-12,-3558,3225},{-43,-3476,3239},{-82,-3397,3257},{-126,-3320,3279},{-174,-3249,3306},{-226,-3184,3337},{-279,-3125,3372},
+    {-332,-3074,3412},{-384,-3030,3456},{-434,-2995,3503},{-481,-2967,3554},{-523,-2947,3608},{-560,-2935,3663},{-591,-2929,3721},{-615,-2929,3779},
+    {-634,-2935,3838},{-645,-2945,3897},{-649,-2958,3955},{-646,-2974,4012},{-637,-2991,4067},{-621,-3009,4120},{-599,-3027,4170},{-572,-3044,4218},
+    {-540,-3058,4262},{-503,-3070,4302},{-463,-3079,4339},{-421,-3085,4371},{-376,-3087,4400},{-331,-3084,4424},{-285,-3078,4444},{-241,-3067,4460},
+    {-198,-3053,4471},{-157,-3035,4479},{-119,-3015,4483},{-85,-2991,4484},{-54,-2967,4482},{-28,-2941,4476},{-6,-2915,4468},{12,-2890,4458},
+    {27,-2866,4446},{38,-2843,4432},{46,-2824,4418},{52,-2808,4402},{56,-2795,4385},{60,-2786,4369},{65,-2781,4351},{70,-2780,4334},
+    {78,-2782,4317},{89,-2788,4299},{104,-2795,4282},{123,-2804,4264},{147,-2813,4247},{177,-2822,4229},{212,-2830,4210},{252,-2834,4191},
+    {297,-2836,4172},{347,-2832,4151},{401,-2823,4129},{457,-2808,4107},{516,-2786,4083},{576,-2757,4058},{635,-2721,4031},{694,-2678,4004},
+    {750,-2627,3975},{803,-2571,3946},{852,-2508,3915},{897,-2440,3884},{937,-2367,3853},{971,-2292,3822},{1000,-2213,3790},{1023,-2134,3758},
+    {1042,-2053,3727},{1055,-1973,3697},{1065,-1894,3666},{1070,-1817,3637},{1073,-1742,3608}
+  },
+  {  // -4
+    {1048,-1338,3532},{1047,-1263,3506},{1045,-1191,3481},{1040,-1123,3456},{1036,-1058,3432},{1030,-995,3409},{1025,-936,3386},{1020,-879,3363},
+    {1015,-823,3341},{1011,-770,3319},{1008,-717,3298},{1005,-665,3277},{1002,-614,3256},{1000,-563,3235},{998,-512,3215},{995,-460,3195},
+    {992,-409,3175},{988,-357,3156},{983,-305,3138},{977,-254,3120},{970,-203,3103},{962,-152,3087},{952,-102,3072},{942,-53,3057},
+    {932,-4,3044},{920,44,3031},{909,91,3018},{897,138,3007},{885,184,2996},{873,231,2986},{860,279,2976},{848,328,2966},
+    {835,378,2956},{821,431,2947},{806,486,2937},{789,543,2927},{768,604,2917},{744,667,2906},{716,733,2894},{681,800,2882},
+    {640,870,2870},{591,940,2856},{534,1009,2842},{467,1076,2827},{390,1140,2811},{302,1198,2795},{204,1248,2778},{95,1289,2761},
+    {-24,1318,2743},{-153,1333,2724},{-290,1332,2705},{-434,1314,2686},{-583,1276,2667},{-735,1218,2648},{-888,1138,2630},{-1040,1036,2613},
+    {-1187,912,2596},{-1328,767,2581},{-1462,602,2568},{-1585,419,2557},{-1697,219,2549},{-1796,4,2543},{-1881,-221,2540},{-1953,-456,2540},
+    {-2009,-695,2544},{-2051,-937,2551},{-2079,-1179,2561},{-2093,-1418,2574},{-2093,-1650,2589},{-2080,-1876,2607},{-2056,-2091,2628},{-2021,-2295,2650},
+    {-1975,-2488,2674},{-1922,-2667,2700},{-1860,-2833,2727},{-1792,-2986,2754},{-1719,-3125,2783},{-1642,-3252,2811},{-1561,-3365,2841},{-1477,-3467,2870},
+    {-1392,-3557,2900},{-1305,-3636,2929},{-1218,-3706,2958},{-1129,-3765,2987},{-1041,-3816,3015},{-953,-3857,3042},{-865,-3891,3067},{-777,-3916,3091},
+    {-690,-3933,3114},{-605,-3942,3135},{-521,-3944,3153},{-440,-3938,3169},{-361,-3924,3184},{-286,-3902,3195},{-216,-3872,3205},{-151,-3835,3212},
+    {-92,-3790,3217},{-40,-3738,3221},{4,-3679,3224},{39,-3614,3226},{66,-3543,3228},{84,-3468,3230},{92,-3388,3233},{91,-3306,3238},
+    {81,-3223,3244},{62,-3139,3254},{35,-3056,3266},{2,-2975,3283},{-37,-2898,3302},{-81,-2825,3326},{-128,-2758,3354},{-178,-2698,3387},
+    {-228,-2645,3423},{-279,-2600,3463},{-327,-2563,3506},{-373,-2534,3552},{-415,-2513,3601},{-453,-2499,3652},{-486,-2492,3705},{-513,-2492,3759},
+    {-534,-2497,3813},{-548,-2506,3867},{-556,-2520,3920},{-557,-2536,3973},{-552,-2553,4024},{-541,-2572,4073},{-524,-2590,4120},{-501,-2607,4164},
+    {-474,-2622,4204},{-442,-2635,4242},{-407,-2645,4276},{-370,-2652,4306},{-330,-2654,4332},{-290,-2653,4354},{-249,-2647,4372},{-210,-2637,4386},
+    {-171,-2624,4397},{-135,-2607,4403},{-102,-2588,4406},{-72,-2566,4406},{-46,-2542,4403},{-23,-2517,4396},{-5,-2493,4388},{9,-2469,4377},
+    {20,-2446,4364},{28,-2426,4350},{33,-2409,4335},{36,-2395,4318},{38,-2385,4301},{39,-2379,4283},{41,-2377,4265},{44,-2379,4247},
+    {50,-2384,4229},{60,-2393,4210},{73,-2404,4192},{91,-2416,4174},{114,-2429,4155},{143,-2441,4136},{178,-2451,4117},{218,-2458,4097},
+    {263,-2462,4077},{313,-2460,4056},{367,-2453,4033},{424,-2439,4010},{483,-2417,3986},{543,-2389,3961},{603,-2352,3935},{663,-2308,3907},
+    {720,-2256,3879},{774,-2198,3850},{824,-2133,3821},{869,-2063,3791},{909,-1987,3761},{944,-1909,3731},{974,-1827,3701},{998,-1744,3671},
+    {1017,-1661,3642},{1031,-1578,3614},{1040,-1496,3586},{1046,-1416,3558},{1048,-1338,3532}
+  },
+  {  // -2
+    {1025,-928,3465},{1025,-851,3441},{1022,-777,3419},{1018,-707,3397},{1013,-640,3376},{1007,-577,3355},{1001,-516,3335},{996,-458,3316},
+    {990,-403,3296},{986,-349,3278},{982,-297,3259},{979,-245,3241},{976,-195,3223},{973,-144,3205},{970,-94,3188},{968,-44,3171},
+    {964,7,3155},{961,57,3139},{956,107,3124},{950,157,3110},{944,207,3096},{936,256,3083},{928,305,3070},{919,354,3059},
+    {909,401,3048},{898,448,3038},{887,495,3029},{876,541,3020},{864,587,3012},{852,634,3005},{839,682,2998},{827,730,2991},
+    {813,780,2985},{798,832,2978},{782,887,2971},{763,944,2964},{741,1003,2957},{715,1065,2949},{684,1129,2941},{648,1195,2931},
+    {605,1262,2922},{554,1329,2911},{495,1395,2899},{427,1459,2887},{349,1518,2874},{260,1573,2860},{162,1619,2845},{53,1656,2829},
+    {-66,1682,2813},{-194,1693,2795},{-330,1689,2777},{-472,1668,2759},{-618,1628,2740},{-767,1568,2721},{-916,1488,2703},{-1063,1385,2684},
+    {-1206,1262,2667},{-1343,1118,2651},{-1470,954,2636},{-1588,772,2623},{-1694,574,2612},{-1787,362,2603},{-1866,138,2598},{-1931,-94,2596},
+    {-1981,-332,2596},{-2017,-573,2600},{-2038,-813,2607},{-2046,-1051,2618},{-2040,-1283,2631},{-2022,-1507,2647},{-1992,-1722,2665},{-1951,-1926,2685},
+    {-1901,-2117,2708},{-1843,-2296,2731},{-1777,-2461,2757},{-1705,-2612,2783},{-1629,-2749,2810},{-1549,-2873,2838},{-1465,-2984,2866},{-1380,-3083,2895},
+    {-1294,-3170,2924},{-1207,-3245,2952},{-1120,-3311,2981},{-1033,-3366,3009},{-946,-3413,3036},{-860,-3450,3063},{-775,-3480,3088},{-691,-3501,3112},
+    {-608,-3514,3135},{-527,-3520,3156},{-448,-3518,3174},{-371,-3509,3191},{-297,-3492,3205},{-227,-3468,3218},{-160,-3436,3228},{-99,-3397,3236},
+    {-43,-3351,3242},{7,-3298,3247},{50,-3238,3251},{85,-3173,3253},{112,-3102,3256},{131,-3026,3259},{142,-2946,3262},{143,-2864,3267},
+    {137,-2780,3274},{122,-2696,3283},{100,-2612,3295},{72,-2531,3309},{37,-2453,3328},{-3,-2380,3350},{-46,-2312,3375},{-92,-2250,3405},
+    {-140,-2196,3438},{-188,-2150,3474},{-234,-2112,3514},{-279,-2081,3556},{-322,-2059,3601},{-360,-2044,3648},{-394,-2036,3696},{-422,-2035,3745},
+    {-445,-2039,3795},{-462,-2049,3844},{-473,-2062,3894},{-478,-2077,3942},{-477,-2095,3989},{-470,-2114,4034},{-457,-2133,4077},{-438,-2151,4117},
+    {-416,-2167,4155},{-389,-2181,4190},{-358,-2191,4221},{-326,-2199,4248},{-291,-2202,4272},{-255,-2202,4293},{-219,-2197,4309},{-184,-2188,4322},
+    {-150,-2176,4331},{-118,-2160,4337},{-89,-2142,4339},{-64,-2121,4338},{-41,-2099,4334},{-23,-2075,4327},{-8,-2052,4318},{3,-2030,4307},
+    {10,-2010,4294},{15,-1992,4279},{17,-1977,4263},{17,-1966,4246},{16,-1958,4228},{15,-1955,4210},{15,-1957,4191},{17,-1962,4172},
+    {21,-1971,4152},{29,-1983,4133},{41,-1997,4114},{58,-2013,4094},{80,-2029,4074},{109,-2044,4054},{143,-2057,4034},{183,-2067,4013},
+    {228,-2073,3992},{278,-2074,3970},{332,-2068,3947},{389,-2055,3923},{449,-2035,3899},{510,-2007,3873},{571,-1970,3847},{631,-1926,3820},
+    {689,-1873,3792},{743,-1813,3764},{794,-1747,3736},{841,-1675,3707},{882,-1597,3678},{918,-1516,3649},{949,-1433,3621},{973,-1347,3593},
+    {993,-1261,3566},{1007,-1175,3540},{1017,-1090,3514},{1023,-1008,3489},{1025,-928,3465}
+  },
+  {  // +0
+    {1005,-515,3408},{1005,-437,3387},{1003,-361,3367},{999,-290,3348},{993,-222,3330},{987,-158,3312},{981,-96,3294},{976,-38,3278},
+    {970,18,3261},{965,71,3246},{961,124,3230},{957,174,3215},{954,224,3200},{951,274,3186},{948,323,3172},{945,372,3158},
+    {942,420,3145},{938,469,3132},{934,518,3120},{929,566,3109},{923,614,3098},{916,662,3088},{909,710,3079},{900,757,3070},
+    {891,803,3062},{881,849,3055},{870,895,3049},{859,940,3044},{848,986,3039},{836,1032,3034},{823,1079,3030},{810,1127,3026},
+    {796,1177,3023},{780,1228,3019},{762,1282,3015},{741,1337,3011},{718,1395,3007},{690,1455,3002},{657,1517,2996},{619,1581,2990},
+    {573,1645,2983},{521,1709,2975},{460,1771,2966},{390,1831,2956},{310,1887,2945},{221,1937,2933},{122,1980,2919},{13,2013,2905},
+    {-106,2034,2890},{-233,2043,2874},{-367,2036,2856},{-507,2012,2838},{-650,1970,2820},{-796,1909,2801},{-941,1828,2781},{-1084,1726,2762},
+    {-1222,1604,2743},{-1354,1462,2726},{-1476,1300,2709},{-1588,1121,2694},{-1688,926,2680},{-1774,718,2669},{-1847,498,2661},{-1906,269,2656},
+    {-1950,35,2654},{-1980,-203,2655},{-1995,-440,2659},{-1997,-674,2666},{-1986,-904,2676},{-1962,-1126,2689},{-1927,-1338,2705},{-1882,-1540,2723},
+    {-1827,-1729,2743},{-1765,-1905,2765},{-1696,-2068,2789},{-1621,-2216,2813},{-1542,-2351,2839},{-1460,-2472,2865},{-1375,-2580,2893},{-1289,-2675,2920},
+    {-1202,-2758,2948},{-1115,-2830,2976},{-1029,-2892,3003},{-943,-2943,3030},{-858,-2985,3057},{-775,-3019,3083},{-693,-3044,3108},{-612,-3061,3132},
+    {-534,-3071,3154},{-457,-3073,3175},{-382,-3068,3194},{-310,-3056,3211},{-240,-3036,3226},{-174,-3010,3239},{-112,-2976,3250},{-54,-2936,3259},
+    {-1,-2889,3266},{47,-2835,3272},{88,-2774,3277},{123,-2708,3281},{150,-2637,3284},{170,-2561,3288},{182,-2482,3292},{186,-2400,3298},
+    {183,-2316,3305},{172,-2232,3314},{154,-2149,3325},{129,-2067,3339},{98,-1989,3357},{63,-1916,3377},{23,-1847,3401},{-19,-1785,3428},
+    {-64,-1730,3459},{-109,-1683,3492},{-154,-1644,3528},{-198,-1612,3567},{-240,-1589,3608},{-278,-1573,3651},{-313,-1564,3695},{-342,-1562,3740},
+    {-367,-1566,3785},{-387,-1575,3831},{-400,-1587,3876},{-408,-1603,3920},{-410,-1621,3963},{-406,-1640,4005},{-397,-1659,4044},{-383,-1677,4081},
+    {-364,-1694,4116},{-341,-1709,4148},{-315,-1720,4176},{-287,-1728,4202},{-256,-1733,4224},{-225,-1733,4242},{-194,-1730,4257},{-163,-1722,4269},
+    {-133,-1711,4277},{-106,-1696,4282},{-81,-1679,4284},{-59,-1660,4282},{-41,-1639,4278},{-26,-1618,4271},{-15,-1596,4261},{-7,-1576,4250},
+    {-3,-1558,4236},{-2,-1543,4221},{-2,-1530,4205},{-5,-1522,4187},{-8,-1518,4168},{-11,-1518,4149},{-13,-1522,4129},{-13,-1531,4109},
+    {-11,-1543,4089},{-4,-1559,4068},{7,-1577,4047},{23,-1596,4027},{45,-1615,4005},{73,-1634,3984},{107,-1650,3962},{146,-1663,3940},
+    {191,-1672,3918},{241,-1674,3895},{296,-1671,3871},{353,-1659,3847},{414,-1640,3821},{475,-1613,3796},{537,-1577,3769},{597,-1532,3742},
+    {656,-1479,3715},{712,-1419,3688},{764,-1352,3660},{812,-1278,3632},{854,-1199,3605},{891,-1117,3578},{923,-1031,3551},{949,-944,3525},
+    {969,-856,3500},{985,-768,3476},{996,-681,3452},{1002,-597,3430},{1005,-515,3408}
+  },
+  {  // +2
+    {986,-103,3361},{987,-24,3343},{985,53,3326},{982,125,3309},{977,194,3293},{971,259,3278},{965,320,3264},{960,379,3250},
+    {954,434,3236},{949,488,3223},{944,540,3211},{941,590,3199},{937,639,3187},{934,687,3175},{931,735,3164},{928,782,3154},
+    {925,829,3144},{922,876,3134},{918,923,3125},{913,970,3117},{908,1016,3109},{901,1062,3103},{894,1108,3096},{887,1153,3091},
+    {878,1198,3086},{869,1243,3082},{859,1287,3079},{848,1332,3077},{837,1377,3075},{825,1422,3073},{812,1468,3072},{798,1516,3072},
+    {783,1564,3071},{766,1615,3070},{746,1667,3069},{724,1722,3068},{698,1778,3067},{668,1836,3064},{633,1896,3061},{592,1956,3058},
+    {545,2017,3053},{490,2078,3047},{427,2136,3041},{355,2192,3033},{274,2244,3024},{184,2290,3013},{84,2328,3001},{-25,2357,2988},
+    {-143,2375,2974},{-269,2380,2958},{-402,2370,2942},{-539,2344,2924},{-680,2301,2905},{-822,2239,2886},{-964,2158,2866},{-1102,2057,2846},
+    {-1236,1937,2826},{-1361,1797,2806},{-1478,1639,2787},{-1584,1465,2770},{-1678,1274,2754},{-1759,1071,2741},{-1826,856,2730},{-1879,633,2722},
+    {-1917,404,2716},{-1941,172,2714},{-1951,-61,2715},{-1947,-291,2719},{-1931,-516,2727},{-1902,-733,2737},{-1863,-942,2750},{-1814,-1140,2765},
+    {-1755,-1326,2783},{-1690,-1498,2802},{-1618,-1657,2824},{-1540,-1803,2846},{-1459,-1934,2870},{-1375,-2051,2895},{-1290,-2155,2921},{-1203,-2246,2947},
+    {-1116,-2325,2973},{-1030,-2393,3000},{-944,-2450,3026},{-860,-2497,3053},{-778,-2535,3079},{-697,-2564,3104},{-618,-2585,3128},{-541,-2599,3152},
+    {-466,-2605,3174},{-393,-2603,3195},{-322,-2595,3214},{-254,-2580,3231},{-189,-2558,3246},{-127,-2530,3260},{-69,-2495,3272},{-14,-2453,3282},
+    {36,-2404,3290},{81,-2350,3298},{121,-2290,3304},{154,-2224,3309},{181,-2153,3314},{202,-2078,3319},{215,-1999,3324},{221,-1918,3331},
+    {220,-1835,3338},{212,-1751,3348},{198,-1669,3359},{176,-1588,3374},{150,-1510,3390},{118,-1437,3410},{82,-1369,3432},{42,-1307,3458},
+    {1,-1251,3486},{-42,-1203,3517},{-85,-1163,3550},{-128,-1131,3586},{-168,-1107,3624},{-206,-1090,3663},{-241,-1080,3703},{-272,-1077,3744},
+    {-298,-1080,3786},{-319,-1089,3827},{-335,-1101,3869},{-345,-1116,3909},{-350,-1134,3948},{-349,-1153,3986},{-343,-1172,4023},{-333,-1191,4057},
+    {-318,-1208,4088},{-299,-1223,4117},{-277,-1235,4144},{-252,-1244,4167},{-226,-1249,4187},{-199,-1251,4205},{-172,-1248,4218},{-145,-1242,4229},
+    {-120,-1232,4236},{-96,-1219,4241},{-75,-1203,4242},{-57,-1185,4240},{-43,-1166,4235},{-32,-1147,4228},{-24,-1128,4219},{-20,-1110,4207},
+    {-19,-1094,4193},{-20,-1081,4178},{-24,-1072,4161},{-29,-1067,4142},{-34,-1065,4123},{-40,-1069,4103},{-43,-1077,4082},{-45,-1089,4061},
+    {-44,-1105,4039},{-39,-1124,4017},{-28,-1145,3995},{-13,-1168,3972},{8,-1190,3950},{35,-1212,3927},{69,-1232,3903},{108,-1247,3880},
+    {153,-1258,3856},{203,-1264,3832},{258,-1262,3807},{316,-1253,3781},{377,-1235,3756},{439,-1209,3729},{501,-1173,3703},{562,-1130,3676},
+    {622,-1077,3649},{679,-1017,3622},{732,-949,3595},{781,-875,3568},{825,-796,3542},{863,-713,3516},{896,-626,3491},{924,-538,3467},
+    {946,-448,3444},{962,-360,3422},{974,-272,3401},{982,-186,3380},{986,-103,3361}
+  },
+  {  // +4
+    {968,304,3325},{970,385,3309},{969,461,3294},{967,534,3280},{963,603,3267},{958,668,3255},{953,730,3243},{947,788,3232},
+    {942,844,3221},{937,897,3211},{933,948,3201},{929,997,3192},{925,1045,3183},{922,1092,3175},{919,1139,3167},{916,1184,3159},
+    {913,1230,3152},{910,1275,3146},{906,1320,3140},{902,1364,3135},{897,1409,3130},{892,1453,3126},{885,1497,3123},{878,1540,3121},
+    {870,1584,3120},{862,1627,3119},{852,1670,3119},{842,1714,3119},{831,1757,3120},{818,1802,3122},{805,1847,3124},{790,1893,3126},
+    {774,1941,3128},{756,1991,3131},{735,2042,3133},{711,2094,3134},{683,2149,3135},{650,2205,3136},{613,2262,3135},{570,2319,3134},
+    {520,2377,3132},{462,2433,3128},{397,2488,3123},{323,2540,3117},{241,2587,3110},{149,2629,3101},{48,2663,3090},{-61,2688,3078},
+    {-179,2702,3065},{-304,2703,3049},{-434,2691,3033},{-570,2663,3015},{-708,2618,2996},{-847,2556,2976},{-984,2476,2955},{-1118,2377,2934},
+    {-1246,2259,2913},{-1367,2123,2892},{-1478,1970,2871},{-1579,1800,2852},{-1667,1616,2834},{-1742,1418,2818},{-1803,1210,2804},{-1850,994,2793},
+    {-1882,772,2785},{-1901,547,2779},{-1905,322,2777},{-1897,98,2778},{-1876,-121,2782},{-1843,-333,2789},{-1800,-536,2799},{-1747,-729,2812},
+    {-1685,-909,2827},{-1617,-1077,2844},{-1542,-1232,2862},{-1463,-1373,2883},{-1381,-1499,2905},{-1296,-1612,2928},{-1209,-1712,2952},{-1123,-1799,2976},
+    {-1036,-1874,3001},{-951,-1937,3027},{-866,-1989,3052},{-784,-2032,3078},{-703,-2066,3103},{-625,-2090,3127},{-549,-2107,3151},{-475,-2117,3174},
+    {-404,-2119,3196},{-335,-2114,3217},{-268,-2103,3236},{-205,-2085,3253},{-143,-2061,3269},{-85,-2031,3284},{-30,-1994,3296},{21,-1951,3308},
+    {68,-1902,3317},{111,-1848,3326},{149,-1788,3333},{181,-1722,3340},{208,-1652,3347},{228,-1578,3353},{243,-1501,3360},{250,-1421,3367},
+    {251,-1339,3376},{246,-1258,3387},{234,-1176,3399},{216,-1097,3413},{192,-1020,3430},{164,-948,3449},{131,-880,3470},{95,-818,3494},
+    {56,-763,3521},{16,-715,3550},{-25,-675,3581},{-66,-642,3614},{-106,-617,3649},{-143,-599,3685},{-178,-589,3722},{-209,-585,3759},
+    {-236,-588,3797},{-259,-595,3835},{-276,-606,3873},{-289,-621,3910},{-296,-639,3946},{-298,-657,3981},{-295,-676,4014},{-288,-695,4045},
+    {-276,-712,4074},{-261,-728,4101},{-243,-740,4125},{-222,-750,4146},{-200,-756,4165},{-177,-758,4181},{-153,-756,4194},{-131,-751,4204},
+    {-109,-742,4210},{-90,-731,4214},{-73,-717,4215},{-58,-701,4213},{-48,-684,4208},{-40,-666,4201},{-36,-650,4191},{-35,-635,4179},
+    {-37,-622,4165},{-41,-612,4150},{-47,-605,4132},{-55,-603,4113},{-63,-605,4093},{-70,-612,4072},{-76,-623,4050},{-79,-638,4028},
+    {-79,-658,4005},{-75,-680,3981},{-66,-705,3957},{-51,-731,3933},{-30,-757,3908},{-4,-782,3883},{29,-804,3858},{69,-823,3833},
+    {113,-836,3807},{164,-844,3781},{218,-845,3755},{276,-837,3729},{337,-822,3702},{400,-797,3675},{463,-763,3648},{525,-720,3621},
+    {586,-669,3594},{644,-610,3568},{698,-543,3541},{748,-469,3516},{794,-390,3491},{834,-307,3466},{868,-220,3443},{898,-132,3421},
+    {921,-42,3399},{940,47,3379},{953,135,3360},{962,221,3342},{968,304,3325}
+  },
+  {  // +6
+    {950,704,3299},{954,784,3286},{955,861,3273},{954,933,3262},{951,1002,3251},{947,1067,3241},{943,1128,3232},{938,1187,3223},
+    {934,1242,3215},{929,1294,3208},{925,1345,3201},{921,1393,3195},{918,1440,3189},{915,1486,3183},{912,1531,3178},{909,1575,3174},
+    {907,1619,3170},{904,1662,3166},{900,1705,3164},{897,1747,3161},{892,1790,3160},{887,1832,3159},{882,1874,3159},{875,1916,3160},
+    {868,1957,3162},{860,1999,3164},{851,2041,3167},{841,2083,3170},{829,2126,3175},{817,2169,3179},{803,2213,3184},{788,2259,3189},
+    {770,2305,3195},{750,2353,3200},{727,2403,3205},{701,2454,3209},{671,2506,3213},{636,2560,3216},{596,2614,3218},{550,2668,3219},
+    {497,2723,3218},{437,2775,3217},{369,2826,3214},{294,2874,3209},{209,2917,3203},{116,2954,3195},{15,2983,3185},{-95,3004,3174},
+    {-213,3014,3161},{-337,3013,3146},{-466,2998,3130},{-599,2968,3112},{-734,2923,3092},{-869,2861,3072},{-1003,2782,3050},{-1132,2685,3028},
+    {-1255,2570,3005},{-1370,2438,2982},{-1476,2290,2960},{-1571,2127,2939},{-1653,1949,2919},{-1722,1759,2900},{-1777,1559,2884},{-1819,1351,2870},
+    {-1846,1138,2858},{-1860,921,2850},{-1859,704,2845},{-1846,489,2842},{-1821,278,2843},{-1785,73,2847},{-1738,-123,2854},{-1682,-309,2864},
+    {-1618,-484,2876},{-1547,-646,2890},{-1471,-795,2906},{-1390,-930,2925},{-1307,-1052,2944},{-1221,-1160,2965},{-1135,-1254,2987},{-1048,-1336,3010},
+    {-962,-1406,3034},{-877,-1465,3058},{-795,-1513,3082},{-714,-1551,3106},{-636,-1580,3130},{-560,-1600,3154},{-486,-1613,3178},{-416,-1619,3200},
+    {-348,-1617,3222},{-282,-1609,3242},{-219,-1595,3262},{-159,-1575,3280},{-102,-1549,3296},{-47,-1517,3311},{4,-1479,3325},{52,-1436,3337},
+    {97,-1386,3349},{137,-1332,3358},{173,-1272,3368},{204,-1208,3376},{230,-1139,3384},{251,-1067,3392},{265,-992,3401},{274,-914,3410},
+    {277,-834,3420},{273,-755,3431},{264,-676,3444},{249,-598,3459},{228,-523,3476},{203,-452,3495},{173,-386,3516},{140,-325,3539},
+    {104,-271,3564},{66,-223,3591},{27,-183,3621},{-12,-150,3651},{-51,-124,3683},{-88,-106,3717},{-122,-95,3751},{-153,-91,3785},
+    {-181,-92,3820},{-204,-98,3855},{-223,-109,3890},{-238,-123,3923},{-247,-140,3956},{-251,-158,3988},{-251,-177,4018},{-247,-195,4047},
+    {-238,-212,4074},{-226,-228,4098},{-212,-240,4121},{-195,-250,4140},{-176,-257,4158},{-157,-260,4173},{-137,-259,4184},{-118,-255,4194},
+    {-101,-247,4200},{-85,-237,4203},{-72,-225,4204},{-62,-211,4202},{-54,-196,4197},{-50,-181,4190},{-50,-167,4180},{-52,-154,4168},
+    {-57,-144,4154},{-64,-137,4138},{-73,-134,4120},{-83,-134,4101},{-93,-140,4080},{-102,-150,4058},{-109,-164,4034},{-114,-183,4010},
+    {-115,-206,3985},{-112,-232,3960},{-104,-259,3934},{-90,-288,3908},{-71,-317,3881},{-44,-345,3854},{-12,-370,3827},{27,-392,3800},
+    {72,-408,3772},{122,-418,3744},{176,-421,3717},{235,-416,3689},{296,-403,3661},{358,-380,3634},{422,-348,3606},{485,-307,3579},
+    {547,-258,3552},{606,-200,3526},{662,-134,3500},{713,-62,3475},{760,15,3451},{802,98,3428},{839,183,3406},{870,271,3385},
+    {895,360,3365},{916,448,3347},{932,536,3330},{943,621,3314},{950,704,3299}
+  },
+  {  // +8
+    {932,1094,3284},{938,1173,3272},{941,1248,3262},{942,1320,3253},{941,1388,3244},{939,1453,3237},{936,1514,3230},{932,1571,3224},
+    {928,1626,3219},{925,1678,3214},{921,1727,3210},{918,1775,3206},{915,1821,3203},{912,1865,3200},{910,1909,3198},{907,1951,3197},
+    {905,1993,3195},{903,2035,3195},{900,2076,3195},{896,2116,3196},{893,2157,3198},{888,2197,3200},{883,2237,3203},{877,2277,3207},
+    {871,2317,3212},{863,2358,3217},{854,2398,3223},{844,2439,3230},{833,2480,3237},{820,2523,3245},{806,2566,3253},{789,2610,3261},
+    {770,2655,3269},{748,2702,3277},{723,2750,3285},{695,2799,3292},{662,2849,3298},{625,2900,3303},{582,2952,3308},{532,3003,3311},
+    {477,3054,3312},{414,3103,3312},{344,3149,3311},{266,3193,3307},{179,3231,3302},{85,3264,3295},{-18,3289,3286},{-128,3306,3276},
+    {-245,3313,3263},{-368,3309,3248},{-496,3291,3231},{-626,3260,3213},{-759,3214,3193},{-890,3153,3172},{-1019,3075,3149},{-1144,2980,3126},
+    {-1262,2869,3102},{-1372,2742,3078},{-1472,2600,3054},{-1561,2443,3031},{-1637,2273,3008},{-1701,2092,2988},{-1751,1901,2969},{-1787,1703,2952},
+    {-1809,1499,2938},{-1818,1292,2926},{-1813,1084,2918},{-1796,879,2913},{-1767,677,2910},{-1727,481,2911},{-1678,293,2915},{-1619,115,2922},
+    {-1553,-52,2931},{-1481,-207,2942},{-1403,-349,2956},{-1322,-478,2972},{-1237,-594,2989},{-1152,-696,3008},{-1065,-786,3028},{-979,-862,3050},
+    {-894,-927,3072},{-810,-981,3094},{-729,-1024,3117},{-650,-1058,3141},{-573,-1082,3164},{-500,-1099,3187},{-429,-1107,3210},{-361,-1109,3232},
+    {-296,-1104,3253},{-234,-1093,3274},{-175,-1077,3293},{-118,-1054,3312},{-64,-1026,3329},{-12,-993,3345},{36,-954,3360},{81,-910,3373},
+    {123,-862,3386},{161,-808,3397},{195,-749,3408},{225,-686,3418},{250,-620,3428},{270,-549,3438},{285,-476,3448},{294,-401,3458},
+    {298,-325,3470},{296,-248,3482},{289,-171,3496},{276,-97,3512},{258,-24,3529},{235,45,3548},{208,109,3569},{178,168,3591},
+    {144,221,3616},{109,268,3642},{72,308,3669},{35,341,3698},{-2,366,3728},{-38,385,3759},{-72,396,3791},{-103,402,3823},
+    {-131,401,3855},{-155,396,3887},{-175,386,3919},{-191,373,3950},{-202,357,3980},{-209,340,4009},{-211,322,4037},{-209,304,4063},
+    {-203,288,4088},{-195,273,4110},{-183,260,4131},{-169,250,4150},{-154,243,4166},{-139,240,4180},{-123,240,4191},{-108,243,4200},
+    {-94,249,4206},{-83,257,4209},{-73,268,4210},{-66,280,4208},{-63,293,4203},{-62,305,4196},{-65,317,4186},{-70,327,4174},
+    {-78,334,4160},{-88,338,4143},{-100,338,4125},{-112,334,4104},{-124,326,4082},{-136,313,4059},{-145,295,4034},{-151,273,4009},
+    {-154,247,3982},{-152,219,3954},{-145,188,3926},{-132,156,3898},{-113,124,3869},{-87,94,3840},{-55,66,3810},{-17,42,3781},
+    {28,23,3751},{77,10,3722},{132,5,3692},{190,7,3663},{251,18,3634},{314,39,3605},{378,68,3577},{442,106,3549},
+    {505,154,3522},{565,209,3496},{622,272,3470},{675,342,3446},{724,418,3423},{768,498,3401},{806,582,3380},{840,667,3360},
+    {868,754,3342},{891,841,3326},{909,928,3310},{922,1012,3296},{932,1094,3284}
+  },
+  {  // +10
+    {913,1470,3278},{922,1548,3268},{928,1622,3260},{931,1692,3253},{932,1759,3247},{932,1823,3241},{931,1883,3237},{929,1940,3233},
+    {926,1994,3230},{924,2045,3228},{921,2093,3227},{919,2140,3226},{916,2184,3225},{914,2228,3225},{912,2270,3226},{910,2311,3227},
+    {909,2351,3229},{907,2391,3232},{904,2430,3235},{902,2469,3239},{899,2508,3243},{895,2546,3249},{890,2585,3255},{885,2623,3262},
+    {879,2662,3269},{871,2701,3278},{863,2740,3287},{853,2780,3297},{841,2820,3307},{828,2861,3318},{813,2903,3329},{795,2946,3340},
+    {774,2991,3351},{751,3036,3362},{724,3082,3372},{693,3129,3382},{657,3177,3390},{616,3226,3398},{570,3274,3404},{518,3323,3409},
+    {459,3370,3413},{393,3415,3414},{320,3458,3414},{240,3497,3412},{151,3531,3408},{55,3560,3401},{-49,3581,3393},{-160,3594,3382},
+    {-276,3598,3369},{-399,3591,3354},{-524,3571,3338},{-653,3539,3319},{-782,3492,3298},{-910,3431,3276},{-1035,3355,3253},{-1155,3263,3228},
+    {-1268,3157,3203},{-1372,3035,3177},{-1467,2899,3152},{-1550,2749,3127},{-1621,2588,3103},{-1679,2416,3080},{-1724,2234,3059},{-1755,2046,3040},
+    {-1772,1853,3023},{-1776,1657,3009},{-1767,1460,2997},{-1747,1265,2989},{-1714,1074,2984},{-1672,888,2982},{-1619,710,2982},{-1559,541,2986},
+    {-1491,382,2992},{-1417,235,3001},{-1339,101,3013},{-1257,-21,3026},{-1173,-130,3041},{-1087,-227,3058},{-1001,-310,3076},{-915,-381,3096},
+    {-831,-441,3116},{-749,-489,3137},{-669,-528,3159},{-591,-557,3181},{-517,-577,3204},{-445,-589,3226},{-377,-595,3248},{-312,-593,3270},
+    {-250,-585,3292},{-190,-571,3312},{-134,-552,3332},{-80,-528,3351},{-29,-498,3369},{19,-464,3386},{65,-425,3401},{107,-381,3416},
+    {146,-333,3430},{182,-280,3443},{214,-223,3455},{243,-162,3467},{267,-98,3478},{286,-30,3490},{301,40,3502},{311,112,3514},
+    {316,185,3527},{316,258,3541},{310,331,3556},{299,403,3572},{284,472,3590},{263,538,3609},{239,600,3630},{211,657,3652},
+    {180,709,3676},{147,754,3701},{112,793,3728},{76,825,3755},{41,851,3783},{6,869,3812},{-27,881,3842},{-58,887,3871},
+    {-86,888,3901},{-110,883,3931},{-131,875,3960},{-148,863,3989},{-161,848,4016},{-169,832,4043},{-173,815,4069},{-174,798,4093},
+    {-171,782,4116},{-165,768,4138},{-156,756,4157},{-146,746,4175},{-134,739,4190},{-122,735,4203},{-110,734,4214},{-99,736,4222},
+    {-89,741,4228},{-81,748,4231},{-76,757,4232},{-73,767,4230},{-73,778,4226},{-76,788,4218},{-82,797,4209},{-90,804,4196},
+    {-101,808,4182},{-114,809,4165},{-129,807,4145},{-143,800,4124},{-158,788,4101},{-171,772,4077},{-182,751,4050},{-190,726,4023},
+    {-194,698,3994},{-193,667,3965},{-187,633,3934},{-175,599,3903},{-157,565,3872},{-132,532,3840},{-100,502,3808},{-63,475,3777},
+    {-19,454,3745},{31,439,3713},{85,431,3682},{143,431,3651},{204,439,3620},{267,456,3590},{332,483,3561},{396,518,3533},
+    {459,562,3505},{521,615,3479},{579,675,3453},{634,741,3429},{685,814,3406},{731,891,3385},{772,972,3365},{807,1055,3347},
+    {838,1139,3330},{864,1224,3315},{885,1308,3301},{901,1390,3289},{913,1470,3278}
+  },
+  {  // +12
+    {893,1831,3282},{905,1906,3274},{914,1978,3268},{920,2047,3262},{924,2113,3258},{926,2175,3255},{927,2234,3252},{927,2290,3251},
+    {926,2343,3250},{925,2393,3251},{924,2441,3251},{923,2486,3253},{921,2530,3255},{920,2572,3258},{919,2613,3261},{918,2653,3265},
+    {917,2692,3270},{916,2730,3275},{914,2768,3281},{912,2805,3288},{910,2842,3296},{907,2879,3304},{903,2916,3313},{898,2953,3323},
+    {892,2990,3334},{885,3028,3346},{877,3066,3358},{867,3105,3371},{855,3144,3384},{841,3184,3398},{824,3225,3412},{805,3267,3426},
+    {783,3310,3440},{757,3354,3453},{727,3399,3466},{694,3444,3478},{655,3490,3489},{611,3536,3499},{562,3582,3507},{506,3627,3514},
+    {444,3671,3519},{375,3713,3522},{299,3751,3523},{215,3787,3522},{124,3817,3518},{26,3841,3512},{-79,3859,3504},{-190,3869,3493},
+    {-307,3869,3480},{-428,3859,3465},{-552,3838,3448},{-678,3804,3428},{-804,3757,3407},{-928,3697,3384},{-1049,3623,3360},{-1164,3535,3334},
+    {-1272,3432,3308},{-1371,3316,3281},{-1460,3186,3254},{-1538,3044,3228},{-1603,2892,3202},{-1656,2729,3177},{-1696,2558,3154},{-1722,2381,3132},
+    {-1735,2199,3113},{-1735,2014,3097},{-1722,1829,3083},{-1698,1646,3072},{-1663,1466,3064},{-1618,1291,3059},{-1564,1123,3057},{-1501,964,3058},
+    {-1432,815,3061},{-1358,677,3067},{-1279,551,3076},{-1197,436,3087},{-1112,334,3100},{-1027,245,3115},{-941,168,3131},{-857,102,3149},
+    {-773,48,3168},{-692,5,3188},{-614,-29,3209},{-538,-54,3230},{-465,-70,3251},{-396,-78,3273},{-330,-80,3295},{-267,-75,3316},
+    {-207,-64,3338},{-150,-48,3358},{-96,-27,3378},{-45,-1,3398},{3,29,3416},{48,64,3434},{91,104,3451},{131,147,3467},
+    {168,194,3482},{202,246,3496},{232,301,3510},{259,359,3523},{282,421,3537},{301,485,3550},{316,552,3563},{326,620,3577},
+    {332,689,3592},{333,759,3607},{328,828,3623},{319,896,3640},{306,962,3659},{288,1024,3678},{266,1083,3699},{240,1138,3721},
+    {211,1187,3745},{180,1230,3769},{147,1268,3794},{114,1299,3821},{80,1324,3847},{46,1343,3875},{14,1355,3902},{-16,1362,3930},
+    {-44,1363,3958},{-69,1360,3986},{-90,1352,4013},{-108,1342,4040},{-121,1328,4066},{-131,1314,4091},{-138,1298,4115},{-140,1282,4138},
+    {-140,1267,4159},{-136,1254,4179},{-131,1242,4198},{-124,1233,4214},{-115,1226,4229},{-107,1222,4242},{-98,1220,4252},{-91,1222,4260},
+    {-85,1226,4266},{-81,1231,4270},{-79,1239,4270},{-80,1247,4269},{-83,1255,4264},{-90,1263,4257},{-99,1269,4247},{-111,1273,4235},
+    {-126,1275,4220},{-141,1273,4202},{-158,1267,4182},{-175,1257,4160},{-192,1243,4136},{-207,1224,4110},{-220,1201,4082},{-229,1173,4052},
+    {-235,1143,4022},{-236,1109,3990},{-231,1074,3957},{-220,1037,3924},{-202,1001,3890},{-178,966,3856},{-148,933,3821},{-111,905,3787},
+    {-68,881,3753},{-19,863,3719},{35,853,3685},{93,850,3653},{154,855,3620},{217,869,3589},{282,892,3559},{346,924,3529},
+    {410,965,3501},{473,1013,3474},{533,1070,3449},{589,1132,3424},{642,1201,3402},{690,1274,3381},{733,1351,3362},{772,1431,3345},
+    {806,1511,3329},{834,1593,3315},{858,1674,3302},{878,1753,3291},{893,1831,3282}
+  },
+  {  // +14
+    {872,2175,3295},{887,2248,3289},{899,2317,3284},{909,2384,3280},{916,2448,3277},{921,2509,3276},{924,2566,3276},{927,2621,3276},
+    {928,2673,3278},{929,2722,3280},{930,2769,3283},{930,2813,3287},{930,2856,3292},{930,2897,3297},{930,2937,3303},{930,2975,3310},
+    {930,3013,3317},{929,3050,3325},{929,3086,3334},{927,3122,3344},{926,3158,3354},{923,3194,3366},{920,3230,3378},{916,3266,3391},
+    {911,3302,3405},{904,3338,3420},{895,3375,3435},{885,3413,3451},{873,3452,3468},{858,3491,3484},{840,3531,3501},{819,3572,3518},
+    {795,3614,3535},{767,3657,3551},{735,3700,3566},{698,3744,3581},{656,3788,3594},{609,3831,3606},{556,3875,3616},{497,3917,3624},
+    {431,3957,3631},{358,3996,3635},{279,4031,3637},{192,4062,3636},{99,4089,3633},{-1,4109,3627},{-108,4123,3619},{-220,4129,3609},
+    {-336,4127,3595},{-457,4114,3580},{-579,4091,3562},{-703,4057,3542},{-826,4010,3520},{-946,3951,3496},{-1062,3879,3471},{-1173,3794,3444},
+    {-1276,3696,3417},{-1370,3585,3389},{-1453,3462,3360},{-1525,3329,3332},{-1586,3185,3305},{-1633,3032,3279},{-1668,2872,3254},{-1689,2706,3230},
+    {-1698,2535,3209},{-1694,2363,3190},{-1678,2190,3174},{-1651,2019,3160},{-1614,1851,3150},{-1566,1688,3142},{-1510,1531,3138},{-1447,1383,3136},
+    {-1377,1244,3137},{-1302,1115,3141},{-1223,997,3147},{-1141,891,3156},{-1057,797,3167},{-972,714,3180},{-887,643,3194},{-803,584,3210},
+    {-721,535,3228},{-641,497,3246},{-564,467,3266},{-490,447,3286},{-419,435,3307},{-351,430,3328},{-287,431,3350},{-226,439,3371},
+    {-168,452,3392},{-114,470,3413},{-62,493,3433},{-14,520,3453},{32,552,3472},{75,587,3491},{116,626,3508},{153,668,3525},
+    {188,714,3542},{220,764,3557},{249,817,3573},{275,873,3588},{297,931,3603},{315,992,3617},{330,1055,3632},{340,1119,3647},
+    {346,1184,3663},{348,1249,3680},{345,1314,3697},{337,1378,3715},{325,1440,3734},{309,1499,3754},{289,1554,3775},{266,1605,3797},
+    {239,1652,3820},{210,1694,3844},{179,1730,3869},{148,1760,3894},{115,1784,3920},{83,1802,3946},{52,1815,3972},{23,1822,3999},
+    {-5,1824,4025},{-29,1821,4051},{-51,1815,4077},{-69,1806,4102},{-84,1794,4126},{-95,1781,4150},{-103,1767,4173},{-108,1752,4194},
+    {-110,1739,4215},{-109,1726,4234},{-106,1715,4252},{-102,1706,4268},{-97,1700,4282},{-92,1696,4295},{-87,1694,4305},{-83,1695,4314},
+    {-81,1698,4320},{-80,1702,4323},{-83,1708,4324},{-87,1714,4322},{-95,1720,4318},{-105,1725,4311},{-118,1729,4301},{-133,1731,4288},
+    {-151,1730,4273},{-169,1725,4255},{-189,1717,4234},{-209,1704,4211},{-228,1687,4185},{-245,1666,4158},{-260,1640,4128},{-271,1611,4097},
+    {-278,1578,4064},{-280,1542,4030},{-276,1505,3995},{-266,1467,3959},{-250,1428,3922},{-227,1392,3885},{-197,1357,3848},{-161,1327,3811},
+    {-119,1301,3775},{-71,1281,3738},{-18,1268,3703},{40,1262,3668},{100,1264,3634},{164,1275,3601},{228,1294,3569},{293,1322,3539},
+    {358,1359,3509},{421,1403,3482},{483,1455,3456},{541,1513,3432},{595,1577,3409},{646,1646,3389},{692,1718,3370},{734,1793,3353},
+    {770,1870,3338},{802,1947,3325},{830,2024,3313},{853,2100,3304},{872,2175,3295}
+  },
+  {  // +16
+    {848,2501,3318},{868,2571,3312},{884,2638,3309},{897,2702,3306},{907,2764,3305},{916,2823,3305},{922,2879,3307},{928,2932,3309},
+    {932,2983,3313},{935,3031,3317},{938,3076,3322},{940,3120,3329},{942,3162,3335},{943,3202,3343},{945,3241,3352},{946,3279,3361},
+    {947,3315,3371},{947,3351,3382},{948,3387,3393},{948,3422,3406},{947,3456,3419},{945,3491,3434},{943,3526,3449},{939,3561,3465},
+    {934,3596,3482},{927,3632,3499},{919,3669,3518},{908,3706,3537},{895,3744,3556},{879,3782,3576},{860,3822,3596},{838,3862,3616},
+    {811,3903,3635},{781,3944,3654},{746,3986,3671},{706,4028,3688},{660,4070,3704},{610,4112,3717},{553,4153,3729},{489,4192,3739},
+    {420,4230,3747},{344,4265,3752},{261,4296,3754},{171,4324,3754},{75,4347,3752},{-27,4364,3746},{-135,4375,3738},{-248,4378,3727},
+    {-365,4372,3714},{-484,4358,3698},{-606,4333,3679},{-727,4298,3658},{-847,4252,3636},{-964,4194,3611},{-1076,4124,3585},{-1181,4042,3557},
+    {-1279,3949,3529},{-1368,3844,3499},{-1446,3728,3470},{-1513,3602,3441},{-1568,3467,3412},{-1610,3324,3384},{-1640,3175,3358},{-1658,3020,3333},
+    {-1662,2862,3310},{-1655,2701,3289},{-1636,2541,3270},{-1606,2382,3255},{-1566,2226,3242},{-1517,2075,3232},{-1460,1930,3225},{-1396,1793,3221},
+    {-1325,1664,3220},{-1250,1545,3221},{-1171,1437,3225},{-1089,1339,3232},{-1006,1252,3241},{-921,1177,3252},{-838,1113,3265},{-755,1059,3279},
+    {-674,1015,3296},{-595,982,3313},{-519,957,3331},{-446,941,3351},{-377,932,3371},{-310,930,3392},{-248,934,3413},{-189,945,3434},
+    {-133,960,3455},{-80,979,3476},{-31,1004,3496},{16,1031,3517},{59,1063,3536},{100,1098,3555},{139,1136,3574},{174,1178,3592},
+    {207,1223,3609},{238,1270,3626},{265,1320,3643},{289,1373,3659},{311,1428,3675},{328,1486,3692},{343,1544,3708},{353,1604,3724},
+    {359,1665,3741},{361,1726,3759},{359,1786,3777},{353,1846,3796},{343,1903,3816},{329,1958,3836},{311,2010,3857},{289,2058,3880},
+    {265,2102,3902},{238,2141,3926},{209,2175,3950},{179,2203,3975},{148,2226,3999},{118,2244,4025},{88,2257,4050},{59,2264,4075},
+    {33,2267,4100},{8,2266,4125},{-14,2261,4149},{-32,2253,4173},{-48,2243,4197},{-60,2231,4220},{-70,2218,4241},{-76,2205,4262},
+    {-80,2193,4282},{-82,2182,4301},{-82,2172,4318},{-80,2164,4334},{-79,2158,4349},{-77,2154,4361},{-76,2152,4372},{-76,2152,4380},
+    {-77,2154,4386},{-81,2157,4390},{-87,2161,4392},{-95,2166,4390},{-106,2170,4386},{-120,2173,4379},{-137,2174,4369},{-156,2174,4356},
+    {-176,2170,4340},{-198,2163,4321},{-221,2152,4300},{-243,2137,4276},{-265,2118,4249},{-284,2094,4220},{-301,2066,4188},{-314,2035,4155},
+    {-322,2000,4120},{-326,1963,4083},{-323,1924,4046},{-315,1885,4007},{-300,1845,3968},{-278,1807,3929},{-249,1771,3889},{-214,1739,3849},
+    {-172,1711,3810},{-125,1689,3771},{-73,1673,3733},{-16,1664,3696},{44,1664,3660},{107,1671,3626},{172,1686,3592},{237,1710,3560},
+    {302,1742,3530},{367,1781,3502},{429,1828,3475},{489,1881,3450},{546,1940,3428},{598,2003,3407},{647,2070,3388},{692,2140,3372},
+    {732,2212,3357},{767,2285,3345},{799,2358,3334},{825,2430,3325},{848,2501,3318}
+  },
+  {  // +18
+    {823,2810,3349},{846,2875,3345},{866,2939,3342},{883,3001,3340},{898,3060,3341},{910,3117,3342},{920,3171,3345},{929,3223,3349},
+    {936,3272,3355},{942,3319,3361},{947,3364,3368},{952,3407,3376},{956,3448,3385},{959,3488,3395},{962,3526,3406},{965,3563,3418},
+    {968,3599,3430},{970,3634,3444},{971,3668,3458},{972,3703,3473},{972,3737,3489},{972,3771,3507},{970,3805,3525},{967,3839,3544},
+    {962,3874,3564},{956,3910,3584},{947,3946,3606},{936,3982,3628},{922,4020,3650},{905,4058,3673},{885,4097,3695},{860,4136,3718},
+    {832,4177,3740},{798,4217,3761},{760,4258,3781},{717,4299,3800},{668,4339,3817},{613,4379,3833},{552,4417,3846},{485,4454,3858},
+    {411,4489,3866},{331,4521,3872},{244,4549,3876},{151,4573,3876},{52,4593,3874},{-52,4607,3869},{-162,4614,3860},{-276,4614,3849},
+    {-393,4607,3835},{-512,4590,3819},{-631,4564,3799},{-750,4529,3778},{-867,4482,3754},{-980,4426,3729},{-1088,4358,3702},{-1189,4280,3673},
+    {-1282,4191,3644},{-1366,4092,3613},{-1439,3983,3583},{-1501,3865,3552},{-1551,3739,3523},{-1588,3606,3493},{-1614,3467,3465},{-1627,3323,3439},
+    {-1628,3177,3414},{-1618,3029,3392},{-1596,2881,3372},{-1564,2734,3355},{-1522,2591,3340},{-1472,2452,3328},{-1413,2318,3319},{-1348,2192,3313},
+    {-1277,2074,3309},{-1202,1965,3309},{-1123,1866,3311},{-1042,1776,3316},{-959,1698,3323},{-876,1629,3332},{-793,1571,3343},{-711,1523,3356},
+    {-631,1485,3371},{-553,1456,3387},{-479,1435,3405},{-407,1423,3423},{-339,1417,3443},{-274,1418,3463},{-213,1425,3483},{-155,1437,3504},
+    {-101,1454,3525},{-50,1475,3546},{-2,1500,3567},{42,1528,3588},{84,1560,3608},{124,1594,3628},{160,1632,3647},{194,1672,3666},
+    {226,1715,3684},{254,1760,3702},{280,1808,3720},{304,1857,3737},{324,1909,3755},{341,1962,3772},{355,2017,3789},{365,2073,3807},
+    {372,2129,3825},{375,2185,3843},{374,2241,3862},{369,2296,3882},{360,2349,3902},{347,2399,3923},{331,2447,3945},{311,2492,3967},
+    {289,2533,3990},{264,2569,4013},{237,2601,4037},{209,2628,4061},{180,2650,4085},{151,2667,4109},{122,2679,4134},{95,2687,4158},
+    {69,2690,4183},{45,2690,4207},{23,2686,4230},{4,2680,4254},{-12,2671,4276},{-25,2661,4298},{-36,2650,4320},{-44,2639,4340},
+    {-50,2628,4360},{-54,2618,4379},{-57,2609,4396},{-59,2602,4412},{-60,2597,4426},{-62,2593,4439},{-64,2591,4450},{-68,2591,4459},
+    {-73,2592,4466},{-81,2594,4470},{-91,2597,4471},{-103,2600,4470},{-118,2602,4466},{-136,2603,4459},{-157,2602,4449},{-179,2599,4436},
+    {-203,2593,4420},{-228,2584,4400},{-253,2571,4378},{-279,2554,4353},{-302,2532,4324},{-324,2507,4294},{-343,2477,4261},{-358,2445,4225},
+    {-368,2409,4188},{-373,2370,4150},{-372,2330,4110},{-365,2289,4069},{-351,2248,4027},{-330,2209,3985},{-303,2172,3942},{-269,2138,3900},
+    {-228,2108,3858},{-182,2084,3817},{-131,2066,3777},{-75,2055,3738},{-15,2050,3699},{47,2054,3663},{112,2065,3628},{178,2085,3594},
+    {243,2112,3563},{308,2146,3533},{372,2188,3506},{434,2235,3480},{492,2288,3457},{548,2346,3436},{599,2407,3417},{647,2472,3401},
+    {690,2539,3386},{730,2606,3374},{765,2675,3364},{796,2743,3355},{823,2810,3349}
+  },
+  {  // +20
+    {794,3100,3389},{822,3162,3385},{847,3222,3383},{868,3281,3383},{887,3338,3384},{903,3392,3387},{917,3445,3391},{930,3495,3396},
+    {940,3543,3403},{950,3589,3411},{958,3633,3420},{965,3675,3430},{972,3715,3441},{977,3754,3453},{983,3791,3466},{987,3828,3480},
+    {992,3863,3495},{995,3898,3511},{998,3932,3528},{1000,3966,3546},{1002,4000,3565},{1002,4033,3585},{1001,4067,3606},{999,4101,3628},
+    {995,4136,3650},{988,4171,3674},{979,4207,3698},{968,4243,3723},{953,4281,3748},{935,4319,3774},{913,4357,3799},{886,4396,3824},
+    {855,4436,3849},{819,4476,3872},{778,4515,3895},{731,4555,3915},{678,4594,3935},{619,4632,3952},{554,4668,3967},{482,4703,3979},
+    {404,4735,3989},{320,4764,3996},{229,4790,4000},{133,4811,4001},{31,4827,3999},{-76,4838,3993},{-188,4843,3985},{-303,4840,3973},
+    {-420,4830,3959},{-538,4812,3942},{-657,4785,3922},{-774,4749,3900},{-888,4703,3875},{-997,4648,3849},{-1101,4583,3821},{-1198,4508,3791},
+    {-1286,4423,3761},{-1364,4330,3730},{-1432,4227,3698},{-1489,4117,3667},{-1534,4000,3636},{-1568,3876,3606},{-1589,3748,3577},{-1598,3615,3549},
+    {-1596,3481,3523},{-1582,3344,3500},{-1558,3209,3478},{-1524,3074,3459},{-1481,2943,3443},{-1429,2816,3429},{-1370,2694,3418},{-1304,2579,3410},
+    {-1234,2471,3405},{-1158,2372,3402},{-1080,2282,3403},{-999,2201,3406},{-917,2129,3411},{-835,2068,3419},{-753,2016,3428},{-672,1974,3440},
+    {-593,1940,3454},{-517,1916,3469},{-443,1899,3485},{-372,1889,3503},{-305,1887,3522},{-242,1890,3541},{-182,1899,3561},{-125,1912,3582},
+    {-72,1930,3603},{-23,1952,3624},{24,1978,3645},{67,2006,3665},{107,2037,3686},{145,2071,3706},{180,2108,3726},{213,2146,3745},
+    {243,2187,3765},{270,2230,3783},{295,2275,3802},{318,2321,3820},{337,2370,3839},{354,2419,3857},{367,2470,3875},{378,2521,3894},
+    {385,2573,3913},{388,2624,3932},{388,2676,3952},{384,2726,3972},{376,2775,3992},{365,2821,4014},{350,2865,4035},{333,2906,4058},
+    {312,2944,4080},{289,2977,4104},{264,3007,4127},{238,3032,4151},{211,3053,4175},{184,3069,4199},{156,3081,4223},{130,3089,4247},
+    {105,3093,4271},{82,3094,4294},{60,3091,4317},{41,3086,4340},{24,3079,4363},{10,3070,4385},{-2,3061,4406},{-11,3052,4427},
+    {-19,3042,4446},{-26,3034,4465},{-31,3026,4483},{-36,3020,4499},{-40,3015,4514},{-46,3012,4527},{-52,3010,4539},{-59,3010,4548},
+    {-69,3010,4555},{-80,3012,4560},{-94,3013,4562},{-111,3015,4561},{-130,3015,4557},{-152,3014,4550},{-176,3012,4540},{-202,3006,4527},
+    {-230,2998,4510},{-258,2987,4490},{-287,2972,4467},{-315,2953,4440},{-341,2929,4411},{-365,2902,4379},{-386,2872,4344},{-403,2837,4307},
+    {-415,2800,4268},{-422,2761,4227},{-422,2720,4185},{-417,2678,4141},{-404,2637,4097},{-385,2596,4052},{-359,2558,4007},{-326,2523,3963},
+    {-287,2492,3918},{-241,2465,3875},{-191,2445,3832},{-136,2431,3791},{-77,2423,3750},{-15,2423,3712},{49,2430,3675},{115,2445,3640},
+    {181,2467,3607},{247,2497,3576},{312,2532,3548},{375,2574,3521},{436,2621,3497},{493,2673,3476},{548,2729,3457},{599,2787,3440},
+    {646,2848,3425},{689,2911,3413},{728,2974,3403},{763,3037,3395},{794,3100,3389}
+  },
+  {  // +22
+    {764,3373,3437},{796,3431,3434},{825,3488,3432},{851,3543,3433},{875,3597,3435},{895,3650,3438},{914,3700,3444},{930,3748,3451},
+    {944,3795,3459},{957,3840,3468},{969,3883,3479},{979,3924,3491},{989,3964,3503},{997,4002,3517},{1005,4039,3532},{1012,4075,3549},
+    {1018,4110,3566},{1024,4145,3584},{1028,4179,3603},{1032,4212,3624},{1035,4246,3645},{1036,4280,3668},{1036,4313,3691},{1035,4348,3716},
+    {1031,4382,3741},{1025,4418,3768},{1016,4453,3795},{1004,4490,3822},{988,4527,3850},{968,4565,3878},{944,4604,3906},{916,4643,3934},
+    {882,4682,3961},{843,4721,3986},{799,4760,4011},{748,4798,4034},{691,4836,4055},{628,4872,4073},{558,4907,4090},{482,4940,4103},
+    {400,4969,4114},{311,4996,4121},{217,5019,4126},{116,5038,4127},{11,5051,4125},{-99,5059,4120},{-212,5061,4111},{-329,5056,4099},
+    {-446,5044,4084},{-565,5025,4067},{-682,4997,4046},{-797,4960,4023},{-908,4915,3998},{-1014,4861,3971},{-1114,4798,3942},{-1207,4727,3912},
+    {-1290,4647,3881},{-1364,4559,3849},{-1427,4463,3816},{-1479,4360,3784},{-1520,4251,3752},{-1549,4137,3721},{-1566,4018,3691},{-1572,3897,3663},
+    {-1566,3773,3636},{-1550,3648,3611},{-1524,3524,3588},{-1488,3401,3568},{-1443,3282,3550},{-1390,3166,3535},{-1331,3055,3522},{-1265,2951,3512},
+    {-1194,2853,3506},{-1119,2764,3502},{-1041,2682,3500},{-961,2609,3502},{-880,2546,3505},{-799,2491,3512},{-718,2445,3520},{-638,2408,3530},
+    {-560,2379,3543},{-485,2358,3557},{-412,2345,3572},{-342,2338,3589},{-276,2338,3607},{-213,2343,3626},{-154,2353,3645},{-99,2368,3665},
+    {-47,2387,3686},{2,2409,3707},{47,2435,3728},{89,2463,3748},{129,2494,3769},{165,2527,3790},{199,2562,3810},{231,2599,3830},
+    {260,2638,3850},{286,2678,3869},{310,2720,3888},{332,2763,3907},{351,2808,3926},{367,2854,3946},{380,2901,3965},{390,2948,3984},
+    {398,2995,4003},{401,3042,4023},{402,3089,4043},{399,3135,4064},{393,3179,4085},{383,3222,4107},{370,3262,4129},{354,3299,4151},
+    {336,3334,4174},{315,3365,4197},{292,3392,4220},{267,3415,4244},{242,3435,4268},{216,3450,4291},{191,3462,4315},{166,3470,4339},
+    {142,3474,4363},{119,3475,4386},{98,3474,4409},{79,3470,4432},{62,3465,4455},{47,3458,4477},{34,3450,4499},{22,3443,4519},
+    {13,3435,4540},{4,3428,4559},{-4,3422,4577},{-12,3416,4594},{-20,3412,4610},{-29,3410,4623},{-38,3408,4635},{-50,3407,4645},
+    {-63,3408,4653},{-79,3408,4658},{-98,3409,4661},{-118,3409,4660},{-142,3408,4657},{-168,3405,4650},{-196,3401,4640},{-226,3394,4626},
+    {-257,3384,4609},{-289,3370,4588},{-321,3354,4564},{-352,3333,4537},{-381,3308,4507},{-407,3280,4473},{-431,3248,4437},{-450,3213,4398},
+    {-464,3175,4357},{-472,3134,4314},{-474,3093,4270},{-470,3050,4224},{-459,3008,4177},{-441,2967,4130},{-416,2928,4083},{-385,2891,4036},
+    {-347,2859,3989},{-303,2831,3943},{-253,2808,3898},{-199,2791,3854},{-141,2781,3812},{-80,2777,3772},{-16,2780,3733},{50,2790,3696},
+    {117,2808,3662},{183,2831,3630},{249,2862,3600},{314,2897,3573},{376,2939,3548},{436,2984,3525},{494,3034,3505},{548,3087,3488},
+    {598,3142,3473},{645,3199,3461},{688,3257,3451},{728,3315,3443},{764,3373,3437}
+  },
+  {  // +24
+    {731,3631,3494},{768,3684,3491},{802,3737,3490},{832,3789,3490},{860,3840,3493},{886,3890,3498},{908,3938,3504},{929,3985,3512},
+    {948,4030,3521},{965,4074,3532},{980,4116,3544},{994,4156,3557},{1006,4195,3571},{1018,4233,3587},{1028,4270,3604},{1038,4306,3622},
+    {1046,4341,3641},{1054,4375,3662},{1061,4409,3683},{1066,4443,3706},{1071,4477,3730},{1074,4511,3755},{1075,4545,3781},{1074,4579,3808},
+    {1070,4614,3836},{1064,4650,3865},{1055,4686,3895},{1043,4723,3925},{1026,4761,3956},{1005,4799,3986},{980,4837,4016},{949,4876,4046},
+    {912,4915,4075},{870,4954,4103},{822,4992,4129},{768,5030,4154},{707,5066,4176},{639,5101,4197},{565,5134,4214},{485,5165,4229},
+    {398,5193,4240},{304,5217,4248},{205,5238,4253},{101,5254,4255},{-8,5265,4253},{-121,5271,4247},{-236,5270,4238},{-354,5264,4226},
+    {-472,5250,4211},{-590,5229,4193},{-707,5200,4172},{-820,5164,4148},{-929,5119,4122},{-1032,5067,4094},{-1128,5006,4065},{-1216,4938,4034},
+    {-1295,4862,4002},{-1365,4779,3969},{-1423,4689,3936},{-1471,4594,3903},{-1507,4493,3871},{-1532,4387,3839},{-1546,4278,3808},{-1548,4167,3779},
+    {-1540,4053,3751},{-1521,3940,3725},{-1493,3827,3701},{-1455,3715,3680},{-1409,3607,3661},{-1356,3502,3644},{-1295,3402,3630},{-1230,3308,3619},
+    {-1159,3220,3611},{-1085,3139,3605},{-1008,3066,3603},{-928,3001,3602},{-848,2944,3605},{-768,2896,3610},{-687,2855,3617},{-609,2823,3626},
+    {-532,2798,3637},{-457,2781,3650},{-385,2770,3664},{-316,2766,3680},{-251,2768,3697},{-189,2775,3715},{-131,2786,3734},{-76,2802,3754},
+    {-25,2821,3774},{23,2844,3794},{68,2869,3815},{110,2897,3836},{148,2927,3856},{184,2959,3877},{217,2992,3897},{248,3027,3918},
+    {276,3064,3938},{302,3102,3958},{325,3141,3977},{346,3182,3997},{365,3223,4016},{380,3265,4036},{394,3308,4056},{404,3351,4076},
+    {412,3394,4096},{416,3437,4116},{417,3480,4136},{415,3521,4157},{410,3562,4179},{402,3600,4201},{391,3637,4223},{376,3671,4245},
+    {360,3702,4268},{341,3730,4291},{320,3756,4315},{297,3777,4338},{274,3795,4362},{250,3810,4386},{226,3821,4410},{202,3829,4434},
+    {179,3834,4457},{157,3836,4481},{137,3835,4505},{118,3833,4528},{101,3829,4551},{85,3824,4574},{71,3818,4596},{58,3812,4617},
+    {46,3806,4638},{35,3800,4658},{24,3795,4677},{14,3791,4695},{2,3788,4711},{-10,3786,4726},{-24,3784,4739},{-39,3784,4749},
+    {-57,3784,4758},{-77,3784,4764},{-100,3783,4767},{-125,3782,4767},{-153,3780,4763},{-184,3776,4757},{-216,3770,4746},{-250,3761,4733},
+    {-285,3750,4715},{-320,3735,4694},{-355,3716,4669},{-389,3694,4641},{-421,3668,4610},{-451,3639,4575},{-476,3606,4537},{-497,3570,4497},
+    {-513,3531,4454},{-524,3490,4409},{-528,3448,4363},{-525,3405,4315},{-515,3362,4267},{-499,3321,4217},{-476,3281,4168},{-445,3243,4118},
+    {-409,3209,4069},{-366,3180,4021},{-318,3155,3974},{-265,3135,3928},{-207,3122,3884},{-146,3115,3842},{-83,3114,3801},{-17,3120,3763},
+    {50,3132,3727},{117,3151,3693},{184,3175,3662},{250,3205,3634},{314,3240,3608},{377,3280,3585},{437,3323,3564},{494,3370,3546},
+    {548,3419,3531},{599,3471,3518},{646,3523,3508},{690,3577,3500},{731,3631,3494}
+  },
+  {  // +26
+    {695,3873,3559},{737,3923,3556},{776,3972,3555},{811,4021,3556},{844,4069,3559},{874,4116,3564},{902,4162,3571},{927,4207,3580},
+    {950,4250,3590},{971,4292,3602},{990,4333,3615},{1008,4373,3630},{1024,4412,3645},{1039,4449,3663},{1052,4486,3681},{1065,4522,3701},
+    {1076,4557,3722},{1086,4591,3745},{1095,4626,3768},{1103,4660,3793},{1109,4694,3819},{1113,4728,3846},{1116,4763,3875},{1116,4798,3904},
+    {1113,4833,3935},{1107,4869,3966},{1098,4906,3998},{1085,4943,4031},{1067,4981,4064},{1045,5020,4096},{1018,5059,4129},{985,5098,4161},
+    {946,5137,4191},{900,5175,4221},{849,5213,4249},{790,5250,4275},{725,5286,4299},{653,5320,4321},{574,5351,4339},{489,5380,4355},
+    {397,5406,4367},{299,5429,4376},{196,5447,4381},{87,5461,4383},{-25,5470,4381},{-141,5474,4375},{-259,5471,4366},{-378,5463,4354},
+    {-498,5447,4338},{-616,5425,4319},{-732,5396,4298},{-843,5360,4273},{-950,5316,4247},{-1050,5265,4218},{-1143,5207,4188},{-1227,5141,4157},
+    {-1302,5070,4124},{-1367,4992,4091},{-1422,4908,4057},{-1465,4819,4024},{-1498,4725,3991},{-1519,4628,3958},{-1529,4528,3927},{-1528,4426,3897},
+    {-1517,4323,3868},{-1496,4219,3841},{-1465,4117,3817},{-1426,4016,3794},{-1379,3918,3774},{-1325,3824,3757},{-1265,3734,3742},{-1199,3649,3729},
+    {-1129,3570,3720},{-1055,3498,3713},{-979,3433,3709},{-900,3375,3707},{-821,3324,3708},{-741,3282,3712},{-662,3246,3717},{-584,3218,3725},
+    {-508,3197,3735},{-434,3183,3746},{-363,3175,3760},{-295,3173,3775},{-230,3176,3791},{-169,3184,3808},{-111,3197,3826},{-56,3213,3845},
+    {-5,3232,3865},{42,3254,3885},{86,3279,3905},{128,3306,3925},{166,3335,3946},{201,3366,3966},{234,3398,3987},{264,3431,4007},
+    {292,3466,4027},{317,3502,4047},{340,3538,4067},{361,3576,4087},{379,3614,4107},{395,3652,4127},{408,3692,4147},{419,3731,4167},
+    {427,3770,4188},{432,3809,4208},{434,3848,4229},{433,3885,4251},{429,3922,4272},{422,3956,4294},{413,3989,4317},{400,4020,4339},
+    {385,4049,4362},{368,4075,4386},{350,4098,4409},{329,4117,4433},{308,4134,4457},{286,4148,4481},{263,4159,4505},{241,4167,4529},
+    {219,4172,4554},{198,4174,4578},{178,4175,4602},{159,4174,4626},{142,4171,4650},{125,4168,4673},{110,4164,4696},{96,4159,4718},
+    {82,4155,4740},{68,4151,4761},{55,4147,4781},{41,4144,4800},{26,4142,4817},{10,4140,4833},{-8,4139,4847},{-28,4139,4858},
+    {-50,4138,4867},{-75,4138,4874},{-102,4137,4877},{-132,4135,4878},{-164,4132,4875},{-199,4126,4868},{-236,4119,4858},{-274,4109,4844},
+    {-313,4096,4827},{-352,4080,4805},{-390,4060,4780},{-428,4036,4751},{-463,4009,4718},{-495,3979,4683},{-523,3945,4644},{-546,3908,4602},
+    {-564,3869,4558},{-576,3828,4512},{-582,3786,4463},{-581,3742,4414},{-573,3699,4363},{-558,3657,4312},{-536,3616,4261},{-507,3578,4209},
+    {-472,3543,4158},{-431,3512,4108},{-383,3485,4059},{-331,3463,4011},{-275,3447,3965},{-214,3436,3921},{-151,3432,3879},{-86,3433,3839},
+    {-18,3441,3801},{49,3454,3766},{117,3473,3734},{185,3498,3704},{251,3527,3677},{316,3561,3653},{378,3598,3632},{439,3639,3613},
+    {496,3682,3597},{551,3728,3584},{602,3776,3573},{650,3824,3565},{695,3873,3559}
+  },
+  {  // +28
+    {658,4103,3633},{704,4148,3629},{748,4193,3628},{788,4239,3630},{826,4284,3633},{861,4328,3638},{893,4372,3646},{923,4415,3655},
+    {950,4457,3666},{976,4498,3678},{999,4538,3693},{1021,4577,3708},{1041,4615,3726},{1059,4652,3744},{1076,4688,3764},{1092,4724,3785},
+    {1106,4759,3808},{1119,4794,3832},{1131,4829,3858},{1140,4863,3885},{1148,4898,3913},{1155,4933,3942},{1158,4968,3972},{1159,5004,4004},
+    {1157,5040,4037},{1152,5077,4070},{1143,5114,4104},{1129,5152,4139},{1111,5191,4174},{1087,5230,4208},{1058,5269,4243},{1023,5308,4276},
+    {981,5347,4309},{933,5386,4340},{878,5423,4370},{816,5460,4397},{746,5495,4422},{670,5528,4445},{586,5559,4464},{496,5586,4481},
+    {399,5611,4493},{296,5632,4503},{188,5648,4508},{75,5660,4510},{-41,5667,4508},{-160,5669,4503},{-281,5665,4494},{-403,5654,4481},
+    {-523,5638,4465},{-642,5615,4446},{-757,5585,4424},{-867,5549,4399},{-972,5506,4372},{-1070,5457,4343},{-1159,5401,4312},{-1240,5338,4280},
+    {-1311,5271,4247},{-1372,5197,4213},{-1423,5119,4179},{-1462,5036,4145},{-1491,4950,4112},{-1508,4860,4079},{-1515,4769,4047},{-1512,4675,4016},
+    {-1498,4581,3987},{-1475,4487,3959},{-1443,4395,3934},{-1403,4304,3911},{-1355,4215,3890},{-1300,4130,3871},{-1240,4050,3855},{-1174,3974,3842},
+    {-1104,3904,3831},{-1031,3839,3823},{-955,3781,3818},{-877,3730,3815},{-799,3685,3814},{-720,3648,3816},{-642,3617,3821},{-565,3593,3827},
+    {-489,3575,3836},{-416,3564,3846},{-346,3558,3858},{-278,3558,3872},{-213,3562,3887},{-152,3571,3903},{-94,3584,3920},{-40,3600,3938},
+    {11,3619,3957},{58,3641,3976},{102,3665,3996},{143,3691,4016},{181,3719,4036},{217,3748,4056},{249,3779,4077},{279,3810,4097},
+    {307,3843,4117},{332,3876,4137},{355,3910,4157},{376,3945,4177},{394,3980,4197},{410,4015,4218},{424,4051,4238},{435,4087,4258},
+    {443,4122,4279},{449,4158,4300},{452,4192,4321},{453,4226,4343},{450,4259,4364},{445,4291,4387},{437,4320,4409},{426,4348,4432},
+    {413,4374,4455},{399,4398,4479},{382,4418,4503},{363,4437,4527},{344,4452,4551},{324,4465,4576},{303,4476,4601},{282,4484,4625},
+    {262,4489,4650},{242,4492,4675},{222,4494,4700},{203,4494,4725},{185,4493,4750},{168,4491,4774},{152,4488,4798},{136,4486,4821},
+    {120,4483,4844},{104,4480,4866},{88,4478,4888},{71,4476,4907},{52,4475,4926},{32,4474,4943},{10,4474,4957},{-14,4473,4970},
+    {-41,4473,4980},{-70,4472,4987},{-103,4471,4991},{-137,4468,4992},{-175,4463,4989},{-214,4457,4983},{-255,4449,4973},{-298,4437,4959},
+    {-341,4423,4941},{-384,4406,4920},{-426,4385,4894},{-467,4360,4864},{-505,4332,4831},{-539,4301,4795},{-570,4267,4755},{-596,4230,4712},
+    {-616,4190,4667},{-630,4149,4619},{-638,4106,4569},{-639,4062,4518},{-632,4019,4466},{-619,3976,4413},{-598,3935,4360},{-571,3896,4307},
+    {-537,3860,4254},{-496,3827,4202},{-450,3799,4152},{-399,3775,4102},{-343,3756,4054},{-283,3742,4009},{-220,3734,3965},{-155,3731,3923},
+    {-88,3734,3884},{-19,3743,3848},{50,3757,3814},{118,3776,3784},{186,3799,3756},{253,3827,3730},{319,3859,3708},{382,3894,3689},
+    {443,3932,3672},{501,3972,3658},{556,4014,3647},{609,4058,3639},{658,4103,3633}
+  },
+  {  // +30
+    {619,4321,3714},{670,4362,3711},{718,4403,3709},{764,4445,3711},{806,4487,3714},{846,4529,3720},{883,4571,3727},{917,4612,3737},
+    {949,4652,3749},{979,4692,3762},{1007,4730,3777},{1033,4769,3793},{1057,4806,3811},{1079,4843,3831},{1100,4879,3852},{1119,4915,3875},
+    {1136,4950,3899},{1152,4986,3925},{1166,5021,3952},{1179,5056,3980},{1189,5091,4010},{1197,5127,4041},{1202,5163,4073},{1205,5199,4107},
+    {1204,5236,4141},{1199,5274,4177},{1190,5312,4213},{1176,5351,4249},{1157,5390,4285},{1132,5430,4322},{1101,5469,4358},{1064,5509,4393},
+    {1019,5548,4427},{968,5587,4460},{909,5624,4490},{843,5660,4519},{769,5695,4545},{688,5727,4568},{600,5757,4589},{504,5783,4606},
+    {402,5807,4619},{295,5826,4629},{182,5841,4634},{64,5851,4637},{-56,5857,4635},{-179,5857,4629},{-303,5851,4620},{-426,5840,4607},
+    {-548,5822,4591},{-667,5799,4571},{-782,5769,4549},{-892,5733,4524},{-995,5691,4496},{-1090,5643,4467},{-1177,5589,4436},{-1255,5530,4403},
+    {-1323,5465,4370},{-1380,5396,4336},{-1427,5323,4301},{-1463,5246,4267},{-1488,5166,4233},{-1502,5084,4200},{-1506,5000,4167},{-1500,4915,4136},
+    {-1484,4829,4106},{-1459,4744,4078},{-1425,4660,4052},{-1384,4578,4028},{-1335,4499,4006},{-1280,4423,3987},{-1220,4350,3970},{-1154,4283,3956},
+    {-1085,4220,3944},{-1012,4163,3935},{-937,4111,3928},{-860,4066,3924},{-782,4027,3922},{-704,3994,3923},{-627,3967,3926},{-550,3947,3931},
+    {-476,3932,3938},{-403,3923,3947},{-333,3919,3958},{-265,3920,3970},{-201,3925,3984},{-140,3934,3999},{-82,3947,4015},{-28,3963,4032},
+    {23,3982,4050},{71,4003,4069},{116,4027,4088},{157,4052,4107},{195,4078,4126},{231,4106,4146},{264,4135,4166},{294,4164,4186},
+    {322,4195,4206},{347,4226,4226},{371,4257,4246},{392,4289,4266},{410,4322,4286},{427,4354,4306},{441,4387,4327},{453,4419,4347},
+    {462,4452,4368},{469,4484,4389},{473,4515,4411},{475,4545,4432},{474,4575,4454},{470,4603,4477},{464,4630,4500},{455,4655,4523},
+    {444,4679,4547},{432,4700,4571},{417,4719,4595},{401,4736,4619},{383,4751,4644},{365,4763,4670},{346,4773,4695},{327,4781,4720},
+    {307,4787,4746},{288,4791,4772},{269,4793,4798},{251,4795,4824},{233,4795,4850},{215,4795,4875},{197,4794,4900},{179,4792,4925},
+    {161,4791,4949},{143,4790,4973},{123,4789,4995},{103,4789,5016},{80,4788,5036},{56,4788,5053},{30,4788,5069},{1,4788,5083},
+    {-31,4788,5093},{-65,4787,5101},{-102,4785,5106},{-142,4782,5108},{-184,4776,5106},{-229,4769,5100},{-274,4760,5090},{-322,4747,5076},
+    {-369,4732,5058},{-416,4714,5036},{-462,4692,5010},{-506,4666,4980},{-547,4638,4947},{-585,4606,4909},{-618,4571,4869},{-647,4533,4825},
+    {-669,4494,4779},{-685,4452,4730},{-695,4409,4680},{-697,4366,4627},{-692,4322,4574},{-680,4279,4520},{-661,4237,4465},{-635,4198,4411},
+    {-602,4161,4357},{-563,4127,4303},{-518,4096,4251},{-467,4070,4200},{-412,4049,4151},{-353,4032,4104},{-290,4021,4058},{-225,4014,4016},
+    {-157,4013,3976},{-88,4017,3938},{-18,4026,3903},{52,4040,3871},{122,4059,3842},{190,4081,3816},{258,4107,3793},{324,4137,3773},
+    {388,4170,3755},{450,4205,3741},{509,4242,3729},{566,4281,3720},{619,4321,3714}
+  },
+  {  // +32
+    {580,4529,3804},{635,4566,3800},{688,4604,3798},{737,4643,3799},{784,4682,3803},{829,4721,3809},{870,4760,3816},{910,4799,3826},
+    {946,4838,3838},{981,4876,3852},{1013,4914,3867},{1043,4951,3884},{1071,4988,3903},{1098,5024,3924},{1122,5061,3946},{1145,5096,3970},
+    {1166,5132,3995},{1185,5168,4022},{1202,5203,4050},{1217,5239,4080},{1230,5275,4111},{1240,5311,4144},{1247,5348,4177},{1251,5385,4212},
+    {1251,5423,4248},{1246,5462,4285},{1237,5501,4323},{1223,5540,4360},{1204,5580,4398},{1178,5621,4436},{1145,5661,4473},{1106,5701,4510},
+    {1059,5740,4545},{1005,5779,4578},{943,5816,4610},{872,5852,4640},{794,5886,4666},{709,5918,4690},{615,5947,4711},{515,5973,4729},
+    {408,5995,4742},{295,6013,4752},{177,6027,4758},{55,6036,4761},{-70,6040,4759},{-197,6038,4753},{-324,6032,4744},{-450,6019,4731},
+    {-573,6001,4714},{-693,5977,4695},{-808,5947,4672},{-917,5911,4647},{-1019,5870,4619},{-1113,5823,4589},{-1197,5772,4558},{-1272,5715,4525},
+    {-1337,5654,4492},{-1391,5589,4457},{-1434,5521,4423},{-1467,5450,4388},{-1489,5376,4354},{-1500,5300,4320},{-1502,5223,4287},{-1493,5145,4256},
+    {-1475,5067,4226},{-1448,4990,4197},{-1413,4914,4170},{-1371,4840,4146},{-1322,4769,4123},{-1266,4701,4103},{-1206,4636,4085},{-1140,4576,4070},
+    {-1071,4520,4057},{-999,4469,4047},{-924,4424,4039},{-848,4384,4034},{-771,4349,4031},{-694,4321,4030},{-617,4298,4031},{-541,4280,4035},
+    {-467,4268,4041},{-395,4260,4049},{-325,4258,4058},{-257,4260,4069},{-193,4265,4081},{-131,4275,4095},{-73,4288,4110},{-19,4304,4126},
+    {33,4322,4143},{81,4342,4160},{126,4364,4178},{168,4388,4196},{207,4413,4215},{243,4440,4234},{277,4467,4253},{308,4494,4273},
+    {336,4523,4292},{363,4552,4312},{386,4581,4332},{408,4610,4352},{428,4640,4372},{445,4670,4392},{460,4699,4413},{473,4729,4433},
+    {483,4758,4454},{491,4787,4475},{497,4816,4497},{500,4843,4519},{500,4870,4541},{498,4895,4564},{494,4919,4587},{488,4942,4611},
+    {479,4963,4635},{468,4983,4660},{456,5000,4684},{442,5016,4710},{427,5030,4735},{410,5041,4761},{393,5051,4787},{375,5059,4814},
+    {357,5066,4841},{339,5070,4868},{321,5074,4895},{302,5077,4922},{283,5078,4949},{265,5079,4976},{246,5080,5002},{226,5080,5028},
+    {206,5081,5054},{185,5081,5079},{162,5082,5102},{138,5082,5125},{111,5083,5145},{83,5084,5164},{52,5084,5181},{18,5085,5195},
+    {-19,5085,5207},{-58,5083,5216},{-101,5081,5221},{-146,5077,5223},{-193,5072,5222},{-243,5064,5216},{-294,5053,5207},{-345,5040,5193},
+    {-397,5024,5175},{-449,5004,5153},{-499,4982,5127},{-546,4956,5097},{-591,4926,5063},{-632,4894,5025},{-668,4859,4984},{-698,4821,4940},
+    {-723,4781,4893},{-741,4739,4844},{-752,4696,4792},{-756,4653,4739},{-753,4609,4685},{-742,4566,4630},{-724,4524,4574},{-699,4484,4519},
+    {-668,4446,4464},{-629,4411,4409},{-585,4379,4356},{-536,4351,4304},{-481,4327,4253},{-422,4308,4205},{-360,4294,4159},{-294,4284,4115},
+    {-226,4279,4074},{-157,4279,4035},{-86,4283,3999},{-15,4292,3966},{57,4306,3936},{128,4323,3910},{198,4345,3886},{266,4369,3865},
+    {334,4397,3847},{399,4427,3832},{461,4459,3820},{522,4493,3810},{580,4529,3804}
+  },
+  {  // +34
+    {540,4730,3900},{599,4763,3896},{656,4798,3895},{710,4833,3895},{762,4869,3899},{811,4905,3904},{857,4942,3912},{901,4979,3922},
+    {942,5016,3934},{981,5053,3948},{1018,5089,3964},{1052,5126,3981},{1085,5162,4001},{1115,5198,4022},{1144,5234,4045},{1170,5270,4069},
+    {1195,5306,4095},{1217,5341,4123},{1237,5377,4152},{1255,5414,4183},{1270,5450,4216},{1283,5487,4249},{1292,5525,4284},{1297,5563,4320},
+    {1298,5602,4357},{1295,5641,4395},{1286,5681,4434},{1272,5722,4473},{1252,5762,4511},{1225,5803,4550},{1191,5844,4588},{1150,5884,4625},
+    {1101,5924,4661},{1043,5963,4696},{978,6001,4728},{904,6036,4758},{822,6070,4786},{731,6101,4810},{633,6130,4831},{527,6155,4849},
+    {415,6176,4863},{296,6193,4873},{173,6206,4879},{46,6214,4882},{-83,6217,4880},{-214,6214,4874},{-344,6206,4865},{-473,6193,4852},
+    {-599,6174,4835},{-720,6150,4816},{-836,6120,4793},{-944,6085,4767},{-1045,6045,4740},{-1137,5999,4710},{-1220,5950,4678},{-1292,5896,4646},
+    {-1354,5838,4612},{-1406,5777,4577},{-1446,5713,4542},{-1476,5647,4508},{-1495,5578,4473},{-1504,5508,4439},{-1503,5438,4406},{-1492,5367,4374},
+    {-1472,5296,4344},{-1444,5226,4315},{-1408,5157,4288},{-1364,5091,4263},{-1314,5027,4240},{-1259,4965,4219},{-1198,4908,4200},{-1133,4854,4184},
+    {-1064,4804,4170},{-992,4759,4159},{-918,4719,4149},{-842,4684,4143},{-766,4653,4138},{-689,4628,4136},{-613,4608,4137},{-538,4593,4139},
+    {-464,4583,4143},{-391,4577,4149},{-321,4575,4157},{-254,4578,4167},{-189,4584,4178},{-127,4594,4190},{-69,4606,4203},{-13,4621,4218},
+    {39,4639,4233},{88,4658,4250},{134,4679,4266},{177,4702,4284},{217,4725,4302},{254,4750,4320},{289,4775,4338},{321,4801,4357},
+    {350,4828,4376},{378,4854,4396},{403,4881,4415},{425,4908,4435},{446,4936,4455},{464,4963,4475},{481,4990,4495},{495,5017,4516},
+    {507,5044,4537},{516,5070,4558},{523,5095,4580},{528,5120,4602},{531,5144,4625},{531,5167,4648},{529,5189,4672},{524,5210,4696},
+    {518,5229,4720},{510,5247,4745},{499,5263,4771},{488,5278,4797},{475,5291,4823},{460,5302,4850},{445,5312,4878},{429,5320,4905},
+    {412,5327,4933},{394,5333,4961},{376,5337,4990},{358,5341,5018},{339,5344,5046},{319,5347,5075},{299,5349,5103},{277,5351,5130},
+    {254,5353,5157},{230,5355,5183},{204,5357,5208},{176,5358,5231},{145,5360,5253},{112,5362,5273},{76,5363,5291},{37,5364,5306},
+    {-5,5364,5319},{-50,5363,5328},{-98,5360,5335},{-149,5356,5337},{-201,5350,5336},{-256,5341,5331},{-312,5330,5322},{-369,5316,5308},
+    {-426,5299,5291},{-481,5279,5269},{-535,5256,5243},{-587,5229,5212},{-635,5200,5178},{-679,5167,5141},{-718,5131,5099},{-751,5093,5055},
+    {-777,5053,5008},{-798,5011,4958},{-811,4968,4906},{-816,4925,4853},{-814,4881,4798},{-805,4838,4742},{-788,4795,4686},{-764,4755,4630},
+    {-733,4716,4574},{-696,4680,4519},{-653,4647,4465},{-604,4618,4412},{-549,4592,4361},{-491,4571,4312},{-429,4553,4265},{-363,4540,4220},
+    {-295,4532,4178},{-224,4528,4139},{-153,4529,4102},{-80,4534,4069},{-7,4543,4038},{66,4555,4010},{138,4572,3986},{209,4592,3964},
+    {279,4615,3945},{347,4640,3930},{414,4668,3917},{478,4698,3907},{540,4730,3900}
+  },
+  {  // +36
+    {500,4924,4004},{563,4954,4000},{624,4985,3998},{682,5017,3998},{738,5050,4001},{791,5084,4006},{842,5118,4014},{890,5153,4024},
+    {936,5188,4036},{980,5224,4050},{1021,5259,4066},{1060,5295,4084},{1096,5330,4103},{1131,5366,4125},{1163,5401,4148},{1194,5437,4173},
+    {1222,5473,4200},{1248,5509,4228},{1271,5545,4258},{1292,5582,4290},{1310,5619,4323},{1325,5657,4357},{1336,5696,4393},{1343,5735,4430},
+    {1346,5774,4468},{1343,5814,4506},{1335,5855,4545},{1321,5896,4585},{1301,5937,4624},{1273,5979,4664},{1238,6020,4702},{1195,6061,4740},
+    {1144,6101,4776},{1084,6140,4811},{1015,6178,4844},{937,6213,4874},{850,6247,4902},{755,6278,4926},{652,6306,4948},{541,6330,4965},
+    {423,6351,4979},{299,6367,4990},{171,6379,4996},{39,6386,4998},{-95,6388,4997},{-230,6385,4991},{-365,6376,4982},{-497,6362,4969},
+    {-625,6343,4952},{-748,6318,4933},{-864,6289,4910},{-973,6254,4885},{-1074,6215,4857},{-1164,6171,4827},{-1245,6124,4796},{-1316,6072,4763},
+    {-1376,6017,4729},{-1425,5960,4695},{-1462,5900,4660},{-1490,5838,4625},{-1506,5775,4590},{-1513,5710,4556},{-1509,5645,4523},{-1496,5580,4491},
+    {-1475,5515,4460},{-1445,5452,4431},{-1408,5390,4404},{-1364,5330,4378},{-1313,5272,4354},{-1257,5217,4333},{-1196,5165,4313},{-1131,5117,4296},
+    {-1063,5073,4281},{-991,5033,4269},{-918,4997,4259},{-843,4966,4251},{-767,4940,4245},{-691,4918,4241},{-615,4900,4240},{-540,4887,4241},
+    {-466,4878,4244},{-393,4874,4248},{-323,4873,4254},{-255,4876,4262},{-190,4882,4272},{-128,4891,4283},{-68,4903,4295},{-12,4918,4308},
+    {42,4934,4322},{92,4952,4337},{139,4972,4352},{184,4993,4368},{225,5015,4385},{264,5038,4403},{300,5062,4420},{333,5086,4438},
+    {364,5110,4457},{393,5135,4476},{420,5160,4495},{444,5185,4514},{466,5210,4534},{486,5235,4554},{504,5260,4574},{520,5284,4595},
+    {533,5308,4616},{544,5332,4637},{554,5355,4659},{560,5378,4682},{565,5400,4705},{567,5420,4728},{568,5440,4752},{566,5459,4777},
+    {562,5477,4802},{556,5493,4828},{548,5508,4854},{539,5522,4881},{528,5535,4909},{515,5546,4937},{502,5556,4965},{487,5564,4994},
+    {471,5572,5023},{455,5579,5052},{437,5584,5082},{418,5589,5112},{399,5594,5141},{378,5598,5171},{356,5602,5200},{332,5605,5229},
+    {307,5609,5257},{279,5612,5285},{249,5615,5311},{217,5618,5336},{182,5621,5359},{144,5624,5380},{103,5626,5398},{58,5627,5414},
+    {11,5627,5428},{-40,5626,5438},{-94,5624,5445},{-150,5619,5448},{-209,5613,5447},{-269,5604,5443},{-331,5592,5434},{-393,5577,5421},
+    {-454,5560,5403},{-515,5539,5382},{-573,5515,5356},{-628,5488,5326},{-680,5458,5292},{-727,5425,5255},{-768,5389,5213},{-804,5351,5169},
+    {-833,5311,5122},{-855,5269,5072},{-869,5226,5021},{-877,5183,4967},{-876,5139,4912},{-868,5096,4856},{-852,5053,4800},{-829,5012,4744},
+    {-799,4973,4688},{-762,4936,4632},{-719,4903,4578},{-671,4872,4524},{-617,4844,4473},{-559,4821,4423},{-496,4801,4376},{-430,4786,4331},
+    {-361,4774,4288},{-290,4767,4248},{-218,4764,4211},{-144,4765,4177},{-69,4770,4145},{5,4779,4117},{80,4791,4092},{153,4806,4070},
+    {226,4825,4051},{297,4846,4035},{366,4870,4022},{434,4896,4012},{500,4924,4004}
+  },
+  {  // +38
+    {460,5113,4114},{527,5140,4109},{591,5167,4107},{654,5197,4107},{714,5227,4110},{771,5258,4115},{826,5291,4122},{879,5323,4132},
+    {929,5357,4143},{977,5391,4157},{1022,5425,4173},{1066,5459,4191},{1107,5494,4211},{1145,5529,4232},{1182,5564,4256},{1216,5600,4281},
+    {1248,5635,4308},{1277,5672,4337},{1304,5708,4367},{1328,5746,4399},{1349,5783,4432},{1366,5822,4467},{1379,5861,4503},{1388,5900,4540},
+    {1393,5940,4578},{1391,5981,4617},{1384,6023,4657},{1371,6064,4697},{1350,6106,4736},{1322,6148,4776},{1286,6190,4814},{1241,6231,4852},
+    {1188,6271,4889},{1125,6311,4923},{1053,6348,4956},{971,6384,4986},{880,6417,5014},{781,6448,5038},{672,6476,5060},{556,6499,5077},
+    {433,6519,5091},{303,6535,5102},{169,6546,5108},{32,6552,5110},{-108,6554,5109},{-247,6550,5103},{-386,6541,5094},{-521,6526,5081},
+    {-652,6507,5065},{-777,6482,5045},{-895,6453,5023},{-1004,6419,4998},{-1104,6381,4970},{-1195,6339,4941},{-1275,6293,4909},{-1343,6244,4877},
+    {-1401,6192,4843},{-1448,6138,4809},{-1484,6082,4774},{-1509,6024,4739},{-1523,5965,4705},{-1527,5905,4671},{-1522,5845,4637},{-1508,5786,4605},
+    {-1485,5727,4574},{-1454,5669,4545},{-1415,5612,4517},{-1370,5558,4491},{-1319,5506,4467},{-1263,5457,4444},{-1202,5410,4424},{-1137,5367,4406},
+    {-1069,5328,4390},{-997,5292,4377},{-924,5260,4365},{-850,5232,4356},{-774,5209,4349},{-698,5189,4344},{-622,5174,4341},{-547,5163,4341},
+    {-473,5155,4342},{-401,5152,4345},{-330,5151,4349},{-262,5154,4356},{-196,5160,4363},{-132,5169,4373},{-72,5180,4383},{-14,5194,4394},
+    {41,5209,4407},{93,5226,4421},{142,5244,4435},{188,5264,4450},{231,5284,4466},{272,5306,4482},{309,5328,4499},{345,5350,4516},
+    {378,5372,4534},{409,5395,4552},{437,5418,4570},{463,5441,4589},{488,5464,4609},{510,5487,4628},{529,5510,4649},{547,5532,4669},
+    {563,5554,4691},{577,5576,4712},{588,5597,4735},{597,5617,4757},{604,5637,4781},{609,5656,4805},{612,5674,4829},{613,5692,4855},
+    {611,5708,4881},{608,5724,4907},{602,5738,4934},{595,5751,4962},{587,5763,4991},{576,5774,5020},{565,5784,5049},{551,5794,5079},
+    {537,5802,5109},{521,5810,5140},{503,5816,5171},{484,5823,5202},{464,5829,5233},{442,5834,5264},{418,5840,5295},{392,5845,5325},
+    {363,5850,5354},{333,5854,5383},{299,5859,5410},{262,5863,5436},{222,5867,5460},{179,5871,5482},{133,5873,5501},{82,5875,5518},
+    {29,5876,5532},{-28,5875,5543},{-88,5872,5551},{-151,5868,5554},{-215,5861,5554},{-282,5852,5550},{-349,5839,5542},{-416,5825,5529},
+    {-483,5806,5512},{-548,5785,5491},{-611,5761,5466},{-670,5734,5436},{-725,5703,5403},{-775,5670,5365},{-820,5634,5325},{-858,5596,5281},
+    {-889,5556,5234},{-913,5514,5185},{-929,5471,5134},{-937,5428,5080},{-938,5384,5026},{-931,5341,4970},{-916,5299,4914},{-893,5257,4858},
+    {-864,5218,4802},{-828,5181,4747},{-785,5146,4692},{-737,5114,4639},{-683,5085,4588},{-625,5060,4538},{-562,5038,4490},{-496,5020,4445},
+    {-427,5006,4402},{-355,4996,4362},{-281,4990,4325},{-206,4988,4290},{-130,4989,4258},{-54,4994,4230},{23,5003,4204},{99,5014,4182},
+    {174,5029,4162},{248,5046,4146},{320,5067,4132},{391,5089,4122},{460,5113,4114}
+  },
+  {  // +40
+    {421,5299,4229},{491,5322,4224},{559,5347,4221},{625,5373,4221},{689,5401,4223},{751,5430,4228},{810,5460,4235},{866,5491,4244},
+    {921,5522,4256},{973,5555,4269},{1023,5588,4285},{1070,5621,4303},{1115,5655,4322},{1158,5689,4344},{1199,5724,4367},{1237,5759,4392},
+    {1273,5795,4419},{1306,5831,4448},{1336,5868,4478},{1363,5905,4510},{1387,5943,4543},{1406,5982,4578},{1422,6021,4614},{1433,6061,4651},
+    {1439,6102,4689},{1439,6143,4728},{1433,6185,4767},{1420,6227,4807},{1399,6270,4846},{1371,6312,4886},{1334,6354,4924},{1288,6396,4961},
+    {1232,6436,4998},{1167,6475,5032},{1092,6513,5064},{1007,6549,5094},{912,6582,5121},{807,6612,5145},{694,6639,5166},{572,6663,5184},
+    {443,6682,5198},{308,6698,5208},{168,6708,5214},{25,6714,5216},{-120,6715,5215},{-264,6710,5210},{-407,6701,5200},{-546,6686,5188},
+    {-680,6667,5172},{-808,6643,5152},{-927,6614,5130},{-1038,6581,5105},{-1139,6543,5078},{-1229,6503,5049},{-1308,6459,5018},{-1376,6412,4986},
+    {-1432,6363,4952},{-1477,6311,4918},{-1511,6258,4884},{-1534,6204,4849},{-1546,6149,4815},{-1549,6094,4781},{-1542,6039,4748},{-1526,5984,4716},
+    {-1501,5930,4685},{-1469,5877,4655},{-1430,5825,4627},{-1384,5776,4600},{-1333,5729,4576},{-1276,5684,4553},{-1215,5642,4532},{-1150,5604,4513},
+    {-1081,5568,4496},{-1010,5536,4482},{-937,5508,4469},{-863,5483,4459},{-787,5462,4450},{-712,5445,4444},{-636,5431,4440},{-561,5421,4437},
+    {-486,5415,4437},{-413,5411,4438},{-342,5411,4441},{-273,5414,4446},{-206,5420,4452},{-141,5428,4459},{-79,5438,4468},{-20,5451,4478},
+    {36,5465,4489},{90,5481,4501},{141,5497,4514},{189,5515,4528},{235,5534,4542},{278,5554,4558},{318,5574,4573},{356,5594,4590},
+    {391,5615,4607},{425,5636,4624},{456,5657,4642},{484,5678,4661},{511,5699,4680},{535,5720,4699},{558,5741,4719},{578,5762,4740},
+    {596,5782,4761},{613,5801,4783},{627,5821,4806},{639,5840,4829},{648,5858,4853},{656,5875,4877},{662,5892,4903},{665,5909,4929},
+    {666,5924,4955},{666,5939,4983},{663,5952,5011},{658,5965,5039},{652,5977,5069},{644,5989,5099},{634,5999,5130},{622,6009,5161},
+    {608,6018,5192},{593,6027,5224},{575,6035,5256},{556,6043,5289},{535,6050,5321},{511,6057,5353},{485,6064,5385},{457,6070,5416},
+    {425,6077,5447},{391,6083,5477},{353,6089,5505},{312,6095,5531},{267,6100,5556},{218,6104,5579},{165,6107,5599},{109,6110,5617},
+    {49,6111,5632},{-14,6110,5643},{-81,6107,5651},{-150,6103,5655},{-221,6096,5656},{-293,6086,5652},{-366,6074,5644},{-440,6059,5632},
+    {-512,6040,5616},{-582,6019,5595},{-649,5994,5570},{-712,5966,5541},{-771,5936,5509},{-824,5902,5472},{-872,5866,5432},{-912,5828,5389},
+    {-945,5788,5343},{-971,5747,5295},{-989,5704,5244},{-998,5661,5192},{-1000,5618,5138},{-993,5575,5083},{-979,5532,5028},{-957,5491,4972},
+    {-928,5452,4917},{-892,5414,4862},{-850,5378,4808},{-802,5346,4755},{-748,5316,4704},{-689,5289,4655},{-626,5266,4607},{-560,5246,4562},
+    {-490,5230,4519},{-417,5217,4479},{-342,5208,4442},{-266,5203,4407},{-189,5202,4376},{-111,5203,4347},{-32,5208,4321},{46,5217,4299},
+    {123,5228,4279},{200,5242,4262},{275,5259,4248},{349,5278,4237},{421,5299,4229}
+  },
+  {  // +42
+    {383,5482,4348},{456,5502,4343},{528,5524,4340},{597,5548,4339},{665,5573,4341},{730,5600,4345},{793,5628,4352},{854,5657,4361},
+    {912,5686,4372},{968,5717,4385},{1022,5749,4400},{1074,5781,4417},{1123,5814,4437},{1170,5847,4458},{1214,5881,4481},{1256,5916,4506},
+    {1296,5951,4532},{1332,5987,4560},{1366,6024,4590},{1396,6061,4622},{1423,6100,4655},{1445,6139,4689},{1463,6178,4725},{1477,6219,4762},
+    {1484,6260,4799},{1486,6302,4838},{1481,6344,4876},{1468,6386,4915},{1448,6429,4954},{1419,6471,4992},{1382,6513,5030},{1334,6555,5067},
+    {1277,6596,5102},{1210,6635,5136},{1132,6673,5167},{1043,6708,5197},{944,6741,5223},{835,6771,5247},{716,6798,5267},{589,6821,5284},
+    {454,6840,5298},{313,6855,5308},{167,6865,5314},{18,6871,5316},{-132,6871,5314},{-283,6866,5309},{-430,6857,5300},{-574,6842,5288},
+    {-711,6823,5272},{-842,6799,5253},{-963,6770,5231},{-1075,6738,5207},{-1177,6702,5180},{-1267,6663,5151},{-1346,6620,5121},{-1413,6576,5089},
+    {-1468,6529,5056},{-1512,6480,5023},{-1544,6430,4989},{-1565,6379,4955},{-1576,6328,4921},{-1577,6277,4887},{-1569,6225,4854},{-1551,6175,4822},
+    {-1526,6125,4791},{-1493,6076,4761},{-1452,6029,4732},{-1406,5984,4706},{-1354,5941,4680},{-1297,5901,4657},{-1235,5863,4636},{-1170,5828,4616},
+    {-1102,5796,4598},{-1031,5767,4583},{-958,5742,4569},{-883,5719,4557},{-808,5700,4548},{-732,5685,4540},{-656,5673,4534},{-580,5663,4531},
+    {-505,5658,4528},{-432,5655,4528},{-359,5655,4529},{-289,5657,4532},{-221,5662,4537},{-155,5670,4543},{-91,5679,4550},{-30,5690,4558},
+    {29,5703,4568},{85,5717,4578},{138,5732,4590},{189,5749,4602},{237,5766,4615},{283,5784,4630},{326,5802,4644},{367,5821,4660},
+    {405,5840,4676},{441,5859,4693},{475,5879,4710},{507,5898,4728},{536,5917,4747},{564,5937,4766},{589,5956,4786},{613,5974,4807},
+    {634,5993,4829},{653,6011,4851},{670,6029,4873},{685,6046,4897},{698,6063,4921},{709,6080,4946},{717,6096,4972},{724,6111,4999},
+    {728,6126,5026},{730,6140,5054},{730,6153,5083},{728,6166,5113},{724,6178,5143},{718,6190,5175},{709,6201,5206},{699,6211,5239},
+    {686,6222,5271},{671,6231,5304},{654,6241,5338},{634,6250,5371},{612,6259,5405},{587,6267,5438},{558,6275,5471},{527,6284,5503},
+    {492,6292,5534},{454,6299,5565},{411,6306,5594},{365,6313,5621},{315,6319,5647},{260,6324,5670},{202,6329,5691},{139,6332,5709},
+    {72,6333,5724},{2,6333,5736},{-71,6330,5745},{-147,6326,5750},{-225,6319,5750},{-304,6309,5747},{-384,6296,5740},{-463,6281,5729},
+    {-540,6262,5713},{-616,6240,5693},{-688,6215,5669},{-755,6187,5641},{-818,6157,5609},{-874,6123,5574},{-924,6087,5535},{-967,6050,5493},
+    {-1002,6010,5448},{-1030,5969,5401},{-1049,5927,5351},{-1059,5884,5300},{-1062,5841,5247},{-1056,5798,5194},{-1042,5756,5139},{-1021,5715,5085},
+    {-992,5675,5030},{-956,5637,4977},{-913,5601,4923},{-865,5568,4872},{-811,5537,4821},{-752,5510,4772},{-688,5485,4726},{-621,5464,4681},
+    {-550,5446,4639},{-477,5431,4599},{-401,5420,4562},{-324,5412,4528},{-245,5408,4496},{-165,5407,4467},{-85,5409,4442},{-5,5415,4419},
+    {75,5423,4399},{153,5434,4382},{231,5448,4368},{308,5464,4357},{383,5482,4348}
+  },
+  {  // +44
+    {346,5663,4471},{423,5680,4465},{497,5700,4461},{570,5721,4460},{641,5744,4462},{710,5769,4465},{776,5794,4472},{841,5821,4480},
+    {903,5849,4490},{963,5879,4503},{1021,5909,4518},{1076,5940,4534},{1130,5971,4553},{1181,6004,4574},{1229,6037,4596},{1275,6071,4620},
+    {1318,6106,4646},{1358,6142,4674},{1395,6179,4703},{1428,6216,4734},{1458,6254,4766},{1483,6293,4800},{1504,6333,4835},{1519,6373,4871},
+    {1528,6414,4907},{1532,6456,4945},{1528,6498,4982},{1516,6541,5020},{1496,6584,5058},{1468,6626,5095},{1429,6668,5132},{1381,6710,5168},
+    {1322,6750,5202},{1253,6790,5234},{1172,6827,5265},{1080,6862,5293},{977,6895,5319},{863,6925,5341},{739,6952,5361},{607,6974,5378},
+    {466,6993,5391},{318,7008,5400},{166,7017,5406},{10,7023,5408},{-146,7023,5406},{-302,7018,5401},{-455,7008,5392},{-603,6993,5380},
+    {-745,6974,5365},{-879,6951,5346},{-1003,6923,5325},{-1117,6892,5301},{-1219,6857,5275},{-1310,6819,5247},{-1389,6778,5217},{-1456,6735,5186},
+    {-1510,6691,5154},{-1553,6645,5121},{-1584,6597,5088},{-1604,6550,5054},{-1614,6501,5020},{-1613,6453,4987},{-1603,6406,4954},{-1585,6359,4922},
+    {-1558,6313,4891},{-1524,6268,4862},{-1483,6225,4833},{-1436,6183,4806},{-1383,6144,4781},{-1326,6107,4757},{-1264,6073,4735},{-1198,6041,4714},
+    {-1129,6012,4696},{-1058,5985,4679},{-985,5962,4665},{-910,5942,4652},{-834,5925,4641},{-758,5910,4632},{-681,5899,4625},{-605,5891,4620},
+    {-530,5885,4616},{-455,5882,4614},{-382,5882,4614},{-310,5884,4615},{-240,5888,4618},{-172,5895,4622},{-106,5903,4628},{-43,5913,4634},
+    {18,5924,4642},{77,5937,4652},{133,5951,4662},{187,5966,4673},{238,5981,4685},{286,5998,4698},{333,6014,4712},{377,6031,4726},
+    {419,6049,4742},{458,6066,4758},{495,6084,4775},{531,6102,4792},{564,6120,4811},{595,6137,4830},{624,6155,4850},{651,6172,4870},
+    {675,6189,4892},{698,6206,4914},{719,6223,4937},{737,6239,4961},{753,6255,4986},{768,6270,5012},{779,6285,5038},{789,6300,5065},
+    {797,6314,5093},{802,6328,5122},{805,6341,5152},{805,6354,5183},{803,6367,5214},{799,6379,5246},{793,6391,5279},{783,6402,5312},
+    {772,6413,5346},{757,6424,5380},{740,6435,5414},{719,6445,5449},{696,6456,5483},{669,6466,5517},{638,6476,5551},{603,6485,5584},
+    {565,6495,5616},{522,6504,5647},{475,6512,5677},{424,6520,5705},{368,6527,5731},{307,6533,5754},{242,6538,5776},{172,6542,5794},
+    {98,6544,5810},{21,6544,5822},{-60,6541,5831},{-143,6537,5836},{-228,6530,5838},{-314,6520,5835},{-400,6507,5829},{-486,6491,5818},
+    {-569,6473,5803},{-650,6451,5784},{-727,6426,5761},{-799,6398,5734},{-865,6367,5703},{-925,6334,5669},{-978,6298,5631},{-1023,6260,5591},
+    {-1060,6221,5547},{-1089,6180,5501},{-1109,6139,5454},{-1120,6096,5404},{-1123,6054,5353},{-1118,6011,5301},{-1104,5970,5248},{-1083,5929,5195},
+    {-1054,5889,5142},{-1018,5852,5089},{-975,5816,5038},{-927,5782,4987},{-872,5751,4938},{-813,5722,4890},{-749,5697,4844},{-681,5674,4800},
+    {-609,5655,4759},{-535,5639,4720},{-458,5626,4683},{-379,5616,4649},{-299,5610,4618},{-218,5606,4590},{-136,5606,4564},{-54,5609,4542},
+    {28,5615,4522},{109,5623,4505},{189,5634,4491},{269,5647,4479},{346,5663,4471}
+  },
+  {  // +46
+    {311,5842,4595},{390,5857,4588},{468,5875,4584},{544,5894,4583},{618,5914,4584},{690,5937,4587},{760,5961,4593},{828,5986,4601},
+    {894,6012,4611},{958,6040,4623},{1019,6068,4637},{1079,6098,4653},{1136,6129,4670},{1190,6160,4690},{1243,6193,4712},{1292,6226,4735},
+    {1339,6260,4760},{1382,6296,4787},{1422,6332,4815},{1459,6369,4845},{1492,6407,4876},{1520,6445,4909},{1543,6485,4943},{1560,6525,4977},
+    {1572,6567,5013},{1576,6608,5049},{1574,6650,5085},{1563,6693,5121},{1544,6735,5158},{1515,6778,5194},{1477,6819,5229},{1428,6861,5263},
+    {1367,6901,5295},{1296,6940,5327},{1212,6977,5356},{1117,7012,5383},{1010,7045,5407},{891,7074,5429},{762,7100,5448},{624,7123,5463},
+    {477,7141,5475},{323,7155,5484},{164,7165,5490},{1,7170,5492},{-162,7170,5490},{-324,7165,5485},{-483,7155,5476},{-636,7141,5464},
+    {-782,7122,5449},{-920,7099,5431},{-1047,7072,5411},{-1163,7041,5388},{-1268,7007,5362},{-1359,6971,5335},{-1439,6932,5306},{-1505,6891,5276},
+    {-1559,6848,5244},{-1601,6804,5212},{-1632,6760,5180},{-1651,6715,5147},{-1659,6669,5114},{-1657,6624,5081},{-1646,6580,5049},{-1627,6536,5017},
+    {-1599,6493,4986},{-1564,6452,4957},{-1522,6412,4928},{-1474,6374,4901},{-1421,6338,4875},{-1362,6304,4851},{-1300,6272,4828},{-1234,6243,4808},
+    {-1165,6216,4788},{-1093,6192,4771},{-1019,6170,4755},{-944,6152,4742},{-868,6136,4730},{-791,6122,4719},{-713,6112,4711},{-636,6104,4704},
+    {-560,6098,4699},{-484,6095,4696},{-409,6095,4694},{-336,6096,4694},{-264,6100,4695},{-194,6105,4698},{-126,6112,4702},{-60,6121,4707},
+    {4,6131,4714},{66,6142,4721},{125,6154,4730},{182,6168,4740},{237,6181,4751},{289,6196,4763},{339,6211,4776},{387,6227,4789},
+    {433,6242,4804},{476,6258,4819},{517,6275,4836},{557,6291,4853},{594,6307,4871},{629,6323,4890},{662,6340,4910},{692,6356,4931},
+    {721,6372,4952},{748,6387,4974},{772,6403,4998},{795,6418,5022},{815,6433,5047},{833,6448,5073},{848,6463,5100},{861,6477,5128},
+    {872,6491,5157},{881,6505,5187},{886,6518,5217},{890,6532,5249},{890,6545,5281},{888,6557,5314},{883,6570,5347},{875,6582,5381},
+    {864,6595,5416},{850,6607,5451},{833,6619,5486},{811,6631,5521},{786,6642,5556},{757,6654,5591},{724,6665,5625},{687,6676,5658},
+    {644,6687,5691},{597,6698,5722},{545,6707,5752},{488,6716,5781},{426,6724,5807},{358,6731,5831},{286,6737,5853},{209,6741,5871},
+    {128,6744,5887},{42,6744,5900},{-46,6742,5909},{-137,6738,5915},{-230,6731,5917},{-323,6721,5915},{-416,6708,5909},{-508,6692,5899},
+    {-598,6673,5885},{-684,6651,5867},{-766,6626,5845},{-842,6598,5819},{-913,6568,5790},{-976,6535,5757},{-1032,6499,5721},{-1079,6462,5682},
+    {-1118,6423,5640},{-1148,6383,5596},{-1169,6342,5550},{-1182,6300,5502},{-1185,6258,5453},{-1180,6216,5403},{-1166,6175,5352},{-1145,6135,5301},
+    {-1116,6096,5250},{-1079,6058,5199},{-1036,6022,5149},{-987,5988,5100},{-932,5957,5052},{-872,5928,5006},{-807,5902,4962},{-738,5879,4919},
+    {-666,5858,4879},{-590,5841,4841},{-512,5827,4805},{-432,5815,4772},{-350,5807,4741},{-268,5802,4713},{-184,5799,4688},{-101,5800,4666},
+    {-17,5803,4646},{66,5809,4629},{149,5818,4615},{231,5829,4604},{311,5842,4595}
+  },
+  {  // +48
+    {277,6020,4719},{359,6034,4712},{439,6049,4708},{518,6066,4706},{595,6085,4707},{671,6105,4710},{744,6127,4715},{816,6150,4722},
+    {885,6175,4731},{952,6201,4742},{1018,6228,4755},{1081,6257,4770},{1141,6286,4787},{1200,6317,4806},{1256,6348,4827},{1309,6381,4849},
+    {1359,6414,4873},{1406,6449,4899},{1449,6484,4926},{1489,6521,4954},{1524,6558,4984},{1555,6596,5015},{1580,6636,5047},{1600,6676,5080},
+    {1614,6716,5114},{1620,6758,5148},{1619,6799,5183},{1610,6841,5218},{1591,6883,5252},{1563,6925,5286},{1524,6967,5319},{1474,7008,5352},
+    {1412,7048,5383},{1338,7086,5412},{1252,7123,5439},{1153,7157,5465},{1042,7189,5488},{919,7219,5508},{785,7244,5526},{640,7267,5540},
+    {487,7285,5552},{326,7298,5560},{159,7308,5565},{-10,7312,5566},{-180,7312,5565},{-349,7307,5559},{-514,7298,5551},{-673,7284,5540},
+    {-825,7265,5525},{-966,7242,5508},{-1097,7216,5488},{-1216,7187,5466},{-1322,7154,5441},{-1416,7119,5415},{-1496,7081,5387},{-1562,7042,5357},
+    {-1616,7001,5327},{-1658,6960,5296},{-1687,6917,5264},{-1706,6875,5232},{-1713,6832,5200},{-1710,6790,5167},{-1698,6748,5136},{-1677,6707,5105},
+    {-1648,6667,5074},{-1612,6628,5045},{-1569,6591,5017},{-1521,6556,4989},{-1467,6522,4964},{-1408,6491,4939},{-1345,6461,4916},{-1278,6434,4895},
+    {-1208,6409,4875},{-1136,6387,4857},{-1061,6367,4841},{-985,6349,4826},{-908,6334,4813},{-830,6322,4802},{-752,6312,4792},{-673,6304,4784},
+    {-595,6298,4778},{-518,6295,4773},{-441,6294,4770},{-366,6295,4768},{-292,6297,4768},{-219,6301,4769},{-148,6307,4772},{-79,6315,4776},
+    {-12,6323,4781},{53,6333,4787},{116,6344,4795},{176,6355,4804},{235,6368,4814},{291,6381,4824},{346,6394,4836},{398,6408,4849},
+    {448,6423,4863},{495,6437,4878},{541,6452,4894},{585,6467,4911},{626,6482,4928},{666,6497,4947},{703,6512,4967},{738,6527,4987},
+    {772,6542,5009},{803,6556,5032},{831,6571,5055},{858,6586,5080},{882,6600,5105},{904,6615,5132},{924,6629,5159},{941,6643,5188},
+    {955,6657,5217},{967,6671,5247},{976,6685,5279},{982,6699,5311},{985,6712,5343},{985,6726,5377},{982,6739,5411},{976,6753,5446},
+    {965,6766,5481},{952,6780,5516},{934,6793,5552},{912,6806,5587},{885,6819,5623},{854,6832,5658},{818,6845,5692},{777,6858,5726},
+    {731,6870,5759},{679,6881,5790},{621,6892,5820},{558,6903,5849},{489,6912,5875},{415,6920,5899},{335,6926,5921},{250,6931,5940},
+    {161,6934,5956},{68,6934,5968},{-29,6933,5978},{-128,6928,5984},{-229,6921,5986},{-330,6912,5985},{-431,6899,5980},{-530,6883,5970},
+    {-626,6864,5957},{-719,6842,5941},{-806,6817,5920},{-887,6789,5896},{-961,6759,5868},{-1028,6726,5837},{-1086,6691,5803},{-1136,6655,5766},
+    {-1176,6616,5726},{-1208,6577,5684},{-1230,6536,5640},{-1243,6495,5595},{-1246,6454,5548},{-1241,6413,5500},{-1228,6373,5451},{-1206,6333,5402},
+    {-1176,6294,5353},{-1139,6257,5305},{-1096,6222,5257},{-1046,6188,5210},{-990,6157,5164},{-929,6128,5119},{-863,6102,5077},{-793,6078,5035},
+    {-720,6057,4996},{-643,6038,4960},{-564,6023,4925},{-483,6010,4893},{-400,6001,4863},{-316,5994,4836},{-231,5990,4812},{-145,5989,4790},
+    {-60,5990,4770},{26,5994,4754},{110,6000,4740},{194,6009,4728},{277,6020,4719}
+  },
+  {  // +50
+    {245,6198,4842},{329,6209,4835},{412,6222,4831},{494,6238,4829},{574,6254,4829},{652,6273,4831},{729,6293,4835},{804,6315,4841},
+    {876,6338,4850},{947,6363,4860},{1016,6388,4872},{1083,6415,4887},{1147,6444,4902},{1209,6473,4920},{1268,6503,4940},{1324,6535,4961},
+    {1378,6568,4983},{1428,6601,5007},{1475,6636,5033},{1517,6672,5060},{1556,6709,5088},{1589,6746,5117},{1617,6785,5148},{1639,6824,5179},
+    {1655,6864,5211},{1663,6905,5243},{1663,6946,5275},{1655,6987,5308},{1637,7029,5340},{1609,7070,5372},{1570,7111,5403},{1519,7151,5433},
+    {1456,7190,5462},{1380,7228,5490},{1292,7264,5515},{1190,7298,5539},{1074,7330,5560},{946,7358,5579},{806,7384,5595},{655,7406,5609},
+    {495,7423,5619},{327,7437,5627},{153,7446,5631},{-25,7450,5632},{-203,7450,5630},{-379,7445,5625},{-551,7436,5617},{-716,7422,5605},
+    {-873,7404,5591},{-1019,7382,5575},{-1154,7356,5556},{-1276,7327,5534},{-1385,7296,5511},{-1480,7262,5485},{-1561,7226,5459},{-1628,7188,5430},
+    {-1682,7150,5401},{-1723,7110,5371},{-1752,7070,5340},{-1770,7029,5309},{-1776,6989,5278},{-1772,6949,5246},{-1759,6909,5215},{-1737,6871,5185},
+    {-1707,6833,5155},{-1670,6797,5126},{-1626,6762,5098},{-1576,6729,5071},{-1521,6698,5046},{-1461,6669,5021},{-1397,6641,4998},{-1330,6616,4976},
+    {-1259,6592,4956},{-1186,6571,4938},{-1110,6553,4921},{-1033,6536,4905},{-955,6522,4891},{-875,6509,4879},{-796,6500,4868},{-716,6492,4859},
+    {-636,6486,4852},{-556,6482,4846},{-478,6480,4842},{-400,6480,4839},{-323,6482,4837},{-248,6485,4837},{-174,6490,4838},{-102,6496,4841},
+    {-31,6503,4845},{38,6511,4850},{105,6521,4857},{169,6531,4864},{232,6542,4873},{293,6553,4883},{352,6565,4894},{409,6578,4906},
+    {463,6590,4920},{516,6604,4934},{567,6617,4949},{615,6631,4966},{662,6644,4983},{706,6658,5001},{748,6672,5021},{789,6686,5042},
+    {827,6701,5063},{862,6715,5086},{896,6729,5110},{927,6743,5134},{956,6757,5160},{982,6771,5187},{1006,6786,5215},{1027,6800,5244},
+    {1045,6814,5273},{1061,6828,5304},{1073,6842,5336},{1082,6857,5368},{1088,6871,5401},{1091,6885,5435},{1089,6900,5470},{1084,6914,5505},
+    {1075,6929,5540},{1062,6943,5576},{1044,6958,5612},{1021,6973,5647},{993,6987,5683},{959,7002,5718},{921,7016,5752},{876,7030,5786},
+    {825,7043,5819},{768,7056,5850},{705,7068,5880},{636,7079,5908},{560,7090,5934},{478,7098,5958},{391,7105,5980},{297,7111,5999},
+    {199,7114,6015},{97,7115,6027},{-9,7114,6037},{-117,7110,6043},{-226,7103,6046},{-336,7093,6045},{-445,7081,6041},{-551,7065,6032},
+    {-655,7046,6021},{-753,7024,6005},{-846,7000,5986},{-932,6972,5963},{-1010,6942,5937},{-1080,6910,5908},{-1141,6875,5876},{-1193,6839,5841},
+    {-1235,6802,5804},{-1268,6763,5764},{-1291,6723,5723},{-1304,6683,5680},{-1308,6643,5635},{-1303,6603,5590},{-1289,6563,5544},{-1266,6524,5498},
+    {-1236,6486,5451},{-1199,6450,5405},{-1154,6415,5360},{-1103,6382,5315},{-1047,6351,5271},{-985,6322,5229},{-918,6296,5188},{-847,6272,5149},
+    {-773,6250,5111},{-695,6231,5076},{-615,6215,5043},{-532,6202,5012},{-448,6191,4983},{-362,6183,4957},{-276,6177,4933},{-188,6175,4912},
+    {-101,6175,4893},{-14,6177,4876},{73,6182,4863},{159,6189,4851},{245,6198,4842}
+  },
+  {  // +52
+    {214,6374,4962},{300,6384,4955},{386,6395,4951},{470,6409,4948},{553,6424,4948},{634,6441,4949},{714,6460,4953},{792,6480,4959},
+    {868,6501,4966},{942,6524,4975},{1015,6549,4987},{1085,6574,5000},{1152,6601,5014},{1218,6629,5031},{1280,6659,5049},{1340,6689,5068},
+    {1397,6721,5090},{1450,6753,5112},{1500,6787,5136},{1545,6822,5161},{1587,6858,5187},{1623,6895,5215},{1653,6932,5243},{1677,6971,5272},
+    {1695,7010,5301},{1705,7050,5331},{1707,7090,5362},{1699,7131,5392},{1682,7171,5422},{1654,7212,5451},{1615,7252,5480},{1564,7291,5508},
+    {1499,7329,5534},{1422,7366,5559},{1330,7402,5583},{1224,7435,5605},{1105,7466,5624},{972,7494,5641},{826,7519,5656},{668,7540,5668},
+    {500,7557,5677},{324,7570,5684},{142,7579,5687},{-44,7583,5688},{-230,7583,5686},{-414,7578,5681},{-593,7569,5673},{-766,7555,5662},
+    {-928,7538,5648},{-1080,7516,5632},{-1219,7491,5614},{-1345,7464,5593},{-1456,7433,5571},{-1553,7400,5547},{-1635,7366,5521},{-1703,7330,5494},
+    {-1757,7293,5466},{-1798,7255,5437},{-1827,7217,5407},{-1843,7178,5377},{-1849,7140,5347},{-1844,7102,5317},{-1830,7065,5287},{-1807,7028,5257},
+    {-1776,6993,5228},{-1737,6959,5200},{-1692,6926,5172},{-1641,6895,5146},{-1585,6866,5120},{-1524,6838,5096},{-1459,6812,5073},{-1390,6788,5051},
+    {-1318,6766,5031},{-1243,6746,5012},{-1166,6728,4995},{-1088,6712,4979},{-1008,6698,4964},{-927,6686,4951},{-845,6676,4940},{-763,6668,4930},
+    {-681,6662,4921},{-599,6658,4914},{-518,6656,4909},{-438,6655,4905},{-358,6655,4902},{-279,6658,4901},{-202,6661,4901},{-126,6666,4903},
+    {-52,6672,4906},{21,6678,4910},{92,6686,4915},{162,6695,4922},{229,6704,4930},{295,6714,4939},{359,6725,4949},{421,6736,4961},
+    {480,6748,4973},{538,6759,4987},{594,6772,5002},{648,6784,5018},{700,6797,5035},{750,6810,5053},{798,6823,5073},{843,6836,5093},
+    {886,6850,5115},{927,6863,5137},{966,6877,5161},{1002,6891,5186},{1036,6905,5212},{1067,6919,5239},{1096,6933,5267},{1121,6947,5296},
+    {1143,6962,5326},{1163,6977,5357},{1179,6991,5389},{1191,7006,5421},{1200,7021,5455},{1205,7037,5489},{1206,7052,5523},{1202,7068,5558},
+    {1194,7083,5594},{1181,7099,5629},{1163,7115,5665},{1139,7131,5700},{1110,7147,5736},{1074,7163,5771},{1032,7178,5805},{984,7193,5838},
+    {929,7208,5870},{867,7222,5901},{798,7235,5931},{722,7247,5959},{639,7258,5984},{549,7268,6008},{453,7276,6029},{351,7282,6048},
+    {243,7286,6064},{131,7287,6076},{16,7286,6086},{-102,7283,6093},{-221,7276,6096},{-339,7266,6095},{-457,7254,6092},{-571,7238,6084},
+    {-682,7220,6074},{-787,7198,6059},{-886,7174,6042},{-977,7147,6021},{-1059,7117,5997},{-1133,7085,5970},{-1197,7052,5940},{-1251,7016,5907},
+    {-1295,6980,5873},{-1328,6942,5836},{-1352,6903,5797},{-1365,6864,5757},{-1369,6825,5715},{-1364,6786,5673},{-1349,6747,5630},{-1327,6709,5586},
+    {-1296,6672,5543},{-1257,6637,5499},{-1212,6603,5456},{-1160,6570,5414},{-1103,6540,5373},{-1040,6511,5333},{-972,6485,5294},{-900,6461,5257},
+    {-824,6439,5221},{-745,6420,5188},{-664,6404,5156},{-580,6390,5127},{-494,6378,5099},{-407,6369,5074},{-319,6363,5051},{-230,6359,5031},
+    {-141,6357,5012},{-52,6358,4996},{37,6361,4983},{126,6367,4971},{214,6374,4962}
+  },
+  {  // +54
+    {183,6550,5078},{272,6558,5071},{361,6568,5066},{448,6580,5064},{533,6594,5063},{617,6609,5064},{700,6626,5067},{781,6645,5072},
+    {861,6665,5078},{938,6686,5087},{1013,6709,5097},{1087,6733,5108},{1158,6759,5122},{1226,6786,5137},{1292,6814,5153},{1355,6843,5171},
+    {1415,6873,5191},{1472,6905,5212},{1524,6938,5234},{1573,6971,5257},{1616,7006,5281},{1655,7042,5306},{1688,7079,5332},{1714,7116,5358},
+    {1734,7154,5386},{1745,7193,5413},{1749,7232,5441},{1742,7271,5468},{1726,7311,5495},{1698,7350,5522},{1659,7389,5548},{1607,7427,5574},
+    {1541,7465,5598},{1461,7501,5620},{1367,7535,5642},{1257,7568,5661},{1133,7598,5679},{995,7625,5694},{842,7649,5707},{677,7669,5718},
+    {501,7686,5726},{317,7699,5731},{126,7707,5734},{-69,7711,5734},{-264,7711,5732},{-457,7706,5726},{-644,7697,5719},{-824,7684,5708},
+    {-993,7666,5695},{-1151,7646,5680},{-1294,7622,5662},{-1423,7595,5643},{-1538,7565,5622},{-1636,7534,5599},{-1720,7501,5574},{-1789,7466,5548},
+    {-1843,7430,5522},{-1884,7394,5494},{-1912,7358,5466},{-1928,7321,5437},{-1932,7285,5408},{-1926,7249,5379},{-1911,7213,5350},{-1886,7179,5322},
+    {-1854,7146,5293},{-1814,7113,5266},{-1767,7082,5239},{-1715,7053,5213},{-1657,7025,5188},{-1595,6999,5164},{-1528,6974,5141},{-1458,6951,5120},
+    {-1384,6930,5099},{-1308,6911,5080},{-1229,6894,5062},{-1149,6878,5046},{-1067,6865,5031},{-984,6853,5018},{-900,6843,5006},{-816,6835,4995},
+    {-731,6828,4986},{-647,6824,4978},{-562,6820,4972},{-479,6819,4967},{-396,6818,4963},{-313,6819,4961},{-232,6822,4961},{-152,6825,4961},
+    {-74,6830,4963},{4,6835,4966},{80,6842,4971},{154,6849,4977},{226,6857,4984},{297,6866,4992},{366,6875,5002},{434,6885,5013},
+    {499,6895,5025},{563,6906,5038},{624,6917,5052},{684,6928,5068},{742,6940,5085},{797,6952,5103},{851,6965,5122},{902,6977,5142},
+    {951,6990,5164},{998,7004,5186},{1042,7017,5210},{1084,7030,5235},{1123,7044,5261},{1159,7058,5288},{1192,7073,5316},{1222,7087,5345},
+    {1249,7102,5375},{1273,7117,5406},{1293,7133,5437},{1309,7148,5470},{1321,7164,5503},{1328,7180,5537},{1331,7197,5571},{1330,7213,5606},
+    {1323,7230,5641},{1310,7247,5676},{1292,7264,5712},{1268,7281,5747},{1237,7298,5781},{1199,7315,5816},{1155,7332,5849},{1103,7348,5882},
+    {1043,7364,5913},{976,7379,5944},{901,7394,5972},{818,7407,5999},{727,7419,6025},{629,7429,6048},{524,7438,6068},{412,7444,6087},
+    {294,7449,6102},{172,7451,6115},{46,7450,6125},{-82,7447,6131},{-211,7441,6135},{-340,7431,6135},{-466,7419,6132},{-590,7404,6126},
+    {-708,7385,6116},{-820,7364,6103},{-925,7340,6087},{-1022,7314,6068},{-1109,7285,6046},{-1186,7254,6022},{-1253,7221,5994},{-1309,7186,5964},
+    {-1355,7150,5932},{-1389,7114,5898},{-1414,7076,5862},{-1427,7038,5825},{-1431,7000,5787},{-1425,6962,5747},{-1410,6925,5707},{-1387,6888,5667},
+    {-1355,6853,5626},{-1315,6818,5586},{-1269,6785,5546},{-1216,6753,5506},{-1158,6724,5468},{-1094,6696,5430},{-1025,6670,5394},{-952,6646,5359},
+    {-875,6625,5326},{-795,6605,5294},{-712,6589,5264},{-626,6574,5236},{-539,6562,5210},{-451,6553,5186},{-361,6545,5164},{-270,6540,5145},
+    {-179,6538,5127},{-88,6538,5112},{3,6539,5098},{93,6544,5087},{183,6550,5078}
+  },
+  {  // +56
+    {154,6724,5189},{245,6731,5182},{336,6739,5177},{426,6750,5174},{514,6762,5172},{601,6776,5173},{687,6792,5175},{771,6809,5179},
+    {853,6828,5185},{934,6848,5192},{1012,6869,5201},{1089,6892,5212},{1163,6916,5224},{1235,6942,5237},{1304,6968,5252},{1370,6996,5268},
+    {1433,7026,5286},{1492,7056,5305},{1548,7087,5325},{1599,7120,5345},{1645,7153,5367},{1687,7188,5390},{1722,7223,5414},{1750,7259,5438},
+    {1771,7296,5462},{1785,7334,5487},{1789,7371,5512},{1784,7409,5536},{1768,7448,5561},{1741,7486,5585},{1701,7523,5608},{1648,7560,5631},
+    {1580,7596,5652},{1498,7631,5673},{1401,7664,5691},{1287,7696,5709},{1158,7725,5724},{1014,7751,5737},{854,7774,5749},{682,7794,5758},
+    {497,7810,5765},{303,7822,5769},{102,7830,5771},{-102,7834,5771},{-307,7833,5768},{-509,7829,5762},{-706,7820,5755},{-893,7806,5745},
+    {-1069,7790,5732},{-1233,7769,5718},{-1381,7746,5701},{-1514,7720,5683},{-1631,7692,5662},{-1732,7661,5641},{-1817,7629,5618},{-1887,7596,5593},
+    {-1941,7562,5568},{-1982,7528,5542},{-2009,7493,5515},{-2023,7458,5488},{-2027,7423,5460},{-2019,7389,5432},{-2002,7355,5405},{-1976,7323,5377},
+    {-1942,7291,5350},{-1900,7260,5324},{-1852,7231,5298},{-1798,7203,5273},{-1738,7176,5248},{-1674,7151,5225},{-1605,7128,5202},{-1533,7106,5181},
+    {-1458,7086,5161},{-1379,7067,5142},{-1299,7050,5124},{-1216,7035,5108},{-1132,7022,5093},{-1046,7010,5079},{-960,7000,5066},{-872,6992,5055},
+    {-785,6985,5046},{-697,6979,5037},{-610,6975,5030},{-522,6973,5025},{-435,6971,5021},{-349,6971,5018},{-264,6973,5016},{-179,6975,5016},
+    {-96,6978,5018},{-14,6983,5020},{67,6988,5024},{146,6994,5029},{224,7001,5036},{301,7008,5043},{376,7016,5052},{449,7025,5063},
+    {520,7034,5074},{590,7044,5087},{657,7054,5101},{723,7065,5116},{787,7076,5132},{849,7087,5150},{908,7099,5169},{966,7111,5189},
+    {1021,7123,5210},{1073,7136,5232},{1123,7149,5256},{1171,7163,5281},{1215,7177,5306},{1257,7191,5333},{1296,7205,5361},{1331,7220,5390},
+    {1363,7235,5419},{1391,7251,5450},{1415,7267,5481},{1435,7283,5514},{1450,7300,5546},{1461,7317,5580},{1467,7334,5614},{1467,7352,5648},
+    {1462,7370,5682},{1450,7388,5717},{1433,7406,5751},{1408,7424,5785},{1376,7442,5819},{1337,7460,5852},{1290,7478,5885},{1234,7496,5917},
+    {1170,7513,5947},{1097,7529,5977},{1016,7544,6005},{926,7558,6031},{827,7571,6055},{720,7582,6077},{605,7591,6097},{483,7599,6115},
+    {354,7603,6130},{221,7606,6143},{84,7606,6153},{-56,7603,6159},{-196,7597,6163},{-336,7588,6164},{-473,7576,6162},{-605,7561,6157},
+    {-733,7543,6148},{-852,7523,6137},{-964,7499,6123},{-1066,7473,6105},{-1158,7445,6086},{-1239,7415,6063},{-1309,7383,6038},{-1368,7349,6011},
+    {-1415,7315,5982},{-1451,7279,5951},{-1476,7243,5918},{-1490,7206,5884},{-1493,7170,5849},{-1487,7133,5813},{-1471,7097,5776},{-1447,7062,5739},
+    {-1414,7027,5702},{-1374,6994,5664},{-1326,6962,5627},{-1272,6931,5591},{-1212,6903,5555},{-1147,6876,5520},{-1077,6850,5487},{-1003,6827,5454},
+    {-925,6806,5423},{-843,6787,5393},{-759,6770,5366},{-672,6756,5339},{-584,6743,5315},{-494,6733,5292},{-402,6725,5272},{-310,6720,5253},
+    {-217,6716,5236},{-124,6715,5221},{-31,6716,5208},{62,6719,5198},{154,6724,5189}
+  },
+  {  // +58
+    {125,6896,5292},{219,6902,5285},{312,6910,5280},{404,6919,5277},{495,6930,5275},{585,6943,5275},{673,6957,5277},{761,6973,5280},
+    {846,6990,5284},{930,7008,5291},{1011,7029,5298},{1091,7050,5308},{1168,7073,5318},{1243,7097,5330},{1315,7122,5343},{1384,7149,5358},
+    {1450,7177,5374},{1512,7206,5390},{1571,7236,5408},{1625,7267,5427},{1673,7299,5446},{1717,7332,5467},{1754,7366,5487},{1785,7400,5509},
+    {1808,7436,5530},{1822,7472,5552},{1828,7508,5574},{1824,7545,5596},{1808,7581,5618},{1781,7618,5639},{1740,7654,5660},{1686,7689,5679},
+    {1617,7724,5698},{1532,7757,5716},{1431,7789,5732},{1313,7819,5747},{1178,7847,5760},{1027,7872,5772},{860,7894,5781},{679,7913,5789},
+    {485,7929,5794},{280,7940,5798},{69,7948,5799},{-146,7951,5798},{-362,7950,5794},{-574,7945,5789},{-780,7936,5781},{-976,7923,5771},
+    {-1160,7907,5760},{-1329,7887,5746},{-1482,7865,5730},{-1619,7839,5713},{-1739,7812,5694},{-1842,7783,5673},{-1928,7752,5652},{-1998,7720,5629},
+    {-2052,7688,5605},{-2092,7655,5580},{-2118,7622,5555},{-2131,7588,5529},{-2133,7555,5503},{-2124,7523,5477},{-2104,7491,5451},{-2076,7459,5425},
+    {-2040,7429,5399},{-1996,7400,5374},{-1946,7372,5349},{-1890,7345,5325},{-1828,7320,5301},{-1761,7296,5279},{-1690,7273,5257},{-1616,7252,5236},
+    {-1538,7233,5216},{-1457,7215,5198},{-1374,7198,5180},{-1288,7184,5164},{-1201,7170,5149},{-1113,7159,5135},{-1023,7148,5122},{-933,7139,5111},
+    {-842,7132,5101},{-751,7126,5093},{-659,7121,5085},{-568,7118,5079},{-477,7116,5075},{-386,7115,5071},{-296,7115,5069},{-207,7116,5069},
+    {-119,7119,5069},{-31,7122,5071},{55,7126,5075},{140,7131,5079},{223,7136,5085},{306,7143,5092},{386,7150,5101},{466,7157,5110},
+    {543,7166,5121},{619,7174,5134},{693,7184,5147},{765,7194,5162},{836,7204,5178},{904,7215,5195},{970,7226,5214},{1034,7238,5233},
+    {1095,7250,5254},{1154,7262,5276},{1210,7275,5299},{1264,7288,5323},{1314,7302,5349},{1362,7317,5375},{1406,7331,5402},{1447,7346,5431},
+    {1484,7362,5460},{1517,7378,5490},{1546,7395,5521},{1570,7412,5552},{1589,7429,5584},{1604,7447,5617},{1613,7465,5650},{1616,7483,5683},
+    {1612,7502,5716},{1603,7521,5750},{1586,7540,5783},{1561,7559,5816},{1529,7579,5849},{1488,7598,5881},{1438,7617,5913},{1379,7635,5943},
+    {1311,7653,5972},{1233,7670,6001},{1145,7686,6027},{1048,7701,6052},{940,7715,6076},{824,7727,6097},{699,7737,6116},{565,7744,6133},
+    {425,7750,6148},{280,7753,6160},{130,7753,6170},{-22,7751,6177},{-175,7745,6181},{-326,7737,6182},{-474,7725,6181},{-618,7711,6177},
+    {-754,7694,6170},{-883,7674,6160},{-1002,7651,6147},{-1110,7626,6132},{-1207,7598,6114},{-1293,7569,6094},{-1366,7538,6072},{-1427,7506,6048},
+    {-1476,7473,6021},{-1513,7438,5993},{-1538,7404,5964},{-1552,7368,5933},{-1556,7333,5901},{-1549,7298,5869},{-1533,7264,5835},{-1507,7230,5801},
+    {-1474,7197,5768},{-1432,7165,5734},{-1383,7134,5700},{-1328,7105,5667},{-1267,7077,5634},{-1201,7051,5602},{-1129,7027,5571},{-1054,7004,5541},
+    {-974,6983,5512},{-891,6965,5485},{-806,6948,5459},{-718,6934,5435},{-628,6921,5412},{-536,6911,5391},{-443,6903,5371},{-349,6897,5354},
+    {-255,6893,5338},{-160,6891,5324},{-65,6891,5311},{30,6893,5301},{125,6896,5292}
+  },
+  {  // +60
+    {96,7067,5388},{192,7072,5381},{288,7078,5376},{382,7086,5372},{476,7096,5370},{569,7108,5369},{660,7120,5370},{750,7135,5373},
+    {839,7151,5376},{925,7168,5382},{1010,7187,5388},{1092,7207,5396},{1173,7228,5405},{1251,7251,5415},{1326,7275,5427},{1398,7300,5439},
+    {1467,7326,5453},{1532,7354,5468},{1592,7382,5483},{1649,7412,5500},{1700,7442,5517},{1745,7474,5534},{1785,7506,5553},{1817,7539,5571},
+    {1842,7573,5590},{1858,7607,5609},{1864,7642,5628},{1860,7676,5647},{1845,7711,5666},{1817,7746,5684},{1776,7781,5702},{1720,7814,5719},
+    {1649,7847,5735},{1561,7879,5750},{1456,7910,5764},{1333,7938,5776},{1192,7965,5787},{1033,7988,5797},{857,8010,5804},{666,8027,5811},
+    {461,8042,5815},{246,8053,5817},{23,8060,5817},{-204,8062,5816},{-432,8061,5812},{-655,8056,5806},{-870,8047,5799},{-1075,8034,5789},
+    {-1266,8018,5778},{-1442,7999,5765},{-1600,7977,5750},{-1741,7952,5734},{-1863,7926,5716},{-1967,7898,5697},{-2054,7868,5676},{-2123,7838,5655},
+    {-2177,7807,5633},{-2215,7775,5610},{-2240,7743,5586},{-2251,7712,5562},{-2251,7680,5538},{-2239,7649,5513},{-2218,7619,5489},{-2187,7589,5464},
+    {-2148,7560,5440},{-2102,7532,5416},{-2049,7506,5392},{-1990,7480,5369},{-1925,7456,5347},{-1856,7433,5325},{-1782,7411,5305},{-1705,7391,5285},
+    {-1624,7372,5265},{-1540,7354,5247},{-1454,7338,5230},{-1365,7324,5214},{-1275,7310,5200},{-1183,7299,5186},{-1090,7288,5174},{-996,7279,5162},
+    {-901,7271,5152},{-806,7265,5144},{-710,7259,5136},{-614,7255,5130},{-519,7252,5125},{-424,7251,5121},{-329,7250,5119},{-234,7250,5118},
+    {-141,7251,5118},{-48,7254,5120},{44,7257,5123},{135,7260,5127},{224,7265,5132},{313,7270,5139},{400,7277,5147},{485,7283,5156},
+    {569,7291,5167},{652,7299,5179},{732,7307,5192},{811,7316,5206},{888,7326,5222},{963,7336,5238},{1036,7347,5256},{1106,7358,5276},
+    {1174,7370,5296},{1240,7382,5317},{1303,7395,5340},{1363,7409,5363},{1420,7422,5388},{1473,7437,5414},{1524,7452,5440},{1570,7467,5468},
+    {1613,7483,5496},{1651,7499,5525},{1685,7516,5555},{1714,7534,5586},{1738,7552,5617},{1757,7570,5648},{1769,7589,5680},{1776,7608,5712},
+    {1775,7628,5744},{1767,7648,5776},{1752,7668,5808},{1728,7688,5840},{1696,7708,5871},{1654,7728,5902},{1603,7748,5931},{1541,7767,5960},
+    {1469,7786,5988},{1386,7803,6015},{1292,7820,6041},{1187,7836,6064},{1071,7850,6087},{945,7863,6107},{809,7874,6125},{664,7882,6142},
+    {511,7888,6156},{352,7892,6168},{188,7893,6177},{22,7891,6184},{-144,7886,6188},{-309,7878,6190},{-469,7867,6190},{-624,7853,6186},
+    {-772,7837,6181},{-910,7817,6172},{-1037,7795,6161},{-1152,7771,6148},{-1256,7745,6133},{-1346,7717,6115},{-1423,7687,6096},{-1487,7656,6074},
+    {-1537,7624,6051},{-1576,7592,6026},{-1602,7558,6000},{-1616,7525,5972},{-1619,7491,5944},{-1612,7458,5914},{-1595,7425,5885},{-1568,7393,5854},
+    {-1534,7361,5824},{-1491,7331,5793},{-1441,7302,5763},{-1385,7274,5733},{-1322,7247,5703},{-1255,7222,5674},{-1182,7198,5646},{-1105,7177,5619},
+    {-1024,7157,5592},{-940,7139,5567},{-853,7123,5544},{-764,7108,5521},{-672,7096,5500},{-579,7086,5481},{-484,7077,5463},{-388,7071,5446},
+    {-292,7066,5431},{-195,7064,5418},{-98,7063,5406},{-1,7064,5396},{96,7067,5388}
+  },
+  {  // +62
+    {66,7235,5474},{165,7239,5468},{263,7245,5462},{360,7252,5458},{457,7261,5456},{552,7271,5455},{646,7283,5455},{739,7296,5457},
+    {830,7310,5460},{920,7326,5464},{1008,7344,5469},{1093,7362,5475},{1176,7382,5483},{1257,7404,5492},{1335,7426,5501},{1410,7450,5512},
+    {1481,7474,5524},{1549,7500,5536},{1612,7527,5549},{1671,7555,5563},{1724,7584,5578},{1772,7613,5593},{1813,7644,5609},{1847,7675,5625},
+    {1873,7707,5641},{1890,7739,5657},{1897,7772,5673},{1893,7805,5689},{1878,7838,5705},{1850,7871,5720},{1807,7903,5735},{1749,7935,5749},
+    {1675,7966,5763},{1583,7996,5775},{1473,8025,5787},{1344,8052,5797},{1195,8077,5806},{1028,8099,5813},{842,8119,5819},{640,8136,5824},
+    {423,8149,5826},{195,8159,5828},{-41,8165,5827},{-281,8167,5825},{-521,8166,5821},{-755,8160,5815},{-981,8151,5807},{-1195,8138,5798},
+    {-1394,8122,5787},{-1575,8103,5775},{-1738,8082,5761},{-1881,8058,5746},{-2005,8033,5729},{-2110,8006,5712},{-2196,7978,5693},{-2265,7949,5673},
+    {-2317,7919,5653},{-2353,7889,5631},{-2375,7858,5610},{-2384,7828,5587},{-2380,7798,5565},{-2366,7769,5542},{-2341,7740,5519},{-2308,7711,5496},
+    {-2266,7684,5473},{-2216,7657,5451},{-2160,7632,5429},{-2097,7607,5407},{-2030,7584,5386},{-1957,7562,5366},{-1880,7541,5346},{-1799,7521,5327},
+    {-1715,7503,5309},{-1627,7486,5292},{-1538,7470,5275},{-1445,7456,5260},{-1351,7443,5246},{-1256,7431,5232},{-1159,7420,5220},{-1060,7411,5209},
+    {-961,7403,5200},{-862,7396,5191},{-762,7390,5184},{-661,7385,5177},{-561,7382,5172},{-460,7379,5169},{-360,7378,5166},{-261,7377,5165},
+    {-162,7378,5165},{-63,7379,5166},{35,7381,5169},{132,7384,5173},{227,7388,5178},{322,7392,5184},{415,7398,5192},{508,7403,5201},
+    {598,7410,5211},{687,7417,5222},{775,7425,5235},{861,7434,5248},{944,7443,5263},{1026,7453,5280},{1106,7463,5297},{1183,7474,5315},
+    {1258,7485,5335},{1331,7497,5356},{1400,7510,5378},{1467,7523,5400},{1531,7537,5424},{1591,7552,5449},{1648,7567,5475},{1701,7582,5501},
+    {1750,7598,5528},{1794,7615,5556},{1834,7633,5585},{1868,7650,5614},{1897,7669,5644},{1921,7688,5674},{1938,7707,5704},{1948,7727,5734},
+    {1951,7747,5765},{1946,7767,5795},{1933,7788,5826},{1911,7809,5855},{1879,7830,5885},{1838,7850,5914},{1785,7871,5942},{1722,7891,5969},
+    {1646,7910,5996},{1559,7929,6021},{1459,7946,6045},{1347,7963,6067},{1223,7978,6088},{1086,7991,6107},{939,8002,6125},{781,8012,6140},
+    {615,8018,6154},{441,8023,6165},{262,8024,6174},{81,8023,6181},{-101,8019,6186},{-280,8011,6188},{-455,8001,6188},{-624,7988,6186},
+    {-783,7972,6181},{-932,7954,6175},{-1068,7933,6166},{-1192,7910,6154},{-1302,7885,6141},{-1397,7858,6126},{-1478,7830,6109},{-1545,7800,6090},
+    {-1599,7770,6070},{-1638,7739,6048},{-1665,7707,6025},{-1680,7675,6001},{-1683,7644,5976},{-1675,7612,5950},{-1657,7581,5924},{-1630,7550,5897},
+    {-1595,7521,5870},{-1551,7492,5843},{-1500,7464,5816},{-1442,7437,5789},{-1379,7412,5762},{-1309,7388,5736},{-1235,7366,5711},{-1157,7345,5686},
+    {-1075,7326,5663},{-989,7309,5640},{-901,7293,5619},{-810,7279,5598},{-717,7267,5579},{-622,7257,5561},{-525,7248,5544},{-428,7242,5529},
+    {-330,7237,5515},{-231,7234,5503},{-132,7233,5492},{-33,7233,5482},{66,7235,5474}
+  },
+  {  // +64
+    {36,7401,5551},{137,7404,5544},{238,7409,5539},{337,7415,5535},{436,7423,5532},{534,7432,5531},{631,7442,5530},{727,7454,5531},
+    {821,7468,5533},{913,7482,5536},{1004,7498,5540},{1092,7516,5545},{1178,7534,5552},{1262,7554,5559},{1342,7575,5567},{1420,7597,5575},
+    {1494,7620,5585},{1564,7644,5595},{1629,7669,5606},{1690,7695,5618},{1745,7722,5630},{1795,7750,5643},{1837,7779,5656},{1872,7808,5669},
+    {1899,7838,5682},{1917,7868,5696},{1924,7899,5709},{1921,7930,5722},{1905,7961,5735},{1875,7991,5748},{1830,8022,5760},{1769,8052,5771},
+    {1691,8081,5782},{1595,8109,5792},{1478,8136,5801},{1342,8161,5809},{1185,8184,5816},{1007,8205,5821},{810,8223,5826},{595,8238,5829},
+    {365,8250,5830},{123,8259,5830},{-128,8264,5829},{-382,8265,5826},{-635,8263,5822},{-881,8257,5816},{-1118,8248,5809},{-1340,8235,5800},
+    {-1545,8219,5789},{-1732,8201,5778},{-1898,8180,5765},{-2043,8157,5751},{-2167,8133,5735},{-2271,8107,5719},{-2356,8080,5702},{-2423,8052,5684},
+    {-2472,8023,5665},{-2505,7995,5645},{-2524,7966,5625},{-2529,7937,5605},{-2522,7909,5584},{-2503,7881,5563},{-2475,7853,5542},{-2437,7826,5521},
+    {-2391,7800,5500},{-2338,7775,5479},{-2278,7751,5459},{-2212,7727,5439},{-2140,7705,5419},{-2063,7684,5400},{-1982,7664,5381},{-1898,7645,5364},
+    {-1809,7627,5347},{-1718,7610,5330},{-1624,7595,5315},{-1528,7581,5301},{-1430,7568,5287},{-1330,7556,5275},{-1228,7545,5263},{-1126,7536,5253},
+    {-1022,7528,5243},{-917,7520,5235},{-812,7514,5228},{-707,7509,5222},{-602,7505,5217},{-496,7502,5213},{-390,7499,5211},{-285,7498,5210},
+    {-180,7498,5210},{-76,7498,5211},{28,7500,5213},{131,7502,5217},{233,7505,5222},{334,7509,5228},{434,7513,5235},{533,7519,5243},
+    {631,7525,5253},{727,7531,5264},{821,7538,5276},{914,7546,5289},{1004,7555,5303},{1093,7564,5319},{1180,7574,5335},{1265,7585,5353},
+    {1347,7596,5372},{1426,7608,5392},{1503,7621,5412},{1577,7634,5434},{1648,7647,5457},{1715,7662,5480},{1779,7677,5505},{1838,7693,5530},
+    {1894,7709,5556},{1945,7726,5582},{1991,7743,5610},{2031,7762,5637},{2067,7780,5665},{2095,7799,5693},{2118,7819,5722},{2133,7839,5750},
+    {2141,7860,5779},{2140,7881,5808},{2130,7902,5836},{2111,7923,5864},{2081,7944,5892},{2041,7965,5919},{1989,7986,5945},{1924,8007,5970},
+    {1847,8027,5995},{1756,8046,6018},{1651,8064,6040},{1532,8081,6061},{1400,8097,6081},{1253,8111,6099},{1094,8123,6115},{923,8132,6130},
+    {742,8140,6142},{553,8145,6153},{357,8147,6162},{159,8147,6169},{-40,8143,6174},{-237,8137,6177},{-428,8128,6177},{-612,8115,6176},
+    {-785,8101,6173},{-946,8083,6167},{-1094,8063,6160},{-1227,8042,6151},{-1344,8018,6140},{-1446,7993,6127},{-1532,7966,6112},{-1603,7938,6096},
+    {-1659,7909,6079},{-1701,7880,6060},{-1729,7850,6041},{-1744,7820,6020},{-1747,7790,5998},{-1739,7761,5976},{-1721,7731,5953},{-1693,7703,5929},
+    {-1657,7675,5906},{-1612,7648,5882},{-1560,7622,5858},{-1501,7596,5834},{-1436,7573,5811},{-1365,7550,5788},{-1290,7529,5766},{-1210,7509,5744},
+    {-1127,7491,5723},{-1040,7475,5702},{-950,7460,5683},{-857,7446,5665},{-762,7435,5647},{-666,7425,5631},{-568,7416,5616},{-469,7410,5602},
+    {-368,7404,5589},{-268,7401,5578},{-167,7399,5568},{-65,7399,5559},{36,7401,5551}
+  },
+  {  // +66
+    {4,7563,5617},{107,7566,5611},{210,7570,5606},{313,7575,5602},{414,7582,5599},{515,7590,5597},{614,7599,5596},{713,7610,5596},
+    {809,7622,5597},{904,7636,5599},{997,7650,5602},{1089,7666,5606},{1177,7683,5610},{1263,7701,5616},{1346,7721,5622},{1426,7741,5629},
+    {1502,7762,5637},{1574,7785,5645},{1642,7808,5654},{1704,7832,5663},{1761,7857,5673},{1812,7883,5683},{1856,7910,5694},{1892,7937,5704},
+    {1919,7965,5715},{1937,7993,5726},{1944,8021,5736},{1940,8050,5747},{1922,8079,5757},{1890,8107,5767},{1842,8136,5776},{1778,8163,5785},
+    {1694,8190,5794},{1592,8216,5801},{1468,8241,5808},{1322,8264,5814},{1154,8285,5819},{965,8304,5823},{754,8321,5825},{525,8334,5827},
+    {279,8345,5827},{21,8352,5826},{-245,8356,5824},{-514,8357,5821},{-780,8353,5816},{-1039,8347,5810},{-1285,8337,5803},{-1515,8324,5794},
+    {-1726,8309,5785},{-1915,8291,5774},{-2083,8270,5762},{-2228,8248,5749},{-2352,8225,5735},{-2453,8200,5720},{-2535,8174,5704},{-2598,8147,5688},
+    {-2643,8120,5670},{-2671,8093,5653},{-2685,8066,5634},{-2686,8039,5616},{-2674,8012,5597},{-2651,7985,5578},{-2617,7959,5559},{-2575,7934,5539},
+    {-2524,7909,5520},{-2466,7885,5501},{-2402,7862,5483},{-2331,7840,5464},{-2255,7819,5446},{-2173,7798,5429},{-2088,7779,5412},{-1999,7761,5396},
+    {-1906,7744,5380},{-1810,7728,5365},{-1712,7713,5351},{-1611,7699,5337},{-1508,7686,5325},{-1404,7675,5313},{-1297,7664,5302},{-1190,7654,5293},
+    {-1081,7646,5284},{-972,7638,5276},{-862,7632,5269},{-751,7626,5264},{-640,7622,5259},{-529,7618,5256},{-418,7616,5254},{-307,7614,5252},
+    {-196,7613,5252},{-85,7613,5253},{25,7614,5256},{134,7615,5259},{242,7618,5264},{350,7621,5269},{457,7625,5276},{562,7629,5284},
+    {666,7635,5293},{769,7641,5304},{871,7648,5315},{970,7655,5328},{1068,7663,5341},{1164,7672,5356},{1258,7682,5372},{1350,7692,5388},
+    {1440,7703,5406},{1527,7715,5425},{1611,7727,5444},{1692,7740,5465},{1770,7753,5486},{1845,7768,5509},{1916,7783,5531},{1982,7798,5555},
+    {2045,7815,5579},{2103,7832,5604},{2156,7849,5629},{2204,7867,5655},{2246,7886,5681},{2281,7905,5708},{2310,7925,5734},{2331,7945,5761},
+    {2345,7966,5787},{2349,7987,5814},{2345,8008,5840},{2330,8030,5866},{2304,8051,5891},{2266,8073,5916},{2216,8094,5940},{2152,8115,5963},
+    {2074,8135,5986},{1981,8154,6008},{1873,8173,6028},{1749,8191,6047},{1608,8207,6065},{1453,8221,6082},{1282,8234,6097},{1098,8245,6111},
+    {901,8253,6123},{694,8259,6133},{481,8262,6141},{263,8262,6148},{44,8260,6153},{-172,8254,6156},{-383,8246,6158},{-584,8235,6157},
+    {-774,8221,6155},{-949,8205,6151},{-1110,8187,6145},{-1254,8166,6138},{-1381,8144,6129},{-1490,8120,6119},{-1582,8095,6107},{-1658,8069,6093},
+    {-1718,8042,6079},{-1762,8015,6063},{-1792,7987,6046},{-1808,7959,6029},{-1812,7931,6010},{-1804,7904,5991},{-1785,7876,5971},{-1757,7850,5951},
+    {-1720,7824,5931},{-1674,7798,5910},{-1621,7774,5890},{-1561,7751,5869},{-1494,7728,5849},{-1423,7707,5829},{-1346,7687,5810},{-1265,7669,5790},
+    {-1180,7652,5772},{-1092,7636,5754},{-1000,7622,5737},{-906,7609,5721},{-810,7598,5705},{-712,7588,5691},{-612,7580,5677},{-511,7573,5665},
+    {-409,7568,5653},{-306,7565,5642},{-203,7563,5633},{-99,7562,5625},{4,7563,5617}
+  },
+  {  // +68
+    {-30,7722,5673},{75,7724,5667},{180,7727,5662},{285,7732,5658},{389,7738,5655},{492,7745,5652},{594,7753,5651},{695,7763,5650},
+    {794,7774,5650},{891,7786,5651},{987,7799,5653},{1081,7814,5656},{1172,7829,5659},{1260,7846,5663},{1345,7863,5668},{1427,7882,5673},
+    {1505,7902,5679},{1579,7922,5685},{1648,7944,5692},{1712,7966,5699},{1770,7989,5707},{1822,8013,5714},{1866,8037,5722},{1902,8062,5731},
+    {1929,8088,5739},{1947,8114,5747},{1953,8140,5755},{1946,8166,5763},{1926,8192,5771},{1891,8218,5778},{1838,8244,5785},{1768,8270,5792},
+    {1678,8294,5798},{1567,8318,5803},{1434,8340,5808},{1277,8361,5812},{1096,8380,5815},{892,8397,5817},{666,8412,5819},{419,8424,5819},
+    {156,8433,5818},{-120,8438,5816},{-403,8441,5814},{-687,8440,5810},{-966,8436,5805},{-1236,8429,5799},{-1490,8419,5792},{-1726,8406,5784},
+    {-1940,8390,5775},{-2130,8372,5764},{-2297,8353,5753},{-2440,8331,5741},{-2559,8309,5729},{-2656,8285,5715},{-2733,8261,5701},{-2789,8235,5686},
+    {-2828,8210,5670},{-2851,8184,5655},{-2859,8158,5638},{-2853,8133,5621},{-2835,8107,5605},{-2806,8083,5587},{-2767,8058,5570},{-2719,8034,5553},
+    {-2662,8011,5536},{-2599,7988,5519},{-2529,7966,5502},{-2453,7945,5485},{-2371,7925,5469},{-2285,7906,5453},{-2195,7888,5438},{-2101,7871,5423},
+    {-2003,7854,5409},{-1902,7839,5395},{-1799,7824,5382},{-1693,7811,5370},{-1585,7799,5359},{-1476,7787,5348},{-1364,7777,5339},{-1252,7767,5330},
+    {-1138,7759,5322},{-1023,7751,5315},{-908,7744,5309},{-792,7739,5304},{-675,7734,5299},{-558,7730,5296},{-441,7727,5294},{-325,7725,5293},
+    {-208,7723,5293},{-91,7723,5295},{25,7723,5297},{140,7724,5300},{255,7726,5304},{369,7729,5310},{482,7732,5316},{595,7736,5324},
+    {706,7741,5332},{815,7747,5342},{924,7753,5353},{1031,7760,5365},{1136,7768,5377},{1239,7777,5391},{1341,7786,5406},{1440,7796,5421},
+    {1537,7806,5438},{1631,7817,5455},{1723,7829,5474},{1812,7842,5493},{1897,7855,5513},{1980,7870,5533},{2058,7884,5555},{2133,7900,5576},
+    {2204,7916,5599},{2269,7932,5622},{2330,7950,5645},{2386,7968,5669},{2435,7986,5693},{2479,8006,5717},{2515,8025,5741},{2544,8045,5765},
+    {2564,8066,5789},{2575,8087,5814},{2577,8108,5837},{2568,8129,5861},{2548,8151,5884},{2515,8172,5907},{2469,8193,5929},{2408,8214,5950},
+    {2332,8235,5970},{2239,8255,5990},{2130,8274,6009},{2002,8292,6026},{1856,8308,6043},{1693,8323,6058},{1511,8337,6072},{1314,8348,6084},
+    {1101,8357,6095},{876,8364,6105},{642,8368,6113},{403,8370,6120},{162,8368,6125},{-77,8364,6129},{-310,8357,6130},{-532,8347,6131},
+    {-742,8335,6130},{-935,8320,6127},{-1111,8303,6123},{-1269,8284,6117},{-1407,8264,6110},{-1526,8242,6102},{-1626,8218,6092},{-1708,8194,6081},
+    {-1773,8169,6069},{-1820,8144,6056},{-1853,8118,6043},{-1871,8092,6028},{-1876,8067,6013},{-1869,8041,5997},{-1850,8016,5980},{-1821,7991,5963},
+    {-1783,7967,5946},{-1737,7944,5929},{-1683,7921,5911},{-1622,7899,5894},{-1555,7879,5877},{-1482,7859,5860},{-1404,7841,5843},{-1322,7824,5826},
+    {-1236,7808,5810},{-1146,7793,5795},{-1053,7780,5780},{-957,7768,5766},{-859,7757,5752},{-760,7748,5739},{-658,7740,5727},{-555,7733,5716},
+    {-451,7728,5706},{-347,7725,5696},{-241,7722,5687},{-136,7722,5680},{-30,7722,5673}
+  },
+  {  // +70
+    {-69,7877,5718},{39,7878,5712},{146,7881,5707},{253,7885,5703},{359,7890,5700},{465,7896,5697},{569,7904,5695},{672,7912,5694},
+    {773,7922,5694},{873,7933,5694},{971,7945,5695},{1066,7958,5696},{1159,7972,5698},{1249,7987,5701},{1336,8003,5704},{1420,8020,5708},
+    {1499,8037,5712},{1574,8056,5716},{1645,8075,5721},{1709,8096,5726},{1768,8117,5732},{1820,8138,5737},{1864,8160,5743},{1899,8183,5749},
+    {1925,8206,5755},{1940,8230,5761},{1944,8253,5766},{1934,8277,5772},{1910,8301,5778},{1869,8325,5783},{1811,8348,5788},{1733,8371,5792},
+    {1633,8393,5796},{1511,8414,5799},{1365,8434,5802},{1194,8452,5804},{997,8469,5806},{775,8484,5807},{530,8496,5807},{264,8506,5806},
+    {-19,8513,5804},{-313,8517,5802},{-613,8518,5799},{-912,8516,5794},{-1203,8511,5789},{-1481,8503,5783},{-1741,8492,5776},{-1979,8479,5769},
+    {-2192,8464,5760},{-2380,8446,5751},{-2542,8427,5741},{-2678,8407,5730},{-2791,8385,5718},{-2880,8363,5706},{-2948,8339,5694},{-2997,8316,5680},
+    {-3028,8292,5666},{-3042,8268,5652},{-3042,8244,5638},{-3029,8220,5623},{-3003,8196,5608},{-2967,8173,5593},{-2921,8150,5578},{-2866,8127,5562},
+    {-2803,8106,5547},{-2733,8085,5532},{-2657,8064,5517},{-2575,8045,5503},{-2488,8026,5488},{-2396,8008,5474},{-2301,7990,5461},{-2201,7974,5447},
+    {-2098,7958,5435},{-1992,7944,5423},{-1883,7930,5411},{-1772,7917,5401},{-1659,7905,5390},{-1544,7894,5381},{-1428,7884,5372},{-1310,7875,5364},
+    {-1191,7866,5357},{-1071,7859,5351},{-950,7852,5346},{-828,7846,5341},{-706,7841,5338},{-583,7837,5335},{-461,7834,5334},{-338,7832,5333},
+    {-215,7830,5333},{-93,7829,5334},{29,7829,5336},{151,7830,5340},{272,7831,5344},{393,7834,5349},{512,7837,5355},{631,7840,5362},
+    {749,7845,5370},{866,7850,5379},{981,7856,5389},{1095,7863,5400},{1207,7870,5412},{1318,7878,5425},{1426,7887,5438},{1533,7896,5453},
+    {1637,7906,5468},{1740,7917,5484},{1839,7929,5501},{1936,7941,5518},{2029,7954,5536},{2120,7968,5555},{2207,7982,5574},{2290,7997,5594},
+    {2369,8013,5614},{2443,8029,5635},{2512,8046,5656},{2577,8063,5678},{2635,8082,5699},{2687,8100,5721},{2732,8120,5743},{2769,8139,5765},
+    {2799,8159,5787},{2819,8180,5808},{2829,8201,5830},{2828,8222,5851},{2816,8243,5872},{2791,8264,5892},{2751,8285,5912},{2696,8306,5931},
+    {2625,8326,5949},{2536,8346,5967},{2428,8365,5983},{2301,8383,5999},{2152,8400,6014},{1983,8416,6028},{1794,8430,6040},{1584,8442,6052},
+    {1357,8452,6062},{1113,8460,6071},{858,8465,6079},{595,8468,6085},{328,8468,6090},{62,8465,6094},{-197,8459,6096},{-445,8451,6098},
+    {-679,8440,6097},{-894,8427,6096},{-1090,8412,6093},{-1265,8395,6089},{-1418,8376,6084},{-1550,8356,6077},{-1660,8335,6070},{-1750,8313,6061},
+    {-1821,8290,6052},{-1874,8267,6042},{-1910,8243,6031},{-1931,8220,6019},{-1938,8196,6006},{-1932,8173,5993},{-1914,8150,5980},{-1886,8127,5966},
+    {-1848,8105,5952},{-1801,8083,5937},{-1747,8063,5923},{-1685,8043,5908},{-1617,8024,5894},{-1543,8006,5880},{-1464,7989,5865},{-1381,7973,5852},
+    {-1293,7958,5838},{-1202,7945,5825},{-1108,7932,5812},{-1011,7921,5800},{-912,7911,5788},{-810,7902,5777},{-707,7895,5766},{-603,7889,5757},
+    {-497,7884,5747},{-391,7880,5739},{-284,7878,5731},{-176,7877,5724},{-69,7877,5718}
+  },
+  {  // +72
+    {-112,8028,5752},{-3,8029,5747},{106,8031,5742},{215,8034,5738},{323,8038,5735},{430,8044,5732},{536,8050,5730},{641,8058,5728},
+    {744,8066,5727},{845,8076,5726},{945,8086,5726},{1042,8098,5727},{1136,8110,5728},{1228,8124,5729},{1316,8138,5731},{1400,8153,5733},
+    {1481,8169,5735},{1556,8186,5738},{1626,8203,5741},{1691,8221,5745},{1749,8240,5748},{1800,8259,5752},{1842,8279,5756},{1875,8299,5760},
+    {1899,8320,5763},{1910,8341,5767},{1909,8362,5771},{1894,8383,5775},{1863,8404,5778},{1815,8425,5781},{1747,8446,5784},{1658,8466,5787},
+    {1546,8485,5789},{1409,8504,5790},{1246,8521,5792},{1056,8537,5792},{839,8551,5793},{596,8563,5792},{328,8573,5791},{39,8581,5789},
+    {-265,8586,5787},{-578,8588,5784},{-894,8588,5780},{-1205,8584,5776},{-1504,8578,5771},{-1786,8569,5765},{-2046,8558,5758},{-2280,8544,5751},
+    {-2487,8529,5743},{-2666,8512,5735},{-2818,8494,5726},{-2944,8474,5716},{-3045,8454,5706},{-3123,8432,5695},{-3180,8411,5684},{-3218,8389,5672},
+    {-3238,8366,5660},{-3242,8344,5647},{-3232,8322,5635},{-3209,8299,5622},{-3175,8278,5609},{-3130,8256,5596},{-3076,8235,5582},{-3014,8214,5569},
+    {-2944,8194,5556},{-2867,8175,5543},{-2784,8156,5530},{-2696,8137,5517},{-2602,8120,5505},{-2504,8103,5493},{-2403,8087,5481},{-2297,8072,5469},
+    {-2188,8057,5458},{-2077,8043,5448},{-1963,8030,5438},{-1846,8018,5429},{-1728,8007,5420},{-1607,7996,5412},{-1486,7987,5404},{-1362,7978,5398},
+    {-1238,7970,5392},{-1112,7962,5386},{-986,7956,5382},{-859,7950,5378},{-731,7945,5375},{-603,7941,5373},{-475,7938,5372},{-346,7935,5371},
+    {-218,7933,5372},{-89,7932,5373},{39,7932,5375},{167,7933,5378},{294,7934,5382},{421,7936,5387},{547,7938,5393},{672,7942,5399},
+    {797,7946,5407},{920,7951,5415},{1042,7956,5424},{1163,7962,5434},{1282,7969,5445},{1400,7977,5456},{1516,7985,5469},{1630,7994,5482},
+    {1742,8004,5495},{1852,8014,5510},{1959,8025,5525},{2064,8037,5541},{2166,8049,5557},{2265,8062,5574},{2360,8076,5591},{2452,8090,5609},
+    {2540,8106,5627},{2623,8121,5645},{2702,8137,5664},{2776,8154,5683},{2844,8172,5702},{2906,8190,5722},{2961,8208,5741},{3009,8227,5760},
+    {3049,8247,5780},{3079,8267,5799},{3100,8287,5818},{3111,8307,5836},{3109,8327,5855},{3094,8348,5873},{3065,8368,5890},{3020,8389,5907},
+    {2958,8409,5923},{2877,8429,5939},{2776,8448,5953},{2653,8466,5967},{2507,8483,5981},{2337,8499,5993},{2144,8514,6004},{1926,8527,6015},
+    {1686,8538,6024},{1426,8547,6032},{1149,8553,6039},{860,8557,6045},{564,8559,6050},{268,8557,6054},{-23,8553,6057},{-303,8547,6059},
+    {-567,8538,6059},{-812,8527,6059},{-1033,8513,6057},{-1231,8498,6055},{-1403,8482,6051},{-1551,8464,6046},{-1676,8445,6041},{-1777,8425,6035},
+    {-1857,8404,6027},{-1918,8383,6019},{-1960,8362,6011},{-1985,8341,6002},{-1996,8319,5992},{-1992,8298,5982},{-1976,8277,5971},{-1949,8257,5960},
+    {-1912,8237,5948},{-1866,8217,5937},{-1811,8199,5925},{-1749,8181,5913},{-1681,8164,5902},{-1606,8147,5890},{-1527,8132,5878},{-1443,8117,5867},
+    {-1354,8104,5855},{-1262,8091,5844},{-1167,8080,5834},{-1069,8070,5823},{-968,8061,5813},{-865,8052,5804},{-761,8046,5795},{-655,8040,5786},
+    {-548,8035,5778},{-440,8031,5771},{-331,8029,5764},{-222,8028,5758},{-112,8028,5752}
+  },
+  {  // +74
+    {-165,8174,5776},{-54,8174,5771},{57,8176,5767},{167,8179,5763},{276,8182,5760},{384,8187,5757},{492,8192,5754},{598,8199,5752},
+    {702,8206,5751},{805,8214,5750},{905,8224,5749},{1003,8234,5748},{1098,8245,5748},{1190,8256,5749},{1278,8269,5749},{1362,8282,5750},
+    {1442,8296,5751},{1517,8311,5753},{1586,8326,5754},{1649,8342,5756},{1704,8358,5758},{1752,8375,5760},{1791,8393,5762},{1820,8410,5764},
+    {1838,8428,5766},{1843,8447,5768},{1835,8465,5770},{1811,8484,5772},{1770,8502,5773},{1709,8520,5775},{1628,8538,5776},{1523,8555,5777},
+    {1393,8572,5778},{1236,8587,5778},{1050,8602,5778},{836,8615,5777},{593,8626,5776},{324,8636,5775},{30,8643,5773},{-282,8648,5771},
+    {-607,8651,5768},{-938,8651,5764},{-1265,8649,5760},{-1582,8644,5756},{-1883,8636,5751},{-2160,8626,5745},{-2411,8615,5739},{-2633,8601,5732},
+    {-2826,8586,5725},{-2990,8570,5717},{-3126,8552,5709},{-3236,8534,5701},{-3321,8514,5691},{-3383,8495,5682},{-3425,8475,5672},{-3449,8454,5662},
+    {-3456,8434,5652},{-3448,8413,5641},{-3426,8393,5630},{-3392,8373,5619},{-3348,8353,5608},{-3293,8333,5597},{-3230,8314,5586},{-3159,8295,5574},
+    {-3081,8277,5563},{-2996,8259,5552},{-2906,8242,5541},{-2811,8225,5530},{-2711,8209,5520},{-2606,8193,5510},{-2498,8178,5500},{-2387,8164,5490},
+    {-2272,8151,5481},{-2155,8138,5472},{-2035,8126,5464},{-1913,8115,5456},{-1789,8104,5448},{-1663,8094,5442},{-1536,8085,5435},{-1407,8077,5430},
+    {-1277,8069,5425},{-1146,8062,5420},{-1015,8056,5417},{-882,8051,5414},{-749,8046,5411},{-616,8042,5410},{-482,8039,5409},{-348,8036,5409},
+    {-214,8034,5410},{-79,8033,5411},{54,8033,5413},{188,8033,5416},{321,8034,5420},{454,8036,5424},{587,8038,5429},{718,8041,5435},
+    {849,8045,5442},{979,8049,5450},{1107,8054,5458},{1235,8060,5467},{1361,8066,5476},{1486,8073,5487},{1609,8081,5497},{1731,8090,5509},
+    {1850,8099,5521},{1968,8108,5534},{2083,8119,5547},{2196,8130,5561},{2307,8142,5575},{2414,8154,5590},{2519,8167,5605},{2620,8180,5621},
+    {2717,8195,5637},{2810,8210,5653},{2899,8225,5669},{2983,8241,5686},{3062,8257,5702},{3135,8274,5719},{3202,8292,5736},{3262,8310,5753},
+    {3314,8328,5769},{3358,8347,5786},{3392,8366,5802},{3416,8385,5818},{3428,8405,5834},{3428,8425,5850},{3413,8444,5865},{3383,8464,5879},
+    {3335,8483,5893},{3267,8502,5907},{3179,8521,5920},{3068,8539,5932},{2932,8556,5944},{2769,8573,5954},{2579,8588,5964},{2361,8601,5974},
+    {2114,8613,5982},{1842,8623,5990},{1547,8631,5996},{1233,8637,6002},{906,8640,6007},{574,8641,6011},{245,8639,6014},{-75,8634,6016},
+    {-378,8627,6017},{-660,8618,6017},{-916,8607,6017},{-1145,8594,6015},{-1345,8580,6013},{-1517,8564,6010},{-1661,8547,6006},{-1779,8530,6002},
+    {-1873,8512,5997},{-1945,8493,5991},{-1996,8474,5985},{-2029,8455,5978},{-2045,8436,5970},{-2046,8418,5962},{-2034,8399,5954},{-2009,8381,5946},
+    {-1974,8363,5937},{-1929,8346,5928},{-1876,8329,5919},{-1814,8313,5909},{-1746,8298,5900},{-1672,8283,5891},{-1592,8269,5881},{-1508,8256,5872},
+    {-1419,8244,5863},{-1326,8233,5854},{-1230,8223,5845},{-1131,8213,5837},{-1030,8205,5829},{-926,8197,5821},{-820,8191,5813},{-713,8186,5806},
+    {-605,8181,5799},{-496,8178,5793},{-386,8175,5787},{-275,8174,5781},{-165,8174,5776}
+  },
+  {  // +76
+    {-230,8315,5790},{-118,8315,5786},{-7,8316,5782},{103,8318,5779},{213,8321,5775},{322,8325,5772},{430,8330,5770},{536,8335,5768},
+    {640,8341,5766},{743,8349,5764},{843,8356,5763},{940,8365,5761},{1034,8374,5761},{1125,8384,5760},{1212,8395,5760},{1294,8406,5759},
+    {1372,8418,5759},{1444,8431,5760},{1509,8444,5760},{1568,8458,5760},{1619,8472,5761},{1661,8486,5761},{1693,8501,5762},{1714,8516,5763},
+    {1723,8532,5763},{1718,8547,5764},{1697,8563,5764},{1659,8579,5765},{1602,8594,5765},{1523,8609,5765},{1420,8624,5765},{1292,8638,5764},
+    {1136,8652,5764},{951,8664,5763},{735,8676,5762},{490,8686,5760},{215,8694,5758},{-85,8700,5756},{-406,8705,5754},{-741,8707,5751},
+    {-1083,8707,5748},{-1422,8705,5744},{-1752,8701,5740},{-2063,8694,5735},{-2352,8686,5731},{-2612,8675,5725},{-2843,8663,5720},{-3042,8650,5713},
+    {-3212,8635,5707},{-3352,8620,5700},{-3464,8603,5693},{-3551,8586,5686},{-3615,8569,5678},{-3657,8550,5670},{-3681,8532,5661},{-3687,8514,5653},
+    {-3678,8495,5644},{-3655,8477,5635},{-3620,8459,5626},{-3574,8440,5617},{-3517,8422,5607},{-3452,8405,5598},{-3379,8388,5589},{-3298,8371,5579},
+    {-3212,8354,5570},{-3119,8338,5561},{-3021,8322,5552},{-2918,8307,5543},{-2811,8293,5534},{-2700,8279,5526},{-2585,8266,5518},{-2467,8253,5510},
+    {-2347,8241,5502},{-2223,8229,5495},{-2098,8218,5488},{-1970,8208,5482},{-1841,8198,5476},{-1710,8189,5471},{-1577,8181,5466},{-1443,8173,5461},
+    {-1308,8166,5457},{-1172,8159,5454},{-1035,8154,5451},{-897,8149,5449},{-759,8144,5447},{-620,8140,5446},{-481,8137,5446},{-342,8135,5446},
+    {-202,8133,5447},{-63,8132,5448},{77,8131,5450},{216,8132,5453},{355,8132,5456},{494,8134,5461},{632,8136,5465},{770,8139,5471},
+    {906,8142,5477},{1043,8146,5483},{1178,8151,5490},{1312,8156,5498},{1445,8162,5506},{1577,8168,5515},{1707,8176,5525},{1836,8183,5535},
+    {1963,8192,5545},{2089,8201,5556},{2212,8210,5568},{2333,8221,5580},{2452,8231,5592},{2569,8243,5605},{2682,8255,5618},{2793,8267,5631},
+    {2900,8281,5644},{3004,8294,5658},{3104,8309,5672},{3199,8323,5686},{3290,8339,5700},{3376,8354,5714},{3455,8371,5729},{3529,8387,5743},
+    {3595,8404,5757},{3654,8422,5771},{3704,8439,5785},{3744,8457,5798},{3774,8476,5812},{3792,8494,5825},{3796,8512,5838},{3786,8531,5850},
+    {3758,8549,5862},{3712,8567,5873},{3645,8585,5884},{3555,8603,5895},{3439,8620,5905},{3294,8636,5914},{3120,8651,5923},{2913,8666,5931},
+    {2673,8678,5938},{2400,8690,5945},{2096,8699,5951},{1763,8706,5956},{1409,8711,5961},{1040,8714,5965},{667,8715,5968},{298,8713,5970},
+    {-57,8708,5972},{-391,8702,5973},{-696,8693,5973},{-970,8683,5973},{-1211,8671,5972},{-1418,8658,5970},{-1593,8643,5968},{-1736,8628,5965},
+    {-1852,8613,5961},{-1941,8597,5957},{-2007,8580,5953},{-2052,8564,5948},{-2078,8547,5943},{-2087,8531,5937},{-2081,8515,5931},{-2062,8499,5925},
+    {-2031,8483,5918},{-1990,8468,5912},{-1939,8454,5905},{-1880,8439,5898},{-1813,8426,5890},{-1740,8413,5883},{-1661,8401,5876},{-1577,8389,5869},
+    {-1489,8379,5862},{-1396,8369,5855},{-1300,8360,5848},{-1201,8351,5841},{-1099,8344,5834},{-995,8337,5828},{-889,8331,5822},{-782,8326,5816},
+    {-673,8322,5810},{-563,8319,5805},{-452,8317,5800},{-341,8315,5795},{-230,8315,5790}
+  },
+  {  // +78
+    {-317,8451,5796},{-206,8451,5792},{-95,8452,5789},{15,8453,5785},{124,8456,5782},{232,8459,5779},{338,8463,5777},{443,8467,5774},
+    {546,8472,5772},{646,8478,5770},{744,8484,5769},{839,8491,5767},{930,8499,5765},{1017,8507,5764},{1100,8516,5763},{1177,8526,5762},
+    {1249,8536,5761},{1315,8546,5760},{1373,8557,5760},{1424,8569,5759},{1465,8580,5759},{1497,8592,5758},{1516,8605,5757},{1524,8617,5757},
+    {1517,8630,5756},{1493,8643,5756},{1452,8655,5755},{1391,8668,5754},{1308,8680,5753},{1200,8692,5752},{1065,8704,5751},{902,8715,5750},
+    {709,8725,5748},{484,8734,5747},{229,8742,5745},{-56,8748,5743},{-366,8753,5740},{-696,8757,5738},{-1040,8758,5735},{-1388,8757,5732},
+    {-1733,8755,5728},{-2065,8751,5725},{-2378,8744,5721},{-2664,8737,5716},{-2922,8727,5712},{-3148,8716,5707},{-3343,8704,5702},{-3507,8691,5696},
+    {-3641,8678,5691},{-3747,8663,5685},{-3829,8648,5679},{-3887,8632,5672},{-3924,8616,5666},{-3942,8600,5659},{-3943,8584,5652},{-3929,8568,5645},
+    {-3902,8551,5638},{-3862,8535,5630},{-3811,8519,5623},{-3751,8503,5615},{-3682,8487,5608},{-3604,8472,5600},{-3520,8456,5593},{-3430,8442,5585},
+    {-3333,8427,5578},{-3231,8413,5571},{-3125,8399,5564},{-3014,8386,5557},{-2900,8373,5550},{-2782,8361,5543},{-2661,8349,5537},{-2537,8338,5530},
+    {-2410,8327,5524},{-2281,8317,5519},{-2150,8307,5514},{-2016,8298,5509},{-1882,8289,5504},{-1745,8281,5500},{-1607,8274,5496},{-1468,8267,5493},
+    {-1328,8260,5490},{-1187,8255,5487},{-1045,8249,5485},{-902,8245,5484},{-759,8241,5483},{-615,8237,5482},{-471,8235,5482},{-326,8232,5482},
+    {-182,8231,5483},{-37,8230,5485},{108,8229,5487},{252,8229,5490},{397,8230,5493},{541,8231,5496},{685,8233,5500},{828,8235,5505},
+    {971,8239,5510},{1113,8242,5516},{1255,8246,5522},{1395,8251,5529},{1535,8256,5536},{1674,8262,5543},{1811,8269,5551},{1947,8276,5560},
+    {2082,8283,5568},{2215,8291,5578},{2347,8300,5587},{2477,8309,5597},{2604,8319,5607},{2730,8330,5618},{2853,8340,5628},{2974,8352,5639},
+    {3092,8364,5650},{3206,8376,5662},{3318,8389,5673},{3425,8402,5685},{3529,8416,5697},{3628,8430,5708},{3722,8445,5720},{3811,8460,5732},
+    {3893,8475,5743},{3969,8491,5755},{4037,8507,5766},{4097,8523,5777},{4148,8540,5788},{4188,8556,5799},{4217,8573,5810},{4232,8590,5820},
+    {4232,8607,5830},{4214,8624,5839},{4178,8641,5848},{4120,8658,5857},{4037,8674,5865},{3927,8689,5873},{3786,8705,5881},{3611,8719,5888},
+    {3399,8732,5894},{3147,8745,5900},{2856,8755,5905},{2525,8764,5910},{2158,8772,5914},{1761,8777,5918},{1345,8780,5921},{920,8781,5923},
+    {499,8780,5925},{94,8776,5927},{-283,8771,5928},{-627,8763,5928},{-931,8754,5928},{-1196,8744,5927},{-1421,8732,5926},{-1608,8720,5925},
+    {-1759,8707,5923},{-1880,8694,5920},{-1971,8680,5917},{-2037,8666,5914},{-2081,8652,5911},{-2104,8638,5907},{-2110,8625,5903},{-2101,8611,5898},
+    {-2078,8598,5894},{-2043,8585,5889},{-1998,8572,5884},{-1944,8560,5879},{-1881,8548,5874},{-1811,8537,5869},{-1735,8527,5863},{-1653,8517,5858},
+    {-1566,8508,5852},{-1475,8499,5847},{-1380,8491,5842},{-1282,8484,5837},{-1182,8477,5831},{-1078,8471,5826},{-973,8466,5822},{-866,8462,5817},
+    {-758,8458,5812},{-648,8455,5808},{-538,8453,5804},{-427,8452,5799},{-317,8451,5796}
+  },
+  {  // +80
+    {-444,8582,5793},{-336,8582,5790},{-228,8582,5787},{-121,8583,5784},{-15,8585,5781},{89,8587,5779},{191,8590,5776},{292,8594,5774},
+    {390,8598,5772},{485,8602,5770},{577,8607,5768},{665,8613,5766},{749,8619,5764},{828,8626,5762},{901,8633,5761},{969,8640,5759},
+    {1030,8648,5758},{1082,8656,5756},{1127,8665,5755},{1161,8674,5753},{1184,8683,5752},{1195,8693,5751},{1193,8702,5749},{1174,8712,5748},
+    {1139,8722,5747},{1083,8731,5745},{1007,8741,5744},{906,8750,5742},{780,8759,5741},{626,8768,5739},{442,8776,5737},{227,8783,5735},
+    {-19,8790,5733},{-294,8795,5731},{-596,8799,5729},{-920,8802,5726},{-1259,8803,5723},{-1605,8803,5721},{-1950,8801,5718},{-2285,8798,5714},
+    {-2602,8793,5711},{-2895,8787,5708},{-3160,8779,5704},{-3394,8770,5700},{-3597,8760,5696},{-3769,8750,5691},{-3910,8738,5687},{-4024,8726,5682},
+    {-4112,8713,5678},{-4175,8700,5673},{-4218,8687,5667},{-4240,8673,5662},{-4245,8659,5657},{-4235,8645,5651},{-4210,8631,5646},{-4173,8617,5640},
+    {-4125,8603,5634},{-4066,8589,5629},{-3998,8575,5623},{-3922,8561,5617},{-3839,8548,5611},{-3749,8535,5605},{-3653,8522,5599},{-3551,8509,5594},
+    {-3445,8497,5588},{-3333,8485,5582},{-3218,8473,5577},{-3099,8462,5572},{-2977,8451,5566},{-2852,8440,5561},{-2724,8430,5557},{-2593,8420,5552},
+    {-2460,8411,5548},{-2325,8402,5543},{-2188,8394,5540},{-2050,8386,5536},{-1909,8378,5533},{-1768,8372,5530},{-1625,8365,5527},{-1481,8359,5525},
+    {-1336,8354,5523},{-1189,8349,5521},{-1043,8344,5520},{-895,8340,5519},{-747,8337,5518},{-598,8334,5518},{-449,8331,5518},{-300,8329,5519},
+    {-150,8328,5520},{-1,8327,5521},{149,8326,5523},{299,8326,5526},{449,8327,5528},{598,8328,5531},{748,8330,5535},{897,8332,5539},
+    {1045,8335,5543},{1194,8338,5548},{1341,8341,5553},{1488,8346,5558},{1634,8350,5564},{1780,8355,5570},{1924,8361,5577},{2068,8367,5583},
+    {2210,8374,5590},{2351,8381,5598},{2491,8389,5605},{2630,8397,5613},{2766,8405,5622},{2901,8414,5630},{3035,8424,5638},{3166,8434,5647},
+    {3294,8444,5656},{3421,8455,5665},{3544,8466,5674},{3665,8478,5683},{3782,8490,5692},{3896,8502,5702},{4006,8515,5711},{4111,8528,5720},
+    {4212,8542,5729},{4307,8555,5738},{4396,8569,5748},{4478,8584,5756},{4553,8598,5765},{4620,8613,5774},{4677,8628,5782},{4723,8643,5790},
+    {4757,8658,5798},{4778,8673,5806},{4782,8688,5813},{4768,8703,5820},{4733,8718,5827},{4675,8733,5833},{4589,8747,5839},{4472,8761,5845},
+    {4319,8775,5851},{4127,8787,5855},{3890,8799,5860},{3605,8810,5864},{3270,8819,5868},{2886,8827,5871},{2456,8833,5874},{1991,8838,5877},
+    {1504,8840,5879},{1011,8840,5881},{529,8838,5882},{76,8835,5883},{-338,8829,5883},{-705,8822,5883},{-1022,8814,5883},{-1290,8805,5883},
+    {-1512,8795,5882},{-1691,8784,5881},{-1832,8774,5879},{-1939,8762,5877},{-2017,8751,5875},{-2069,8740,5873},{-2099,8728,5870},{-2109,8717,5868},
+    {-2103,8706,5865},{-2082,8695,5862},{-2048,8685,5858},{-2004,8675,5855},{-1950,8665,5851},{-1887,8656,5848},{-1817,8647,5844},{-1740,8639,5840},
+    {-1658,8631,5836},{-1572,8624,5832},{-1481,8617,5829},{-1386,8611,5825},{-1288,8605,5821},{-1188,8600,5817},{-1085,8596,5814},{-981,8592,5810},
+    {-875,8589,5806},{-768,8586,5803},{-660,8584,5799},{-552,8583,5796},{-444,8582,5793}
+  },
+  {  // +82
+    {-659,8708,5783},{-558,8708,5781},{-458,8708,5778},{-360,8708,5776},{-262,8709,5774},{-167,8711,5771},{-75,8713,5769},{15,8715,5767},
+    {102,8718,5765},{184,8721,5763},{262,8725,5761},{336,8729,5759},{403,8734,5757},{464,8738,5755},{517,8744,5753},{563,8749,5751},
+    {599,8755,5750},{624,8761,5748},{639,8767,5746},{640,8773,5744},{626,8780,5743},{596,8787,5741},{548,8793,5739},{480,8800,5737},
+    {390,8806,5735},{275,8813,5734},{135,8819,5732},{-34,8824,5730},{-231,8830,5728},{-457,8834,5726},{-712,8838,5723},{-993,8841,5721},
+    {-1296,8843,5719},{-1615,8844,5717},{-1945,8844,5714},{-2276,8843,5712},{-2601,8841,5709},{-2912,8837,5706},{-3204,8833,5703},{-3471,8827,5700},
+    {-3709,8820,5697},{-3919,8813,5694},{-4098,8804,5691},{-4249,8795,5687},{-4371,8786,5684},{-4468,8776,5680},{-4541,8765,5676},{-4592,8754,5673},
+    {-4623,8743,5669},{-4635,8732,5665},{-4632,8721,5661},{-4614,8709,5656},{-4583,8697,5652},{-4540,8686,5648},{-4486,8674,5644},{-4423,8662,5639},
+    {-4351,8651,5635},{-4271,8639,5631},{-4184,8628,5626},{-4091,8617,5622},{-3992,8606,5618},{-3887,8595,5613},{-3778,8584,5609},{-3664,8574,5605},
+    {-3547,8564,5601},{-3425,8554,5597},{-3301,8544,5593},{-3173,8535,5589},{-3043,8526,5585},{-2910,8517,5582},{-2774,8509,5579},{-2637,8501,5575},
+    {-2497,8494,5572},{-2356,8486,5569},{-2213,8479,5567},{-2069,8473,5564},{-1923,8467,5562},{-1776,8461,5560},{-1628,8456,5558},{-1478,8451,5557},
+    {-1328,8446,5556},{-1177,8442,5555},{-1025,8438,5554},{-873,8435,5554},{-720,8432,5554},{-567,8430,5554},{-413,8428,5554},{-258,8426,5555},
+    {-104,8425,5556},{51,8424,5557},{206,8424,5559},{361,8424,5561},{516,8424,5563},{671,8425,5566},{825,8427,5569},{980,8429,5572},
+    {1135,8431,5575},{1289,8433,5579},{1443,8437,5583},{1596,8440,5587},{1749,8444,5591},{1901,8448,5596},{2053,8453,5601},{2204,8458,5606},
+    {2354,8464,5612},{2503,8470,5617},{2652,8476,5623},{2799,8483,5629},{2945,8490,5635},{3090,8498,5642},{3234,8506,5648},{3376,8514,5655},
+    {3516,8523,5661},{3655,8532,5668},{3792,8541,5675},{3926,8551,5682},{4059,8561,5689},{4188,8572,5696},{4315,8582,5703},{4439,8593,5710},
+    {4559,8604,5717},{4675,8616,5723},{4788,8628,5730},{4895,8640,5737},{4998,8652,5744},{5094,8664,5750},{5184,8677,5756},{5266,8689,5763},
+    {5340,8702,5769},{5405,8715,5775},{5458,8728,5780},{5499,8741,5786},{5526,8754,5791},{5535,8767,5796},{5526,8780,5801},{5493,8793,5805},
+    {5435,8805,5809},{5345,8817,5813},{5219,8829,5817},{5050,8840,5821},{4833,8851,5824},{4560,8861,5827},{4225,8870,5829},{3824,8878,5832},
+    {3357,8884,5834},{2830,8889,5836},{2258,8892,5837},{1664,8894,5838},{1073,8893,5839},{512,8891,5840},{0,8887,5840},{-449,8882,5840},
+    {-833,8875,5840},{-1152,8868,5840},{-1412,8860,5839},{-1618,8852,5839},{-1777,8844,5838},{-1897,8835,5837},{-1983,8826,5835},{-2040,8817,5834},
+    {-2072,8809,5832},{-2083,8800,5830},{-2077,8792,5828},{-2055,8784,5826},{-2020,8776,5824},{-1974,8769,5822},{-1919,8762,5819},{-1855,8755,5817},
+    {-1785,8749,5814},{-1708,8743,5812},{-1626,8738,5809},{-1539,8733,5807},{-1449,8728,5804},{-1356,8724,5801},{-1261,8720,5799},{-1163,8717,5796},
+    {-1064,8714,5793},{-963,8712,5791},{-862,8710,5788},{-761,8709,5786},{-659,8708,5783}
+  },
+  {  // +84
+    {-1140,8828,5767},{-1059,8828,5765},{-979,8827,5763},{-902,8827,5762},{-827,8828,5760},{-756,8828,5758},{-690,8829,5756},{-628,8831,5754},
+    {-572,8832,5753},{-523,8834,5751},{-481,8836,5749},{-447,8839,5747},{-423,8841,5745},{-409,8844,5744},{-407,8847,5742},{-417,8850,5740},
+    {-443,8854,5738},{-484,8857,5736},{-543,8861,5735},{-621,8864,5733},{-719,8867,5731},{-841,8871,5729},{-985,8874,5727},{-1154,8876,5725},
+    {-1348,8879,5723},{-1565,8881,5721},{-1805,8883,5720},{-2065,8884,5718},{-2341,8884,5715},{-2627,8884,5713},{-2918,8883,5711},{-3208,8882,5709},
+    {-3490,8879,5707},{-3758,8876,5705},{-4009,8872,5702},{-4239,8868,5700},{-4444,8863,5698},{-4625,8857,5695},{-4780,8850,5693},{-4910,8844,5690},
+    {-5016,8836,5688},{-5099,8829,5685},{-5162,8821,5682},{-5205,8813,5679},{-5229,8804,5677},{-5238,8796,5674},{-5231,8787,5671},{-5211,8778,5668},
+    {-5178,8769,5665},{-5135,8760,5662},{-5081,8751,5659},{-5017,8742,5656},{-4946,8733,5653},{-4867,8723,5650},{-4780,8714,5647},{-4688,8705,5644},
+    {-4590,8696,5641},{-4486,8687,5638},{-4377,8679,5635},{-4265,8670,5632},{-4148,8662,5629},{-4027,8653,5626},{-3903,8645,5623},{-3775,8637,5620},
+    {-3645,8629,5617},{-3512,8622,5615},{-3377,8615,5612},{-3239,8607,5610},{-3099,8601,5607},{-2957,8594,5605},{-2813,8588,5603},{-2668,8581,5601},
+    {-2521,8576,5599},{-2373,8570,5597},{-2223,8565,5596},{-2072,8560,5594},{-1920,8555,5593},{-1767,8550,5592},{-1613,8546,5591},{-1458,8543,5590},
+    {-1302,8539,5590},{-1146,8536,5589},{-989,8533,5589},{-831,8530,5589},{-673,8528,5589},{-514,8526,5589},{-355,8525,5590},{-196,8524,5591},
+    {-36,8523,5592},{124,8522,5593},{285,8522,5594},{445,8522,5596},{606,8523,5597},{767,8523,5599},{927,8524,5601},{1088,8526,5604},
+    {1249,8528,5606},{1409,8530,5609},{1570,8532,5612},{1730,8535,5615},{1890,8538,5618},{2050,8542,5622},{2209,8546,5625},{2368,8550,5629},
+    {2527,8554,5633},{2685,8559,5637},{2843,8564,5641},{3000,8569,5645},{3156,8575,5649},{3312,8581,5654},{3467,8587,5658},{3621,8594,5663},
+    {3774,8600,5667},{3926,8608,5672},{4077,8615,5677},{4227,8622,5682},{4375,8630,5687},{4522,8638,5691},{4668,8647,5696},{4811,8655,5701},
+    {4953,8664,5706},{5093,8673,5711},{5230,8682,5715},{5365,8692,5720},{5497,8701,5725},{5626,8711,5729},{5751,8721,5734},{5873,8731,5738},
+    {5990,8741,5742},{6103,8751,5747},{6210,8761,5751},{6311,8772,5755},{6405,8782,5758},{6491,8793,5762},{6567,8803,5766},{6633,8814,5769},
+    {6687,8824,5772},{6726,8834,5775},{6748,8845,5778},{6749,8855,5781},{6726,8865,5783},{6673,8875,5786},{6585,8885,5788},{6453,8894,5790},
+    {6267,8903,5792},{6017,8911,5793},{5688,8919,5795},{5266,8926,5796},{4739,8932,5797},{4104,8937,5798},{3372,8940,5799},{2575,8942,5799},
+    {1763,8942,5800},{992,8941,5800},{303,8938,5800},{-282,8934,5800},{-760,8929,5800},{-1140,8924,5799},{-1435,8918,5799},{-1659,8912,5798},
+    {-1826,8906,5797},{-1946,8900,5797},{-2027,8894,5796},{-2077,8888,5794},{-2102,8882,5793},{-2106,8877,5792},{-2093,8871,5791},{-2065,8866,5789},
+    {-2025,8861,5788},{-1976,8857,5786},{-1919,8853,5785},{-1855,8849,5783},{-1785,8845,5781},{-1711,8842,5780},{-1634,8839,5778},{-1554,8836,5776},
+    {-1473,8834,5774},{-1390,8832,5773},{-1306,8830,5771},{-1223,8829,5769},{-1140,8828,5767}
+  },
+  {  // +86
+    {-3319,8938,5746},{-3298,8937,5745},{-3284,8936,5744},{-3278,8935,5742},{-3281,8934,5741},{-3293,8934,5740},{-3316,8933,5738},{-3351,8933,5737},
+    {-3398,8933,5736},{-3457,8932,5734},{-3530,8932,5733},{-3617,8932,5732},{-3719,8932,5730},{-3834,8931,5729},{-3963,8931,5727},{-4104,8930,5726},
+    {-4257,8930,5724},{-4420,8929,5723},{-4591,8928,5721},{-4767,8927,5720},{-4945,8926,5718},{-5124,8924,5717},{-5299,8922,5715},{-5469,8920,5713},
+    {-5630,8917,5712},{-5782,8914,5710},{-5920,8911,5708},{-6046,8908,5707},{-6157,8904,5705},{-6253,8900,5703},{-6334,8896,5702},{-6401,8891,5700},
+    {-6452,8886,5698},{-6489,8882,5696},{-6513,8876,5694},{-6524,8871,5693},{-6522,8866,5691},{-6509,8860,5689},{-6485,8854,5687},{-6451,8848,5685},
+    {-6408,8842,5683},{-6356,8836,5681},{-6296,8830,5679},{-6228,8823,5677},{-6154,8817,5675},{-6073,8811,5673},{-5986,8804,5671},{-5893,8798,5669},
+    {-5795,8791,5667},{-5692,8785,5665},{-5585,8778,5663},{-5474,8772,5661},{-5358,8766,5660},{-5240,8759,5658},{-5117,8753,5656},{-4992,8747,5654},
+    {-4864,8740,5652},{-4733,8734,5650},{-4599,8728,5648},{-4463,8722,5646},{-4325,8717,5645},{-4184,8711,5643},{-4042,8705,5641},{-3898,8700,5640},
+    {-3752,8695,5638},{-3604,8690,5637},{-3455,8684,5635},{-3305,8680,5634},{-3153,8675,5633},{-3000,8670,5631},{-2846,8666,5630},{-2690,8662,5629},
+    {-2534,8658,5628},{-2376,8654,5627},{-2218,8650,5626},{-2059,8647,5626},{-1899,8644,5625},{-1738,8641,5625},{-1576,8638,5624},{-1414,8635,5624},
+    {-1251,8633,5624},{-1088,8631,5624},{-924,8629,5624},{-759,8627,5624},{-595,8626,5624},{-429,8625,5625},{-263,8623,5625},{-97,8623,5626},
+    {69,8622,5626},{236,8622,5627},{403,8622,5628},{571,8622,5629},{738,8622,5631},{906,8623,5632},{1074,8624,5633},{1242,8625,5635},
+    {1410,8626,5636},{1579,8628,5638},{1747,8629,5640},{1915,8631,5642},{2084,8634,5644},{2253,8636,5646},{2421,8639,5648},{2590,8642,5651},
+    {2758,8645,5653},{2927,8648,5655},{3095,8652,5658},{3263,8655,5661},{3431,8659,5663},{3599,8663,5666},{3767,8668,5669},{3935,8672,5672},
+    {4102,8677,5674},{4269,8682,5677},{4436,8687,5680},{4603,8692,5683},{4769,8698,5686},{4935,8703,5689},{5101,8709,5692},{5266,8715,5695},
+    {5431,8721,5698},{5595,8727,5701},{5759,8734,5704},{5922,8740,5707},{6084,8747,5709},{6246,8754,5712},{6408,8760,5715},{6568,8767,5718},
+    {6728,8774,5720},{6887,8781,5723},{7045,8789,5726},{7202,8796,5728},{7358,8803,5731},{7512,8810,5733},{7666,8818,5735},{7818,8825,5737},
+    {7968,8832,5740},{8117,8840,5742},{8263,8847,5744},{8408,8855,5745},{8550,8862,5747},{8690,8869,5749},{8826,8877,5750},{8959,8884,5752},
+    {9088,8891,5753},{9212,8899,5754},{9330,8906,5756},{9443,8913,5757},{9547,8920,5758},{9642,8927,5759},{9724,8933,5759},{9792,8940,5760},
+    {9840,8946,5761},{9861,8953,5761},{9846,8959,5761},{9778,8965,5762},{9630,8971,5762},{9351,8976,5762},{8843,8981,5762},{7899,8986,5762},
+    {6113,8990,5762},{3187,8991,5762},{272,8990,5761},{-1505,8987,5761},{-2451,8983,5760},{-2970,8979,5760},{-3266,8975,5759},{-3438,8972,5759},
+    {-3534,8968,5758},{-3583,8964,5757},{-3601,8961,5756},{-3597,8958,5756},{-3579,8955,5755},{-3552,8952,5754},{-3519,8950,5753},{-3483,8947,5752},
+    {-3446,8945,5751},{-3410,8943,5750},{-3375,8941,5748},{-3345,8940,5747},{-3319,8938,5746}
+  },
+  {  // +88
+    {-15180,8931,5721},{-14901,8930,5720},{-14628,8929,5720},{-14363,8929,5719},{-14105,8928,5718},{-13855,8927,5718},{-13612,8926,5717},{-13376,8924,5716},
+    {-13147,8923,5715},{-12926,8921,5715},{-12711,8920,5714},{-12502,8918,5713},{-12300,8916,5712},{-12103,8915,5711},{-11911,8913,5711},{-11724,8911,5710},
+    {-11542,8909,5709},{-11363,8906,5708},{-11189,8904,5707},{-11018,8902,5706},{-10850,8899,5705},{-10684,8897,5704},{-10521,8894,5703},{-10360,8892,5702},
+    {-10201,8889,5701},{-10044,8886,5700},{-9888,8883,5699},{-9733,8880,5698},{-9579,8877,5697},{-9426,8874,5696},{-9273,8871,5695},{-9121,8868,5694},
+    {-8969,8865,5693},{-8817,8862,5692},{-8665,8859,5691},{-8513,8855,5690},{-8361,8852,5689},{-8209,8849,5688},{-8056,8845,5687},{-7903,8842,5686},
+    {-7750,8838,5685},{-7596,8835,5684},{-7442,8831,5683},{-7287,8828,5682},{-7132,8825,5680},{-6976,8821,5679},{-6819,8818,5678},{-6662,8814,5677},
+    {-6504,8811,5676},{-6346,8807,5675},{-6187,8804,5674},{-6027,8800,5674},{-5867,8797,5673},{-5706,8794,5672},{-5545,8791,5671},{-5383,8787,5670},
+    {-5220,8784,5669},{-5057,8781,5668},{-4893,8778,5667},{-4728,8775,5667},{-4563,8772,5666},{-4397,8769,5665},{-4231,8766,5664},{-4064,8763,5664},
+    {-3897,8760,5663},{-3729,8758,5662},{-3561,8755,5662},{-3392,8753,5661},{-3223,8750,5661},{-3053,8748,5660},{-2883,8746,5660},{-2712,8744,5660},
+    {-2541,8742,5659},{-2369,8740,5659},{-2197,8738,5659},{-2025,8736,5659},{-1852,8734,5658},{-1679,8733,5658},{-1505,8731,5658},{-1331,8730,5658},
+    {-1157,8729,5658},{-982,8728,5658},{-807,8727,5658},{-632,8726,5659},{-456,8725,5659},{-280,8725,5659},{-104,8724,5659},{73,8724,5660},
+    {250,8724,5660},{427,8723,5661},{604,8723,5661},{782,8724,5662},{960,8724,5662},{1139,8724,5663},{1317,8725,5664},{1496,8725,5664},
+    {1676,8726,5665},{1855,8727,5666},{2035,8728,5667},{2215,8729,5668},{2395,8730,5669},{2576,8731,5670},{2757,8733,5671},{2938,8734,5672},
+    {3120,8736,5673},{3301,8738,5674},{3483,8740,5675},{3666,8742,5676},{3848,8744,5678},{4031,8746,5679},{4215,8748,5680},{4399,8751,5681},
+    {4583,8753,5683},{4767,8756,5684},{4952,8758,5685},{5137,8761,5687},{5323,8764,5688},{5509,8767,5689},{5695,8770,5691},{5882,8773,5692},
+    {6070,8776,5693},{6258,8779,5695},{6446,8782,5696},{6636,8786,5697},{6825,8789,5698},{7016,8793,5700},{7207,8796,5701},{7399,8800,5702},
+    {7592,8803,5704},{7786,8807,5705},{7980,8811,5706},{8176,8814,5707},{8372,8818,5708},{8570,8822,5710},{8769,8825,5711},{8969,8829,5712},
+    {9171,8833,5713},{9374,8837,5714},{9578,8840,5715},{9785,8844,5716},{9993,8848,5717},{10202,8851,5717},{10414,8855,5718},{10628,8859,5719},
+    {10845,8862,5720},{11064,8866,5721},{11285,8870,5721},{11509,8873,5722},{11737,8876,5723},{11967,8880,5723},{12201,8883,5724},{12438,8886,5724},
+    {12679,8890,5724},{12924,8893,5725},{13173,8896,5725},{13427,8899,5726},{13684,8901,5726},{13947,8904,5726},{14214,8907,5726},{14486,8909,5726},
+    {14763,8912,5726},{15044,8914,5726},{15331,8916,5726},{15622,8918,5726},{15918,8920,5726},{16218,8922,5726},{16522,8923,5726},{16829,8925,5726},
+    {17140,8926,5726},{17452,8927,5726},{17767,8929,5725},{-17918,8929,5725},{-17603,8930,5725},{-17288,8931,5724},{-16976,8931,5724},{-16665,8931,5723},
+    {-16359,8932,5723},{-16056,8932,5722},{-15758,8931,5722},{-15466,8931,5721},{-15180,8931,5721}
+  },
+  {  // +90
+    {-16958,8827,5692},{-16758,8827,5692},{-16558,8827,5692},{-16358,8827,5692},{-16158,8827,5692},{-15958,8827,5692},{-15758,8827,5692},{-15558,8827,5692},
+    {-15358,8827,5692},{-15158,8827,5692},{-14958,8827,5692},{-14758,8827,5692},{-14558,8827,5692},{-14358,8827,5692},{-14158,8827,5692},{-13958,8827,5692},
+    {-13758,8827,5692},{-13558,8827,5692},{-13358,8827,5692},{-13158,8827,5692},{-12958,8827,5692},{-12758,8827,5692},{-12558,8827,5692},{-12358,8827,5692},
+    {-12158,8827,5692},{-11958,8827,5692},{-11758,8827,5692},{-11558,8827,5692},{-11358,8827,5692},{-11158,8827,5692},{-10958,8827,5692},{-10758,8827,5692},
+    {-10558,8827,5692},{-10358,8827,5692},{-10158,8827,5692},{-9958,8827,5692},{-9758,8827,5692},{-9558,8827,5692},{-9358,8827,5692},{-9158,8827,5692},
+    {-8958,8827,5692},{-8758,8827,5692},{-8558,8827,5692},{-8358,8827,5692},{-8158,8827,5692},{-7958,8827,5692},{-7758,8827,5692},{-7558,8827,5692},
+    {-7358,8827,5692},{-7158,8827,5692},{-6958,8827,5692},{-6758,8827,5692},{-6558,8827,5692},{-6358,8827,5692},{-6158,8827,5692},{-5958,8827,5692},
+    {-5758,8827,5692},{-5558,8827,5692},{-5358,8827,5692},{-5158,8827,5692},{-4958,8827,5692},{-4758,8827,5692},{-4558,8827,5692},{-4358,8827,5692},
+    {-4158,8827,5692},{-3958,8827,5692},{-3758,8827,5692},{-3558,8827,5692},{-3358,8827,5692},{-3159,8827,5692},{-2959,8827,5692},{-2759,8827,5692},
+    {-2559,8827,5692},{-2359,8827,5692},{-2159,8827,5692},{-1959,8827,5692},{-1759,8827,5692},{-1559,8827,5692},{-1359,8827,5692},{-1159,8827,5692},
+    {-959,8827,5692},{-759,8827,5692},{-559,8827,5692},{-359,8827,5692},{-159,8827,5692},{41,8827,5692},{241,8827,5692},{441,8827,5692},
+    {641,8827,5692},{841,8827,5692},{1041,8827,5692},{1241,8827,5692},{1441,8827,5692},{1641,8827,5692},{1841,8827,5692},{2041,8827,5692},
+    {2241,8827,5692},{2441,8827,5692},{2641,8827,5692},{2841,8827,5692},{3041,8827,5692},{3241,8827,5692},{3441,8827,5692},{3641,8827,5692},
+    {3841,8827,5692},{4041,8827,5692},{4241,8827,5692},{4441,8827,5692},{4641,8827,5692},{4841,8827,5692},{5041,8827,5692},{5241,8827,5692},
+    {5441,8827,5692},{5641,8827,5692},{5841,8827,5692},{6041,8827,5692},{6241,8827,5692},{6441,8827,5692},{6641,8827,5692},{6841,8827,5692},
+    {7041,8827,5692},{7241,8827,5692},{7441,8827,5692},{7641,8827,5692},{7841,8827,5692},{8041,8827,5692},{8241,8827,5692},{8441,8827,5692},
+    {8641,8827,5692},{8841,8827,5692},{9041,8827,5692},{9241,8827,5692},{9441,8827,5692},{9641,8827,5692},{9841,8827,5692},{10041,8827,5692},
+    {10241,8827,5692},{10441,8827,5692},{10641,8827,5692},{10841,8827,5692},{11041,8827,5692},{11241,8827,5692},{11441,8827,5692},{11641,8827,5692},
+    {11841,8827,5692},{12041,8827,5692},{12241,8827,5692},{12441,8827,5692},{12641,8827,5692},{12841,8827,5692},{13041,8827,5692},{13241,8827,5692},
+    {13441,8827,5692},{13641,8827,5692},{13841,8827,5692},{14041,8827,5692},{14241,8827,5692},{14441,8827,5692},{14641,8827,5692},{14841,8827,5692},
+    {15041,8827,5692},{15241,8827,5692},{15441,8827,5692},{15641,8827,5692},{15841,8827,5692},{16041,8827,5692},{16241,8827,5692},{16441,8827,5692},
+    {16642,8827,5692},{16842,8827,5692},{17042,8827,5692},{17242,8827,5692},{17442,8827,5692},{17642,8827,5692},{17842,8827,5692},{-17958,8827,5692},
+    {-17758,8827,5692},{-17558,8827,5692},{-17358,8827,5692},{-17158,8827,5692},{-16958,8827,5692}
+  }
+};
+
+#endif // MAGNETIC_GRID_DATA_H
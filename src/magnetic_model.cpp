@@ -0,0 +1,58 @@
+/*
+ * magnetic_model.cpp
+ * 
+ * Interpolation of the precomputed geomagnetic field grid
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "magnetic_model.h"
+#include "hal.h"
+#include "magnetic_grid_data.h"
+
+void getMagneticField(float latitude, float longitude, MagneticField *field) {
+  // 経度を-180〜180度に正規化し、緯度は範囲内に制限する
+  while (longitude < -180.0f) longitude += 360.0f;
+  while (longitude > 180.0f) longitude -= 360.0f;
+  latitude = constrain(latitude, -90.0f, 90.0f);
+  
+  float row = (latitude + 90.0f) / MAGNETIC_GRID_STEP;
+  float column = (longitude + 180.0f) / MAGNETIC_GRID_STEP;
+  int r0 = (int)row;
+  int c0 = (int)column;
+  if (r0 > MAGNETIC_GRID_ROWS - 2) r0 = MAGNETIC_GRID_ROWS - 2;
+  if (c0 > MAGNETIC_GRID_COLUMNS - 2) c0 = MAGNETIC_GRID_COLUMNS - 2;
+  float tr = row - r0;
+  float tc = column - c0;
+  
+  // Corner weights
+  float w00 = (1.0f - tr) * (1.0f - tc);
+  float w01 = (1.0f - tr) * tc;
+  float w10 = tr * (1.0f - tc);
+  float w11 = tr * tc;
+  
+  const int16_t *p00 = MAGNETIC_GRID[r0][c0];
+  const int16_t *p01 = MAGNETIC_GRID[r0][c0 + 1];
+  const int16_t *p10 = MAGNETIC_GRID[r0 + 1][c0];
+  const int16_t *p11 = MAGNETIC_GRID[r0 + 1][c0 + 1];
+  
+  // 偏角は±180度をまたぐ場合があるため、最初の格子点を基準に連続にする
+  float d00 = p00[0];
+  float d[3] = { (float)p01[0], (float)p10[0], (float)p11[0] };
+  for (int i = 0; i < 3; i++) {
+    if (d[i] - d00 > 18000.0f) d[i] -= 36000.0f;
+    if (d[i] - d00 < -18000.0f) d[i] += 36000.0f;
+  }
+  float declination = (w00 * d00 + w01 * d[0] + w10 * d[1] + w11 * d[2]) * 0.01f;
+  if (declination > 180.0f) declination -= 360.0f;
+  if (declination < -180.0f) declination += 360.0f;
+  
+  field->declination = declination;
+  field->inclination = (w00 * p00[1] + w01 * p01[1] + w10 * p10[1] + w11 * p11[1]) * 0.01f;
+  field->fieldStrength = (w00 * p00[2] + w01 * p01[2] + w10 * p10[2] + w11 * p11[2]) * 0.01f;
+}
+
+float getMagneticModelEpoch() {
+  return MAGNETIC_GRID_EPOCH;
+}
@@ -0,0 +1,31 @@
+/*
+ * magnetic_model.h
+ * 
+ * Geomagnetic field lookup for the Polaris Navigator
+ * Bilinear interpolation of a World Magnetic Model grid generated offline
+ * by tools/gen_magnetic_grid.py (2 degree spacing, see magnetic_grid_data.h)
+ * 
+ * 偏角は真北と磁北の差（東偏が正）。磁極の近く（伏角が±85度を超える所）では
+ * 水平成分が小さく偏角の精度は保証されない。
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef MAGNETIC_MODEL_H
+#define MAGNETIC_MODEL_H
+
+// Expected geomagnetic field at a location
+struct MagneticField {
+  float declination;    // 偏角（度、東偏が正）
+  float inclination;    // 伏角（度、下向きが正）
+  float fieldStrength;  // 全磁力（uT）
+};
+
+// Field at a geodetic latitude/longitude (degrees, sea level)
+void getMagneticField(float latitude, float longitude, MagneticField *field);
+
+// Decimal year of the grid
+float getMagneticModelEpoch();
+
+#endif // MAGNETIC_MODEL_H
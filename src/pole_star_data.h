@@ -0,0 +1,968 @@
+/*
+ * pole_star_data.h
+ * 
+ * Generated by tools/gen_pole_star_table.py - do not edit
+ * Apparent places of the pole stars and refraction for pole_star_table.cpp
+ * 
+ * 赤経は均時差（分点差）を含めたGMST基準の値（時角 = GMST + 経度 - 赤経）
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef POLE_STAR_DATA_H
+#define POLE_STAR_DATA_H
+
+// const配列はESP32ではフラッシュ（rodata）に配置される
+
+// Apparent places: 2024-01-01 to 2035-12-31, every 10 days
+#define POLE_STAR_TABLE_START_JD  2460310.5
+#define POLE_STAR_TABLE_STEP_DAYS 10.0
+#define POLE_STAR_TABLE_ENTRIES   440
+
+// [star][entry] = { RA (deg, GMST frame), Dec (deg) }
+static const float POLE_STAR_PLACES[2][POLE_STAR_TABLE_ENTRIES][2] = {
+  {  // Polaris
+    // 2024
+    { 45.866033f, 89.3695814f },
+    { 45.806584f, 89.3701669f },
+    { 45.733339f, 89.3706358f },
+    { 45.653052f, 89.3709727f },
+    { 45.576639f, 89.3711034f },
+    { 45.497712f, 89.3710045f },
+    { 45.415097f, 89.3707469f },
+    { 45.345549f, 89.3703885f },
+    { 45.289255f, 89.3698291f },
+    { 45.238375f, 89.3690975f },
+    { 45.200818f, 89.3683660f },
+    { 45.182016f, 89.3675876f },
+    { 45.180119f, 89.3667063f },
+    { 45.189262f, 89.3658565f },
+    { 45.210318f, 89.3650896f },
+    { 45.252360f, 89.3643786f },
+    { 45.306407f, 89.3637027f },
+    { 45.363635f, 89.3631333f },
+    { 45.434186f, 89.3627590f },
+    { 45.516994f, 89.3624763f },
+    { 45.600862f, 89.3622634f },
+    { 45.685933f, 89.3622673f },
+    { 45.775270f, 89.3624399f },
+    { 45.868469f, 89.3626860f },
+    { 45.955861f, 89.3630668f },
+    { 46.034599f, 89.3636116f },
+    { 46.115409f, 89.3642948f },
+    { 46.190793f, 89.3650287f },
+    { 46.249464f, 89.3658283f },
+    { 46.300448f, 89.3667921f },
+    { 46.345855f, 89.3677964f },
+    { 46.375546f, 89.3687541f },
+    { 46.387948f, 89.3697865f },
+    { 46.387390f, 89.3708557f },
+    { 46.376863f, 89.3718322f },
+    { 46.348948f, 89.3727216f },
+    { 46.300951f, 89.3735515f },
+    // 2025
+    { 46.246360f, 89.3742985f },
+    { 46.184670f, 89.3748474f },
+    { 46.107656f, 89.3751894f },
+    { 46.025670f, 89.3754383f },
+    { 45.947353f, 89.3755057f },
+    { 45.870380f, 89.3753050f },
+    { 45.794392f, 89.3749710f },
+    { 45.725121f, 89.3745293f },
+    { 45.673054f, 89.3739241f },
+    { 45.632916f, 89.3731813f },
+    { 45.599176f, 89.3723689f },
+    { 45.585280f, 89.3715778f },
+    { 45.592384f, 89.3707391f },
+    { 45.608468f, 89.3698503f },
+    { 45.636707f, 89.3690894f },
+    { 45.683928f, 89.3684321f },
+    { 45.744214f, 89.3677861f },
+    { 45.810419f, 89.3672617f },
+    { 45.883009f, 89.3669229f },
+    { 45.967823f, 89.3667091f },
+    { 46.058239f, 89.3665849f },
+    { 46.143941f, 89.3666008f },
+    { 46.232775f, 89.3668276f },
+    { 46.326972f, 89.3671662f },
+    { 46.414355f, 89.3675587f },
+    { 46.493982f, 89.3681378f },
+    { 46.570870f, 89.3688728f },
+    { 46.643457f, 89.3696374f },
+    { 46.703839f, 89.3704830f },
+    { 46.748376f, 89.3714405f },
+    { 46.786544f, 89.3724658f },
+    { 46.814677f, 89.3734763f },
+    { 46.820608f, 89.3744552f },
+    { 46.811699f, 89.3754923f },
+    { 46.795481f, 89.3764795f },
+    { 46.762153f, 89.3772998f },
+    { 46.710080f, 89.3780540f },
+    // 2026
+    { 46.649357f, 89.3787405f },
+    { 46.582771f, 89.3792213f },
+    { 46.507124f, 89.3794945f },
+    { 46.422646f, 89.3796302f },
+    { 46.341495f, 89.3796174f },
+    { 46.268458f, 89.3793785f },
+    { 46.195405f, 89.3789289f },
+    { 46.129469f, 89.3784032f },
+    { 46.082073f, 89.3777748f },
+    { 46.048227f, 89.3769695f },
+    { 46.024570f, 89.3761219f },
+    { 46.016207f, 89.3753109f },
+    { 46.028295f, 89.3744747f },
+    { 46.055742f, 89.3736324f },
+    { 46.090183f, 89.3728620f },
+    { 46.139559f, 89.3722307f },
+    { 46.207111f, 89.3716765f },
+    { 46.278962f, 89.3711690f },
+    { 46.353910f, 89.3708519f },
+    { 46.441658f, 89.3707161f },
+    { 46.534599f, 89.3706441f },
+    { 46.624386f, 89.3707002f },
+    { 46.713830f, 89.3709693f },
+    { 46.805431f, 89.3713686f },
+    { 46.895368f, 89.3718375f },
+    { 46.973933f, 89.3724304f },
+    { 47.045304f, 89.3731912f },
+    { 47.115675f, 89.3740310f },
+    { 47.172863f, 89.3748769f },
+    { 47.213232f, 89.3758250f },
+    { 47.245670f, 89.3768725f },
+    { 47.267133f, 89.3778774f },
+    { 47.270740f, 89.3788467f },
+    { 47.255949f, 89.3798418f },
+    { 47.229515f, 89.3807927f },
+    { 47.193172f, 89.3816058f },
+    // 2027
+    { 47.137318f, 89.3822761f },
+    { 47.067720f, 89.3828671f },
+    { 46.998026f, 89.3833070f },
+    { 46.921442f, 89.3834900f },
+    { 46.835712f, 89.3835049f },
+    { 46.755364f, 89.3834110f },
+    { 46.683156f, 89.3831036f },
+    { 46.616389f, 89.3825826f },
+    { 46.556492f, 89.3819769f },
+    { 46.510799f, 89.3812985f },
+    { 46.485141f, 89.3804957f },
+    { 46.469872f, 89.3796083f },
+    { 46.465725f, 89.3787596f },
+    { 46.484575f, 89.3779582f },
+    { 46.518872f, 89.3771281f },
+    { 46.560748f, 89.3763598f },
+    { 46.616390f, 89.3757613f },
+    { 46.686175f, 89.3752549f },
+    { 46.765149f, 89.3748117f },
+    { 46.846163f, 89.3745313f },
+    { 46.931598f, 89.3744363f },
+    { 47.027505f, 89.3744577f },
+    { 47.121107f, 89.3745647f },
+    { 47.207579f, 89.3748459f },
+    { 47.298585f, 89.3753116f },
+    { 47.387786f, 89.3758386f },
+    { 47.465092f, 89.3764447f },
+    { 47.535022f, 89.3772296f },
+    { 47.599049f, 89.3781090f },
+    { 47.654097f, 89.3789934f },
+    { 47.692285f, 89.3799415f },
+    { 47.714907f, 89.3809755f },
+    { 47.730783f, 89.3820085f },
+    { 47.729901f, 89.3829605f },
+    { 47.706777f, 89.3838871f },
+    { 47.674180f, 89.3848055f },
+    { 47.630901f, 89.3855754f },
+    // 2028
+    { 47.571146f, 89.3861641f },
+    { 47.499883f, 89.3866703f },
+    { 47.422783f, 89.3870305f },
+    { 47.345798f, 89.3871512f },
+    { 47.263891f, 89.3870808f },
+    { 47.179819f, 89.3868744f },
+    { 47.109864f, 89.3865161f },
+    { 47.049475f, 89.3859456f },
+    { 46.992880f, 89.3852406f },
+    { 46.953303f, 89.3845164f },
+    { 46.933152f, 89.3837035f },
+    { 46.925890f, 89.3827901f },
+    { 46.931349f, 89.3819258f },
+    { 46.953028f, 89.3811328f },
+    { 46.994316f, 89.3803507f },
+    { 47.045406f, 89.3796169f },
+    { 47.102453f, 89.3790238f },
+    { 47.176289f, 89.3785827f },
+    { 47.260128f, 89.3782082f },
+    { 47.343165f, 89.3779424f },
+    { 47.432274f, 89.3778954f },
+    { 47.527246f, 89.3779854f },
+    { 47.622221f, 89.3781408f },
+    { 47.712887f, 89.3784691f },
+    { 47.798311f, 89.3789700f },
+    { 47.885405f, 89.3795621f },
+    { 47.964403f, 89.3802270f },
+    { 48.027528f, 89.3810036f },
+    { 48.086479f, 89.3819170f },
+    { 48.138001f, 89.3828485f },
+    { 48.170488f, 89.3837738f },
+    { 48.188425f, 89.3847934f },
+    { 48.195802f, 89.3858287f },
+    { 48.188991f, 89.3867652f },
+    { 48.163072f, 89.3876525f },
+    { 48.120109f, 89.3885067f },
+    // 2029
+    { 48.070175f, 89.3892412f },
+    { 48.008489f, 89.3897827f },
+    { 47.930303f, 89.3901706f },
+    { 47.850197f, 89.3904493f },
+    { 47.771846f, 89.3905120f },
+    { 47.689638f, 89.3903284f },
+    { 47.610454f, 89.3900314f },
+    { 47.540531f, 89.3896062f },
+    { 47.484102f, 89.3889784f },
+    { 47.437947f, 89.3882362f },
+    { 47.400668f, 89.3874477f },
+    { 47.385215f, 89.3866248f },
+    { 47.387786f, 89.3857374f },
+    { 47.398260f, 89.3848367f },
+    { 47.425422f, 89.3840511f },
+    { 47.472443f, 89.3833220f },
+    { 47.529217f, 89.3826094f },
+    { 47.593459f, 89.3820450f },
+    { 47.668736f, 89.3816507f },
+    { 47.755201f, 89.3813445f },
+    { 47.844766f, 89.3811457f },
+    { 47.932399f, 89.3811237f },
+    { 48.026560f, 89.3812778f },
+    { 48.123653f, 89.3815202f },
+    { 48.211823f, 89.3818602f },
+    { 48.296347f, 89.3823951f },
+    { 48.380119f, 89.3830519f },
+    { 48.455382f, 89.3837389f },
+    { 48.518849f, 89.3845430f },
+    { 48.570626f, 89.3854716f },
+    { 48.615133f, 89.3864282f },
+    { 48.646243f, 89.3873886f },
+    { 48.655796f, 89.3883718f },
+    { 48.653871f, 89.3893926f },
+    { 48.641788f, 89.3903396f },
+    { 48.608788f, 89.3911606f },
+    { 48.559263f, 89.3919457f },
+    // 2030
+    { 48.502496f, 89.3926321f },
+    { 48.435736f, 89.3931043f },
+    { 48.357239f, 89.3934092f },
+    { 48.272693f, 89.3935897f },
+    { 48.191542f, 89.3935819f },
+    { 48.113631f, 89.3933454f },
+    { 48.034751f, 89.3929394f },
+    { 47.966579f, 89.3924401f },
+    { 47.915679f, 89.3917908f },
+    { 47.874109f, 89.3909784f },
+    { 47.844616f, 89.3901441f },
+    { 47.834521f, 89.3893141f },
+    { 47.842263f, 89.3884230f },
+    { 47.863323f, 89.3875434f },
+    { 47.895381f, 89.3867608f },
+    { 47.944923f, 89.3860692f },
+    { 48.009586f, 89.3854342f },
+    { 48.077877f, 89.3848894f },
+    { 48.154169f, 89.3845330f },
+    { 48.243601f, 89.3843095f },
+    { 48.335245f, 89.3841566f },
+    { 48.424980f, 89.3841729f },
+    { 48.518462f, 89.3843812f },
+    { 48.613698f, 89.3846869f },
+    { 48.704033f, 89.3850884f },
+    { 48.785486f, 89.3856478f },
+    { 48.863489f, 89.3863491f },
+    { 48.937481f, 89.3871084f },
+    { 48.995921f, 89.3879164f },
+    { 49.041235f, 89.3888493f },
+    { 49.080176f, 89.3898435f },
+    { 49.104135f, 89.3907978f },
+    { 49.108985f, 89.3917632f },
+    { 49.099807f, 89.3927613f },
+    { 49.078091f, 89.3936840f },
+    { 49.041443f, 89.3944835f },
+    // 2031
+    { 48.986021f, 89.3951956f },
+    { 48.919835f, 89.3958129f },
+    { 48.849891f, 89.3962459f },
+    { 48.768902f, 89.3964580f },
+    { 48.680842f, 89.3965335f },
+    { 48.599132f, 89.3964570f },
+    { 48.522145f, 89.3961454f },
+    { 48.447874f, 89.3956591f },
+    { 48.383508f, 89.3950871f },
+    { 48.334986f, 89.3943964f },
+    { 48.301976f, 89.3935728f },
+    { 48.279065f, 89.3926975f },
+    { 48.272125f, 89.3918492f },
+    { 48.287376f, 89.3909963f },
+    { 48.314748f, 89.3901230f },
+    { 48.351726f, 89.3893465f },
+    { 48.406799f, 89.3887017f },
+    { 48.474685f, 89.3881152f },
+    { 48.548677f, 89.3876189f },
+    { 48.629292f, 89.3873075f },
+    { 48.717452f, 89.3871449f },
+    { 48.812342f, 89.3870760f },
+    { 48.904438f, 89.3871415f },
+    { 48.994162f, 89.3873897f },
+    { 49.088589f, 89.3877737f },
+    { 49.177935f, 89.3882270f },
+    { 49.256294f, 89.3888098f },
+    { 49.330920f, 89.3895525f },
+    { 49.399501f, 89.3903560f },
+    { 49.455173f, 89.3911965f },
+    { 49.495989f, 89.3921368f },
+    { 49.525285f, 89.3931434f },
+    { 49.544160f, 89.3941290f },
+    { 49.543252f, 89.3950772f },
+    { 49.523528f, 89.3960341f },
+    { 49.494995f, 89.3969438f },
+    { 49.451594f, 89.3977013f },
+    // 2032
+    { 49.389352f, 89.3983346f },
+    { 49.319076f, 89.3988827f },
+    { 49.242780f, 89.3992497f },
+    { 49.160331f, 89.3993865f },
+    { 49.073681f, 89.3993757f },
+    { 48.988336f, 89.3992143f },
+    { 48.913759f, 89.3988520f },
+    { 48.844859f, 89.3983053f },
+    { 48.782219f, 89.3976534f },
+    { 48.738716f, 89.3969326f },
+    { 48.711832f, 89.3960914f },
+    { 48.695690f, 89.3951862f },
+    { 48.696019f, 89.3943307f },
+    { 48.715315f, 89.3934974f },
+    { 48.750188f, 89.3926639f },
+    { 48.794892f, 89.3919162f },
+    { 48.851044f, 89.3913045f },
+    { 48.923547f, 89.3907934f },
+    { 49.002703f, 89.3903592f },
+    { 49.083185f, 89.3900793f },
+    { 49.173631f, 89.3899840f },
+    { 49.269144f, 89.3899894f },
+    { 49.361112f, 89.3900970f },
+    { 49.452582f, 89.3903988f },
+    { 49.542791f, 89.3908433f },
+    { 49.630440f, 89.3913565f },
+    { 49.709033f, 89.3919920f },
+    { 49.776373f, 89.3927599f },
+    { 49.840069f, 89.3936152f },
+    { 49.892207f, 89.3944994f },
+    { 49.925563f, 89.3954327f },
+    { 49.948179f, 89.3964506f },
+    { 49.959333f, 89.3974486f },
+    { 49.951763f, 89.3983785f },
+    { 49.926486f, 89.3993040f },
+    { 49.887759f, 89.4001774f },
+    // 2033
+    { 49.838100f, 89.4009040f },
+    { 49.772775f, 89.4014835f },
+    { 49.693806f, 89.4019426f },
+    { 49.613620f, 89.4022488f },
+    { 49.530511f, 89.4023256f },
+    { 49.441148f, 89.4022063f },
+    { 49.357858f, 89.4019678f },
+    { 49.284703f, 89.4015524f },
+    { 49.219371f, 89.4009348f },
+    { 49.164776f, 89.4002373f },
+    { 49.124047f, 89.3994796f },
+    { 49.103072f, 89.3986291f },
+    { 49.096457f, 89.3977366f },
+    { 49.100680f, 89.3968654f },
+    { 49.125355f, 89.3960613f },
+    { 49.166979f, 89.3952809f },
+    { 49.216416f, 89.3945523f },
+    { 49.277744f, 89.3939849f },
+    { 49.352743f, 89.3935386f },
+    { 49.435371f, 89.3931650f },
+    { 49.520944f, 89.3929477f },
+    { 49.609813f, 89.3929069f },
+    { 49.705529f, 89.3929897f },
+    { 49.800242f, 89.3931786f },
+    { 49.887738f, 89.3935119f },
+    { 49.975769f, 89.3940167f },
+    { 50.061697f, 89.3946067f },
+    { 50.135666f, 89.3952620f },
+    { 50.200542f, 89.3960675f },
+    { 50.257989f, 89.3969684f },
+    { 50.304172f, 89.3978747f },
+    { 50.334573f, 89.3988361f },
+    { 50.347971f, 89.3998510f },
+    { 50.350807f, 89.4008549f },
+    { 50.338158f, 89.4017950f },
+    { 50.303825f, 89.4026676f },
+    { 50.257056f, 89.4035009f },
+    // 2034
+    { 50.200987f, 89.4041966f },
+    { 50.129876f, 89.4046976f },
+    { 50.047942f, 89.4050811f },
+    { 49.962966f, 89.4053154f },
+    { 49.878137f, 89.4053190f },
+    { 49.792238f, 89.4051361f },
+    { 49.707943f, 89.4048095f },
+    { 49.636741f, 89.4043392f },
+    { 49.578140f, 89.4036996f },
+    { 49.526934f, 89.4029323f },
+    { 49.491890f, 89.4021458f },
+    { 49.477542f, 89.4013081f },
+    { 49.476955f, 89.4003984f },
+    { 49.489679f, 89.3995420f },
+    { 49.519316f, 89.3987694f },
+    { 49.565872f, 89.3980288f },
+    { 49.623384f, 89.3973655f },
+    { 49.687627f, 89.3968361f },
+    { 49.764647f, 89.3964529f },
+    { 49.851630f, 89.3961706f },
+    { 49.938528f, 89.3959946f },
+    { 50.028192f, 89.3960124f },
+    { 50.123829f, 89.3961769f },
+    { 50.218002f, 89.3964179f },
+    { 50.306527f, 89.3968117f },
+    { 50.390897f, 89.3973693f },
+    { 50.473035f, 89.3980158f },
+    { 50.546524f, 89.3987424f },
+    { 50.605237f, 89.3995663f },
+    { 50.655823f, 89.4005017f },
+    { 50.697672f, 89.4014667f },
+    { 50.720740f, 89.4024176f },
+    { 50.726815f, 89.4034294f },
+    { 50.722171f, 89.4044452f },
+    { 50.701626f, 89.4053566f },
+    { 50.661995f, 89.4061991f },
+    // 2035
+    { 50.607611f, 89.4069860f },
+    { 50.543861f, 89.4076301f },
+    { 50.470089f, 89.4080895f },
+    { 50.383715f, 89.4083841f },
+    { 50.294574f, 89.4085388f },
+    { 50.209783f, 89.4084945f },
+    { 50.124671f, 89.4082198f },
+    { 50.043160f, 89.4078177f },
+    { 49.975047f, 89.4073014f },
+    { 49.921014f, 89.4066110f },
+    { 49.878325f, 89.4058217f },
+    { 49.848681f, 89.4050075f },
+    { 49.839234f, 89.4041683f },
+    { 49.847827f, 89.4033019f },
+    { 49.866631f, 89.4024464f },
+    { 49.900321f, 89.4017003f },
+    { 49.953271f, 89.4010345f },
+    { 50.015866f, 89.4004066f },
+    { 50.084296f, 89.3999223f },
+    { 50.164845f, 89.3996124f },
+    { 50.253788f, 89.3993945f },
+    { 50.344561f, 89.3992902f },
+    { 50.435339f, 89.3993687f },
+    { 50.528980f, 89.3995987f },
+    { 50.624253f, 89.3999299f },
+    { 50.711527f, 89.4003688f },
+    { 50.792044f, 89.4009704f },
+    { 50.871225f, 89.4016928f },
+    { 50.941012f, 89.4024526f },
+    { 50.996128f, 89.4033078f },
+    { 51.040848f, 89.4042785f },
+    { 51.075583f, 89.4052646f },
+    { 51.094515f, 89.4062462f },
+    { 51.093519f, 89.4072473f },
+    { 51.078721f, 89.4082487f },
+    { 51.052319f, 89.4091712f },
+    { 51.006217f, 89.4099628f },
+    // 2036
+    { 50.942954f, 89.4106833f }
+  },
+  {  // Sigma Octantis
+    // 2024
+    { 321.901092f, -88.8603715f },
+    { 321.879974f, -88.8594500f },
+    { 321.868875f, -88.8584962f },
+    { 321.867843f, -88.8574944f },
+    { 321.873150f, -88.8563945f },
+    { 321.884046f, -88.8553316f },
+    { 321.903591f, -88.8543729f },
+    { 321.932542f, -88.8533879f },
+    { 321.964357f, -88.8524395f },
+    { 321.999048f, -88.8516568f },
+    { 322.042429f, -88.8509721f },
+    { 322.089390f, -88.8503613f },
+    { 322.134760f, -88.8498723f },
+    { 322.183005f, -88.8495657f },
+    { 322.234082f, -88.8494292f },
+    { 322.283589f, -88.8493620f },
+    { 322.328808f, -88.8494535f },
+    { 322.371723f, -88.8497735f },
+    { 322.414107f, -88.8501745f },
+    { 322.449235f, -88.8506504f },
+    { 322.475339f, -88.8512917f },
+    { 322.498551f, -88.8520392f },
+    { 322.515453f, -88.8528212f },
+    { 322.520857f, -88.8536065f },
+    { 322.518292f, -88.8544453f },
+    { 322.509626f, -88.8553151f },
+    { 322.493557f, -88.8560495f },
+    { 322.467256f, -88.8566910f },
+    { 322.433609f, -88.8573145f },
+    { 322.398852f, -88.8577660f },
+    { 322.358941f, -88.8579980f },
+    { 322.312686f, -88.8581000f },
+    { 322.269038f, -88.8580547f },
+    { 322.228833f, -88.8578074f },
+    { 322.188464f, -88.8573385f },
+    { 322.151577f, -88.8567404f },
+    { 322.122462f, -88.8560633f },
+    // 2025
+    { 322.101643f, -88.8551976f },
+    { 322.085431f, -88.8542058f },
+    { 322.075368f, -88.8532312f },
+    { 322.077478f, -88.8522086f },
+    { 322.087228f, -88.8511156f },
+    { 322.100211f, -88.8500495f },
+    { 322.122345f, -88.8490609f },
+    { 322.153255f, -88.8481413f },
+    { 322.187822f, -88.8472337f },
+    { 322.225588f, -88.8464357f },
+    { 322.267955f, -88.8458346f },
+    { 322.316092f, -88.8452997f },
+    { 322.363977f, -88.8448430f },
+    { 322.409716f, -88.8446043f },
+    { 322.459387f, -88.8445281f },
+    { 322.508967f, -88.8445345f },
+    { 322.552083f, -88.8446840f },
+    { 322.592588f, -88.8450205f },
+    { 322.631794f, -88.8455036f },
+    { 322.664777f, -88.8460436f },
+    { 322.688922f, -88.8466797f },
+    { 322.706369f, -88.8474773f },
+    { 322.719440f, -88.8482969f },
+    { 322.722770f, -88.8490774f },
+    { 322.714283f, -88.8499087f },
+    { 322.701002f, -88.8507352f },
+    { 322.681946f, -88.8514550f },
+    { 322.652192f, -88.8520494f },
+    { 322.616384f, -88.8525532f },
+    { 322.578293f, -88.8529617f },
+    { 322.537581f, -88.8531410f },
+    { 322.493037f, -88.8531128f },
+    { 322.447362f, -88.8529937f },
+    { 322.407622f, -88.8526885f },
+    { 322.371030f, -88.8521315f },
+    { 322.335163f, -88.8514577f },
+    { 322.307737f, -88.8507041f },
+    // 2026
+    { 322.290393f, -88.8498013f },
+    { 322.277916f, -88.8487819f },
+    { 322.271650f, -88.8477366f },
+    { 322.275733f, -88.8467168f },
+    { 322.289029f, -88.8456552f },
+    { 322.306941f, -88.8445706f },
+    { 322.329660f, -88.8436083f },
+    { 322.361933f, -88.8427315f },
+    { 322.399898f, -88.8418669f },
+    { 322.438020f, -88.8411160f },
+    { 322.480752f, -88.8405312f },
+    { 322.529149f, -88.8400703f },
+    { 322.577335f, -88.8396971f },
+    { 322.624030f, -88.8394691f },
+    { 322.671152f, -88.8394646f },
+    { 322.719209f, -88.8395785f },
+    { 322.762827f, -88.8397643f },
+    { 322.799453f, -88.8401523f },
+    { 322.834502f, -88.8407091f },
+    { 322.865497f, -88.8412950f },
+    { 322.885991f, -88.8419663f },
+    { 322.898772f, -88.8427636f },
+    { 322.907323f, -88.8436002f },
+    { 322.907266f, -88.8444087f },
+    { 322.896037f, -88.8451867f },
+    { 322.877471f, -88.8459831f },
+    { 322.854504f, -88.8466976f },
+    { 322.823827f, -88.8472240f },
+    { 322.784321f, -88.8476579f },
+    { 322.743119f, -88.8479904f },
+    { 322.702126f, -88.8480940f },
+    { 322.657248f, -88.8479929f },
+    { 322.612127f, -88.8477483f },
+    { 322.572811f, -88.8473593f },
+    { 322.538437f, -88.8467704f },
+    { 322.507047f, -88.8459945f },
+    // 2027
+    { 322.481325f, -88.8451695f },
+    { 322.466169f, -88.8442716f },
+    { 322.458890f, -88.8432136f },
+    { 322.455593f, -88.8421371f },
+    { 322.461182f, -88.8411199f },
+    { 322.477639f, -88.8400634f },
+    { 322.498909f, -88.8390095f },
+    { 322.523899f, -88.8380444f },
+    { 322.557190f, -88.8371909f },
+    { 322.596944f, -88.8364130f },
+    { 322.638033f, -88.8356888f },
+    { 322.680524f, -88.8351445f },
+    { 322.727899f, -88.8347770f },
+    { 322.777354f, -88.8344662f },
+    { 322.823148f, -88.8343024f },
+    { 322.867804f, -88.8343534f },
+    { 322.914012f, -88.8345261f },
+    { 322.955924f, -88.8348039f },
+    { 322.990609f, -88.8352165f },
+    { 323.021777f, -88.8357980f },
+    { 323.049073f, -88.8364832f },
+    { 323.067770f, -88.8371721f },
+    { 323.076385f, -88.8379617f },
+    { 323.079149f, -88.8388470f },
+    { 323.075925f, -88.8396505f },
+    { 323.061409f, -88.8404028f },
+    { 323.037781f, -88.8411602f },
+    { 323.010896f, -88.8418146f },
+    { 322.978141f, -88.8423118f },
+    { 322.937240f, -88.8426519f },
+    { 322.893822f, -88.8428785f },
+    { 322.851533f, -88.8429482f },
+    { 322.808523f, -88.8427559f },
+    { 322.764286f, -88.8424091f },
+    { 322.724784f, -88.8419661f },
+    { 322.693136f, -88.8413047f },
+    { 322.665093f, -88.8404786f },
+    // 2028
+    { 322.641594f, -88.8395916f },
+    { 322.629070f, -88.8386302f },
+    { 322.625425f, -88.8375949f },
+    { 322.626491f, -88.8364916f },
+    { 322.635025f, -88.8354321f },
+    { 322.653145f, -88.8344445f },
+    { 322.678284f, -88.8334163f },
+    { 322.706273f, -88.8324565f },
+    { 322.739387f, -88.8316671f },
+    { 322.780428f, -88.8309357f },
+    { 322.823528f, -88.8302749f },
+    { 322.866001f, -88.8297785f },
+    { 322.912631f, -88.8294466f },
+    { 322.961817f, -88.8292444f },
+    { 323.008001f, -88.8291387f },
+    { 323.051268f, -88.8292205f },
+    { 323.094199f, -88.8295038f },
+    { 323.134816f, -88.8298471f },
+    { 323.167639f, -88.8303026f },
+    { 323.193855f, -88.8309478f },
+    { 323.217280f, -88.8316580f },
+    { 323.233075f, -88.8324006f },
+    { 323.237505f, -88.8331995f },
+    { 323.235839f, -88.8340416f },
+    { 323.228282f, -88.8348866f },
+    { 323.211069f, -88.8356165f },
+    { 323.184750f, -88.8362880f },
+    { 323.152979f, -88.8369327f },
+    { 323.118192f, -88.8373781f },
+    { 323.076876f, -88.8376306f },
+    { 323.030833f, -88.8377847f },
+    { 322.987523f, -88.8377601f },
+    { 322.945811f, -88.8375077f },
+    { 322.903205f, -88.8370739f },
+    { 322.865273f, -88.8365171f },
+    { 322.835466f, -88.8358356f },
+    // 2029
+    { 322.811551f, -88.8349628f },
+    { 322.792210f, -88.8339992f },
+    { 322.781159f, -88.8330438f },
+    { 322.780946f, -88.8319963f },
+    { 322.786621f, -88.8308888f },
+    { 322.796831f, -88.8298465f },
+    { 322.817054f, -88.8288462f },
+    { 322.845068f, -88.8278805f },
+    { 322.875427f, -88.8269630f },
+    { 322.910605f, -88.8261643f },
+    { 322.951765f, -88.8255291f },
+    { 322.996430f, -88.8249459f },
+    { 323.040842f, -88.8244764f },
+    { 323.085508f, -88.8242332f },
+    { 323.133750f, -88.8241114f },
+    { 323.180200f, -88.8240760f },
+    { 323.221248f, -88.8242252f },
+    { 323.261357f, -88.8245499f },
+    { 323.299594f, -88.8249833f },
+    { 323.330389f, -88.8254996f },
+    { 323.353780f, -88.8261467f },
+    { 323.372345f, -88.8269311f },
+    { 323.384903f, -88.8277170f },
+    { 323.386986f, -88.8285036f },
+    { 323.379583f, -88.8293675f },
+    { 323.367515f, -88.8301921f },
+    { 323.347841f, -88.8309021f },
+    { 323.317599f, -88.8315391f },
+    { 323.282722f, -88.8320838f },
+    { 323.245506f, -88.8324923f },
+    { 323.203339f, -88.8326892f },
+    { 323.157886f, -88.8327135f },
+    { 323.113215f, -88.8326319f },
+    { 323.072577f, -88.8323276f },
+    { 323.033411f, -88.8317990f },
+    { 322.996448f, -88.8311797f },
+    { 322.968534f, -88.8304434f },
+    // 2030
+    { 322.948506f, -88.8295349f },
+    { 322.932666f, -88.8285401f },
+    { 322.924701f, -88.8275288f },
+    { 322.927226f, -88.8264978f },
+    { 322.936899f, -88.8254153f },
+    { 322.951362f, -88.8243488f },
+    { 322.972754f, -88.8233979f },
+    { 323.002870f, -88.8224878f },
+    { 323.036857f, -88.8216026f },
+    { 323.072364f, -88.8208682f },
+    { 323.113799f, -88.8202753f },
+    { 323.159635f, -88.8197671f },
+    { 323.204300f, -88.8193803f },
+    { 323.249049f, -88.8191620f },
+    { 323.295717f, -88.8191266f },
+    { 323.341415f, -88.8191955f },
+    { 323.382483f, -88.8193798f },
+    { 323.419175f, -88.8197758f },
+    { 323.454313f, -88.8202985f },
+    { 323.483515f, -88.8208636f },
+    { 323.503106f, -88.8215548f },
+    { 323.517147f, -88.8223642f },
+    { 323.525918f, -88.8231830f },
+    { 323.524700f, -88.8239922f },
+    { 323.513849f, -88.8248123f },
+    { 323.497071f, -88.8256296f },
+    { 323.474293f, -88.8263369f },
+    { 323.442788f, -88.8268985f },
+    { 323.404301f, -88.8273931f },
+    { 323.364540f, -88.8277491f },
+    { 323.322575f, -88.8278670f },
+    { 323.276492f, -88.8278219f },
+    { 323.231806f, -88.8276394f },
+    { 323.192312f, -88.8272614f },
+    { 323.155596f, -88.8266890f },
+    { 323.122161f, -88.8259720f },
+    // 2031
+    { 323.096359f, -88.8251808f },
+    { 323.079611f, -88.8242743f },
+    { 323.068893f, -88.8232367f },
+    { 323.063765f, -88.8222053f },
+    { 323.068663f, -88.8211937f },
+    { 323.082209f, -88.8201250f },
+    { 323.099792f, -88.8190844f },
+    { 323.123285f, -88.8181464f },
+    { 323.155101f, -88.8172804f },
+    { 323.191472f, -88.8164716f },
+    { 323.229526f, -88.8157617f },
+    { 323.271056f, -88.8152289f },
+    { 323.317139f, -88.8148237f },
+    { 323.363485f, -88.8144933f },
+    { 323.407356f, -88.8143475f },
+    { 323.452165f, -88.8143966f },
+    { 323.496997f, -88.8145342f },
+    { 323.536540f, -88.8148026f },
+    { 323.570815f, -88.8152442f },
+    { 323.602767f, -88.8158135f },
+    { 323.629286f, -88.8164675f },
+    { 323.646706f, -88.8171784f },
+    { 323.656661f, -88.8179998f },
+    { 323.661041f, -88.8188755f },
+    { 323.657226f, -88.8196843f },
+    { 323.642725f, -88.8204848f },
+    { 323.621387f, -88.8212839f },
+    { 323.595503f, -88.8219524f },
+    { 323.561878f, -88.8224753f },
+    { 323.521514f, -88.8228843f },
+    { 323.479768f, -88.8231587f },
+    { 323.437444f, -88.8232369f },
+    { 323.393038f, -88.8230936f },
+    { 323.348983f, -88.8228197f },
+    { 323.310415f, -88.8224045f },
+    { 323.277105f, -88.8217610f },
+    { 323.246784f, -88.8209864f },
+    // 2032
+    { 323.223240f, -88.8201580f },
+    { 323.209844f, -88.8192068f },
+    { 323.203238f, -88.8181730f },
+    { 323.201833f, -88.8171214f },
+    { 323.209780f, -88.8160886f },
+    { 323.226375f, -88.8150796f },
+    { 323.247957f, -88.8140595f },
+    { 323.274157f, -88.8131359f },
+    { 323.307033f, -88.8123459f },
+    { 323.345764f, -88.8115930f },
+    { 323.385696f, -88.8109405f },
+    { 323.427381f, -88.8104697f },
+    { 323.473565f, -88.8101260f },
+    { 323.520370f, -88.8098918f },
+    { 323.564468f, -88.8098027f },
+    { 323.607969f, -88.8099028f },
+    { 323.651084f, -88.8101543f },
+    { 323.689978f, -88.8104852f },
+    { 323.722224f, -88.8109715f },
+    { 323.750290f, -88.8116291f },
+    { 323.774069f, -88.8123254f },
+    { 323.788828f, -88.8130765f },
+    { 323.794391f, -88.8139273f },
+    { 323.794803f, -88.8147898f },
+    { 323.787734f, -88.8156255f },
+    { 323.770154f, -88.8164026f },
+    { 323.745776f, -88.8171352f },
+    { 323.716451f, -88.8177971f },
+    { 323.681431f, -88.8182657f },
+    { 323.640207f, -88.8185884f },
+    { 323.596394f, -88.8188065f },
+    { 323.554084f, -88.8188083f },
+    { 323.511084f, -88.8185933f },
+    { 323.468218f, -88.8182370f },
+    { 323.431420f, -88.8177329f },
+    { 323.400984f, -88.8170595f },
+    // 2033
+    { 323.374727f, -88.8162282f },
+    { 323.354870f, -88.8153304f },
+    { 323.344274f, -88.8143942f },
+    { 323.342056f, -88.8133496f },
+    { 323.345103f, -88.8122810f },
+    { 323.355091f, -88.8112839f },
+    { 323.374702f, -88.8102867f },
+    { 323.399899f, -88.8093091f },
+    { 323.428022f, -88.8084301f },
+    { 323.462948f, -88.8076561f },
+    { 323.503340f, -88.8069904f },
+    { 323.545075f, -88.8064028f },
+    { 323.588358f, -88.8059656f },
+    { 323.633902f, -88.8057218f },
+    { 323.681091f, -88.8055695f },
+    { 323.725652f, -88.8055434f },
+    { 323.767099f, -88.8057245f },
+    { 323.808479f, -88.8060417f },
+    { 323.845973f, -88.8064536f },
+    { 323.875916f, -88.8069966f },
+    { 323.901145f, -88.8076771f },
+    { 323.921548f, -88.8084496f },
+    { 323.933701f, -88.8092360f },
+    { 323.936612f, -88.8100732f },
+    { 323.932259f, -88.8109743f },
+    { 323.921936f, -88.8118047f },
+    { 323.902277f, -88.8125471f },
+    { 323.873722f, -88.8132566f },
+    { 323.841723f, -88.8138500f },
+    { 323.805447f, -88.8142702f },
+    { 323.762884f, -88.8145260f },
+    { 323.719075f, -88.8146321f },
+    { 323.676724f, -88.8145809f },
+    { 323.635401f, -88.8142991f },
+    { 323.595609f, -88.8138429f },
+    { 323.560180f, -88.8132908f },
+    { 323.532827f, -88.8125704f },
+    // 2034
+    { 323.511015f, -88.8116916f },
+    { 323.494040f, -88.8107636f },
+    { 323.486890f, -88.8097926f },
+    { 323.488620f, -88.8087592f },
+    { 323.495478f, -88.8076979f },
+    { 323.509317f, -88.8066817f },
+    { 323.531275f, -88.8057404f },
+    { 323.559655f, -88.8048109f },
+    { 323.591539f, -88.8039497f },
+    { 323.627091f, -88.8032501f },
+    { 323.668948f, -88.8026471f },
+    { 323.713021f, -88.8021201f },
+    { 323.756129f, -88.8017587f },
+    { 323.801830f, -88.8015655f },
+    { 323.849065f, -88.8014992f },
+    { 323.893088f, -88.8015548f },
+    { 323.934179f, -88.8017751f },
+    { 323.973255f, -88.8021780f },
+    { 324.008969f, -88.8026705f },
+    { 324.037790f, -88.8032521f },
+    { 324.059122f, -88.8039894f },
+    { 324.076116f, -88.8048038f },
+    { 324.085792f, -88.8056192f },
+    { 324.084778f, -88.8064700f },
+    { 324.076938f, -88.8073444f },
+    { 324.063202f, -88.8081750f },
+    { 324.040777f, -88.8088956f },
+    { 324.010690f, -88.8095251f },
+    { 323.975594f, -88.8100807f },
+    { 323.937981f, -88.8104515f },
+    { 323.896294f, -88.8106147f },
+    { 323.851319f, -88.8106519f },
+    { 323.809425f, -88.8105247f },
+    { 323.770592f, -88.8101663f },
+    { 323.732634f, -88.8096437f },
+    { 323.700070f, -88.8090073f },
+    // 2035
+    { 323.675908f, -88.8082421f },
+    { 323.657915f, -88.8073387f },
+    { 323.645755f, -88.8063564f },
+    { 323.641585f, -88.8053778f },
+    { 323.646891f, -88.8043614f },
+    { 323.658617f, -88.8033002f },
+    { 323.674853f, -88.8023065f },
+    { 323.699345f, -88.8013921f },
+    { 323.730923f, -88.8005085f },
+    { 323.764850f, -88.7996987f },
+    { 323.802675f, -88.7990243f },
+    { 323.845568f, -88.7984923f },
+    { 323.890858f, -88.7980490f },
+    { 323.936076f, -88.7977285f },
+    { 323.980903f, -88.7976128f },
+    { 324.027521f, -88.7976414f },
+    { 324.072206f, -88.7977586f },
+    { 324.111254f, -88.7980484f },
+    { 324.147997f, -88.7985180f },
+    { 324.182078f, -88.7990685f },
+    { 324.208348f, -88.7997090f },
+    { 324.226982f, -88.8004662f },
+    { 324.240553f, -88.8013103f },
+    { 324.247006f, -88.8021664f },
+    { 324.243867f, -88.8030011f },
+    { 324.231998f, -88.8038637f },
+    { 324.214616f, -88.8046865f },
+    { 324.190589f, -88.8053654f },
+    { 324.157595f, -88.8059417f },
+    { 324.120357f, -88.8064231f },
+    { 324.081894f, -88.8067263f },
+    { 324.039872f, -88.8068223f },
+    { 323.996186f, -88.8067514f },
+    { 323.954948f, -88.8065440f },
+    { 323.917971f, -88.8061387f },
+    { 323.884222f, -88.8055296f },
+    { 323.854035f, -88.8048274f },
+    // 2036
+    { 323.832522f, -88.8040387f }
+  }
+};
+
+// Refraction (arcminutes) for true altitudes -1 to 90 deg, 10 degC / 1010 hPa
+#define REFRACTION_TABLE_MIN_ALT  -1.0f
+#define REFRACTION_TABLE_STEP     0.5f
+#define REFRACTION_TABLE_ENTRIES  183
+
+static const float REFRACTION_TABLE[REFRACTION_TABLE_ENTRIES] = {
+  38.7968f, 33.6897f, 28.9839f, 25.0058f, 21.7458f, 19.0933f, 16.9276f, 15.1450f,
+  13.6630f, 12.4183f, 11.3622f, 10.4577f, 9.6761f, 8.9951f, 8.3975f, 7.8693f,
+  7.3996f, 6.9794f, 6.6017f, 6.2603f, 5.9504f, 5.6680f, 5.4096f, 5.1723f,
+  4.9537f, 4.7517f, 4.5644f, 4.3904f, 4.2282f, 4.0767f, 3.9349f, 3.8019f,
+  3.6769f, 3.5591f, 3.4481f, 3.3431f, 3.2437f, 3.1495f, 3.0600f, 2.9750f,
+  2.8940f, 2.8168f, 2.7431f, 2.6727f, 2.6054f, 2.5409f, 2.4791f, 2.4198f,
+  2.3628f, 2.3080f, 2.2553f, 2.2046f, 2.1557f, 2.1085f, 2.0629f, 2.0189f,
+  1.9764f, 1.9352f, 1.8954f, 1.8568f, 1.8194f, 1.7831f, 1.7479f, 1.7137f,
+  1.6805f, 1.6482f, 1.6168f, 1.5862f, 1.5565f, 1.5275f, 1.4992f, 1.4717f,
+  1.4448f, 1.4186f, 1.3930f, 1.3680f, 1.3436f, 1.3197f, 1.2963f, 1.2734f,
+  1.2511f, 1.2292f, 1.2077f, 1.1867f, 1.1661f, 1.1459f, 1.1261f, 1.1067f,
+  1.0876f, 1.0689f, 1.0505f, 1.0324f, 1.0146f, 0.9972f, 0.9800f, 0.9631f,
+  0.9465f, 0.9302f, 0.9141f, 0.8983f, 0.8827f, 0.8673f, 0.8522f, 0.8372f,
+  0.8225f, 0.8080f, 0.7937f, 0.7796f, 0.7656f, 0.7519f, 0.7383f, 0.7249f,
+  0.7116f, 0.6985f, 0.6856f, 0.6728f, 0.6601f, 0.6476f, 0.6353f, 0.6230f,
+  0.6109f, 0.5989f, 0.5871f, 0.5753f, 0.5637f, 0.5522f, 0.5408f, 0.5295f,
+  0.5183f, 0.5071f, 0.4961f, 0.4852f, 0.4744f, 0.4636f, 0.4530f, 0.4424f,
+  0.4319f, 0.4215f, 0.4111f, 0.4008f, 0.3906f, 0.3805f, 0.3704f, 0.3604f,
+  0.3504f, 0.3406f, 0.3307f, 0.3209f, 0.3112f, 0.3015f, 0.2919f, 0.2823f,
+  0.2728f, 0.2633f, 0.2538f, 0.2444f, 0.2351f, 0.2257f, 0.2164f, 0.2072f,
+  0.1979f, 0.1887f, 0.1796f, 0.1704f, 0.1613f, 0.1522f, 0.1431f, 0.1341f,
+  0.1251f, 0.1160f, 0.1071f, 0.0981f, 0.0891f, 0.0802f, 0.0712f, 0.0623f,
+  0.0534f, 0.0445f, 0.0356f, 0.0267f, 0.0178f, 0.0089f, 0.0000f
+};
+
+#endif // POLE_STAR_DATA_H
@@ -0,0 +1,88 @@
+/*
+ * pole_star_table.cpp
+ * 
+ * Interpolation of the precomputed pole star and refraction tables
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "pole_star_table.h"
+#include "hal.h"
+#include <math.h>
+#include "pole_star_data.h"
+
+// 範囲外の外挿に使う2点の間隔（37 x 10日 = 370日、ほぼ1年）
+#define POLE_STAR_EXTRAPOLATION_SPAN 37
+
+PoleStar poleStarForLatitude(float latitude) {
+  // 緯度が0付近（未設定）の場合は北半球として扱う（calculatePolarisPosition()と同じ）
+  return latitude <= -0.1f ? POLE_STAR_SIGMA_OCTANTIS : POLE_STAR_POLARIS;
+}
+
+// Copy one table entry
+static void readPlace(PoleStar star, int index, double *ra, double *dec) {
+  *ra = POLE_STAR_PLACES[star][index][0];
+  *dec = POLE_STAR_PLACES[star][index][1];
+}
+
+void getPoleStarPlace(PoleStar star, double jd, double *ra, double *dec) {
+  double position = (jd - POLE_STAR_TABLE_START_JD) / POLE_STAR_TABLE_STEP_DAYS;
+  
+  // Interpolate between entries a and b (extrapolate outside the table)
+  int a, b;
+  if (position < 0.0) {
+    a = 0;
+    b = POLE_STAR_EXTRAPOLATION_SPAN;
+  } else if (position >= POLE_STAR_TABLE_ENTRIES - 1) {
+    a = POLE_STAR_TABLE_ENTRIES - 1 - POLE_STAR_EXTRAPOLATION_SPAN;
+    b = POLE_STAR_TABLE_ENTRIES - 1;
+  } else {
+    a = (int)position;
+    b = a + 1;
+  }
+  double t = (position - a) / (b - a);
+  
+  double raA, decA, raB, decB;
+  readPlace(star, a, &raA, &decA);
+  readPlace(star, b, &raB, &decB);
+  
+  // 赤経が0/360度をまたぐ場合は連続になるよう補正する
+  double raDelta = raB - raA;
+  if (raDelta > 180.0) raDelta -= 360.0;
+  if (raDelta < -180.0) raDelta += 360.0;
+  
+  double value = fmod(raA + raDelta * t, 360.0);
+  if (value < 0) value += 360.0;
+  *ra = value;
+  *dec = decA + (decB - decA) * t;
+}
+
+float getRefraction(float trueAltitude, float temperatureC, float pressureHpa) {
+  // 表の範囲外: 地平線下は表の端の値、天頂付近は0
+  float position = (trueAltitude - REFRACTION_TABLE_MIN_ALT) / REFRACTION_TABLE_STEP;
+  if (position < 0.0f) {
+    position = 0.0f;
+  }
+  if (position >= REFRACTION_TABLE_ENTRIES - 1) {
+    return 0.0f;
+  }
+  
+  int index = (int)position;
+  float t = position - index;
+  float r0 = REFRACTION_TABLE[index];
+  float r1 = REFRACTION_TABLE[index + 1];
+  float arcmin = r0 + (r1 - r0) * t;
+  
+  // 気温と気圧による補正（大気の密度に比例）
+  float scale = (pressureHpa / REFRACTION_STANDARD_PRESSURE_HPA) *
+                ((273.0f + REFRACTION_STANDARD_TEMPERATURE_C) / (273.0f + temperatureC));
+  return arcmin * scale / 60.0f;
+}
+
+float pressureFromAltitude(float altitudeM) {
+  // 国際標準大気（対流圏）
+  if (altitudeM < -500.0f) altitudeM = -500.0f;
+  if (altitudeM > 11000.0f) altitudeM = 11000.0f;
+  return 1013.25f * powf(1.0f - 2.25577e-5f * altitudeM, 5.25588f);
+}
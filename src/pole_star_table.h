@@ -0,0 +1,44 @@
+/*
+ * pole_star_table.h
+ * 
+ * Precomputed apparent places of the pole stars and atmospheric refraction
+ * The tables are generated offline by tools/gen_pole_star_table.py
+ * (precession, nutation and aberration) and only interpolated at runtime
+ * 
+ * 表の範囲内では天球上で0.3秒角以内の精度。範囲外は約1年離れた
+ * 2点から外挿する（年周光行差の成分が相殺され、数年で数秒角程度の誤差）。
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#ifndef POLE_STAR_TABLE_H
+#define POLE_STAR_TABLE_H
+
+// Pole stars
+enum PoleStar {
+  POLE_STAR_POLARIS,         // 北半球: 北極星
+  POLE_STAR_SIGMA_OCTANTIS   // 南半球: はちぶんぎ座σ星
+};
+
+// Standard conditions of the refraction table
+#define REFRACTION_STANDARD_TEMPERATURE_C 10.0f
+#define REFRACTION_STANDARD_PRESSURE_HPA  1010.0f
+
+// Pole star used for a latitude (the south only below the equator)
+PoleStar poleStarForLatitude(float latitude);
+
+// Apparent place at a Julian date (degrees)
+// 赤経はグリニッジ平均恒星時の基準（時角 = GMST + 経度 - 赤経）
+void getPoleStarPlace(PoleStar star, double jd, double *ra, double *dec);
+
+// Refraction for a true (geometric) altitude in degrees
+// Returns the amount to add to the altitude (degrees)
+float getRefraction(float trueAltitude,
+                    float temperatureC = REFRACTION_STANDARD_TEMPERATURE_C,
+                    float pressureHpa = REFRACTION_STANDARD_PRESSURE_HPA);
+
+// Standard-atmosphere pressure at an altitude above sea level (hPa)
+float pressureFromAltitude(float altitudeM);
+
+#endif // POLE_STAR_TABLE_H
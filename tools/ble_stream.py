@@ -0,0 +1,227 @@
+#!/usr/bin/env python3
+"""
+ble_stream.py
+
+Receives the BLE orientation stream of src/BleStreamer.cpp (Bluetooth
+setting enabled) and writes it to a CSV file for the capture software:
+
+  time_s, qw, qx, qy, qz, az_error, alt_error (arcmin), confidence,
+  predicted, stationary, target_valid, flags
+
+The time column is unwrapped from the 16-bit millisecond stamps, and
+counted from the first frame. Gaps in the frame sequence (frames dropped on
+the device while the link was congested) are counted and reported. The
+status characteristic (position, pole target, link MTU) is printed once
+per second.
+
+Needs the bleak package for the connection (pip install bleak).
+
+  python3 tools/ble_stream.py -o mount.csv [--address AA:BB:CC:DD:EE:FF]
+  python3 tools/ble_stream.py --self-test
+
+Created: 2025-04-12
+GitHub: https://github.com/kennel-org/polaris-navigator
+"""
+
+import asyncio
+import struct
+import sys
+
+# Format (must match src/BleStreamer.h)
+DEVICE_NAME = "Polaris-Nav"
+STREAM_CHAR_UUID = "7a0b1001-5c3e-4b8e-9d2a-6f1c0e9a4b01"
+STATUS_CHAR_UUID = "7a0b1002-5c3e-4b8e-9d2a-6f1c0e9a4b01"
+STREAM_VERSION = 1
+
+HEADER = struct.Struct("<BBH")
+FRAME = struct.Struct("<H4hhhBB")
+STATUS = struct.Struct("<iiiIHHhhHHBBBBII")
+
+FLAG_ATTITUDE_VALID = 0x01
+FLAG_STATIONARY = 0x08
+FLAG_PREDICTED = 0x10
+FLAG_TARGET_VALID = 0x40
+
+CSV_HEADER = ("time_s,qw,qx,qy,qz,az_error,alt_error,confidence,"
+              "predicted,stationary,target_valid,flags")
+
+
+class StreamDecoder:
+    """Turns notifications into rows, unwrapping time and tracking sequence gaps"""
+
+    def __init__(self):
+        self.rows = []
+        self.frames = 0
+        self.notifications = 0
+        self.lost = 0
+        self._next_sequence = None
+        self._last_ms = None
+        self._time_ms = 0
+
+    def feed(self, data):
+        version, count, sequence = HEADER.unpack_from(data, 0)
+        if version != STREAM_VERSION:
+            raise ValueError("unsupported stream version %d" % version)
+        if len(data) < HEADER.size + count * FRAME.size:
+            raise ValueError("short notification (%d bytes for %d frames)" % (len(data), count))
+
+        if self._next_sequence is not None:
+            self.lost += (sequence - self._next_sequence) & 0xFFFF
+        self._next_sequence = (sequence + count) & 0xFFFF
+        self.notifications += 1
+
+        for i in range(count):
+            fields = FRAME.unpack_from(data, HEADER.size + i * FRAME.size)
+            stamp, qw, qx, qy, qz, az, alt, confidence, flags = fields
+            # 16ビットのミリ秒は約65秒で一周する
+            if self._last_ms is not None:
+                self._time_ms += (stamp - self._last_ms) & 0xFFFF
+            self._last_ms = stamp
+            self.rows.append((self._time_ms * 0.001,
+                              qw / 16384.0, qx / 16384.0, qy / 16384.0, qz / 16384.0,
+                              az * 0.1, alt * 0.1, confidence / 255.0,
+                              int(bool(flags & FLAG_PREDICTED)),
+                              int(bool(flags & FLAG_STATIONARY)),
+                              int(bool(flags & FLAG_TARGET_VALID)), flags))
+            self.frames += 1
+        return count
+
+
+def decode_status(data):
+    (lat, lon, alt, utc, hdop, pole_az, pole_alt, declination, frame_rate, imu_rate,
+     sats, flags, version, mtu, sent, dropped) = STATUS.unpack_from(data, 0)
+    return {
+        "lat": lat * 1e-7, "lon": lon * 1e-7, "alt_m": alt * 0.01, "utc": utc,
+        "hdop": hdop * 0.01, "pole_az": pole_az * 0.01, "pole_alt": pole_alt * 0.01,
+        "declination": declination * 0.01, "frame_rate_hz": frame_rate,
+        "imu_rate_hz": imu_rate, "sats": sats, "gps_fix": bool(flags & 0x01),
+        "time_synced": bool(flags & 0x02), "true_north": bool(flags & 0x04),
+        "fine_alignment": bool(flags & 0x08), "version": version, "mtu": mtu,
+        "frames_sent": sent, "frames_dropped": dropped,
+    }
+
+
+def format_row(row):
+    return ("%.3f,%.5f,%.5f,%.5f,%.5f,%.1f,%.1f,%.3f,%d,%d,%d,%d" % row)
+
+
+async def capture(address, path):
+    from bleak import BleakClient, BleakScanner
+
+    if address is None:
+        device = await BleakScanner.find_device_by_name(DEVICE_NAME, timeout=10.0)
+        if device is None:
+            sys.stderr.write("%s not found\n" % DEVICE_NAME)
+            return 1
+        address = device.address
+
+    decoder = StreamDecoder()
+    with open(path, "w") as out:
+        out.write(CSV_HEADER + "\n")
+
+        def on_stream(_, data):
+            first = len(decoder.rows)
+            decoder.feed(bytes(data))
+            for row in decoder.rows[first:]:
+                out.write(format_row(row) + "\n")
+            del decoder.rows[:]
+
+        def on_status(_, data):
+            s = decode_status(bytes(data))
+            print("pole az %.2f alt %.2f, %d sats, MTU %d, %d frames (%d lost on the link, "
+                  "%d dropped on the device)" % (s["pole_az"], s["pole_alt"], s["sats"], s["mtu"],
+                                                 decoder.frames, decoder.lost,
+                                                 s["frames_dropped"]))
+
+        async with BleakClient(address) as client:
+            print("connected to %s, writing %s (Ctrl-C to stop)" % (address, path))
+            await client.start_notify(STREAM_CHAR_UUID, on_stream)
+            await client.start_notify(STATUS_CHAR_UUID, on_status)
+            try:
+                while client.is_connected:
+                    await asyncio.sleep(1.0)
+            except asyncio.CancelledError:
+                pass
+
+    print("%d frames in %d notifications, %d lost" %
+          (decoder.frames, decoder.notifications, decoder.lost))
+    return 0
+
+
+def self_test():
+    # 50Hz、1通知に2フレーム、時刻は65.5秒で一周させる
+    notifications = []
+    sequence = 0xFFF0
+    stamp = 65000
+    for n in range(40):
+        count = 2
+        data = bytearray(HEADER.pack(STREAM_VERSION, count, sequence & 0xFFFF))
+        for i in range(count):
+            k = n * count + i
+            data += FRAME.pack(stamp & 0xFFFF, 16384, 0, -8192, 0, -150 + k, 42, 255,
+                               FLAG_ATTITUDE_VALID | FLAG_TARGET_VALID |
+                               (FLAG_PREDICTED if k % 2 else 0))
+            stamp += 20
+        notifications.append(bytes(data))
+        sequence += count
+        if n == 20:
+            sequence += 3      # 端末側で3フレーム捨てた
+            stamp += 60
+
+    decoder = StreamDecoder()
+    for data in notifications:
+        decoder.feed(data)
+    assert decoder.frames == 80 and decoder.notifications == 40
+    assert decoder.lost == 3, decoder.lost
+    times = [row[0] for row in decoder.rows]
+    assert all(b > a for a, b in zip(times, times[1:])), "time must be unwrapped"
+    assert abs(times[-1] - (79 * 0.020 + 0.060)) < 1e-9, times[-1]
+    first = decoder.rows[0]
+    assert abs(first[1] - 1.0) < 1e-9 and abs(first[3] + 0.5) < 1e-9
+    assert abs(first[5] + 15.0) < 1e-9 and abs(first[6] - 4.2) < 1e-9
+    assert first[8] == 0 and decoder.rows[1][8] == 1 and first[10] == 1
+    assert format_row(first).startswith("0.000,1.00000,")
+
+    status = STATUS.pack(356812345, 1397654321, 4210, 1735689600, 85, 35, 3560, -780,
+                         50, 400, 9, 0x0F, STREAM_VERSION, 247, 1200, 4)
+    s = decode_status(status)
+    assert abs(s["lat"] - 35.6812345) < 1e-6 and abs(s["declination"] + 7.8) < 1e-9
+    assert s["fine_alignment"] and s["mtu"] == 247 and s["frames_dropped"] == 4
+
+    try:
+        decoder.feed(bytes([STREAM_VERSION + 1, 0, 0, 0]))
+        raise AssertionError("version mismatch not detected")
+    except ValueError:
+        pass
+
+    print("self-test passed: %d frames, %d bytes per frame, %d per notification at MTU 247" %
+          (decoder.frames, FRAME.size, (247 - 3 - HEADER.size) // FRAME.size))
+    return 0
+
+
+def main(argv):
+    if len(argv) > 1 and argv[1] == "--self-test":
+        return self_test()
+
+    path = "ble_stream.csv"
+    address = None
+    i = 1
+    while i < len(argv):
+        if argv[i] == "-o" and i + 1 < len(argv):
+            path = argv[i + 1]
+            i += 2
+        elif argv[i] == "--address" and i + 1 < len(argv):
+            address = argv[i + 1]
+            i += 2
+        else:
+            sys.stderr.write(__doc__)
+            return 1
+
+    try:
+        return asyncio.run(capture(address, path))
+    except KeyboardInterrupt:
+        return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
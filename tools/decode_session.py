@@ -0,0 +1,375 @@
+#!/usr/bin/env python3
+"""
+decode_session.py
+
+Decodes the binary session files written by src/SessionRecorder.cpp
+(/sessions/NNNNNN.pnr on the spiffs partition) into CSV files for analysis:
+
+  <prefix>_imu.csv        time_s, ax, ay, az (g), gx, gy, gz (dps), mx, my, mz (raw uT,
+                          empty without a reading), mag_cal (row in _magcal.csv, -1 none)
+  <prefix>_magcal.csv     time_s, valid, offset_x/y/z (uT), soft-iron matrix s00..s22
+  <prefix>_gps.csv        time_s, utc, lat, lon, alt_m, hdop, sats, live, time_synced
+  <prefix>_orient.csv     time_s, qw, qx, qy, qz, heading_raw, error, bias_x/y/z (dps),
+                          temperature, confidence, flags, mag_field
+  <prefix>_align.csv      time_s, az_error, alt_error, pole_az, pole_alt, mode, power
+
+Blocks with a bad magic or CRC are skipped (reported on stderr); decoding
+continues with the next block. Pass the files of one session in order.
+
+Copy the files off the device with any LittleFS tool (e.g. read the
+partition with esptool.py and unpack it with mklittlefs -u).
+
+  python3 tools/decode_session.py 000012.pnr 000013.pnr -o night1
+  python3 tools/decode_session.py --self-test
+
+Created: 2025-04-12
+GitHub: https://github.com/kennel-org/polaris-navigator
+"""
+
+import os
+import struct
+import sys
+import tempfile
+import zlib
+
+# Format (must match src/SessionRecorder.h)
+BLOCK_SIZE = 4096
+BLOCK_MAGIC = 0x4250
+FORMAT_VERSION = 3
+BLOCK_FILE_START = 0x01
+
+REC_PADDING = 0
+REC_INFO = 1
+REC_IMU_BATCH = 2
+REC_GPS = 3
+REC_ORIENTATION = 4
+REC_ALIGNMENT = 5
+REC_MAG_CAL = 6
+
+IMU_FLAG_MAG = 0x01
+MAG_LSB_PER_UT = 16.0
+
+BLOCK_HEADER = struct.Struct("<HBBHHII")
+INFO = struct.Struct("<IHHqqff")
+GPS = struct.Struct("<IiiiHBBI")
+ORIENTATION = struct.Struct("<I4hHH3hhBBH")
+ALIGNMENT = struct.Struct("<IhhHhBBH")
+MAG_CAL = struct.Struct("<I3f9fB3x")
+
+DISPLAY_MODES = ["polar", "gps", "imu", "celestial", "raw", "calibration", "clock"]
+POWER_STATES = ["active", "dimmed", "blanked"]
+
+
+def read_varint(data, pos):
+    value = 0
+    shift = 0
+    while True:
+        byte = data[pos]
+        pos += 1
+        value |= (byte & 0x7F) << shift
+        if byte < 0x80:
+            return value, pos
+        shift += 7
+
+
+def unzigzag(value):
+    return (value >> 1) ^ -(value & 1)
+
+
+def decode_imu_batch(payload, info, mag_cal):
+    """Returns [(time_s, ax, ay, az, gx, gy, gz, mx, my, mz, mag_cal)] for one batch."""
+    time_us, pos = read_varint(payload, 0)
+    time_us = unzigzag(time_us)
+    count = payload[pos]
+    flags = payload[pos + 1]
+    pos += 2
+
+    # 地磁気はバッチごとに1回読み出され、バッチの全サンプルで使われる
+    mag = ("", "", "")
+    if flags & IMU_FLAG_MAG:
+        raw = []
+        for _ in range(3):
+            value, pos = read_varint(payload, pos)
+            raw.append(unzigzag(value) / MAG_LSB_PER_UT)
+        mag = tuple(raw)
+
+    acc_scale = info["acc_lsb_per_g"] if info else 4096.0
+    gyro_scale = info["gyro_lsb_per_dps"] if info else 16.0
+    values = [0] * 6
+    samples = []
+    for _ in range(count):
+        dt, pos = read_varint(payload, pos)
+        time_us += dt
+        for axis in range(3):
+            delta, pos = read_varint(payload, pos)
+            values[axis] += unzigzag(delta)
+            delta, pos = read_varint(payload, pos)
+            values[axis + 3] += unzigzag(delta)
+        samples.append((time_us * 1e-6,
+                        values[0] / acc_scale, values[1] / acc_scale, values[2] / acc_scale,
+                        values[3] / gyro_scale, values[4] / gyro_scale, values[5] / gyro_scale)
+                       + mag + (mag_cal if flags & IMU_FLAG_MAG else -1,))
+    return samples
+
+
+def decode_blocks(data, stats):
+    """Yields (type, payload) for every record in the valid blocks of a file."""
+    last_sequence = None
+    for offset in range(0, len(data) - BLOCK_SIZE + 1, BLOCK_SIZE):
+        block = data[offset:offset + BLOCK_SIZE]
+        magic, flags, version, used, _, sequence, crc = BLOCK_HEADER.unpack_from(block)
+        if magic != BLOCK_MAGIC or version != FORMAT_VERSION or \
+                used < BLOCK_HEADER.size or used > BLOCK_SIZE:
+            stats["bad_blocks"] += 1
+            continue
+        if zlib.crc32(block[BLOCK_HEADER.size:used]) != crc:
+            stats["bad_blocks"] += 1
+            sys.stderr.write("block at 0x%x: CRC mismatch, skipped\n" % offset)
+            continue
+        if last_sequence is not None and sequence != last_sequence + 1 and \
+                not flags & BLOCK_FILE_START:
+            stats["gaps"] += 1
+        last_sequence = sequence
+        stats["blocks"] += 1
+
+        pos = BLOCK_HEADER.size
+        while pos < used:
+            record_type = block[pos]
+            if record_type == REC_PADDING:
+                break
+            length, pos = read_varint(block, pos + 1)
+            yield record_type, bytes(block[pos:pos + length])
+            pos += length
+
+
+def decode_files(paths):
+    """Returns a dict of record lists for the given session files."""
+    out = {"info": [], "imu": [], "magcal": [], "gps": [], "orient": [], "align": []}
+    stats = {"blocks": 0, "bad_blocks": 0, "gaps": 0}
+    info = None
+    for path in paths:
+        with open(path, "rb") as f:
+            data = f.read()
+        for record_type, payload in decode_blocks(data, stats):
+            if record_type == REC_INFO:
+                session, part, rate, start_timer, start_utc, acc, gyro = INFO.unpack(payload)
+                info = {"session": session, "part": part, "imu_rate_hz": rate,
+                        "start_timer_us": start_timer, "start_utc_us": start_utc,
+                        "acc_lsb_per_g": acc, "gyro_lsb_per_dps": gyro}
+                out["info"].append(info)
+            elif record_type == REC_IMU_BATCH:
+                out["imu"].extend(decode_imu_batch(payload, info, len(out["magcal"]) - 1))
+            elif record_type == REC_MAG_CAL:
+                v = MAG_CAL.unpack(payload)
+                out["magcal"].append((v[0] * 1e-3, v[13]) + tuple(float(x) for x in v[1:13]))
+            elif record_type == REC_GPS:
+                t, lat, lon, alt, hdop, sats, flags, utc = GPS.unpack(payload)
+                out["gps"].append((t * 1e-3, utc, lat * 1e-7, lon * 1e-7, alt * 1e-2,
+                                   hdop * 1e-2, sats, flags & 1, (flags >> 1) & 1))
+            elif record_type == REC_ORIENTATION:
+                v = ORIENTATION.unpack(payload)
+                out["orient"].append((v[0] * 1e-3,
+                                      v[1] / 16384.0, v[2] / 16384.0, v[3] / 16384.0, v[4] / 16384.0,
+                                      v[5] * 1e-2, v[6] * 1e-2,
+                                      v[7] * 1e-3, v[8] * 1e-3, v[9] * 1e-3,
+                                      v[10] * 1e-2, v[11] / 255.0, v[12], v[13] * 1e-2))
+            elif record_type == REC_ALIGNMENT:
+                t, az_err, alt_err, pole_az, pole_alt, mode, power, _ = ALIGNMENT.unpack(payload)
+                out["align"].append((t * 1e-3, az_err * 1e-2, alt_err * 1e-2,
+                                     pole_az * 1e-2, pole_alt * 1e-2,
+                                     DISPLAY_MODES[mode] if mode < len(DISPLAY_MODES) else mode,
+                                     POWER_STATES[power] if power < len(POWER_STATES) else power))
+    return out, stats
+
+
+def write_csv(path, header, rows):
+    with open(path, "w") as f:
+        f.write(header + "\n")
+        for row in rows:
+            f.write(",".join(("%.6f" % v) if isinstance(v, float) else str(v) for v in row))
+            f.write("\n")
+
+
+def write_outputs(out, prefix):
+    write_csv(prefix + "_imu.csv", "time_s,ax,ay,az,gx,gy,gz,mx,my,mz,mag_cal", out["imu"])
+    write_csv(prefix + "_magcal.csv",
+              "time_s,valid,offset_x,offset_y,offset_z,s00,s01,s02,s10,s11,s12,s20,s21,s22",
+              out["magcal"])
+    write_csv(prefix + "_gps.csv", "time_s,utc,lat,lon,alt_m,hdop,sats,live,time_synced",
+              out["gps"])
+    write_csv(prefix + "_orient.csv",
+              "time_s,qw,qx,qy,qz,heading_raw,error,bias_x,bias_y,bias_z,"
+              "temperature,confidence,flags,mag_field", out["orient"])
+    write_csv(prefix + "_align.csv", "time_s,az_error,alt_error,pole_az,pole_alt,mode,power",
+              out["align"])
+
+
+# --- Encoder mirroring SessionRecorder (used by --self-test) ---
+
+def put_varint(value):
+    out = bytearray()
+    while value >= 0x80:
+        out.append((value & 0x7F) | 0x80)
+        value >>= 7
+    out.append(value)
+    return bytes(out)
+
+
+def zigzag(value):
+    return ((value << 1) ^ (value >> 31)) & 0xFFFFFFFF
+
+
+def zigzag64(value):
+    return ((value << 1) ^ (value >> 63)) & 0xFFFFFFFFFFFFFFFF
+
+
+def encode_imu_batch(start_us, samples, mag=None):
+    """mag: raw reading in 1/MAG_LSB_PER_UT uT steps, or None."""
+    out = bytearray(put_varint(zigzag64(samples[0][0] - start_us)))
+    out.append(len(samples))
+    out.append(IMU_FLAG_MAG if mag is not None else 0)
+    if mag is not None:
+        for value in mag:
+            out += put_varint(zigzag(value))
+    previous = [0] * 6
+    previous_us = samples[0][0]
+    for t, values in samples:
+        out += put_varint(t - previous_us)
+        previous_us = t
+        for axis in range(3):
+            for index in (axis, axis + 3):
+                out += put_varint(zigzag(values[index] - previous[index]))
+                previous[index] = values[index]
+    return bytes(out)
+
+
+def encode_blocks(records, first_sequence=0):
+    """records: [(type, payload)] -> bytes of sealed blocks (first one starts a file)."""
+    blocks = []
+    block = bytearray(BLOCK_HEADER.size)
+    for record_type, payload in records:
+        record = bytes([record_type]) + put_varint(len(payload)) + payload
+        if len(block) + len(record) > BLOCK_SIZE:
+            blocks.append(block)
+            block = bytearray(BLOCK_HEADER.size)
+        block += record
+    blocks.append(block)
+
+    data = bytearray()
+    for i, block in enumerate(blocks):
+        used = len(block)
+        crc = zlib.crc32(bytes(block[BLOCK_HEADER.size:]))
+        flags = BLOCK_FILE_START if i == 0 else 0
+        BLOCK_HEADER.pack_into(block, 0, BLOCK_MAGIC, flags, FORMAT_VERSION, used, 0,
+                               first_sequence + i, crc)
+        data += block + bytes(BLOCK_SIZE - used)
+    return bytes(data)
+
+
+def self_test():
+    start_us = 5000000
+    info = INFO.pack(7, 0, 200, start_us, 1735689600000000, 4096.0, 16.0)
+    records = [(REC_INFO, info),
+               (REC_MAG_CAL, MAG_CAL.pack(0, 12.5, -3.0, 40.0, 1.0, 0, 0, 0, 1.0, 0, 0, 0, 1.0, 1))]
+
+    # 200 Hz samples with a slow drift, batched like the FIFO (8 per batch)
+    # 最初のバッチはstart()より前に取り込まれたサンプルから始まる
+    expected = []
+    t = start_us - 20000
+    for batch in range(200):
+        samples = []
+        for i in range(8):
+            t += 5000 + (i % 3)
+            n = batch * 8 + i
+            values = [n % 50 - 25, 4096 - n % 7, -n % 11, 3 * (n % 5), -2, n % 1000]
+            samples.append((t, values))
+        # 地磁気は読み出せなかったバッチもある
+        mag = [400 + batch, -250, 640 - batch] if batch % 5 else None
+        for t_sample, values in samples:
+            expected.append((t_sample, values, mag))
+        records.append((REC_IMU_BATCH, encode_imu_batch(start_us, samples, mag)))
+        if batch % 40 == 0:
+            records.append((REC_GPS, GPS.pack(batch * 40, 356812345, 1397654321, 4210,
+                                              85, 9, 3, 1735689600 + batch // 25)))
+            records.append((REC_ORIENTATION, ORIENTATION.pack(batch * 40, 16384, 0, 0, 0,
+                                                              1234, 250, 10, -5, 3, 3150,
+                                                              200, 0x03, 4500)))
+            records.append((REC_ALIGNMENT, ALIGNMENT.pack(batch * 40, -150, 75, 35, 3560,
+                                                          0, 0, 0)))
+
+    data = bytearray(encode_blocks(records))
+    block_count = len(data) // BLOCK_SIZE
+    assert block_count > 2, "test data should span several blocks"
+
+    with tempfile.TemporaryDirectory() as tmp:
+        path = os.path.join(tmp, "000007.pnr")
+        with open(path, "wb") as f:
+            f.write(data)
+        out, stats = decode_files([path])
+        assert stats == {"blocks": block_count, "bad_blocks": 0, "gaps": 0}, stats
+        assert len(out["info"]) == 1 and out["info"][0]["session"] == 7
+        assert len(out["imu"]) == len(expected), (len(out["imu"]), len(expected))
+        for got, (t, values, mag) in zip(out["imu"], expected):
+            assert abs(got[0] - (t - start_us) * 1e-6) < 1e-9
+            for axis in range(3):
+                assert abs(got[1 + axis] - values[axis] / 4096.0) < 1e-9
+                assert abs(got[4 + axis] - values[axis + 3] / 16.0) < 1e-9
+                assert got[7 + axis] == (mag[axis] / MAG_LSB_PER_UT if mag else "")
+            assert got[10] == (0 if mag else -1)
+        assert len(out["magcal"]) == 1 and out["magcal"][0][1] == 1
+        assert out["magcal"][0][2] == 12.5 and out["magcal"][0][5] == 1.0
+        assert len(out["gps"]) == 5 and abs(out["gps"][0][2] - 35.6812345) < 1e-6
+        assert out["gps"][0][7] == 1 and out["gps"][0][8] == 1
+        assert abs(out["orient"][0][1] - 1.0) < 1e-9 and abs(out["orient"][0][7] - 0.010) < 1e-9
+        assert abs(out["align"][0][1] + 1.5) < 1e-9 and out["align"][0][5] == "polar"
+
+        # 壊れたブロックは読み飛ばし、次のブロックから続ける
+        data[BLOCK_SIZE + 100] ^= 0xFF
+        with open(path, "wb") as f:
+            f.write(data)
+        out, stats = decode_files([path])
+        assert stats["bad_blocks"] == 1 and stats["gaps"] == 1, stats
+        assert 0 < len(out["imu"]) < len(expected)
+
+        prefix = os.path.join(tmp, "session")
+        write_outputs(out, prefix)
+        with open(prefix + "_imu.csv") as f:
+            assert f.readline().startswith("time_s,ax")
+
+    print("self-test passed: %d blocks, %d IMU samples, %.1f bytes/sample" %
+          (block_count, len(expected), len(data) / len(expected)))
+    return 0
+
+
+def main(argv):
+    if len(argv) > 1 and argv[1] == "--self-test":
+        return self_test()
+
+    paths = []
+    prefix = "session"
+    i = 1
+    while i < len(argv):
+        if argv[i] == "-o" and i + 1 < len(argv):
+            prefix = argv[i + 1]
+            i += 2
+        else:
+            paths.append(argv[i])
+            i += 1
+    if not paths:
+        sys.stderr.write(__doc__)
+        return 1
+
+    out, stats = decode_files(paths)
+    write_outputs(out, prefix)
+    for info in out["info"]:
+        print("session %d part %d: IMU %d Hz, start UTC %d us" %
+              (info["session"], info["part"], info["imu_rate_hz"], info["start_utc_us"]))
+    print("%d blocks (%d bad, %d gaps): %d IMU samples, %d GPS, %d orientation, %d alignment" %
+          (stats["blocks"], stats["bad_blocks"], stats["gaps"], len(out["imu"]),
+           len(out["gps"]), len(out["orient"]), len(out["align"])))
+    print("wrote %s_{imu,gps,orient,align}.csv" % prefix)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
@@ -0,0 +1,267 @@
+#!/usr/bin/env python3
+"""
+gen_logo.py
+
+Generates src/logo_data.h: the startup logo compressed for
+src/ImageDecoder.cpp, which decodes it in line blocks straight into
+the display's DMA buffers.
+
+The source is a GIMP "C source header" export (tools/assets/icon.h). Pixels
+are reduced to RGB565 and coded with a QOI-style scheme adapted to the
+5/6/5 components. Each op is one byte unless noted:
+
+  00iiiiii          INDEX  colour from a 64-entry table of recent colours,
+                           hash = (r * 3 + g * 5 + b * 7) & 63
+  01rrggbb          DIFF   r, g, b differ from the previous pixel by -2..1
+  10gggggg rrrrbbbb LUMA   dg = -32..31; r and b differ by dg / 2 (rounded
+                           down) plus -8..7
+  11nnnnnn          RUN    the previous pixel repeated 1..62 times
+                           (0xC0..0xFD)
+  11111110 hi lo    RAW    RGB565, big-endian
+
+The differences wrap around each component's width. The previous pixel
+starts as black and the table as zeros. Runs continue across rows, so the
+decoder carries its state from one line block to the next.
+
+Usage:
+  python3 tools/gen_logo.py [image.h]   # writes src/logo_data.h
+  python3 tools/gen_logo.py --self-test
+
+Created: 2025-04-12
+GitHub: https://github.com/kennel-org/polaris-navigator
+"""
+
+import os
+import re
+import sys
+
+OP_INDEX = 0x00
+OP_DIFF = 0x40
+OP_LUMA = 0x80
+OP_RUN = 0xC0
+OP_RAW = 0xFE
+MAX_RUN = 62
+
+# 表示側の1ブロックの行数（src/StartupScreen.hのLOGO_BLOCK_ROWSと合わせる）
+BLOCK_ROWS = 8
+
+
+def load_gimp_header(path):
+    """Returns (width, height, [RGB565]) from a GIMP C header export."""
+    text = open(path, encoding="latin-1").read()
+    width = int(re.search(r"width\s*=\s*(\d+)", text).group(1))
+    height = int(re.search(r"height\s*=\s*(\d+)", text).group(1))
+    body = text[text.index("header_data ="):]
+    chars = "".join(re.findall(r'"((?:[^"\\]|\\.)*)"', body))
+    data = chars.encode("latin-1").decode("unicode_escape").encode("latin-1")
+    if len(data) != width * height * 4:
+        raise ValueError("%s: %d bytes for %dx%d" % (path, len(data), width, height))
+
+    pixels = []
+    for i in range(0, len(data), 4):
+        d = [c - 33 for c in data[i:i + 4]]
+        r = (d[0] << 2) | (d[1] >> 4)
+        g = ((d[1] & 0xF) << 4) | (d[2] >> 2)
+        b = ((d[2] & 0x3) << 6) | d[3]
+        pixels.append(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3))
+    return width, height, pixels
+
+
+def split(c):
+    return (c >> 11) & 31, (c >> 5) & 63, c & 31
+
+
+def color_hash(c):
+    r, g, b = split(c)
+    return (r * 3 + g * 5 + b * 7) & 63
+
+
+def wrap(value, bits):
+    half = 1 << (bits - 1)
+    return ((value + half) & ((1 << bits) - 1)) - half
+
+
+def encode(pixels):
+    out = bytearray()
+    index = [0] * 64
+    prev = 0
+    run = 0
+    for c in pixels:
+        if c == prev:
+            run += 1
+            if run == MAX_RUN:
+                out.append(OP_RUN | (run - 1))
+                run = 0
+            continue
+        if run:
+            out.append(OP_RUN | (run - 1))
+            run = 0
+
+        h = color_hash(c)
+        if index[h] == c:
+            out.append(OP_INDEX | h)
+        else:
+            index[h] = c
+            r, g, b = split(c)
+            pr, pg, pb = split(prev)
+            dr = wrap(r - pr, 5)
+            dg = wrap(g - pg, 6)
+            db = wrap(b - pb, 5)
+            dr_dg = dr - (dg >> 1)
+            db_dg = db - (dg >> 1)
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                out.append(OP_DIFF | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+            elif -8 <= dr_dg <= 7 and -8 <= db_dg <= 7:
+                out.append(OP_LUMA | (dg + 32))
+                out.append(((dr_dg + 8) << 4) | (db_dg + 8))
+            else:
+                out += bytes([OP_RAW, c >> 8, c & 0xFF])
+        prev = c
+    if run:
+        out.append(OP_RUN | (run - 1))
+    return bytes(out)
+
+
+class Decoder:
+    """Mirror of src/ImageDecoder.cpp (resumable between blocks)."""
+
+    def __init__(self, data, pixels):
+        self.data = data
+        self.pos = 0
+        self.prev = 0
+        self.index = [0] * 64
+        self.run = 0
+        self.remaining = pixels
+
+    def decode(self, count):
+        out = []
+        while len(out) < count and self.remaining > 0:
+            if self.run == 0 and self.pos < len(self.data):
+                op = self.data[self.pos]
+                self.pos += 1
+                if op == OP_RAW:
+                    self.prev = (self.data[self.pos] << 8) | self.data[self.pos + 1]
+                    self.pos += 2
+                elif op >= OP_RUN:
+                    self.run = (op & 0x3F) + 1
+                elif op >= OP_LUMA:
+                    dg = (op & 0x3F) - 32
+                    n = self.data[self.pos]
+                    self.pos += 1
+                    pr, pg, pb = split(self.prev)
+                    r = (pr + (n >> 4) - 8 + (dg >> 1)) & 31
+                    g = (pg + dg) & 63
+                    b = (pb + (n & 15) - 8 + (dg >> 1)) & 31
+                    self.prev = (r << 11) | (g << 5) | b
+                elif op >= OP_DIFF:
+                    pr, pg, pb = split(self.prev)
+                    r = (pr + ((op >> 4) & 3) - 2) & 31
+                    g = (pg + ((op >> 2) & 3) - 2) & 63
+                    b = (pb + (op & 3) - 2) & 31
+                    self.prev = (r << 11) | (g << 5) | b
+                else:
+                    self.prev = self.index[op]
+                if op < OP_RUN or op == OP_RAW:
+                    self.index[color_hash(self.prev)] = self.prev
+                    out.append(self.prev)
+                    self.remaining -= 1
+                    continue
+            if self.run > 0:
+                self.run -= 1
+            out.append(self.prev)
+            self.remaining -= 1
+        return out
+
+
+def decode_blocks(data, width, height, rows=BLOCK_ROWS):
+    decoder = Decoder(data, width * height)
+    pixels = []
+    for row in range(0, height, rows):
+        pixels += decoder.decode(width * min(rows, height - row))
+    return pixels
+
+
+def write_header(path, source, width, height, pixels):
+    data = encode(pixels)
+    out = []
+    out.append("/*")
+    out.append(" * logo_data.h")
+    out.append(" * ")
+    out.append(" * Generated by tools/gen_logo.py from %s - do not edit" % source)
+    out.append(" * Startup logo, RGB565 coded for ImageDecoder (QOI-style, %d bytes for %dx%d)"
+               % (len(data), width, height))
+    out.append(" * ")
+    out.append(" * Created: 2025-04-12")
+    out.append(" * GitHub: https://github.com/kennel-org/polaris-navigator")
+    out.append(" */")
+    out.append("")
+    out.append("#ifndef LOGO_DATA_H")
+    out.append("#define LOGO_DATA_H")
+    out.append("")
+    out.append("#include <Arduino.h>")
+    out.append("")
+    out.append("#define LOGO_WIDTH  %d" % width)
+    out.append("#define LOGO_HEIGHT %d" % height)
+    out.append("")
+    out.append("// const配列はESP32ではフラッシュ（rodata）に配置される")
+    out.append("static const uint8_t LOGO_DATA[%d] PROGMEM = {" % len(data))
+    for i in range(0, len(data), 16):
+        line = ", ".join("0x%02X" % b for b in data[i:i + 16])
+        sep = "," if i + 16 < len(data) else ""
+        out.append("  " + line + sep)
+    out.append("};")
+    out.append("")
+    out.append("#endif // LOGO_DATA_H")
+    out.append("")
+
+    with open(path, "w") as f:
+        f.write("\n".join(out))
+    print("wrote %s (%d bytes, %.1f%% of raw RGB565)" %
+          (path, len(data), 100.0 * len(data) / (2 * width * height)))
+
+
+def self_test(source):
+    # 端の場合: 長い連続（行をまたぐ）、表の一致、各成分の折り返し、RAW
+    width, height = 37, 11
+    synthetic = []
+    for y in range(height):
+        for x in range(width):
+            if y < 3:
+                synthetic.append(0)
+            elif y < 5:
+                synthetic.append(0xF800 if x % 2 else 0x07E0)
+            elif y < 8:
+                synthetic.append(((x * 7 + y * 3) & 31) << 11 | ((x * 13) & 63) << 5 | (y * 5 & 31))
+            else:
+                synthetic.append(0xFFFF - x * 1111 if x % 3 else 0x0821 * (x & 7))
+    data = encode(synthetic)
+    assert decode_blocks(data, width, height, 3) == synthetic, "synthetic round trip"
+    assert decode_blocks(data, width, height, 7) == synthetic, "block size must not matter"
+
+    width, height, pixels = load_gimp_header(source)
+    data = encode(pixels)
+    assert decode_blocks(data, width, height) == pixels, "logo round trip"
+    print("self-test passed: %dx%d logo in %d bytes (%d raw RGB565, %d as GIMP text)" %
+          (width, height, len(data), 2 * width * height, 4 * width * height))
+    return True
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    args = [a for a in sys.argv[1:] if a != "--self-test"]
+    source = args[0] if args else os.path.join(root, "tools", "assets", "icon.h")
+
+    if not self_test(source):
+        print("self-test failed")
+        return 1
+    if "--self-test" in sys.argv:
+        return 0
+
+    width, height, pixels = load_gimp_header(source)
+    write_header(os.path.join(root, "src", "logo_data.h"),
+                 os.path.relpath(source, root), width, height, pixels)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,267 @@
+#!/usr/bin/env python3
+"""
+gen_magnetic_grid.py
+
+Generates src/magnetic_grid_data.h: a global grid of magnetic declination,
+inclination and total field strength for magnetic_model.cpp.
+
+The field is synthesized from World Magnetic Model spherical-harmonic
+coefficients on the WGS84 ellipsoid (height 0) at GRID_EPOCH, and is only
+bilinearly interpolated at runtime.
+
+By default the built-in WMM2020 coefficients (degree 1-8, with secular
+variation) are used. Leaving out degrees 9-12 changes the declination by
+up to about 0.5 degrees away from the magnetic poles (see --self-test).
+For the full model of a newer epoch, pass the official coefficient file
+from NOAA:
+
+  python3 tools/gen_magnetic_grid.py                  # built-in WMM2020 (degree 8)
+  python3 tools/gen_magnetic_grid.py WMM.COF 2026.0   # full model at an epoch
+  python3 tools/gen_magnetic_grid.py --self-test      # WMM2020 test values
+
+Created: 2025-04-12
+GitHub: https://github.com/kennel-org/polaris-navigator
+"""
+
+import math
+import os
+import sys
+
+# Grid layout
+GRID_STEP = 2.0          # degrees
+GRID_EPOCH = 2025.5      # decimal year
+
+# Reference radius of the model and WGS84 ellipsoid (km)
+MODEL_RADIUS = 6371.2
+WGS84_A = 6378.137
+WGS84_F = 1.0 / 298.257223563
+
+DEG = math.pi / 180.0
+
+# WMM2020: n, m, g, h, g_dot, h_dot (nT, nT/yr), epoch 2020.0
+WMM2020_EPOCH = 2020.0
+WMM2020 = [
+    (1, 0, -29404.5, 0.0, 6.7, 0.0),
+    (1, 1, -1450.7, 4652.9, 7.7, -25.1),
+    (2, 0, -2500.0, 0.0, -11.5, 0.0),
+    (2, 1, 2982.0, -2991.6, -7.1, -30.2),
+    (2, 2, 1676.8, -734.8, -2.2, -23.9),
+    (3, 0, 1363.9, 0.0, 2.8, 0.0),
+    (3, 1, -2381.0, -82.2, -6.2, 5.7),
+    (3, 2, 1236.2, 241.8, 3.4, -1.0),
+    (3, 3, 525.7, -542.9, -12.2, 1.1),
+    (4, 0, 903.1, 0.0, -1.1, 0.0),
+    (4, 1, 809.4, 282.0, -1.6, 0.2),
+    (4, 2, 86.2, -158.4, -6.0, 6.9),
+    (4, 3, -309.4, 199.8, 5.4, 3.7),
+    (4, 4, 47.9, -350.1, -5.5, -5.6),
+    (5, 0, -234.4, 0.0, -0.3, 0.0),
+    (5, 1, 363.1, 47.7, 0.6, 0.1),
+    (5, 2, 187.8, 208.4, -0.7, 2.5),
+    (5, 3, -140.7, -121.3, 0.1, -0.9),
+    (5, 4, -151.2, 32.2, 1.2, 3.0),
+    (5, 5, 13.7, 99.1, 1.0, 0.5),
+    (6, 0, 65.9, 0.0, -0.6, 0.0),
+    (6, 1, 65.6, -19.1, -0.4, 0.1),
+    (6, 2, 73.0, 25.0, 0.5, -1.8),
+    (6, 3, -121.5, 52.7, 1.4, -1.4),
+    (6, 4, -36.2, -64.4, -1.4, 0.9),
+    (6, 5, 13.5, 9.0, -0.0, 0.1),
+    (6, 6, -64.7, 68.1, 0.8, 1.0),
+    (7, 0, 80.6, 0.0, -0.1, 0.0),
+    (7, 1, -76.8, -51.4, -0.3, 0.5),
+    (7, 2, -8.3, -16.8, -0.1, 0.6),
+    (7, 3, 56.5, 2.3, 0.7, -0.7),
+    (7, 4, 15.8, 23.5, 0.2, -0.2),
+    (7, 5, 6.4, -2.2, -0.5, -1.2),
+    (7, 6, -7.2, -27.2, -0.8, 0.2),
+    (7, 7, 9.8, -1.9, 1.0, 0.3),
+    (8, 0, 23.6, 0.0, -0.1, 0.0),
+    (8, 1, 9.8, 8.4, 0.1, -0.3),
+    (8, 2, -17.5, -15.3, -0.1, 0.7),
+    (8, 3, -0.4, 12.8, 0.5, -0.2),
+    (8, 4, -21.1, -11.8, -0.1, 0.5),
+    (8, 5, 15.3, 14.9, 0.4, -0.3),
+    (8, 6, 13.7, 3.6, 0.5, -0.5),
+    (8, 7, -16.5, -6.9, 0.0, -0.2),
+    (8, 8, -0.3, 2.8, 0.4, 0.1),
+]
+
+
+def load_cof(path):
+    """Read an official WMM.COF file: returns (epoch, coefficients, name)."""
+    coefficients = []
+    epoch = None
+    name = os.path.basename(path)
+    with open(path) as f:
+        for line in f:
+            fields = line.split()
+            if not fields:
+                continue
+            if fields[0].startswith("9999"):
+                break
+            if epoch is None:
+                epoch = float(fields[0])
+                name = fields[1]
+                continue
+            n, m = int(fields[0]), int(fields[1])
+            g, h, gd, hd = (float(x) for x in fields[2:6])
+            coefficients.append((n, m, g, h, gd, hd))
+    return epoch, coefficients, name
+
+
+def schmidt_legendre(nmax, x):
+    """Schmidt semi-normalized associated Legendre functions P[n][m](x)."""
+    s = math.sqrt(max(0.0, 1.0 - x * x))
+    P = [[0.0] * (nmax + 2) for _ in range(nmax + 2)]
+    P[0][0] = 1.0
+    for m in range(0, nmax + 1):
+        if m > 0:
+            P[m][m] = (2 * m - 1) * s * P[m - 1][m - 1]
+        if m + 1 <= nmax:
+            P[m + 1][m] = (2 * m + 1) * x * P[m][m]
+        for n in range(m + 2, nmax + 1):
+            P[n][m] = ((2 * n - 1) * x * P[n - 1][m] - (n + m - 1) * P[n - 2][m]) / (n - m)
+    for n in range(1, nmax + 1):
+        for m in range(1, n + 1):
+            P[n][m] *= math.sqrt(2.0 * math.factorial(n - m) / math.factorial(n + m))
+    return P
+
+
+def field(coefficients, epoch, year, latitude, longitude):
+    """North, east and down components (nT) at a geodetic position, height 0."""
+    dt = year - epoch
+    nmax = max(c[0] for c in coefficients)
+
+    # Geodetic -> geocentric
+    lat = max(-89.999, min(89.999, latitude)) * DEG
+    e2 = WGS84_F * (2.0 - WGS84_F)
+    rc = WGS84_A / math.sqrt(1.0 - e2 * math.sin(lat) ** 2)
+    xp = rc * math.cos(lat)
+    zp = rc * (1.0 - e2) * math.sin(lat)
+    r = math.hypot(xp, zp)
+    lat_c = math.asin(zp / r)
+    lon = longitude * DEG
+
+    # dP/dlat by central difference (this is an offline generator)
+    eps = 1e-6
+    P = schmidt_legendre(nmax, math.sin(lat_c))
+    Pp = schmidt_legendre(nmax, math.sin(lat_c + eps))
+    Pm = schmidt_legendre(nmax, math.sin(lat_c - eps))
+
+    x = y = z = 0.0
+    for n, m, g, h, gd, hd in coefficients:
+        g += gd * dt
+        h += hd * dt
+        scale = (MODEL_RADIUS / r) ** (n + 2)
+        cos_m, sin_m = math.cos(m * lon), math.sin(m * lon)
+        dP = (Pp[n][m] - Pm[n][m]) / (2.0 * eps)
+        x += -scale * (g * cos_m + h * sin_m) * dP
+        y += scale * m * (g * sin_m - h * cos_m) * P[n][m] / math.cos(lat_c)
+        z += -(n + 1) * scale * (g * cos_m + h * sin_m) * P[n][m]
+
+    # Geocentric -> geodetic components
+    psi = lat_c - lat
+    north = x * math.cos(psi) - z * math.sin(psi)
+    down = x * math.sin(psi) + z * math.cos(psi)
+    # x is already the northward component, so y is eastward
+    return north, y, down
+
+
+def elements(north, east, down):
+    horizontal = math.hypot(north, east)
+    declination = math.atan2(east, north) / DEG
+    inclination = math.atan2(down, horizontal) / DEG
+    total = math.sqrt(horizontal * horizontal + down * down)
+    return declination, inclination, total
+
+
+def self_test():
+    """WMM2020 report test values at 2020.0, height 0 (degree 12 model)."""
+    tests = [
+        # lat, lon, D, I, F
+        (80.0, 0.0, -1.28, 83.14, 55000.1),
+        (0.0, 120.0, 0.16, -15.42, 41104.9),
+        (-80.0, 240.0, 69.36, -72.20, 55120.6),
+    ]
+    ok = True
+    for lat, lon, d_ref, i_ref, f_ref in tests:
+        d, i, f = elements(*field(WMM2020, WMM2020_EPOCH, 2020.0, lat, lon))
+        print("lat %6.1f lon %6.1f: D %+7.2f (%+7.2f)  I %+6.2f (%+6.2f)  F %8.1f (%8.1f)"
+              % (lat, lon, d, d_ref, i, i_ref, f, f_ref))
+        # 8次までの打ち切りを考慮した許容範囲
+        ok = ok and abs(d - d_ref) < 1.0 and abs(i - i_ref) < 0.5 and abs(f - f_ref) < 300.0
+    return ok
+
+
+def write_grid(path, coefficients, epoch, name, year):
+    rows = int(round(180.0 / GRID_STEP)) + 1
+    columns = int(round(360.0 / GRID_STEP)) + 1
+
+    out = []
+    out.append("/*")
+    out.append(" * magnetic_grid_data.h")
+    out.append(" * ")
+    out.append(" * Generated by tools/gen_magnetic_grid.py - do not edit")
+    out.append(" * %s magnetic field grid for magnetic_model.cpp (epoch %.1f, height 0)" % (name, year))
+    out.append(" * ")
+    out.append(" * 値は { 偏角 (0.01度), 伏角 (0.01度), 全磁力 (0.01uT) } のint16")
+    out.append(" * 行は南緯90度から北緯90度、列は西経180度から東経180度（両端を含む）")
+    out.append(" * ")
+    out.append(" * Created: 2025-04-12")
+    out.append(" * GitHub: https://github.com/kennel-org/polaris-navigator")
+    out.append(" */")
+    out.append("")
+    out.append("#ifndef MAGNETIC_GRID_DATA_H")
+    out.append("#define MAGNETIC_GRID_DATA_H")
+    out.append("")
+    out.append("#include <stdint.h>")
+    out.append("")
+    out.append("// const配列はESP32ではフラッシュ（rodata）に配置される")
+    out.append("#define MAGNETIC_GRID_EPOCH     %.1ff" % year)
+    out.append("#define MAGNETIC_GRID_STEP      %.1ff" % GRID_STEP)
+    out.append("#define MAGNETIC_GRID_ROWS      %d" % rows)
+    out.append("#define MAGNETIC_GRID_COLUMNS   %d" % columns)
+    out.append("")
+    out.append("static const int16_t MAGNETIC_GRID[MAGNETIC_GRID_ROWS][MAGNETIC_GRID_COLUMNS][3] = {")
+    for row in range(rows):
+        lat = -90.0 + row * GRID_STEP
+        out.append("  {  // %+.0f" % lat)
+        values = []
+        for column in range(columns):
+            lon = -180.0 + column * GRID_STEP
+            d, i, f = elements(*field(coefficients, epoch, year, lat, lon))
+            values.append("{%d,%d,%d}" % (round(d * 100.0), round(i * 100.0), round(f / 10.0)))
+        for k in range(0, columns, 8):
+            sep = "," if k + 8 < columns else ""
+            out.append("    " + ",".join(values[k:k + 8]) + sep)
+        out.append("  }," if row < rows - 1 else "  }")
+    out.append("};")
+    out.append("")
+    out.append("#endif // MAGNETIC_GRID_DATA_H")
+    out.append("")
+
+    with open(path, "w") as f:
+        f.write("\n".join(out))
+    print("wrote %s (%d x %d)" % (path, rows, columns))
+
+
+def main():
+    if not self_test():
+        print("self-test failed")
+        return 1
+    if "--self-test" in sys.argv:
+        return 0
+
+    coefficients, epoch, name, year = WMM2020, WMM2020_EPOCH, "WMM2020 (degree 8)", GRID_EPOCH
+    if len(sys.argv) > 1:
+        epoch, coefficients, name = load_cof(sys.argv[1])
+        year = float(sys.argv[2]) if len(sys.argv) > 2 else epoch
+
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    write_grid(os.path.join(root, "src", "magnetic_grid_data.h"), coefficients, epoch, name, year)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
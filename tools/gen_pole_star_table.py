@@ -0,0 +1,328 @@
+#!/usr/bin/env python3
+"""
+gen_pole_star_table.py
+
+Generates src/pole_star_data.h: apparent places of Polaris and Sigma Octantis
+and an atmospheric refraction table for pole_star_table.cpp.
+
+Method (standard library only):
+  - ICRS J2000 catalogue place + space motion (proper motion as a vector)
+  - IAU 1976 precession (Lieske) from J2000 to the date
+  - IAU 1980 nutation (terms down to 0.001")
+  - Annual aberration as an Earth-velocity vector, including the e-terms
+  - Equation of the equinoxes folded into RA, so that
+    hour angle = GMST + longitude - RA (the device only computes GMST)
+
+Light deflection (< 0.005") and annual parallax (< 0.012") are ignored.
+The places are sampled every 10 days. Annual aberration (±20") is not
+resolved by yearly samples, but with 10-day samples linear interpolation
+stays within 0.3".
+
+Usage:
+  python3 tools/gen_pole_star_table.py              # writes src/pole_star_data.h
+  python3 tools/gen_pole_star_table.py --self-test  # checks against Meeus example 23.a
+
+Created: 2025-04-12
+GitHub: https://github.com/kennel-org/polaris-navigator
+"""
+
+import math
+import os
+import sys
+
+# Table range and spacing
+START_YEAR = 2024
+END_YEAR = 2035          # inclusive
+STEP_DAYS = 10.0
+
+# Refraction table (true altitude in degrees)
+REFRACTION_MIN_ALT = -1.0
+REFRACTION_MAX_ALT = 90.0
+REFRACTION_STEP = 0.5
+
+ARCSEC = math.pi / (180.0 * 3600.0)
+DEG = math.pi / 180.0
+
+# Catalogue (ICRS, epoch J2000; proper motion mu_alpha* = mu_alpha cos(dec), mas/yr)
+STARS = [
+    # name, RA (h, m, s), Dec (sign, d, m, s), pmRA*, pmDec
+    ("Polaris",         (2, 31, 49.09456), (+1, 89, 15, 50.7923), 44.48, -11.85),
+    ("Sigma Octantis",  (21, 8, 46.86357), (-1, 88, 57, 23.3983), 25.96, 5.02),
+]
+
+# IAU 1980 nutation series: D, M, M', F, Omega, psi (0.0001"), psi_t, eps, eps_t
+NUTATION_TERMS = [
+    (0, 0, 0, 0, 1, -171996, -174.2, 92025, 8.9),
+    (-2, 0, 0, 2, 2, -13187, -1.6, 5736, -3.1),
+    (0, 0, 0, 2, 2, -2274, -0.2, 977, -0.5),
+    (0, 0, 0, 0, 2, 2062, 0.2, -895, 0.5),
+    (0, 1, 0, 0, 0, 1426, -3.4, 54, -0.1),
+    (0, 0, 1, 0, 0, 712, 0.1, -7, 0.0),
+    (-2, 1, 0, 2, 2, -517, 1.2, 224, -0.6),
+    (0, 0, 0, 2, 1, -386, -0.4, 200, 0.0),
+    (0, 0, 1, 2, 2, -301, 0.0, 129, -0.1),
+    (-2, -1, 0, 2, 2, 217, -0.5, -95, 0.3),
+    (-2, 0, 1, 0, 0, -158, 0.0, 0, 0.0),
+    (-2, 0, 0, 2, 1, 129, 0.1, -70, 0.0),
+    (0, 0, -1, 2, 2, 123, 0.0, -53, 0.0),
+    (2, 0, 0, 0, 0, 63, 0.0, 0, 0.0),
+    (0, 0, 1, 0, 1, 63, 0.1, -33, 0.0),
+    (2, 0, -1, 2, 2, -59, 0.0, 26, 0.0),
+    (0, 0, -1, 0, 1, -58, -0.1, 32, 0.0),
+    (0, 0, 1, 2, 1, -51, 0.0, 27, 0.0),
+    (-2, 0, 2, 0, 0, 48, 0.0, 0, 0.0),
+    (0, 0, -2, 2, 1, 46, 0.0, -24, 0.0),
+    (2, 0, 0, 2, 2, -38, 0.0, 16, 0.0),
+    (0, 0, 2, 2, 2, -31, 0.0, 13, 0.0),
+    (0, 0, 2, 0, 0, 29, 0.0, 0, 0.0),
+    (-2, 0, 1, 2, 2, 29, 0.0, -12, 0.0),
+    (0, 0, 0, 2, 0, 26, 0.0, 0, 0.0),
+    (-2, 0, 0, 2, 0, -22, 0.0, 0, 0.0),
+    (0, 0, -1, 2, 1, 21, 0.0, -10, 0.0),
+    (0, 2, 0, 0, 0, 17, -0.1, 0, 0.0),
+    (2, 0, -1, 0, 1, 16, 0.0, -8, 0.0),
+    (-2, 2, 0, 2, 2, -16, 0.1, 7, 0.0),
+    (0, 1, 0, 0, 1, -15, 0.0, 9, 0.0),
+    (-2, 0, 1, 0, 1, -13, 0.0, 7, 0.0),
+    (0, -1, 0, 0, 1, -12, 0.0, 6, 0.0),
+    (0, 0, 2, -2, 0, 11, 0.0, 0, 0.0),
+]
+
+
+def julian_date(year, month, day):
+    """Julian date at 0h of a Gregorian calendar date."""
+    if month <= 2:
+        year -= 1
+        month += 12
+    a = year // 100
+    b = 2 - a + a // 4
+    return math.floor(365.25 * (year + 4716)) + math.floor(30.6001 * (month + 1)) + day + b - 1524.5
+
+
+# Rotation matrices (frame rotations)
+def r1(a):
+    c, s = math.cos(a), math.sin(a)
+    return [[1, 0, 0], [0, c, s], [0, -s, c]]
+
+
+def r2(a):
+    c, s = math.cos(a), math.sin(a)
+    return [[c, 0, -s], [0, 1, 0], [s, 0, c]]
+
+
+def r3(a):
+    c, s = math.cos(a), math.sin(a)
+    return [[c, s, 0], [-s, c, 0], [0, 0, 1]]
+
+
+def mat_mul(a, b):
+    return [[sum(a[i][k] * b[k][j] for k in range(3)) for j in range(3)] for i in range(3)]
+
+
+def mat_vec(m, v):
+    return [sum(m[i][k] * v[k] for k in range(3)) for i in range(3)]
+
+
+def normalize(v):
+    n = math.sqrt(sum(x * x for x in v))
+    return [x / n for x in v]
+
+
+def to_vector(ra, dec):
+    return [math.cos(dec) * math.cos(ra), math.cos(dec) * math.sin(ra), math.sin(dec)]
+
+
+def to_spherical(v):
+    ra = math.atan2(v[1], v[0]) % (2.0 * math.pi)
+    dec = math.asin(max(-1.0, min(1.0, v[2])))
+    return ra, dec
+
+
+def nutation(T):
+    """Nutation in longitude and obliquity (radians) and the mean obliquity."""
+    D = (297.85036 + 445267.111480 * T - 0.0019142 * T * T + T ** 3 / 189474.0) * DEG
+    M = (357.52772 + 35999.050340 * T - 0.0001603 * T * T - T ** 3 / 300000.0) * DEG
+    Mp = (134.96298 + 477198.867398 * T + 0.0086972 * T * T + T ** 3 / 56250.0) * DEG
+    F = (93.27191 + 483202.017538 * T - 0.0036825 * T * T + T ** 3 / 327270.0) * DEG
+    Om = (125.04452 - 1934.136261 * T + 0.0020708 * T * T + T ** 3 / 450000.0) * DEG
+
+    dpsi = 0.0
+    deps = 0.0
+    for d, m, mp, f, om, ps, pst, ep, ept in NUTATION_TERMS:
+        arg = d * D + m * M + mp * Mp + f * F + om * Om
+        dpsi += (ps + pst * T) * math.sin(arg)
+        deps += (ep + ept * T) * math.cos(arg)
+    dpsi *= 0.0001 * ARCSEC
+    deps *= 0.0001 * ARCSEC
+
+    eps0 = (84381.448 - 46.8150 * T - 0.00059 * T * T + 0.001813 * T ** 3) * ARCSEC
+    return dpsi, deps, eps0
+
+
+def earth_velocity(T):
+    """Earth's velocity / c in the ecliptic of date (annual aberration vector)."""
+    kappa = 20.49552 * ARCSEC
+    L0 = 280.46646 + 36000.76983 * T + 0.0003032 * T * T
+    M = (357.52911 + 35999.05029 * T - 0.0001537 * T * T) * DEG
+    C = ((1.914602 - 0.004817 * T - 0.000014 * T * T) * math.sin(M)
+         + (0.019993 - 0.000101 * T) * math.sin(2 * M)
+         + 0.000289 * math.sin(3 * M))
+    sun = (L0 + C) * DEG
+    e = 0.016708634 - 0.000042037 * T
+    perihelion = (102.93735 + 1.71946 * T) * DEG
+    return [kappa * (math.sin(sun) - e * math.sin(perihelion)),
+            kappa * (-math.cos(sun) + e * math.cos(perihelion)),
+            0.0]
+
+
+def apparent_place(ra0, dec0, pm_ra_star, pm_dec, jd):
+    """Apparent place (true equator and equinox of date) plus the equation of the equinoxes."""
+    t = (jd - 2451545.0) / 365.25         # Julian years
+    T = t / 100.0                         # Julian centuries
+
+    # Space motion (linear in the tangent plane)
+    p = to_vector(ra0, dec0)
+    e_ra = [-math.sin(ra0), math.cos(ra0), 0.0]
+    e_dec = [-math.sin(dec0) * math.cos(ra0), -math.sin(dec0) * math.sin(ra0), math.cos(dec0)]
+    mu_ra = pm_ra_star * 0.001 * ARCSEC
+    mu_dec = pm_dec * 0.001 * ARCSEC
+    p = normalize([p[i] + t * (mu_ra * e_ra[i] + mu_dec * e_dec[i]) for i in range(3)])
+
+    # Precession (IAU 1976)
+    zeta = (2306.2181 * T + 0.30188 * T * T + 0.017998 * T ** 3) * ARCSEC
+    z = (2306.2181 * T + 1.09468 * T * T + 0.018203 * T ** 3) * ARCSEC
+    theta = (2004.3109 * T - 0.42665 * T * T - 0.041833 * T ** 3) * ARCSEC
+    P = mat_mul(r3(-z), mat_mul(r2(theta), r3(-zeta)))
+    p = mat_vec(P, p)
+
+    # Nutation
+    dpsi, deps, eps0 = nutation(T)
+    eps = eps0 + deps
+    N = mat_mul(r1(-eps), mat_mul(r3(-dpsi), r1(eps0)))
+    p = mat_vec(N, p)
+
+    # Annual aberration (velocity rotated from the ecliptic to the true equator)
+    v = mat_vec(r1(-eps), earth_velocity(T))
+    p = normalize([p[i] + v[i] for i in range(3)])
+
+    ra, dec = to_spherical(p)
+    return ra, dec, dpsi * math.cos(eps)
+
+
+def refraction_arcmin(true_alt):
+    """Saemundsson's formula for a true altitude, 10 degC and 1010 hPa (arcminutes)."""
+    h = max(true_alt, -1.5)
+    r = 1.02 / math.tan((h + 10.3 / (h + 5.11)) * DEG)
+    # 天頂で0になるよう補正（式は90度で約-0.0019分）
+    return max(r + 0.0019279, 0.0)
+
+
+def catalogue(star):
+    name, (rh, rm, rs), (sign, dd, dm, ds), pm_ra, pm_dec = star
+    ra = (rh + rm / 60.0 + rs / 3600.0) * 15.0 * DEG
+    dec = sign * (dd + dm / 60.0 + ds / 3600.0) * DEG
+    return name, ra, dec, pm_ra, pm_dec
+
+
+def self_test():
+    """Meeus, Astronomical Algorithms 2nd ed., example 23.a (theta Persei)."""
+    ra0 = (2 + 44 / 60.0 + 11.986 / 3600.0) * 15.0 * DEG
+    dec0 = (49 + 13 / 60.0 + 42.48 / 3600.0) * DEG
+    pm_ra_star = 0.03425 * 15.0 * 1000.0 * math.cos(dec0)   # s/yr -> mas/yr (mu_alpha*)
+    pm_dec = -0.0895 * 1000.0
+    jd = 2462088.69
+
+    ra, dec, _ = apparent_place(ra0, dec0, pm_ra_star, pm_dec, jd)
+    expected_ra = (2 + 46 / 60.0 + 14.390 / 3600.0) * 15.0 * DEG
+    expected_dec = (49 + 21 / 60.0 + 7.45 / 3600.0) * DEG
+    err_ra = (ra - expected_ra) / ARCSEC * math.cos(dec)
+    err_dec = (dec - expected_dec) / ARCSEC
+    print("Meeus 23.a: dRA*cos(dec) = %+.3f\"  dDec = %+.3f\"" % (err_ra, err_dec))
+    return abs(err_ra) < 0.5 and abs(err_dec) < 0.5
+
+
+def write_table(path):
+    start_jd = julian_date(START_YEAR, 1, 1)
+    end_jd = julian_date(END_YEAR + 1, 1, 1)
+    entries = int(math.ceil((end_jd - start_jd) / STEP_DAYS)) + 1
+
+    out = []
+    out.append("/*")
+    out.append(" * pole_star_data.h")
+    out.append(" * ")
+    out.append(" * Generated by tools/gen_pole_star_table.py - do not edit")
+    out.append(" * Apparent places of the pole stars and refraction for pole_star_table.cpp")
+    out.append(" * ")
+    out.append(" * 赤経は均時差（分点差）を含めたGMST基準の値（時角 = GMST + 経度 - 赤経）")
+    out.append(" * ")
+    out.append(" * Created: 2025-04-12")
+    out.append(" * GitHub: https://github.com/kennel-org/polaris-navigator")
+    out.append(" */")
+    out.append("")
+    out.append("#ifndef POLE_STAR_DATA_H")
+    out.append("#define POLE_STAR_DATA_H")
+    out.append("")
+    out.append("// const配列はESP32ではフラッシュ（rodata）に配置される")
+    out.append("")
+    out.append("// Apparent places: %d-01-01 to %d-12-31, every %g days" % (START_YEAR, END_YEAR, STEP_DAYS))
+    out.append("#define POLE_STAR_TABLE_START_JD  %.1f" % start_jd)
+    out.append("#define POLE_STAR_TABLE_STEP_DAYS %.1f" % STEP_DAYS)
+    out.append("#define POLE_STAR_TABLE_ENTRIES   %d" % entries)
+    out.append("")
+    out.append("// [star][entry] = { RA (deg, GMST frame), Dec (deg) }")
+    out.append("static const float POLE_STAR_PLACES[2][POLE_STAR_TABLE_ENTRIES][2] = {")
+    for s, star in enumerate(STARS):
+        name, ra0, dec0, pm_ra, pm_dec = catalogue(star)
+        out.append("  {  // %s" % name)
+        year = None
+        for i in range(entries):
+            jd = start_jd + i * STEP_DAYS
+            ra, dec, eqeq = apparent_place(ra0, dec0, pm_ra, pm_dec, jd)
+            ra_gmst = (ra - eqeq) / DEG % 360.0
+            entry_year = START_YEAR + int((jd - start_jd) / 365.25)
+            if entry_year != year:
+                year = entry_year
+                out.append("    // %d" % year)
+            sep = "," if i < entries - 1 else ""
+            out.append("    { %.6ff, %.7ff }%s" % (ra_gmst, dec / DEG, sep))
+        out.append("  }," if s < len(STARS) - 1 else "  }")
+    out.append("};")
+    out.append("")
+
+    count = int(round((REFRACTION_MAX_ALT - REFRACTION_MIN_ALT) / REFRACTION_STEP)) + 1
+    out.append("// Refraction (arcminutes) for true altitudes %g to %g deg, 10 degC / 1010 hPa"
+               % (REFRACTION_MIN_ALT, REFRACTION_MAX_ALT))
+    out.append("#define REFRACTION_TABLE_MIN_ALT  %.1ff" % REFRACTION_MIN_ALT)
+    out.append("#define REFRACTION_TABLE_STEP     %.1ff" % REFRACTION_STEP)
+    out.append("#define REFRACTION_TABLE_ENTRIES  %d" % count)
+    out.append("")
+    out.append("static const float REFRACTION_TABLE[REFRACTION_TABLE_ENTRIES] = {")
+    values = ["%.4ff" % refraction_arcmin(REFRACTION_MIN_ALT + i * REFRACTION_STEP) for i in range(count)]
+    for i in range(0, count, 8):
+        line = ", ".join(values[i:i + 8])
+        sep = "," if i + 8 < count else ""
+        out.append("  " + line + sep)
+    out.append("};")
+    out.append("")
+    out.append("#endif // POLE_STAR_DATA_H")
+    out.append("")
+
+    with open(path, "w") as f:
+        f.write("\n".join(out))
+    print("wrote %s (%d entries per star)" % (path, entries))
+
+
+def main():
+    if not self_test():
+        print("self-test failed")
+        return 1
+    if "--self-test" in sys.argv:
+        return 0
+
+    root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+    write_table(os.path.join(root, "src", "pole_star_data.h"))
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
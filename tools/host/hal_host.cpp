@@ -0,0 +1,31 @@
+/*
+ * hal_host.cpp
+ * 
+ * Host implementation of src/hal.h for the replay and benchmark harness
+ * The clock is virtual: it only moves when the replay sets it, so a run
+ * over the same input always produces the same output
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "hal.h"
+
+// 仮想時計（esp_timer_get_time()と同じくマイクロ秒）
+static int64_t hostTimeUs = 0;
+
+void halHostSetTimeUs(int64_t timeUs) {
+  hostTimeUs = timeUs;
+}
+
+int64_t esp_timer_get_time() {
+  return hostTimeUs;
+}
+
+unsigned long millis() {
+  return (unsigned long)(hostTimeUs / 1000);
+}
+
+unsigned long micros() {
+  return (unsigned long)hostTimeUs;
+}
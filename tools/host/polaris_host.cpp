@@ -0,0 +1,765 @@
+/*
+ * polaris_host.cpp
+ * 
+ * Native replay and benchmark harness for the Polaris Navigator math
+ * Runs the sensor fusion (GyroBiasEstimator + AHRSEngine, the same steps
+ * as SensorTask::processSample()), the magnetometer calibrator and the
+ * ephemeris on a PC, without the device
+ * 
+ *   bench   synthetic scenarios with known truth: accuracy and per-call cost
+ *           of every stage and the fast math error bounds, checked against the thresholds below (exit 1 on
+ *           a regression; the per-call costs only count with --strict-timing)
+ *   replay  a session decoded by tools/decode_session.py: re-runs the fusion
+ *           over the recorded IMU samples and the ephemeris over the recorded
+ *           GPS fixes, and compares with what the device computed (exit 1 when
+ *           the pitch/roll or pole position RMS exceeds REPLAY_MAX_*)
+ * 
+ * 入力と仮想時計だけで結果が決まるため、同じ入力なら常に同じ出力になる。
+ * 記録された磁力計の生データに装置と同じ較正を当てて9軸で再生し、
+ * 方位・ピッチ・ロールと極の位置を比較する（地磁気のないバッチは6軸）。
+ * 
+ * Build (from the repository root):
+ *   g++ -std=gnu++17 -O2 -Wall -Isrc -o polaris_host \
+ *       tools/host/polaris_host.cpp tools/host/hal_host.cpp \
+ *       src/fast_math.cpp src/AHRSEngine.cpp src/GyroBiasEstimator.cpp \
+ *       src/MagCalibrator.cpp src/celestial_math.cpp src/pole_star_table.cpp \
+ *       src/magnetic_model.cpp src/Ephemeris.cpp src/TimeBase.cpp src/Logger.cpp \
+ *       src/AlignmentAverager.cpp
+ * 
+ *   ./polaris_host bench [--strict-timing]
+ *   python3 tools/decode_session.py 000012.pnr -o night1
+ *   ./polaris_host replay night1 [mahony|madgwick|eskf]
+ * 
+ * Created: 2025-04-12
+ * GitHub: https://github.com/kennel-org/polaris-navigator
+ */
+
+#include "hal.h"
+#include <chrono>
+#include <vector>
+#include "AHRSEngine.h"
+#include "GyroBiasEstimator.h"
+#include "MagCalibrator.h"
+#include "Ephemeris.h"
+#include "celestial_math.h"
+#include "pole_star_table.h"
+#include "magnetic_model.h"
+#include "AlignmentAverager.h"
+#include "fast_math.h"
+
+// Regression thresholds (bench)
+// コストはデスクトップPCでの目安（ESP32-S3ではおよそ50〜100倍）。マシンの速さや
+// 負荷で変わるため、--strict-timing を付けたときだけ合否に含める
+#define BENCH_AHRS_MAX_ERROR_DEG     0.6    // 収束後の姿勢誤差の最大値
+#define BENCH_AHRS_FINAL_ERROR_DEG   0.2    // 静止区間の終わりの姿勢誤差
+#define BENCH_AHRS_MAX_NS            2000   // 1サンプルあたりのコスト
+#define BENCH_BIAS_MAX_ERROR_DPS     0.02   // 静止区間で推定したバイアスの誤差
+#define BENCH_MAG_MAX_OFFSET_UT      1.0    // ハードアイアンの推定誤差
+#define BENCH_MAG_MAX_NS             5000
+#define BENCH_POLE_ALT_TOLERANCE_DEG 0.1    // 極の見かけの高度 - 緯度（大気差の分）
+#define BENCH_POLE_AZ_LIMIT_DEG      1.5    // 北極星の方位（真北からのずれの上限）
+#define BENCH_SUN_DEC_TOLERANCE_DEG  0.05   // 夏至の太陽赤緯
+#define BENCH_PREDICT_MAX_ERROR_DEG  0.01   // 一定の角速度で60ms先を予測した誤差
+#define BENCH_PREDICT_MAX_NS         500
+#define BENCH_ALIGN_MAX_ERROR_ARCMIN 0.5    // 400Hzで10秒平均した極の位置の誤差
+#define BENCH_ALIGN_MAX_SIGMA_RATIO  3.0    // 実際の誤差 / 推定した1σ
+#define BENCH_EPHEMERIS_MAX_NS       5000   // Ephemeris::update() 1回あたり（200ms間隔）
+#define BENCH_ELEMENTS_MAX_NS        20000  // 太陽・月・極星の赤経赤緯の計算
+
+// Synthetic scenario
+#define BENCH_RATE_HZ        200
+#define BENCH_FIELD_UT       46.0f    // 全磁力
+#define BENCH_INCLINATION    49.0f    // 伏角（東京付近）
+#define BENCH_GYRO_NOISE_DPS 0.02f
+#define BENCH_ACC_NOISE_G    0.003f
+#define BENCH_MAG_NOISE_UT   0.2f
+
+// Replay: IMU samples between the start of the log and the first comparison
+#define REPLAY_SETTLE_S      5.0
+
+// Replay regression thresholds (RMS against what the device computed)
+// 記録の量子化（姿勢は1/16384、極の位置は0.01度）より十分大きい値
+#define REPLAY_MAX_TILT_RMS_DEG  0.5    // ピッチ・ロール
+#define REPLAY_MAX_POLE_RMS_DEG  0.02   // 極の方位・高度
+
+typedef std::chrono::steady_clock BenchClock;
+
+static double elapsedNs(BenchClock::time_point start, long calls) {
+  double ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(
+                BenchClock::now() - start).count();
+  return calls > 0 ? ns / calls : 0.0;
+}
+
+// Deterministic noise (LCG + Box-Muller)
+class Noise {
+public:
+  explicit Noise(uint32_t seed) : _state(seed) {}
+  
+  float uniform() {
+    _state = _state * 1664525u + 1013904223u;
+    return ((_state >> 8) + 0.5f) / 16777216.0f;
+  }
+  
+  float gaussian(float sigma) {
+    float u1 = uniform();
+    float u2 = uniform();
+    return sigma * sqrtf(-2.0f * logf(u1)) * cosf(6.2831853f * u2);
+  }
+
+private:
+  uint32_t _state;
+};
+
+// Quaternion helpers (w, x, y, z; body -> horizontal frame X=north, Y=west, Z=zenith)
+static void quatMultiply(const float a[4], const float b[4], float out[4]) {
+  float r[4] = {
+    a[0] * b[0] - a[1] * b[1] - a[2] * b[2] - a[3] * b[3],
+    a[0] * b[1] + a[1] * b[0] + a[2] * b[3] - a[3] * b[2],
+    a[0] * b[2] - a[1] * b[3] + a[2] * b[0] + a[3] * b[1],
+    a[0] * b[3] + a[1] * b[2] - a[2] * b[1] + a[3] * b[0]
+  };
+  memcpy(out, r, sizeof(r));
+}
+
+static void quatFromAxisAngle(float x, float y, float z, float angleRad, float q[4]) {
+  float s = sinf(angleRad * 0.5f);
+  q[0] = cosf(angleRad * 0.5f);
+  q[1] = x * s;
+  q[2] = y * s;
+  q[3] = z * s;
+}
+
+// Horizontal-frame vector expressed in body axes (R^T v)
+static void toBody(const float q[4], const float v[3], float out[3]) {
+  float conj[4] = {q[0], -q[1], -q[2], -q[3]};
+  float p[4] = {0.0f, v[0], v[1], v[2]};
+  float t[4];
+  quatMultiply(conj, p, t);
+  quatMultiply(t, q, p);
+  out[0] = p[1];
+  out[1] = p[2];
+  out[2] = p[3];
+}
+
+// Angle between two attitudes (degrees)
+// acos()は誤差が小さいとfloatの分解能が足りないため、相対回転のベクトル部から求める
+static float attitudeErrorDeg(const float a[4], const float b[4]) {
+  float conj[4] = {a[0], -a[1], -a[2], -a[3]};
+  float d[4];
+  quatMultiply(conj, b, d);
+  float v = sqrtf(d[1] * d[1] + d[2] * d[2] + d[3] * d[3]);
+  return 2.0f * atan2f(v, fabsf(d[0])) * (float)RAD_TO_DEG;
+}
+
+// Inverse of AHRSEngine::fromDeviceAxes()
+static void toDeviceAxes(const float body[3], float device[3]) {
+  device[0] = -body[1];
+  device[1] = body[0];
+  device[2] = body[2];
+}
+
+// Fusion steps of SensorTask::processSample() (device axes in, attitude out)
+class FusionPipeline {
+public:
+  FusionPipeline(AHRSAlgorithm algorithm, uint16_t rateHz)
+    : _ahrs(algorithm), _rateHz(rateHz), _lastSampleUs(0) {}
+  
+  void process(const float acc[3], const float gyro[3], const float mag[3],
+               float temperature, int64_t timestampUs) {
+    // 実測dtを計算（異常値は公称周期に置き換える）
+    float nominalDt = 1.0f / _rateHz;
+    float dt = nominalDt;
+    if (_lastSampleUs != 0) {
+      dt = (timestampUs - _lastSampleUs) * 1e-6f;
+      if (dt <= 0.0f || dt > 0.1f) {
+        dt = nominalDt;
+      }
+    }
+    _lastSampleUs = timestampUs;
+    
+    _gyroBias.update(gyro, acc, mag, temperature, dt);
+    float bias[3] = {0.0f, 0.0f, 0.0f};
+    _gyroBias.getBias(temperature, bias);
+    
+    float accBody[3], gyroBody[3], magBody[3], biasBody[3];
+    AHRSEngine::fromDeviceAxes(acc, accBody);
+    AHRSEngine::fromDeviceAxes(gyro, gyroBody);
+    AHRSEngine::fromDeviceAxes(bias, biasBody);
+    if (mag != nullptr) {
+      AHRSEngine::fromDeviceAxes(mag, magBody);
+    }
+    _ahrs.setGyroBias(biasBody);
+    _ahrs.update(accBody, gyroBody, mag != nullptr ? magBody : nullptr, dt);
+  }
+  
+  const AHRSEngine& ahrs() const { return _ahrs; }
+  const GyroBiasEstimator& gyroBias() const { return _gyroBias; }
+
+private:
+  AHRSEngine _ahrs;
+  GyroBiasEstimator _gyroBias;
+  uint16_t _rateHz;
+  int64_t _lastSampleUs;
+};
+
+// Result line with a pass/fail mark
+static bool check(const char* name, double value, double limit, const char* unit) {
+  bool ok = value <= limit;
+  printf("  %-34s %10.4f %-6s (limit %g) %s\n", name, value, unit, limit, ok ? "ok" : "FAIL");
+  return ok;
+}
+
+// Wall-clock limits only fail the run with --strict-timing
+static bool strictTiming = false;
+
+static bool checkTiming(const char* name, double value, double limit, const char* unit) {
+  bool ok = value <= limit;
+  printf("  %-34s %10.4f %-6s (limit %g) %s\n", name, value, unit, limit,
+         ok ? "ok" : (strictTiming ? "FAIL" : "slow"));
+  return ok || !strictTiming;
+}
+
+// --- Bench ---
+
+// Still, slew in azimuth, tilt change, still (truth known at every sample)
+static bool benchFusion(AHRSAlgorithm algorithm) {
+  printf("%s fusion\n", AHRSEngine::getAlgorithmName(algorithm));
+  
+  const float gyroBias[3] = {0.30f, -0.20f, 0.10f};   // 本体座標系（dps）
+  const float incl = BENCH_INCLINATION * (float)DEG_TO_RAD;
+  const float field[3] = {BENCH_FIELD_UT * cosf(incl), 0.0f, -BENCH_FIELD_UT * sinf(incl)};
+  const float up[3] = {0.0f, 0.0f, 1.0f};
+  
+  // 初期姿勢: 北へ向けて35度傾けた状態
+  float truth[4];
+  quatFromAxisAngle(0.0f, 1.0f, 0.0f, -35.0f * (float)DEG_TO_RAD, truth);
+  
+  Noise noise(12345);
+  FusionPipeline pipeline(algorithm, BENCH_RATE_HZ);
+  const float dt = 1.0f / BENCH_RATE_HZ;
+  const int total = 60 * BENCH_RATE_HZ;
+  float maxError = 0.0f;
+  float finalError = 0.0f;
+  double costNs = 0.0;
+  
+  for (int i = 0; i < total; i++) {
+    float t = i * dt;
+    
+    // 水平座標系での角速度: 10-30秒は方位方向に9dps、30-40秒は傾きを3dps
+    float rate[3] = {0.0f, 0.0f, 0.0f};
+    if (t >= 10.0f && t < 30.0f) {
+      rate[2] = 9.0f;
+    } else if (t >= 30.0f && t < 40.0f) {
+      rate[1] = 3.0f;
+    }
+    float rateNorm = sqrtf(rate[0] * rate[0] + rate[1] * rate[1] + rate[2] * rate[2]);
+    if (rateNorm > 0.0f) {
+      float step[4];
+      quatFromAxisAngle(rate[0] / rateNorm, rate[1] / rateNorm, rate[2] / rateNorm,
+                        rateNorm * dt * (float)DEG_TO_RAD, step);
+      quatMultiply(step, truth, truth);
+    }
+    
+    float accBody[3], magBody[3], gyroBody[3];
+    toBody(truth, up, accBody);
+    toBody(truth, field, magBody);
+    toBody(truth, rate, gyroBody);
+    for (int axis = 0; axis < 3; axis++) {
+      accBody[axis] += noise.gaussian(BENCH_ACC_NOISE_G);
+      magBody[axis] += noise.gaussian(BENCH_MAG_NOISE_UT);
+      gyroBody[axis] += gyroBias[axis] + noise.gaussian(BENCH_GYRO_NOISE_DPS);
+    }
+    
+    float acc[3], gyro[3], mag[3];
+    toDeviceAxes(accBody, acc);
+    toDeviceAxes(gyroBody, gyro);
+    toDeviceAxes(magBody, mag);
+    
+    int64_t timestampUs = 1000000LL + (int64_t)i * 1000000LL / BENCH_RATE_HZ;
+    halHostSetTimeUs(timestampUs);
+    BenchClock::time_point start = BenchClock::now();
+    pipeline.process(acc, gyro, mag, 25.0f, timestampUs);
+    costNs += elapsedNs(start, 1);
+    
+    float q[4];
+    pipeline.ahrs().getQuaternion(q);
+    float error = attitudeErrorDeg(q, truth);
+    if (t >= 5.0f && error > maxError) {
+      maxError = error;
+    }
+    finalError = error;
+  }
+  
+  // 静止区間で推定したバイアス（デバイス座標系）と真値の差
+  float bias[3], biasTruth[3];
+  bool biasOk = pipeline.gyroBias().getBias(25.0f, bias);
+  toDeviceAxes(gyroBias, biasTruth);
+  float biasError = 0.0f;
+  for (int axis = 0; axis < 3; axis++) {
+    biasError = fmaxf(biasError, fabsf(bias[axis] - biasTruth[axis]));
+  }
+  
+  bool ok = true;
+  ok &= check("attitude error after 5 s (max)", maxError, BENCH_AHRS_MAX_ERROR_DEG, "deg");
+  ok &= check("attitude error at the end", finalError, BENCH_AHRS_FINAL_ERROR_DEG, "deg");
+  ok &= check("gyro bias error", biasOk ? biasError : 1e9, BENCH_BIAS_MAX_ERROR_DPS, "dps");
+  ok &= checkTiming("cost per sample", costNs / total, BENCH_AHRS_MAX_NS, "ns");
+  return ok;
+}
+
+// Display latency compensation: extrapolate a tilted attitude turning in azimuth
+static bool benchPrediction() {
+  printf("Latency prediction\n");
+  
+  const float rate[3] = {0.0f, 0.0f, 20.0f};   // 水平座標系で方位方向に20dps
+  const float lead = 0.060f;                    // 60ms先
+  float start[4], step[4], truth[4];
+  quatFromAxisAngle(0.0f, 1.0f, 0.0f, -35.0f * (float)DEG_TO_RAD, start);
+  quatFromAxisAngle(0.0f, 0.0f, 1.0f, rate[2] * lead * (float)DEG_TO_RAD, step);
+  quatMultiply(step, start, truth);
+  
+  // 体軸の角速度は描画時のスナップショットと同じくジャイロから得る
+  float gyroBody[3];
+  toBody(start, rate, gyroBody);
+  float predicted[4];
+  AHRSEngine::predict(start, gyroBody, lead, predicted);
+  float error = attitudeErrorDeg(predicted, truth);
+  float lag = attitudeErrorDeg(start, truth);
+  
+  const long calls = 200000;
+  float sink[4] = {0.0f, 0.0f, 0.0f, 0.0f};
+  BenchClock::time_point begin = BenchClock::now();
+  for (long i = 0; i < calls; i++) {
+    float q[4];
+    AHRSEngine::predict(start, gyroBody, lead + i * 1e-9f, q);
+    sink[0] += q[0];
+  }
+  double costNs = elapsedNs(begin, calls);
+  
+  bool ok = true;
+  printf("  %-34s %10.4f deg\n", "uncompensated lag", lag);
+  ok &= check("predicted attitude error", error, BENCH_PREDICT_MAX_ERROR_DEG, "deg");
+  ok &= checkTiming("cost per frame", costNs, BENCH_PREDICT_MAX_NS, "ns");
+  if (sink[0] == 0.0f) {
+    printf("(unexpected zero checksum)\n");
+  }
+  return ok;
+}
+
+// Fine alignment averaging: noisy still pointing, then the mount is nudged
+static bool benchAlignment() {
+  printf("Fine alignment averaging\n");
+  
+  const int rateHz = 400;
+  const float noiseDeg = 0.03f;               // 1サンプルあたりの各軸の雑音
+  const float nudgeDeg = 0.5f;                // 8秒後に方位を動かす
+  float truth[4], yaw[4];
+  quatFromAxisAngle(0.0f, 1.0f, 0.0f, -35.0f * (float)DEG_TO_RAD, truth);
+  quatFromAxisAngle(0.0f, 0.0f, 1.0f, -10.0f * (float)DEG_TO_RAD, yaw);
+  quatMultiply(yaw, truth, truth);
+  
+  Noise noise(27);
+  AlignmentAverager averager;
+  int64_t t = 0;
+  float worstError = 0.0f;
+  float worstRatio = 0.0f;
+  for (int i = 0; i < 20 * rateHz; i++) {
+    if (i == 8 * rateHz) {
+      float nudge[4];
+      quatFromAxisAngle(0.0f, 0.0f, 1.0f, nudgeDeg * (float)DEG_TO_RAD, nudge);
+      quatMultiply(nudge, truth, truth);
+    }
+    
+    float jitter[4] = {1.0f, 0.0f, 0.0f, 0.0f};
+    for (int k = 1; k < 4; k++) {
+      jitter[k] = 0.5f * noise.gaussian(noiseDeg) * (float)DEG_TO_RAD;
+    }
+    float q[4];
+    quatMultiply(jitter, truth, q);
+    averager.addSample(q, t);
+    t += 1000000 / rateHz;
+    
+    // 動かす前と後のそれぞれ最後の2秒（窓が十分に伸びた後）を評価する
+    int second = i / rateHz;
+    if (second != 6 && second != 7 && second != 18 && second != 19) {
+      continue;
+    }
+    const AlignmentEstimate& e = averager.getEstimate();
+    if (!e.valid) {
+      continue;
+    }
+    float heading, pitch, roll;
+    AHRSEngine::quaternionToEuler(truth, &heading, &pitch, &roll);
+    float dh = e.heading - heading;
+    if (dh > 180.0f) dh -= 360.0f;
+    if (dh < -180.0f) dh += 360.0f;
+    float dx = dh * cosf(pitch * (float)DEG_TO_RAD);
+    float dy = e.pitch - pitch;
+    float error = sqrtf(dx * dx + dy * dy) * 60.0f;
+    if (error > worstError) worstError = error;
+    if (e.sigmaDeg > 0.0f && error / (e.sigmaDeg * 60.0f) > worstRatio) {
+      worstRatio = error / (e.sigmaDeg * 60.0f);
+    }
+  }
+  
+  AlignmentEstimate e = averager.getEstimate();
+  const long calls = 200000;
+  BenchClock::time_point begin = BenchClock::now();
+  for (long i = 0; i < calls; i++) {
+    averager.addSample(truth, t);
+    t += 1000000 / rateHz;
+  }
+  double costNs = elapsedNs(begin, calls);
+  
+  bool ok = true;
+  printf("  %-34s %10.4f arcmin (window %.1f s)\n", "reported 1 sigma", e.sigmaDeg * 60.0f, e.windowS);
+  ok &= check("averaged pointing error", worstError, BENCH_ALIGN_MAX_ERROR_ARCMIN, "arcmin");
+  ok &= check("error / reported sigma", worstRatio, BENCH_ALIGN_MAX_SIGMA_RATIO, "");
+  bool restarted = e.resets == 1;
+  printf("  %-34s %10u        (expected 1) %s\n", "restarts after the nudge", (unsigned)e.resets,
+         restarted ? "ok" : "FAIL");
+  ok &= restarted;
+  printf("  %-34s %10.1f ns\n", "cost per sample", costNs);
+  return ok;
+}
+
+// Hard/soft-iron distorted field over random attitudes
+static bool benchMagCalibration() {
+  printf("Magnetometer calibration\n");
+  
+  const float offset[3] = {12.0f, -30.0f, 8.0f};
+  const float scale[3] = {1.10f, 0.95f, 1.02f};
+  Noise noise(777);
+  MagCalibrator calibrator;
+  const int total = 3000;
+  double costNs = 0.0;
+  
+  for (int i = 0; i < total; i++) {
+    // 球面上の一様な方向
+    float z = 2.0f * noise.uniform() - 1.0f;
+    float phi = 6.2831853f * noise.uniform();
+    float r = sqrtf(1.0f - z * z);
+    float dir[3] = {r * cosf(phi), r * sinf(phi), z};
+    float raw[3];
+    for (int axis = 0; axis < 3; axis++) {
+      raw[axis] = offset[axis] + scale[axis] * BENCH_FIELD_UT * dir[axis] +
+                  noise.gaussian(BENCH_MAG_NOISE_UT);
+    }
+    
+    BenchClock::time_point start = BenchClock::now();
+    calibrator.addSample(raw);
+    costNs += elapsedNs(start, 1);
+  }
+  
+  const MagCalibration& cal = calibrator.getCalibration();
+  float offsetError = 0.0f;
+  for (int axis = 0; axis < 3; axis++) {
+    offsetError = fmaxf(offsetError, fabsf(cal.offset[axis] - offset[axis]));
+  }
+  
+  bool ok = true;
+  ok &= check("hard-iron offset error", cal.valid ? offsetError : 1e9, BENCH_MAG_MAX_OFFSET_UT, "uT");
+  ok &= checkTiming("cost per sample", costNs / total, BENCH_MAG_MAX_NS, "ns");
+  return ok;
+}
+
+// Approximation error of the fast math helpers against libm
+static bool benchFastMath() {
+  printf("Fast math\n");
+  float atan2Error, invSqrtError, sinCosError;
+  fastMathSelfTest(&atan2Error, &invSqrtError, &sinCosError);
+  
+  // 誤差は小さいため100万倍して表示する
+  bool ok = true;
+  ok &= check("fastAtan2 max error", atan2Error * 1e6, FM_ATAN2_MAX_ERROR * 1e6, "urad");
+  ok &= check("fastInvSqrt max relative error", invSqrtError * 1e6, FM_INVSQRT_MAX_ERROR * 1e6, "ppm");
+  ok &= check("fastSinCos max error", sinCosError * 1e6, FM_SINCOS_MAX_ERROR * 1e6, "x1e-6");
+  return ok;
+}
+
+// Pole and Sun positions at known dates, and the per-call cost
+static bool benchEphemeris() {
+  printf("Ephemeris\n");
+  bool ok = true;
+  
+  // 2025年夏至（6/21 02:42 UTC）の太陽赤緯は黄道傾斜角に等しい
+  double jd = getJulianDateTime(2025, 6, 21, 2, 42, 0.0);
+  double ra, dec;
+  calculateSunEquatorial(jd, &ra, &dec);
+  ok &= check("Sun declination at the solstice", fabs(dec - 23.4362), BENCH_SUN_DEC_TOLERANCE_DEG, "deg");
+  
+  // 東京: 極の見かけの高度は緯度 + 大気差、北極星は真北から1度以内
+  const float latitude = 35.6812f;
+  const float longitude = 139.7671f;
+  Ephemeris ephemeris;
+  ephemeris.setLocation(latitude, longitude);
+  ephemeris.setAtmosphere(10.0f, 40.0f);
+  halHostSetTimeUs(1000000LL);
+  ephemeris.setTime(2025, 11, 3, 12, 0, 0);
+  ephemeris.update();
+  float poleAz = ephemeris.getPoleAzimuth();
+  if (poleAz > 180.0f) poleAz -= 360.0f;
+  ok &= check("pole altitude - latitude", fabs(ephemeris.getPoleAltitude() - latitude),
+              BENCH_POLE_ALT_TOLERANCE_DEG, "deg");
+  ok &= check("Polaris azimuth from true north", fabs(poleAz), BENCH_POLE_AZ_LIMIT_DEG, "deg");
+  
+  // update()はloop()と同じ200ms間隔で呼ぶ（約1Hzで位置を、1分ごとに赤経赤緯を更新する）
+  const long calls = 36000;
+  BenchClock::time_point start = BenchClock::now();
+  for (long i = 0; i < calls; i++) {
+    halHostSetTimeUs(1000000LL + (i + 1) * 200000LL);
+    ephemeris.update();
+  }
+  ok &= checkTiming("Ephemeris::update() (2 h at 5 Hz)", elapsedNs(start, calls), BENCH_EPHEMERIS_MAX_NS, "ns");
+  
+  // 1分ごとの再計算の中身
+  const long elementCalls = 2000;
+  double sink = 0.0;
+  float phase;
+  start = BenchClock::now();
+  for (long i = 0; i < elementCalls; i++) {
+    double t = jd + i / 1440.0;
+    calculateSunEquatorial(t, &ra, &dec);
+    sink += ra;
+    calculateMoonEquatorial(t, &ra, &dec, &phase);
+    sink += ra;
+    getPoleStarPlace(POLE_STAR_POLARIS, t, &ra, &dec);
+    sink += ra;
+  }
+  ok &= checkTiming("Sun + Moon + pole star elements", elapsedNs(start, elementCalls), BENCH_ELEMENTS_MAX_NS, "ns");
+  if (sink == 0.0) {
+    printf("(unexpected zero checksum)\n");
+  }
+  return ok;
+}
+
+static int runBench() {
+  bool ok = true;
+  ok &= benchFastMath();
+  ok &= benchFusion(AHRS_MAHONY);
+  ok &= benchFusion(AHRS_MADGWICK);
+  ok &= benchFusion(AHRS_ESKF);
+  ok &= benchPrediction();
+  ok &= benchAlignment();
+  ok &= benchMagCalibration();
+  ok &= benchEphemeris();
+  printf("%s\n", ok ? "bench passed" : "bench FAILED");
+  return ok ? 0 : 1;
+}
+
+// --- Replay ---
+
+// Numeric CSV reader for the files written by decode_session.py
+static bool readCsv(const char* path, size_t columns, std::vector<std::vector<double>>& rows) {
+  FILE* file = fopen(path, "r");
+  if (file == nullptr) {
+    return false;
+  }
+  
+  char line[512];
+  bool header = true;
+  while (fgets(line, sizeof(line), file) != nullptr) {
+    if (header) {
+      header = false;
+      continue;
+    }
+    std::vector<double> row;
+    char* p = line;
+    while (row.size() < columns && *p != '\0' && *p != '\n') {
+      char* end;
+      double value = strtod(p, &end);
+      row.push_back(end == p ? NAN : value);
+      p = strchr(p, ',');
+      if (p == nullptr) {
+        break;
+      }
+      p++;
+    }
+    if (row.size() == columns) {
+      rows.push_back(row);
+    }
+  }
+  fclose(file);
+  return true;
+}
+
+static int runReplay(const char* prefix, AHRSAlgorithm algorithm) {
+  std::vector<std::vector<double>> imu, magcal, gps, orient, align;
+  char path[256];
+  snprintf(path, sizeof(path), "%s_imu.csv", prefix);
+  if (!readCsv(path, 11, imu) || imu.empty()) {
+    fprintf(stderr, "no IMU samples in %s\n", path);
+    return 1;
+  }
+  snprintf(path, sizeof(path), "%s_magcal.csv", prefix);
+  readCsv(path, 14, magcal);
+  snprintf(path, sizeof(path), "%s_gps.csv", prefix);
+  readCsv(path, 9, gps);
+  snprintf(path, sizeof(path), "%s_orient.csv", prefix);
+  readCsv(path, 14, orient);
+  snprintf(path, sizeof(path), "%s_align.csv", prefix);
+  readCsv(path, 5, align);
+  
+  // 記録の間隔から公称のサンプリング周期を推定する
+  double span = imu.back()[0] - imu.front()[0];
+  uint16_t rateHz = span > 0.0 ? (uint16_t)(imu.size() / span + 0.5) : 200;
+  FusionPipeline pipeline(algorithm, rateHz ? rateHz : 200);
+  Ephemeris ephemeris;
+  MagCalibrator magCal;
+  int magCalIndex = -1;
+  long magSamples = 0;
+  
+  size_t gpsIndex = 0, orientIndex = 0, alignIndex = 0;
+  float temperature = NAN;
+  double pitchSum2 = 0.0, rollSum2 = 0.0, pitchMax = 0.0, rollMax = 0.0;
+  double headingSum2 = 0.0, headingMax = 0.0;
+  long attitudeCount = 0;
+  double azSum2 = 0.0, altSum2 = 0.0, azMax = 0.0, altMax = 0.0;
+  long poleCount = 0;
+  double costNs = 0.0;
+  
+  for (const std::vector<double>& s : imu) {
+    double t = s[0];
+    int64_t timestampUs = (int64_t)(t * 1e6) + 1000000LL;
+    halHostSetTimeUs(timestampUs);
+    
+    // この時刻までのGPSで位置と時刻を合わせる（装置と同じくGPSの時刻を基準にする）
+    while (gpsIndex < gps.size() && gps[gpsIndex][0] <= t) {
+      const std::vector<double>& g = gps[gpsIndex++];
+      if (g[1] > 0) {
+        int year, month, day, hour, minute, second;
+        TimeBase::fromUnixSeconds((int64_t)g[1], &year, &month, &day, &hour, &minute, &second);
+        ephemeris.setTime(year, month, day, hour, minute, second);
+      }
+      ephemeris.setLocation((float)g[2], (float)g[3]);
+      ephemeris.setAtmosphere(isnan(temperature) ? 10.0f : temperature, (float)g[4]);
+    }
+    
+    // 地磁気は装置と同じく記録された較正を当ててから渡す（読めなかったバッチは6軸）
+    int index = isnan(s[10]) ? -1 : (int)s[10];
+    if (index != magCalIndex && index >= 0 && index < (int)magcal.size()) {
+      const std::vector<double>& c = magcal[index];
+      MagCalibration calibration = magCal.getCalibration();
+      calibration.valid = c[1] != 0.0;
+      for (int i = 0; i < 3; i++) {
+        calibration.offset[i] = (float)c[2 + i];
+        for (int j = 0; j < 3; j++) {
+          calibration.softIron[i][j] = (float)c[5 + i * 3 + j];
+        }
+      }
+      magCal.setCalibration(calibration);
+      magCalIndex = index;
+    }
+    float mag[3];
+    bool magOk = !isnan(s[7]) && !isnan(s[8]) && !isnan(s[9]);
+    if (magOk) {
+      float raw[3] = {(float)s[7], (float)s[8], (float)s[9]};
+      magCal.apply(raw, mag);
+      magSamples++;
+    }
+    
+    float acc[3] = {(float)s[1], (float)s[2], (float)s[3]};
+    float gyro[3] = {(float)s[4], (float)s[5], (float)s[6]};
+    BenchClock::time_point start = BenchClock::now();
+    pipeline.process(acc, gyro, magOk ? mag : nullptr, temperature, timestampUs);
+    costNs += elapsedNs(start, 1);
+    
+    // 記録された姿勢と方位・ピッチ・ロールを比べる
+    while (orientIndex < orient.size() && orient[orientIndex][0] <= t) {
+      const std::vector<double>& o = orient[orientIndex++];
+      temperature = (float)o[10];
+      if (t - imu.front()[0] < REPLAY_SETTLE_S || !pipeline.ahrs().isInitialized()) {
+        continue;
+      }
+      float recorded[4] = {(float)o[1], (float)o[2], (float)o[3], (float)o[4]};
+      float q[4];
+      pipeline.ahrs().getQuaternion(q);
+      float h0, p0, r0, h1, p1, r1;
+      AHRSEngine::quaternionToEuler(recorded, &h0, &p0, &r0);
+      AHRSEngine::quaternionToEuler(q, &h1, &p1, &r1);
+      double dh = fabs(h1 - h0);
+      if (dh > 180.0) dh = 360.0 - dh;
+      double dp = fabs(p1 - p0);
+      double dr = fabs(r1 - r0);
+      if (dr > 180.0) dr = 360.0 - dr;
+      headingSum2 += dh * dh;
+      headingMax = fmax(headingMax, dh);
+      pitchSum2 += dp * dp;
+      rollSum2 += dr * dr;
+      pitchMax = fmax(pitchMax, dp);
+      rollMax = fmax(rollMax, dr);
+      attitudeCount++;
+    }
+    
+    // 極の位置を装置の計算と比べる
+    while (alignIndex < align.size() && align[alignIndex][0] <= t) {
+      const std::vector<double>& a = align[alignIndex++];
+      ephemeris.update();
+      if (!ephemeris.hasTime()) {
+        continue;
+      }
+      double daz = fabs(ephemeris.getPoleAzimuth() - a[3]);
+      if (daz > 180.0) daz = 360.0 - daz;
+      double dalt = fabs(ephemeris.getPoleAltitude() - a[4]);
+      azSum2 += daz * daz;
+      altSum2 += dalt * dalt;
+      azMax = fmax(azMax, daz);
+      altMax = fmax(altMax, dalt);
+      poleCount++;
+    }
+  }
+  
+  printf("replay %s: %zu IMU samples (%u Hz), %zu GPS, %zu orientation, %zu alignment records\n",
+         prefix, imu.size(), (unsigned)rateHz, gps.size(), orient.size(), align.size());
+  printf("%s fusion (%ld of %zu samples with magnetometer): %.0f ns/sample\n",
+         AHRSEngine::getAlgorithmName(algorithm), magSamples, imu.size(), costNs / imu.size());
+  
+  // ピッチ・ロールと極の位置のRMSで合否を決める（方位と最大値は参考）
+  bool ok = true;
+  if (attitudeCount > 0) {
+    if (magSamples > 0) {
+      printf("  heading vs device: rms %.3f, max %.3f deg\n",
+             sqrt(headingSum2 / attitudeCount), headingMax);
+    }
+    printf("  pitch vs device: max %.3f deg, roll vs device: max %.3f deg\n", pitchMax, rollMax);
+    ok &= check("pitch vs device (rms)", sqrt(pitchSum2 / attitudeCount), REPLAY_MAX_TILT_RMS_DEG, "deg");
+    ok &= check("roll vs device (rms)", sqrt(rollSum2 / attitudeCount), REPLAY_MAX_TILT_RMS_DEG, "deg");
+  }
+  if (poleCount > 0) {
+    printf("pole position vs device (%ld records): max azimuth %.4f, altitude %.4f deg\n",
+           poleCount, azMax, altMax);
+    ok &= check("pole azimuth (rms)", sqrt(azSum2 / poleCount), REPLAY_MAX_POLE_RMS_DEG, "deg");
+    ok &= check("pole altitude (rms)", sqrt(altSum2 / poleCount), REPLAY_MAX_POLE_RMS_DEG, "deg");
+  }
+  printf("%s\n", ok ? "replay passed" : "replay FAILED");
+  return ok ? 0 : 1;
+}
+
+static bool parseAlgorithm(const char* name, AHRSAlgorithm* algorithm) {
+  for (int i = 0; i < AHRS_ALGORITHM_COUNT; i++) {
+    if (strcasecmp(name, AHRSEngine::getAlgorithmName((AHRSAlgorithm)i)) == 0) {
+      *algorithm = (AHRSAlgorithm)i;
+      return true;
+    }
+  }
+  return false;
+}
+
+int main(int argc, char** argv) {
+  if (argc >= 2 && strcmp(argv[1], "bench") == 0) {
+    strictTiming = argc >= 3 && strcmp(argv[2], "--strict-timing") == 0;
+    return runBench();
+  }
+  if (argc >= 3 && strcmp(argv[1], "replay") == 0) {
+    AHRSAlgorithm algorithm = AHRS_MAHONY;
+    if (argc >= 4 && !parseAlgorithm(argv[3], &algorithm)) {
+      fprintf(stderr, "unknown algorithm %s\n", argv[3]);
+      return 1;
+    }
+    return runReplay(argv[2], algorithm);
+  }
+  
+  fprintf(stderr, "usage: %s bench [--strict-timing] | replay <prefix> [mahony|madgwick|eskf]\n",
+          argv[0]);
+  return 1;
+}